@@ -82,6 +82,9 @@ static const dma_conf_t dma_config[] = {
     { .stream = 6  },
     { .stream = 10 },
     { .stream = 8  },
+    { .stream = 1  },
+    { .stream = 9  },
+    { .stream = 5  },
 };
 
 #define DMA_0_ISR  isr_dma1_stream4
@@ -89,6 +92,9 @@ static const dma_conf_t dma_config[] = {
 #define DMA_2_ISR  isr_dma1_stream6
 #define DMA_3_ISR  isr_dma2_stream2
 #define DMA_4_ISR  isr_dma2_stream0
+#define DMA_5_ISR  isr_dma1_stream1
+#define DMA_6_ISR  isr_dma2_stream1
+#define DMA_7_ISR  isr_dma1_stream5
 
 #define DMA_NUMOF           (sizeof(dma_config) / sizeof(dma_config[0]))
 #endif
@@ -130,6 +136,10 @@ static const uart_conf_t uart_config[] = {
 #ifdef MODULE_PERIPH_DMA
         .dma        = 0,
         .dma_chan   = 7,
+#endif
+#ifdef MODULE_PERIPH_UART_DMA
+        .rx_dma     = 5,
+        .rx_dma_chan = 4,
 #endif
     },
     {
@@ -144,6 +154,10 @@ static const uart_conf_t uart_config[] = {
 #ifdef MODULE_PERIPH_DMA
         .dma        = 1,
         .dma_chan   = 5,
+#endif
+#ifdef MODULE_PERIPH_UART_DMA
+        .rx_dma     = 6,
+        .rx_dma_chan = 5,
 #endif
     },
     {
@@ -158,6 +172,10 @@ static const uart_conf_t uart_config[] = {
 #ifdef MODULE_PERIPH_DMA
         .dma        = 3,
         .dma_chan   = 4,
+#endif
+#ifdef MODULE_PERIPH_UART_DMA
+        .rx_dma     = 7,
+        .rx_dma_chan = 4,
 #endif
     },
 };
@@ -24,13 +24,20 @@
 #include "cpu.h"
 #include "panic.h"
 #include "riotboot/slot.h"
+#ifdef MODULE_RIOTBOOT_VERIFY
+#include "riotboot/verify.h"
+#endif
 
 void kernel_init(void)
 {
     /* bootloader boots only slot 0 if it is valid */
     unsigned slot = 0;
 
+#ifdef MODULE_RIOTBOOT_VERIFY
+    if (riotboot_verify_slot(slot) == 0) {
+#else
     if (riotboot_slot_validate(slot) == 0) {
+#endif
         riotboot_slot_jump(slot);
     }
 
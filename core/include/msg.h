@@ -309,6 +309,59 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Send multiple messages to a thread at once (non-blocking).
+ *
+ * If the target thread is waiting for a message, the first message is
+ * delivered directly. All further messages are put into the target's message
+ * queue until it is full. All messages are handled in a single critical
+ * section and the scheduler is called at most once afterwards, so the current
+ * thread is only preempted if the target has a higher priority.
+ *
+ * Can also be called from an ISR, in which case ``sender_pid`` of all
+ * messages is set to @ref KERNEL_PID_ISR.
+ *
+ * @param[in] m             Array of @p numof preallocated ``msg_t``
+ *                          structures, must not be NULL.
+ * @param[in] numof         Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  Number of messages delivered, starting at the beginning of @p m
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_bulk(msg_t *m, unsigned numof, kernel_pid_t target_pid);
+
+/**
+ * @brief Receive multiple messages at once.
+ *
+ * This function blocks until at least one message was received. Up to
+ * @p numof messages are then taken from the message queue and from blocked
+ * senders in a single critical section, in the order they were sent. The
+ * scheduler is called at most once, with the highest priority of all senders
+ * that got unblocked.
+ *
+ * @param[out] m        Array of @p numof preallocated ``msg_t`` structures,
+ *                      must not be NULL.
+ * @param[in]  numof    Maximum number of messages to receive, must be > 0.
+ *
+ * @return  Number of messages received (>= 1)
+ */
+int msg_receive_bulk(msg_t *m, unsigned numof);
+
+/**
+ * @brief Try to receive multiple messages at once.
+ *
+ * Same as msg_receive_bulk() but does not block if no message can be
+ * received.
+ *
+ * @param[out] m        Array of @p numof preallocated ``msg_t`` structures,
+ *                      must not be NULL.
+ * @param[in]  numof    Maximum number of messages to receive, must be > 0.
+ *
+ * @return  Number of messages received, 0 if there was none
+ */
+int msg_try_receive_bulk(msg_t *m, unsigned numof);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -25,6 +25,7 @@
 #include <stddef.h>
 
 #include "list.h"
+#include "kernel_types.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -32,26 +33,63 @@
 
 /**
  * @brief Mutex structure. Must never be modified by the user.
+ *
+ * If the module `core_mutex_priority_inheritance` is used, a thread that
+ * blocks on a locked mutex temporarily lends its priority to the current
+ * owner if that one is running at a lower priority. Whenever the owner
+ * unlocks a mutex, its priority is recomputed from the priority it was
+ * created with and the waiters of the mutexes it still holds, so mutexes can
+ * be unlocked in any order. This bounds the time a high priority thread waits
+ * for a mutex held by a low priority thread, which otherwise could be
+ * preempted by medium priority threads indefinitely (see
+ * tests/thread_priority_inversion and tests/mutex_priority_inheritance).
+ *
+ * @note    The boost is not propagated if the owner itself is blocked on
+ *          another mutex.
  */
-typedef struct {
+typedef struct mutex {
     /**
      * @brief   The process waiting queue of the mutex. **Must never be changed
      *          by the user.**
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The current owner of the mutex or @ref KERNEL_PID_UNDEF
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   The next mutex held by the same owner
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     * @internal
+     */
+    struct mutex *next_held;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, NULL }
+#else
 #define MUTEX_INIT { { NULL } }
+#endif
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, NULL }
+#else
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -72,6 +110,10 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+    mutex->next_held = NULL;
+#endif
 }
 
 /**
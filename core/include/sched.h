@@ -119,6 +119,21 @@ int sched_run(void);
  */
 void sched_set_status(thread_t *process, unsigned int status);
 
+/**
+ * @brief   Change the priority of the given thread
+ *
+ * @details If the thread is on the runqueue, it is moved to the runqueue of
+ *          its new priority. The caller is responsible for triggering the
+ *          scheduler afterwards, e.g. by calling sched_switch().
+ *
+ * @pre     Interrupts are disabled
+ * @pre     @p priority is less than @ref SCHED_PRIO_LEVELS
+ *
+ * @param[in,out]   thread      The thread to change the priority of
+ * @param[in]       priority    The new priority to apply
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief       Yield if approriate.
  *
@@ -198,6 +213,65 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 void sched_register_cb(void (*callback)(uint32_t, uint32_t));
 #endif /* MODULE_SCHEDSTATISTICS */
 
+#if defined(MODULE_SCHEDLATENCY) || defined(DOXYGEN)
+/**
+ * @brief   Number of buckets of the wake-to-run latency histogram
+ *
+ * Bucket 0 counts latencies of 0 ticks, bucket n > 0 latencies in
+ * [2^(n-1), 2^n) ticks. The last bucket also counts all larger latencies.
+ */
+#ifndef SCHEDLATENCY_BUCKETS
+#define SCHEDLATENCY_BUCKETS    (16U)
+#endif
+
+/**
+ *  Wake-to-run latency statistics of a thread
+ */
+typedef struct {
+    uint32_t woken;     /**< xtimer time stamp of the last wake-up */
+    uint32_t max;       /**< maximum latency in xtimer ticks */
+    uint16_t hist[SCHEDLATENCY_BUCKETS];    /**< log2 latency histogram,
+                                                 saturates at UINT16_MAX */
+    uint8_t waiting;    /**< thread was woken up but did not run yet */
+} schedlat_t;
+
+/**
+ *  Thread latency table
+ */
+extern schedlat_t sched_latency[KERNEL_PID_LAST + 1];
+
+/**
+ *  Longest time interrupts were disabled, in CPU cycles
+ *
+ *  Only updated by CPUs that can measure it (currently Cortex-M3 and up),
+ *  0 otherwise.
+ */
+extern volatile uint32_t sched_irq_off_max;
+
+/**
+ *  @brief  Resets all latency statistics
+ */
+void sched_latency_reset(void);
+#endif /* MODULE_SCHEDLATENCY */
+
+#if defined(MODULE_SCHEDSTACK) || defined(DOXYGEN)
+/**
+ *  Stack high-water marks in bytes, indexed by PID
+ *
+ *  The stack pointer of a thread is sampled whenever the thread is switched
+ *  out, so this is a lower bound of the real maximum: stack used only between
+ *  two context switches goes unnoticed. Unlike the stack fill pattern of
+ *  @ref thread_measure_stack_free, sampling costs a subtraction and a compare
+ *  per context switch and does not need DEVELHELP.
+ */
+extern unsigned sched_stack_max[KERNEL_PID_LAST + 1];
+
+/**
+ *  @brief  Resets the stack high-water marks of all threads
+ */
+void sched_stack_reset(void);
+#endif /* MODULE_SCHEDSTACK */
+
 #ifdef __cplusplus
 }
 #endif
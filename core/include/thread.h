@@ -188,6 +188,12 @@ struct _thread {
 
     clist_node_t rq_entry;          /**< run queue entry                */
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    uint8_t base_priority;          /**< priority without the boost of
+                                         mutex waiters                  */
+    struct mutex *mutexes_held;     /**< mutexes owned by the thread    */
+#endif
+
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
     || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
     void *wait_data;                /**< used by msg, mbox and thread
@@ -203,11 +209,14 @@ struct _thread {
                                          to this thread's message queue */
 #endif
 #if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
-    || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
+    || defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_SCHEDSTACK) \
+    || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
 #endif
 #if defined(DEVELHELP) || defined(DOXYGEN)
     const char *name;               /**< thread's name                  */
+#endif
+#if defined(DEVELHELP) || defined(MODULE_SCHEDSTACK) || defined(DOXYGEN)
     int stack_size;                 /**< thread's stack size            */
 #endif
 #ifdef HAVE_THREAD_ARCH_T
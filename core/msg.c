@@ -32,6 +32,9 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#ifdef MODULE_TRACEBUF
+#include "tracebuf.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -91,6 +94,10 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
 
     m->sender_pid = sched_active_pid;
 
+#ifdef MODULE_TRACEBUF
+    tracebuf_add(TRACEBUF_MSG_SEND, ((uint32_t)target_pid << 16) | m->type);
+#endif
+
     if (target == NULL) {
         DEBUG("msg_send(): target thread does not exist\n");
         irq_restore(state);
@@ -164,8 +171,12 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
         *target_message = *m;
         sched_set_status(target, STATUS_PENDING);
 
+        /* only switch if the receiver preempts us or we wait for a reply,
+         * this saves a context switch round trip on plain sends to lower
+         * priority receivers */
+        uint16_t target_prio = target->priority;
         irq_restore(state);
-        thread_yield_higher();
+        sched_switch(target_prio);
     }
 
     return 1;
@@ -198,6 +209,9 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     }
 
     m->sender_pid = KERNEL_PID_ISR;
+#ifdef MODULE_TRACEBUF
+    tracebuf_add(TRACEBUF_MSG_SEND, ((uint32_t)target_pid << 16) | m->type);
+#endif
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("msg_send_int: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", thread_getpid(), target_pid);
@@ -276,14 +290,27 @@ int msg_reply_int(msg_t *m, msg_t *reply)
     return 1;
 }
 
+#ifdef MODULE_TRACEBUF
+static inline int _trace_receive(msg_t *m, int res)
+{
+    if (res == 1) {
+        tracebuf_add(TRACEBUF_MSG_RECV,
+                     ((uint32_t)m->sender_pid << 16) | m->type);
+    }
+    return res;
+}
+#else
+#define _trace_receive(m, res)  (res)
+#endif
+
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    return _trace_receive(m, _msg_receive(m, 0));
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    return _trace_receive(m, _msg_receive(m, 1));
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -372,6 +399,134 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_send_bulk(msg_t *m, unsigned numof, kernel_pid_t target_pid)
+{
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_bulk(): target_pid is invalid, continuing anyways\n");
+    }
+#endif /* DEVELHELP */
+
+    kernel_pid_t sender_pid = irq_is_in() ? KERNEL_PID_ISR : sched_active_pid;
+    unsigned state = irq_disable();
+    thread_t *target = (thread_t *) sched_threads[target_pid];
+
+    if (target == NULL) {
+        DEBUG("msg_send_bulk(): target thread does not exist\n");
+        irq_restore(state);
+        return -1;
+    }
+
+    unsigned sent = 0;
+    int woken = 0;
+
+    if ((numof > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_bulk: Direct msg copy to %" PRIkernel_pid ".\n",
+              target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *) target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = 1;
+        sent++;
+    }
+
+    for (; sent < numof; sent++) {
+        m[sent].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[sent])) {
+            break;
+        }
+    }
+
+    DEBUG("msg_send_bulk: %u of %u messages delivered to %" PRIkernel_pid
+          ".\n", sent, numof, target_pid);
+
+    uint16_t target_prio = target->priority;
+    irq_restore(state);
+    if (woken) {
+        sched_switch(target_prio);
+    }
+    return sent;
+}
+
+static int _msg_receive_bulk(msg_t *m, unsigned numof, int block)
+{
+    assert(numof > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = (thread_t *) sched_active_thread;
+    unsigned received = 0;
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    int queue_index;
+
+    /* queued messages were sent before the ones of blocked senders */
+    if (thread_has_msg_queue(me)) {
+        while ((received < numof) &&
+               ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+            m[received++] = me->msg_array[queue_index];
+        }
+    }
+
+    /* take messages of blocked senders, the ones not fitting into m are
+     * moved to the just freed queue space */
+    while (me->msg_waiters.next) {
+        msg_t *dest;
+
+        if (received < numof) {
+            dest = &m[received++];
+        }
+        else if (thread_has_msg_queue(me) &&
+                 ((queue_index = cib_put(&(me->msg_queue))) >= 0)) {
+            dest = &me->msg_array[queue_index];
+        }
+        else {
+            break;
+        }
+
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+        thread_t *sender = container_of((clist_node_t*)next, thread_t, rq_entry);
+
+        *dest = *((msg_t *) sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    if (received == 0) {
+        if (!block) {
+            irq_restore(state);
+            return 0;
+        }
+        DEBUG("_msg_receive_bulk(): %" PRIkernel_pid ": No msg in queue. "
+              "Going blocked.\n", me->pid);
+        me->wait_data = (void *) m;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+        irq_restore(state);
+        thread_yield_higher();
+        /* sender copied message */
+        return 1;
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return received;
+}
+
+int msg_receive_bulk(msg_t *m, unsigned numof)
+{
+    return _msg_receive_bulk(m, numof, 1);
+}
+
+int msg_try_receive_bulk(msg_t *m, unsigned numof)
+{
+    return _msg_receive_bulk(m, numof, 0);
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -32,6 +32,126 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static inline void _set_owner(mutex_t *mutex, thread_t *thread)
+{
+    if (thread) {
+        mutex->owner = thread->pid;
+        mutex->next_held = thread->mutexes_held;
+        thread->mutexes_held = mutex;
+    }
+}
+
+static inline void _boost_owner(mutex_t *mutex, uint8_t priority)
+{
+    if (mutex->owner == KERNEL_PID_UNDEF) {
+        return;
+    }
+
+    thread_t *owner = (thread_t *)sched_threads[mutex->owner];
+
+    if (owner && (owner->priority > priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: boosting owner %" PRIkernel_pid
+              " to prio %" PRIu8 "\n", sched_active_pid, owner->pid, priority);
+        sched_change_priority(owner, priority);
+    }
+}
+
+/* applies the highest priority of the thread itself and of all threads
+ * waiting for a mutex it holds, returns 1 if the priority was lowered */
+static int _update_priority(thread_t *thread)
+{
+    uint8_t priority = thread->base_priority;
+
+    for (mutex_t *m = thread->mutexes_held; m; m = m->next_held) {
+        if (m->queue.next == MUTEX_LOCKED) {
+            continue;
+        }
+        for (list_node_t *n = m->queue.next; n; n = n->next) {
+            thread_t *waiter = container_of((clist_node_t *)n, thread_t,
+                                            rq_entry);
+
+            if (waiter->priority < priority) {
+                priority = waiter->priority;
+            }
+        }
+    }
+
+    int lowered = (priority > thread->priority);
+
+    sched_change_priority(thread, priority);
+    return lowered;
+}
+
+/* removes the mutex from the mutexes held by its owner and updates the
+ * priority of the owner, returns 1 if the priority was lowered */
+static int _release_owner(mutex_t *mutex)
+{
+    thread_t *owner = NULL;
+
+    if (mutex->owner != KERNEL_PID_UNDEF) {
+        owner = (thread_t *)sched_threads[mutex->owner];
+    }
+    mutex->owner = KERNEL_PID_UNDEF;
+    if (owner == NULL) {
+        return 0;
+    }
+
+    for (mutex_t **m = &owner->mutexes_held; *m; m = &(*m)->next_held) {
+        if (*m == mutex) {
+            *m = mutex->next_held;
+            break;
+        }
+    }
+    mutex->next_held = NULL;
+    return _update_priority(owner);
+}
+
+/* hands the mutex to a woken waiter, which inherits the priority of the
+ * remaining waiters */
+static inline void _handover(mutex_t *mutex, thread_t *thread)
+{
+    _set_owner(mutex, thread);
+    _update_priority(thread);
+}
+#else
+static inline void _set_owner(mutex_t *mutex, thread_t *thread)
+{
+    (void)mutex;
+    (void)thread;
+}
+
+static inline void _boost_owner(mutex_t *mutex, uint8_t priority)
+{
+    (void)mutex;
+    (void)priority;
+}
+
+static inline int _release_owner(mutex_t *mutex)
+{
+    (void)mutex;
+    return 0;
+}
+
+static inline void _handover(mutex_t *mutex, thread_t *thread)
+{
+    (void)mutex;
+    (void)thread;
+}
+#endif
+
+/* lets the scheduler pick the next thread, after the running one may have
+ * lost the priority inherited from waiters */
+static void _reschedule(void)
+{
+    if (irq_is_in()) {
+        sched_context_switch_request = 1;
+    }
+    else {
+        thread_yield_higher();
+    }
+}
+
 int _mutex_lock(mutex_t *mutex, int blocking)
 {
     unsigned irqstate = irq_disable();
@@ -41,6 +161,7 @@ int _mutex_lock(mutex_t *mutex, int blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, (thread_t *)sched_active_thread);
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               sched_active_pid);
         irq_restore(irqstate);
@@ -58,6 +179,7 @@ int _mutex_lock(mutex_t *mutex, int blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+        _boost_owner(mutex, me->priority);
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
@@ -86,7 +208,13 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+        int lowered = _release_owner(mutex);
         irq_restore(irqstate);
+        if (lowered) {
+            /* a waiter gave up (e.g. on timeout), but the owner was still
+             * boosted: a thread with higher priority might be runnable now */
+            _reschedule();
+        }
         return;
     }
 
@@ -102,9 +230,18 @@ void mutex_unlock(mutex_t *mutex)
         mutex->queue.next = MUTEX_LOCKED;
     }
 
+    int lowered = _release_owner(mutex);
+    _handover(mutex, process);
+
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
-    sched_switch(process_priority);
+    if (lowered) {
+        /* not only the woken thread might preempt the unlocking one now */
+        _reschedule();
+    }
+    else {
+        sched_switch(process_priority);
+    }
 }
 
 void mutex_unlock_and_sleep(mutex_t *mutex)
@@ -114,6 +251,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+        _release_owner(mutex);
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -126,6 +264,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            _handover(mutex, process);
         }
     }
 
@@ -20,6 +20,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 
 #include "sched.h"
 #include "clist.h"
@@ -28,15 +29,24 @@
 #include "thread.h"
 #include "irq.h"
 #include "log.h"
+#include "assert.h"
 
 #ifdef MODULE_MPU_STACK_GUARD
 #include "mpu.h"
 #endif
 
-#ifdef MODULE_SCHEDSTATISTICS
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#include "mutex.h"
+#endif
+
+#if defined(MODULE_SCHEDSTATISTICS) || defined(MODULE_SCHEDLATENCY)
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_TRACEBUF
+#include "tracebuf.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -79,6 +89,42 @@ static void (*sched_cb) (uint32_t timestamp, uint32_t value) = NULL;
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 #endif
 
+#ifdef MODULE_SCHEDSTACK
+unsigned sched_stack_max[KERNEL_PID_LAST + 1];
+
+static inline void _stack_sample(thread_t *thread)
+{
+    unsigned used = (thread->stack_start + thread->stack_size) - thread->sp;
+
+    if (used > sched_stack_max[thread->pid]) {
+        sched_stack_max[thread->pid] = used;
+    }
+}
+#endif
+
+#ifdef MODULE_SCHEDLATENCY
+schedlat_t sched_latency[KERNEL_PID_LAST + 1];
+volatile uint32_t sched_irq_off_max = 0;
+
+static inline void _latency_record(schedlat_t *lat)
+{
+    uint32_t latency = xtimer_now().ticks32 - lat->woken;
+    unsigned bucket = 0;
+
+    lat->waiting = 0;
+    if (latency > lat->max) {
+        lat->max = latency;
+    }
+    while (latency && (bucket < (SCHEDLATENCY_BUCKETS - 1))) {
+        latency >>= 1;
+        bucket++;
+    }
+    if (lat->hist[bucket] < UINT16_MAX) {
+        lat->hist[bucket]++;
+    }
+}
+#endif
+
 int __attribute__((used)) sched_run(void)
 {
     sched_context_switch_request = 0;
@@ -95,6 +141,12 @@ int __attribute__((used)) sched_run(void)
           (kernel_pid_t)((active_thread == NULL) ? KERNEL_PID_UNDEF : active_thread->pid),
           next_thread->pid);
 
+#ifdef MODULE_SCHEDLATENCY
+    if (sched_latency[next_thread->pid].waiting) {
+        _latency_record(&sched_latency[next_thread->pid]);
+    }
+#endif
+
     if (active_thread == next_thread) {
         DEBUG("sched_run: done, sched_active_thread was not changed.\n");
         return 0;
@@ -115,6 +167,11 @@ int __attribute__((used)) sched_run(void)
         }
 #endif
 
+#ifdef MODULE_SCHEDSTACK
+        /* the context was saved already, so sp is the deepest point */
+        _stack_sample(active_thread);
+#endif
+
 #ifdef MODULE_SCHEDSTATISTICS
         schedstat_t *active_stat = &sched_pidlist[active_thread->pid];
         if (active_stat->laststart) {
@@ -132,6 +189,10 @@ int __attribute__((used)) sched_run(void)
     }
 #endif
 
+#ifdef MODULE_TRACEBUF
+    tracebuf_add(TRACEBUF_SCHED_SWITCH, next_thread->pid);
+#endif
+
     next_thread->status = STATUS_RUNNING;
     sched_active_pid = next_thread->pid;
     sched_active_thread = (volatile thread_t *) next_thread;
@@ -158,6 +219,34 @@ void sched_register_cb(void (*callback)(uint32_t, uint32_t))
 }
 #endif
 
+#ifdef MODULE_SCHEDSTACK
+void sched_stack_reset(void)
+{
+    unsigned state = irq_disable();
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *thread = (thread_t *)sched_threads[i];
+
+        sched_stack_max[i] = 0;
+        if (thread) {
+            _stack_sample(thread);
+        }
+    }
+    irq_restore(state);
+}
+#endif
+
+#ifdef MODULE_SCHEDLATENCY
+void sched_latency_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(sched_latency, 0, sizeof(sched_latency));
+    sched_irq_off_max = 0;
+    irq_restore(state);
+}
+#endif
+
 void sched_set_status(thread_t *process, unsigned int status)
 {
     if (status >= STATUS_ON_RUNQUEUE) {
@@ -166,6 +255,10 @@ void sched_set_status(thread_t *process, unsigned int status)
                   process->pid, process->priority);
             clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
             runqueue_bitcache |= 1 << process->priority;
+#ifdef MODULE_SCHEDLATENCY
+            sched_latency[process->pid].woken = xtimer_now().ticks32;
+            sched_latency[process->pid].waiting = 1;
+#endif
         }
     }
     else {
@@ -183,6 +276,36 @@ void sched_set_status(thread_t *process, unsigned int status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert(priority < SCHED_PRIO_LEVELS);
+
+    if (thread->priority == priority) {
+        return;
+    }
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        DEBUG("sched_change_priority: moving thread %" PRIkernel_pid
+              " from runqueue %" PRIu8 " to %" PRIu8 ".\n",
+              thread->pid, thread->priority, priority);
+        clist_remove(&sched_runqueues[thread->priority], &(thread->rq_entry));
+        if (!sched_runqueues[thread->priority].next) {
+            runqueue_bitcache &= ~(1 << thread->priority);
+        }
+        /* the active thread has to stay at the head of its runqueue, as
+         * sched_set_status() pops it from there */
+        if (thread == sched_active_thread) {
+            clist_lpush(&sched_runqueues[priority], &(thread->rq_entry));
+        }
+        else {
+            clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));
+        }
+        runqueue_bitcache |= 1 << priority;
+    }
+
+    thread->priority = priority;
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = (thread_t *) sched_active_thread;
@@ -213,6 +336,16 @@ NORETURN void sched_task_exit(void)
     DEBUG("sched_task_exit: ending thread %" PRIkernel_pid "...\n", sched_active_thread->pid);
 
     (void) irq_disable();
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    /* mutexes still locked lose their owner, the pid may be reused */
+    for (mutex_t *m = sched_active_thread->mutexes_held; m; ) {
+        mutex_t *next = m->next_held;
+
+        m->owner = KERNEL_PID_UNDEF;
+        m->next_held = NULL;
+        m = next;
+    }
+#endif
     sched_threads[sched_active_pid] = NULL;
     sched_num_threads--;
 
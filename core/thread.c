@@ -214,16 +214,27 @@ kernel_pid_t thread_create(char *stack, int stacksize, char priority, int flags,
     cb->pid = pid;
     cb->sp = thread_stack_init(function, arg, stack, stacksize);
 
-#if defined(DEVELHELP) || defined(SCHED_TEST_STACK) || defined(MODULE_MPU_STACK_GUARD)
+#if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
+    || defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_SCHEDSTACK)
     cb->stack_start = stack;
 #endif
 
-#ifdef DEVELHELP
+#if defined(DEVELHELP) || defined(MODULE_SCHEDSTACK)
     cb->stack_size = total_stacksize;
+#endif
+#ifdef DEVELHELP
     cb->name = name;
 #endif
+#ifdef MODULE_SCHEDSTACK
+    /* the initial stack frame is the first sample */
+    sched_stack_max[pid] = (stack + total_stacksize) - cb->sp;
+#endif
 
     cb->priority = priority;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    cb->base_priority = priority;
+    cb->mutexes_held = NULL;
+#endif
     cb->status = 0;
 
     cb->rq_entry.next = NULL;
@@ -56,6 +56,13 @@ CORTEXM_STATIC_INLINE void cortexm_init_misc(void)
 #ifdef SCB_CCR_STKALIGN_Msk
     SCB->CCR |= SCB_CCR_STKALIGN_Msk;
 #endif
+
+#if defined(MODULE_SCHEDLATENCY) && defined(DWT_CTRL_CYCCNTENA_Msk)
+    /* start the cycle counter used to measure interrupt disabled times */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 }
 
 void cortexm_init(void)
@@ -36,6 +36,9 @@
 #include "sched.h"
 #include "thread.h"
 #include "cpu_conf.h"
+#ifdef MODULE_TRACEBUF
+#include "tracebuf.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -102,6 +105,11 @@ static inline void cortexm_init_fpu(void)
 #if defined(CPU_ARCH_CORTEX_M4F) || defined(CPU_ARCH_CORTEX_M7)
     /* give full access to the FPU */
     SCB->CPACR |= (uint32_t)CORTEXM_SCB_CPACR_FPU_ACCESS_FULL;
+    /* extend the exception frame only for threads that used the FPU and only
+     * store S0-S15 when needed, the context switch relies on this */
+#if (__FPU_PRESENT == 1U)
+    FPU->FPCCR |= (FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk);
+#endif
 #endif
 }
 
@@ -184,6 +192,9 @@ static inline void cortexm_sleep(int deep)
  */
 static inline void cortexm_isr_end(void)
 {
+#ifdef MODULE_TRACEBUF
+    tracebuf_add(TRACEBUF_ISR_END, __get_IPSR());
+#endif
     if (sched_context_switch_request) {
         thread_yield_higher();
     }
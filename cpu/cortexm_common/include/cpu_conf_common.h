@@ -23,6 +23,20 @@
 extern "C" {
 #endif
 
+/**
+ * @brief    Additional stack space for the FPU context of a thread
+ *
+ * A thread that used the FPU is interrupted with the extended exception frame
+ * (S0-S15 and FPSCR) and the context switch additionally saves S16-S31.
+ */
+#ifndef THREAD_EXTRA_STACKSIZE_FPU
+#ifdef __ARM_FP
+#define THREAD_EXTRA_STACKSIZE_FPU      (136)
+#else
+#define THREAD_EXTRA_STACKSIZE_FPU      (0)
+#endif
+#endif
+
 /**
  * @brief    Configuration of default stack sizes
  *
@@ -33,18 +47,20 @@ extern "C" {
  * If needed, you can overwrite these values the the `cpu_conf.h` file of the
  * specific CPU implementation.
  *
- * @todo Adjust values for Cortex-M4F with FPU?
+ * If the code is compiled to use the FPU, the values include
+ * @ref THREAD_EXTRA_STACKSIZE_FPU.
+ *
  * @todo Configure second set if no newlib nano.specs are available?
  * @{
  */
 #ifndef THREAD_EXTRA_STACKSIZE_PRINTF
-#define THREAD_EXTRA_STACKSIZE_PRINTF   (512)
+#define THREAD_EXTRA_STACKSIZE_PRINTF   (512 + THREAD_EXTRA_STACKSIZE_FPU)
 #endif
 #ifndef THREAD_STACKSIZE_DEFAULT
-#define THREAD_STACKSIZE_DEFAULT        (1024)
+#define THREAD_STACKSIZE_DEFAULT        (1024 + THREAD_EXTRA_STACKSIZE_FPU)
 #endif
 #ifndef THREAD_STACKSIZE_IDLE
-#define THREAD_STACKSIZE_IDLE           (256)
+#define THREAD_STACKSIZE_IDLE           (256 + THREAD_EXTRA_STACKSIZE_FPU)
 #endif
 /** @} */
 
@@ -22,6 +22,40 @@
 #include "irq.h"
 #include "cpu.h"
 
+#if defined(MODULE_SCHEDLATENCY) && defined(DWT_CTRL_CYCCNTENA_Msk)
+#include "sched.h"
+
+/* cycle counter value when interrupts were disabled last */
+static uint32_t _irq_off_start;
+
+static inline void _irq_off_begin(uint32_t mask)
+{
+    if (!mask) {
+        _irq_off_start = DWT->CYCCNT;
+    }
+}
+
+static inline void _irq_off_end(void)
+{
+    if (__get_PRIMASK()) {
+        uint32_t duration = DWT->CYCCNT - _irq_off_start;
+
+        if (duration > sched_irq_off_max) {
+            sched_irq_off_max = duration;
+        }
+    }
+}
+#else
+static inline void _irq_off_begin(uint32_t mask)
+{
+    (void)mask;
+}
+
+static inline void _irq_off_end(void)
+{
+}
+#endif
+
 /**
  * @brief Disable all maskable interrupts
  */
@@ -29,6 +63,7 @@ unsigned int irq_disable(void)
 {
     uint32_t mask = __get_PRIMASK();
     __disable_irq();
+    _irq_off_begin(mask);
     return mask;
 }
 
@@ -37,6 +72,7 @@ unsigned int irq_disable(void)
  */
 __attribute__((used)) unsigned int irq_enable(void)
 {
+    _irq_off_end();
     __enable_irq();
     return __get_PRIMASK();
 }
@@ -46,6 +82,9 @@ __attribute__((used)) unsigned int irq_enable(void)
  */
 void irq_restore(unsigned int state)
 {
+    if (!state) {
+        _irq_off_end();
+    }
     __set_PRIMASK(state);
 }
 
@@ -82,7 +82,28 @@
  * | RET  | <- exception return code
  * -------- lowest address (top of stack)
  *
- * TODO: Implement handling of FPU registers for Cortex-M4 CPUs
+ * On the Cortex-M4F and Cortex-M7 the context is extended lazily: a thread
+ * that executed floating point instructions has the FPU context active
+ * (CONTROL.FPCA), so the hardware handled part of the frame is extended by
+ * space for S0-S15 and FPSCR and bit 4 of the exception return code is
+ * cleared. The context switch then additionally stores S16-S31:
+ *
+ * ------------------- highest address (bottom of stack)
+ * | FPSCR, S15 - S0 | <- reserved by hardware
+ * -------------------
+ * | xPSR - R0       |
+ * -------------------
+ * | S31 - S16       |
+ * -------------------
+ * | R11 - R4        |
+ * -------------------
+ * | RET             |
+ * ------------------- lowest address (top of stack)
+ *
+ * S0-S15 are only written to the reserved space when the FPU is used again
+ * (lazy state preservation, FPCCR.LSPEN), here by the store of S16-S31.
+ * Threads that never touch the FPU keep the basic frame and switch as fast as
+ * without FPU.
  *
  *
  * @author      Stefan Pfeiffer <stefan.pfeiffer@fu-berlin.de>
@@ -123,6 +144,16 @@ extern uint32_t _sstack;
  */
 #define EXCEPT_RET_TASK_MODE        (0xfffffffd)
 
+/**
+ * @brief   Save and restore the FPU context of threads
+ *
+ * Only needed if the code is compiled to use FPU instructions
+ */
+#if (defined(CPU_ARCH_CORTEX_M4F) || defined(CPU_ARCH_CORTEX_M7)) && \
+    defined(__ARM_FP)
+#define FPU_CONTEXT                 (1)
+#endif
+
 char *thread_stack_init(thread_task_func_t task_func,
                              void *arg,
                              void *stack_start,
@@ -148,21 +179,8 @@ char *thread_stack_init(thread_task_func_t task_func,
         *stk = ~((uint32_t)STACK_MARKER);
     }
 
-#if defined(CPU_ARCH_CORTEX_M4F) || (CPU_ARCH_CORTEX_M7)
-    /* TODO: fix FPU handling for Cortex-M4f */
-    /*
-    stk--;
-    *stk = (unsigned int) 0;
-    */
-
-    /* S0 - S15 */
-    /*
-    for (int i = 15; i >= 0; i--) {
-        stk--;
-        *stk = i;
-    }
-    */
-#endif
+    /* new threads start without FPU context, so the basic frame is used even
+     * on CPUs with FPU */
 
     /* ****************************** */
     /* Automatically popped registers */
@@ -280,6 +298,14 @@ void *thread_isr_stack_start(void)
 __attribute__((naked)) void NORETURN cpu_switch_context_exit(void)
 {
     __asm__ volatile (
+#ifdef FPU_CONTEXT
+    /* drop the FPU context of the exiting thread, so no lazy state
+     * preservation is pending for its stack when it is reused */
+    "mrs    r0, control              \n"
+    "bic    r0, r0, #4               \n" /* clear CONTROL.FPCA */
+    "msr    control, r0              \n"
+    "isb                             \n"
+#endif
     "bl     irq_enable               \n" /* enable IRQs to make the SVC
                                            * interrupt is reachable */
     "svc    #1                            \n" /* trigger the SVC interrupt */
@@ -317,11 +343,14 @@ void __attribute__((naked)) __attribute__((used)) isr_pendsv(void) {
     "mov    r0, sp                    \n" /* switch back to the exception SP */
     "mov    sp, r12                   \n"
 #else
+#ifdef FPU_CONTEXT
+    "tst    lr, #0x10                 \n" /* extended frame (bit 4 clear)? */
+    "it     eq                        \n"
+    "vstmdbeq r0!, {s16-s31}          \n" /* save FPU regs, this triggers
+                                           * the lazy save of S0-S15 */
+#endif
     "stmdb  r0!,{r4-r11}              \n" /* save regs */
     "stmdb  r0!,{lr}                  \n" /* exception return value */
-#if defined(CPU_ARCH_CORTEX_M4F) || defined(CPU_ARCH_CORTEX_M7)
-/*  "vstmdb sp!, {s16-s31}            \n" */ /* TODO save FPU registers */
-#endif
 #endif
     "ldr    r1, =sched_active_thread  \n" /* load address of current tcb */
     "ldr    r1, [r1]                  \n" /* dereference pdc */
@@ -364,10 +393,12 @@ void __attribute__((naked)) __attribute__((used)) isr_svc(void) {
     "ldr    r0, [r0]                  \n" /* dereference TCB */
     "ldr    r1, [r0]                  \n" /* load tcb->sp to register 1 */
     "ldmia  r1!, {r0}                 \n" /* restore exception return value */
-#if defined(CPU_ARCH_CORTEX_M4F) || defined(CPU_ARCH_CORTEX_M7)
-/*  "pop    {s16-s31}                 \n" */ /* TODO load FPU registers */
-#endif
     "ldmia  r1!, {r4-r11}             \n" /* restore other registers */
+#ifdef FPU_CONTEXT
+    "tst    r0, #0x10                 \n" /* extended frame (bit 4 clear)? */
+    "it     eq                        \n"
+    "vldmiaeq r1!, {s16-s31}          \n" /* restore FPU regs */
+#endif
     "msr    psp, r1                   \n" /* restore user mode SP to PSP reg */
     "bx     r0                        \n" /* load exception return value to PC,
                                            * causes end of exception*/
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_esp32_esp_app_cpu
+ * @{
+ *
+ * @file
+ * @brief       Implementation of the APP CPU offloading
+ * @}
+ */
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_attr.h"
+#include "esp_common.h"
+#include "esp_app_cpu.h"
+#include "irq.h"
+#include "irq_arch.h"
+#include "kernel_defines.h"
+#include "mutex.h"
+
+#include "rom/cache.h"
+#include "rom/ets_sys.h"
+#include "soc/cpu.h"
+#include "soc/dport_reg.h"
+#include "xtensa/xtensa_api.h"
+
+/* defined in linker script */
+extern uint8_t _init_start;
+
+/* stack of the APP CPU, the ROM only provides a small one */
+static uint8_t _app_cpu_stack[ESP_APP_CPU_STACKSIZE] __attribute__((aligned(16)));
+
+/* function to be executed by the APP CPU, NULL if the APP CPU is idle */
+static volatile esp_app_cpu_func_t _app_cpu_func;
+static void * volatile _app_cpu_arg;
+static volatile bool _app_cpu_started;
+
+/* serializes the callers of esp_app_cpu_exec */
+static mutex_t _app_cpu_lock = MUTEX_INIT;
+/* unlocked by the ISR when the APP CPU has finished a function */
+static mutex_t _app_cpu_done = MUTEX_INIT_LOCKED;
+
+static NORETURN void IRAM _app_cpu_loop(void)
+{
+    _app_cpu_started = true;
+
+    while (1) {
+        /* volatile accesses are serialized by memw on Xtensa */
+        esp_app_cpu_func_t func = _app_cpu_func;
+        if (func == NULL) {
+            continue;
+        }
+        func(_app_cpu_arg);
+        _app_cpu_func = NULL;
+        /* trigger the completion interrupt on the PRO CPU */
+        DPORT_WRITE_PERI_REG(DPORT_CPU_INTR_FROM_CPU_1_REG, DPORT_CPU_INTR_FROM_CPU_1);
+    }
+}
+
+/* entry point of the APP CPU, called by the ROM code */
+static NORETURN void IRAM _app_cpu_start(void)
+{
+    cpu_configure_region_protection();
+
+    /* move exception vectors to IRAM */
+    __asm__ volatile ("wsr %0, vecbase" :: "r"(&_init_start));
+
+    /*
+     * Switch from the ROM stack to our own stack. With call4 the register a5
+     * of the caller becomes the stack pointer a1 of the callee.
+     */
+    __asm__ volatile ("mov a5, %0\n"
+                      "callx4 %1\n"
+                      :: "r"(&_app_cpu_stack[sizeof(_app_cpu_stack)]),
+                         "r"(_app_cpu_loop)
+                      : "a4", "a5", "memory");
+    UNREACHABLE();
+}
+
+static void IRAM _app_cpu_done_isr(void *arg)
+{
+    irq_isr_enter();
+    (void)arg;
+
+    DPORT_WRITE_PERI_REG(DPORT_CPU_INTR_FROM_CPU_1_REG, 0);
+    mutex_unlock(&_app_cpu_done);
+
+    irq_isr_exit();
+}
+
+void esp_app_cpu_init(void)
+{
+    DEBUG("%s\n", __func__);
+
+    /* route the completion interrupt to the PRO CPU */
+    intr_matrix_set(PRO_CPU_NUM, ETS_FROM_CPU_INTR1_SOURCE, CPU_INUM_APP_CPU);
+    xt_set_interrupt_handler(CPU_INUM_APP_CPU, _app_cpu_done_isr, NULL);
+    xt_ints_on(BIT(CPU_INUM_APP_CPU));
+
+    /* enable cached read from flash for the APP CPU */
+    Cache_Flush(APP_CPU_NUM);
+    Cache_Read_Enable(APP_CPU_NUM);
+
+    /* release the APP CPU from stall and reset */
+    esp_cpu_unstall(APP_CPU_NUM);
+    DPORT_SET_PERI_REG_MASK(DPORT_APPCPU_CTRL_B_REG, DPORT_APPCPU_CLKGATE_EN);
+    DPORT_CLEAR_PERI_REG_MASK(DPORT_APPCPU_CTRL_C_REG, DPORT_APPCPU_RUNSTALL);
+    DPORT_SET_PERI_REG_MASK(DPORT_APPCPU_CTRL_A_REG, DPORT_APPCPU_RESETTING);
+    DPORT_CLEAR_PERI_REG_MASK(DPORT_APPCPU_CTRL_A_REG, DPORT_APPCPU_RESETTING);
+    ets_set_appcpu_boot_addr((uint32_t)_app_cpu_start);
+
+    while (!_app_cpu_started) {
+        ets_delay_us(100);
+    }
+    ets_printf("APP cpu is up\n");
+}
+
+void esp_app_cpu_exec(esp_app_cpu_func_t func, void *arg)
+{
+    assert(func != NULL);
+    assert(!irq_is_in());
+
+    mutex_lock(&_app_cpu_lock);
+
+    _app_cpu_arg = arg;
+    _app_cpu_func = func;
+    /* blocks until the APP CPU signals completion */
+    mutex_lock(&_app_cpu_done);
+
+    mutex_unlock(&_app_cpu_lock);
+}
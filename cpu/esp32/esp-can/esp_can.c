@@ -117,6 +117,8 @@ typedef struct _esp_can_dev {
     uint32_t rx_frames_rptr;    /**< pointer to ring buffer for read  */
     uint32_t rx_frames_num;     /**< number of frames in ring buffer  */
     uint32_t rx_filter_num;     /**< number of acceptance filters     */
+    uint32_t rx_filter_overflow; /**< filters that did not fit into the
+                                      list, frames are not filtered then */
 
     bool   powered_up;      /**< device is powered up    */
 
@@ -179,6 +181,8 @@ static int  _esp_can_remove_filter(candev_t *candev, const struct can_filter *fi
 /* internal function declarations, we don't need device since we habe only one */
 static void _esp_can_get_bittiming_const (struct can_bittiming_const* esp_const);
 static void _esp_can_set_bittiming (void);
+static void _esp_can_set_acceptance_filter (void);
+static void _esp_can_update_acceptance_filter (void);
 static void _esp_can_power_up  (void);
 static void _esp_can_power_down(void);
 static void _esp_can_init_pins (void);
@@ -550,13 +554,17 @@ static int _esp_can_set_filter(candev_t *candev, const struct can_filter *filter
     }
 
     if (i == ESP_CAN_MAX_RX_FILTERS) {
-        DEBUG("%s no more filters available\n", __func__);
-        return -EOVERFLOW;
+        /* the router still filters in software, so accept all frames */
+        DEBUG("%s no more filters available, disable filtering\n", __func__);
+        _esp_can_dev.rx_filter_overflow++;
+        _esp_can_update_acceptance_filter();
+        return i;
     }
 
     /* set the filter and return the filter index */
     _esp_can_dev.rx_filters[i] = *filter;
     _esp_can_dev.rx_filter_num++;
+    _esp_can_update_acceptance_filter();
     return i;
 }
 
@@ -570,10 +578,18 @@ static int _esp_can_remove_filter(candev_t *candev, const struct can_filter *fil
             /* mark the filter entry as not in use */
             _esp_can_dev.rx_filters[i].can_id = 0;
             _esp_can_dev.rx_filter_num--;
+            _esp_can_update_acceptance_filter();
             return 0;
         }
     }
 
+    if (_esp_can_dev.rx_filter_overflow) {
+        /* one of the filters that did not fit into the list */
+        _esp_can_dev.rx_filter_overflow--;
+        _esp_can_update_acceptance_filter();
+        return 0;
+    }
+
     DEBUG("%s error filter not found\n", __func__);
     return -EOVERFLOW;
 }
@@ -602,6 +618,84 @@ static void _esp_can_set_operating_mode (void)
     }
 }
 
+/**
+ * Programs the hardware acceptance filter with the union of all filters in
+ * the list. The SJA1000 compatible controller has a single code/mask filter
+ * over the identifier, so the hardware filter accepts a superset that is
+ * narrowed down by the software filters. Has to be called in reset mode.
+ */
+static void _esp_can_set_acceptance_filter (void)
+{
+    uint32_t code = 0;
+    uint32_t care = 0;  /* bits of code that have to match */
+    int eff = -1;
+    bool first = true;
+
+    if (_esp_can_dev.rx_filter_num && !_esp_can_dev.rx_filter_overflow) {
+        for (unsigned i = 0; i < ESP_CAN_MAX_RX_FILTERS; i++) {
+            struct can_filter* f = &_esp_can_dev.rx_filters[i];
+            uint32_t f_code;
+            uint32_t f_care;
+
+            if (f->can_id == 0) {
+                continue;
+            }
+            /* standard and extended frames use the filter bits differently,
+             * filters for both can not be combined */
+            int f_eff = (f->can_id & CAN_EFF_FLAG) ? 1 : 0;
+            if (!(f->can_mask & CAN_EFF_FLAG) || ((eff >= 0) && (eff != f_eff))) {
+                care = 0;
+                break;
+            }
+            eff = f_eff;
+
+            /* the identifier is left aligned in ACR0..3, followed by RTR */
+            if (f_eff) {
+                f_code = (f->can_id & CAN_EFF_MASK) << 3;
+                f_care = (f->can_mask & CAN_EFF_MASK) << 3;
+            }
+            else {
+                f_code = (f->can_id & CAN_SFF_MASK) << 21;
+                f_care = (f->can_mask & CAN_SFF_MASK) << 21;
+            }
+
+            if (first) {
+                care = f_care;
+                first = false;
+            }
+            else {
+                /* only bits all filters agree on have to match */
+                care &= f_care & ~(code ^ f_code);
+            }
+            code = f_code & care;
+        }
+    }
+
+    DEBUG("%s code=%08x care=%08x\n", __func__,
+          (unsigned)code, (unsigned)care);
+
+    CAN.mode_reg.acceptance_filter = 0;            /* single filter */
+    for (unsigned i = 0; i < 4; i++) {
+        CAN.acceptance_filter.code_reg[i].byte = (code >> (24 - (8 * i))) & 0xff;
+        /* mask bits set to 1 are not compared */
+        CAN.acceptance_filter.mask_reg[i].byte = (~care >> (24 - (8 * i))) & 0xff;
+    }
+}
+
+static void _esp_can_update_acceptance_filter (void)
+{
+    /* the configuration is applied on power up otherwise */
+    if (!_esp_can_dev.powered_up) {
+        return;
+    }
+
+    critical_enter();
+    _esp_can_set_reset_mode();
+    _esp_can_set_acceptance_filter();
+    _esp_can_set_operating_mode();
+    critical_exit();
+}
+
 static int _esp_can_config(void)
 {
     DEBUG("%s\n", __func__);
@@ -633,12 +727,8 @@ static int _esp_can_config(void)
     CAN.tx_error_counter_reg.byte = 0;
     CAN.rx_error_counter_reg.byte = 0;
 
-    /* accept all CAN messages, filtering is done by software */
-    CAN.mode_reg.acceptance_filter = 0;            /* single filter */
-    CAN.acceptance_filter.mask_reg[0].byte = 0xff; /* all bits masked */
-    CAN.acceptance_filter.mask_reg[1].byte = 0xff;
-    CAN.acceptance_filter.mask_reg[2].byte = 0xff;
-    CAN.acceptance_filter.mask_reg[3].byte = 0xff;
+    /* drop frames nobody subscribed to in hardware */
+    _esp_can_set_acceptance_filter();
 
     /* clear interrupt status register by read and enable all interrupts */
     uint32_t tmp = CAN.interrupt_reg.val; (void)tmp;
@@ -889,9 +979,11 @@ static void IRAM_ATTR _esp_can_intr_handler (void *arg)
                 frame.can_id |= esp_frame.eff ? CAN_EFF_FLAG : 0;
                 frame.can_dlc = esp_frame.dlc;
 
-                /* apply acceptance filters only if they are set */
+                /* apply acceptance filters only if they are set and
+                 * complete */
                 unsigned f_id = 0;
-                if (_esp_can_dev.rx_filter_num) {
+                if (_esp_can_dev.rx_filter_num &&
+                    !_esp_can_dev.rx_filter_overflow) {
                     for (f_id = 0; f_id < ESP_CAN_MAX_RX_FILTERS; f_id++) {
                         /* compared masked can_id with each filter */
                         struct can_filter* f = &_esp_can_dev.rx_filters[f_id];
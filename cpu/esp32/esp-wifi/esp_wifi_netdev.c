@@ -52,7 +52,6 @@
 #include "net/ipv6/hdr.h"
 #include "net/gnrc/ipv6/nib.h"
 
-#define SYSTEM_EVENT_WIFI_RX_DONE    (SYSTEM_EVENT_MAX + 3)
 #define SYSTEM_EVENT_WIFI_TX_DONE    (SYSTEM_EVENT_MAX + 4)
 
 /**
@@ -70,22 +69,40 @@ static char _esp_wifi_stack[ESP_WIFI_STACKSIZE];
 extern esp_err_t esp_system_event_add_handler (system_event_cb_t handler,
                                                void *arg);
 
+/*
+ * The frame is not copied here. Its WiFi driver buffer is queued and freed
+ * once the stack has fetched the frame with _esp_wifi_recv.
+ */
 esp_err_t _esp_wifi_rx_cb(void *buffer, uint16_t len, void *eb)
 {
     DEBUG("%s: buf=%p len=%d eb=%p\n", __func__, buffer, len, eb);
 
-    CHECK_PARAM_RET (buffer != NULL, -EINVAL);
-    CHECK_PARAM_RET (len <= ETHERNET_DATA_LEN, -EINVAL);
+    if ((buffer == NULL) || (len == 0) || (len > ETHERNET_DATA_LEN)) {
+        esp_wifi_internal_free_rx_buffer(eb);
+        return -EINVAL;
+    }
 
     mutex_lock(&_esp_wifi_dev.dev_lock);
 
-    memcpy(_esp_wifi_dev.rx_buf, buffer, len);
-    _esp_wifi_dev.rx_len = len;
-    _esp_wifi_dev.event = SYSTEM_EVENT_WIFI_RX_DONE;
-    _esp_wifi_dev.netdev.event_callback(&_esp_wifi_dev.netdev, NETDEV_EVENT_ISR);
+    if (_esp_wifi_dev.rx_numof == ESP_WIFI_RX_QUEUE_LEN) {
+        DEBUG("%s: RX queue full, frame dropped\n", __func__);
+        mutex_unlock(&_esp_wifi_dev.dev_lock);
+        esp_wifi_internal_free_rx_buffer(eb);
+        return ESP_OK;
+    }
+
+    esp_wifi_rx_buf_t *rx = &_esp_wifi_dev.rx_queue[(_esp_wifi_dev.rx_head +
+                                                     _esp_wifi_dev.rx_numof) %
+                                                    ESP_WIFI_RX_QUEUE_LEN];
+    rx->buffer = buffer;
+    rx->eb = eb;
+    rx->len = len;
+    _esp_wifi_dev.rx_numof++;
 
     mutex_unlock(&_esp_wifi_dev.dev_lock);
 
+    _esp_wifi_dev.netdev.event_callback(&_esp_wifi_dev.netdev, NETDEV_EVENT_ISR);
+
     return ESP_OK;
 }
 
@@ -298,7 +315,8 @@ static int _esp_wifi_recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
     mutex_lock(&dev->dev_lock);
 
-    uint8_t size = dev->rx_len;
+    esp_wifi_rx_buf_t *rx = &dev->rx_queue[dev->rx_head];
+    uint16_t size = (dev->rx_numof) ? rx->len : 0;
 
     if (!buf && !len) {
         /* return the size without dropping received data */
@@ -306,39 +324,38 @@ static int _esp_wifi_recv(netdev_t *netdev, void *buf, size_t len, void *info)
         return size;
     }
 
-    if (!buf && len) {
-        /* return the size and drop received data */
+    if (!size) {
         mutex_unlock(&dev->dev_lock);
-        dev->rx_len = 0;
-        return size;
+        return (buf) ? -EINVAL : 0;
     }
 
-    if (buf && len && dev->rx_len) {
-        if (dev->rx_len > len) {
+    if (buf) {
+        if (size > len) {
             DEBUG("[esp_wifi] No space in receive buffers\n");
             mutex_unlock(&dev->dev_lock);
             return -ENOBUFS;
         }
 
         #if ENABLE_DEBUG
-        /* esp_hexdump (dev->rx_buf, dev->rx_len, 'b', 16); */
+        /* esp_hexdump (rx->buffer, size, 'b', 16); */
         #endif
 
-        /* copy received date and reset the receive length */
-        memcpy(buf, dev->rx_buf, dev->rx_len);
-        dev->rx_len = 0;
+        /* copy received data directly from the WiFi driver buffer */
+        memcpy(buf, rx->buffer, size);
 
         #ifdef MODULE_NETSTATS_L2
         netdev->stats.rx_count++;
         netdev->stats.rx_bytes += size;
         #endif
-
-        mutex_unlock(&dev->dev_lock);
-        return size;
     }
 
+    /* return the WiFi driver buffer, also if the frame is dropped */
+    esp_wifi_internal_free_rx_buffer(rx->eb);
+    dev->rx_head = (dev->rx_head + 1) % ESP_WIFI_RX_QUEUE_LEN;
+    dev->rx_numof--;
+
     mutex_unlock(&dev->dev_lock);
-    return -EINVAL;
+    return size;
 }
 
 static int _esp_wifi_get(netdev_t *netdev, netopt_t opt, void *val, size_t max_len)
@@ -390,14 +407,10 @@ static void _esp_wifi_isr(netdev_t *netdev)
     esp_wifi_netdev_t *dev = (esp_wifi_netdev_t *) netdev;
 
     switch (dev->event) {
-        case SYSTEM_EVENT_WIFI_RX_DONE:
-            if (dev->rx_len) {
-                dev->netdev.event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-            }
-        case SYSTEM_EVENT_STA_CONNECTED:
+        case SYSTEM_EVENT_ETH_CONNECTED:
             dev->netdev.event_callback(netdev, NETDEV_EVENT_LINK_UP);
             break;
-        case SYSTEM_EVENT_STA_DISCONNECTED:
+        case SYSTEM_EVENT_ETH_DISCONNECTED:
             dev->netdev.event_callback(netdev, NETDEV_EVENT_LINK_DOWN);
             break;
         default:
@@ -405,6 +418,12 @@ static void _esp_wifi_isr(netdev_t *netdev)
     }
     _esp_wifi_dev.event = SYSTEM_EVENT_MAX; /* no event */
 
+    /* hand the queued frames to the stack, each recv() dequeues one, frames
+     * queued meanwhile come with their own event */
+    for (unsigned numof = dev->rx_numof; numof; numof--) {
+        dev->netdev.event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+    }
+
     return;
 }
 
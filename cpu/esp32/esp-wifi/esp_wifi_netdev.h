@@ -21,6 +21,8 @@
 
 #include "net/netdev.h"
 
+#include "esp_wifi_params.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -30,6 +32,16 @@ extern "C" {
  */
 extern const netdev_driver_t esp_wifi_driver;
 
+/**
+ * @brief   Received frame that is still held in a WiFi driver buffer
+ */
+typedef struct
+{
+    void *buffer;                      /**< frame data */
+    void *eb;                          /**< WiFi driver buffer to free */
+    uint16_t len;                      /**< length of the frame */
+} esp_wifi_rx_buf_t;
+
 /**
  * @brief   Device descriptor for ESP WiFi devices
  */
@@ -37,10 +49,12 @@ typedef struct
 {
     netdev_t netdev;                   /**< netdev parent struct */
 
-    uint8_t rx_len;                    /**< number of bytes received */
-    uint8_t rx_buf[ETHERNET_DATA_LEN]; /**< receive buffer */
+    /** received frames in the order of their reception */
+    esp_wifi_rx_buf_t rx_queue[ESP_WIFI_RX_QUEUE_LEN];
+    uint8_t rx_head;                   /**< index of the oldest frame */
+    uint8_t rx_numof;                  /**< number of frames in rx_queue */
 
-    uint8_t tx_len;                    /**< number of bytes in transmit buffer */
+    uint16_t tx_len;                   /**< number of bytes in transmit buffer */
     uint8_t tx_buf[ETHERNET_DATA_LEN]; /**< transmit buffer */
 
     uint32_t event;                    /**< received event */
@@ -35,6 +35,15 @@
 #define ESP_WIFI_PRIO         GNRC_NETIF_PRIO
 #endif
 
+#ifndef ESP_WIFI_RX_QUEUE_LEN
+/**
+ * Number of received frames whose WiFi driver buffers are held until the
+ * stack fetched them, must not exceed the number of dynamic RX buffers of
+ * the WiFi driver
+ */
+#define ESP_WIFI_RX_QUEUE_LEN (8U)
+#endif
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    cpu_esp32_esp_app_cpu ESP32 APP CPU offloading
+ * @ingroup     cpu_esp32
+ * @brief       Execute functions on the otherwise unused APP CPU
+ *
+ * RIOT runs on the PRO CPU of the ESP32 only. With module `esp_app_cpu`, the
+ * APP CPU of dual-core ESP32 SoCs is started as well and executes functions
+ * that are handed over with @ref esp_app_cpu_exec. The calling thread is
+ * blocked until the function has returned, meanwhile the PRO CPU continues
+ * to run other threads. This is useful for lengthy computations such as
+ * cryptographic operations.
+ *
+ * The APP CPU does not run the RIOT scheduler. Functions executed on the APP
+ * CPU must therefore not call any kernel function, e.g. no mutexes, no
+ * messages, no xtimer and no output via stdio. They must only work on the data
+ * passed to them, which must not be accessed from the PRO CPU until
+ * @ref esp_app_cpu_exec returns. Since the flash cache is disabled during
+ * flash write and erase operations, functions that are executed while the
+ * flash is written have to be placed in IRAM.
+ *
+ * Only one function is executed on the APP CPU at a time. Further callers are
+ * blocked until the APP CPU becomes available.
+ *
+ * @{
+ *
+ * @file
+ * @brief       APP CPU offloading interface
+ */
+
+#ifndef ESP_APP_CPU_H
+#define ESP_APP_CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the stack used by the APP CPU
+ */
+#ifndef ESP_APP_CPU_STACKSIZE
+#define ESP_APP_CPU_STACKSIZE   (2048)
+#endif
+
+/**
+ * @brief   Function executed on the APP CPU
+ *
+ * @param[in]   arg     argument passed to @ref esp_app_cpu_exec
+ */
+typedef void (*esp_app_cpu_func_t)(void *arg);
+
+/**
+ * @brief   Start the APP CPU
+ *
+ * Called once during system initialization.
+ */
+void esp_app_cpu_init(void);
+
+/**
+ * @brief   Execute a function on the APP CPU
+ *
+ * Blocks the calling thread until @p func has returned on the APP CPU.
+ *
+ * @note    Must not be called from interrupt context.
+ *
+ * @param[in]   func    function to execute, see the restrictions above
+ * @param[in]   arg     argument passed to @p func
+ */
+void esp_app_cpu_exec(esp_app_cpu_func_t func, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ESP_APP_CPU_H */
+/** @} */
@@ -49,6 +49,7 @@ extern volatile uint32_t irq_interrupt_nesting;
 #define CPU_INUM_SOFTWARE   17  /* level interrupt, low priority = 1 */
 #define CPU_INUM_ETH        18  /* level interrupt, low priority = 1 */
 #define CPU_INUM_TIMER      19  /* level interrupt, medium priority = 2 */
+#define CPU_INUM_APP_CPU    20  /* level interrupt, medium priority = 2 */
 /** @} */
 
 #if defined(SDK_INT_HANDLING) || defined(DOXYGEN)
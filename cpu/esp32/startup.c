@@ -65,6 +65,10 @@
 #include "stdio_uart.h"
 #endif
 
+#ifdef MODULE_ESP_APP_CPU
+#include "esp_app_cpu.h"
+#endif
+
 #define MHZ 1000000UL
 #define STRINGIFY(s) STRINGIFY2(s)
 #define STRINGIFY2(s) #s
@@ -161,9 +165,14 @@ NORETURN void IRAM call_start_cpu0 (void)
 
     ets_printf("PRO cpu is up ");
 
+    #ifdef MODULE_ESP_APP_CPU
+    /* APP cpu is started later in system_init */
+    ets_printf("(APP cpu is used for offloading by module esp_app_cpu)\n");
+    #else
     /* disable APP cpu */
     ets_printf("(single core mode, only PRO cpu is used)\n");
     DPORT_CLEAR_PERI_REG_MASK(DPORT_APPCPU_CTRL_B_REG, DPORT_APPCPU_CLKGATE_EN);
+    #endif
 
     #ifdef MODULE_ESP_IDF_HEAP
     /* init heap */
@@ -349,6 +358,11 @@ static NORETURN void IRAM system_init (void)
     extern void esp_event_handler_init(void);
     esp_event_handler_init();
 
+    #ifdef MODULE_ESP_APP_CPU
+    /* start the APP cpu for offloading */
+    esp_app_cpu_init();
+    #endif
+
     /* starting RIOT */
     ets_printf("Starting RIOT kernel on PRO cpu\n");
     kernel_init();
@@ -22,6 +22,9 @@
 #ifdef MODULE_PERIPH_MCG
 #include "mcg.h"
 #endif
+#ifdef MODULE_PERIPH_DMA
+#include "periph/dma.h"
+#endif
 
 /**
  * @brief Initialize the CPU, set IRQ priorities
@@ -38,6 +41,10 @@ void cpu_init(void)
 #ifdef MODULE_PERIPH_MCG
     /* initialize the CPU clocking provided by the MCG module */
     kinetis_mcg_init();
+#endif
+#ifdef MODULE_PERIPH_DMA
+    /* initialize DMA channels */
+    dma_init();
 #endif
     /* trigger static peripheral initialization */
     periph_init();
@@ -0,0 +1,367 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_kinetis
+ * @ingroup     drivers_periph_dma
+ * @{
+ *
+ * @file
+ * @brief       Low-level DMA driver implementation for the eDMA
+ *
+ * Logical DMA streams map 1:1 to the channels of the eDMA. The request line
+ * given to dma_configure() is the DMAMUX source of the peripheral.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "cpu.h"
+#include "bit.h"
+#include "mutex.h"
+#include "assert.h"
+#include "periph/dma.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#if defined(DMA_INT_INT16_MASK)
+#error "DMA is not supported for target CPU"
+#endif
+
+#ifndef DMAMUX
+#define DMAMUX              DMAMUX0
+#endif
+
+#define DMA_NUMOF           (sizeof(DMA0->TCD) / sizeof(DMA0->TCD[0]))
+
+/* maximum major loop count with channel linking disabled */
+#define DMA_CITER_MAX       (DMA_CITER_ELINKNO_CITER_MASK >> DMA_CITER_ELINKNO_CITER_SHIFT)
+
+struct dma_ctx {
+    mutex_t conf_lock;
+    mutex_t sync_lock;
+    dma_cb_t cb;
+    void *arg;
+    uint16_t len;
+    uint8_t swtrig;
+};
+
+static struct dma_ctx dma_ctx[DMA_NUMOF];
+
+void dma_init(void)
+{
+    for (unsigned i = 0; i < DMA_NUMOF; i++) {
+        mutex_init(&dma_ctx[i].conf_lock);
+        mutex_init(&dma_ctx[i].sync_lock);
+        mutex_lock(&dma_ctx[i].sync_lock);
+    }
+
+    bit_set32(&SIM->SCGC6, SIM_SCGC6_DMAMUX_SHIFT);
+    bit_set32(&SIM->SCGC7, SIM_SCGC7_DMA_SHIFT);
+}
+
+int dma_transfer(dma_t dma, int chan, const void *src, void *dst, size_t len,
+                 dma_mode_t mode, uint8_t flags)
+{
+    int ret = dma_configure(dma, chan, src, dst, len, mode, flags);
+    if (ret != 0) {
+        return ret;
+    }
+    dma_start(dma);
+    dma_wait(dma);
+    dma_stop(dma);
+
+    return len;
+}
+
+void dma_acquire(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    mutex_lock(&dma_ctx[dma].conf_lock);
+}
+
+void dma_release(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    mutex_unlock(&dma_ctx[dma].conf_lock);
+}
+
+int dma_configure(dma_t dma, int chan, const void *src, void *dst, size_t len,
+                  dma_mode_t mode, uint8_t flags)
+{
+    assert(src != NULL);
+    assert(dst != NULL);
+    assert(dma < DMA_NUMOF);
+
+    uint32_t width = (flags & DMA_DATA_WIDTH_MASK) >> DMA_DATA_WIDTH_SHIFT;
+    uint16_t soff = (flags & DMA_INC_SRC_ADDR) ? (1 << width) : 0;
+    uint16_t doff = (flags & DMA_INC_DST_ADDR) ? (1 << width) : 0;
+    uint32_t nbytes, iter;
+
+    if ((len == 0) || (len > DMA_CITER_MAX)) {
+        return -1;
+    }
+
+    /* make sure the channel is idle before touching its TCD */
+    dma_stop(dma);
+    DMAMUX->CHCFG[dma] = 0;
+
+    switch (mode) {
+        case DMA_PERIPH_TO_MEM:
+        case DMA_MEM_TO_PERIPH:
+            /* move one item per request of the peripheral */
+            nbytes = (1 << width);
+            iter = len;
+            DMAMUX->CHCFG[dma] = DMAMUX_CHCFG_ENBL_MASK |
+                                 DMAMUX_CHCFG_SOURCE(chan);
+            dma_ctx[dma].swtrig = 0;
+            break;
+        case DMA_MEM_TO_MEM:
+            /* move everything in a single minor loop on a software start */
+            nbytes = (len << width);
+            iter = 1;
+            dma_ctx[dma].swtrig = 1;
+            break;
+        default:
+            return -1;
+    }
+
+    DMA0->TCD[dma].SADDR = (uint32_t)src;
+    DMA0->TCD[dma].SOFF = soff;
+    DMA0->TCD[dma].ATTR = DMA_ATTR_SSIZE(width) | DMA_ATTR_DSIZE(width);
+    DMA0->TCD[dma].NBYTES_MLNO = nbytes;
+    DMA0->TCD[dma].DADDR = (uint32_t)dst;
+    DMA0->TCD[dma].DOFF = doff;
+    DMA0->TCD[dma].CITER_ELINKNO = DMA_CITER_ELINKNO_CITER(iter);
+    DMA0->TCD[dma].BITER_ELINKNO = DMA_BITER_ELINKNO_BITER(iter);
+    if (flags & DMA_CIRCULAR) {
+        /* rewind the addresses after the major loop and keep the request
+         * enabled, so the transfer restarts at the beginning of the buffer */
+        DMA0->TCD[dma].SLAST = -(int32_t)(soff * iter);
+        DMA0->TCD[dma].DLAST_SGA = -(int32_t)(doff * iter);
+        DMA0->TCD[dma].CSR = DMA_CSR_INTMAJOR_MASK | DMA_CSR_INTHALF_MASK;
+    }
+    else {
+        DMA0->TCD[dma].SLAST = 0;
+        DMA0->TCD[dma].DLAST_SGA = 0;
+        DMA0->TCD[dma].CSR = DMA_CSR_INTMAJOR_MASK | DMA_CSR_DREQ_MASK;
+    }
+    dma_ctx[dma].len = len;
+
+    NVIC_EnableIRQ((IRQn_Type)((int)DMA0_IRQn + dma));
+
+    return 0;
+}
+
+void dma_start(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    DMA0->CDNE = DMA_CDNE_CDNE(dma);
+    if (dma_ctx[dma].swtrig) {
+        DMA0->SSRT = DMA_SSRT_SSRT(dma);
+    }
+    else {
+        DMA0->SERQ = DMA_SERQ_SERQ(dma);
+    }
+}
+
+uint16_t dma_suspend(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    uint16_t left = 0;
+
+    if (DMA0->ERQ & (1 << dma)) {
+        NVIC_DisableIRQ((IRQn_Type)((int)DMA0_IRQn + dma));
+        DMA0->CERQ = DMA_CERQ_CERQ(dma);
+        while (DMA0->TCD[dma].CSR & DMA_CSR_ACTIVE_MASK) {}
+        left = dma_remaining(dma);
+        NVIC_EnableIRQ((IRQn_Type)((int)DMA0_IRQn + dma));
+    }
+    return left;
+}
+
+void dma_resume(dma_t dma, uint16_t remaining)
+{
+    assert(dma < DMA_NUMOF);
+
+    /* the TCD keeps its position while the request is disabled */
+    if (remaining > 0) {
+        DMA0->SERQ = DMA_SERQ_SERQ(dma);
+    }
+}
+
+void dma_stop(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    DMA0->CERQ = DMA_CERQ_CERQ(dma);
+    while (DMA0->TCD[dma].CSR & DMA_CSR_ACTIVE_MASK) {}
+}
+
+void dma_set_callback(dma_t dma, dma_cb_t cb, void *arg)
+{
+    assert(dma < DMA_NUMOF);
+
+    dma_ctx[dma].arg = arg;
+    dma_ctx[dma].cb = cb;
+}
+
+uint16_t dma_remaining(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    if (DMA0->TCD[dma].CSR & DMA_CSR_DONE_MASK) {
+        return 0;
+    }
+    if (dma_ctx[dma].swtrig) {
+        /* memory to memory transfers run in a single minor loop */
+        return dma_ctx[dma].len;
+    }
+    return (DMA0->TCD[dma].CITER_ELINKNO & DMA_CITER_ELINKNO_CITER_MASK) >>
+           DMA_CITER_ELINKNO_CITER_SHIFT;
+}
+
+void dma_wait(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    mutex_lock(&dma_ctx[dma].sync_lock);
+}
+
+static void dma_isr_handler(dma_t dma)
+{
+    DMA0->CINT = DMA_CINT_CINT(dma);
+    DEBUG("[dma] channel %u done\n", (unsigned)dma);
+
+    if (dma_ctx[dma].cb) {
+        dma_ctx[dma].cb(dma_ctx[dma].arg);
+    }
+    else {
+        mutex_unlock(&dma_ctx[dma].sync_lock);
+    }
+
+    cortexm_isr_end();
+}
+
+#ifdef DMA_INT_INT0_MASK
+void isr_dma0(void)
+{
+    dma_isr_handler(0);
+}
+#endif
+
+#ifdef DMA_INT_INT1_MASK
+void isr_dma1(void)
+{
+    dma_isr_handler(1);
+}
+#endif
+
+#ifdef DMA_INT_INT2_MASK
+void isr_dma2(void)
+{
+    dma_isr_handler(2);
+}
+#endif
+
+#ifdef DMA_INT_INT3_MASK
+void isr_dma3(void)
+{
+    dma_isr_handler(3);
+}
+#endif
+
+#ifdef DMA_INT_INT4_MASK
+void isr_dma4(void)
+{
+    dma_isr_handler(4);
+}
+#endif
+
+#ifdef DMA_INT_INT5_MASK
+void isr_dma5(void)
+{
+    dma_isr_handler(5);
+}
+#endif
+
+#ifdef DMA_INT_INT6_MASK
+void isr_dma6(void)
+{
+    dma_isr_handler(6);
+}
+#endif
+
+#ifdef DMA_INT_INT7_MASK
+void isr_dma7(void)
+{
+    dma_isr_handler(7);
+}
+#endif
+
+#ifdef DMA_INT_INT8_MASK
+void isr_dma8(void)
+{
+    dma_isr_handler(8);
+}
+#endif
+
+#ifdef DMA_INT_INT9_MASK
+void isr_dma9(void)
+{
+    dma_isr_handler(9);
+}
+#endif
+
+#ifdef DMA_INT_INT10_MASK
+void isr_dma10(void)
+{
+    dma_isr_handler(10);
+}
+#endif
+
+#ifdef DMA_INT_INT11_MASK
+void isr_dma11(void)
+{
+    dma_isr_handler(11);
+}
+#endif
+
+#ifdef DMA_INT_INT12_MASK
+void isr_dma12(void)
+{
+    dma_isr_handler(12);
+}
+#endif
+
+#ifdef DMA_INT_INT13_MASK
+void isr_dma13(void)
+{
+    dma_isr_handler(13);
+}
+#endif
+
+#ifdef DMA_INT_INT14_MASK
+void isr_dma14(void)
+{
+    dma_isr_handler(14);
+}
+#endif
+
+#ifdef DMA_INT_INT15_MASK
+void isr_dma15(void)
+{
+    dma_isr_handler(15);
+}
+#endif
@@ -176,6 +176,18 @@ static int _init(candev_t *candev)
         return -1;
     }
 
+#ifdef MODULE_CAN_FD
+    int enable_fd = 1;
+    ret = real_setsockopt(dev->sock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES,
+                          &enable_fd, sizeof(enable_fd));
+
+    if (ret < 0) {
+        real_printf("Error: CAN-FD not supported\n");
+        real_close(dev->sock);
+        return -1;
+    }
+#endif
+
     strcpy(ifr.ifr_name, dev->conf->interface_name);
     ret = real_ioctl(dev->sock, SIOCGIFINDEX, &ifr);
 
@@ -207,7 +219,7 @@ static int _send(candev_t *candev, const struct can_frame *frame)
     int nbytes;
     candev_linux_t *dev = (candev_linux_t *)candev;
 
-    nbytes = real_write(dev->sock, frame, sizeof(struct can_frame));
+    nbytes = real_write(dev->sock, frame, can_frame_size(frame));
 
     if (nbytes < frame->can_dlc) {
         real_printf("CAN write op failed, nbytes=%i\n", nbytes);
@@ -224,7 +236,12 @@ static int _send(candev_t *candev, const struct can_frame *frame)
 static void _isr(candev_t *candev)
 {
     int nbytes;
-    struct can_frame rcv_frame;
+#ifdef MODULE_CAN_FD
+    struct canfd_frame rcv_buf;
+#else
+    struct can_frame rcv_buf;
+#endif
+    struct can_frame *rcv_frame = (struct can_frame *)&rcv_buf;
     candev_linux_t *dev = (candev_linux_t *)candev;
 
     if (dev == NULL) {
@@ -232,7 +249,7 @@ static void _isr(candev_t *candev)
     }
 
     DEBUG("candev_native _isr: CAN SIGIO interrupt received, sock = %i\n", dev->sock);
-    nbytes = real_read(dev->sock, &rcv_frame, sizeof(struct can_frame));
+    nbytes = real_read(dev->sock, &rcv_buf, sizeof(rcv_buf));
 
     if (nbytes < 0) {   /* SIGIO signal was probably due to an error with the socket */
         DEBUG("candev_native _isr: read: error during read\n");
@@ -244,23 +261,29 @@ static void _isr(candev_t *candev)
         return;
     }
 
-    if (rcv_frame.can_id & CAN_ERR_FLAG) {
+#ifdef MODULE_CAN_FD
+    if (nbytes == (int)CANFD_MTU) {
+        rcv_buf.flags |= CANFD_FDF;
+    }
+#endif
+
+    if (rcv_frame->can_id & CAN_ERR_FLAG) {
         DEBUG("candev_native _isr: error frame\n");
-        candev_event_t evt = _can_error_to_can_evt(rcv_frame);
+        candev_event_t evt = _can_error_to_can_evt(*rcv_frame);
         if ((evt != CANDEV_EVENT_NOEVENT) && (dev->candev.event_callback)) {
             dev->candev.event_callback(&dev->candev, evt, NULL);
         }
         return;
     }
 
-    if (rcv_frame.can_id & CAN_RTR_FLAG) {
+    if (rcv_frame->can_id & CAN_RTR_FLAG) {
         DEBUG("candev_native _isr: rtr frame\n");
         return;
     }
 
     if (dev->candev.event_callback) {
         DEBUG("candev_native _isr: calling event callback\n");
-        dev->candev.event_callback(&dev->candev, CANDEV_EVENT_RX_INDICATION, &rcv_frame);
+        dev->candev.event_callback(&dev->candev, CANDEV_EVENT_RX_INDICATION, rcv_frame);
     }
 
 }
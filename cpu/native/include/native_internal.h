@@ -167,6 +167,15 @@ ssize_t _native_read(int fd, void *buf, size_t count);
 ssize_t _native_write(int fd, const void *buf, size_t count);
 ssize_t _native_writev(int fildes, const struct iovec *iov, int iovcnt);
 
+#ifdef MODULE_NATIVE_VTIME
+extern const char *_native_vtime_file; /**< shared clock, NULL if local */
+
+/**
+ * wait for an interrupt, advancing the virtual time to the next timer
+ */
+void native_vtime_idle(void);
+#endif
+
 /**
  * @endcond
  */
@@ -24,6 +24,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "net/netdev.h"
 
@@ -35,6 +36,17 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames read from the tap for one SIGIO
+ *
+ * Reading the frames queued by the host in one go saves a signal round trip
+ * per frame. The limit keeps the network interface thread from starving
+ * others under load.
+ */
+#ifndef NETDEV_TAP_RX_BATCH
+#define NETDEV_TAP_RX_BATCH                 (16U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +56,7 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscous;                 /**< Flag for promiscous mode */
+    bool rx_more;                       /**< last read got a frame */
 } netdev_tap_t;
 
 /**
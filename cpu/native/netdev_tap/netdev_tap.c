@@ -94,16 +94,30 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
     return value;
 }
 
-static inline void _isr(netdev_t *netdev)
+static void _continue_reading(netdev_tap_t *dev);
+
+static void _isr(netdev_t *netdev)
 {
-    if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-    }
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+
+    if (!netdev->event_callback) {
 #if DEVELHELP
-    else {
         puts("netdev_tap: _isr(): no event_callback set.");
-    }
 #endif
+        return;
+    }
+
+    /* drain the frames queued by the host for one signal, _recv() tells
+     * whether the last read got a frame */
+    for (unsigned i = 0; i < NETDEV_TAP_RX_BATCH; i++) {
+        dev->rx_more = false;
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        if (!dev->rx_more) {
+            break;
+        }
+    }
+
+    _continue_reading(dev);
 }
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
@@ -124,6 +138,15 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             *((bool*)value) = (bool)_get_promiscous(dev);
             res = sizeof(bool);
             break;
+        case NETOPT_RX_PREALLOC:
+            if (max_len < sizeof(uint16_t)) {
+                res = -EINVAL;
+            }
+            else {
+                *((uint16_t *)value) = ETHERNET_FRAME_LEN;
+                res = sizeof(uint16_t);
+            }
+            break;
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -224,9 +247,8 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
             static uint8_t nullbuf[ETHERNET_FRAME_LEN];
 
-            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
+            dev->rx_more = (real_read(dev->tap_fd, nullbuf,
+                                      sizeof(nullbuf)) > 0);
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -238,6 +260,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
+        dev->rx_more = true;
         ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
         if (!(dev->promiscous) && !_is_addr_multicast(hdr->dst) &&
             !_is_addr_broadcast(hdr->dst) &&
@@ -247,13 +270,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
-
             return 0;
         }
 
-        _continue_reading(dev);
-
 #ifdef MODULE_NETSTATS_L2
         netdev->stats.rx_count++;
         netdev->stats.rx_bytes += nread;
@@ -32,7 +32,11 @@
 void pm_set_lowest(void)
 {
     _native_in_syscall++; /* no switching here */
+#ifdef MODULE_NATIVE_VTIME
+    native_vtime_idle();
+#else
     real_pause();
+#endif
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
@@ -17,6 +17,12 @@
  *
  * Uses POSIX realtime clock and POSIX itimer to mimic hardware.
  *
+ * With the `native_vtime` module, the timer counts virtual time instead: when
+ * RIOT is idle, the time jumps to the next timer target. With `--vtime=<file>`
+ * several instances share a clock through a memory mapped file. Time only
+ * advances when all of them are idle, to the earliest target among them, so
+ * a network of nodes runs faster than real time and in a consistent order.
+ *
  * This is based on native's hwtimer implementation by Ludwig Knüpfer.
  * I removed the multiplexing, as xtimer does the same. (kaspar)
  *
@@ -53,11 +59,52 @@
 
 #define NATIVE_TIMER_SPEED 1000000
 
+#ifdef MODULE_NATIVE_VTIME
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * maximum number of instances sharing a virtual clock
+ */
+#ifndef NATIVE_VTIME_NODES_MAX
+#define NATIVE_VTIME_NODES_MAX  (256U)
+#endif
+
+/**
+ * time in us between checks of the shared clock while waiting for others
+ */
+#ifndef NATIVE_VTIME_POLL_US
+#define NATIVE_VTIME_POLL_US    (100U)
+#endif
+
+#define VTIME_NONE              (UINT64_MAX)
+
+typedef struct {
+    uint32_t pid;               /* owner of the slot, 0 if unused */
+    uint32_t idle;              /* waiting for the time to advance */
+    uint64_t deadline;          /* next timer target of the node */
+} _vtime_node_t;
+
+typedef struct {
+    uint32_t lock;
+    uint64_t now;               /* latest time granted to any node */
+    _vtime_node_t node[NATIVE_VTIME_NODES_MAX];
+} _vtime_shared_t;
+
+const char *_native_vtime_file = NULL;
+static uint64_t _vtime_now;
+static uint64_t _vtime_deadline = VTIME_NONE;
+static _vtime_shared_t *_shared;
+static _vtime_node_t *_node;
+#else
 static unsigned long time_null;
+#endif
 
 static timer_cb_t _callback;
 static void *_cb_arg;
 
+#ifndef MODULE_NATIVE_VTIME
 static struct itimerval itv;
 
 /**
@@ -68,6 +115,7 @@ static unsigned long ts2ticks(struct timespec *tp)
     /* TODO: check for overflow */
     return((tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
 }
+#endif
 
 /**
  * native timer signal handler
@@ -81,6 +129,128 @@ void native_isr_timer(void)
     _callback(_cb_arg, 0);
 }
 
+#ifdef MODULE_NATIVE_VTIME
+static void _vtime_lock(void)
+{
+    while (__atomic_exchange_n(&_shared->lock, 1, __ATOMIC_ACQUIRE)) {}
+}
+
+static void _vtime_unlock(void)
+{
+    __atomic_store_n(&_shared->lock, 0, __ATOMIC_RELEASE);
+}
+
+static void _vtime_leave(void)
+{
+    _vtime_lock();
+    _node->pid = 0;
+    _node->idle = 0;
+    _vtime_unlock();
+}
+
+static void _vtime_join(void)
+{
+    int fd = real_open(_native_vtime_file, O_RDWR | O_CREAT, 0600);
+    if (fd == -1) {
+        err(EXIT_FAILURE, "vtime: open(%s)", _native_vtime_file);
+    }
+    if (ftruncate(fd, sizeof(_vtime_shared_t)) == -1) {
+        err(EXIT_FAILURE, "vtime: ftruncate");
+    }
+    _shared = mmap(NULL, sizeof(_vtime_shared_t), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+    if (_shared == MAP_FAILED) {
+        err(EXIT_FAILURE, "vtime: mmap");
+    }
+    real_close(fd);
+
+    _vtime_lock();
+    for (unsigned i = 0; i < NATIVE_VTIME_NODES_MAX; i++) {
+        if (_shared->node[i].pid == 0) {
+            _node = &_shared->node[i];
+            _node->pid = _native_pid;
+            _node->idle = 0;
+            _node->deadline = VTIME_NONE;
+            break;
+        }
+    }
+    _vtime_now = _shared->now;
+    _vtime_unlock();
+
+    if (_node == NULL) {
+        errx(EXIT_FAILURE, "vtime: more than %u nodes", NATIVE_VTIME_NODES_MAX);
+    }
+    atexit(_vtime_leave);
+}
+
+/* called with the lock held */
+static bool _vtime_is_next(void)
+{
+    for (unsigned i = 0; i < NATIVE_VTIME_NODES_MAX; i++) {
+        _vtime_node_t *node = &_shared->node[i];
+        if ((node->pid == 0) || (node == _node)) {
+            continue;
+        }
+        if (!node->idle || (node->deadline < _vtime_deadline)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* jumps to the timer target and raises the timer interrupt, which is
+ * handled when pm_set_lowest() leaves its syscall section */
+static void _vtime_fire(void)
+{
+    _vtime_now = _vtime_deadline;
+    _vtime_deadline = VTIME_NONE;
+    kill(_native_pid, SIGALRM);
+}
+
+void native_vtime_idle(void)
+{
+    if (_shared == NULL) {
+        if (_vtime_deadline == VTIME_NONE) {
+            real_pause();
+        }
+        else {
+            _vtime_fire();
+        }
+        return;
+    }
+
+    _vtime_lock();
+    _node->deadline = _vtime_deadline;
+    _node->idle = 1;
+    _vtime_unlock();
+
+    /* any signal, e.g. a frame from another node, ends idling */
+    while (_native_sigpend == 0) {
+        _vtime_lock();
+        if ((_vtime_deadline != VTIME_NONE) && _vtime_is_next()) {
+            if (_shared->now < _vtime_deadline) {
+                _shared->now = _vtime_deadline;
+            }
+            _node->idle = 0;
+            _vtime_unlock();
+            _vtime_fire();
+            return;
+        }
+        _vtime_unlock();
+
+        struct timeval t = { .tv_sec = 0, .tv_usec = NATIVE_VTIME_POLL_US };
+        real_select(0, NULL, NULL, NULL, &t);
+    }
+
+    _vtime_lock();
+    _node->idle = 0;
+    if (_vtime_now < _shared->now) {
+        _vtime_now = _shared->now;
+    }
+    _vtime_unlock();
+}
+#endif
+
 int timer_init(tim_t dev, unsigned long freq, timer_cb_t cb, void *arg)
 {
     (void)freq;
@@ -92,9 +262,15 @@ int timer_init(tim_t dev, unsigned long freq, timer_cb_t cb, void *arg)
         return -1;
     }
 
+#ifdef MODULE_NATIVE_VTIME
+    if ((_native_vtime_file != NULL) && (_shared == NULL)) {
+        _vtime_join();
+    }
+#else
     /* initialize time delta */
     time_null = 0;
     time_null = timer_read(0);
+#endif
 
     _callback = cb;
     _cb_arg = arg;
@@ -109,6 +285,10 @@ static void do_timer_set(unsigned int offset)
 {
     DEBUG("%s\n", __func__);
 
+#ifdef MODULE_NATIVE_VTIME
+    _vtime_deadline = (offset) ? _vtime_now + offset : VTIME_NONE;
+#else
+
     if (offset && offset < NATIVE_TIMER_MIN_RES) {
         offset = NATIVE_TIMER_MIN_RES;
     }
@@ -124,6 +304,7 @@ static void do_timer_set(unsigned int offset)
         err(EXIT_FAILURE, "timer_arm: setitimer");
     }
     _native_syscall_leave();
+#endif
 }
 
 int timer_set(tim_t dev, int channel, unsigned int offset)
@@ -178,10 +359,14 @@ unsigned int timer_read(tim_t dev)
         return 0;
     }
 
-    struct timespec t;
-
     DEBUG("timer_read()\n");
 
+#ifdef MODULE_NATIVE_VTIME
+    /* every read takes a tick, so busy waiting loops terminate */
+    return (unsigned)(_vtime_now++);
+#else
+    struct timespec t;
+
     _native_syscall_enter();
 #ifdef __MACH__
     clock_serv_t cclock;
@@ -201,4 +386,5 @@ unsigned int timer_read(tim_t dev)
     _native_syscall_leave();
 
     return ts2ticks(&t) - time_null;
+#endif
 }
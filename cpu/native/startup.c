@@ -92,6 +92,9 @@ static const char short_opts[] = ":hi:s:deEoc:"
 #endif
 #ifdef MODULE_SOCKET_ZEP
     "z:"
+#endif
+#ifdef MODULE_NATIVE_VTIME
+    "t:"
 #endif
     "";
 
@@ -112,6 +115,9 @@ static const struct option long_opts[] = {
 #endif
 #ifdef MODULE_SOCKET_ZEP
     { "zep", required_argument, NULL, 'z' },
+#endif
+#ifdef MODULE_NATIVE_VTIME
+    { "vtime", required_argument, NULL, 't' },
 #endif
     { NULL, 0, NULL, '\0' },
 };
@@ -292,6 +298,11 @@ void usage_exit(int status)
 "    -n <ifnum>:<ifname>, --can <ifnum>:<ifname>\n"
 "        specify CAN interface <ifname> to use for CAN device #<ifnum>\n"
 "        max number of CAN device: %d\n", CAN_DLL_NUMOF);
+#endif
+#ifdef MODULE_NATIVE_VTIME
+    real_printf(
+"    -t <file>, --vtime=<file>\n"
+"        share the virtual clock with all instances using <file>\n");
 #endif
     real_exit(status);
 }
@@ -451,6 +462,11 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
                 }
                 break;
 #endif
+#ifdef MODULE_NATIVE_VTIME
+            case 't':
+                _native_vtime_file = optarg;
+                break;
+#endif
 #ifdef MODULE_SOCKET_ZEP
             case 'z':
                 _zep_params_setup(optarg, zeps++);
@@ -113,6 +113,11 @@ typedef struct {
 #define PERIPH_I2C_NEED_WRITE_REG
 /** @} */
 
+/**
+ * @brief   Queued I2C transfers are driven by the TWIM interrupt
+ */
+#define PERIPH_I2C_HAVE_ASYNC
+
 /**
  * @name    The PWM unit on the nRF52 supports 4 channels per device
  */
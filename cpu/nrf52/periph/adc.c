@@ -44,6 +44,30 @@
 #endif
 /** @} */
 
+/**
+ * @brief   PPI channel restarting the SAADC with the second buffer during
+ *          continuous sampling
+ *
+ * Can be overridden by the board configuration if the channel is used
+ * elsewhere.
+ */
+#ifndef ADC_CONTINUOUS_PPI_CH
+#define ADC_CONTINUOUS_PPI_CH   (19U)
+#endif
+
+/**
+ * @brief   Clock of the SAADC's sample rate timer in Hz
+ */
+#define SAMPLERATE_CLK      (16000000UL)
+
+/**
+ * @brief   Valid range of the sample rate timer's compare value
+ * @{
+ */
+#define SAMPLERATE_CC_MIN   (80UL)
+#define SAMPLERATE_CC_MAX   (2047UL)
+/** @} */
+
 /**
  * @brief   Lock to prevent concurrency issues when used from different threads
  */
@@ -55,6 +79,19 @@ static mutex_t lock = MUTEX_INIT;
  */
 static int16_t result;
 
+#ifdef MODULE_PERIPH_ADC_CONTINUOUS
+/**
+ * @brief   State of continuous sampling
+ */
+static struct {
+    adc_cb_t cb;            /**< callback, NULL if not sampling */
+    void *arg;              /**< argument of cb */
+    int16_t *buf;           /**< double buffer */
+    size_t len;             /**< samples per half of buf */
+    unsigned filling;       /**< half of buf the SAADC is writing to */
+} cont;
+#endif
+
 static inline void prep(void)
 {
     mutex_lock(&lock);
@@ -144,3 +181,104 @@ int adc_sample(adc_t line, adc_res_t res)
      * voltage levels?! (observed on nrf52dk and nrf52840dk) */
     return (result < 0) ? 0 : (int)result;
 }
+
+#ifdef MODULE_PERIPH_ADC_CONTINUOUS
+int adc_continuous_start(adc_t line, adc_res_t res, uint32_t freq,
+                         int16_t *buf, size_t len, adc_cb_t cb, void *arg)
+{
+    assert((line < ADC_NUMOF) && buf && cb);
+    assert((len > 0) && (len <= SAADC_RESULT_MAXCNT_MAXCNT_Msk));
+
+    uint32_t cc = (freq) ? (SAMPLERATE_CLK / freq) : 0;
+    if ((res > 2) || (cc < SAMPLERATE_CC_MIN) || (cc > SAMPLERATE_CC_MAX)) {
+        return -1;
+    }
+
+    /* the ADC stays reserved until adc_continuous_stop() */
+    prep();
+
+    cont.cb = cb;
+    cont.arg = arg;
+    cont.buf = buf;
+    cont.len = len;
+    cont.filling = 0;
+
+    NRF_SAADC->RESOLUTION = res;
+    NRF_SAADC->CH[0].PSELP = (line + 1);
+    /* let the SAADC's own timer trigger the conversions */
+    NRF_SAADC->SAMPLERATE = ((SAADC_SAMPLERATE_MODE_Timers <<
+                              SAADC_SAMPLERATE_MODE_Pos) |
+                             (cc << SAADC_SAMPLERATE_CC_Pos));
+
+    /* start with the first half, the result pointer is double buffered, so
+     * the second half can be set up right after the STARTED event */
+    NRF_SAADC->RESULT.PTR = (uint32_t)buf;
+    NRF_SAADC->RESULT.MAXCNT = len;
+    NRF_SAADC->EVENTS_STARTED = 0;
+    NRF_SAADC->TASKS_START = 1;
+    while (NRF_SAADC->EVENTS_STARTED == 0) {}
+    NRF_SAADC->EVENTS_STARTED = 0;
+    NRF_SAADC->RESULT.PTR = (uint32_t)&buf[len];
+
+    /* restart the SAADC with the prepared half as soon as one is full, so no
+     * sample is lost while the interrupt is pending */
+    NRF_PPI->CH[ADC_CONTINUOUS_PPI_CH].EEP = (uint32_t)&NRF_SAADC->EVENTS_END;
+    NRF_PPI->CH[ADC_CONTINUOUS_PPI_CH].TEP = (uint32_t)&NRF_SAADC->TASKS_START;
+    NRF_PPI->CHENSET = (1UL << ADC_CONTINUOUS_PPI_CH);
+
+    NRF_SAADC->EVENTS_END = 0;
+    NRF_SAADC->INTENSET = (SAADC_INTEN_END_Msk | SAADC_INTEN_STARTED_Msk);
+    NVIC_EnableIRQ(SAADC_IRQn);
+
+    NRF_SAADC->TASKS_SAMPLE = 1;
+
+    return 0;
+}
+
+void adc_continuous_stop(adc_t line)
+{
+    (void)line;
+
+    if (cont.cb == NULL) {
+        return;
+    }
+    cont.cb = NULL;
+
+    NRF_SAADC->INTENCLR = (SAADC_INTEN_END_Msk | SAADC_INTEN_STARTED_Msk);
+    NRF_PPI->CHENCLR = (1UL << ADC_CONTINUOUS_PPI_CH);
+    NRF_SAADC->EVENTS_STOPPED = 0;
+    NRF_SAADC->TASKS_STOP = 1;
+    while (NRF_SAADC->EVENTS_STOPPED == 0) {}
+    NRF_SAADC->SAMPLERATE = 0;
+
+    /* restore the setup adc_sample() relies on */
+    NRF_SAADC->RESULT.MAXCNT = 1;
+    NRF_SAADC->RESULT.PTR = (uint32_t)&result;
+    NRF_SAADC->EVENTS_END = 0;
+    NRF_SAADC->EVENTS_STARTED = 0;
+
+    done();
+}
+
+void isr_saadc(void)
+{
+    if (NRF_SAADC->EVENTS_END) {
+        NRF_SAADC->EVENTS_END = 0;
+        if (cont.cb) {
+            cont.cb(cont.arg, &cont.buf[cont.filling * cont.len], cont.len);
+        }
+    }
+
+    /* the SAADC switched to the prepared half, the one just handed to the
+     * callback is filled next */
+    if (NRF_SAADC->EVENTS_STARTED) {
+        NRF_SAADC->EVENTS_STARTED = 0;
+        if (cont.cb) {
+            NRF_SAADC->RESULT.PTR = (uint32_t)&cont.buf[cont.filling * cont.len];
+            cont.filling ^= 1;
+        }
+    }
+
+    cortexm_isr_end();
+}
+#endif /* MODULE_PERIPH_ADC_CONTINUOUS */
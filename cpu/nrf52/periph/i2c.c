@@ -212,3 +212,133 @@ int i2c_write_bytes(i2c_t dev, uint16_t addr, const void *data, size_t len,
 
     return finish(dev);
 }
+
+#ifdef MODULE_PERIPH_I2C_ASYNC
+/**
+ * @brief   Transfers in progress
+ */
+static i2c_xfer_t *_xfer[I2C_NUMOF];
+
+static inline IRQn_Type irqn(i2c_t dev)
+{
+    /* the IRQ number of a nRF52 peripheral equals its ID, which is encoded in
+     * bits 12 to 17 of its base address */
+    return (IRQn_Type)(((uint32_t)bus(dev) >> 12) & 0x3f);
+}
+
+int i2c_xfer_start(i2c_t dev, i2c_xfer_t *xfer)
+{
+    assert(dev < I2C_NUMOF);
+
+    if (xfer->flags & (I2C_REG16 | I2C_ADDR10)) {
+        return -EOPNOTSUPP;
+    }
+    if (!xfer->data || (xfer->len == 0) || (xfer->len > 255)) {
+        return -EINVAL;
+    }
+    DEBUG("[i2c] xfer_start: op %u, %i byte(s) at addr 0x%02x\n",
+          (unsigned)xfer->op, (int)xfer->len, (int)xfer->addr);
+
+    _xfer[dev] = xfer;
+    bus(dev)->EVENTS_STOPPED = 0;
+    bus(dev)->EVENTS_ERROR = 0;
+    bus(dev)->EVENTS_SUSPENDED = 0;
+    bus(dev)->INTENSET = (TWIM_INTEN_STOPPED_Msk | TWIM_INTEN_ERROR_Msk |
+                          TWIM_INTEN_SUSPENDED_Msk);
+    NVIC_EnableIRQ(irqn(dev));
+
+    bus(dev)->ADDRESS = xfer->addr;
+    bus(dev)->RXD.PTR = (uint32_t)xfer->data;
+    bus(dev)->RXD.MAXCNT = (uint8_t)xfer->len;
+    /* the register address is sent from the descriptor, which stays valid
+     * until the transfer is finished */
+    bus(dev)->TXD.PTR = (uint32_t)&xfer->reg;
+    bus(dev)->TXD.MAXCNT = 1;
+
+    switch (xfer->op) {
+        case I2C_XFER_READ_BYTES:
+            bus(dev)->SHORTS = TWIM_SHORTS_LASTRX_STOP_Msk;
+            bus(dev)->TASKS_STARTRX = 1;
+            return 0;
+        case I2C_XFER_READ_REGS:
+            bus(dev)->SHORTS = (TWIM_SHORTS_LASTTX_STARTRX_Msk |
+                                TWIM_SHORTS_LASTRX_STOP_Msk);
+            break;
+        case I2C_XFER_WRITE_BYTES:
+            bus(dev)->TXD.PTR = (uint32_t)xfer->data;
+            bus(dev)->TXD.MAXCNT = (uint8_t)xfer->len;
+            bus(dev)->SHORTS = TWIM_SHORTS_LASTTX_STOP_Msk;
+            break;
+        case I2C_XFER_WRITE_REGS:
+            /* send the register address first and suspend, the data follows
+             * from the interrupt without a repeated start condition, so no
+             * temporary buffer is needed */
+            bus(dev)->SHORTS = TWIM_SHORTS_LASTTX_SUSPEND_Msk;
+            break;
+        default:
+            bus(dev)->INTENCLR = 0xffffffff;
+            _xfer[dev] = NULL;
+            return -EINVAL;
+    }
+    bus(dev)->TASKS_STARTTX = 1;
+
+    return 0;
+}
+
+static void isr_xfer(i2c_t dev)
+{
+    i2c_xfer_t *xfer = _xfer[dev];
+
+    if (bus(dev)->EVENTS_SUSPENDED) {
+        bus(dev)->EVENTS_SUSPENDED = 0;
+        bus(dev)->SHORTS = TWIM_SHORTS_LASTTX_STOP_Msk;
+        bus(dev)->TXD.PTR = (uint32_t)xfer->data;
+        bus(dev)->TXD.MAXCNT = (uint8_t)xfer->len;
+        bus(dev)->TASKS_STARTTX = 1;
+        bus(dev)->TASKS_RESUME = 1;
+    }
+
+    if (bus(dev)->EVENTS_ERROR) {
+        bus(dev)->EVENTS_ERROR = 0;
+        /* the TWIM does not stop by itself on errors */
+        bus(dev)->TASKS_RESUME = 1;
+        bus(dev)->TASKS_STOP = 1;
+    }
+
+    if (bus(dev)->EVENTS_STOPPED) {
+        int res = 0;
+        uint32_t errorsrc = bus(dev)->ERRORSRC;
+
+        bus(dev)->EVENTS_STOPPED = 0;
+        bus(dev)->INTENCLR = 0xffffffff;
+        bus(dev)->SHORTS = 0;
+        if (errorsrc) {
+            bus(dev)->ERRORSRC = errorsrc;
+            res = (errorsrc & TWIM_ERRORSRC_ANACK_Msk) ? -ENXIO : -EIO;
+            DEBUG("[i2c] isr_xfer: transfer failed (%i)\n", res);
+        }
+        _xfer[dev] = NULL;
+        i2c_xfer_done(dev, res);
+    }
+}
+
+static void isr_twim(NRF_TWIM_Type *twim)
+{
+    for (i2c_t dev = 0; dev < I2C_NUMOF; dev++) {
+        if ((bus(dev) == twim) && _xfer[dev]) {
+            isr_xfer(dev);
+        }
+    }
+    cortexm_isr_end();
+}
+
+void isr_spi0_twi0(void)
+{
+    isr_twim(NRF_TWIM0);
+}
+
+void isr_spi1_twi1(void)
+{
+    isr_twim(NRF_TWIM1);
+}
+#endif /* MODULE_PERIPH_I2C_ASYNC */
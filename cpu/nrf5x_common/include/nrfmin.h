@@ -104,6 +104,16 @@ extern "C" {
 #define NRFMIN_PAYLOAD_MAX          (200U)
 #endif
 
+/**
+ * @brief   Number of receive buffers
+ *
+ * While received packets wait to be read, the radio continues to receive
+ * into the remaining buffers, so back-to-back packets are not lost.
+ */
+#ifndef NRFMIN_RX_BUF_NUMOF
+#define NRFMIN_RX_BUF_NUMOF         (2U)
+#endif
+
 /**
  * @brief   Export some information on header and packet lengths
  * @{
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_nrf5x_common
+ * @ingroup     drivers_periph_aes
+ * @{
+ *
+ * @file
+ * @brief       AES-128 implementation using the ECB peripheral
+ *
+ * The ECB peripheral only supports encryption. As it uses the same context
+ * layout as the software AES, decryption is done in software.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "cpu.h"
+#include "mutex.h"
+#include "crypto/aes.h"
+#include "periph/aes.h"
+
+/* the ECB peripheral reads key and cleartext from and writes the ciphertext
+ * to this structure, so it needs to reside in RAM */
+static struct {
+    uint8_t key[AES_KEY_SIZE];
+    uint8_t clear[AES_BLOCK_SIZE];
+    uint8_t cipher[AES_BLOCK_SIZE];
+} _ecb;
+
+static mutex_t _lock = MUTEX_INIT;
+
+static int _encrypt(const cipher_context_t *ctx, const uint8_t *plain_block,
+                    uint8_t *cipher_block)
+{
+    int res = 1;
+
+    mutex_lock(&_lock);
+#ifdef CPU_FAM_NRF51
+    NRF_ECB->POWER = 1;
+#endif
+
+    memcpy(_ecb.key, ctx->context, AES_KEY_SIZE);
+    memcpy(_ecb.clear, plain_block, AES_BLOCK_SIZE);
+    NRF_ECB->ECBDATAPTR = (uint32_t)&_ecb;
+    NRF_ECB->EVENTS_ENDECB = 0;
+    NRF_ECB->EVENTS_ERRORECB = 0;
+    NRF_ECB->TASKS_STARTECB = 1;
+
+    /* a block takes less than 20us, not worth sleeping for */
+    while ((NRF_ECB->EVENTS_ENDECB == 0) && (NRF_ECB->EVENTS_ERRORECB == 0)) {}
+
+    if (NRF_ECB->EVENTS_ERRORECB) {
+        res = CIPHER_ERR_ENC_FAILED;
+    }
+    else {
+        memcpy(cipher_block, _ecb.cipher, AES_BLOCK_SIZE);
+    }
+    NRF_ECB->EVENTS_ENDECB = 0;
+    NRF_ECB->EVENTS_ERRORECB = 0;
+    /* don't leave key material behind */
+    memset(&_ecb, 0, sizeof(_ecb));
+
+#ifdef CPU_FAM_NRF51
+    NRF_ECB->POWER = 0;
+#endif
+    mutex_unlock(&_lock);
+
+    return res;
+}
+
+const cipher_interface_t periph_aes_interface = {
+    AES_BLOCK_SIZE,
+    AES_KEY_SIZE,
+    aes_init,
+    _encrypt,
+    aes_decrypt
+};
@@ -22,6 +22,7 @@
 #include <errno.h>
 
 #include "cpu.h"
+#include "irq.h"
 #include "mutex.h"
 #include "assert.h"
 
@@ -123,14 +124,43 @@ static nrfmin_pkt_t tx_buf;
  * @brief   As the device is memory mapped, we need some space to save incoming
  *          data to.
  *
- * @todo    Improve the RX buffering to at least use double buffering
+ * The radio receives into the buffer following the received packets, the
+ * END interrupt passes it the next buffer right away.
  */
-static nrfmin_pkt_t rx_buf;
+static nrfmin_pkt_t rx_buf[NRFMIN_RX_BUF_NUMOF];
 
 /**
- * @brief   While we listen for incoming data, we lock the RX buffer
+ * @brief   Oldest received packet
  */
-static volatile uint8_t rx_lock = 0;
+static volatile unsigned rx_first = 0;
+
+/**
+ * @brief   Number of received packets waiting to be read
+ */
+static volatile unsigned rx_numof = 0;
+
+/**
+ * @brief   Buffer the radio receives into next
+ */
+static inline nrfmin_pkt_t *rx_next(void)
+{
+    return &rx_buf[(rx_first + rx_numof) % NRFMIN_RX_BUF_NUMOF];
+}
+
+/**
+ * @brief   Start reception into the next buffer, if one is free
+ *
+ * @return  0 if all buffers are full and the radio stays idle
+ */
+static int rx_start(void)
+{
+    if (rx_numof == NRFMIN_RX_BUF_NUMOF) {
+        return 0;
+    }
+    NRF_RADIO->PACKETPTR = (uint32_t)rx_next();
+    NRF_RADIO->BASE0 = (CONF_ADDR_BASE | my_addr);
+    return 1;
+}
 
 /**
  * @brief   Set radio into idle (DISABLED) state
@@ -141,8 +171,7 @@ static void go_idle(void)
     NRF_RADIO->EVENTS_DISABLED = 0;
     NRF_RADIO->TASKS_DISABLE = 1;
     while (NRF_RADIO->EVENTS_DISABLED == 0) {}
-    /* also release any existing lock on the RX buffer */
-    rx_lock = 0;
+    NRF_RADIO->SHORTS = RADIO_SHORTS_READY_START_Msk;
     state = STATE_IDLE;
 }
 
@@ -157,14 +186,12 @@ static void goto_target_state(void)
 {
     go_idle();
 
-    if ((target_state == STATE_RX) && (rx_buf.pkt.hdr.len == 0)) {
-        /* set receive buffer and our own address */
-        rx_lock = 1;
-        NRF_RADIO->PACKETPTR = (uint32_t)(&rx_buf);
-        NRF_RADIO->BASE0 = (CONF_ADDR_BASE | my_addr);
-        /* goto RX mode */
-        NRF_RADIO->TASKS_RXEN = 1;
+    if (target_state == STATE_RX) {
+        /* with all buffers full, recv() enables RX again */
         state = STATE_RX;
+        if (rx_start()) {
+            NRF_RADIO->TASKS_RXEN = 1;
+        }
     }
 
     if (target_state == STATE_OFF) {
@@ -308,17 +335,31 @@ void isr_radio(void)
         NRF_RADIO->EVENTS_END = 0;
         /* did we just send or receive something? */
         if (state == STATE_RX) {
-            /* drop packet on invalid CRC */
+            /* drop packet on invalid CRC, the next one goes to the same buffer */
             if ((NRF_RADIO->CRCSTATUS != 1) || !(nrfmin_dev.event_callback)) {
-                rx_buf.pkt.hdr.len = 0;
                 NRF_RADIO->TASKS_START = 1;
+                cortexm_isr_end();
                 return;
             }
-            rx_lock = 0;
+            /* keep the packet and continue in the next buffer */
+            rx_numof++;
+            if (rx_start()) {
+                NRF_RADIO->TASKS_START = 1;
+            }
             nrfmin_dev.event_callback(&nrfmin_dev, NETDEV_EVENT_ISR);
         }
         else if (state == STATE_TX) {
-            goto_target_state();
+            if (NRF_RADIO->SHORTS & RADIO_SHORTS_DISABLED_RXEN_Msk) {
+                /* the radio is already ramping up for RX, which leaves us
+                 * enough time to pass it the RX buffer and address before
+                 * it starts */
+                NRF_RADIO->SHORTS = RADIO_SHORTS_READY_START_Msk;
+                rx_start();
+                state = STATE_RX;
+            }
+            else {
+                goto_target_state();
+            }
         }
     }
 
@@ -351,6 +392,13 @@ static int nrfmin_send(netdev_t *dev, const iolist_t *iolist)
     NRF_RADIO->PACKETPTR = (uint32_t)(&tx_buf);
     NRF_RADIO->BASE0 = (CONF_ADDR_BASE | hdr->dst_addr);
 
+    /* switch to RX right after the transmission if a buffer is free */
+    if ((target_state == STATE_RX) && (rx_numof < NRFMIN_RX_BUF_NUMOF)) {
+        NRF_RADIO->SHORTS = (RADIO_SHORTS_READY_START_Msk |
+                             RADIO_SHORTS_END_DISABLE_Msk |
+                             RADIO_SHORTS_DISABLED_RXEN_Msk);
+    }
+
     /* trigger the actual transmission */
     DEBUG("[nrfmin] send: putting %i byte into the ether\n", (int)hdr->len);
     state = STATE_TX;
@@ -366,30 +414,40 @@ static int nrfmin_recv(netdev_t *dev, void *buf, size_t len, void *info)
 
     assert(state != STATE_OFF);
 
-    unsigned pktlen = rx_buf.pkt.hdr.len;
-
     /* check if packet data is readable */
-    if (rx_lock || (pktlen == 0)) {
+    if (rx_numof == 0) {
         DEBUG("[nrfmin] recv: no packet data available\n");
         return 0;
     }
 
+    nrfmin_pkt_t *pkt = &rx_buf[rx_first];
+    unsigned pktlen = pkt->pkt.hdr.len;
+
     if (buf == NULL) {
-        if (len > 0) {
-            /* drop packet */
-            DEBUG("[nrfmin] recv: dropping packet of length %i\n", pktlen);
-            rx_buf.pkt.hdr.len = 0;
-            goto_target_state();
+        if (len == 0) {
+            return pktlen;
         }
+        /* drop packet */
+        DEBUG("[nrfmin] recv: dropping packet of length %i\n", pktlen);
     }
     else {
         DEBUG("[nrfmin] recv: reading packet of length %i\n", pktlen);
 
         pktlen = (len < pktlen) ? len : pktlen;
-        memcpy(buf, rx_buf.raw, pktlen);
-        rx_buf.pkt.hdr.len = 0;
+        memcpy(buf, pkt->raw, pktlen);
+    }
+
+    /* release the buffer, if the radio stopped for lack of buffers it
+     * continues in this one */
+    unsigned irq = irq_disable();
+    int stalled = (rx_numof == NRFMIN_RX_BUF_NUMOF);
+
+    rx_first = (rx_first + 1) % NRFMIN_RX_BUF_NUMOF;
+    rx_numof--;
+    if (stalled && (state == STATE_RX)) {
         goto_target_state();
     }
+    irq_restore(irq);
 
     return pktlen;
 }
@@ -456,8 +514,16 @@ static int nrfmin_init(netdev_t *dev)
 
 static void nrfmin_isr(netdev_t *dev)
 {
-    if (nrfmin_dev.event_callback) {
+    /* one ISR event may stand for several packets received back-to-back,
+     * each RX_COMPLETE handler reads one of them */
+    while (rx_numof && nrfmin_dev.event_callback) {
+        unsigned numof = rx_numof;
+
         nrfmin_dev.event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+        if (rx_numof >= numof) {
+            /* the packet was not read, leave it for the next event */
+            break;
+        }
     }
 }
 
@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_sam0_common
+ * @ingroup     drivers_periph_dma
+ * @{
+ *
+ * @file
+ * @brief       Low-level DMA driver implementation for the DMAC
+ *
+ * Logical DMA streams map 1:1 to the channels of the DMAC. Every channel uses
+ * a single transfer descriptor, which links back to itself in circular mode.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "cpu.h"
+#include "irq.h"
+#include "mutex.h"
+#include "assert.h"
+#include "periph/dma.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define DMA_NUMOF           (DMAC_CH_NUM)
+
+struct dma_ctx {
+    mutex_t conf_lock;
+    mutex_t sync_lock;
+    dma_cb_t cb;
+    void *arg;
+    uint8_t swtrig;
+};
+
+static struct dma_ctx dma_ctx[DMA_NUMOF];
+
+/* the DMAC fetches the descriptors from and writes them back to SRAM */
+static DmacDescriptor _desc[DMA_NUMOF] __attribute__((aligned(16)));
+static DmacDescriptor _wb[DMA_NUMOF] __attribute__((aligned(16)));
+
+static inline void poweron(void)
+{
+#if defined(CPU_FAM_SAMD21)
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+#elif defined(CPU_FAM_SAML21) || defined(CPU_FAM_SAMR30)
+    MCLK->AHBMASK.reg |= MCLK_AHBMASK_DMAC;
+#endif
+}
+
+/* DMAC->CHID is shared with the ISR, so channel register accesses from thread
+ * context must be done with interrupts disabled */
+static inline void _select(dma_t dma)
+{
+    DMAC->CHID.reg = DMAC_CHID_ID(dma);
+}
+
+void dma_init(void)
+{
+    for (unsigned i = 0; i < DMA_NUMOF; i++) {
+        mutex_init(&dma_ctx[i].conf_lock);
+        mutex_init(&dma_ctx[i].sync_lock);
+        mutex_lock(&dma_ctx[i].sync_lock);
+    }
+
+    poweron();
+    DMAC->CTRL.reg = 0;
+    DMAC->CTRL.reg = DMAC_CTRL_SWRST;
+    while (DMAC->CTRL.reg & DMAC_CTRL_SWRST) {}
+
+    DMAC->BASEADDR.reg = (uint32_t)_desc;
+    DMAC->WRBADDR.reg = (uint32_t)_wb;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xf);
+
+    NVIC_EnableIRQ(DMAC_IRQn);
+}
+
+int dma_transfer(dma_t dma, int chan, const void *src, void *dst, size_t len,
+                 dma_mode_t mode, uint8_t flags)
+{
+    int ret = dma_configure(dma, chan, src, dst, len, mode, flags);
+    if (ret != 0) {
+        return ret;
+    }
+    dma_start(dma);
+    dma_wait(dma);
+    dma_stop(dma);
+
+    return len;
+}
+
+void dma_acquire(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    mutex_lock(&dma_ctx[dma].conf_lock);
+}
+
+void dma_release(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    mutex_unlock(&dma_ctx[dma].conf_lock);
+}
+
+int dma_configure(dma_t dma, int chan, const void *src, void *dst, size_t len,
+                  dma_mode_t mode, uint8_t flags)
+{
+    assert(src != NULL);
+    assert(dst != NULL);
+    assert(dma < DMA_NUMOF);
+
+    uint32_t width = (flags & DMA_DATA_WIDTH_MASK) >> DMA_DATA_WIDTH_SHIFT;
+    uint32_t chctrlb;
+    uint16_t btctrl = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE(width);
+    uintptr_t srcaddr = (uintptr_t)src;
+    uintptr_t dstaddr = (uintptr_t)dst;
+
+    if ((len == 0) || (len > UINT16_MAX)) {
+        return -1;
+    }
+
+    switch (mode) {
+        case DMA_PERIPH_TO_MEM:
+        case DMA_MEM_TO_PERIPH:
+            /* move one beat per request of the peripheral */
+            chctrlb = DMAC_CHCTRLB_TRIGSRC(chan) | DMAC_CHCTRLB_TRIGACT_BEAT;
+            dma_ctx[dma].swtrig = 0;
+            break;
+        case DMA_MEM_TO_MEM:
+            /* move the whole block on a software trigger */
+            chctrlb = DMAC_CHCTRLB_TRIGACT_BLOCK;
+            dma_ctx[dma].swtrig = 1;
+            break;
+        default:
+            return -1;
+    }
+
+    /* incremented addresses point to the end of the block */
+    if (flags & DMA_INC_SRC_ADDR) {
+        btctrl |= DMAC_BTCTRL_SRCINC;
+        srcaddr += len << width;
+    }
+    if (flags & DMA_INC_DST_ADDR) {
+        btctrl |= DMAC_BTCTRL_DSTINC;
+        dstaddr += len << width;
+    }
+    if (flags & DMA_CIRCULAR) {
+        btctrl |= DMAC_BTCTRL_BLOCKACT_INT;
+        _desc[dma].DESCADDR.reg = (uint32_t)&_desc[dma];
+    }
+    else {
+        _desc[dma].DESCADDR.reg = 0;
+    }
+    _desc[dma].BTCTRL.reg = btctrl;
+    _desc[dma].BTCNT.reg = len;
+    _desc[dma].SRCADDR.reg = srcaddr;
+    _desc[dma].DSTADDR.reg = dstaddr;
+    _wb[dma].BTCNT.reg = len;
+
+    unsigned state = irq_disable();
+    _select(dma);
+    DMAC->CHCTRLA.reg = 0;
+    while (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_ENABLE) {}
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    while (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_SWRST) {}
+    DMAC->CHCTRLB.reg = chctrlb;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL | DMAC_CHINTENSET_TERR;
+    irq_restore(state);
+
+    return 0;
+}
+
+void dma_start(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    unsigned state = irq_disable();
+    _select(dma);
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    if (dma_ctx[dma].swtrig) {
+        DMAC->SWTRIGCTRL.reg |= (1 << dma);
+    }
+    irq_restore(state);
+}
+
+uint16_t dma_suspend(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    uint16_t left = 0;
+    unsigned state = irq_disable();
+
+    _select(dma);
+    if (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_ENABLE) {
+        DMAC->CHCTRLB.reg = (DMAC->CHCTRLB.reg & ~DMAC_CHCTRLB_CMD_Msk) |
+                            DMAC_CHCTRLB_CMD_SUSPEND;
+        while (!(DMAC->CHINTFLAG.reg & (DMAC_CHINTFLAG_SUSP |
+                                        DMAC_CHINTFLAG_TCMPL |
+                                        DMAC_CHINTFLAG_TERR))) {}
+        DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_SUSP;
+        /* the write-back descriptor holds the state of a suspended channel */
+        left = _wb[dma].BTCNT.reg;
+    }
+    irq_restore(state);
+
+    return left;
+}
+
+void dma_resume(dma_t dma, uint16_t remaining)
+{
+    assert(dma < DMA_NUMOF);
+
+    if (remaining > 0) {
+        unsigned state = irq_disable();
+        _select(dma);
+        DMAC->CHCTRLB.reg = (DMAC->CHCTRLB.reg & ~DMAC_CHCTRLB_CMD_Msk) |
+                            DMAC_CHCTRLB_CMD_RESUME;
+        irq_restore(state);
+    }
+}
+
+void dma_stop(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    unsigned state = irq_disable();
+    _select(dma);
+    DMAC->CHCTRLA.reg = 0;
+    while (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_ENABLE) {}
+    irq_restore(state);
+}
+
+void dma_set_callback(dma_t dma, dma_cb_t cb, void *arg)
+{
+    assert(dma < DMA_NUMOF);
+
+    dma_ctx[dma].arg = arg;
+    dma_ctx[dma].cb = cb;
+}
+
+uint16_t dma_remaining(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    uint32_t active = DMAC->ACTIVE.reg;
+
+    /* the count of the channel currently being served is only visible in the
+     * ACTIVE register, all others are up to date in the write-back memory */
+    if ((active & DMAC_ACTIVE_ABUSY) &&
+        (((active & DMAC_ACTIVE_ID_Msk) >> DMAC_ACTIVE_ID_Pos) == dma)) {
+        return (active & DMAC_ACTIVE_BTCNT_Msk) >> DMAC_ACTIVE_BTCNT_Pos;
+    }
+    return _wb[dma].BTCNT.reg;
+}
+
+void dma_wait(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    mutex_lock(&dma_ctx[dma].sync_lock);
+}
+
+void isr_dmac(void)
+{
+    uint32_t pending = DMAC->INTSTATUS.reg;
+
+    for (unsigned dma = 0; pending; dma++, pending >>= 1) {
+        if (!(pending & 1)) {
+            continue;
+        }
+        _select(dma);
+        DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR;
+        DEBUG("[dma] channel %u done\n", dma);
+
+        if (dma_ctx[dma].cb) {
+            dma_ctx[dma].cb(dma_ctx[dma].arg);
+        }
+        else {
+            mutex_unlock(&dma_ctx[dma].sync_lock);
+        }
+    }
+
+    cortexm_isr_end();
+}
@@ -21,6 +21,9 @@
 #include "cpu.h"
 #include "periph_conf.h"
 #include "periph/init.h"
+#ifdef MODULE_PERIPH_DMA
+#include "periph/dma.h"
+#endif
 
 #ifndef CLOCK_8MHZ
 #define CLOCK_8MHZ          1
@@ -212,6 +215,10 @@ void cpu_init(void)
     cortexm_init();
     /* Initialise clock sources and generic clocks */
     clk_init();
+#ifdef MODULE_PERIPH_DMA
+    /* initialize DMA channels */
+    dma_init();
+#endif
     /* trigger static peripheral initialization */
     periph_init();
 }
@@ -20,6 +20,9 @@
 
 #include "cpu.h"
 #include "periph/init.h"
+#ifdef MODULE_PERIPH_DMA
+#include "periph/dma.h"
+#endif
 
 static void _gclk_setup(int gclk, uint32_t reg)
 {
@@ -79,6 +82,10 @@ void cpu_init(void)
     SUPC->BOD33.bit.ENABLE=0;
 #endif
 
+#ifdef MODULE_PERIPH_DMA
+    /* initialize DMA channels */
+    dma_init();
+#endif
     /* trigger static peripheral initialization */
     periph_init();
 }
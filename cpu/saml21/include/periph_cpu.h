@@ -26,6 +26,15 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Wake-up latency of the power modes in microseconds
+ *
+ * Waking up from BACKUP is a reset, so it is never entered while a timer is
+ * pending. The STANDBY value is a conservative estimate including the
+ * restart of the main clock.
+ */
+#define PM_WAKEUP_LATENCY_US    { UINT32_MAX, 100U, 0U }
+
 /**
  * @brief   Mapping of pins to EXTI lines, -1 means not EXTI possible
  */
@@ -34,6 +34,9 @@
 #include "stmclk.h"
 #include "periph_cpu.h"
 #include "periph/init.h"
+#ifdef MODULE_PERIPH_DMA
+#include "periph/dma.h"
+#endif
 
 #if defined (CPU_FAM_STM32L4)
 #define BIT_APB_PWREN       RCC_APB1ENR1_PWREN
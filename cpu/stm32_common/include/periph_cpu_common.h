@@ -74,6 +74,11 @@ extern "C" {
 #define PERIPH_SPI_NEEDS_TRANSFER_REGS
 /** @} */
 
+/**
+ * @brief   Use the DMA capable scatter-gather transfer of this platform
+ */
+#define PERIPH_SPI_HAS_TRANSFER_IOLIST
+
 /**
  * @brief   Number of usable low power modes
  */
@@ -245,38 +250,13 @@ typedef struct {
 } dma_conf_t;
 
 /**
- * @brief   DMA type
- */
-typedef unsigned dma_t;
-
-/**
- * @brief   DMA modes
- */
-typedef enum {
-    DMA_PERIPH_TO_MEM,     /**< Peripheral to memory */
-    DMA_MEM_TO_PERIPH,     /**< Memory to peripheral */
-    DMA_MEM_TO_MEM,        /**< Memory to memory */
-} dma_mode_t;
-
-/**
- * @name    DMA Increment modes
+ * @brief   Overwrite the default dma_t type definition
  * @{
  */
-#define DMA_INC_SRC_ADDR  (0x01)
-#define DMA_INC_DST_ADDR  (0x02)
-#define DMA_INC_BOTH_ADDR (DMA_INC_SRC_ADDR | DMA_INC_DST_ADDR)
+#define HAVE_DMA_T
+typedef unsigned dma_t;
 /** @} */
 
-/**
- * @name    DMA data width
- * @{
- */
-#define DMA_DATA_WIDTH_BYTE      (0x00)
-#define DMA_DATA_WIDTH_HALF_WORD (0x04)
-#define DMA_DATA_WIDTH_WORD      (0x08)
-#define DMA_DATA_WIDTH_MASK      (0x0C)
-#define DMA_DATA_WIDTH_SHIFT     (2)
-/** @} */
 #endif /* MODULE_PERIPH_DMA */
 
 /**
@@ -285,6 +265,10 @@ typedef enum {
 typedef struct {
     gpio_t pin;             /**< pin connected to the line */
     uint8_t chan;           /**< DAC device used for this line */
+#ifdef MODULE_PERIPH_DAC_STREAM
+    dma_t dma;              /**< Logical DMA stream used for streaming */
+    uint8_t dma_chan;       /**< DMA channel used for streaming */
+#endif
 } dac_conf_t;
 
 /**
@@ -296,6 +280,12 @@ typedef struct {
     uint32_t rcc_mask;      /**< corresponding bit in the RCC register */
     uint8_t bus;            /**< APBx bus the timer is clock from */
     uint8_t irqn;           /**< global IRQ channel */
+#ifdef MODULE_PERIPH_TIMER_CAPTURE
+    gpio_t cap_pin[TIMER_CHAN]; /**< input pins of the channels, or GPIO_UNDEF */
+#ifndef CPU_FAM_STM32F1
+    gpio_af_t cap_af;       /**< alternate function of the input pins */
+#endif
+#endif
 } timer_conf_t;
 
 /**
@@ -366,6 +356,10 @@ typedef struct {
     dma_t dma;              /**< Logical DMA stream used for TX */
     uint8_t dma_chan;       /**< DMA channel used for TX */
 #endif
+#ifdef MODULE_PERIPH_UART_DMA
+    dma_t rx_dma;           /**< Logical DMA stream used for RX */
+    uint8_t rx_dma_chan;    /**< DMA channel used for RX */
+#endif
 #ifdef MODULE_STM32_PERIPH_UART_HW_FC
     gpio_t cts_pin;         /**< CTS pin - set to GPIO_UNDEF when not using HW flow control */
     gpio_t rts_pin;         /**< RTS pin */
@@ -524,101 +518,6 @@ void gpio_init_analog(gpio_t pin);
  */
 #define DMA_STREAM_UNDEF (UINT_MAX)
 
-/**
- * @brief   Initialize DMA
- */
-void dma_init(void);
-
-/**
- * @brief   Execute a DMA transfer
- *
- * This function blocks until the transfer is completed. This is a convenience
- * function which configure, start, wait and stop a DMA transfer.
- *
- * @param[in]  dma     logical DMA stream
- * @param[in]  chan    DMA channel
- * @param[in]  src     source buffer
- * @param[out] dst     destination buffer
- * @param[in]  len     length to transfer
- * @param[in]  mode    DMA mode
- * @param[in]  flags   DMA configuration
- *
- * @return < 0 on error, the number of transfered bytes otherwise
- */
-int dma_transfer(dma_t dma, int chan, const void *src, void *dst, size_t len,
-                 dma_mode_t mode, uint8_t flags);
-
-/**
- * @brief   Acquire a DMA stream
- *
- * @param[in] dma     logical DMA stream
- */
-void dma_acquire(dma_t dma);
-
-/**
- * @brief   Release a DMA stream
- *
- * @param[in] dma     logical DMA stream
- */
-void dma_release(dma_t dma);
-
-/**
- * @brief   Start a DMA transfer on a stream
- *
- * Start a DMA transfer on a given stream. The stream must be configured first
- * by a @p dma_configure call.
- *
- * @param[in] dma     logical DMA stream
- */
-void dma_start(dma_t dma);
-
-/**
- * @brief   Suspend a DMA transfer on a stream
- *
- * @param[in] dma     logical DMA stream
- *
- * @return the remaining number of bytes to transfer
- */
-uint16_t dma_suspend(dma_t dma);
-
-/**
- * @brief   Resume a suspended DMA transfer on a stream
- *
- * @param[in] dma         logical DMA stream
- * @param[in] reamaining  the remaining number of bytes to transfer
- */
-void dma_resume(dma_t dma, uint16_t remaining);
-
-/**
- * @brief   Stop a DMA transfer on a stream
- *
- * @param[in] dma     logical DMA stream
- */
-void dma_stop(dma_t dma);
-
-/**
- * @brief   Wait for the end of a transfer
- *
- * @param[in] dma     logical DMA stream
- */
-void dma_wait(dma_t dma);
-
-/**
- * @brief   Configure a DMA stream for a new transfer
- *
- * @param[in]  dma     logical DMA stream
- * @param[in]  chan    DMA channel
- * @param[in]  src     source buffer
- * @param[out] dst     destination buffer
- * @param[in]  len     length to transfer
- * @param[in]  mode    DMA mode
- * @param[in]  flags   DMA configuration
- *
- * @return < 0 on error, 0 on success
- */
-int dma_configure(dma_t dma, int chan, const void *src, void *dst, size_t len,
-                  dma_mode_t mode, uint8_t flags);
-
 /**
  * @brief   Get DMA base register
  *
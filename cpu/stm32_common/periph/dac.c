@@ -24,6 +24,9 @@
 #include "cpu.h"
 #include "assert.h"
 #include "periph/dac.h"
+#ifdef MODULE_PERIPH_DAC_STREAM
+#include "periph/dma.h"
+#endif
 
 /* DAC channel enable bits */
 #ifdef DAC_CR_EN2
@@ -121,3 +124,108 @@ void dac_poweroff(dac_t line)
 #endif
     }
 }
+
+#ifdef MODULE_PERIPH_DAC_STREAM
+/* TIM6 triggers the conversions of all streaming lines (TSEL = 0) */
+#define STREAM_TIM          (TIM6)
+
+static struct {
+    dac_stream_cb_t cb;
+    void *arg;
+    uint16_t *buf;
+    size_t len;
+} _stream[DAC_NUMOF];
+
+static unsigned _streaming;
+
+static void _stream_cb(void *arg)
+{
+    dac_t line = (dac_t)(uintptr_t)arg;
+    size_t half = _stream[line].len / 2;
+
+    if (_stream[line].cb == NULL) {
+        return;
+    }
+    /* the counter is reloaded when the DMA wraps around, so a large count
+     * means it is playing the first half and the second one is free */
+    if (dma_remaining(dac_config[line].dma) > half) {
+        _stream[line].cb(_stream[line].arg, _stream[line].buf + half, half);
+    }
+    else {
+        _stream[line].cb(_stream[line].arg, _stream[line].buf, half);
+    }
+}
+
+int8_t dac_stream_start(dac_t line, uint16_t *buf, size_t len, uint32_t rate,
+                        dac_stream_cb_t cb, void *arg)
+{
+    assert(buf && ((len & 0x1) == 0));
+
+    if ((line >= DAC_NUMOF) || (dac_config[line].dma == DMA_STREAM_UNDEF)) {
+        return DAC_NOLINE;
+    }
+
+    uint32_t div = (rate) ? periph_timer_clk(APB1) / rate : 0;
+    uint32_t psc = (div - 1) >> 16;
+    if ((div == 0) || (psc > 0xffff)) {
+        return DAC_NORATE;
+    }
+
+    unsigned shift = 16 * (dac_config[line].chan & 0x01);
+#ifdef DAC_DHR12R2_DACC2DHR
+    volatile uint32_t *dhr = (shift) ? &dev(line)->DHR12L2
+                                     : &dev(line)->DHR12L1;
+#else
+    volatile uint32_t *dhr = &dev(line)->DHR12L1;
+#endif
+
+    _stream[line].cb = cb;
+    _stream[line].arg = arg;
+    _stream[line].buf = buf;
+    _stream[line].len = len;
+
+    /* the 12-bit left aligned register takes the 16-bit samples as they are */
+    dma_acquire(dac_config[line].dma);
+    dma_set_callback(dac_config[line].dma, _stream_cb, (void *)(uintptr_t)line);
+    dma_configure(dac_config[line].dma, dac_config[line].dma_chan, buf,
+                  (void *)dhr, len, DMA_MEM_TO_PERIPH,
+                  DMA_INC_SRC_ADDR | DMA_DATA_WIDTH_HALF_WORD | DMA_CIRCULAR);
+    dma_start(dac_config[line].dma);
+
+    dev(line)->CR |= ((DAC_CR_TEN1 | DAC_CR_DMAEN1) << shift);
+
+    /* TIM6 emits a trigger on each update event */
+    if (_streaming++ == 0) {
+        periph_clk_en(APB1, RCC_APB1ENR_TIM6EN);
+        STREAM_TIM->CR2 = TIM_CR2_MMS_1;
+    }
+    STREAM_TIM->CR1 = 0;
+    STREAM_TIM->PSC = psc;
+    STREAM_TIM->ARR = (div / (psc + 1)) - 1;
+    STREAM_TIM->EGR = TIM_EGR_UG;
+    STREAM_TIM->CR1 = TIM_CR1_CEN;
+
+    return DAC_OK;
+}
+
+void dac_stream_stop(dac_t line)
+{
+    assert(line < DAC_NUMOF);
+
+    unsigned shift = 16 * (dac_config[line].chan & 0x01);
+
+    if (!(dev(line)->CR & (DAC_CR_DMAEN1 << shift))) {
+        return;
+    }
+
+    dev(line)->CR &= ~((DAC_CR_TEN1 | DAC_CR_DMAEN1) << shift);
+    dma_stop(dac_config[line].dma);
+    dma_set_callback(dac_config[line].dma, NULL, NULL);
+    dma_release(dac_config[line].dma);
+
+    if (--_streaming == 0) {
+        STREAM_TIM->CR1 = 0;
+        periph_clk_dis(APB1, RCC_APB1ENR_TIM6EN);
+    }
+}
+#endif /* MODULE_PERIPH_DAC_STREAM */
@@ -20,10 +20,9 @@
 
 #include <stdint.h>
 
-#include "periph_cpu.h"
-#include "periph_conf.h"
 #include "mutex.h"
 #include "assert.h"
+#include "periph/dma.h"
 
 #if !(defined(CPU_FAM_STM32F2) || defined(CPU_FAM_STM32F4) || defined(CPU_FAM_STM32F7))
 #error "DMA is not supported for target CPU"
@@ -37,6 +36,8 @@ struct dma_ctx {
     mutex_t conf_lock;
     mutex_t sync_lock;
     uint16_t len;
+    dma_cb_t cb;
+    void *arg;
 };
 
 static struct dma_ctx dma_ctx[DMA_NUMOF];
@@ -153,6 +154,9 @@ int dma_configure(dma_t dma, int chan, const void *src, void *dst, size_t len,
                  (mode & 3) << DMA_SxCR_DIR_Pos;
     /* Enable interrupts */
     stream->CR |= DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+    if (flags & DMA_CIRCULAR) {
+        stream->CR |= DMA_SxCR_CIRC | DMA_SxCR_HTIE;
+    }
     /* Configure FIFO */
     stream->FCR = 0;
 
@@ -219,6 +223,21 @@ void dma_stop(dma_t dma)
     stream->CR &= ~(uint32_t)DMA_SxCR_EN;
 }
 
+void dma_set_callback(dma_t dma, dma_cb_t cb, void *arg)
+{
+    assert(dma < DMA_NUMOF);
+
+    dma_ctx[dma].arg = arg;
+    dma_ctx[dma].cb = cb;
+}
+
+uint16_t dma_remaining(dma_t dma)
+{
+    assert(dma < DMA_NUMOF);
+
+    return dma_stream(dma_config[dma].stream)->NDTR;
+}
+
 void dma_wait(dma_t dma)
 {
     assert(dma < DMA_NUMOF);
@@ -230,7 +249,12 @@ void dma_isr_handler(dma_t dma)
 {
     dma_clear_all_flags(dma);
 
-    mutex_unlock(&dma_ctx[dma].sync_lock);
+    if (dma_ctx[dma].cb) {
+        dma_ctx[dma].cb(dma_ctx[dma].arg);
+    }
+    else {
+        mutex_unlock(&dma_ctx[dma].sync_lock);
+    }
 
     cortexm_isr_end();
 }
@@ -29,6 +29,7 @@
 #include "cpu.h"
 #include "mutex.h"
 #include "assert.h"
+#include "periph/dma.h"
 #include "periph/spi.h"
 #include "pm_layered.h"
 
@@ -126,15 +127,16 @@ int spi_acquire(spi_t bus, spi_cs_t cs, spi_mode_t mode, spi_clk_t clk)
 #endif
     /* enable SPI device clock */
     periph_clk_en(spi_config[bus].apbbus, spi_config[bus].rccmask);
-    /* enable device */
+    /* enable device, configuring CR1 with a single write */
     uint8_t br = spi_divtable[spi_config[bus].apbbus][clk];
-    dev(bus)->CR1 = ((br << BR_SHIFT) | mode | SPI_CR1_MSTR);
+    uint32_t cr1 = ((br << BR_SHIFT) | mode | SPI_CR1_MSTR);
     if (cs != SPI_HWCS_MASK) {
-        dev(bus)->CR1 |= (SPI_CR1_SSM | SPI_CR1_SSI);
+        cr1 |= (SPI_CR1_SSM | SPI_CR1_SSI);
     }
     else {
         dev(bus)->CR2 |= (SPI_CR2_SSOE);
     }
+    dev(bus)->CR1 = cr1;
 
     return SPI_OK;
 }
@@ -201,6 +203,45 @@ static void _transfer_dma(spi_t bus, const void *out, void *in, size_t len)
 
     _wait_for_end(bus);
 }
+
+static void _transfer_dma_iolist(spi_t bus, const iolist_t *iolist)
+{
+    uint8_t tmp = 0;
+    dma_acquire(spi_config[bus].tx_dma);
+    dma_acquire(spi_config[bus].rx_dma);
+
+    dev(bus)->CR2 |= SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN;
+
+    /* keep the streams acquired for the whole list and only re-arm them for
+     * each element, the thread sleeps while the data is moved */
+    for (; iolist; iolist = iolist->iol_next) {
+        if (iolist->iol_len == 0) {
+            continue;
+        }
+        dma_configure(spi_config[bus].tx_dma, spi_config[bus].tx_dma_chan,
+                      iolist->iol_base, (void *)&(dev(bus)->DR),
+                      iolist->iol_len, DMA_MEM_TO_PERIPH, DMA_INC_SRC_ADDR);
+        dma_configure(spi_config[bus].rx_dma, spi_config[bus].rx_dma_chan,
+                      (void *)&(dev(bus)->DR), &tmp, iolist->iol_len,
+                      DMA_PERIPH_TO_MEM, 0);
+
+        dma_start(spi_config[bus].rx_dma);
+        dma_start(spi_config[bus].tx_dma);
+
+        dma_wait(spi_config[bus].rx_dma);
+        dma_wait(spi_config[bus].tx_dma);
+
+        dma_stop(spi_config[bus].tx_dma);
+        dma_stop(spi_config[bus].rx_dma);
+    }
+
+    dev(bus)->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+
+    dma_release(spi_config[bus].tx_dma);
+    dma_release(spi_config[bus].rx_dma);
+
+    _wait_for_end(bus);
+}
 #endif
 
 static void _transfer_no_dma(spi_t bus, const void *out, void *in, size_t len)
@@ -244,6 +285,24 @@ static void _transfer_no_dma(spi_t bus, const void *out, void *in, size_t len)
     _wait_for_end(bus);
 }
 
+static inline void _cs_select(spi_t bus, spi_cs_t cs)
+{
+    dev(bus)->CR1 |= (SPI_CR1_SPE);     /* this pulls the HW CS line low */
+    if ((cs != SPI_HWCS_MASK) && (cs != SPI_CS_UNDEF)) {
+        gpio_clear((gpio_t)cs);
+    }
+}
+
+static inline void _cs_release(spi_t bus, spi_cs_t cs, bool cont)
+{
+    if ((!cont) && (cs != SPI_CS_UNDEF)) {
+        dev(bus)->CR1 &= ~(SPI_CR1_SPE);    /* pull HW CS line high */
+        if (cs != SPI_HWCS_MASK) {
+            gpio_set((gpio_t)cs);
+        }
+    }
+}
+
 void spi_transfer_bytes(spi_t bus, spi_cs_t cs, bool cont,
                         const void *out, void *in, size_t len)
 {
@@ -251,10 +310,7 @@ void spi_transfer_bytes(spi_t bus, spi_cs_t cs, bool cont,
     assert(out || in);
 
     /* active the given chip select line */
-    dev(bus)->CR1 |= (SPI_CR1_SPE);     /* this pulls the HW CS line low */
-    if ((cs != SPI_HWCS_MASK) && (cs != SPI_CS_UNDEF)) {
-        gpio_clear((gpio_t)cs);
-    }
+    _cs_select(bus, cs);
 
 #ifdef MODULE_PERIPH_DMA
     if (spi_config[bus].tx_dma != DMA_STREAM_UNDEF
@@ -269,10 +325,31 @@ void spi_transfer_bytes(spi_t bus, spi_cs_t cs, bool cont,
 #endif
 
     /* release the chip select if not specified differently */
-    if ((!cont) && (cs != SPI_CS_UNDEF)) {
-        dev(bus)->CR1 &= ~(SPI_CR1_SPE);    /* pull HW CS line high */
-        if (cs != SPI_HWCS_MASK) {
-            gpio_set((gpio_t)cs);
+    _cs_release(bus, cs, cont);
+}
+
+void spi_transfer_iolist(spi_t bus, spi_cs_t cs, bool cont,
+                         const iolist_t *iolist)
+{
+    assert(iolist != NULL);
+
+    _cs_select(bus, cs);
+
+#ifdef MODULE_PERIPH_DMA
+    if (spi_config[bus].tx_dma != DMA_STREAM_UNDEF
+            && spi_config[bus].rx_dma != DMA_STREAM_UNDEF) {
+        _transfer_dma_iolist(bus, iolist);
+    }
+    else {
+#endif
+    for (; iolist; iolist = iolist->iol_next) {
+        if (iolist->iol_len > 0) {
+            _transfer_no_dma(bus, iolist->iol_base, NULL, iolist->iol_len);
         }
     }
+#ifdef MODULE_PERIPH_DMA
+    }
+#endif
+
+    _cs_release(bus, cs, cont);
 }
@@ -28,6 +28,17 @@
  */
 static timer_isr_ctx_t isr_ctx[TIMER_NUMOF];
 
+#ifdef MODULE_PERIPH_TIMER_CAPTURE
+/**
+ * @brief   Capture callback and capturing channels of each timer
+ */
+static struct {
+    timer_capture_cb_t cb;
+    void *arg;
+    uint8_t chans;
+} cap_ctx[TIMER_NUMOF];
+#endif
+
 /**
  * @brief   Get the timer device
  */
@@ -106,11 +117,74 @@ void timer_stop(tim_t tim)
     dev(tim)->CR1 &= ~(TIM_CR1_CEN);
 }
 
+#ifdef MODULE_PERIPH_TIMER_CAPTURE
+int timer_capture(tim_t tim, int channel, gpio_flank_t flank,
+                  timer_capture_cb_t cb, void *arg)
+{
+    if ((channel >= (int)TIMER_CHAN) ||
+        (timer_config[tim].cap_pin[channel] == GPIO_UNDEF)) {
+        return -1;
+    }
+
+    gpio_init(timer_config[tim].cap_pin[channel], GPIO_IN);
+#ifndef CPU_FAM_STM32F1
+    gpio_init_af(timer_config[tim].cap_pin[channel], timer_config[tim].cap_af);
+#endif
+
+    cap_ctx[tim].cb = cb;
+    cap_ctx[tim].arg = arg;
+    cap_ctx[tim].chans |= (1 << channel);
+
+    /* map the channel to its own input (CCxS = 01) */
+    volatile uint32_t *ccmr = (channel < 2) ? &dev(tim)->CCMR1
+                                            : &dev(tim)->CCMR2;
+    unsigned shift = 8 * (channel & 0x1);
+    *ccmr = (*ccmr & ~(0xffUL << shift)) | (TIM_CCMR1_CC1S_0 << shift);
+
+    /* select the edge(s) and enable capturing */
+    uint32_t ccer = TIM_CCER_CC1E;
+    if (flank == GPIO_FALLING) {
+        ccer |= TIM_CCER_CC1P;
+    }
+    else if (flank == GPIO_BOTH) {
+        ccer |= (TIM_CCER_CC1P | TIM_CCER_CC1NP);
+    }
+    dev(tim)->CCER = (dev(tim)->CCER & ~(0xfUL << (4 * channel))) |
+                     (ccer << (4 * channel));
+
+    dev(tim)->SR &= ~(TIM_SR_CC1IF << channel);
+    dev(tim)->DIER |= (TIM_DIER_CC1IE << channel);
+
+    return 0;
+}
+
+void timer_capture_stop(tim_t tim, int channel)
+{
+    if (channel >= (int)TIMER_CHAN) {
+        return;
+    }
+
+    dev(tim)->DIER &= ~(TIM_DIER_CC1IE << channel);
+    dev(tim)->CCER &= ~(0xfUL << (4 * channel));
+    volatile uint32_t *ccmr = (channel < 2) ? &dev(tim)->CCMR1
+                                            : &dev(tim)->CCMR2;
+    *ccmr &= ~(0xffUL << (8 * (channel & 0x1)));
+    cap_ctx[tim].chans &= ~(1 << channel);
+}
+#endif
+
 static inline void irq_handler(tim_t tim)
 {
     uint32_t status = (dev(tim)->SR & dev(tim)->DIER);
 
     for (unsigned int i = 0; i < TIMER_CHAN; i++) {
+#ifdef MODULE_PERIPH_TIMER_CAPTURE
+        if ((status & (TIM_SR_CC1IF << i)) && (cap_ctx[tim].chans & (1 << i))) {
+            /* reading the captured value clears the flag */
+            cap_ctx[tim].cb(cap_ctx[tim].arg, i, dev(tim)->CCR[i]);
+            continue;
+        }
+#endif
         if (status & (TIM_SR_CC1IF << i)) {
             dev(tim)->DIER &= ~(TIM_DIER_CC1IE << i);
             isr_ctx[tim].cb(isr_ctx[tim].arg, i);
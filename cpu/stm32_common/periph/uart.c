@@ -30,6 +30,7 @@
 #include "sched.h"
 #include "thread.h"
 #include "assert.h"
+#include "periph/dma.h"
 #include "periph/uart.h"
 #include "periph/gpio.h"
 #include "pm_layered.h"
@@ -41,6 +42,22 @@
  */
 static uart_isr_ctx_t isr_ctx[UART_NUMOF];
 
+#ifdef MODULE_PERIPH_UART_DMA
+/**
+ * @brief   State of the DMA driven mode
+ */
+typedef struct {
+    uart_rx_chunk_cb_t rx_cb;   /**< DMA receive callback */
+    uint8_t *rx_buf;            /**< circular DMA receive buffer */
+    uint16_t rx_len;            /**< size of rx_buf */
+    uint16_t rx_pos;            /**< position up to which data was passed on */
+    uart_tx_done_cb_t tx_cb;    /**< transmit complete callback */
+    void *tx_arg;               /**< argument to the transmit callback */
+} uart_dma_ctx_t;
+
+static uart_dma_ctx_t dma_ctx[UART_NUMOF];
+#endif
+
 static inline USART_TypeDef *dev(uart_t uart)
 {
     return uart_config[uart].dev;
@@ -53,7 +70,17 @@ static inline void uart_init_lpuart(uart_t uart, uint32_t baudrate);
 #endif
 #endif
 
-static inline void uart_init_pins(uart_t uart, uart_rx_cb_t rx_cb)
+static inline bool rx_enabled(uart_t uart)
+{
+#ifdef MODULE_PERIPH_UART_DMA
+    if (dma_ctx[uart].rx_cb) {
+        return true;
+    }
+#endif
+    return (isr_ctx[uart].rx_cb != NULL);
+}
+
+static inline void uart_init_pins(uart_t uart, bool rx)
 {
      /* configure TX pin */
     gpio_init(uart_config[uart].tx_pin, GPIO_OUT);
@@ -65,7 +92,7 @@ static inline void uart_init_pins(uart_t uart, uart_rx_cb_t rx_cb)
     gpio_init_af(uart_config[uart].tx_pin, uart_config[uart].tx_af);
 #endif
     /* configure RX pin */
-    if (rx_cb) {
+    if (rx) {
         gpio_init(uart_config[uart].rx_pin, GPIO_IN);
 #ifndef CPU_FAM_STM32F1
         gpio_init_af(uart_config[uart].rx_pin, uart_config[uart].rx_af);
@@ -85,15 +112,9 @@ static inline void uart_init_pins(uart_t uart, uart_rx_cb_t rx_cb)
 #endif
 }
 
-int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
+static int _init(uart_t uart, uint32_t baudrate)
 {
-    assert(uart < UART_NUMOF);
-
-    /* save ISR context */
-    isr_ctx[uart].rx_cb = rx_cb;
-    isr_ctx[uart].arg   = arg;
-
-    uart_init_pins(uart, rx_cb);
+    uart_init_pins(uart, rx_enabled(uart));
 
     /* enable the clock */
     uart_poweron(uart);
@@ -120,6 +141,32 @@ int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
     uart_init_usart(uart, baudrate);
 #endif
 
+#ifdef MODULE_STM32_PERIPH_UART_HW_FC
+    if (uart_config[uart].cts_pin != GPIO_UNDEF) {
+        /* configure hardware flow control */
+        dev(uart)->CR3 = (USART_CR3_RTSE | USART_CR3_CTSE);
+    }
+#endif
+
+    return UART_OK;
+}
+
+int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
+{
+    assert(uart < UART_NUMOF);
+
+    /* save ISR context */
+    isr_ctx[uart].rx_cb = rx_cb;
+    isr_ctx[uart].arg   = arg;
+#ifdef MODULE_PERIPH_UART_DMA
+    dma_ctx[uart].rx_cb = NULL;
+#endif
+
+    int res = _init(uart, baudrate);
+    if (res != UART_OK) {
+        return res;
+    }
+
     /* enable RX interrupt if applicable */
     if (rx_cb) {
         NVIC_EnableIRQ(uart_config[uart].irqn);
@@ -129,16 +176,147 @@ int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
         dev(uart)->CR1 = (USART_CR1_UE | USART_CR1_TE);
     }
 
-#ifdef MODULE_STM32_PERIPH_UART_HW_FC
-    if (uart_config[uart].cts_pin != GPIO_UNDEF) {
-        /* configure hardware flow control */
-        dev(uart)->CR3 = (USART_CR3_RTSE | USART_CR3_CTSE);
-    }
+    return UART_OK;
+}
+
+#ifdef MODULE_PERIPH_UART_DMA
+static inline volatile void *rx_data_reg(uart_t uart)
+{
+#if defined(CPU_FAM_STM32F7)
+    return &dev(uart)->RDR;
+#else
+    return &dev(uart)->DR;
+#endif
+}
+
+static inline volatile void *tx_data_reg(uart_t uart)
+{
+#if defined(CPU_FAM_STM32F7)
+    return &dev(uart)->TDR;
+#else
+    return &dev(uart)->DR;
 #endif
+}
+
+/* pass everything the DMA wrote since the last call on to the user */
+static void rx_dma_flush(uart_t uart)
+{
+    uart_dma_ctx_t *ctx = &dma_ctx[uart];
+    uint16_t pos = ctx->rx_len - dma_remaining(uart_config[uart].rx_dma);
+
+    if (pos == ctx->rx_len) {
+        pos = 0;
+    }
+    /* an unchanged position means no new data, a full lap of the DMA
+     * without us noticing is an overrun and can not be detected */
+    if (pos == ctx->rx_pos) {
+        return;
+    }
+    if (pos < ctx->rx_pos) {
+        ctx->rx_cb(isr_ctx[uart].arg, &ctx->rx_buf[ctx->rx_pos],
+                   ctx->rx_len - ctx->rx_pos);
+        ctx->rx_pos = 0;
+    }
+    if (pos > ctx->rx_pos) {
+        ctx->rx_cb(isr_ctx[uart].arg, &ctx->rx_buf[ctx->rx_pos],
+                   pos - ctx->rx_pos);
+    }
+    ctx->rx_pos = pos;
+}
+
+static void rx_dma_cb(void *arg)
+{
+    rx_dma_flush((uart_t)(uintptr_t)arg);
+}
+
+static void tx_dma_cb(void *arg)
+{
+    uart_t uart = (uart_t)(uintptr_t)arg;
+    dma_t dma = uart_config[uart].dma;
+
+    dma_stop(dma);
+    dma_set_callback(dma, NULL, NULL);
+    dev(uart)->CR3 &= ~USART_CR3_DMAT;
+    dma_release(dma);
+
+    if (dma_ctx[uart].tx_cb) {
+        dma_ctx[uart].tx_cb(dma_ctx[uart].tx_arg);
+    }
+}
+
+int uart_init_dma(uart_t uart, uint32_t baudrate, uint8_t *rx_buf,
+                  size_t rx_len, uart_rx_chunk_cb_t rx_cb, void *arg)
+{
+    assert(uart < UART_NUMOF);
+    assert(rx_buf && rx_cb && (rx_len > 0) && (rx_len <= UINT16_MAX));
+
+    dma_t dma = uart_config[uart].rx_dma;
+    if (dma == DMA_STREAM_UNDEF) {
+        return UART_NOMODE;
+    }
+
+    /* save ISR context */
+    isr_ctx[uart].rx_cb = NULL;
+    isr_ctx[uart].arg   = arg;
+    dma_ctx[uart].rx_cb = rx_cb;
+    dma_ctx[uart].rx_buf = rx_buf;
+    dma_ctx[uart].rx_len = rx_len;
+    dma_ctx[uart].rx_pos = 0;
+
+    int res = _init(uart, baudrate);
+    if (res != UART_OK) {
+        return res;
+    }
+
+    /* the RX stream stays acquired for as long as the device is in DMA mode */
+    dma_acquire(dma);
+    dma_set_callback(dma, rx_dma_cb, (void *)(uintptr_t)uart);
+    dma_configure(dma, uart_config[uart].rx_dma_chan, (void *)rx_data_reg(uart),
+                  rx_buf, rx_len, DMA_PERIPH_TO_MEM,
+                  DMA_INC_DST_ADDR | DMA_CIRCULAR);
+    dma_start(dma);
+
+    /* the DMA fetches the data, we only take an interrupt on idle line */
+    dev(uart)->CR3 |= USART_CR3_DMAR;
+    NVIC_EnableIRQ(uart_config[uart].irqn);
+    dev(uart)->CR1 = (USART_CR1_UE | USART_CR1_TE | USART_CR1_RE |
+                      USART_CR1_IDLEIE);
 
     return UART_OK;
 }
 
+int uart_write_async(uart_t uart, const uint8_t *data, size_t len,
+                     uart_tx_done_cb_t cb, void *arg)
+{
+    assert(uart < UART_NUMOF);
+    assert(!irq_is_in());
+
+    dma_t dma = uart_config[uart].dma;
+    if (dma == DMA_STREAM_UNDEF) {
+        return UART_NOMODE;
+    }
+    if (!len) {
+        if (cb) {
+            cb(arg);
+        }
+        return UART_OK;
+    }
+
+    /* released again by tx_dma_cb() once the transfer is done */
+    dma_acquire(dma);
+    dma_ctx[uart].tx_cb = cb;
+    dma_ctx[uart].tx_arg = arg;
+    dma_set_callback(dma, tx_dma_cb, (void *)(uintptr_t)uart);
+    dev(uart)->CR3 |= USART_CR3_DMAT;
+    dma_configure(dma, uart_config[uart].dma_chan, data,
+                  (void *)tx_data_reg(uart), len, DMA_MEM_TO_PERIPH,
+                  DMA_INC_SRC_ADDR);
+    dma_start(dma);
+
+    return UART_OK;
+}
+#endif /* MODULE_PERIPH_UART_DMA */
+
 static inline void uart_init_usart(uart_t uart, uint32_t baudrate)
 {
     uint16_t mantissa;
@@ -271,7 +449,7 @@ void uart_poweron(uart_t uart)
 {
     assert(uart < UART_NUMOF);
 #ifdef STM32_PM_STOP
-    if (isr_ctx[uart].rx_cb) {
+    if (rx_enabled(uart)) {
         pm_block(STM32_PM_STOP);
     }
 #endif
@@ -284,7 +462,7 @@ void uart_poweroff(uart_t uart)
 
     periph_clk_dis(uart_config[uart].bus, uart_config[uart].rcc_mask);
 #ifdef STM32_PM_STOP
-    if (isr_ctx[uart].rx_cb) {
+    if (rx_enabled(uart)) {
         pm_unblock(STM32_PM_STOP);
     }
 #endif
@@ -298,7 +476,13 @@ static inline void irq_handler(uart_t uart)
 
     uint32_t status = dev(uart)->ISR;
 
-    if (status & USART_ISR_RXNE) {
+#ifdef MODULE_PERIPH_UART_DMA
+    if (status & USART_ISR_IDLE) {
+        dev(uart)->ICR = USART_ICR_IDLECF;
+        rx_dma_flush(uart);
+    }
+#endif
+    if ((status & USART_ISR_RXNE) && isr_ctx[uart].rx_cb) {
         isr_ctx[uart].rx_cb(isr_ctx[uart].arg, (uint8_t)dev(uart)->RDR);
     }
     if (status & USART_ISR_ORE) {
@@ -309,7 +493,15 @@ static inline void irq_handler(uart_t uart)
 
     uint32_t status = dev(uart)->SR;
 
-    if (status & USART_SR_RXNE) {
+#ifdef MODULE_PERIPH_UART_DMA
+    if (status & USART_SR_IDLE) {
+        /* IDLE is cleared by reading SR and DR sequentially, the DMA has
+         * already fetched the last byte at this point */
+        dev(uart)->DR;
+        rx_dma_flush(uart);
+    }
+#endif
+    if ((status & USART_SR_RXNE) && isr_ctx[uart].rx_cb) {
         isr_ctx[uart].rx_cb(isr_ctx[uart].arg, (uint8_t)dev(uart)->DR);
     }
     if (status & USART_SR_ORE) {
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Decode the output of the log_binary module
+
+Reads a terminal log from a file or stdin, picks the `log:` lines, looks the
+format string of each record up in the ELF file of the application and prints
+the formatted message. Other lines are passed through unchanged.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+LINE = re.compile(r"log: ([0-9a-f]{8}) (\d+)((?: [0-9a-f]{8})*)")
+CONV = re.compile(r"%([-+ #0]*[0-9*]*(?:\.[0-9*]+)?)(hh|h|ll|l|q|j|z|t)?([a-zA-Z%])")
+
+LEVELS = ["NONE", "ERROR", "WARNING", "INFO", "DEBUG", "ALL"]
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+
+class Elf:
+    """Minimal reader for the allocated sections of a little endian ELF file"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[5] != 1:
+            raise ValueError("%s is not a little endian ELF file" % path)
+        if self.data[4] == 2:
+            shoff, = struct.unpack_from("<Q", self.data, 0x28)
+            shentsize, shnum = struct.unpack_from("<HH", self.data, 0x3a)
+            shdr = "<IIQQQQ"
+        else:
+            shoff, = struct.unpack_from("<I", self.data, 0x20)
+            shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2e)
+            shdr = "<IIIIII"
+        self.sections = []
+        for i in range(shnum):
+            _, stype, flags, addr, offset, size = struct.unpack_from(
+                shdr, self.data, shoff + i * shentsize)
+            if flags & SHF_ALLOC and stype != SHT_NOBITS:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        for start, offset, size in self.sections:
+            if start <= addr < start + size:
+                pos = offset + addr - start
+                end = self.data.index(b"\0", pos, offset + size)
+                return self.data[pos:end].decode("utf-8", "replace")
+        return None
+
+
+def _format(fmt, args):
+    args = list(args)
+
+    def conv(match):
+        flags, _, spec = match.groups()
+        if spec == "%":
+            return "%"
+        arg = args.pop(0) if args else 0
+        if spec in "di":
+            arg = arg - (1 << 32) if arg & 0x80000000 else arg
+        elif spec == "p":
+            return "0x%08x" % arg
+        elif spec == "s":
+            return "<str@0x%08x>" % arg
+        elif spec == "c":
+            return chr(arg & 0xff)
+        elif spec not in "uxXo":
+            return "<%%%s?>" % spec
+        return ("%" + flags + spec) % arg
+
+    return CONV.sub(conv, fmt)
+
+
+def decode(elf, lines):
+    for line in lines:
+        match = LINE.search(line)
+        if not match:
+            sys.stdout.write(line)
+            continue
+        fmt_id = int(match.group(1), 16)
+        level = int(match.group(2))
+        args = [int(val, 16) for val in match.group(3).split()]
+        fmt = elf.string(fmt_id)
+        name = LEVELS[level] if level < len(LEVELS) else str(level)
+        if fmt is None:
+            msg = "unknown format 0x%08x %s\n" % (fmt_id, args)
+        else:
+            msg = _format(fmt, args)
+        sys.stdout.write("[%s] %s" % (name, msg))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin, help="terminal log (default stdin)")
+    args = parser.parse_args()
+    decode(Elf(args.elf), args.log)
+
+
+if __name__ == "__main__":
+    main()
@@ -13,6 +13,8 @@
  */
 
 #include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -37,3 +39,26 @@ int to_file(const char *filename, void *buf, size_t len)
         return fd;
     }
 }
+
+void *from_file(const char *filename, size_t *len)
+{
+    FILE *f = fopen(filename, "rb");
+    void *buf = NULL;
+    long size;
+
+    if (f == NULL) {
+        return NULL;
+    }
+    if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 &&
+        fseek(f, 0, SEEK_SET) == 0) {
+        /* allocate at least one byte, so that empty files work as well */
+        buf = malloc(size + 1);
+        if (buf && fread(buf, 1, size, f) != (size_t)size) {
+            free(buf);
+            buf = NULL;
+        }
+        *len = size;
+    }
+    fclose(f);
+    return buf;
+}
@@ -24,6 +24,16 @@
  */
 int to_file(const char *filename, void *buf, size_t len);
 
+/**
+ * @brief  Read a whole file into a newly allocated buffer
+ *
+ * @param[in]  filename    name of the file to be read
+ * @param[out] len         the number of bytes read
+ *
+ * @returns buffer to be freed by the caller, NULL on error
+ */
+void *from_file(const char *filename, size_t *len);
+
 #ifdef __cplusplus
 } /* end extern "C" */
 #endif
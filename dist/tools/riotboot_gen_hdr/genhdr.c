@@ -20,6 +20,7 @@
 #include <stdlib.h>
 
 #include "riotboot/hdr.h"
+#include "riotboot/verify.h"
 #include "common.h"
 
 /**
@@ -41,6 +42,14 @@ static void populate_hdr(riotboot_hdr_t *hdr, uint32_t ver, uint32_t addr)
     hdr->chksum = riotboot_hdr_checksum(hdr);
 }
 
+static void populate_digest(riotboot_digest_t *digest, const void *img,
+                            size_t img_len)
+{
+    digest->magic_number = RIOTBOOT_DIGEST_MAGIC;
+    digest->img_len = img_len;
+    sha256(img, img_len, digest->sha256);
+}
+
 int genhdr(int argc, char *argv[])
 {
     const char generate_usage[] = "<IMG_BIN> <APP_VER> <START_ADDR> <HDR_LEN> <outfile|->";
@@ -48,6 +57,10 @@ int genhdr(int argc, char *argv[])
     /* riotboot_hdr buffer */
     uint8_t *hdr_buf;
 
+    /* image to compute the digest of */
+    void *img_buf;
+    size_t img_len;
+
     /* arguments storage variables */
     long app_ver_arg = 0;
     long start_addr_arg = 0;
@@ -92,14 +105,29 @@ int genhdr(int argc, char *argv[])
         hdr_len = hdr_len_arg;
     }
 
+    if (hdr_len < sizeof(riotboot_hdr_t) + sizeof(riotboot_digest_t)) {
+        fprintf(stderr, "Error: HDR_LEN too small!\n");
+        return -1;
+    }
+
+    img_buf = from_file(argv[1], &img_len);
+    if (img_buf == NULL) {
+        fprintf(stderr, "Error: cannot read IMG_BIN!\n");
+        return -1;
+    }
+
     /* prepare a 0 initialised buffer for riotboot_hdr_t */
     hdr_buf = calloc(1, hdr_len);
     if (hdr_buf == NULL) {
         fprintf(stderr, "Error: not enough memory!\n");
+        free(img_buf);
         return -1;
     }
 
     populate_hdr((riotboot_hdr_t*)hdr_buf, app_ver, start_addr);
+    populate_digest((riotboot_digest_t*)(hdr_buf + sizeof(riotboot_hdr_t)),
+                    img_buf, img_len);
+    free(img_buf);
 
     /* Write the header */
     if (!to_file(argv[5], hdr_buf, hdr_len)) {
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Decode the output of the tracebuf shell command / tracebuf_dump()
+
+Reads a terminal log from a file or stdin, picks the `tracebuf:` lines and
+prints one event per line with the time relative to the first event and to
+the previous event.
+"""
+
+import argparse
+import re
+import sys
+
+LINE = re.compile(r"tracebuf: ([0-9a-f]{8}) ([0-9a-f]{8}) ([0-9a-f]{8})")
+
+USER = 0x100
+
+
+def _pid_type(arg):
+    return "pid %d type 0x%04x" % (arg >> 16, arg & 0xffff)
+
+
+EVENTS = {
+    1: ("sched_switch", lambda arg: "pid %d" % arg),
+    2: ("msg_send", _pid_type),
+    3: ("msg_recv", _pid_type),
+    4: ("isr_end", lambda arg: "exception %d" % arg),
+    5: ("netapi_dispatch",
+        lambda arg: "nettype %d cmd 0x%04x" % (arg >> 16, arg & 0xffff)),
+    6: ("pktbuf_alloc", lambda arg: "0x%08x" % arg),
+    7: ("pktbuf_free", lambda arg: "0x%08x" % arg),
+}
+
+
+def decode(lines, tick_us):
+    first = None
+    last = None
+    for line in lines:
+        match = LINE.search(line)
+        if not match:
+            continue
+        time, evt, arg = (int(val, 16) for val in match.groups())
+        if first is None:
+            first = last = time
+        # timestamps are 32 bit xtimer ticks and may wrap around
+        rel = ((time - first) & 0xffffffff) * tick_us
+        delta = ((time - last) & 0xffffffff) * tick_us
+        last = time
+        if evt in EVENTS:
+            name, fmt = EVENTS[evt]
+            desc = fmt(arg)
+        elif evt >= USER:
+            name = "user+%d" % (evt - USER)
+            desc = "0x%08x" % arg
+        else:
+            name = "unknown(%d)" % evt
+            desc = "0x%08x" % arg
+        print("%12.1f %+10.1f  %-16s %s" % (rel, delta, name, desc))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin, help="terminal log (default stdin)")
+    parser.add_argument("--tick-us", type=float, default=1.0,
+                        help="duration of one xtimer tick in microseconds")
+    args = parser.parse_args()
+    decode(args.log, args.tick_us)
+
+
+if __name__ == "__main__":
+    main()
@@ -21,6 +21,7 @@
 #include <string.h>
 
 #include "assert.h"
+#include "byteorder.h"
 #include "apa102.h"
 
 #define START           (0x00000000)
@@ -36,6 +37,49 @@
 #define GREEN_SHIFT     (8U)
 
 
+static inline uint32_t frame(const color_rgba_t *val)
+{
+    uint32_t data = HEAD;
+    /* we scale the 8-bit alpha value to a 5-bit value by cutting off the
+     * 3 leas significant bits */
+    data |= (((uint32_t)val->alpha << BRIGHT_SHIFT) & BRIGHT);
+    data |= ((uint32_t)val->color.b << BLUE_SHIFT);
+    data |= ((uint32_t)val->color.g << GREEN_SHIFT);
+    data |= val->color.r;
+    return data;
+}
+
+#ifdef MODULE_APA102_SPI
+void apa102_init(apa102_t *dev, const apa102_params_t *params)
+{
+    assert(dev && params && params->buf);
+
+    memcpy(dev, params, sizeof(apa102_params_t));
+}
+
+void apa102_load_rgba(const apa102_t *dev, const color_rgba_t vals[])
+{
+    static const uint32_t start = START;
+    static const uint32_t end = END;
+
+    assert(dev && vals);
+
+    /* prepare the whole strip, so it is sent in one transfer */
+    for (int i = 0; i < dev->led_numof; i++) {
+        dev->buf[i] = htonl(frame(&vals[i]));
+    }
+
+    iolist_t iol_end = { .iol_base = (void *)&end, .iol_len = sizeof(end) };
+    iolist_t iol_leds = { .iol_next = &iol_end, .iol_base = dev->buf,
+                          .iol_len = dev->led_numof * sizeof(uint32_t) };
+    iolist_t iol_start = { .iol_next = &iol_leds, .iol_base = (void *)&start,
+                           .iol_len = sizeof(start) };
+
+    spi_acquire(dev->spi, SPI_CS_UNDEF, SPI_MODE_0, dev->spi_clk);
+    spi_transfer_iolist(dev->spi, SPI_CS_UNDEF, false, &iol_start);
+    spi_release(dev->spi);
+}
+#else
 static inline void shift(const apa102_t *dev, uint32_t data)
 {
     for (int i = 31; i >= 0; i--) {
@@ -63,14 +107,8 @@ void apa102_load_rgba(const apa102_t *dev, const color_rgba_t vals[])
 
     shift(dev, START);
     for (int i = 0; i < dev->led_numof; i++) {
-        uint32_t data = HEAD;
-        /* we scale the 8-bit alpha value to a 5-bit value by cutting off the
-         * 3 leas significant bits */
-        data |= (((uint32_t)vals[i].alpha << BRIGHT_SHIFT) & BRIGHT);
-        data |= ((uint32_t)vals[i].color.b << BLUE_SHIFT);
-        data |= ((uint32_t)vals[i].color.g << GREEN_SHIFT);
-        data |= vals[i].color.r;
-        shift(dev, data);
+        shift(dev, frame(&vals[i]));
     }
     shift(dev, END);
 }
+#endif
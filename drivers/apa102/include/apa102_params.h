@@ -32,6 +32,12 @@ extern "C" {
 #ifndef APA102_PARAM_LED_NUMOF
 #define APA102_PARAM_LED_NUMOF      (64)    /* many have 64 per meter... */
 #endif
+#ifndef APA102_PARAM_SPI
+#define APA102_PARAM_SPI            (SPI_DEV(0))
+#endif
+#ifndef APA102_PARAM_SPI_CLK
+#define APA102_PARAM_SPI_CLK        (SPI_CLK_5MHZ)
+#endif
 #ifndef APA102_PARAM_DATA_PIN
 #define APA102_PARAM_DATA_PIN       (GPIO_PIN(0, 0))
 #endif
@@ -40,12 +46,29 @@ extern "C" {
 #endif
 
 #ifndef APA102_PARAMS
+#ifdef MODULE_APA102_SPI
+#define APA102_PARAMS               { .led_numof = APA102_PARAM_LED_NUMOF, \
+                                      .spi       = APA102_PARAM_SPI, \
+                                      .spi_clk   = APA102_PARAM_SPI_CLK, \
+                                      .buf       = apa102_buf }
+#else
 #define APA102_PARAMS               { .led_numof = APA102_PARAM_LED_NUMOF, \
                                       .data_pin  = APA102_PARAM_DATA_PIN, \
                                       .clk_pin   = APA102_PARAM_CLK_PIN }
 #endif
+#endif
 /**@}*/
 
+#if defined(MODULE_APA102_SPI) && !defined(APA102_PARAMS_BUF_EXTERN)
+/**
+ * @brief   Frame buffer for the default configuration
+ *
+ * Define `APA102_PARAMS_BUF_EXTERN` when overriding @ref APA102_PARAMS with
+ * buffers allocated by the application.
+ */
+static uint32_t apa102_buf[APA102_PARAM_LED_NUMOF];
+#endif
+
 /**
  * @brief   APA102 configuration
  */
@@ -80,6 +80,17 @@ void at86rf2xx_sram_write(const at86rf2xx_t *dev, uint8_t offset,
     spi_release(SPIDEV);
 }
 
+void at86rf2xx_fb_write_iolist(const at86rf2xx_t *dev, uint8_t phr,
+                               const iolist_t *iolist)
+{
+    uint8_t hdr[2] = { (AT86RF2XX_ACCESS_FB | AT86RF2XX_ACCESS_WRITE), phr };
+
+    getbus(dev);
+    spi_transfer_bytes(SPIDEV, CSPIN, true, hdr, NULL, sizeof(hdr));
+    spi_transfer_iolist(SPIDEV, CSPIN, false, iolist);
+    spi_release(SPIDEV);
+}
+
 void at86rf2xx_fb_start(const at86rf2xx_t *dev)
 {
     uint8_t reg = AT86RF2XX_ACCESS_FB | AT86RF2XX_ACCESS_READ;
@@ -100,21 +100,24 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     at86rf2xx_t *dev = (at86rf2xx_t *)netdev;
     size_t len = 0;
 
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        len += iol->iol_len;
+    }
+    /* packet data + FCS too long */
+    if ((len + IEEE802154_FCS_LEN) > AT86RF2XX_MAX_PKT_LENGTH) {
+        DEBUG("[at86rf2xx] error: packet too large (%u byte) to be send\n",
+              (unsigned)len + IEEE802154_FCS_LEN);
+        return -EOVERFLOW;
+    }
+
     at86rf2xx_tx_prepare(dev);
 
-    /* load packet data into FIFO */
-    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
-        /* current packet data + FCS too long */
-        if ((len + iol->iol_len + 2) > AT86RF2XX_MAX_PKT_LENGTH) {
-            DEBUG("[at86rf2xx] error: packet too large (%u byte) to be send\n",
-                  (unsigned)len + 2);
-            return -EOVERFLOW;
-        }
+    /* load the whole frame into the frame buffer in one SPI transaction */
+    dev->tx_frame_len += (uint8_t)len;
+    at86rf2xx_fb_write_iolist(dev, dev->tx_frame_len, iolist);
 #ifdef MODULE_NETSTATS_L2
-        netdev->stats.tx_bytes += len;
+    netdev->stats.tx_bytes += len;
 #endif
-        len = at86rf2xx_tx_load(dev, iol->iol_base, iol->iol_len, len);
-    }
 
     /* send data out directly if pre-loading id disabled */
     if (!(dev->flags & AT86RF2XX_OPT_PRELOADING)) {
@@ -349,6 +352,12 @@ static int _get(netdev_t *netdev, netopt_t opt, void *val, size_t max_len)
                 !!(dev->flags & AT86RF2XX_OPT_CSMA);
             return sizeof(netopt_enable_t);
 
+        case NETOPT_RX_PREALLOC:
+            assert(max_len >= sizeof(uint16_t));
+            /* FCS is not copied into the buffer */
+            *((uint16_t *)val) = IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN;
+            return sizeof(uint16_t);
+
 /* Only radios with the XAH_CTRL_2 register support frame retry reporting */
 #if AT86RF2XX_HAVE_RETRIES
         case NETOPT_TX_RETRIES_NEEDED:
@@ -396,6 +405,18 @@ static int _get(netdev_t *netdev, netopt_t opt, void *val, size_t max_len)
             res = sizeof(uint8_t);
             break;
 
+        case NETOPT_CSMA_MINBE:
+            assert(max_len >= sizeof(uint8_t));
+            *((uint8_t *)val) = at86rf2xx_reg_read(dev, AT86RF2XX_REG__CSMA_BE) & 0x0f;
+            res = sizeof(uint8_t);
+            break;
+
+        case NETOPT_CSMA_MAXBE:
+            assert(max_len >= sizeof(uint8_t));
+            *((uint8_t *)val) = at86rf2xx_reg_read(dev, AT86RF2XX_REG__CSMA_BE) >> 4;
+            res = sizeof(uint8_t);
+            break;
+
         case NETOPT_CCA_THRESHOLD:
             assert(max_len >= sizeof(int8_t));
             *((int8_t *)val) = at86rf2xx_get_cca_threshold(dev);
@@ -589,6 +610,24 @@ static int _set(netdev_t *netdev, netopt_t opt, const void *val, size_t len)
             }
             break;
 
+        case NETOPT_CSMA_MINBE: {
+            assert(len <= sizeof(uint8_t));
+            uint8_t max_be = at86rf2xx_reg_read(dev, AT86RF2XX_REG__CSMA_BE) >> 4;
+
+            at86rf2xx_set_csma_backoff_exp(dev, *((const uint8_t *)val), max_be);
+            res = sizeof(uint8_t);
+            break;
+        }
+
+        case NETOPT_CSMA_MAXBE: {
+            assert(len <= sizeof(uint8_t));
+            uint8_t min_be = at86rf2xx_reg_read(dev, AT86RF2XX_REG__CSMA_BE) & 0x0f;
+
+            at86rf2xx_set_csma_backoff_exp(dev, min_be, *((const uint8_t *)val));
+            res = sizeof(uint8_t);
+            break;
+        }
+
         case NETOPT_CCA_THRESHOLD:
             assert(len <= sizeof(int8_t));
             at86rf2xx_set_cca_threshold(dev, *((const int8_t *)val));
@@ -26,6 +26,8 @@
 
 #include <stdint.h>
 
+#include "iolist.h"
+
 #include "at86rf2xx.h"
 
 
@@ -114,6 +116,18 @@ void at86rf2xx_sram_read(const at86rf2xx_t *dev, uint8_t offset,
 void at86rf2xx_sram_write(const at86rf2xx_t *dev, uint8_t offset,
                           const uint8_t *data, size_t len);
 
+/**
+ * @brief   Write a complete frame into the frame buffer of the given device
+ *
+ * The PHR and all elements of @p iolist are written in one SPI transaction.
+ *
+ * @param[in] dev       device to write to
+ * @param[in] phr       PHY header, i.e. length of the frame including FCS
+ * @param[in] iolist    frame to write
+ */
+void at86rf2xx_fb_write_iolist(const at86rf2xx_t *dev, uint8_t phr,
+                               const iolist_t *iolist);
+
 /**
  * @brief   Start a read transcation internal frame buffer of the given device
  *
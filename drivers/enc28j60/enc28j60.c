@@ -212,12 +212,16 @@ static void cmd_rbm(enc28j60_t *dev, uint8_t *data, size_t len)
     spi_release(dev->spi);
 }
 
-static void cmd_wbm(enc28j60_t *dev, uint8_t *data, size_t len)
+static void cmd_wbm_iolist(enc28j60_t *dev, uint8_t ctrl,
+                           const iolist_t *iolist)
 {
+    uint8_t hdr[2] = { CMD_WBM, ctrl };
+
     /* start transaction */
     spi_acquire(dev->spi, dev->cs_pin, SPI_MODE_0, SPI_CLK);
-    /* transfer data */
-    spi_transfer_regs(dev->spi, dev->cs_pin, CMD_WBM, data, NULL, len);
+    /* transfer control byte and the complete frame in one burst */
+    spi_transfer_bytes(dev->spi, dev->cs_pin, true, hdr, NULL, sizeof(hdr));
+    spi_transfer_iolist(dev->spi, dev->cs_pin, false, iolist);
     /* finish SPI transaction */
     spi_release(dev->spi);
 }
@@ -242,6 +246,45 @@ static void mac_set(enc28j60_t *dev, uint8_t *mac)
     cmd_wcr(dev, REG_B3_MAADR1, 3, mac[5]);
 }
 
+#ifdef MODULE_L2FILTER
+static void l2filter_apply(enc28j60_t *dev)
+{
+    const l2filter_t *entry = l2filter_whitelist_single(dev->netdev.filter,
+                                                        ETHERNET_ADDR_LEN);
+    uint32_t sum = 0;
+
+    if (entry == NULL) {
+        /* accept everything, the list is applied in software only */
+        cmd_wcr(dev, REG_B1_ERXFCON, 1, 0);
+        return;
+    }
+    /* the pattern match checksum is the IP checksum over the selected bytes,
+     * here the source address taken as three 16-bit words */
+    for (unsigned i = 0; i < ETHERNET_ADDR_LEN; i += 2) {
+        sum += ((uint16_t)entry->addr[i] << 8) | entry->addr[i + 1];
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    sum = ~sum & 0xffff;
+
+    /* the window starts at the destination address, so the source address
+     * is selected by bytes 6 to 11 of the mask */
+    cmd_wcr(dev, REG_B1_EPMOL, 1, 0);
+    cmd_wcr(dev, REG_B1_EPMOH, 1, 0);
+    cmd_wcr(dev, REG_B1_EPMM0, 1, 0xc0);
+    cmd_wcr(dev, REG_B1_EPMM1, 1, 0x0f);
+    for (uint8_t reg = REG_B1_EPMM2; reg <= REG_B1_EPMM7; reg++) {
+        cmd_wcr(dev, reg, 1, 0);
+    }
+    cmd_wcr(dev, REG_B1_EPMCSL, 1, (uint8_t)sum);
+    cmd_wcr(dev, REG_B1_EPMCSH, 1, (uint8_t)(sum >> 8));
+    /* AND mode: only frames matching the pattern are accepted. Other sources
+     * with the same checksum still pass and are caught by l2filter_pass() */
+    cmd_wcr(dev, REG_B1_ERXFCON, 1, ERXFCON_ANDOR | ERXFCON_CRCEN | ERXFCON_PMEN);
+}
+#endif
+
 static void on_int(void *arg)
 {
     netdev_t *netdev = (netdev_t *)arg;
@@ -281,11 +324,10 @@ static int nd_send(netdev_t *netdev, const iolist_t *iolist)
     /* set write pointer */
     cmd_w_addr(dev, ADDR_WRITE_PTR, BUF_TX_START);
     /* write control byte and the actual data into the buffer */
-    cmd_wbm(dev, &ctrl, 1);
     for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
         c += iol->iol_len;
-        cmd_wbm(dev, iol->iol_base, iol->iol_len);
     }
+    cmd_wbm_iolist(dev, ctrl, iolist);
     /* set TX end pointer */
     cmd_w_addr(dev, ADDR_TX_END, cmd_r_addr(dev, ADDR_WRITE_PTR) - 1);
     /* trigger the send process */
@@ -304,12 +346,11 @@ static int nd_send(netdev_t *netdev, const iolist_t *iolist)
 /*
  * Section 14 of errata sheet: Even values in ERXRDPT may corrupt receive
  * buffer as well as the next packet pointer. ERXRDPT need to be set always
- * at odd addresses. Following macros determine odd ERXRDPT from next packet
- * pointer and vise versa. Next packet pointer is always at even address
- * because of hardware padding.
+ * at odd addresses. Following macro determines odd ERXRDPT from next packet
+ * pointer. Next packet pointer is always at even address because of hardware
+ * padding.
  */
 #define NEXT_TO_ERXRDPT(n) ((n == BUF_RX_START || n - 1 > BUF_RX_END) ? BUF_RX_END : n - 1)
-#define ERXRDPT_TO_NEXT(e) ((e >= BUF_RX_END) ? BUF_RX_START : e + 1)
 
 static int nd_recv(netdev_t *netdev, void *buf, size_t max_len, void *info)
 {
@@ -321,9 +362,9 @@ static int nd_recv(netdev_t *netdev, void *buf, size_t max_len, void *info)
     (void)info;
     mutex_lock(&dev->devlock);
 
-    /* set read pointer to RX read address */
-    uint16_t rx_rd_ptr = cmd_r_addr(dev, ADDR_RX_READ);
-    cmd_w_addr(dev, ADDR_READ_PTR, ERXRDPT_TO_NEXT(rx_rd_ptr));
+    /* set read pointer to the next packet, tracked by software to save
+     * reading back ERXRDPT for every frame */
+    cmd_w_addr(dev, ADDR_READ_PTR, dev->rx_next);
     /* read packet header */
     cmd_rbm(dev, head, 6);
     /* TODO: care for endianess */
@@ -343,6 +384,7 @@ static int nd_recv(netdev_t *netdev, void *buf, size_t max_len, void *info)
             size = 0;
         }
         /* release memory */
+        dev->rx_next = next;
         cmd_w_addr(dev, ADDR_RX_READ, NEXT_TO_ERXRDPT(next));
         cmd_bfs(dev, REG_ECON2, -1, ECON2_PKTDEC);
     }
@@ -392,6 +434,7 @@ static int nd_init(netdev_t *netdev)
     cmd_w_addr(dev, ADDR_RX_START, BUF_RX_START);
     cmd_w_addr(dev, ADDR_RX_END, BUF_RX_END);
     cmd_w_addr(dev, ADDR_RX_READ, NEXT_TO_ERXRDPT(BUF_RX_START));
+    dev->rx_next = BUF_RX_START;
     /* configure the TX buffer */
     cmd_w_addr(dev, ADDR_TX_START, BUF_TX_START);
     cmd_w_addr(dev, ADDR_TX_END, BUF_TX_END);
@@ -466,10 +509,17 @@ static void nd_isr(netdev_t *netdev)
             }
         }
         if (eir & EIR_PKTIF) {
-            do {
-                DEBUG("[enc28j60] isr: packet received\n");
-                netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-            } while (cmd_rcr(dev, REG_B1_EPKTCNT, 1) > 0);
+            /* drain the RX buffer: read the packet count once per burst, so
+             * all frames are read without switching register banks */
+            uint8_t cnt = cmd_rcr(dev, REG_B1_EPKTCNT, 1);
+
+            while (cnt > 0) {
+                do {
+                    DEBUG("[enc28j60] isr: packet received\n");
+                    netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+                } while (--cnt > 0);
+                cnt = cmd_rcr(dev, REG_B1_EPKTCNT, 1);
+            }
         }
         if (eir & EIR_RXERIF) {
             DEBUG("[enc28j60] isr: incoming packet dropped - RX buffer full\n");
@@ -505,6 +555,22 @@ static int nd_get(netdev_t *netdev, netopt_t opt, void *value, size_t max_len)
                 *((netopt_enable_t *)value) = NETOPT_DISABLE;
             }
             return sizeof(netopt_enable_t);
+        case NETOPT_RX_PREALLOC:
+            assert(max_len >= sizeof(uint16_t));
+            /* CRC is discarded by nd_recv() */
+            *((uint16_t *)value) = ETHERNET_FRAME_LEN;
+            return sizeof(uint16_t);
+#ifdef MODULE_L2FILTER
+        case NETOPT_L2FILTER_HW:
+            assert(max_len >= sizeof(netopt_enable_t));
+            if (cmd_rcr(dev, REG_B1_ERXFCON, 1) & ERXFCON_PMEN) {
+                *((netopt_enable_t *)value) = NETOPT_ENABLE;
+            }
+            else {
+                *((netopt_enable_t *)value) = NETOPT_DISABLE;
+            }
+            return sizeof(netopt_enable_t);
+#endif
         default:
             return netdev_eth_get(netdev, opt, value, max_len);
     }
@@ -519,6 +585,17 @@ static int nd_set(netdev_t *netdev, netopt_t opt, const void *value, size_t valu
             assert(value_len == ETHERNET_ADDR_LEN);
             mac_set(dev, (uint8_t *)value);
             return ETHERNET_ADDR_LEN;
+#ifdef MODULE_L2FILTER
+        case NETOPT_L2FILTER:
+        case NETOPT_L2FILTER_RM: {
+            int res = netdev_eth_set(netdev, opt, value, value_len);
+
+            if (res >= 0) {
+                l2filter_apply(dev);
+            }
+            return res;
+        }
+#endif
         default:
             return netdev_eth_set(netdev, opt, value, value_len);
     }
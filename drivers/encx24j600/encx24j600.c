@@ -131,10 +131,16 @@ static void _isr(netdev_t *netdev)
 
     /* check & handle available packets */
     if (eir & ENC_PKTIF) {
-        while (_packets_available(dev)) {
+        /* drain the RX buffer, reading the packet count once per burst */
+        int cnt = _packets_available(dev);
+
+        while (cnt > 0) {
             unlock(dev);
-            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+            do {
+                netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+            } while (--cnt > 0);
             lock(dev);
+            cnt = _packets_available(dev);
         }
     }
 
@@ -409,6 +415,11 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
                 *((netopt_enable_t *)value) = NETOPT_DISABLE;
             }
             return sizeof(netopt_enable_t);
+        case NETOPT_RX_PREALLOC:
+            assert(max_len >= sizeof(uint16_t));
+            /* checksum is discarded by _recv() */
+            *((uint16_t *)value) = ETHERNET_FRAME_LEN;
+            return sizeof(uint16_t);
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
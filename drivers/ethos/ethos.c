@@ -24,6 +24,7 @@
 
 #include "random.h"
 #include "ethos.h"
+#include "memscan.h"
 #include "periph/uart.h"
 #include "tsrb.h"
 #include "irq.h"
@@ -44,6 +45,9 @@ extern isrpipe_t stdio_uart_isrpipe;
 
 static void _get_mac_addr(netdev_t *dev, uint8_t* buf);
 static void ethos_isr(void *arg, uint8_t c);
+#ifdef MODULE_PERIPH_UART_DMA
+static void ethos_isr_chunk(void *arg, const uint8_t *data, size_t len);
+#endif
 static const netdev_driver_t netdev_driver_ethos;
 
 static const uint8_t _esc_esc[] = {ETHOS_ESC_CHAR, (ETHOS_ESC_CHAR ^ 0x20)};
@@ -71,7 +75,15 @@ void ethos_setup(ethos_t *dev, const ethos_params_t *params)
     dev->mac_addr[0] &= (0x2);      /* unset globally unique bit */
     dev->mac_addr[0] &= ~(0x1);     /* set unicast bit*/
 
-    uart_init(params->uart, params->baudrate, ethos_isr, (void*)dev);
+    int res = UART_NOMODE;
+#ifdef MODULE_PERIPH_UART_DMA
+    res = uart_init_dma(params->uart, params->baudrate, dev->rxdma,
+                        sizeof(dev->rxdma), ethos_isr_chunk, dev);
+#endif
+    if (res == UART_NOMODE) {
+        /* no RX DMA for this device, take an interrupt per byte */
+        uart_init(params->uart, params->baudrate, ethos_isr, (void*)dev);
+    }
 
     uint8_t frame_delim = ETHOS_FRAME_DELIMITER;
     uart_write(dev->uart, &frame_delim, 1);
@@ -185,6 +197,49 @@ static void ethos_isr(void *arg, uint8_t c)
     }
 }
 
+#ifdef MODULE_PERIPH_UART_DMA
+/* stores a run of unescaped bytes of the current frame at once */
+static void _handle_run(ethos_t *dev, const uint8_t *data, size_t len)
+{
+    switch (dev->frametype) {
+        case ETHOS_FRAME_TYPE_DATA:
+        case ETHOS_FRAME_TYPE_HELLO:
+        case ETHOS_FRAME_TYPE_HELLO_REPLY:
+            dev->framesize += tsrb_add(&dev->inbuf, (const char *)data, len);
+            break;
+#ifdef USE_ETHOS_FOR_STDIO
+        case ETHOS_FRAME_TYPE_TEXT:
+            dev->framesize += len;
+            isrpipe_write(&stdio_uart_isrpipe, (const char *)data, len);
+            break;
+#endif
+    }
+}
+
+static void ethos_isr_chunk(void *arg, const uint8_t *data, size_t len)
+{
+    ethos_t *dev = (ethos_t *) arg;
+    size_t i = 0;
+
+    while (i < len) {
+        size_t run = 0;
+
+        /* only delimiters and escapes need the state machine */
+        if ((dev->state == IN_FRAME) && dev->accept_new) {
+            run = memscan2(&data[i], len - i, ETHOS_FRAME_DELIMITER,
+                           ETHOS_ESC_CHAR);
+        }
+        if (run > 0) {
+            _handle_run(dev, &data[i], run);
+            i += run;
+        }
+        else {
+            ethos_isr(dev, data[i++]);
+        }
+    }
+}
+#endif
+
 static void _isr(netdev_t *netdev)
 {
     ethos_t *dev = (ethos_t *) netdev;
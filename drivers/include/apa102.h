@@ -10,6 +10,12 @@
  * @defgroup    drivers_apa102 APA102 RGB LED
  * @ingroup     drivers_actuators
  * @brief       Driver for chained APA102 RGB LEDs
+ *
+ * By default the driver shifts the data out by toggling two GPIOs. With the
+ * `apa102_spi` pseudomodule the LED frames are encoded into a frame buffer
+ * and sent in a single transfer by the SPI peripheral instead, using DMA on
+ * platforms that support it for spi_transfer_iolist().
+ *
  * @{
  *
  * @file
@@ -21,8 +27,14 @@
 #ifndef APA102_H
 #define APA102_H
 
+#include <stdint.h>
+
 #include "color.h"
+#ifdef MODULE_APA102_SPI
+#include "periph/spi.h"
+#else
 #include "periph/gpio.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,8 +45,15 @@ extern "C" {
  */
 typedef struct {
     int led_numof;          /**< number of chained LEDs */
+#if defined(MODULE_APA102_SPI) || defined(DOXYGEN)
+    spi_t spi;              /**< SPI bus the LEDs are connected to */
+    spi_clk_t spi_clk;      /**< SPI clock speed */
+    uint32_t *buf;          /**< frame buffer of `led_numof` words */
+#endif
+#if !defined(MODULE_APA102_SPI) || defined(DOXYGEN)
     gpio_t data_pin;        /**< data pin */
     gpio_t clk_pin;         /**< clock pin */
+#endif
 } apa102_params_t;
 
 /**
@@ -56,6 +75,9 @@ void apa102_init(apa102_t *dev, const apa102_params_t *params);
 /**
  * @brief   Apply the given color values to the connected LED(s)
  *
+ * With `apa102_spi` the calling thread sleeps while the frame is transferred,
+ * if the platform uses DMA for SPI transfers.
+ *
  * @param[in] dev       device descriptor
  * @param[in] vals      color values, MUST be of size `dev->led_numof`
  *
@@ -54,6 +54,7 @@ typedef struct {
     mutex_t devlock;        /**< lock the device on access */
     int8_t bank;            /**< remember the active register bank */
     uint32_t tx_time;       /**< last transmission time for timeout handling */
+    uint16_t rx_next;       /**< address of the next packet in the RX buffer */
 } enc28j60_t;
 
 /**
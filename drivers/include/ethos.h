@@ -44,6 +44,15 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @brief   Size of the DMA receive buffer
+ *
+ * Only used with the `periph_uart_dma` module.
+ */
+#ifndef ETHOS_DMA_BUFSIZE
+#define ETHOS_DMA_BUFSIZE               (256U)
+#endif
+
 /**
  * @name    Escape char definitions
  * @{
@@ -81,6 +90,9 @@ typedef struct {
     size_t last_framesize;  /**< size of last completed frame */
     mutex_t out_mutex;      /**< mutex used for locking concurrent sends */
     bool accept_new;        /**< incoming frame can be stored or not */
+#if defined(MODULE_PERIPH_UART_DMA) || defined(DOXYGEN)
+    uint8_t rxdma[ETHOS_DMA_BUFSIZE];   /**< DMA receive buffer */
+#endif
 } ethos_t;
 
 /**
@@ -24,6 +24,7 @@
 #define KW2XRF_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "board.h"
 #include "periph/spi.h"
@@ -76,6 +77,20 @@ extern "C" {
  */
 #define KW2XDRF_OUTPUT_POWER_MIN       (-35)
 
+/**
+ * @name    Default CSMA/CA and retransmission parameters
+ *
+ * The transceiver has no hardware CSMA/CA or frame retransmission, the
+ * driver emulates both using the event timer so that the backoffs do not
+ * need the CPU (see @ref NETOPT_CSMA).
+ * @{
+ */
+#define KW2XRF_DEFAULT_CSMA_MAX_BACKOFFS    (4U)    /**< macMaxCSMABackoffs */
+#define KW2XRF_DEFAULT_CSMA_MIN_BE          (3U)    /**< macMinBE */
+#define KW2XRF_DEFAULT_CSMA_MAX_BE          (5U)    /**< macMaxBE */
+#define KW2XRF_DEFAULT_MAX_FRAME_RETRIES    (3U)    /**< macMaxFrameRetries */
+/** @} */
+
 /**
  * @brief   Internal device option flags
  *
@@ -135,6 +150,17 @@ typedef struct {
                                              this is required to know when to
                                              return to @ref kw2xrf_t::idle_state */
     int16_t tx_power;                   /**< The current tx-power setting of the device */
+    bool csma;                          /**< CSMA/CA is performed by the driver */
+    uint8_t csma_max_backoffs;          /**< maximum number of CSMA/CA backoffs */
+    uint8_t csma_min_be;                /**< minimum CSMA/CA backoff exponent */
+    uint8_t csma_max_be;                /**< maximum CSMA/CA backoff exponent */
+    uint8_t max_frame_retries;          /**< maximum number of retransmissions
+                                             of unacknowledged frames */
+    uint8_t csma_be;                    /**< backoff exponent of the current
+                                             TX attempt */
+    uint8_t csma_backoffs;              /**< backoffs of the current TX attempt */
+    uint8_t tx_retries;                 /**< retransmissions of the current
+                                             (or last) frame */
     /** @} */
 } kw2xrf_t;
 
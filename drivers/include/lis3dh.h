@@ -901,6 +901,25 @@ int lis3dh_set_int1(const lis3dh_t *dev, const uint8_t mode);
  */
 int lis3dh_get_fifo_level(const lis3dh_t *dev);
 
+/**
+ * @brief   Read several samples from the FIFO in one bus transaction
+ *
+ * Reading the output registers with address auto increment wraps from OUT_Z_H
+ * back to OUT_X_L while the FIFO is enabled, so a single burst transfers @p num
+ * samples. Combined with the FIFO watermark interrupt on INT1 (see
+ * lis3dh_set_fifo() and lis3dh_set_int1()) the host only wakes up once per
+ * batch of samples.
+ *
+ * @param[in]  dev          Device descriptor of sensor
+ * @param[out] data         Accelerometer readings in milli-G, oldest first
+ * @param[in]  num          Number of samples to read, at most the current
+ *                          FIFO level (see lis3dh_get_fifo_level())
+ *
+ * @return                  0 on success
+ * @return                  -1 on error
+ */
+int lis3dh_read_fifo(const lis3dh_t *dev, lis3dh_data_t *data, size_t num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -117,6 +117,17 @@ typedef struct {
     int16_t z;  /**< Z axis */
 } lsm6dsl_3d_data_t;
 
+/**
+ * @brief   One data set read from the FIFO
+ *
+ * Values of a sensor that is not stored in the FIFO
+ * (@ref LSM6DSL_DECIMATION_NOT_IN_FIFO) are set to 0.
+ */
+typedef struct {
+    lsm6dsl_3d_data_t gyro;     /**< gyroscope values */
+    lsm6dsl_3d_data_t acc;      /**< accelerometer values */
+} lsm6dsl_fifo_data_t;
+
 /**
  * @brief   Named return values
  */
@@ -215,6 +226,42 @@ int lsm6dsl_acc_power_up(const lsm6dsl_t *dev);
  */
 int lsm6dsl_gyro_power_up(const lsm6dsl_t *dev);
 
+/**
+ * @brief   Set the FIFO watermark and signal it on the INT1 pin
+ *
+ * The sensor stores its samples in the FIFO in continuous mode. With the
+ * watermark interrupt connected to a GPIO interrupt, the host wakes up once
+ * per @p num data sets and fetches them with lsm6dsl_fifo_read().
+ *
+ * Gyroscope and accelerometer must use the same decimation, or one of them
+ * must not be stored in the FIFO.
+ *
+ * @param[in] dev    device to configure
+ * @param[in] num    number of data sets, 0 to disable the interrupt
+ * @return LSM6DSL_OK on success
+ * @return < 0 on error
+ */
+int lsm6dsl_fifo_set_watermark(const lsm6dsl_t *dev, uint16_t num);
+
+/**
+ * @brief   Get the number of complete data sets stored in the FIFO
+ * @param[in] dev    device to query
+ * @return number of data sets on success
+ * @return < 0 on error
+ */
+int lsm6dsl_fifo_get_level(const lsm6dsl_t *dev);
+
+/**
+ * @brief   Read data sets from the FIFO in burst transfers
+ * @param[in] dev    device to read
+ * @param[out] data  data sets, oldest first
+ * @param[in] num    number of data sets to read, at most the FIFO level
+ * @return LSM6DSL_OK on success
+ * @return < 0 on error
+ */
+int lsm6dsl_fifo_read(const lsm6dsl_t *dev, lsm6dsl_fifo_data_t *data,
+                      size_t num);
+
 #ifdef __cplusplus
 }
 #endif
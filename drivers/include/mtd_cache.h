@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache mtd page cache
+ * @ingroup     drivers_storage
+ * @brief       Set-associative page cache stacked on top of another mtd device
+ *
+ * The cache is a @ref mtd_dev_t itself, so it can be handed to any user of
+ * the mtd interface (e.g. a VFS file system) in place of the device it wraps.
+ *
+ * Pages read from the underlying device are kept in a cache of
+ * `sets * ways` lines of one page each. A page may only be placed in the set
+ * `page % sets`, within a set the least recently used line is replaced.
+ * Writes only update the cached copy of a page. The modified part of a line
+ * is written to the underlying device when the line is evicted, on
+ * @ref mtd_cache_flush (or @ref mtd_flush) and before the device is powered
+ * down. Erasing discards all cached lines of the erased sectors.
+ *
+ * Buffer memory is provided by the user:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static mtd_cache_line_t lines[4 * 2];
+ * static uint8_t buf[MTD_CACHE_BUF_SIZE(4, 2, 256)];
+ * static mtd_cache_t cache;
+ *
+ * mtd_cache_setup(&cache, MTD_0, lines, buf, sizeof(buf), 4, 2);
+ * mtd_init(&cache.base);
+ * ~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @warning Data written through the cache is only persistent after it was
+ *          flushed.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definition for the mtd_cache driver
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief   Size of the data buffer needed for a cache of the given geometry
+ *
+ * @param[in] sets      number of sets
+ * @param[in] ways      number of lines per set
+ * @param[in] page_size page size of the underlying device
+ */
+#define MTD_CACHE_BUF_SIZE(sets, ways, page_size) \
+    ((size_t)(sets) * (ways) * (page_size))
+
+/**
+ * @brief   Management data of a single cache line
+ */
+typedef struct {
+    uint32_t page;              /**< cached page, UINT32_MAX if unused */
+    uint32_t last_use;          /**< value of the use counter at last access */
+    uint32_t dirty_start;       /**< first modified byte of the line */
+    uint32_t dirty_end;         /**< end of the modified range, 0 if clean */
+} mtd_cache_line_t;
+
+/**
+ * @brief   Device descriptor for mtd_cache device
+ *
+ * This is an extension of the @c mtd_dev_t struct
+ */
+typedef struct {
+    mtd_dev_t base;             /**< inherit from mtd_dev_t object */
+    mtd_dev_t *parent;          /**< cached device */
+    mtd_cache_line_t *lines;    /**< line management data, sets * ways */
+    uint8_t *buf;               /**< line data */
+    size_t buf_len;             /**< size of @p buf in bytes */
+    uint16_t sets;              /**< number of sets */
+    uint16_t ways;              /**< number of lines in a set */
+    uint32_t tick;              /**< use counter for LRU replacement */
+    mutex_t lock;               /**< serializes access to the cache */
+} mtd_cache_t;
+
+/**
+ * @brief   mtd_cache device operations table for mtd
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Set up a cache in front of another mtd device
+ *
+ * @p buf must hold at least @ref MTD_CACHE_BUF_SIZE(@p sets, @p ways, page
+ * size of @p parent) bytes, otherwise initializing the cache fails with
+ * -ENOMEM. Neither @p parent nor the cache are initialized by this function,
+ * call @ref mtd_init on `&cache->base` afterwards.
+ *
+ * @param[out] cache    cache descriptor
+ * @param[in]  parent   device to cache
+ * @param[in]  lines    line management data, must hold @p sets * @p ways entries
+ * @param[in]  buf      line data buffer
+ * @param[in]  buf_len  size of @p buf in bytes
+ * @param[in]  sets     number of sets, must be > 0
+ * @param[in]  ways     number of lines in a set, must be > 0
+ */
+void mtd_cache_setup(mtd_cache_t *cache, mtd_dev_t *parent,
+                     mtd_cache_line_t *lines, uint8_t *buf, size_t buf_len,
+                     unsigned sets, unsigned ways);
+
+/**
+ * @brief   Write all modified lines to the underlying device
+ *
+ * Lines stay cached and are clean afterwards.
+ *
+ * @param[in] cache     cache descriptor
+ *
+ * @return 0 on success
+ * @return < 0 error of the underlying device
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
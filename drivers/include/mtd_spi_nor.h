@@ -24,6 +24,7 @@
 #ifndef MTD_SPI_NOR_H
 #define MTD_SPI_NOR_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "periph_conf.h"
@@ -82,6 +83,11 @@ typedef struct __attribute__((packed)) {
  * @brief   Flag to set when the device support 32KiB block erase (block_erase_32k opcode)
  */
 #define SPI_NOR_F_SECT_32K  (2)
+/**
+ * @brief   Flag to set to read with the read_fast opcode (one dummy byte
+ *          after the address), needed for high SPI clocks on most devices
+ */
+#define SPI_NOR_F_FAST_READ (4)
 
 /**
  * @brief   Device descriptor for serial flash memory devices
@@ -122,6 +128,12 @@ typedef struct {
      * Computed by mtd_spi_nor_init, no need to touch outside the driver.
      */
     uint8_t sec_addr_shift;
+    /**
+     * @brief   an erase started by mtd_spi_nor_erase_start may still be running
+     *
+     * Maintained by the driver, no need to touch outside the driver.
+     */
+    bool busy;
 } mtd_spi_nor_t;
 
 /**
@@ -147,6 +159,36 @@ extern const mtd_spi_nor_opcode_t mtd_spi_nor_opcode_default;
  */
 extern const mtd_spi_nor_opcode_t mtd_spi_nor_opcode_default_4bytes;
 
+/**
+ * @brief   Start an erase without waiting for it to complete
+ *
+ * Issues a single erase command at @p addr, covering as much of @p size as
+ * the device allows in one go (chip, 32 KiB block, 4 KiB sector or one
+ * sector), and returns immediately. Erasing takes tens of milliseconds, during
+ * which the caller can do other work and poll @ref mtd_spi_nor_busy. Call
+ * this function again with the remaining range once the device is idle.
+ *
+ * Any other operation on the device waits for a pending erase first.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] addr      start address, must be sector aligned
+ * @param[in] size      number of bytes to erase, multiple of the sector size
+ *
+ * @return number of bytes the started erase covers
+ * @return -EOVERFLOW if @p addr or @p size are invalid
+ */
+int mtd_spi_nor_erase_start(mtd_spi_nor_t *dev, uint32_t addr, uint32_t size);
+
+/**
+ * @brief   Check whether an erase started by @ref mtd_spi_nor_erase_start is
+ *          still running
+ *
+ * @param[in] dev       device descriptor
+ *
+ * @return  true if the device is still busy
+ */
+bool mtd_spi_nor_busy(mtd_spi_nor_t *dev);
+
 #ifdef __cplusplus
 }
 #endif
@@ -96,7 +96,9 @@
  *    passing the buffer and reading the received data into this buffer
  *
  * This receive sequence can of course be simplified by skipping steps 2 and 3
- * when using fixed sized pre-allocated buffers or similar means. *
+ * when using fixed sized pre-allocated buffers or similar means. Devices that
+ * support this advertise the required buffer size with
+ * @ref NETOPT_RX_PREALLOC.
  *
  * @note    The @ref netdev_driver_t::send "send()" and
  *          @ref netdev_driver_t::recv "recv()" functions **must** never be
@@ -206,6 +208,9 @@ extern "C" {
 #ifdef MODULE_L2FILTER
 #include "net/l2filter.h"
 #endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+#include "net/netstats/neighbor.h"
+#endif
 
 enum {
     NETDEV_TYPE_UNKNOWN,
@@ -287,6 +292,9 @@ struct netdev {
 #ifdef MODULE_L2FILTER
     l2filter_t filter[L2FILTER_LISTSIZE];   /**< link layer address filters */
 #endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    netstats_nb_table_t nb_stats;           /**< per neighbor link statistics */
+#endif
 };
 
 /**
@@ -15,10 +15,11 @@
  * a MCU's ADC unit(s). This interface is intentionally designed as simple as
  * possible, to allow for very easy implementation and maximal portability.
  *
- * As of now, the interface does not allow for any advanced ADC concepts (e.g.
- * continuous mode, scan sequences, injections). It is to be determined, if
- * these features will ever be integrated in this interface, or if it does make
- * more sense to create a second, advanced ADC interface for this.
+ * As of now, the interface does not allow for advanced ADC concepts like scan
+ * sequences or injections. CPUs providing the `periph_adc_continuous` feature
+ * can sample a single line continuously at a fixed rate into a double buffer
+ * (see adc_continuous_start()), which allows for signal processing without
+ * timing jitter.
  *
  * The ADC driver interface is built around the concept of ADC lines. An ADC
  * line in this context is a tuple consisting out of a hardware ADC device (an
@@ -30,8 +31,6 @@
  * waiting for the result of a conversion (e.g. through putting the calling
  * thread to sleep while waiting for the conversion results).
  *
- * @todo        Extend interface for continuous mode?
- *
  * @{
  *
  * @file
@@ -44,6 +43,8 @@
 #define PERIPH_ADC_H
 
 #include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "periph_cpu.h"
 #include "periph_conf.h"
@@ -115,6 +116,56 @@ int adc_init(adc_t line);
  */
 int adc_sample(adc_t line, adc_res_t res);
 
+#if defined(MODULE_PERIPH_ADC_CONTINUOUS) || defined(DOXYGEN)
+/**
+ * @brief   Signature of the callback for continuous sampling
+ *
+ * The callback is called in interrupt context. @p samples stays untouched by
+ * the ADC until the next callback, so it can be processed in place (e.g. as
+ * `q15_t` vector by CMSIS-DSP) while the other half of the buffer fills.
+ *
+ * @param[in] arg           argument given to adc_continuous_start()
+ * @param[in] samples       the half of the buffer that was just filled
+ * @param[in] len           number of samples in @p samples
+ */
+typedef void (*adc_cb_t)(void *arg, int16_t *samples, size_t len);
+
+/**
+ * @brief   Sample the given ADC line continuously into a double buffer
+ *
+ * The conversions are triggered by hardware at @p freq and written to @p buf
+ * without involving the CPU. @p buf is used as two halves of @p len samples
+ * each: whenever one half is full, @p cb is called with it and sampling
+ * continues in the other half.
+ *
+ * The ADC is reserved until adc_continuous_stop() is called, adc_sample()
+ * blocks in the meantime.
+ *
+ * @param[in] line          line to sample, must be initialized
+ * @param[in] res           resolution to use for conversion
+ * @param[in] freq          sampling rate in Hz
+ * @param[out] buf          buffer for 2 * @p len samples
+ * @param[in] len           number of samples per half of @p buf
+ * @param[in] cb            called whenever a half of @p buf is full
+ * @param[in] arg           argument passed to @p cb
+ *
+ * @return                  0 on success
+ * @return                  -1 if resolution or sampling rate are not
+ *                          applicable
+ */
+int adc_continuous_start(adc_t line, adc_res_t res, uint32_t freq,
+                         int16_t *buf, size_t len, adc_cb_t cb, void *arg);
+
+/**
+ * @brief   Stop continuous sampling and release the ADC
+ *
+ * May also be called from the callback.
+ *
+ * @param[in] line          line given to adc_continuous_start()
+ */
+void adc_continuous_stop(adc_t line);
+#endif /* MODULE_PERIPH_ADC_CONTINUOUS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_periph_aes AES Abstraction
+ * @ingroup     drivers_periph
+ * @brief       Peripheral AES-128 block cipher interface
+ *
+ * Many MCUs contain an AES engine that en- and decrypts single blocks much
+ * faster than the software implementation in @ref sys_crypto. CPUs that
+ * provide the `periph_aes` feature expose their AES engine as a
+ * @ref cipher_interface_t. The interface is never used directly: once the
+ * feature is used, e.g. by adding
+ *
+ *     FEATURES_OPTIONAL += periph_aes
+ *
+ * to the application's Makefile, cipher_init() transparently selects it for
+ * @ref CIPHER_AES_128. All modes of operation in @ref sys_crypto (e.g. CCM
+ * and CTR) are built on cipher_encrypt() and cipher_decrypt() and thus
+ * benefit without further changes.
+ *
+ * Implementations may fall back to software for operations the hardware
+ * does not support, e.g. decryption on engines that can only encrypt, as
+ * long as the context layout matches the one of the software AES.
+ *
+ * @{
+ * @file
+ * @brief       AES peripheral driver interface
+ */
+
+#ifndef PERIPH_AES_H
+#define PERIPH_AES_H
+
+#include "crypto/ciphers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   AES-128 block cipher implemented by the CPU's AES peripheral
+ */
+extern const cipher_interface_t periph_aes_interface;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERIPH_AES_H */
+/** @} */
@@ -27,6 +27,10 @@
  * so that any particular bit-width configuration on this driver level would not
  * have much effect...
  *
+ * Platforms providing the `periph_dac_stream` feature can additionally clock
+ * out a buffer of samples at a fixed rate using a timer and the DMA, without
+ * any CPU involvement per sample (see @ref dac_stream_start).
+ *
  * @{
  * @file
  * @brief       DAC peripheral driver interface definition
@@ -38,6 +42,7 @@
 #ifndef PERIPH_DAC_H
 #define PERIPH_DAC_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <limits.h>
 
@@ -60,7 +65,8 @@ typedef unsigned int dac_t;
  */
 enum {
     DAC_OK     = 0,
-    DAC_NOLINE = -1
+    DAC_NOLINE = -1,
+    DAC_NORATE = -2,
 };
 
 /**
@@ -117,6 +123,53 @@ void dac_poweron(dac_t line);
  */
 void dac_poweroff(dac_t line);
 
+#if defined(MODULE_PERIPH_DAC_STREAM) || defined(DOXYGEN)
+/**
+ * @brief   Signature of the DAC stream refill callback
+ *
+ * The callback is executed in interrupt context. It must fill @p samples
+ * before the DMA wraps around to them.
+ *
+ * @param[in] arg           context to the callback (optional)
+ * @param[out] samples      part of the stream buffer that was played out
+ * @param[in] len           number of samples in @p samples
+ */
+typedef void (*dac_stream_cb_t)(void *arg, uint16_t *samples, size_t len);
+
+/**
+ * @brief   Continuously play out a buffer of samples on a DAC line
+ *
+ * @p buf is used as a circular buffer with two halves: whenever the DMA has
+ * played one half and moved on to the other, @p cb is called with the half
+ * that can be refilled. Samples use the same 16-bit scale as @ref dac_set.
+ *
+ * The line must have been initialized with @ref dac_init before.
+ *
+ * @param[in] line          DAC line to stream to
+ * @param[in] buf           sample buffer, must stay valid until the stream is
+ *                          stopped
+ * @param[in] len           number of samples in @p buf, must be even
+ * @param[in] rate          sample rate in Hz
+ * @param[in] cb            refill callback, may be NULL to repeat @p buf
+ * @param[in] arg           optional context passed to @p cb
+ *
+ * @return  DAC_OK on success
+ * @return  DAC_NOLINE on invalid DAC line or no DMA configured for it
+ * @return  DAC_NORATE if @p rate can not be generated
+ */
+int8_t dac_stream_start(dac_t line, uint16_t *buf, size_t len, uint32_t rate,
+                        dac_stream_cb_t cb, void *arg);
+
+/**
+ * @brief   Stop a stream started by @ref dac_stream_start
+ *
+ * The line keeps the output value of the last sample played.
+ *
+ * @param[in] line          DAC line to stop streaming to
+ */
+void dac_stream_stop(dac_t line);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_periph_dma DMA
+ * @ingroup     drivers_periph
+ * @brief       Low-level DMA peripheral driver
+ *
+ * This interface abstracts the DMA controllers of the supported CPUs, so that
+ * peripheral drivers can move data between memory and peripherals (or between
+ * two memory regions) without copying byte by byte on the CPU.
+ *
+ * A logical DMA stream (@ref dma_t) maps to one hardware stream or channel of
+ * the DMA controller. As streams are shared between peripheral drivers, a
+ * stream needs to be acquired before it is configured and released after the
+ * transfer is done, using `dma_acquire()` and `dma_release()`.
+ *
+ * The hardware request line that triggers a transfer is passed as `chan` to
+ * `dma_configure()`. Its meaning is CPU specific: the channel selection of the
+ * stream on stm32, the trigger source on sam0 and the DMAMUX source on
+ * kinetis. It is ignored for @ref DMA_MEM_TO_MEM transfers.
+ *
+ * Transfer lengths and remaining counts are given in data items of the
+ * configured width (see @ref DMA_DATA_WIDTH_BYTE and friends).
+ *
+ * By default `dma_wait()` blocks until the transfer completes. With a callback
+ * set by `dma_set_callback()`, completion is signaled in interrupt context
+ * instead, which allows for non-blocking and circular transfers.
+ *
+ * @{
+ * @file
+ * @brief       Low-level DMA peripheral driver interface definition
+ */
+
+#ifndef PERIPH_DMA_H
+#define PERIPH_DMA_H
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "periph_cpu.h"
+#include "periph_conf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default DMA stream access macro
+ */
+#ifndef DMA_DEV
+#define DMA_DEV(x)          (x)
+#endif
+
+/**
+ * @brief   Define global value for undefined DMA stream
+ */
+#ifndef DMA_UNDEF
+#define DMA_UNDEF           (UINT_MAX)
+#endif
+
+/**
+ * @brief   Default type for logical DMA streams
+ */
+#ifndef HAVE_DMA_T
+typedef unsigned dma_t;
+#endif
+
+/**
+ * @brief   DMA transfer directions
+ */
+#ifndef HAVE_DMA_MODE_T
+typedef enum {
+    DMA_PERIPH_TO_MEM,      /**< Peripheral to memory */
+    DMA_MEM_TO_PERIPH,      /**< Memory to peripheral */
+    DMA_MEM_TO_MEM,         /**< Memory to memory */
+} dma_mode_t;
+#endif
+
+/**
+ * @name    DMA increment modes
+ * @{
+ */
+#ifndef DMA_INC_SRC_ADDR
+#define DMA_INC_SRC_ADDR            (0x01)
+#define DMA_INC_DST_ADDR            (0x02)
+#define DMA_INC_BOTH_ADDR           (DMA_INC_SRC_ADDR | DMA_INC_DST_ADDR)
+#endif
+/** @} */
+
+/**
+ * @name    DMA data width
+ *
+ * The width of a data item is `1 << ((flags & DMA_DATA_WIDTH_MASK) >>
+ * DMA_DATA_WIDTH_SHIFT)` bytes.
+ * @{
+ */
+#ifndef DMA_DATA_WIDTH_BYTE
+#define DMA_DATA_WIDTH_BYTE         (0x00)
+#define DMA_DATA_WIDTH_HALF_WORD    (0x04)
+#define DMA_DATA_WIDTH_WORD         (0x08)
+#define DMA_DATA_WIDTH_MASK         (0x0C)
+#define DMA_DATA_WIDTH_SHIFT        (2)
+#endif
+/** @} */
+
+/**
+ * @brief   Circular mode, the transfer restarts at the beginning of the buffer
+ *          when it is complete
+ *
+ * Where the hardware supports it, a half transfer interrupt is raised as well.
+ */
+#ifndef DMA_CIRCULAR
+#define DMA_CIRCULAR                (0x10)
+#endif
+
+/**
+ * @brief   Signature of the DMA interrupt callback
+ *
+ * @param[in] arg       context given to @ref dma_set_callback
+ */
+typedef void (*dma_cb_t)(void *arg);
+
+/**
+ * @brief   Initialize DMA
+ *
+ * Called once by the CPU initialization code.
+ */
+void dma_init(void);
+
+/**
+ * @brief   Execute a DMA transfer
+ *
+ * This function blocks until the transfer is completed. This is a convenience
+ * function which configure, start, wait and stop a DMA transfer.
+ *
+ * @param[in]  dma     logical DMA stream
+ * @param[in]  chan    DMA request line
+ * @param[in]  src     source buffer
+ * @param[out] dst     destination buffer
+ * @param[in]  len     number of data items to transfer
+ * @param[in]  mode    DMA mode
+ * @param[in]  flags   DMA configuration
+ *
+ * @return < 0 on error, the number of transfered items otherwise
+ */
+int dma_transfer(dma_t dma, int chan, const void *src, void *dst, size_t len,
+                 dma_mode_t mode, uint8_t flags);
+
+/**
+ * @brief   Acquire a DMA stream
+ *
+ * @param[in] dma     logical DMA stream
+ */
+void dma_acquire(dma_t dma);
+
+/**
+ * @brief   Release a DMA stream
+ *
+ * @param[in] dma     logical DMA stream
+ */
+void dma_release(dma_t dma);
+
+/**
+ * @brief   Configure a DMA stream for a new transfer
+ *
+ * @param[in]  dma     logical DMA stream
+ * @param[in]  chan    DMA request line
+ * @param[in]  src     source buffer
+ * @param[out] dst     destination buffer
+ * @param[in]  len     number of data items to transfer
+ * @param[in]  mode    DMA mode
+ * @param[in]  flags   DMA configuration
+ *
+ * @return < 0 on error, 0 on success
+ */
+int dma_configure(dma_t dma, int chan, const void *src, void *dst, size_t len,
+                  dma_mode_t mode, uint8_t flags);
+
+/**
+ * @brief   Start a DMA transfer on a stream
+ *
+ * Start a DMA transfer on a given stream. The stream must be configured first
+ * by a @p dma_configure call.
+ *
+ * @param[in] dma     logical DMA stream
+ */
+void dma_start(dma_t dma);
+
+/**
+ * @brief   Suspend a DMA transfer on a stream
+ *
+ * @param[in] dma     logical DMA stream
+ *
+ * @return the remaining number of items to transfer
+ */
+uint16_t dma_suspend(dma_t dma);
+
+/**
+ * @brief   Resume a suspended DMA transfer on a stream
+ *
+ * @param[in] dma         logical DMA stream
+ * @param[in] remaining   the remaining number of items to transfer, as
+ *                        returned by @ref dma_suspend
+ */
+void dma_resume(dma_t dma, uint16_t remaining);
+
+/**
+ * @brief   Stop a DMA transfer on a stream
+ *
+ * @param[in] dma     logical DMA stream
+ */
+void dma_stop(dma_t dma);
+
+/**
+ * @brief   Set a callback for the interrupts of a DMA stream
+ *
+ * With a callback set, transfer complete (and half transfer) interrupts call
+ * @p cb in interrupt context instead of waking up @ref dma_wait. This allows
+ * for non-blocking and circular transfers. Set @p cb to NULL to restore the
+ * blocking behavior.
+ *
+ * @param[in] dma     logical DMA stream
+ * @param[in] cb      callback, or NULL
+ * @param[in] arg     context passed to @p cb
+ */
+void dma_set_callback(dma_t dma, dma_cb_t cb, void *arg);
+
+/**
+ * @brief   Get the number of items left to transfer on a DMA stream
+ *
+ * @param[in] dma     logical DMA stream
+ *
+ * @return  the remaining number of items to transfer
+ */
+uint16_t dma_remaining(dma_t dma);
+
+/**
+ * @brief   Wait for the end of a transfer
+ *
+ * @param[in] dma     logical DMA stream
+ */
+void dma_wait(dma_t dma);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERIPH_DMA_H */
+/** @} */
@@ -438,6 +438,114 @@ int i2c_write_reg(i2c_t dev, uint16_t addr, uint16_t reg,
 int i2c_write_regs(i2c_t dev, uint16_t addr, uint16_t reg,
                   const void *data, size_t len, uint8_t flags);
 
+#if defined(MODULE_PERIPH_I2C_ASYNC) || defined(DOXYGEN)
+/**
+ * @name    Queued asynchronous transfers
+ *
+ * With the `periph_i2c_async` module, drivers can queue transfers on a bus
+ * instead of blocking the calling thread for their whole duration. Each
+ * transfer is described by an @ref i2c_xfer_t that reports its result through
+ * a completion callback. Transfers of all users of a bus are executed in the
+ * order they were submitted. The bus is acquired on the first transfer
+ * submitted to an idle queue and released once the queue runs empty, so
+ * asynchronous and blocking users can share a bus.
+ *
+ * CPUs that define `PERIPH_I2C_HAVE_ASYNC` drive the queue from the I2C
+ * interrupt and call the callbacks in interrupt context. On all other CPUs
+ * @ref i2c_xfer_submit() executes the queue with the blocking functions
+ * before it returns and calls the callbacks in the context of the submitting
+ * thread.
+ * @{
+ */
+
+/**
+ * @name    Asynchronous transfer operations
+ * @{
+ */
+#define I2C_XFER_READ_BYTES     (0U)    /**< like i2c_read_bytes() */
+#define I2C_XFER_READ_REGS      (1U)    /**< like i2c_read_regs() */
+#define I2C_XFER_WRITE_BYTES    (2U)    /**< like i2c_write_bytes() */
+#define I2C_XFER_WRITE_REGS     (3U)    /**< like i2c_write_regs() */
+/** @} */
+
+/**
+ * @brief   Signature of the completion callback of a transfer
+ *
+ * @param[in] arg           @ref i2c_xfer_t::arg of the transfer
+ * @param[in] res           0 on success, a negative errno value as returned
+ *                          by the blocking functions on error
+ */
+typedef void (*i2c_xfer_cb_t)(void *arg, int res);
+
+/**
+ * @brief   Descriptor of a queued transfer
+ *
+ * The descriptor and @ref i2c_xfer_t::data are used by the I2C driver until
+ * the callback of the transfer is called and must stay valid until then.
+ * Within the callback the descriptor may be modified and submitted again.
+ */
+typedef struct i2c_xfer {
+    struct i2c_xfer *next;  /**< next transfer of the list */
+    void *data;             /**< data to read or write */
+    size_t len;             /**< number of bytes to read or write */
+    uint16_t addr;          /**< 7-bit or 10-bit device address */
+    uint16_t reg;           /**< register address for the `_REGS` operations */
+    uint8_t op;             /**< the operation, `I2C_XFER_*` */
+    uint8_t flags;          /**< optional flags (see @ref i2c_flags_t) */
+    i2c_xfer_cb_t cb;       /**< completion callback, may be NULL */
+    void *arg;              /**< argument of @ref i2c_xfer_t::cb */
+} i2c_xfer_t;
+
+/**
+ * @brief   Queue a list of transfers on the given I2C bus
+ *
+ * The transfers of @p list, linked by @ref i2c_xfer_t::next and terminated
+ * with NULL, are appended to the queue of @p dev. Every transfer completes
+ * with its own callback, a failed transfer does not cancel the ones following
+ * it.
+ *
+ * Must be called from thread context or from a completion callback of the
+ * same bus. The bus must not be acquired by the caller.
+ *
+ * @param[in] dev           I2C peripheral device
+ * @param[in] list          first transfer of the list
+ *
+ * @return                  0 When success
+ * @return                  -EINVAL When a transfer uses @ref I2C_NOSTOP or
+ *                          @ref I2C_NOSTART, nothing was queued then
+ */
+int i2c_xfer_submit(i2c_t dev, i2c_xfer_t *list);
+
+/**
+ * @brief   Start a transfer in the background
+ *
+ * @internal    Implemented by CPUs that define `PERIPH_I2C_HAVE_ASYNC`, only
+ *              called by the common queue implementation with the bus
+ *              acquired.
+ *
+ * @param[in] dev           I2C peripheral device
+ * @param[in] xfer          transfer to start
+ *
+ * @return                  0 When the transfer was started, its end must be
+ *                          signaled with i2c_xfer_done()
+ * @return                  a negative errno value when the transfer could not
+ *                          be started
+ */
+int i2c_xfer_start(i2c_t dev, i2c_xfer_t *xfer);
+
+/**
+ * @brief   Signal the end of the transfer started with i2c_xfer_start()
+ *
+ * @internal    Called by the interrupt handler of CPUs that define
+ *              `PERIPH_I2C_HAVE_ASYNC`.
+ *
+ * @param[in] dev           I2C peripheral device
+ * @param[in] res           result of the transfer
+ */
+void i2c_xfer_done(i2c_t dev, int res);
+/** @} */
+#endif /* MODULE_PERIPH_I2C_ASYNC */
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_periph_sha256 SHA256 Abstraction
+ * @ingroup     drivers_periph
+ * @brief       Peripheral SHA256 compression function interface
+ *
+ * CPUs with a hash engine that can resume from an intermediate digest
+ * provide the `periph_sha256` feature by implementing
+ * periph_sha256_transform(). Once the feature is used, e.g. by adding
+ *
+ *     FEATURES_OPTIONAL += periph_sha256
+ *
+ * to the application's Makefile, the @ref sys_hashes_sha256 API (and thus
+ * HMAC, hash chains and everything built on top) runs all block
+ * compressions on the engine instead of the software implementation.
+ * Padding and buffering of partial blocks stay in software.
+ *
+ * Implementations must serialize concurrent calls themselves.
+ *
+ * @{
+ * @file
+ * @brief       SHA256 peripheral driver interface
+ */
+
+#ifndef PERIPH_SHA256_H
+#define PERIPH_SHA256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Compress consecutive 64 byte message blocks into a SHA256 state
+ *
+ * @param[in,out]   state   intermediate digest as host order words
+ * @param[in]       blocks  message blocks, not necessarily word aligned
+ * @param[in]       num     number of 64 byte blocks in @p blocks
+ */
+void periph_sha256_transform(uint32_t state[8], const void *blocks,
+                             size_t num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERIPH_SHA256_H */
+/** @} */
@@ -58,6 +58,7 @@
 #include <stdint.h>
 #include <limits.h>
 
+#include "iolist.h"
 #include "periph_cpu.h"
 #include "periph_conf.h"
 #include "periph/gpio.h"
@@ -318,6 +319,29 @@ uint8_t spi_transfer_reg(spi_t bus, spi_cs_t cs, uint8_t reg, uint8_t out);
 void spi_transfer_regs(spi_t bus, spi_cs_t cs, uint8_t reg,
                        const void *out, void *in, size_t len);
 
+/**
+ * @brief   Send a scatter-gather list of buffers using the given SPI bus
+ *
+ * All elements of @p iolist are sent as one continuous transfer, the chip
+ * select line stays asserted between the elements. Received data is
+ * discarded.
+ *
+ * Platforms that can move data with DMA queue the elements to the DMA
+ * controller, so the calling thread sleeps while the buffers are
+ * transferred. All other platforms fall back to a generic implementation
+ * calling spi_transfer_bytes() for each element.
+ *
+ * @pre     at least one element of @p iolist is not empty
+ *
+ * @param[in]  bus      SPI device to use
+ * @param[in]  cs       chip select pin/line to use, set to SPI_CS_UNDEF if chip
+ *                      select should not be handled by the SPI driver
+ * @param[in]  cont     if true, keep device selected after transfer
+ * @param[in]  iolist   list of buffers to send
+ */
+void spi_transfer_iolist(spi_t bus, spi_cs_t cs, bool cont,
+                         const iolist_t *iolist);
+
 #ifdef __cplusplus
 }
 #endif
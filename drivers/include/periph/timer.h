@@ -10,6 +10,11 @@
  * @defgroup    drivers_periph_timer Timer
  * @ingroup     drivers_periph
  * @brief       Low-level timer peripheral driver
+ *
+ * Platforms providing the `periph_timer_capture` feature can additionally
+ * latch the counter value on edges of an input pin in hardware, see
+ * @ref timer_capture. This gives timestamps free of interrupt latency.
+ *
  * @{
  *
  * @file
@@ -26,6 +31,9 @@
 #include "periph_cpu.h"
 /** @todo remove dev_enums.h include once all platforms are ported to the updated periph interface */
 #include "periph/dev_enums.h"
+#ifdef MODULE_PERIPH_TIMER_CAPTURE
+#include "periph/gpio.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -164,6 +172,46 @@ void timer_start(tim_t dev);
  */
 void timer_stop(tim_t dev);
 
+#if defined(MODULE_PERIPH_TIMER_CAPTURE) || defined(DOXYGEN)
+/**
+ * @brief   Signature of input capture callbacks
+ *
+ * @param[in] arg       optional context for the callback
+ * @param[in] channel   timer channel that captured an edge
+ * @param[in] value     counter value latched by the hardware on the edge
+ */
+typedef void (*timer_capture_cb_t)(void *arg, int channel, unsigned int value);
+
+/**
+ * @brief   Capture the counter value on edges of a channel's input pin
+ *
+ * The timer must have been initialized with @ref timer_init before. The pin
+ * of each channel is part of the timer's board configuration. The callback
+ * is executed in interrupt context for every captured edge, until the
+ * capture is stopped with @ref timer_capture_stop. A channel used for
+ * capturing can not be used with @ref timer_set at the same time.
+ *
+ * @param[in] dev           the timer device to capture with
+ * @param[in] channel       the channel to capture on
+ * @param[in] flank         edge(s) to capture
+ * @param[in] cb            callback executed for each captured edge
+ * @param[in] arg           optional argument passed to @p cb
+ *
+ * @return                  0 on success
+ * @return                  -1 on invalid channel or no pin configured
+ */
+int timer_capture(tim_t dev, int channel, gpio_flank_t flank,
+                  timer_capture_cb_t cb, void *arg);
+
+/**
+ * @brief   Stop capturing on a channel
+ *
+ * @param[in] dev           the timer device
+ * @param[in] channel       the channel to stop capturing on
+ */
+void timer_capture_stop(tim_t dev, int channel);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
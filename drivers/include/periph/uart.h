@@ -37,6 +37,14 @@
  * to STDIO in RIOT which is used for standard input/output functions like
  * `printf()` or `puts()`.
  *
+ * Platforms providing the `periph_uart_dma` feature additionally support a DMA
+ * driven mode. Received data is written by DMA into a circular buffer supplied
+ * by the user, and the user is notified with chunks of data when the line goes
+ * idle and when half or all of the buffer has been filled. This reduces the
+ * number of interrupts for fast serial links from one per byte to a few per
+ * frame. Transmission can be started without blocking using
+ * @ref uart_write_async.
+ *
  * @{
  *
  * @file
@@ -90,6 +98,28 @@ typedef unsigned int uart_t;
  */
 typedef void(*uart_rx_cb_t)(void *arg, uint8_t data);
 
+#if defined(MODULE_PERIPH_UART_DMA) || defined(DOXYGEN)
+/**
+ * @brief   Signature for the DMA receive callback
+ *
+ * The callback is executed in interrupt context with a chunk of newly received
+ * data. @p data points into the DMA buffer given to @ref uart_init_dma and is
+ * only valid until the callback returns.
+ *
+ * @param[in] arg           context to the callback (optional)
+ * @param[in] data          start of the received data
+ * @param[in] len           number of bytes received
+ */
+typedef void(*uart_rx_chunk_cb_t)(void *arg, const uint8_t *data, size_t len);
+
+/**
+ * @brief   Signature for the DMA transmit complete callback
+ *
+ * @param[in] arg           context to the callback (optional)
+ */
+typedef void(*uart_tx_done_cb_t)(void *arg);
+#endif
+
 /**
  * @brief   Interrupt context for a UART device
  */
@@ -108,7 +138,8 @@ enum {
     UART_NODEV      = -1,   /**< invalid UART device given */
     UART_NOBAUD     = -2,   /**< given baudrate is not applicable */
     UART_INTERR     = -3,   /**< all other internal errors */
-    UART_NOMODE     = -4    /**< given mode is not applicable */
+    UART_NOMODE     = -4,   /**< given mode is not applicable */
+    UART_BUSY       = -5    /**< device is busy with another transfer */
 };
 
 /**
@@ -151,6 +182,57 @@ int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg);
  */
 void uart_write(uart_t uart, const uint8_t *data, size_t len);
 
+#if defined(MODULE_PERIPH_UART_DMA) || defined(DOXYGEN)
+/**
+ * @brief   Initialize a given UART device for DMA driven reception
+ *
+ * The UART device is configured like in @ref uart_init, but received bytes are
+ * written by DMA into @p rx_buf, which is used as a circular buffer. @p rx_cb
+ * is called with the data received since the last call whenever the line goes
+ * idle, and whenever the first or the second half of @p rx_buf has been
+ * filled. The callback must consume the data before the DMA wraps around and
+ * overwrites it, so @p rx_buf should hold at least two of the largest expected
+ * bursts of data.
+ *
+ * @param[in] uart          UART device to initialize
+ * @param[in] baudrate      desired baudrate in baud/s
+ * @param[in] rx_buf        buffer to receive into, must stay valid while the
+ *                          device is in use
+ * @param[in] rx_len        size of @p rx_buf in bytes
+ * @param[in] rx_cb         receive callback, executed in interrupt context
+ * @param[in] arg           optional context passed to the callback functions
+ *
+ * @return                  UART_OK on success
+ * @return                  UART_NODEV on invalid UART device
+ * @return                  UART_NOBAUD on inapplicable baudrate
+ * @return                  UART_NOMODE if no DMA is configured for the device
+ * @return                  UART_INTERR on other errors
+ */
+int uart_init_dma(uart_t uart, uint32_t baudrate, uint8_t *rx_buf,
+                  size_t rx_len, uart_rx_chunk_cb_t rx_cb, void *arg);
+
+/**
+ * @brief   Start a DMA transfer of the given buffer without blocking
+ *
+ * The function returns as soon as the transfer has been started. @p data must
+ * stay valid until @p cb has been called. If a previous asynchronous transfer
+ * is still ongoing, this function waits for it to finish first, so it must
+ * not be called from interrupt context.
+ *
+ * @param[in] uart          UART device to use for transmission
+ * @param[in] data          data buffer to send
+ * @param[in] len           number of bytes to send
+ * @param[in] cb            callback executed in interrupt context once
+ *                          @p data may be reused, may be NULL
+ * @param[in] arg           optional context passed to @p cb
+ *
+ * @return                  UART_OK on success
+ * @return                  UART_NOMODE if no DMA is configured for the device
+ */
+int uart_write_async(uart_t uart, const uint8_t *data, size_t len,
+                     uart_tx_done_cb_t cb, void *arg);
+#endif
+
 /**
  * @brief   Power on the given UART device
  *
@@ -44,6 +44,17 @@ extern "C" {
 #define SLIPDEV_BUFSIZE (2048U)
 #endif
 
+/**
+ * @brief   Size of the DMA receive buffer
+ *
+ * Only used with the `periph_uart_dma` module. The buffer is used as a ring
+ * and handed over in chunks, it should hold at least two chunks received
+ * between the interrupts of the UART.
+ */
+#ifndef SLIPDEV_DMA_BUFSIZE
+#define SLIPDEV_DMA_BUFSIZE (256U)
+#endif
+
 /**
  * @brief   Configuration parameters for a slipdev
  */
@@ -62,6 +73,9 @@ typedef struct {
     slipdev_params_t config;                /**< configuration parameters */
     tsrb_t inbuf;                           /**< RX buffer */
     char rxmem[SLIPDEV_BUFSIZE];            /**< memory used by RX buffer */
+#if defined(MODULE_PERIPH_UART_DMA) || defined(DOXYGEN)
+    uint8_t rxdma[SLIPDEV_DMA_BUFSIZE];     /**< DMA receive buffer */
+#endif
     uint16_t inesc;                         /**< device previously received an escape
                                              *   byte */
 } slipdev_t;
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_ws281x WS281x RGB LED
+ * @ingroup     drivers_actuators
+ * @brief       Driver for chained WS2811/WS2812 RGB LEDs
+ *
+ * The one wire protocol of the WS281x is generated by the SPI peripheral: the
+ * bus runs at 5MHz and every data bit is encoded as five SPI bits, `11000`
+ * for a 0 (0.4us high) and `11110` for a 1 (0.8us high). Colors are encoded
+ * into a frame buffer by ws281x_set() and sent by ws281x_write() in a single
+ * transfer, which uses DMA on platforms that support it for
+ * spi_transfer_iolist(). Only the MOSI pin is connected to the LED strip.
+ *
+ * The frame buffer needs @ref WS281X_BUF_SIZE bytes for a given number of
+ * LEDs, 15 bytes per LED plus the reset time.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface for controlling WS281x LEDs
+ */
+
+#ifndef WS281X_H
+#define WS281X_H
+
+#include <stdint.h>
+
+#include "color.h"
+#include "periph/spi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of SPI bytes encoding one LED
+ */
+#define WS281X_BYTES_PER_LED    (15U)
+
+/**
+ * @brief   Number of zero bytes appended to latch the data (80us at 5MHz)
+ */
+#ifndef WS281X_RESET_BYTES
+#define WS281X_RESET_BYTES      (50U)
+#endif
+
+/**
+ * @brief   Size of the frame buffer for @p n LEDs in bytes
+ */
+#define WS281X_BUF_SIZE(n)      ((n) * WS281X_BYTES_PER_LED + WS281X_RESET_BYTES)
+
+/**
+ * @brief   Configuration parameters for (chained) WS281x LEDs
+ */
+typedef struct {
+    uint16_t led_numof;     /**< number of chained LEDs */
+    spi_t spi;              /**< SPI bus the data line is connected to */
+    uint8_t *buf;           /**< frame buffer of
+                                 `WS281X_BUF_SIZE(led_numof)` bytes */
+} ws281x_params_t;
+
+/**
+ * @brief   Device descriptor definition for WS281x LEDs
+ */
+typedef ws281x_params_t ws281x_t;
+
+/**
+ * @brief   Initialize (chained) WS281x LEDs
+ *
+ * All LEDs of the frame buffer are set to black.
+ *
+ * @param[out] dev      device descriptor
+ * @param[in]  params   device configuration
+ *
+ * @pre     @p dev != NULL
+ * @pre     @p params != NULL
+ */
+void ws281x_init(ws281x_t *dev, const ws281x_params_t *params);
+
+/**
+ * @brief   Set the color of one LED in the frame buffer
+ *
+ * The LEDs keep their color until ws281x_write() is called.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] index     index of the LED in the chain
+ * @param[in] color     new color of the LED
+ *
+ * @pre     @p index < `dev->led_numof`
+ */
+void ws281x_set(const ws281x_t *dev, unsigned index, const color_rgb_t *color);
+
+/**
+ * @brief   Send the frame buffer to the LEDs
+ *
+ * The calling thread sleeps while the frame is transferred, if the platform
+ * uses DMA for SPI transfers.
+ *
+ * @param[in] dev       device descriptor
+ */
+void ws281x_write(const ws281x_t *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WS281X_H */
+/** @} */
@@ -107,6 +107,12 @@ void kw2xrf_reset_phy(kw2xrf_t *dev)
     kw2xrf_set_option(dev, KW2XRF_OPT_ACK_REQ, true);
     kw2xrf_set_option(dev, KW2XRF_OPT_AUTOCCA, true);
 
+    dev->csma = true;
+    dev->csma_max_backoffs = KW2XRF_DEFAULT_CSMA_MAX_BACKOFFS;
+    dev->csma_min_be = KW2XRF_DEFAULT_CSMA_MIN_BE;
+    dev->csma_max_be = KW2XRF_DEFAULT_CSMA_MAX_BE;
+    dev->max_frame_retries = KW2XRF_DEFAULT_MAX_FRAME_RETRIES;
+
     kw2xrf_set_power_mode(dev, KW2XRF_AUTODOZE);
     kw2xrf_set_sequence(dev, dev->idle_state);
 
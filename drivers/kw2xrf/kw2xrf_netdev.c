@@ -23,8 +23,10 @@
 #include <string.h>
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
 
 #include "log.h"
+#include "random.h"
 #include "thread_flags.h"
 #include "net/eui64.h"
 #include "net/ieee802154.h"
@@ -43,6 +45,7 @@
 #include "debug.h"
 
 #define _MACACKWAITDURATION         (864 / 16) /* 864us * 62500Hz */
+#define _UNITBACKOFFPERIOD          (20U)      /* 20 symbols = 320us */
 
 #define KW2XRF_THREAD_FLAG_ISR      (1 << 8)
 
@@ -99,8 +102,26 @@ static size_t kw2xrf_tx_load(uint8_t *pkt_buf, uint8_t *buf, size_t len, size_t
     return offset + len;
 }
 
-static void kw2xrf_tx_exec(kw2xrf_t *dev)
+/* starts one transmission attempt of the frame in the packet buffer */
+static void kw2xrf_tx_attempt(kw2xrf_t *dev)
 {
+    uint32_t periods = 0;
+
+    if (dev->csma) {
+        periods = random_uint32_range(0, 1U << dev->csma_be);
+    }
+
+    if (periods > 0) {
+        /* let the event timer start the sequence after the backoff, the
+         * CPU is free (or may sleep) until the sequence IRQ */
+        DEBUG("[kw2xrf] backoff %" PRIu32 " periods\n", periods);
+        kw2xrf_trigger_tx_ops_enable(dev, periods * _UNITBACKOFFPERIOD);
+        kw2xrf_timer2_seq_start_on(dev);
+    }
+    else {
+        kw2xrf_timer2_seq_start_off(dev);
+    }
+
     if ((dev->netdev.flags & KW2XRF_OPT_ACK_REQ) &&
         (_send_last_fcf & IEEE802154_FCF_ACK_REQ)) {
         kw2xrf_set_sequence(dev, XCVSEQ_TX_RX);
@@ -110,6 +131,48 @@ static void kw2xrf_tx_exec(kw2xrf_t *dev)
     }
 }
 
+static void kw2xrf_tx_exec(kw2xrf_t *dev)
+{
+    dev->csma_be = dev->csma_min_be;
+    dev->csma_backoffs = 0;
+    dev->tx_retries = 0;
+    kw2xrf_tx_attempt(dev);
+}
+
+/* stops timer triggered sequence starts after the sequence ended */
+static void kw2xrf_tx_trigger_off(kw2xrf_t *dev)
+{
+    kw2xrf_timer2_seq_start_off(dev);
+    kw2xrf_trigger_tx_ops_disable(dev);
+}
+
+/* retries after a busy channel, returns false if no backoffs are left */
+static bool kw2xrf_tx_backoff(kw2xrf_t *dev)
+{
+    if (!dev->csma || (dev->csma_backoffs >= dev->csma_max_backoffs)) {
+        return false;
+    }
+    dev->csma_backoffs++;
+    if (dev->csma_be < dev->csma_max_be) {
+        dev->csma_be++;
+    }
+    kw2xrf_tx_attempt(dev);
+    return true;
+}
+
+/* retransmits an unacknowledged frame, returns false if no retries are left */
+static bool kw2xrf_tx_retransmit(kw2xrf_t *dev)
+{
+    if (dev->tx_retries >= dev->max_frame_retries) {
+        return false;
+    }
+    dev->tx_retries++;
+    dev->csma_be = dev->csma_min_be;
+    dev->csma_backoffs = 0;
+    kw2xrf_tx_attempt(dev);
+    return true;
+}
+
 static void kw2xrf_wait_idle(kw2xrf_t *dev)
 {
     /* make sure any ongoing T or TR sequence is finished */
@@ -199,8 +262,8 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     netdev->stats.rx_bytes += pkt_len;
 #endif
 
-    if (pkt_len > len) {
-        /* not enough space in buf */
+    if ((pkt_len + 1) > len) {
+        /* not enough space in buf (FIFO is read including the LQI) */
         return -ENOBUFS;
     }
 
@@ -265,6 +328,14 @@ int _get(netdev_t *netdev, netopt_t opt, void *value, size_t len)
             *((netopt_state_t *)value) = _get_state(dev);
             return sizeof(netopt_state_t);
 
+        case NETOPT_RX_PREALLOC:
+            if (len < sizeof(uint16_t)) {
+                return -EOVERFLOW;
+            }
+            /* the FIFO is read in one burst including FCS and LQI */
+            *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX + 1;
+            return sizeof(uint16_t);
+
         case NETOPT_AUTOACK:
             if (dev->netdev.flags & KW2XRF_OPT_AUTOACK) {
                 *((netopt_enable_t *)value) = NETOPT_ENABLE;
@@ -318,6 +389,45 @@ int _get(netdev_t *netdev, netopt_t opt, void *value, size_t len)
                 !!(dev->netdev.flags & KW2XRF_OPT_AUTOCCA);
             return sizeof(netopt_enable_t);
 
+        case NETOPT_CSMA:
+            *((netopt_enable_t *)value) = dev->csma;
+            return sizeof(netopt_enable_t);
+
+        case NETOPT_CSMA_RETRIES:
+            if (len < sizeof(uint8_t)) {
+                return -EOVERFLOW;
+            }
+            *((uint8_t *)value) = dev->csma_max_backoffs;
+            return sizeof(uint8_t);
+
+        case NETOPT_CSMA_MINBE:
+            if (len < sizeof(uint8_t)) {
+                return -EOVERFLOW;
+            }
+            *((uint8_t *)value) = dev->csma_min_be;
+            return sizeof(uint8_t);
+
+        case NETOPT_CSMA_MAXBE:
+            if (len < sizeof(uint8_t)) {
+                return -EOVERFLOW;
+            }
+            *((uint8_t *)value) = dev->csma_max_be;
+            return sizeof(uint8_t);
+
+        case NETOPT_RETRANS:
+            if (len < sizeof(uint8_t)) {
+                return -EOVERFLOW;
+            }
+            *((uint8_t *)value) = dev->max_frame_retries;
+            return sizeof(uint8_t);
+
+        case NETOPT_TX_RETRIES_NEEDED:
+            if (len < sizeof(uint8_t)) {
+                return -EOVERFLOW;
+            }
+            *((uint8_t *)value) = dev->tx_retries;
+            return sizeof(uint8_t);
+
         case NETOPT_CHANNEL:
             if (len < sizeof(uint16_t)) {
                 return -EOVERFLOW;
@@ -508,6 +618,57 @@ static int _set(netdev_t *netdev, netopt_t opt, const void *value, size_t len)
             res = sizeof(netopt_enable_t);
             break;
 
+        case NETOPT_CSMA:
+            dev->csma = ((bool *)value)[0];
+            if (dev->csma) {
+                /* every backoff ends with a CCA */
+                kw2xrf_set_option(dev, KW2XRF_OPT_AUTOCCA, true);
+            }
+            res = sizeof(netopt_enable_t);
+            break;
+
+        case NETOPT_CSMA_RETRIES:
+            if ((len > sizeof(uint8_t)) || (*((uint8_t *)value) > 5)) {
+                res = -EINVAL;
+            }
+            else {
+                dev->csma_max_backoffs = *((uint8_t *)value);
+                res = sizeof(uint8_t);
+            }
+            break;
+
+        case NETOPT_CSMA_MINBE:
+            if ((len > sizeof(uint8_t)) ||
+                (*((uint8_t *)value) > dev->csma_max_be)) {
+                res = -EINVAL;
+            }
+            else {
+                dev->csma_min_be = *((uint8_t *)value);
+                res = sizeof(uint8_t);
+            }
+            break;
+
+        case NETOPT_CSMA_MAXBE:
+            if ((len > sizeof(uint8_t)) || (*((uint8_t *)value) > 8) ||
+                (*((uint8_t *)value) < dev->csma_min_be)) {
+                res = -EINVAL;
+            }
+            else {
+                dev->csma_max_be = *((uint8_t *)value);
+                res = sizeof(uint8_t);
+            }
+            break;
+
+        case NETOPT_RETRANS:
+            if ((len > sizeof(uint8_t)) || (*((uint8_t *)value) > 7)) {
+                res = -EINVAL;
+            }
+            else {
+                dev->max_frame_retries = *((uint8_t *)value);
+                res = sizeof(uint8_t);
+            }
+            break;
+
         case NETOPT_CCA_THRESHOLD:
             if (len < sizeof(uint8_t)) {
                 res = -EOVERFLOW;
@@ -613,15 +774,19 @@ static void _isr_event_seq_t(netdev_t *netdev, uint8_t *dregs)
         DEBUG("[kw2xrf] SEQIRQ\n");
         irqsts1 |= MKW2XDM_IRQSTS1_SEQIRQ;
 
-        if (dregs[MKW2XDM_IRQSTS1] & MKW2XDM_IRQSTS1_CCAIRQ) {
-            irqsts1 |= MKW2XDM_IRQSTS1_CCAIRQ;
-            if (dregs[MKW2XDM_IRQSTS2] & MKW2XDM_IRQSTS2_CCA) {
-                DEBUG("[kw2xrf] CCA CH busy\n");
-                netdev->event_callback(netdev, NETDEV_EVENT_TX_MEDIUM_BUSY);
-            }
-            else {
-                netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
+        kw2xrf_tx_trigger_off(dev);
+
+        irqsts1 |= (dregs[MKW2XDM_IRQSTS1] & MKW2XDM_IRQSTS1_CCAIRQ);
+        if ((dregs[MKW2XDM_IRQSTS1] & MKW2XDM_IRQSTS1_CCAIRQ) &&
+            (dregs[MKW2XDM_IRQSTS2] & MKW2XDM_IRQSTS2_CCA)) {
+            DEBUG("[kw2xrf] CCA CH busy\n");
+            if (kw2xrf_tx_backoff(dev)) {
+                goto out;
             }
+            netdev->event_callback(netdev, NETDEV_EVENT_TX_MEDIUM_BUSY);
+        }
+        else {
+            netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
         }
 
         assert(dev->pending_tx != 0);
@@ -629,6 +794,8 @@ static void _isr_event_seq_t(netdev_t *netdev, uint8_t *dregs)
         kw2xrf_set_idle_sequence(dev);
     }
 
+out:
+
     kw2xrf_write_dreg(dev, MKW2XDM_IRQSTS1, irqsts1);
     dregs[MKW2XDM_IRQSTS1] &= ~irqsts1;
 }
@@ -684,31 +851,42 @@ static void _isr_event_seq_tr(netdev_t *netdev, uint8_t *dregs)
     }
 
     if (dregs[MKW2XDM_IRQSTS1] & MKW2XDM_IRQSTS1_SEQIRQ) {
-        if (dregs[MKW2XDM_IRQSTS1] & MKW2XDM_IRQSTS1_CCAIRQ) {
-            irqsts1 |= MKW2XDM_IRQSTS1_CCAIRQ;
-            if (dregs[MKW2XDM_IRQSTS2] & MKW2XDM_IRQSTS2_CCA) {
-                DEBUG("[kw2xrf] CCA CH busy\n");
-                netdev->event_callback(netdev, NETDEV_EVENT_TX_MEDIUM_BUSY);
-            }
-        }
-
         DEBUG("[kw2xrf] SEQIRQ\n");
         irqsts1 |= MKW2XDM_IRQSTS1_SEQIRQ;
+        kw2xrf_seq_timeout_off(dev);
+        kw2xrf_tx_trigger_off(dev);
+
+        irqsts1 |= (dregs[MKW2XDM_IRQSTS1] & MKW2XDM_IRQSTS1_CCAIRQ);
+        if ((dregs[MKW2XDM_IRQSTS1] & MKW2XDM_IRQSTS1_CCAIRQ) &&
+            (dregs[MKW2XDM_IRQSTS2] & MKW2XDM_IRQSTS2_CCA)) {
+            DEBUG("[kw2xrf] CCA CH busy\n");
+            if (kw2xrf_tx_backoff(dev)) {
+                goto out;
+            }
+            /* the frame was never sent, so don't report it as complete */
+            netdev->event_callback(netdev, NETDEV_EVENT_TX_MEDIUM_BUSY);
+        }
+        else {
+            netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
+        }
         assert(dev->pending_tx != 0);
         dev->pending_tx--;
-        netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
-        kw2xrf_seq_timeout_off(dev);
         kw2xrf_set_idle_sequence(dev);
     }
     else if (dregs[MKW2XDM_IRQSTS3] & MKW2XDM_IRQSTS3_TMR4IRQ) {
         DEBUG("[kw2xrf] TC4TMOUT, no SEQIRQ, TX failed\n");
+        kw2xrf_seq_timeout_off(dev);
+        kw2xrf_tx_trigger_off(dev);
+        if (kw2xrf_tx_retransmit(dev)) {
+            goto out;
+        }
         assert(dev->pending_tx != 0);
         dev->pending_tx--;
         netdev->event_callback(netdev, NETDEV_EVENT_TX_NOACK);
-        kw2xrf_seq_timeout_off(dev);
         kw2xrf_set_sequence(dev, dev->idle_state);
     }
 
+out:
     kw2xrf_write_dreg(dev, MKW2XDM_IRQSTS1, irqsts1);
     dregs[MKW2XDM_IRQSTS1] &= ~irqsts1;
 }
@@ -84,25 +84,29 @@ int lis3dh_init(lis3dh_t *dev, const lis3dh_params_t *params)
 
 int lis3dh_read_xyz(const lis3dh_t *dev, lis3dh_data_t *acc_data)
 {
-    uint8_t i;
+    return lis3dh_read_fifo(dev, acc_data, 1);
+}
+
+int lis3dh_read_fifo(const lis3dh_t *dev, lis3dh_data_t *data, size_t num)
+{
     /* Set READ MULTIPLE mode */
     static const uint8_t addr = (LIS3DH_REG_OUT_X_L | LIS3DH_SPI_READ_MASK |
                                  LIS3DH_SPI_MULTI_MASK);
 
     /* Acquire exclusive access to the bus. */
     spi_acquire(DEV_SPI, DEV_CS, SPI_MODE, DEV_CLK);
-    /* Perform the transaction */
+    /* Perform the transaction, the address wraps around after OUT_Z_H */
     spi_transfer_regs(DEV_SPI, DEV_CS, addr,
-                      NULL, acc_data, sizeof(lis3dh_data_t));
+                      NULL, data, num * sizeof(lis3dh_data_t));
     /* Release the bus for other threads. */
     spi_release(DEV_SPI);
 
     /* Scale to milli-G */
-    for (i = 0; i < 3; ++i) {
-        int32_t tmp = (int32_t)(((int16_t *)acc_data)[i]);
+    for (size_t i = 0; i < (num * 3); ++i) {
+        int32_t tmp = (int32_t)(((int16_t *)data)[i]);
         tmp *= dev->scale;
         tmp /= 32768;
-        (((int16_t *)acc_data)[i]) = (int16_t)tmp;
+        (((int16_t *)data)[i]) = (int16_t)tmp;
     }
 
     return 0;
@@ -151,8 +151,39 @@ extern "C" {
 #define LSM6DSL_FIFO_CTRL5_FIFO_ODR_SHIFT   (3)
 
 #define LSM6DSL_FIFO_CTRL3_GYRO_DEC_SHIFT   (3)
+#define LSM6DSL_FIFO_CTRL3_ACC_DEC_MASK     (0x07)
+
+#define LSM6DSL_FIFO_CTRL2_FTH_MASK         (0x07)
+/** @} */
+
+/**
+ * @name    FIFO_STATUSx registers
+ * @{
+ */
+#define LSM6DSL_FIFO_STATUS2_DIFF_MASK      (0x07)
+#define LSM6DSL_FIFO_STATUS4_PATTERN_MASK   (0x03)
+/** @} */
+
+/**
+ * @name    INT1_CTRL register
+ * @{
+ */
+#define LSM6DSL_INT1_CTRL_FTH               (0x08)
 /** @} */
 
+/**
+ * @brief   Maximum FIFO threshold in 16-bit words
+ */
+#define LSM6DSL_FIFO_FTH_MAX                (0x7ff)
+
+/**
+ * @brief   Maximum number of bytes read from the FIFO in one I2C transfer
+ *
+ * Multiple of the size of a full data set (gyroscope and accelerometer) and
+ * below the transfer limit of all I2C implementations.
+ */
+#define LSM6DSL_FIFO_CHUNK_SIZE             (240U)
+
 /**
  * @brief	Offset for temperature calculation
  */
@@ -20,6 +20,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "xtimer.h"
 
 #include "lsm6dsl.h"
@@ -300,3 +302,166 @@ int lsm6dsl_gyro_power_up(const lsm6dsl_t *dev)
 
     return LSM6DSL_OK;
 }
+
+/**
+ * @brief   Number of 16-bit words per FIFO data set of the given sensor
+ */
+static inline unsigned _fifo_words(uint8_t decimation)
+{
+    return (decimation == LSM6DSL_DECIMATION_NOT_IN_FIFO) ? 0 : 3;
+}
+
+static int _fifo_set_words(const lsm6dsl_t *dev)
+{
+    unsigned gyro = _fifo_words(dev->params.gyro_decimation);
+    unsigned acc = _fifo_words(dev->params.acc_decimation);
+
+    if (gyro && acc &&
+        (dev->params.gyro_decimation != dev->params.acc_decimation)) {
+        return -LSM6DSL_ERROR_CNF;
+    }
+    if (!gyro && !acc) {
+        return -LSM6DSL_ERROR_CNF;
+    }
+    return gyro + acc;
+}
+
+int lsm6dsl_fifo_set_watermark(const lsm6dsl_t *dev, uint16_t num)
+{
+    int words = _fifo_set_words(dev);
+    uint32_t fth;
+    uint8_t tmp;
+    int res;
+
+    if (words < 0) {
+        return words;
+    }
+    fth = (uint32_t)num * words;
+    if (fth > LSM6DSL_FIFO_FTH_MAX) {
+        return -LSM6DSL_ERROR_CNF;
+    }
+
+    i2c_acquire(BUS);
+    res = i2c_write_reg(BUS, ADDR, LSM6DSL_REG_FIFO_CTRL1, fth & 0xff, 0);
+    res += i2c_read_reg(BUS, ADDR, LSM6DSL_REG_FIFO_CTRL2, &tmp, 0);
+    tmp &= ~(LSM6DSL_FIFO_CTRL2_FTH_MASK);
+    tmp |= (fth >> 8) & LSM6DSL_FIFO_CTRL2_FTH_MASK;
+    res += i2c_write_reg(BUS, ADDR, LSM6DSL_REG_FIFO_CTRL2, tmp, 0);
+    res += i2c_read_reg(BUS, ADDR, LSM6DSL_REG_INT1_CTRL, &tmp, 0);
+    if (num) {
+        tmp |= LSM6DSL_INT1_CTRL_FTH;
+    }
+    else {
+        tmp &= ~(LSM6DSL_INT1_CTRL_FTH);
+    }
+    res += i2c_write_reg(BUS, ADDR, LSM6DSL_REG_INT1_CTRL, tmp, 0);
+    i2c_release(BUS);
+
+    if (res < 0) {
+        DEBUG("[ERROR] lsm6dsl_fifo_set_watermark\n");
+        return -LSM6DSL_ERROR_BUS;
+    }
+    return LSM6DSL_OK;
+}
+
+int lsm6dsl_fifo_get_level(const lsm6dsl_t *dev)
+{
+    int words = _fifo_set_words(dev);
+    uint8_t status[2];
+
+    if (words < 0) {
+        return words;
+    }
+
+    i2c_acquire(BUS);
+    if (i2c_read_regs(BUS, ADDR, LSM6DSL_REG_FIFO_STATUS1, status, 2, 0) < 0) {
+        i2c_release(BUS);
+        DEBUG("[ERROR] lsm6dsl_fifo_get_level\n");
+        return -LSM6DSL_ERROR_BUS;
+    }
+    i2c_release(BUS);
+
+    return (status[0] | ((status[1] & LSM6DSL_FIFO_STATUS2_DIFF_MASK) << 8)) /
+           words;
+}
+
+int lsm6dsl_fifo_read(const lsm6dsl_t *dev, lsm6dsl_fifo_data_t *data,
+                      size_t num)
+{
+    int words = _fifo_set_words(dev);
+    uint8_t *buf = (uint8_t *)data;
+    size_t len = num * words * 2;
+    uint8_t status[2];
+    uint16_t pattern;
+    int res;
+
+    if (words < 0) {
+        return words;
+    }
+
+    i2c_acquire(BUS);
+    /* drop the rest of a data set a previous read left behind, so the burst
+     * starts at the first word of a data set */
+    res = i2c_read_regs(BUS, ADDR, LSM6DSL_REG_FIFO_STATUS3, status, 2, 0);
+    pattern = status[0] | ((status[1] & LSM6DSL_FIFO_STATUS4_PATTERN_MASK) << 8);
+    if ((res == 0) && (pattern % words)) {
+        uint8_t drop[12];
+        res = i2c_read_regs(BUS, ADDR, LSM6DSL_REG_FIFO_DATA_OUT_L, drop,
+                            (words - (pattern % words)) * 2, 0);
+    }
+    /* the FIFO output register address rolls back on auto increment, so each
+     * chunk is a single transfer */
+    for (size_t pos = 0; (res == 0) && (pos < len);
+         pos += LSM6DSL_FIFO_CHUNK_SIZE) {
+        size_t chunk = len - pos;
+        if (chunk > LSM6DSL_FIFO_CHUNK_SIZE) {
+            chunk = LSM6DSL_FIFO_CHUNK_SIZE;
+        }
+        res = i2c_read_regs(BUS, ADDR, LSM6DSL_REG_FIFO_DATA_OUT_L,
+                            &buf[pos], chunk, 0);
+    }
+    i2c_release(BUS);
+
+    if (res < 0) {
+        DEBUG("[ERROR] lsm6dsl_fifo_read\n");
+        return -LSM6DSL_ERROR_BUS;
+    }
+
+    /* convert the little endian raw words in place */
+    int16_t *raw = (int16_t *)data;
+    for (size_t i = 0; i < (len / 2); i++) {
+        raw[i] = (int16_t)(buf[2 * i] | (buf[2 * i + 1] << 8));
+    }
+
+    /* spread data sets of a single sensor to the full structure, starting
+     * with the last one so no raw data is overwritten before it is moved */
+    if (words == 3) {
+        int gyro = _fifo_words(dev->params.gyro_decimation);
+        for (size_t i = num; i-- > 0;) {
+            lsm6dsl_3d_data_t tmp;
+            memcpy(&tmp, &raw[i * 3], sizeof(tmp));
+            memset(&data[i], 0, sizeof(data[i]));
+            if (gyro) {
+                data[i].gyro = tmp;
+            }
+            else {
+                data[i].acc = tmp;
+            }
+        }
+    }
+
+    assert(dev->params.acc_fs < LSM6DSL_ACC_FS_MAX);
+    assert(dev->params.gyro_fs < LSM6DSL_GYRO_FS_MAX);
+    for (size_t i = 0; i < num; i++) {
+        int16_t *gyro = &data[i].gyro.x;
+        int16_t *acc = &data[i].acc.x;
+        for (unsigned j = 0; j < 3; j++) {
+            gyro[j] = ((int32_t)gyro[j] * range_gyro[dev->params.gyro_fs]) /
+                      INT16_MAX;
+            acc[j] = ((int32_t)acc[j] * range_acc[dev->params.acc_fs]) /
+                     INT16_MAX;
+        }
+    }
+
+    return LSM6DSL_OK;
+}
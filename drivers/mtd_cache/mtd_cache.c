@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Set-associative write-back page cache for mtd devices
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "assert.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define LINE_UNUSED     (UINT32_MAX)
+
+static int mtd_cache_init(mtd_dev_t *mtd);
+static int mtd_cache_read(mtd_dev_t *mtd, void *dest, uint32_t addr,
+                          uint32_t size);
+static int mtd_cache_write(mtd_dev_t *mtd, const void *src, uint32_t addr,
+                           uint32_t size);
+static int mtd_cache_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size);
+static int mtd_cache_power(mtd_dev_t *mtd, enum mtd_power_state power);
+static int mtd_cache_sync(mtd_dev_t *mtd);
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = mtd_cache_init,
+    .read = mtd_cache_read,
+    .write = mtd_cache_write,
+    .erase = mtd_cache_erase,
+    .power = mtd_cache_power,
+    .flush = mtd_cache_sync,
+};
+
+static inline uint8_t *_line_data(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    return cache->buf + (size_t)(line - cache->lines) * cache->base.page_size;
+}
+
+static int _write_back(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (line->dirty_end == 0) {
+        return 0;
+    }
+
+    uint32_t addr = line->page * cache->base.page_size + line->dirty_start;
+    uint32_t len = line->dirty_end - line->dirty_start;
+
+    DEBUG("mtd_cache: write back page %lu (%lu bytes)\n",
+          (unsigned long)line->page, (unsigned long)len);
+    int res = mtd_write(cache->parent, _line_data(cache, line) + line->dirty_start,
+                        addr, len);
+    if (res < 0) {
+        return res;
+    }
+    line->dirty_end = 0;
+    return 0;
+}
+
+/**
+ * @brief   Find the line holding @p page, loading it on a miss
+ *
+ * With @p fill unset, the line is not read from the parent on a miss, the
+ * caller is about to overwrite all of it.
+ */
+static int _get_line(mtd_cache_t *cache, uint32_t page, bool fill,
+                     mtd_cache_line_t **out)
+{
+    mtd_cache_line_t *set = &cache->lines[(page % cache->sets) * cache->ways];
+    mtd_cache_line_t *victim = set;
+
+    for (unsigned i = 0; i < cache->ways; i++) {
+        if (set[i].page == page) {
+            set[i].last_use = ++cache->tick;
+            *out = &set[i];
+            return 0;
+        }
+        if ((victim->page != LINE_UNUSED) &&
+            ((set[i].page == LINE_UNUSED) ||
+             (set[i].last_use < victim->last_use))) {
+            victim = &set[i];
+        }
+    }
+
+    int res = _write_back(cache, victim);
+    if (res < 0) {
+        return res;
+    }
+
+    /* the line is unusable until the read succeeded */
+    victim->page = LINE_UNUSED;
+    if (fill) {
+        res = mtd_read(cache->parent, _line_data(cache, victim),
+                       page * cache->base.page_size, cache->base.page_size);
+        if (res < 0) {
+            return res;
+        }
+    }
+    victim->page = page;
+    victim->last_use = ++cache->tick;
+    *out = victim;
+    return 0;
+}
+
+static int _flush(mtd_cache_t *cache)
+{
+    for (unsigned i = 0; i < (unsigned)cache->sets * cache->ways; i++) {
+        int res = _write_back(cache, &cache->lines[i]);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+void mtd_cache_setup(mtd_cache_t *cache, mtd_dev_t *parent,
+                     mtd_cache_line_t *lines, uint8_t *buf, size_t buf_len,
+                     unsigned sets, unsigned ways)
+{
+    assert(cache && parent && lines && buf);
+    assert((sets > 0) && (ways > 0));
+
+    memset(cache, 0, sizeof(*cache));
+    cache->base.driver = &mtd_cache_driver;
+    cache->parent = parent;
+    cache->lines = lines;
+    cache->buf = buf;
+    cache->buf_len = buf_len;
+    cache->sets = sets;
+    cache->ways = ways;
+    mutex_init(&cache->lock);
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    int res = _flush(cache);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int mtd_cache_init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = (mtd_cache_t *)mtd;
+
+    int res = mtd_init(cache->parent);
+    if (res < 0) {
+        return res;
+    }
+    if (cache->buf_len < MTD_CACHE_BUF_SIZE(cache->sets, cache->ways,
+                                            cache->parent->page_size)) {
+        return -ENOMEM;
+    }
+
+    mtd->sector_count = cache->parent->sector_count;
+    mtd->pages_per_sector = cache->parent->pages_per_sector;
+    mtd->page_size = cache->parent->page_size;
+
+    for (unsigned i = 0; i < (unsigned)cache->sets * cache->ways; i++) {
+        cache->lines[i].page = LINE_UNUSED;
+        cache->lines[i].dirty_end = 0;
+    }
+    cache->tick = 0;
+    return 0;
+}
+
+static int mtd_cache_read(mtd_dev_t *mtd, void *dest, uint32_t addr,
+                          uint32_t size)
+{
+    mtd_cache_t *cache = (mtd_cache_t *)mtd;
+    uint8_t *out = dest;
+    uint32_t left = size;
+    int res = 0;
+
+    if ((uint64_t)addr + size >
+        (uint64_t)mtd->sector_count * mtd->pages_per_sector * mtd->page_size) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    while (left) {
+        uint32_t page = addr / mtd->page_size;
+        uint32_t offset = addr % mtd->page_size;
+        uint32_t len = mtd->page_size - offset;
+        mtd_cache_line_t *line;
+
+        if (len > left) {
+            len = left;
+        }
+        res = _get_line(cache, page, true, &line);
+        if (res < 0) {
+            break;
+        }
+        memcpy(out, _line_data(cache, line) + offset, len);
+        out += len;
+        addr += len;
+        left -= len;
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)size;
+}
+
+static int mtd_cache_write(mtd_dev_t *mtd, const void *src, uint32_t addr,
+                           uint32_t size)
+{
+    mtd_cache_t *cache = (mtd_cache_t *)mtd;
+    const uint8_t *in = src;
+    uint32_t left = size;
+    int res = 0;
+
+    if ((uint64_t)addr + size >
+        (uint64_t)mtd->sector_count * mtd->pages_per_sector * mtd->page_size) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    while (left) {
+        uint32_t page = addr / mtd->page_size;
+        uint32_t offset = addr % mtd->page_size;
+        uint32_t len = mtd->page_size - offset;
+        mtd_cache_line_t *line;
+
+        if (len > left) {
+            len = left;
+        }
+        res = _get_line(cache, page, len != mtd->page_size, &line);
+        if (res < 0) {
+            break;
+        }
+        memcpy(_line_data(cache, line) + offset, in, len);
+        if (line->dirty_end == 0) {
+            line->dirty_start = offset;
+            line->dirty_end = offset + len;
+        }
+        else {
+            if (offset < line->dirty_start) {
+                line->dirty_start = offset;
+            }
+            if (offset + len > line->dirty_end) {
+                line->dirty_end = offset + len;
+            }
+        }
+        in += len;
+        addr += len;
+        left -= len;
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)size;
+}
+
+static int mtd_cache_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
+{
+    mtd_cache_t *cache = (mtd_cache_t *)mtd;
+    uint32_t first = addr / mtd->page_size;
+    uint32_t last = (addr + size) / mtd->page_size;
+
+    mutex_lock(&cache->lock);
+    int res = mtd_erase(cache->parent, addr, size);
+    if (res == 0) {
+        /* whatever was cached or pending for the erased pages is gone */
+        for (unsigned i = 0; i < (unsigned)cache->sets * cache->ways; i++) {
+            mtd_cache_line_t *line = &cache->lines[i];
+            if ((line->page != LINE_UNUSED) &&
+                (line->page >= first) && (line->page < last)) {
+                line->page = LINE_UNUSED;
+                line->dirty_end = 0;
+            }
+        }
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int mtd_cache_power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = (mtd_cache_t *)mtd;
+
+    if (power == MTD_POWER_DOWN) {
+        int res = mtd_cache_flush(cache);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return mtd_power(cache->parent, power);
+}
+
+static int mtd_cache_sync(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = (mtd_cache_t *)mtd;
+
+    int res = mtd_cache_flush(cache);
+    if (res < 0) {
+        return res;
+    }
+    return mtd_flush(cache->parent);
+}
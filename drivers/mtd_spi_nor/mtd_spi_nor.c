@@ -25,11 +25,10 @@
 #include <errno.h>
 
 #include "mtd.h"
+#include "thread.h"
+#include "timex.h"
 #if MODULE_XTIMER
 #include "xtimer.h"
-#include "timex.h"
-#else
-#include "thread.h"
 #endif
 #include "byteorder.h"
 #include "mtd_spi_nor.h"
@@ -48,6 +47,8 @@
 #define MTD_SPI_NOR_WRITE_WAIT_US (50 * US_PER_MS)
 #endif
 
+#define SPI_NOR_STATUS_WIP  (0x01)  /**< write in progress */
+
 #define MTD_32K             (32768ul)
 #define MTD_32K_ADDR_MASK   (0x7FFF)
 #define MTD_4K              (4096ul)
@@ -74,11 +75,13 @@ const mtd_desc_t mtd_spi_nor_driver = {
  * @param[in]  dev    pointer to device descriptor
  * @param[in]  opcode command opcode
  * @param[in]  addr   address (big endian)
+ * @param[in]  dummy  number of dummy bytes between address and data
  * @param[out] dest   read buffer
  * @param[in]  count  number of bytes to read after the address has been sent
  */
 static void mtd_spi_cmd_addr_read(const mtd_spi_nor_t *dev, uint8_t opcode,
-                                  be_uint32_t addr, void *dest, uint32_t count)
+                                  be_uint32_t addr, unsigned dummy,
+                                  void *dest, uint32_t count)
 {
     TRACE("mtd_spi_cmd_addr_read: %p, %02x, (%02x %02x %02x %02x), %p, %" PRIu32 "\n",
           (void *)dev, (unsigned int)opcode, addr.u8[0], addr.u8[1], addr.u8[2],
@@ -97,6 +100,9 @@ static void mtd_spi_cmd_addr_read(const mtd_spi_nor_t *dev, uint8_t opcode,
         /* Send opcode followed by address */
         spi_transfer_byte(dev->spi, dev->cs, true, opcode);
         spi_transfer_bytes(dev->spi, dev->cs, true, (char *)addr_buf, NULL, dev->addr_width);
+        while (dummy--) {
+            spi_transfer_byte(dev->spi, dev->cs, true, 0);
+        }
 
         /* Read data */
         spi_transfer_bytes(dev->spi, dev->cs, false, NULL, dest, count);
@@ -256,22 +262,53 @@ static int mtd_spi_read_jedec_id(const mtd_spi_nor_t *dev, mtd_jedec_id_t *out)
     return status;
 }
 
-static inline void wait_for_write_complete(const mtd_spi_nor_t *dev)
+static bool write_in_progress(const mtd_spi_nor_t *dev)
 {
-    do {
-        uint8_t status;
-        mtd_spi_cmd_read(dev, dev->opcode->rdsr, &status, sizeof(status));
+    uint8_t status;
+    mtd_spi_cmd_read(dev, dev->opcode->rdsr, &status, sizeof(status));
 
-        TRACE("mtd_spi_nor: wait device status = 0x%02x\n", (unsigned int)status);
-        if ((status & 1) == 0) { /* TODO magic number */
-            break;
-        }
+    TRACE("mtd_spi_nor: wait device status = 0x%02x\n", (unsigned int)status);
+    return (status & SPI_NOR_STATUS_WIP);
+}
+
+/**
+ * @internal
+ * @brief Wait for a program or erase command to complete
+ *
+ * Must be called with the bus acquired, the bus is acquired again on return.
+ *
+ * @param[in]  dev    pointer to device descriptor
+ * @param[in]  us     time to sleep between polls with the bus released, 0 to
+ *                    only yield (for short operations like page programs)
+ */
+static void wait_for_write_complete(const mtd_spi_nor_t *dev, uint32_t us)
+{
+    while (write_in_progress(dev)) {
 #if MODULE_XTIMER
-        xtimer_usleep(MTD_SPI_NOR_WRITE_WAIT_US);
+        if (us) {
+            /* leave the bus to others while the chip is busy */
+            spi_release(dev->spi);
+            xtimer_usleep(us);
+            spi_acquire(dev->spi, dev->cs, dev->mode, dev->clk);
+            continue;
+        }
 #else
-        thread_yield();
+        (void)us;
 #endif
-    } while (1);
+        thread_yield();
+    }
+}
+
+/**
+ * @internal
+ * @brief Wait for an erase started by mtd_spi_nor_erase_start, bus acquired
+ */
+static void wait_for_pending(mtd_spi_nor_t *dev)
+{
+    if (dev->busy) {
+        wait_for_write_complete(dev, MTD_SPI_NOR_WRITE_WAIT_US);
+        dev->busy = false;
+    }
 }
 
 static int mtd_spi_nor_init(mtd_dev_t *mtd)
@@ -295,6 +332,7 @@ static int mtd_spi_nor_init(mtd_dev_t *mtd)
     if (dev->addr_width == 0) {
         return -EINVAL;
     }
+    dev->busy = false;
 
     /* CS */
     DEBUG("mtd_spi_nor_init: CS init\n");
@@ -354,29 +392,29 @@ static int mtd_spi_nor_read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t
 {
     DEBUG("mtd_spi_nor_read: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
           (void *)mtd, dest, addr, size);
-    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
     size_t chipsize = mtd->page_size * mtd->pages_per_sector * mtd->sector_count;
     if (addr > chipsize) {
         return -EOVERFLOW;
     }
-    if (size > mtd->page_size) {
-        size = mtd->page_size;
-    }
+    /* the address counter of the chip crosses page boundaries on its own,
+     * so any range can be read with a single command */
     if ((addr + size) > chipsize) {
         size = chipsize - addr;
     }
-    uint32_t page_addr_mask = dev->page_addr_mask;
-    if ((addr & page_addr_mask) != ((addr + size - 1) & page_addr_mask)) {
-        /* Reads across page boundaries must be split */
-        size = mtd->page_size - (addr & ~(page_addr_mask));
-    }
     if (size == 0) {
         return 0;
     }
     be_uint32_t addr_be = byteorder_htonl(addr);
 
     spi_acquire(dev->spi, dev->cs, dev->mode, dev->clk);
-    mtd_spi_cmd_addr_read(dev, dev->opcode->read, addr_be, dest, size);
+    wait_for_pending(dev);
+    if (dev->flag & SPI_NOR_F_FAST_READ) {
+        mtd_spi_cmd_addr_read(dev, dev->opcode->read_fast, addr_be, 1, dest, size);
+    }
+    else {
+        mtd_spi_cmd_addr_read(dev, dev->opcode->read, addr_be, 0, dest, size);
+    }
     spi_release(dev->spi);
 
     return size;
@@ -391,7 +429,7 @@ static int mtd_spi_nor_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uin
     if (size == 0) {
         return 0;
     }
-    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
     if (size > mtd->page_size) {
         DEBUG("mtd_spi_nor_write: ERR: page program >1 page (%" PRIu32 ")!\n", mtd->page_size);
         return -EOVERFLOW;
@@ -407,24 +445,28 @@ static int mtd_spi_nor_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uin
     be_uint32_t addr_be = byteorder_htonl(addr);
 
     spi_acquire(dev->spi, dev->cs, dev->mode, dev->clk);
+    wait_for_pending(dev);
     /* write enable */
     mtd_spi_cmd(dev, dev->opcode->wren);
 
     /* Page program */
     mtd_spi_cmd_addr_write(dev, dev->opcode->page_program, addr_be, src, size);
 
-    /* waiting for the command to complete before returning */
-    wait_for_write_complete(dev);
+    /* waiting for the command to complete before returning, page programs
+     * take less than a few milliseconds so there is no point in sleeping */
+    wait_for_write_complete(dev, 0);
 
     spi_release(dev->spi);
     return size;
 }
 
-static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
+/**
+ * @internal
+ * @brief Check an erase request against the device geometry
+ */
+static int check_erase(const mtd_spi_nor_t *dev, uint32_t addr, uint32_t size)
 {
-    DEBUG("mtd_spi_nor_erase: %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
-          (void *)mtd, addr, size);
-    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    const mtd_dev_t *mtd = &dev->base;
     uint32_t sector_size = mtd->page_size * mtd->pages_per_sector;
     uint32_t total_size = sector_size * mtd->sector_count;
 
@@ -443,50 +485,111 @@ static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
     if (size % sector_size != 0) {
         return -EOVERFLOW;
     }
+    return 0;
+}
+
+/**
+ * @internal
+ * @brief Issue the largest erase command possible at @p addr, bus acquired
+ *
+ * @return number of bytes erased by the command
+ */
+static uint32_t erase_cmd(const mtd_spi_nor_t *dev, uint32_t addr, uint32_t size)
+{
+    const mtd_dev_t *mtd = &dev->base;
+    uint32_t sector_size = mtd->page_size * mtd->pages_per_sector;
+    uint32_t total_size = sector_size * mtd->sector_count;
+    be_uint32_t addr_be = byteorder_htonl(addr);
+
+    /* write enable */
+    mtd_spi_cmd(dev, dev->opcode->wren);
+
+    if (size == total_size) {
+        mtd_spi_cmd(dev, dev->opcode->chip_erase);
+        return total_size;
+    }
+    else if ((dev->flag & SPI_NOR_F_SECT_32K) && (size >= MTD_32K) &&
+             ((addr & MTD_32K_ADDR_MASK) == 0)) {
+        /* 32 KiB blocks can be erased with block erase command */
+        mtd_spi_cmd_addr_write(dev, dev->opcode->block_erase_32k, addr_be, NULL, 0);
+        return MTD_32K;
+    }
+    else if ((dev->flag & SPI_NOR_F_SECT_4K) && (size >= MTD_4K) &&
+             ((addr & MTD_4K_ADDR_MASK) == 0)) {
+        /* 4 KiB sectors can be erased with sector erase command */
+        mtd_spi_cmd_addr_write(dev, dev->opcode->sector_erase, addr_be, NULL, 0);
+        return MTD_4K;
+    }
+    else {
+        mtd_spi_cmd_addr_write(dev, dev->opcode->block_erase, addr_be, NULL, 0);
+        return sector_size;
+    }
+}
+
+static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
+{
+    DEBUG("mtd_spi_nor_erase: %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
+          (void *)mtd, addr, size);
+    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+
+    int res = check_erase(dev, addr, size);
+    if (res < 0) {
+        return res;
+    }
 
     spi_acquire(dev->spi, dev->cs, dev->mode, dev->clk);
+    wait_for_pending(dev);
     while (size) {
-        be_uint32_t addr_be = byteorder_htonl(addr);
-        /* write enable */
-        mtd_spi_cmd(dev, dev->opcode->wren);
-
-        if (size == total_size) {
-            mtd_spi_cmd(dev, dev->opcode->chip_erase);
-            size -= total_size;
-        }
-        else if ((dev->flag & SPI_NOR_F_SECT_32K) && (size >= MTD_32K) &&
-                 ((addr & MTD_32K_ADDR_MASK) == 0)) {
-            /* 32 KiB blocks can be erased with block erase command */
-            mtd_spi_cmd_addr_write(dev, dev->opcode->block_erase_32k, addr_be, NULL, 0);
-            addr += MTD_32K;
-            size -= MTD_32K;
-        }
-        else if ((dev->flag & SPI_NOR_F_SECT_4K) && (size >= MTD_4K) &&
-                 ((addr & MTD_4K_ADDR_MASK) == 0)) {
-            /* 4 KiB sectors can be erased with sector erase command */
-            mtd_spi_cmd_addr_write(dev, dev->opcode->sector_erase, addr_be, NULL, 0);
-            addr += MTD_4K;
-            size -= MTD_4K;
-        }
-        else {
-            mtd_spi_cmd_addr_write(dev, dev->opcode->block_erase, addr_be, NULL, 0);
-            addr += sector_size;
-            size -= sector_size;
-        }
+        uint32_t erased = erase_cmd(dev, addr, size);
+        addr += erased;
+        size -= erased;
 
         /* waiting for the command to complete before continuing */
-        wait_for_write_complete(dev);
+        wait_for_write_complete(dev, MTD_SPI_NOR_WRITE_WAIT_US);
     }
     spi_release(dev->spi);
 
     return 0;
 }
 
+int mtd_spi_nor_erase_start(mtd_spi_nor_t *dev, uint32_t addr, uint32_t size)
+{
+    DEBUG("mtd_spi_nor_erase_start: %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
+          (void *)dev, addr, size);
+
+    int res = check_erase(dev, addr, size);
+    if ((res < 0) || (size == 0)) {
+        return res;
+    }
+
+    spi_acquire(dev->spi, dev->cs, dev->mode, dev->clk);
+    wait_for_pending(dev);
+    res = erase_cmd(dev, addr, size);
+    dev->busy = true;
+    spi_release(dev->spi);
+
+    return res;
+}
+
+bool mtd_spi_nor_busy(mtd_spi_nor_t *dev)
+{
+    if (!dev->busy) {
+        return false;
+    }
+
+    spi_acquire(dev->spi, dev->cs, dev->mode, dev->clk);
+    dev->busy = write_in_progress(dev);
+    spi_release(dev->spi);
+
+    return dev->busy;
+}
+
 static int mtd_spi_nor_power(mtd_dev_t *mtd, enum mtd_power_state power)
 {
     mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
 
     spi_acquire(dev->spi, dev->cs, dev->mode, dev->clk);
+    wait_for_pending(dev);
     switch (power) {
         case MTD_POWER_UP:
             mtd_spi_cmd(dev, dev->opcode->wake);
@@ -18,8 +18,12 @@
  * @}
  */
 
+#include <errno.h>
+
 #include "board.h"
 #include "cpu.h"
+#include "irq.h"
+#include "assert.h"
 #include "periph/i2c.h"
 
 #ifdef I2C_NUMOF
@@ -80,4 +84,136 @@ int i2c_write_regs(i2c_t dev, uint16_t addr, uint16_t reg,
 }
 #endif /* PERIPH_I2C_NEED_WRITE_REGS */
 
+#ifdef MODULE_PERIPH_I2C_ASYNC
+/**
+ * @brief   Transfer queue of a bus
+ */
+typedef struct {
+    i2c_xfer_t *head;       /**< transfer in progress */
+    i2c_xfer_t *tail;       /**< last queued transfer */
+    uint8_t busy;           /**< the queue owns the bus */
+} _xfer_queue_t;
+
+static _xfer_queue_t _queues[I2C_NUMOF];
+
+#ifndef PERIPH_I2C_HAVE_ASYNC
+static int _xfer_blocking(i2c_t dev, const i2c_xfer_t *xfer)
+{
+    switch (xfer->op) {
+        case I2C_XFER_READ_BYTES:
+            return i2c_read_bytes(dev, xfer->addr, xfer->data, xfer->len,
+                                  xfer->flags);
+        case I2C_XFER_READ_REGS:
+            return i2c_read_regs(dev, xfer->addr, xfer->reg, xfer->data,
+                                 xfer->len, xfer->flags);
+        case I2C_XFER_WRITE_BYTES:
+            return i2c_write_bytes(dev, xfer->addr, xfer->data, xfer->len,
+                                   xfer->flags);
+        case I2C_XFER_WRITE_REGS:
+            return i2c_write_regs(dev, xfer->addr, xfer->reg, xfer->data,
+                                  xfer->len, xfer->flags);
+        default:
+            return -EINVAL;
+    }
+}
+#endif /* PERIPH_I2C_HAVE_ASYNC */
+
+/**
+ * @brief   Remove the finished head of the queue and call its callback
+ *
+ * @return  1 if more transfers are queued
+ * @return  0 if the queue ran empty, the bus was released then
+ */
+static int _xfer_complete(i2c_t dev, int res)
+{
+    _xfer_queue_t *queue = &_queues[dev];
+    i2c_xfer_t *xfer = queue->head;
+
+    unsigned state = irq_disable();
+    queue->head = xfer->next;
+    if (queue->head == NULL) {
+        queue->tail = NULL;
+    }
+    irq_restore(state);
+
+    /* the queue stays busy while the callback runs, so transfers submitted
+     * from the callback are simply appended */
+    if (xfer->cb) {
+        xfer->cb(xfer->arg, res);
+    }
+
+    state = irq_disable();
+    if (queue->head) {
+        irq_restore(state);
+        return 1;
+    }
+    queue->busy = 0;
+    irq_restore(state);
+    i2c_release(dev);
+    return 0;
+}
+
+static void _xfer_process(i2c_t dev)
+{
+    do {
+#ifdef PERIPH_I2C_HAVE_ASYNC
+        int res = i2c_xfer_start(dev, _queues[dev].head);
+        if (res == 0) {
+            /* the CPU calls i2c_xfer_done() when the transfer is finished */
+            return;
+        }
+#else
+        int res = _xfer_blocking(dev, _queues[dev].head);
+#endif
+        if (!_xfer_complete(dev, res)) {
+            return;
+        }
+    } while (1);
+}
+
+int i2c_xfer_submit(i2c_t dev, i2c_xfer_t *list)
+{
+    assert((dev < I2C_NUMOF) && list);
+
+    _xfer_queue_t *queue = &_queues[dev];
+    i2c_xfer_t *last = list;
+
+    for (i2c_xfer_t *xfer = list; xfer; xfer = xfer->next) {
+        if (xfer->flags & (I2C_NOSTOP | I2C_NOSTART)) {
+            return -EINVAL;
+        }
+        last = xfer;
+    }
+
+    unsigned state = irq_disable();
+    uint8_t idle = !queue->busy;
+    if (queue->tail) {
+        queue->tail->next = list;
+    }
+    else {
+        queue->head = list;
+    }
+    queue->tail = last;
+    queue->busy = 1;
+    irq_restore(state);
+
+    if (idle) {
+        /* only a callback of a busy queue may submit from interrupt context */
+        assert(!irq_is_in());
+        i2c_acquire(dev);
+        _xfer_process(dev);
+    }
+    return 0;
+}
+
+#ifdef PERIPH_I2C_HAVE_ASYNC
+void i2c_xfer_done(i2c_t dev, int res)
+{
+    if (_xfer_complete(dev, res)) {
+        _xfer_process(dev);
+    }
+}
+#endif /* PERIPH_I2C_HAVE_ASYNC */
+#endif /* MODULE_PERIPH_I2C_ASYNC */
+
 #endif /* I2C_NUMOF */
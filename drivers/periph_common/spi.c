@@ -19,6 +19,7 @@
  *
  * @}
  */
+#include <assert.h>
 #include <stddef.h>
 
 #include "board.h"
@@ -70,4 +71,27 @@ void spi_transfer_regs(spi_t bus, spi_cs_t cs,
 }
 #endif
 
+#ifndef PERIPH_SPI_HAS_TRANSFER_IOLIST
+void spi_transfer_iolist(spi_t bus, spi_cs_t cs, bool cont,
+                         const iolist_t *iolist)
+{
+    assert(iolist != NULL);
+
+    while (iolist) {
+        const iolist_t *next = iolist->iol_next;
+
+        /* skip empty elements, so the chip select is released with the last
+         * byte transferred */
+        while (next && (next->iol_len == 0)) {
+            next = next->iol_next;
+        }
+        if (iolist->iol_len > 0) {
+            spi_transfer_bytes(bus, cs, cont || (next != NULL),
+                               iolist->iol_base, NULL, iolist->iol_len);
+        }
+        iolist = next;
+    }
+}
+#endif
+
 #endif /* SPI_NUMOF */
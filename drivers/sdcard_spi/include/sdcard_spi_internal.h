@@ -97,6 +97,8 @@ extern "C" {
 #define SD_CMD_17 17 /* Reads a block of the size selected by the SET_BLOCKLEN command */
 #define SD_CMD_18 18 /* Continuously transfers data blocks from card to host
                         until interrupted by a STOP_TRANSMISSION command */
+#define SD_CMD_23 23 /* Sent as ACMD23 sets the number of blocks to pre-erase before
+                        a multiple block write */
 #define SD_CMD_24 24 /* Writes a block of the size selected by the SET_BLOCKLEN command */
 #define SD_CMD_25 25 /* Continuously writes blocks of data until 'Stop Tran'token is sent */
 #define SD_CMD_41 41 /* Reserved (used for ACMD41) */
@@ -149,6 +151,11 @@ extern "C" {
 
 #define SD_CARD_DUMMY_BYTE 0xFF
 
+/* number of dummy bytes clocked out per SPI transfer while receiving data */
+#ifndef SD_CARD_DUMMY_CHUNK_SIZE
+#define SD_CARD_DUMMY_CHUNK_SIZE 64
+#endif
+
 #define SDCARD_SPI_IEC_KIBI (1024L)
 #define SDCARD_SPI_SI_KILO  (1000L)
 
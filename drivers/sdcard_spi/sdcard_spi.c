@@ -567,6 +567,27 @@ static inline int _transfer_bytes(sdcard_spi_t *card, const char *out, char *in,
     unsigned trans_bytes = 0;
     char in_temp;
 
+    if (_dyn_spi_rxtx_byte == &_hw_spi_rxtx_byte) {
+        /* let the SPI driver move the whole buffer */
+        if (out != NULL) {
+            spi_transfer_bytes(card->params.spi_dev, GPIO_UNDEF, true, out, in, length);
+            return length;
+        }
+        /* the card expects MOSI to stay high while it sends data */
+        char dummy[SD_CARD_DUMMY_CHUNK_SIZE];
+        memset(dummy, SD_CARD_DUMMY_BYTE, sizeof(dummy));
+        while (trans_bytes < length) {
+            unsigned chunk = length - trans_bytes;
+            if (chunk > sizeof(dummy)) {
+                chunk = sizeof(dummy);
+            }
+            spi_transfer_bytes(card->params.spi_dev, GPIO_UNDEF, true, dummy,
+                               (in != NULL) ? &in[trans_bytes] : NULL, chunk);
+            trans_bytes += chunk;
+        }
+        return trans_bytes;
+    }
+
     for (trans_bytes = 0; trans_bytes < length; trans_bytes++) {
         if (out != NULL) {
             trans_ret = _dyn_spi_rxtx_byte(card, out[trans_bytes], &in_temp);
@@ -751,6 +772,13 @@ static inline int _write_blocks(sdcard_spi_t *card, char cmd_idx, int bladdr, co
     int written = 0;
 
     uint32_t addr = card->use_block_addr ? bladdr : (bladdr * SD_HC_BLOCK_SIZE);
+
+    if (cmd_idx == SD_CMD_25) {
+        /* let the card pre-erase the blocks, this is only a hint so errors
+           are ignored */
+        sdcard_spi_send_acmd(card, SD_CMD_23, nbl, 0);
+    }
+
     char cmd_r1_resu = sdcard_spi_send_cmd(card, cmd_idx, addr, SD_BLOCK_WRITE_CMD_RETRIES);
 
     if (R1_VALID(cmd_r1_resu) && !R1_ERROR(cmd_r1_resu)) {
@@ -792,9 +820,11 @@ static inline int _write_blocks(sdcard_spi_t *card, char cmd_idx, int bladdr, co
                state */
             _send_dummy_byte(card);
             if (!_wait_for_not_busy(card, SD_WAIT_FOR_NOT_BUSY_CNT)) {
-                _unselect_card_spi(card);
                 *state = SD_RW_TIMEOUT;
             }
+            else {
+                *state = SD_RW_OK;
+            }
         }
         else {
             DEBUG("_write_blocks: write single block: [OK]\n");
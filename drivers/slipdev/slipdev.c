@@ -17,6 +17,7 @@
 #include <string.h>
 
 #include "log.h"
+#include "memscan.h"
 #include "slipdev.h"
 
 #define ENABLE_DEBUG    (0)
@@ -37,16 +38,42 @@ static void _slip_rx_cb(void *arg, uint8_t byte)
     }
 }
 
+#ifdef MODULE_PERIPH_UART_DMA
+static void _slip_rx_chunk_cb(void *arg, const uint8_t *data, size_t len)
+{
+    slipdev_t *dev = arg;
+
+    tsrb_add(&dev->inbuf, (const char *)data, len);
+    if (dev->netdev.event_callback == NULL) {
+        return;
+    }
+    /* one event per completed frame, as in byte mode */
+    for (size_t i = 0;
+         (i += memscan2(&data[i], len - i, SLIP_END, SLIP_END)) < len; i++) {
+        dev->netdev.event_callback((netdev_t *)dev, NETDEV_EVENT_ISR);
+    }
+}
+#endif
+
 static int _init(netdev_t *netdev)
 {
     slipdev_t *dev = (slipdev_t *)netdev;
+    int res = UART_NOMODE;
 
     DEBUG("slipdev: initializing device %p on UART %i with baudrate %" PRIu32 "\n",
           (void *)dev, dev->config.uart, dev->config.baudrate);
     /* initialize buffers */
     tsrb_init(&dev->inbuf, dev->rxmem, sizeof(dev->rxmem));
-    if (uart_init(dev->config.uart, dev->config.baudrate, _slip_rx_cb,
-                  dev) != UART_OK) {
+#ifdef MODULE_PERIPH_UART_DMA
+    res = uart_init_dma(dev->config.uart, dev->config.baudrate, dev->rxdma,
+                        sizeof(dev->rxdma), _slip_rx_chunk_cb, dev);
+#endif
+    if (res == UART_NOMODE) {
+        /* no RX DMA for this device, take an interrupt per byte */
+        res = uart_init(dev->config.uart, dev->config.baudrate, _slip_rx_cb,
+                        dev);
+    }
+    if (res != UART_OK) {
         LOG_ERROR("slipdev: error initializing UART %i with baudrate %" PRIu32 "\n",
                   dev->config.uart, dev->config.baudrate);
         return -ENODEV;
@@ -93,73 +120,85 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     slipdev_t *dev = (slipdev_t *)netdev;
-    int res = 0;
+    size_t res = 0;
+    char *data;
+    size_t avail;
 
     (void)info;
     if (buf == NULL) {
-        if (len > 0) {
-            /* remove data */
-            for (; len > 0; len--) {
-                int byte = tsrb_get_one(&dev->inbuf);
-                if ((byte == (int)SLIP_END) || (byte < 0)) {
-                    /* end early if end of packet or ringbuffer is reached;
-                     * len might be larger than the actual packet */
-                    break;
-                }
-            }
-        } else {
+        if (len == 0) {
             /* the user was warned not to use a buffer size > `INT_MAX` ;-) */
-            res = (int)tsrb_avail(&dev->inbuf);
+            return (int)tsrb_avail(&dev->inbuf);
+        }
+        /* remove data up to the end of the packet; len might be larger than
+         * the actual packet */
+        while ((len > 0) &&
+               ((avail = tsrb_peek_region(&dev->inbuf, &data)) > 0)) {
+            size_t n = (avail < len) ? avail : len;
+            size_t end = memscan2(data, n, SLIP_END, SLIP_END);
+
+            if (end < n) {
+                tsrb_drop(&dev->inbuf, end + 1);
+                break;
+            }
+            tsrb_drop(&dev->inbuf, n);
+            len -= n;
         }
+        return 0;
     }
-    else {
-        int byte;
-        uint8_t *ptr = buf;
-
-        do {
-            if ((byte = tsrb_get_one(&dev->inbuf)) < 0) {
-                /* something went wrong, return error */
-                return -EIO;
+
+    uint8_t *ptr = buf;
+
+    /* decode region by region: runs of plain bytes are copied as a whole,
+     * only END and ESC are looked at individually. Bytes beyond len are
+     * counted but discarded up to the end of the packet. */
+    while ((avail = tsrb_peek_region(&dev->inbuf, &data)) > 0) {
+        const uint8_t *in = (const uint8_t *)data;
+        size_t i = 0;
+
+        while (i < avail) {
+            if (dev->inesc) {
+                uint8_t byte = in[i++];
+
+                dev->inesc = 0;
+                if (byte == SLIP_END) {
+                    /* aborted escape sequence ends the packet anyway */
+                    tsrb_drop(&dev->inbuf, i);
+                    return (res > len) ? -ENOBUFS : (int)res;
+                }
+                if (byte == SLIP_END_ESC) {
+                    byte = SLIP_END;
+                }
+                else if (byte == SLIP_ESC_ESC) {
+                    byte = SLIP_ESC;
+                }
+                if (res < len) {
+                    ptr[res] = byte;
+                }
+                res++;
+                continue;
             }
-            switch (byte) {
-                case SLIP_END:
-                    break;
-                case SLIP_ESC:
-                    dev->inesc = 1;
-                    break;
-                case SLIP_END_ESC:
-                    if (dev->inesc) {
-                        *(ptr++) = SLIP_END;
-                        res++;
-                        dev->inesc = 0;
-                        break;
-                    }
-                    /* Intentionally falls through */
-                    /* to default when !dev->inesc */
-                case SLIP_ESC_ESC:
-                    if (dev->inesc) {
-                        *(ptr++) = SLIP_ESC;
-                        res++;
-                        dev->inesc = 0;
-                        break;
-                    }
-                    /* Intentionally falls through */
-                    /* to default when !dev->inesc */
-                default:
-                    *(ptr++) = (uint8_t)byte;
-                    res++;
-                    break;
+
+            size_t run = memscan2(&in[i], avail - i, SLIP_END, SLIP_ESC);
+
+            if ((res + run) <= len) {
+                memcpy(&ptr[res], &in[i], run);
             }
-            if ((unsigned)res > len) {
-                while (byte != SLIP_END) {
-                    /* clear out unreceived packet */
-                    byte = tsrb_get_one(&dev->inbuf);
-                }
-                return -ENOBUFS;
+            res += run;
+            i += run;
+            if (i == avail) {
+                break;
             }
-        } while (byte != SLIP_END);
+            if (in[i++] == SLIP_END) {
+                tsrb_drop(&dev->inbuf, i);
+                return (res > len) ? -ENOBUFS : (int)res;
+            }
+            dev->inesc = 1;
+        }
+        tsrb_drop(&dev->inbuf, i);
     }
-    return res;
+    /* ringbuffer ran empty before the end of the packet */
+    return -EIO;
 }
 
 static void _isr(netdev_t *netdev)
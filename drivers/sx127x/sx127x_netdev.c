@@ -261,6 +261,7 @@ static void _isr(netdev_t *netdev)
 
             case SX127X_RF_LORA_IRQFLAGS_CADDETECTED:
             case SX127X_RF_LORA_IRQFLAGS_CADDONE:
+            case SX127X_RF_LORA_IRQFLAGS_VALIDHEADER:
                 irq = SX127X_IRQ_DIO3;
                 break;
 
@@ -714,6 +715,16 @@ void _on_dio3_irq(void *arg)
         case SX127X_MODEM_FSK:
             break;
         case SX127X_MODEM_LORA:
+            if (dev->settings.state == SX127X_RF_RX_RUNNING) {
+                /* DIO3 is ValidHeader while receiving: the packet is
+                 * coming, so it must not be cut by the RX timeout timer */
+                sx127x_reg_write(dev, SX127X_REG_LR_IRQFLAGS,
+                                 SX127X_RF_LORA_IRQFLAGS_VALIDHEADER);
+                xtimer_remove(&dev->_internal.rx_timeout_timer);
+                netdev->event_callback(netdev, NETDEV_EVENT_RX_STARTED);
+                break;
+            }
+
             /* Clear IRQ */
             sx127x_reg_write(dev, SX127X_REG_LR_IRQFLAGS,
                              SX127X_RF_LORA_IRQFLAGS_CADDETECTED |
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_ws281x
+ * @{
+ *
+ * @file
+ * @brief       Default configuration for WS281x LEDs
+ */
+
+#ifndef WS281X_PARAMS_H
+#define WS281X_PARAMS_H
+
+#include "board.h"
+#include "ws281x.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Set default configuration parameters for the WS281x driver
+ * @{
+ */
+#ifndef WS281X_PARAM_LED_NUMOF
+#define WS281X_PARAM_LED_NUMOF      (8U)
+#endif
+#ifndef WS281X_PARAM_SPI
+#define WS281X_PARAM_SPI            (SPI_DEV(0))
+#endif
+
+#ifndef WS281X_PARAMS
+#define WS281X_PARAMS               { .led_numof = WS281X_PARAM_LED_NUMOF, \
+                                      .spi       = WS281X_PARAM_SPI, \
+                                      .buf       = ws281x_buf }
+#endif
+/**@}*/
+
+#ifndef WS281X_PARAMS_BUF_EXTERN
+/**
+ * @brief   Frame buffer for the default configuration
+ *
+ * Define `WS281X_PARAMS_BUF_EXTERN` when overriding @ref WS281X_PARAMS with
+ * buffers allocated by the application.
+ */
+static uint8_t ws281x_buf[WS281X_BUF_SIZE(WS281X_PARAM_LED_NUMOF)];
+#endif
+
+/**
+ * @brief   WS281x configuration
+ */
+static const ws281x_params_t ws281x_params[] =
+{
+    WS281X_PARAMS
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WS281X_PARAMS_H */
+/** @} */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_ws281x
+ * @{
+ *
+ * @file
+ * @brief       WS281x RGB LED driver implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "assert.h"
+#include "ws281x.h"
+
+#define SYM_0           (0x18)  /* 11000 */
+#define SYM_1           (0x1e)  /* 11110 */
+#define SYM_BITS        (5U)
+
+/* encodes one color byte into five SPI bytes, MSB first */
+static void encode(uint8_t *out, uint8_t val)
+{
+    uint64_t bits = 0;
+
+    for (int i = 7; i >= 0; i--) {
+        bits = (bits << SYM_BITS) | ((val & (1 << i)) ? SYM_1 : SYM_0);
+    }
+    for (int i = 4; i >= 0; i--) {
+        out[i] = (uint8_t)bits;
+        bits >>= 8;
+    }
+}
+
+void ws281x_init(ws281x_t *dev, const ws281x_params_t *params)
+{
+    static const color_rgb_t black = { 0, 0, 0 };
+
+    assert(dev && params && params->buf);
+
+    memcpy(dev, params, sizeof(ws281x_params_t));
+
+    for (unsigned i = 0; i < dev->led_numof; i++) {
+        ws281x_set(dev, i, &black);
+    }
+    memset(&dev->buf[dev->led_numof * WS281X_BYTES_PER_LED], 0,
+           WS281X_RESET_BYTES);
+}
+
+void ws281x_set(const ws281x_t *dev, unsigned index, const color_rgb_t *color)
+{
+    assert(dev && color && (index < dev->led_numof));
+
+    /* the LEDs expect green, red, blue */
+    uint8_t *out = &dev->buf[index * WS281X_BYTES_PER_LED];
+    encode(out, color->g);
+    encode(out + 5, color->r);
+    encode(out + 10, color->b);
+}
+
+void ws281x_write(const ws281x_t *dev)
+{
+    assert(dev);
+
+    iolist_t iol = { .iol_base = dev->buf,
+                     .iol_len = WS281X_BUF_SIZE(dev->led_numof) };
+
+    spi_acquire(dev->spi, SPI_CS_UNDEF, SPI_MODE_0, SPI_CLK_5MHZ);
+    spi_transfer_iolist(dev->spi, SPI_CS_UNDEF, false, &iol);
+    spi_release(dev->spi);
+}
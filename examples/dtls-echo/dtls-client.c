@@ -23,7 +23,9 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 
+#include "net/ipv6/addr.h"
 #include "net/sock/udp.h"
 #include "tinydtls_keys.h"
 
@@ -50,6 +52,15 @@
 
 static int dtls_connected = 0; /* This is handled by Tinydtls callbacks */
 
+/*
+ * The DTLS session is kept open between calls of client_send() as long as the
+ * same server is used, so only the first message needs a handshake.
+ */
+static dtls_context_t *_dtls_context = NULL;
+static sock_udp_t _sock;
+static session_t _dst;
+static char _dst_str[IPV6_ADDR_MAX_STR_LEN + 8];
+
 /* TinyDTLS callback for detecting the state of the DTLS channel. */
 static int _events_handler(struct dtls_context_t *ctx,
                            session_t *session,
@@ -58,9 +69,13 @@ static int _events_handler(struct dtls_context_t *ctx,
 {
     (void) ctx;
     (void) session;
-    (void) level;
 
-    if (code == DTLS_EVENT_CONNECTED) {
+    if ((level == DTLS_ALERT_LEVEL_FATAL) ||
+        (code == DTLS_ALERT_CLOSE_NOTIFY)) {
+        /* the session is gone, the next message starts a new handshake */
+        dtls_connected = 0;
+    }
+    else if (code == DTLS_EVENT_CONNECTED) {
         dtls_connected = 1;
         DEBUG("CLIENT: DTLS Channel established!\n");
     }
@@ -381,26 +396,48 @@ dtls_context_t *_init_dtls(sock_udp_t *sock, sock_udp_ep_t *local,
     return new_context;
 }
 
-static void client_send(char *addr_str, char *data)
+/* Release resources (strict order!) */
+static void _close_session(void)
 {
-    static session_t dst;
-    dtls_context_t *dtls_context = NULL;
+    if (_dtls_context != NULL) {
+        dtls_free_context(_dtls_context); /* This also sends a DTLS Alert record */
+        sock_udp_close(&_sock);
+        _dtls_context = NULL;
+    }
+    dtls_connected = 0;
+    DEBUG("Client DTLS session finished\n");
+}
 
+static int _open_session(char *addr_str)
+{
     sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
     sock_udp_ep_t remote = SOCK_IPV6_EP_ANY;
-    sock_udp_t sock;
 
-    uint8_t watch = MAX_TIMES_TRY_TO_SEND;
-    ssize_t app_data_buf = 0;               /* Upper layer packet to send */
+    /* _init_dtls() splits the interface off addr_str, so copy it first */
+    strncpy(_dst_str, addr_str, sizeof(_dst_str) - 1);
 
     /* NOTE: dtls_init() must be called previous to this (see main.c) */
-
-    dtls_context = _init_dtls(&sock, &local, &remote, &dst, addr_str);
-    if (!dtls_context) {
+    _dtls_context = _init_dtls(&_sock, &local, &remote, &_dst, addr_str);
+    if (!_dtls_context) {
         puts("ERROR: Client unable to load context!");
-        return;
+        return -1;
     }
 
+    /* The sock must be opened with the remote already linked to it */
+    if (sock_udp_create(&_sock, &local, &remote, 0) != 0) {
+        puts("ERROR: Unable to create UDP sock");
+        dtls_free_context(_dtls_context);
+        _dtls_context = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+static void client_send(char *addr_str, char *data)
+{
+    uint8_t watch = MAX_TIMES_TRY_TO_SEND;
+    ssize_t app_data_buf = 0;               /* Upper layer packet to send */
+
     char *client_payload;
     if (strlen(data) > DTLS_MAX_BUF) {
         puts("ERROR: Exceeded max size of DTLS buffer.");
@@ -409,9 +446,11 @@ static void client_send(char *addr_str, char *data)
     client_payload = data;
     app_data_buf = strlen(client_payload);
 
-    /* The sock must be opened with the remote already linked to it */
-    if (sock_udp_create(&sock, &local, &remote, 0) != 0) {
-        puts("ERROR: Unable to create UDP sock");
+    if ((_dtls_context != NULL) && (strcmp(_dst_str, addr_str) != 0)) {
+        /* a different server was given */
+        _close_session();
+    }
+    if ((_dtls_context == NULL) && (_open_session(addr_str) < 0)) {
         return;
     }
 
@@ -420,10 +459,12 @@ static void client_send(char *addr_str, char *data)
      * record.
      *
      * NOTE: If dtls_connect() returns zero, then the DTLS channel for the
-     *      dtls_context is already created (never the case for this example)
+     *      dtls_context is already created and is reused without a new
+     *      handshake.
      */
-    if (dtls_connect(dtls_context, &dst) < 0) {
+    if (dtls_connect(_dtls_context, &_dst) < 0) {
         puts("ERROR: Client unable to start a DTLS channel!\n");
+        _close_session();
         return;
     }
 
@@ -446,7 +487,7 @@ static void client_send(char *addr_str, char *data)
         /*  DTLS Session must be established before sending our data */
         if (dtls_connected) {
             DEBUG("Sending (upper layer) data\n");
-            app_data_buf = try_send(dtls_context, &dst,
+            app_data_buf = try_send(_dtls_context, &_dst,
                                     (uint8 *)client_payload, app_data_buf);
 
             if (app_data_buf == 0) { /* Client only transmit data one time. */
@@ -456,7 +497,7 @@ static void client_send(char *addr_str, char *data)
 
         /* Check if a DTLS record was received */
         /* NOTE: We expect an answer after try_send() */
-        dtls_handle_read(dtls_context);
+        dtls_handle_read(_dtls_context);
         watch--;
     } /* END while */
 
@@ -467,24 +508,23 @@ static void client_send(char *addr_str, char *data)
      * leaving a memory leak of 124 bytes.
      * This can lead to "retransmit buffer full" error.
      *
-     * A temporary solution is to make the dtls_context_t global and be sure
-     * to never release it. Alternatively, never let this part of the code
-     * ends, in a similar approach to the server side.
+     * Hence the context is released whenever no DTLS channel could be
+     * established, and kept for the next message otherwise.
      */
-
-    /* Release resources (strict order!) */
-    dtls_free_context(dtls_context); /* This also sends a DTLS Alert record */
-    sock_udp_close(&sock);
-    dtls_connected = 0;
-    DEBUG("Client DTLS session finished\n");
-
-    return;
+    if (!dtls_connected) {
+        _close_session();
+    }
 }
 
 int udp_client_cmd(int argc, char **argv)
 {
+    if ((argc == 2) && (strcmp(argv[1], "close") == 0)) {
+        _close_session();
+        return 0;
+    }
     if (argc != 3) {
         printf("usage: %s <addr> <data> \n", argv[0]);
+        printf("       %s close\n", argv[0]);
         return 1;
     }
     client_send(argv[1], argv[2]);
@@ -23,6 +23,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include "net/gcoap.h"
+#ifdef MODULE_GNRC_PKTBUF_STATS
+#include "net/gnrc/pktbuf.h"
+#endif
 #include "od.h"
 #include "fmt.h"
 
@@ -33,11 +36,17 @@ static void _resp_handler(unsigned req_state, coap_pkt_t* pdu,
                           sock_udp_ep_t *remote);
 static ssize_t _stats_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len, void *ctx);
 static ssize_t _riot_board_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len, void *ctx);
+#ifdef MODULE_GNRC_PKTBUF_STATS
+static ssize_t _riot_pktbuf_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len, void *ctx);
+#endif
 
 /* CoAP resources */
 static const coap_resource_t _resources[] = {
     { "/cli/stats", COAP_GET | COAP_PUT, _stats_handler, NULL },
     { "/riot/board", COAP_GET, _riot_board_handler, NULL },
+#ifdef MODULE_GNRC_PKTBUF_STATS
+    { "/riot/pktbuf", COAP_GET, _riot_pktbuf_handler, NULL },
+#endif
 };
 
 static gcoap_listener_t _listener = {
@@ -141,6 +150,29 @@ static ssize_t _riot_board_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len, vo
     return gcoap_finish(pdu, strlen(RIOT_BOARD), COAP_FORMAT_TEXT);
 }
 
+#ifdef MODULE_GNRC_PKTBUF_STATS
+/*
+ * Packet buffer telemetry as comma separated values: bytes used, high-water
+ * mark, largest free chunk, number of free chunks, allocation failures.
+ */
+static ssize_t _riot_pktbuf_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len, void *ctx)
+{
+    (void)ctx;
+    gnrc_pktbuf_stats_t stats;
+
+    gnrc_pktbuf_get_stats(&stats);
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    int res = snprintf((char *)pdu->payload, pdu->payload_len,
+                       "%u,%u,%u,%u,%lu", (unsigned)stats.used,
+                       (unsigned)stats.max_used, (unsigned)stats.free_largest,
+                       stats.free_chunks, (unsigned long)stats.alloc_fails);
+    if ((res < 0) || ((size_t)res >= pdu->payload_len)) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_INTERNAL_SERVER_ERROR);
+    }
+    return gcoap_finish(pdu, res, COAP_FORMAT_TEXT);
+}
+#endif
+
 static size_t _send(uint8_t *buf, size_t len, char *addr_str, char *port_str)
 {
     ipv6_addr_t addr;
@@ -48,8 +48,10 @@ int main(void)
     skald_eddystone_uid_t uid = { URI_NAMESPACE, URI_INSTANCE };
     skald_eddystone_uid_adv(&_ctx_uid, &uid, TX_PWR);
 
-    /* also advertise the defined short-URL */
+    /* also advertise the defined short-URL, in the same advertising events
+     * as the URI */
     skald_eddystone_url_adv(&_ctx_url, EDDYSTONE_URL_HTTPS, URL, TX_PWR);
+    skald_adv_add(&_ctx_uid, &_ctx_url);
 
     return 0;
 }
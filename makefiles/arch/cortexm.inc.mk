@@ -64,9 +64,9 @@ export CFLAGS += -DCPU_ARCH_$(ARCH)
 
 # set the compiler specific CPU and FPU options
 ifeq ($(CPU_ARCH),cortex-m4f)
-# TODO: enable hard floating points for the M4F once the context save/restore
-#       code is adjusted to take care of FPU registers
-#export CFLAGS_FPU += -mfloat-abi=hard -mfpu=fpv4-sp-d16
+# the context switch saves the FPU registers of threads using the FPU, so
+# hard floating point can be enabled with
+# CFLAGS_FPU="-mfloat-abi=hard -mfpu=fpv4-sp-d16"
 export MCPU := cortex-m4
 endif
 CFLAGS_FPU ?= -mfloat-abi=soft
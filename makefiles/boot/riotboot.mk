@@ -25,6 +25,9 @@ export SLOT0_OFFSET ?= $(RIOTBOOT_LEN)
 # Mandatory APP_VER, set to 0 by default
 APP_VER ?= 0
 
+# Set to 1 to let the bootloader check the image digest before booting
+RIOTBOOT_VERIFY ?= 0
+
 # Final target for slot 0 with riot_hdr
 SLOT0_RIOT_BIN = $(BINDIR_APP)-slot0.riot.bin
 
@@ -69,7 +72,7 @@ riotboot/flash-bootloader: riotboot/bootloader/flash
 riotboot/bootloader/%:
 	$(Q)/usr/bin/env -i \
 		QUIET=$(QUIET)\
-		PATH=$(PATH) BOARD=$(BOARD) \
+		PATH=$(PATH) BOARD=$(BOARD) RIOTBOOT_VERIFY=$(RIOTBOOT_VERIFY) \
 			$(MAKE) --no-print-directory -C $(RIOTBOOT_DIR) $*
 
 # Generate a binary file from the bootloader which fills all the
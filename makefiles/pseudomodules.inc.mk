@@ -1,5 +1,7 @@
 PSEUDOMODULES += at_urc
+PSEUDOMODULES += auto_init_deferred
 PSEUDOMODULES += auto_init_gnrc_rpl
+PSEUDOMODULES += can_fd
 PSEUDOMODULES += can_mbox
 PSEUDOMODULES += can_pm
 PSEUDOMODULES += can_raw
@@ -11,6 +13,9 @@ PSEUDOMODULES += core_%
 PSEUDOMODULES += ecc_%
 PSEUDOMODULES += emb6_router
 PSEUDOMODULES += event_%
+PSEUDOMODULES += evtimer_heap
+PSEUDOMODULES += fib_route_cache
+PSEUDOMODULES += gcoap_cocoa
 PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
@@ -19,18 +24,30 @@ PSEUDOMODULES += gnrc_ipv6_nib_6ln
 PSEUDOMODULES += gnrc_ipv6_nib_6lr
 PSEUDOMODULES += gnrc_ipv6_nib_dns
 PSEUDOMODULES += gnrc_ipv6_nib_router
+PSEUDOMODULES += gnrc_ipv6_rxq
 PSEUDOMODULES += gnrc_netdev_default
 PSEUDOMODULES += gnrc_neterr
+PSEUDOMODULES += gnrc_netapi_batch
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
+PSEUDOMODULES += gnrc_netif_ieee802154_burst
+PSEUDOMODULES += gnrc_netif_ieee802154_mhr
+PSEUDOMODULES += gnrc_netif_ipv6_cache
+PSEUDOMODULES += gnrc_netif_txq
+PSEUDOMODULES += gnrc_netreg_hash
 PSEUDOMODULES += gnrc_pktbuf_cmd
+PSEUDOMODULES += gnrc_pktbuf_stats
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
+PSEUDOMODULES += gnrc_sixlowpan_frag_stats
+PSEUDOMODULES += gnrc_sixlowpan_iphc_cache
+PSEUDOMODULES += gnrc_sixlowpan_iphc_fwd
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_check_reuse
+PSEUDOMODULES += gnrc_tcp_event
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += l2filter_blacklist
 PSEUDOMODULES += l2filter_whitelist
@@ -38,8 +55,12 @@ PSEUDOMODULES += lis2dh12_spi
 PSEUDOMODULES += log
 PSEUDOMODULES += log_printfnoformat
 PSEUDOMODULES += lora
+PSEUDOMODULES += malloc_thread_cache_stats
+PSEUDOMODULES += memarray_stats
 PSEUDOMODULES += mpu_stack_guard
 PSEUDOMODULES += nanocoap_%
+PSEUDOMODULES += native_vtime
+PSEUDOMODULES += netcap_uart
 PSEUDOMODULES += netdev_default
 PSEUDOMODULES += netif
 PSEUDOMODULES += netstats
@@ -52,6 +73,8 @@ PSEUDOMODULES += newlib_gnu_source
 PSEUDOMODULES += newlib_nano
 PSEUDOMODULES += openthread
 PSEUDOMODULES += pktqueue
+PSEUDOMODULES += pm_layered_stats
+PSEUDOMODULES += posix_poll
 PSEUDOMODULES += printf_float
 PSEUDOMODULES += prng
 PSEUDOMODULES += prng_%
@@ -59,15 +82,30 @@ PSEUDOMODULES += riotboot_%
 PSEUDOMODULES += saul_adc
 PSEUDOMODULES += saul_default
 PSEUDOMODULES += saul_gpio
+PSEUDOMODULES += saul_reg_cache
+PSEUDOMODULES += saul_reg_index
+PSEUDOMODULES += schedlatency
+PSEUDOMODULES += schedstack
 PSEUDOMODULES += schedstatistics
+PSEUDOMODULES += semtech_loramac_queue
+PSEUDOMODULES += shell_buffered
+PSEUDOMODULES += shell_tlv
+PSEUDOMODULES += sntp_discipline
 PSEUDOMODULES += sock
+PSEUDOMODULES += sock_async
+PSEUDOMODULES += sock_dns_cache
 PSEUDOMODULES += sock_ip
 PSEUDOMODULES += sock_tcp
 PSEUDOMODULES += sock_udp
+PSEUDOMODULES += stdio_uart_async
+PSEUDOMODULES += xtimer_heap
 
 # print ascii representation in function od_hex_dump()
 PSEUDOMODULES += od_string
 
+# SPI variant of the APA102 driver
+PSEUDOMODULES += apa102_spi
+
 # include variants of the AT86RF2xx drivers as pseudo modules
 PSEUDOMODULES += at86rf23%
 PSEUDOMODULES += at86rf21%
@@ -135,5 +173,7 @@ PSEUDOMODULES += ds18_optimized
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# This pseudomodule causes the rounds of SHA256 to be unrolled (more flash, less CPU)
+PSEUDOMODULES += hashes_sha256_unroll
 
 # Packages may also add modules to PSEUDOMODULES in their `Makefile.include`.
@@ -122,9 +122,9 @@ static int _dev_erase(const struct lfs_config *c, lfs_block_t block)
 
 static int _dev_sync(const struct lfs_config *c)
 {
-    (void)c;
+    littlefs_desc_t *fs = c->context;
 
-    return 0;
+    return mtd_flush(fs->dev);
 }
 
 static int prepare(littlefs_desc_t *fs)
@@ -164,6 +164,7 @@ NORETURN static int _jump_back(lua_State *L)
 }
 
 static int lua_riot_do_module_or_buf(const uint8_t *buf, size_t buflen,
+                                     const char *mode,
                                      const char *modname, void *memory, size_t mem_size,
                                      uint16_t modmask, int *retval)
 {
@@ -205,7 +206,7 @@ static int lua_riot_do_module_or_buf(const uint8_t *buf, size_t buflen,
     }
     else {
         compilation_result = luaL_loadbufferx(L, (const char *)buf,
-                                              buflen, modname, "t");
+                                              buflen, modname, mode);
     }
 
     switch (compilation_result) {
@@ -261,15 +262,23 @@ lua_riot_do_error:
 LUALIB_API int lua_riot_do_module(const char *modname, void *memory, size_t mem_size,
                                   uint16_t modmask, int *retval)
 {
-    return lua_riot_do_module_or_buf(NULL, 0, modname, memory, mem_size, modmask,
-                                     retval);
+    return lua_riot_do_module_or_buf(NULL, 0, NULL, modname, memory, mem_size,
+                                     modmask, retval);
 }
 
 LUALIB_API int lua_riot_do_buffer(const uint8_t *buf, size_t buflen, void *memory,
                                   size_t mem_size, uint16_t modmask, int *retval)
 {
-    return lua_riot_do_module_or_buf(buf, buflen, "=BUFFER", memory, mem_size,
-                                     modmask, retval);
+    return lua_riot_do_module_or_buf(buf, buflen, "t", "=BUFFER", memory,
+                                     mem_size, modmask, retval);
+}
+
+LUALIB_API int lua_riot_do_bytecode(const uint8_t *buf, size_t buflen,
+                                    void *memory, size_t mem_size,
+                                    uint16_t modmask, int *retval)
+{
+    return lua_riot_do_module_or_buf(buf, buflen, "b", "=BYTECODE", memory,
+                                     mem_size, modmask, retval);
 }
 
 #define MAX_ERR_STRING ((sizeof(lua_riot_str_errors) / sizeof(*lua_riot_str_errors)) - 1)
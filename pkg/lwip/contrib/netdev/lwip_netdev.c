@@ -235,7 +235,7 @@ static err_t _ieee802154_link_output(struct netif *netif, struct pbuf *p)
 
 static struct pbuf *_get_recv_pkt(netdev_t *dev)
 {
-    int len = dev->driver->recv(dev, _tmp_buf, sizeof(_tmp_buf), NULL);
+    int len = dev->driver->recv(dev, NULL, 0, NULL);
 
     if (len < 0) {
         DEBUG("lwip_netdev: an error occurred while reading the packet\n");
@@ -246,9 +246,28 @@ static struct pbuf *_get_recv_pkt(netdev_t *dev)
 
     if (p == NULL) {
         DEBUG("lwip_netdev: can not allocate in pbuf\n");
+        /* drop the frame, so the device can receive the next one */
+        dev->driver->recv(dev, NULL, len, NULL);
         return NULL;
     }
-    pbuf_take(p, _tmp_buf, len);
+    if (p->next == NULL) {
+        /* fits into a single pbuf: let the driver copy it there directly */
+        len = dev->driver->recv(dev, p->payload, p->len, NULL);
+    }
+    else {
+        len = dev->driver->recv(dev, _tmp_buf, sizeof(_tmp_buf), NULL);
+        if (len > 0) {
+            pbuf_take(p, _tmp_buf, len);
+        }
+    }
+    if (len < 0) {
+        DEBUG("lwip_netdev: an error occurred while reading the packet\n");
+        pbuf_free(p);
+        return NULL;
+    }
+    if (len < p->tot_len) {
+        pbuf_realloc(p, (u16_t)len);
+    }
     return p;
 }
 
@@ -276,6 +295,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 }
                 if (netif->input(p, netif) != ERR_OK) {
                     DEBUG("lwip_netdev: error inputing packet\n");
+                    pbuf_free(p);
                     return;
                 }
             }
@@ -19,6 +19,9 @@
 #include "net/ipv6/addr.h"
 #include "net/ipv6/hdr.h"
 #include "net/sock/ip.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async.h"
+#endif
 #include "timex.h"
 
 #include "lwip/api.h"
@@ -43,6 +46,9 @@ int sock_ip_create(sock_ip_t *sock, const sock_ip_ep_t *local,
                                 (struct _sock_tl_ep *)remote, proto, flags,
                                 NETCONN_RAW)) == 0) {
         sock->conn = tmp;
+#ifdef MODULE_SOCK_ASYNC
+        sock->async.cb.generic = NULL;
+#endif
     }
     return res;
 }
@@ -51,6 +57,9 @@ void sock_ip_close(sock_ip_t *sock)
 {
     assert(sock != NULL);
     if (sock->conn != NULL) {
+#ifdef MODULE_SOCK_ASYNC
+        lwip_sock_async_remove(&sock->async);
+#endif
         netconn_delete(sock->conn);
         sock->conn = NULL;
     }
@@ -174,8 +183,35 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
 {
     assert((sock != NULL) || (remote != NULL));
     assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+#ifdef MODULE_SOCK_ASYNC
+    ssize_t res = lwip_sock_send(&sock->conn, data, len, proto,
+                                 (struct _sock_tl_ep *)remote, NETCONN_RAW);
+
+    if ((res >= 0) && (sock != NULL) && (sock->async.cb.ip != NULL)) {
+        sock->async.cb.ip(sock, SOCK_ASYNC_MSG_SENT, sock->async.cb_arg);
+    }
+    return res;
+#else
     return lwip_sock_send(&sock->conn, data, len, proto,
                           (struct _sock_tl_ep *)remote, NETCONN_RAW);
+#endif
 }
 
+#ifdef MODULE_SOCK_ASYNC
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *cb_arg)
+{
+    assert(sock != NULL);
+    lwip_sock_async_set(&sock->async, sock, &sock->conn,
+                        (lwip_sock_async_cb_t)cb, cb_arg);
+}
+
+#ifdef MODULE_SOCK_ASYNC_EVENT
+sock_async_ctx_t *sock_ip_get_async_ctx(sock_ip_t *sock)
+{
+    assert(sock != NULL);
+    return &sock->async.async_ctx;
+}
+#endif
+#endif
+
 /** @} */
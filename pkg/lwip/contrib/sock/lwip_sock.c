@@ -15,6 +15,7 @@
 
 #include "lwip/sock_internal.h"
 
+#include "mutex.h"
 #include "net/af.h"
 #include "net/ipv4/addr.h"
 #include "net/ipv6/addr.h"
@@ -255,9 +256,73 @@ static int _sock_ep_to_netconn_pars(const struct _sock_tl_ep *local,
     return res;
 }
 
+#ifdef MODULE_SOCK_ASYNC
+static mutex_t _async_lock = MUTEX_INIT;
+static lwip_sock_async_t *_async_socks = NULL;
+
+/* called by lwIP from the tcpip thread */
+static void _netconn_cb(struct netconn *conn, enum netconn_evt evt, u16_t len)
+{
+    (void)len;
+    if (evt != NETCONN_EVT_RCVPLUS) {
+        return;
+    }
+    mutex_lock(&_async_lock);
+    for (lwip_sock_async_t *async = _async_socks; async != NULL;
+         async = async->next) {
+        if (*async->conn == conn) {
+            if (async->cb.generic != NULL) {
+                async->cb.generic(async->sock, SOCK_ASYNC_MSG_RECV,
+                                  async->cb_arg);
+            }
+            break;
+        }
+    }
+    mutex_unlock(&_async_lock);
+}
+
+void lwip_sock_async_set(lwip_sock_async_t *async, void *sock,
+                         struct netconn **conn, lwip_sock_async_cb_t cb,
+                         void *cb_arg)
+{
+    lwip_sock_async_t *ptr;
+
+    mutex_lock(&_async_lock);
+    for (ptr = _async_socks; (ptr != NULL) && (ptr != async); ptr = ptr->next) {}
+    if (ptr == NULL) {
+        async->next = _async_socks;
+        _async_socks = async;
+    }
+    async->sock = sock;
+    async->conn = conn;
+    async->cb.generic = cb;
+    async->cb_arg = cb_arg;
+    mutex_unlock(&_async_lock);
+}
+
+void lwip_sock_async_remove(lwip_sock_async_t *async)
+{
+    mutex_lock(&_async_lock);
+    for (lwip_sock_async_t **ptr = &_async_socks; *ptr != NULL;
+         ptr = &(*ptr)->next) {
+        if (*ptr == async) {
+            *ptr = async->next;
+            break;
+        }
+    }
+    mutex_unlock(&_async_lock);
+}
+#endif
+
 static int _create(int type, int proto, uint16_t flags, struct netconn **out)
 {
-    if ((*out = netconn_new_with_proto_and_callback(type, proto, NULL)) == NULL) {
+#ifdef MODULE_SOCK_ASYNC
+    netconn_callback callback = _netconn_cb;
+#else
+    netconn_callback callback = NULL;
+#endif
+
+    if ((*out = netconn_new_with_proto_and_callback(type, proto, callback)) == NULL) {
         return -ENOMEM;
     }
 #if LWIP_IPV4 && LWIP_IPV6
@@ -101,6 +101,11 @@ void sock_tcp_disconnect(sock_tcp_t *sock)
 {
     assert(sock != NULL);
     mutex_lock(&sock->mutex);
+    if (sock->last_buf != NULL) {
+        pbuf_free(sock->last_buf);
+        sock->last_buf = NULL;
+        sock->last_offset = 0;
+    }
     if (sock->conn != NULL) {
         netconn_close(sock->conn);
         netconn_delete(sock->conn);
@@ -250,6 +255,39 @@ int sock_tcp_accept(sock_tcp_queue_t *queue, sock_tcp_t **sock,
     return res;
 }
 
+static int _recv_err(err_t err)
+{
+    switch (err) {
+        case ERR_ABRT:
+            return -ECONNABORTED;
+        case ERR_CONN:
+            return -EADDRNOTAVAIL;
+        case ERR_RST:
+        case ERR_CLSD:
+            return -ECONNRESET;
+        case ERR_MEM:
+            return -ENOMEM;
+#if LWIP_SO_RCVTIMEO
+        case ERR_TIMEOUT:
+            return -ETIMEDOUT;
+#endif
+        default:
+            /* no applicable error */
+            return -1;
+    }
+}
+
+static void _release_lent_buf(sock_tcp_t *sock)
+{
+    /* sock_tcp_read_buf() keeps a fully lent pbuf until the next call */
+    if ((sock->last_buf != NULL) &&
+        (sock->last_offset >= sock->last_buf->tot_len)) {
+        pbuf_free(sock->last_buf);
+        sock->last_buf = NULL;
+        sock->last_offset = 0;
+    }
+}
+
 ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
                       uint32_t timeout)
 {
@@ -280,6 +318,7 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
         mutex_unlock(&sock->mutex);
         return -EAGAIN;
     }
+    _release_lent_buf(sock);
     while (!done) {
         uint16_t copylen, buf_len;
         if (sock->last_buf != NULL) {
@@ -288,30 +327,7 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
         else {
             err_t err;
             if ((err = netconn_recv_tcp_pbuf(sock->conn, &buf)) < 0) {
-                switch (err) {
-                    case ERR_ABRT:
-                        res = -ECONNABORTED;
-                        break;
-                    case ERR_CONN:
-                        res = -EADDRNOTAVAIL;
-                        break;
-                    case ERR_RST:
-                    case ERR_CLSD:
-                        res = -ECONNRESET;
-                        break;
-                    case ERR_MEM:
-                        res = -ENOMEM;
-                        break;
-#if LWIP_SO_RCVTIMEO
-                    case ERR_TIMEOUT:
-                        res = -ETIMEDOUT;
-                        break;
-#endif
-                    default:
-                        /* no applicable error */
-                        res = -1;
-                        break;
-                }
+                res = _recv_err(err);
                 break;
             }
             sock->last_buf = buf;
@@ -329,7 +345,7 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
         if (buf_len > copylen) {
             /* there is still data in the buffer */
             sock->last_buf = buf;
-            sock->last_offset = copylen;
+            sock->last_offset += copylen;
         }
         else {
             sock->last_buf = NULL;
@@ -350,6 +366,60 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
     return res;
 }
 
+ssize_t sock_tcp_read_buf(sock_tcp_t *sock, void **data, uint32_t timeout)
+{
+    struct pbuf *buf;
+    uint16_t offset;
+    ssize_t res;
+
+    assert((sock != NULL) && (data != NULL));
+    if (sock->conn == NULL) {
+        return -ENOTCONN;
+    }
+    if (timeout == 0) {
+        if (!mutex_trylock(&sock->mutex)) {
+            return -EAGAIN;
+        }
+    }
+    else {
+        mutex_lock(&sock->mutex);
+    }
+    _release_lent_buf(sock);
+    if (sock->last_buf == NULL) {
+        err_t err;
+#if LWIP_SO_RCVTIMEO
+        if ((timeout != 0) && (timeout != SOCK_NO_TIMEOUT)) {
+            netconn_set_recvtimeout(sock->conn, timeout / US_PER_MS);
+        }
+        else
+#endif
+        if ((timeout == 0) && !cib_avail(&sock->conn->recvmbox.mbox.cib)) {
+            mutex_unlock(&sock->mutex);
+            return -EAGAIN;
+        }
+        err = netconn_recv_tcp_pbuf(sock->conn, &buf);
+#if LWIP_SO_RCVTIMEO
+        netconn_set_recvtimeout(sock->conn, 0);
+#endif
+        if (err < 0) {
+            mutex_unlock(&sock->mutex);
+            return _recv_err(err);
+        }
+        sock->last_buf = buf;
+        sock->last_offset = 0;
+    }
+    /* lend the segment of the pbuf chain the read position is in */
+    offset = sock->last_offset;
+    for (buf = sock->last_buf; offset >= buf->len; buf = buf->next) {
+        offset -= buf->len;
+    }
+    *data = (uint8_t *)buf->payload + offset;
+    res = buf->len - offset;
+    sock->last_offset += res;
+    mutex_unlock(&sock->mutex);
+    return res;
+}
+
 ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
 {
     struct netconn *conn;
@@ -18,6 +18,9 @@
 #include "net/ipv4/addr.h"
 #include "net/ipv6/addr.h"
 #include "net/sock/udp.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async.h"
+#endif
 #include "timex.h"
 
 #include "lwip/api.h"
@@ -38,6 +41,9 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
                                 (struct _sock_tl_ep *)remote, 0, flags,
                                 NETCONN_UDP)) == 0) {
         sock->conn = tmp;
+#ifdef MODULE_SOCK_ASYNC
+        sock->async.cb.generic = NULL;
+#endif
     }
     return res;
 }
@@ -46,6 +52,9 @@ void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
     if (sock->conn != NULL) {
+#ifdef MODULE_SOCK_ASYNC
+        lwip_sock_async_remove(&sock->async);
+#endif
         netconn_delete(sock->conn);
         sock->conn = NULL;
     }
@@ -65,6 +74,44 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *ep)
                                0)) ? -ENOTCONN : 0;
 }
 
+/**
+ * @brief   Converts the remote end point of a received netbuf
+ *
+ * @return  0 on success.
+ * @return  -EPROTO, if the address family of @p sock is not supported.
+ */
+static int _get_remote(sock_udp_t *sock, struct netbuf *buf,
+                       sock_udp_ep_t *remote)
+{
+    size_t addr_len;
+#if LWIP_IPV6
+    if (sock->conn->type & NETCONN_TYPE_IPV6) {
+        addr_len = sizeof(ipv6_addr_t);
+        remote->family = AF_INET6;
+    }
+    else {
+#endif
+#if LWIP_IPV4
+        addr_len = sizeof(ipv4_addr_t);
+        remote->family = AF_INET;
+#else
+        (void)sock;
+        return -EPROTO;
+#endif
+#if LWIP_IPV6
+    }
+#endif
+#if LWIP_NETBUF_RECVINFO
+    remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
+#else
+    remote->netif = SOCK_ADDR_ANY_NETIF;
+#endif
+    /* copy address */
+    memcpy(&remote->addr, &buf->addr, addr_len);
+    remote->port = buf->port;
+    return 0;
+}
+
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote)
 {
@@ -81,34 +128,9 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
         netbuf_delete(buf);
         return -ENOBUFS;
     }
-    if (remote != NULL) {
-        /* convert remote */
-        size_t addr_len;
-#if LWIP_IPV6
-        if (sock->conn->type & NETCONN_TYPE_IPV6) {
-            addr_len = sizeof(ipv6_addr_t);
-            remote->family = AF_INET6;
-        }
-        else {
-#endif
-#if LWIP_IPV4
-            addr_len = sizeof(ipv4_addr_t);
-            remote->family = AF_INET;
-#else
-            netbuf_delete(buf);
-            return -EPROTO;
-#endif
-#if LWIP_IPV6
-        }
-#endif
-#if LWIP_NETBUF_RECVINFO
-        remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
-#else
-        remote->netif = SOCK_ADDR_ANY_NETIF;
-#endif
-        /* copy address */
-        memcpy(&remote->addr, &buf->addr, addr_len);
-        remote->port = buf->port;
+    if ((remote != NULL) && (_get_remote(sock, buf, remote) < 0)) {
+        netbuf_delete(buf);
+        return -EPROTO;
     }
     /* copy data */
     for (struct pbuf *q = buf->p; q != NULL; q = q->next) {
@@ -119,8 +141,54 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
     return (ssize_t)res;
 }
 
-ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
-                      const sock_udp_ep_t *remote)
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote)
+{
+    struct netbuf *buf;
+    u16_t len;
+    int res;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    buf = *buf_ctx;
+    if (buf != NULL) {
+        /* hand out the next pbuf of the chain, release after the last one */
+        if (netbuf_next(buf) < 0) {
+            netbuf_delete(buf);
+            *buf_ctx = NULL;
+            *data = NULL;
+            return 0;
+        }
+    }
+    else {
+        if ((res = lwip_sock_recv(sock->conn, timeout, &buf)) < 0) {
+            return res;
+        }
+        if ((remote != NULL) && (_get_remote(sock, buf, remote) < 0)) {
+            netbuf_delete(buf);
+            return -EPROTO;
+        }
+        *buf_ctx = buf;
+    }
+    netbuf_data(buf, data, &len);
+    if (len == 0) {
+        /* empty datagram */
+        netbuf_delete(buf);
+        *buf_ctx = NULL;
+        *data = NULL;
+    }
+    return (ssize_t)len;
+}
+
+void sock_udp_recv_buf_free(sock_udp_t *sock, void *buf_ctx)
+{
+    (void)sock;
+    if (buf_ctx != NULL) {
+        netbuf_delete(buf_ctx);
+    }
+}
+
+static ssize_t _send(sock_udp_t *sock, const void *data, size_t len,
+                     const sock_udp_ep_t *remote)
 {
     assert((sock != NULL) || (remote != NULL));
     assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
@@ -132,4 +200,66 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                           NETCONN_UDP);
 }
 
+#ifdef MODULE_SOCK_ASYNC
+static inline void _sent(sock_udp_t *sock)
+{
+    if ((sock != NULL) && (sock->async.cb.udp != NULL)) {
+        sock->async.cb.udp(sock, SOCK_ASYNC_MSG_SENT, sock->async.cb_arg);
+    }
+}
+#endif
+
+ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
+                      const sock_udp_ep_t *remote)
+{
+    ssize_t res = _send(sock, data, len, remote);
+
+#ifdef MODULE_SOCK_ASYNC
+    if (res >= 0) {
+        _sent(sock);
+    }
+#endif
+    return res;
+}
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned numof)
+{
+    unsigned sent;
+    ssize_t res = 0;
+
+    assert((numof == 0) || (msgs != NULL));
+    /* netconn has no way to pass several datagrams at once */
+    for (sent = 0; sent < numof; sent++) {
+        if ((res = _send(sock, msgs[sent].data, msgs[sent].len,
+                         msgs[sent].remote)) < 0) {
+            break;
+        }
+    }
+    if (sent == 0) {
+        return res;
+    }
+#ifdef MODULE_SOCK_ASYNC
+    _sent(sock);
+#endif
+    return sent;
+}
+
+#ifdef MODULE_SOCK_ASYNC
+void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *cb_arg)
+{
+    assert(sock != NULL);
+    lwip_sock_async_set(&sock->async, sock, &sock->conn,
+                        (lwip_sock_async_cb_t)cb, cb_arg);
+}
+
+#ifdef MODULE_SOCK_ASYNC_EVENT
+sock_async_ctx_t *sock_udp_get_async_ctx(sock_udp_t *sock)
+{
+    assert(sock != NULL);
+    return &sock->async.async_ctx;
+}
+#endif
+#endif
+
 /** @} */
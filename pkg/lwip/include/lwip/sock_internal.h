@@ -30,6 +30,10 @@
 #include "lwip/ip_addr.h"
 #include "lwip/api.h"
 
+#ifdef MODULE_SOCK_ASYNC
+#include "sock_types.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -57,6 +61,12 @@ int lwip_sock_recv(struct netconn *conn, uint32_t timeout, struct netbuf **buf);
 #endif
 ssize_t lwip_sock_send(struct netconn **conn, const void *data, size_t len,
                        int proto, const struct _sock_tl_ep *remote, int type);
+#ifdef MODULE_SOCK_ASYNC
+void lwip_sock_async_set(lwip_sock_async_t *async, void *sock,
+                         struct netconn **conn, lwip_sock_async_cb_t cb,
+                         void *cb_arg);
+void lwip_sock_async_remove(lwip_sock_async_t *async);
+#endif
 /**
  * @}
  */
@@ -138,7 +138,6 @@ extern "C" {
 #define LWIP_SOCKET             (0)
 
 #define LWIP_DONT_PROVIDE_BYTEORDER_FUNCTIONS
-#define MEMP_MEM_MALLOC         (1)
 #define NETIF_MAX_HWADDR_LEN    (GNRC_NETIF_HDR_L2ADDR_MAX_LEN)
 
 #define TCPIP_THREAD_STACKSIZE  (THREAD_STACKSIZE_DEFAULT)
@@ -149,6 +148,15 @@ extern "C" {
 #define MEM_SIZE                (TCPIP_THREAD_STACKSIZE + 6144)
 #endif
 
+/* By default all pools are taken from the heap of size MEM_SIZE. Set
+ * MEMP_MEM_MALLOC to 0 to use fixed-size pools instead, which avoid heap
+ * fragmentation and per-allocation headers, and size them for the
+ * application with the MEMP_NUM_* and PBUF_POOL_SIZE options of lwIP's opt.h
+ * (e.g. `CFLAGS += -DMEMP_NUM_TCP_PCB=8`). */
+#ifndef MEMP_MEM_MALLOC
+#define MEMP_MEM_MALLOC         (1)
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
@@ -20,17 +20,58 @@
 
 #include "net/af.h"
 #include "lwip/api.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async_types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if defined(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief   Generic asynchronous callback type
+ * @internal
+ */
+typedef void (*lwip_sock_async_cb_t)(void *sock, sock_async_flags_t flags,
+                                     void *arg);
+
+/**
+ * @brief   Asynchronous context of a sock
+ * @internal
+ */
+typedef struct lwip_sock_async {
+    struct lwip_sock_async *next;   /**< list of socks with a callback */
+    void *sock;                     /**< the sock this context belongs to */
+    struct netconn **conn;          /**< connection of lwip_sock_async_t::sock */
+    /**
+     * @brief   asynchronous upper layer callback
+     *
+     * @note    All have void return value and a (pointer) sock pointer as
+     *          first argument, so it should be safe to just call
+     *          lwip_sock_async_t::cb::generic.
+     */
+    union {
+        lwip_sock_async_cb_t generic;   /**< generic version */
+        sock_ip_cb_t ip;                /**< IP version */
+        sock_udp_cb_t udp;              /**< UDP version */
+    } cb;
+    void *cb_arg;                   /**< asynchronous callback argument */
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+    sock_async_ctx_t async_ctx;     /**< asynchronous event context */
+#endif
+} lwip_sock_async_t;
+#endif
+
 /**
  * @brief   Raw IP sock type
  * @internal
  */
 struct sock_ip {
     struct netconn *conn;
+#if defined(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+    lwip_sock_async_t async;        /**< asynchronous context */
+#endif
 };
 
 /**
@@ -62,6 +103,9 @@ struct sock_tcp_queue {
  */
 struct sock_udp {
     struct netconn *conn;
+#if defined(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+    lwip_sock_async_t async;        /**< asynchronous context */
+#endif
 };
 
 #ifdef __cplusplus
@@ -19,6 +19,11 @@
 #ifndef NIMBLE_RIOT_H
 #define NIMBLE_RIOT_H
 
+#ifdef MODULE_BLUETIL_AD
+#include "host/ble_gap.h"
+#include "net/bluetil/ad.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -58,6 +63,50 @@ extern "C" {
  */
 void nimble_riot_init(void);
 
+#if defined(MODULE_BLUETIL_AD) || defined(DOXYGEN)
+/**
+ * @brief   Callback for scan reports that passed the filters of
+ *          nimble_riot_disc_filtered()
+ *
+ * Called in the context of NimBLE's host thread.
+ *
+ * @param[in] desc      the scan report, NULL once the discovery completed
+ * @param[in] idx       index of the report's advertising data, only valid
+ *                      during the call
+ * @param[in] arg       argument given to nimble_riot_disc_filtered()
+ */
+typedef void (*nimble_riot_disc_cb_t)(const struct ble_gap_disc_desc *desc,
+                                      const bluetil_ad_index_t *idx,
+                                      void *arg);
+
+/**
+ * @brief   Start a discovery procedure that only reports matching devices
+ *
+ * The advertising data of each scan report is indexed once in the host
+ * thread with bluetil_ad_index() and checked against all @p filters, so the
+ * callback only runs for matching devices and does not need to parse the
+ * data again. Only one filtered discovery can be active at a time.
+ *
+ * @param[in] own_addr_type     address type used for active scanning
+ * @param[in] duration_ms       duration of the discovery, BLE_HS_FOREVER
+ *                              for no timeout
+ * @param[in] params            discovery parameters
+ * @param[in] filters           conditions a report must meet, must stay
+ *                              valid while the discovery is active
+ * @param[in] filters_numof     number of entries in @p filters
+ * @param[in] cb                callback for matching reports
+ * @param[in] arg               argument passed to @p cb
+ *
+ * @return  0 on success
+ * @return  a NimBLE error code of ble_gap_disc() otherwise
+ */
+int nimble_riot_disc_filtered(uint8_t own_addr_type, int32_t duration_ms,
+                              const struct ble_gap_disc_params *params,
+                              const bluetil_ad_filter_t *filters,
+                              unsigned filters_numof,
+                              nimble_riot_disc_cb_t cb, void *arg);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,7 @@
  * @}
  */
 
+#include "assert.h"
 #include "thread.h"
 #include "nimble_riot.h"
 
@@ -33,6 +34,17 @@
 static char _stack_controller[NIMBLE_CONTROLLER_STACKSIZE];
 static char _stack_host[NIMBLE_HOST_STACKSIZE];
 
+#ifdef MODULE_BLUETIL_AD
+static struct {
+    const bluetil_ad_filter_t *filters;
+    unsigned filters_numof;
+    nimble_riot_disc_cb_t cb;
+    void *arg;
+    /* kept out of the host thread's stack */
+    bluetil_ad_index_t idx;
+} _disc;
+#endif
+
 static void *_host_thread(void *arg)
 {
     (void)arg;
@@ -69,3 +81,45 @@ void nimble_riot_init(void)
                   _host_thread, NULL,
                   "nimble_host");
 }
+
+#ifdef MODULE_BLUETIL_AD
+static int _on_disc(struct ble_gap_event *event, void *arg)
+{
+    (void)arg;
+
+    if (event->type == BLE_GAP_EVENT_DISC) {
+        bluetil_ad_t ad = BLUETIL_AD_INIT((uint8_t *)event->disc.data,
+                                          event->disc.length_data,
+                                          event->disc.length_data);
+
+        /* a report with more fields than the index holds is still matched
+         * against the ones that fit */
+        if ((bluetil_ad_index(&ad, &_disc.idx) != BLUETIL_AD_INVALID) &&
+            bluetil_ad_index_match(&_disc.idx, _disc.filters,
+                                   _disc.filters_numof)) {
+            _disc.cb(&event->disc, &_disc.idx, _disc.arg);
+        }
+    }
+    else if (event->type == BLE_GAP_EVENT_DISC_COMPLETE) {
+        _disc.cb(NULL, NULL, _disc.arg);
+    }
+
+    return 0;
+}
+
+int nimble_riot_disc_filtered(uint8_t own_addr_type, int32_t duration_ms,
+                              const struct ble_gap_disc_params *params,
+                              const bluetil_ad_filter_t *filters,
+                              unsigned filters_numof,
+                              nimble_riot_disc_cb_t cb, void *arg)
+{
+    assert(cb);
+
+    _disc.filters = filters;
+    _disc.filters_numof = filters_numof;
+    _disc.cb = cb;
+    _disc.arg = arg;
+
+    return ble_gap_disc(own_addr_type, duration_ms, params, _on_disc, NULL);
+}
+#endif
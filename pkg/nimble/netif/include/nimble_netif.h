@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    pkg_nimble_netif GNRC netif implementation for NimBLE
+ * @ingroup     pkg_nimble
+ * @brief       IPv6 over BLE (RFC 7668) using NimBLE's L2CAP connection
+ *              oriented channels
+ *
+ * Each BLE connection carries one L2CAP connection oriented channel on the
+ * IPSP PSM. All connections together form a single GNRC network interface,
+ * packets are sent to the connection matching the link layer destination
+ * address, or to all connections for multicast and broadcast.
+ *
+ * Flow control is done by L2CAP's credit based scheme: a receive buffer is
+ * handed back to NimBLE right after a packet was taken out of it, which
+ * returns the credits to the peer.
+ *
+ * A node accepts connections with nimble_netif_accept() (peripheral role) and
+ * opens connections with nimble_netif_connect() (central role). Both can be
+ * used at the same time, limited by @ref NIMBLE_NETIF_MAX_CONN.
+ *
+ * @{
+ *
+ * @file
+ * @brief       GNRC netif implementation for NimBLE
+ */
+
+#ifndef NIMBLE_NETIF_H
+#define NIMBLE_NETIF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "host/ble_gap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   L2CAP PSM used for IPv6 (IPSP)
+ */
+#define NIMBLE_NETIF_PSM            (0x0023)
+
+/**
+ * @brief   Maximum number of concurrent connections
+ */
+#ifndef NIMBLE_NETIF_MAX_CONN
+#define NIMBLE_NETIF_MAX_CONN       (MYNEWT_VAL_BLE_MAX_CONNECTIONS)
+#endif
+
+/**
+ * @brief   L2CAP SDU size, large enough to never fragment on 6LoWPAN
+ */
+#ifndef NIMBLE_NETIF_MTU
+#define NIMBLE_NETIF_MTU            (1280U)
+#endif
+
+/**
+ * @brief   Priority of the network interface's thread
+ */
+#ifndef NIMBLE_NETIF_PRIO
+#define NIMBLE_NETIF_PRIO           (GNRC_NETIF_PRIO)
+#endif
+
+/**
+ * @brief   Create the network interface
+ *
+ * Called by auto_init after NimBLE was started.
+ */
+void nimble_netif_init(void);
+
+/**
+ * @brief   Advertise and accept incoming connections
+ *
+ * Advertising is resumed after each connection as long as connection slots
+ * are left.
+ *
+ * @param[in] ad            advertising data
+ * @param[in] ad_len        length of @p ad in bytes
+ * @param[in] adv_params    advertising parameters, may be NULL for
+ *                          undirected connectable advertising with default
+ *                          timing
+ *
+ * @return  0 on success
+ * @return  -EALREADY if already advertising
+ * @return  -ENOMEM if no connection slot is free
+ * @return  -ECANCELED if NimBLE refused to advertise
+ */
+int nimble_netif_accept(const uint8_t *ad, size_t ad_len,
+                        const struct ble_gap_adv_params *adv_params);
+
+/**
+ * @brief   Stop accepting incoming connections
+ *
+ * @return  0 on success
+ * @return  -EALREADY if not advertising
+ */
+int nimble_netif_accept_stop(void);
+
+/**
+ * @brief   Open a connection to the given peer
+ *
+ * The IPSP channel is opened as soon as the connection is established.
+ *
+ * @param[in] addr          address of the peer
+ * @param[in] conn_params   connection parameters, may be NULL for defaults
+ * @param[in] timeout       connection timeout in ms
+ *
+ * @return  index of the connection slot used
+ * @return  -ENOMEM if no connection slot is free
+ * @return  -ECANCELED if NimBLE refused to connect
+ */
+int nimble_netif_connect(const ble_addr_t *addr,
+                         const struct ble_gap_conn_params *conn_params,
+                         uint32_t timeout);
+
+/**
+ * @brief   Close the connection in the given slot
+ *
+ * @param[in] slot          index of the connection slot
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p slot is not in use
+ */
+int nimble_netif_close(int slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NIMBLE_NETIF_H */
+/** @} */
@@ -0,0 +1,555 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     pkg_nimble_netif
+ * @{
+ *
+ * @file
+ * @brief       GNRC netif implementation for NimBLE
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#include "net/gnrc.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/nettype.h"
+
+#include "nimble_netif.h"
+
+#include "host/ble_hs.h"
+#include "host/ble_gap.h"
+#include "host/ble_l2cap.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#define ADDR_LEN            (6U)
+#define SYNC_POLL_INTERVAL  (10U * US_PER_MS)
+
+enum {
+    SLOT_UNUSED = 0,
+    SLOT_CONNECTING,        /**< GAP connection is being opened (central) */
+    SLOT_CONNECTED,         /**< GAP connection is up, no channel yet */
+    SLOT_OPEN,              /**< IPSP channel is open */
+};
+
+typedef struct {
+    struct ble_l2cap_chan *chan;    /**< IPSP channel, if SLOT_OPEN */
+    uint16_t handle;                /**< GAP connection handle */
+    uint8_t addr[ADDR_LEN];         /**< peer address in network byte order */
+    uint8_t state;                  /**< state of the slot */
+} _conn_t;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE];
+static gnrc_netif_t *_netif = NULL;
+
+static _conn_t _conn[NIMBLE_NETIF_MAX_CONN];
+static mutex_t _lock = MUTEX_INIT;
+
+static uint8_t _own_addr_type;
+static uint8_t _own_addr[ADDR_LEN];
+
+static struct ble_gap_adv_params _adv_params;
+static bool _accepting = false;
+
+static int _on_gap_evt(struct ble_gap_event *event, void *arg);
+static int _on_l2cap_evt(struct ble_l2cap_event *event, void *arg);
+
+/* NimBLE keeps addresses in little endian byte order */
+static void _addr_swapped_cp(uint8_t *dst, const uint8_t *src)
+{
+    for (unsigned i = 0; i < ADDR_LEN; i++) {
+        dst[i] = src[ADDR_LEN - 1 - i];
+    }
+}
+
+static _conn_t *_conn_by_state(uint8_t state)
+{
+    for (unsigned i = 0; i < NIMBLE_NETIF_MAX_CONN; i++) {
+        if (_conn[i].state == state) {
+            return &_conn[i];
+        }
+    }
+    return NULL;
+}
+
+static _conn_t *_conn_by_handle(uint16_t handle)
+{
+    for (unsigned i = 0; i < NIMBLE_NETIF_MAX_CONN; i++) {
+        if ((_conn[i].state != SLOT_UNUSED) &&
+            (_conn[i].state != SLOT_CONNECTING) &&
+            (_conn[i].handle == handle)) {
+            return &_conn[i];
+        }
+    }
+    return NULL;
+}
+
+static _conn_t *_conn_by_addr(const uint8_t *addr)
+{
+    for (unsigned i = 0; i < NIMBLE_NETIF_MAX_CONN; i++) {
+        if ((_conn[i].state == SLOT_OPEN) &&
+            (memcmp(_conn[i].addr, addr, ADDR_LEN) == 0)) {
+            return &_conn[i];
+        }
+    }
+    return NULL;
+}
+
+/* must be called with _lock held */
+static void _adv_resume(void)
+{
+    if (_accepting && !ble_gap_adv_active() &&
+        (_conn_by_state(SLOT_UNUSED) != NULL)) {
+        if (ble_gap_adv_start(_own_addr_type, NULL, BLE_HS_FOREVER,
+                              &_adv_params, _on_gap_evt, NULL) != 0) {
+            DEBUG("nimble_netif: unable to resume advertising\n");
+        }
+    }
+}
+
+static int _rx_ready(struct ble_l2cap_chan *chan)
+{
+    struct os_mbuf *sdu_rx = os_msys_get_pkthdr(0, 0);
+
+    if (sdu_rx == NULL) {
+        return -ENOBUFS;
+    }
+    if (ble_l2cap_recv_ready(chan, sdu_rx) != 0) {
+        os_mbuf_free_chain(sdu_rx);
+        return -ECANCELED;
+    }
+    return 0;
+}
+
+static void _on_data(_conn_t *conn, struct ble_l2cap_event *event)
+{
+    struct os_mbuf *sdu_rx = event->receive.sdu_rx;
+    size_t len = OS_MBUF_PKTLEN(sdu_rx);
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+
+    /* copy straight out of the mbuf chain into the packet buffer */
+    pkt = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        DEBUG("nimble_netif: no space left in packet buffer\n");
+        goto out;
+    }
+    os_mbuf_copydata(sdu_rx, 0, len, pkt->data);
+
+    netif_hdr = gnrc_pktbuf_add(pkt, NULL,
+                                sizeof(gnrc_netif_hdr_t) + (2 * ADDR_LEN),
+                                GNRC_NETTYPE_NETIF);
+    if (netif_hdr == NULL) {
+        DEBUG("nimble_netif: no space left in packet buffer\n");
+        gnrc_pktbuf_release(pkt);
+        goto out;
+    }
+    gnrc_netif_hdr_init(netif_hdr->data, ADDR_LEN, ADDR_LEN);
+    gnrc_netif_hdr_set_src_addr(netif_hdr->data, conn->addr, ADDR_LEN);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr->data, _own_addr, ADDR_LEN);
+    ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid = _netif->pid;
+
+    /* throw away packet if no one is interested */
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
+                                      GNRC_NETREG_DEMUX_CTX_ALL, netif_hdr)) {
+        DEBUG("nimble_netif: unable to forward packet\n");
+        gnrc_pktbuf_release(netif_hdr);
+    }
+
+out:
+    os_mbuf_free_chain(sdu_rx);
+    /* handing out a new buffer returns the credits to the peer */
+    if (_rx_ready(event->receive.chan) != 0) {
+        DEBUG("nimble_netif: unable to provide receive buffer\n");
+    }
+}
+
+static int _on_l2cap_evt(struct ble_l2cap_event *event, void *arg)
+{
+    _conn_t *conn;
+
+    (void)arg;
+    mutex_lock(&_lock);
+    switch (event->type) {
+        case BLE_L2CAP_EVENT_COC_CONNECTED:
+            conn = _conn_by_handle(event->connect.conn_handle);
+            if (conn == NULL) {
+                break;
+            }
+            if (event->connect.status != 0) {
+                DEBUG("nimble_netif: unable to open channel\n");
+                ble_gap_terminate(conn->handle, BLE_ERR_REM_USER_CONN_TERM);
+                break;
+            }
+            conn->chan = event->connect.chan;
+            conn->state = SLOT_OPEN;
+            break;
+        case BLE_L2CAP_EVENT_COC_DISCONNECTED:
+            conn = _conn_by_handle(event->disconnect.conn_handle);
+            if ((conn != NULL) && (conn->chan == event->disconnect.chan)) {
+                conn->chan = NULL;
+                conn->state = SLOT_CONNECTED;
+            }
+            break;
+        case BLE_L2CAP_EVENT_COC_ACCEPT:
+            if ((_conn_by_handle(event->accept.conn_handle) == NULL) ||
+                (event->accept.peer_sdu_size < NIMBLE_NETIF_MTU)) {
+                mutex_unlock(&_lock);
+                return BLE_HS_EREJECT;
+            }
+            if (_rx_ready(event->accept.chan) != 0) {
+                mutex_unlock(&_lock);
+                return BLE_HS_ENOMEM;
+            }
+            break;
+        case BLE_L2CAP_EVENT_COC_DATA_RECEIVED:
+            conn = _conn_by_handle(event->receive.conn_handle);
+            if (conn != NULL) {
+                _on_data(conn, event);
+            }
+            else {
+                os_mbuf_free_chain(event->receive.sdu_rx);
+            }
+            break;
+        default:
+            break;
+    }
+    mutex_unlock(&_lock);
+    return 0;
+}
+
+static void _on_connect(_conn_t *conn, struct ble_gap_event *event)
+{
+    struct ble_gap_conn_desc desc;
+    bool central = (conn->state == SLOT_CONNECTING);
+
+    conn->handle = event->connect.conn_handle;
+    conn->state = SLOT_CONNECTED;
+    if (ble_gap_conn_find(conn->handle, &desc) == 0) {
+        _addr_swapped_cp(conn->addr, desc.peer_id_addr.val);
+    }
+    if (central) {
+        struct os_mbuf *sdu_rx = os_msys_get_pkthdr(0, 0);
+
+        if ((sdu_rx == NULL) ||
+            (ble_l2cap_connect(conn->handle, NIMBLE_NETIF_PSM,
+                               NIMBLE_NETIF_MTU, sdu_rx,
+                               _on_l2cap_evt, NULL) != 0)) {
+            DEBUG("nimble_netif: unable to open channel\n");
+            if (sdu_rx != NULL) {
+                os_mbuf_free_chain(sdu_rx);
+            }
+            ble_gap_terminate(conn->handle, BLE_ERR_REM_USER_CONN_TERM);
+        }
+    }
+}
+
+static int _on_gap_evt(struct ble_gap_event *event, void *arg)
+{
+    _conn_t *conn = arg;
+
+    mutex_lock(&_lock);
+    switch (event->type) {
+        case BLE_GAP_EVENT_CONNECT:
+            if (conn == NULL) {
+                /* incoming connection from advertising */
+                conn = _conn_by_state(SLOT_UNUSED);
+            }
+            if (event->connect.status != 0) {
+                if ((conn != NULL) && (conn->state == SLOT_CONNECTING)) {
+                    conn->state = SLOT_UNUSED;
+                }
+            }
+            else if (conn == NULL) {
+                ble_gap_terminate(event->connect.conn_handle,
+                                  BLE_ERR_CONN_LIMIT);
+            }
+            else {
+                _on_connect(conn, event);
+            }
+            _adv_resume();
+            break;
+        case BLE_GAP_EVENT_DISCONNECT:
+            conn = _conn_by_handle(event->disconnect.conn.conn_handle);
+            if (conn != NULL) {
+                memset(conn, 0, sizeof(*conn));
+            }
+            _adv_resume();
+            break;
+        case BLE_GAP_EVENT_ADV_COMPLETE:
+            _adv_resume();
+            break;
+        default:
+            break;
+    }
+    mutex_unlock(&_lock);
+    return 0;
+}
+
+static int _send_conn(_conn_t *conn, gnrc_pktsnip_t *payload)
+{
+    struct os_mbuf *sdu = os_msys_get_pkthdr(0, 0);
+
+    if (sdu == NULL) {
+        return -ENOBUFS;
+    }
+    for (; payload != NULL; payload = payload->next) {
+        if (os_mbuf_append(sdu, payload->data, payload->size) != 0) {
+            os_mbuf_free_chain(sdu);
+            return -ENOBUFS;
+        }
+    }
+    if (ble_l2cap_send(conn->chan, sdu) != 0) {
+        os_mbuf_free_chain(sdu);
+        return -EBUSY;
+    }
+    return 0;
+}
+
+static int _netif_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *netif_hdr;
+    int res = -ENOTCONN;
+
+    (void)netif;
+    if (pkt->type != GNRC_NETTYPE_NETIF) {
+        DEBUG("nimble_netif: first header is not generic netif header\n");
+        gnrc_pktbuf_release(pkt);
+        return -EBADMSG;
+    }
+    netif_hdr = pkt->data;
+
+    mutex_lock(&_lock);
+    if (netif_hdr->flags &
+        (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
+        for (unsigned i = 0; i < NIMBLE_NETIF_MAX_CONN; i++) {
+            if ((_conn[i].state == SLOT_OPEN) &&
+                (_send_conn(&_conn[i], pkt->next) == 0)) {
+                res = 0;
+            }
+        }
+    }
+    else if (netif_hdr->dst_l2addr_len == ADDR_LEN) {
+        _conn_t *conn = _conn_by_addr(gnrc_netif_hdr_get_dst_addr(netif_hdr));
+
+        if (conn != NULL) {
+            res = _send_conn(conn, pkt->next);
+        }
+    }
+    mutex_unlock(&_lock);
+
+    if (res == 0) {
+        res = gnrc_pkt_len(pkt->next);
+    }
+    gnrc_pktbuf_release(pkt);
+    return res;
+}
+
+static gnrc_pktsnip_t *_netif_recv(gnrc_netif_t *netif)
+{
+    (void)netif;
+    /* not used, packets are dispatched from NimBLE's host thread */
+    return NULL;
+}
+
+static const gnrc_netif_ops_t _nimble_netif_ops = {
+    .init = NULL,
+    .send = _netif_send,
+    .recv = _netif_recv,
+    .get = gnrc_netif_get_from_netdev,
+    .set = gnrc_netif_set_from_netdev,
+    .msg_handler = NULL,
+};
+
+static int _netdev_init(netdev_t *dev)
+{
+    uint8_t addr[ADDR_LEN];
+
+    _netif = dev->context;
+
+    /* the address is only known after host and controller are in sync */
+    while (!ble_hs_synced()) {
+        xtimer_usleep(SYNC_POLL_INTERVAL);
+    }
+    if ((ble_hs_id_infer_auto(0, &_own_addr_type) != 0) ||
+        (ble_hs_id_copy_addr(_own_addr_type, addr, NULL) != 0)) {
+        return -ENODEV;
+    }
+    _addr_swapped_cp(_own_addr, addr);
+
+    if (ble_l2cap_create_server(NIMBLE_NETIF_PSM, NIMBLE_NETIF_MTU,
+                                _on_l2cap_evt, NULL) != 0) {
+        return -ENODEV;
+    }
+    return 0;
+}
+
+static int _netdev_get(netdev_t *dev, netopt_t opt, void *value,
+                       size_t max_len)
+{
+    (void)dev;
+    switch (opt) {
+        case NETOPT_ADDRESS:
+            assert(max_len >= ADDR_LEN);
+            memcpy(value, _own_addr, ADDR_LEN);
+            return ADDR_LEN;
+        case NETOPT_ADDR_LEN:
+        case NETOPT_SRC_LEN:
+            assert(max_len == sizeof(uint16_t));
+            *((uint16_t *)value) = ADDR_LEN;
+            return sizeof(uint16_t);
+        case NETOPT_MAX_PACKET_SIZE:
+            assert(max_len == sizeof(uint16_t));
+            *((uint16_t *)value) = NIMBLE_NETIF_MTU;
+            return sizeof(uint16_t);
+        case NETOPT_PROTO:
+            assert(max_len == sizeof(gnrc_nettype_t));
+            *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+            return sizeof(gnrc_nettype_t);
+        case NETOPT_DEVICE_TYPE:
+            assert(max_len == sizeof(uint16_t));
+            *((uint16_t *)value) = NETDEV_TYPE_BLE;
+            return sizeof(uint16_t);
+        default:
+            return -ENOTSUP;
+    }
+}
+
+static const netdev_driver_t _nimble_netdev_driver = {
+    .send = NULL,
+    .recv = NULL,
+    .init = _netdev_init,
+    .isr  = NULL,
+    .get  = _netdev_get,
+    .set  = netdev_set_notsup,
+};
+
+static netdev_t _nimble_netdev_dummy = {
+    .driver = &_nimble_netdev_driver,
+};
+
+void nimble_netif_init(void)
+{
+    gnrc_netif_create(_stack, sizeof(_stack), NIMBLE_NETIF_PRIO,
+                      "nimble_netif", &_nimble_netdev_dummy,
+                      &_nimble_netif_ops);
+}
+
+int nimble_netif_accept(const uint8_t *ad, size_t ad_len,
+                        const struct ble_gap_adv_params *adv_params)
+{
+    int res = 0;
+
+    mutex_lock(&_lock);
+    if (_accepting) {
+        res = -EALREADY;
+    }
+    else if (_conn_by_state(SLOT_UNUSED) == NULL) {
+        res = -ENOMEM;
+    }
+    else if (ble_gap_adv_set_data(ad, (int)ad_len) != 0) {
+        res = -ECANCELED;
+    }
+    else {
+        if (adv_params != NULL) {
+            _adv_params = *adv_params;
+        }
+        else {
+            memset(&_adv_params, 0, sizeof(_adv_params));
+            _adv_params.conn_mode = BLE_GAP_CONN_MODE_UND;
+            _adv_params.disc_mode = BLE_GAP_DISC_MODE_GEN;
+        }
+        _accepting = true;
+        if (ble_gap_adv_start(_own_addr_type, NULL, BLE_HS_FOREVER,
+                              &_adv_params, _on_gap_evt, NULL) != 0) {
+            _accepting = false;
+            res = -ECANCELED;
+        }
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+int nimble_netif_accept_stop(void)
+{
+    int res = 0;
+
+    mutex_lock(&_lock);
+    if (!_accepting) {
+        res = -EALREADY;
+    }
+    else {
+        _accepting = false;
+        ble_gap_adv_stop();
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+int nimble_netif_connect(const ble_addr_t *addr,
+                         const struct ble_gap_conn_params *conn_params,
+                         uint32_t timeout)
+{
+    _conn_t *conn;
+    int res;
+
+    assert(addr != NULL);
+    mutex_lock(&_lock);
+    conn = _conn_by_state(SLOT_UNUSED);
+    if (conn == NULL) {
+        res = -ENOMEM;
+    }
+    else {
+        conn->state = SLOT_CONNECTING;
+        if (ble_gap_connect(_own_addr_type, addr, (int32_t)timeout,
+                            conn_params, _on_gap_evt, conn) != 0) {
+            conn->state = SLOT_UNUSED;
+            res = -ECANCELED;
+        }
+        else {
+            res = (int)(conn - _conn);
+        }
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+int nimble_netif_close(int slot)
+{
+    int res = 0;
+
+    if ((slot < 0) || (slot >= (int)NIMBLE_NETIF_MAX_CONN)) {
+        return -EINVAL;
+    }
+    mutex_lock(&_lock);
+    switch (_conn[slot].state) {
+        case SLOT_CONNECTING:
+            ble_gap_conn_cancel();
+            _conn[slot].state = SLOT_UNUSED;
+            break;
+        case SLOT_CONNECTED:
+        case SLOT_OPEN:
+            ble_gap_terminate(_conn[slot].handle, BLE_ERR_REM_USER_CONN_TERM);
+            break;
+        default:
+            res = -EINVAL;
+            break;
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
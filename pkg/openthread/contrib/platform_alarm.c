@@ -41,17 +41,19 @@ static msg_t ot_alarm_msg;
 void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
 {
     (void)aInstance;
-    (void)aT0;
 
     DEBUG("openthread: otPlatAlarmStartAt: aT0: %" PRIu32 ", aDT: %" PRIu32 "\n", aT0, aDt);
     ot_alarm_msg.type = OPENTHREAD_XTIMER_MSG_TYPE_EVENT;
 
-    if (aDt == 0) {
+    /* the delay is relative to aT0, so subtract the time already passed */
+    uint32_t elapsed = otPlatAlarmMilliGetNow() - aT0;
+
+    if (elapsed >= aDt) {
         msg_send(&ot_alarm_msg, thread_getpid());
     }
     else {
-        int dt = aDt * US_PER_MS;
-        xtimer_set_msg(&ot_timer, dt, &ot_alarm_msg, thread_getpid());
+        uint64_t dt = (uint64_t)(aDt - elapsed) * US_PER_MS;
+        xtimer_set_msg64(&ot_timer, dt, &ot_alarm_msg, thread_getpid());
     }
 }
 
@@ -40,13 +40,23 @@
 static otRadioFrame sTransmitFrame;
 static otRadioFrame sReceiveFrame;
 static int8_t Rssi;
+static uint16_t _channel;
 
 static netdev_t *_dev;
 
-/* set 15.4 channel */
+/* set 15.4 channel, skipping the driver if it is already tuned to it */
 static int _set_channel(uint16_t channel)
 {
-    return _dev->driver->set(_dev, NETOPT_CHANNEL, &channel, sizeof(uint16_t));
+    int res;
+
+    if (channel == _channel) {
+        return sizeof(uint16_t);
+    }
+    res = _dev->driver->set(_dev, NETOPT_CHANNEL, &channel, sizeof(uint16_t));
+    if (res >= 0) {
+        _channel = channel;
+    }
+    return res;
 }
 
 /* set transmission power */
@@ -134,6 +144,7 @@ void openthread_radio_init(netdev_t *dev, uint8_t *tb, uint8_t *rb)
     sReceiveFrame.mPsdu = rb;
     sReceiveFrame.mLength = 0;
     _dev = dev;
+    _dev->driver->get(_dev, NETOPT_CHANNEL, &_channel, sizeof(uint16_t));
 }
 
 /* Called upon NETDEV_EVENT_RX_COMPLETE event */
@@ -151,6 +162,14 @@ void recv_pkt(otInstance *aInstance, netdev_t *dev)
         return;
     }
 
+    /* frame does not fit into the receive buffer: drop it */
+    if ((unsigned)len > (OPENTHREAD_NETDEV_BUFLEN - RADIO_IEEE802154_FCS_LEN)) {
+        DEBUG("Frame too long: %d\n", len);
+        dev->driver->recv(dev, NULL, len, NULL);
+        otPlatRadioReceiveDone(aInstance, NULL, OT_ERROR_ABORT);
+        return;
+    }
+
     /* Fill OpenThread receive frame */
     /* Openthread needs a packet length with FCS included,
      * OpenThread do not use the data so we don't need to calculate FCS */
@@ -64,6 +64,14 @@ typedef struct {
     uint8_t len;
 } loramac_send_params_t;
 
+#ifdef MODULE_SEMTECH_LORAMAC_QUEUE
+typedef struct {
+    const uint8_t *data;
+    uint8_t len;
+    uint8_t status;
+} loramac_queue_params_t;
+#endif
+
 typedef void (*semtech_loramac_func_t)(semtech_loramac_t *, void *);
 
 /**
@@ -562,6 +570,95 @@ static void _send(semtech_loramac_t *mac, void *arg)
 #endif
 }
 
+#ifdef MODULE_SEMTECH_LORAMAC_QUEUE
+static void _queue_arm(semtech_loramac_t *mac, uint32_t delay)
+{
+    mac->queue.timer_msg.type = MSG_TYPE_LORAMAC_QUEUE_FLUSH;
+    xtimer_set_msg(&mac->queue.timer, delay * US_PER_MS,
+                   &mac->queue.timer_msg, semtech_loramac_pid);
+}
+
+static bool _queue_fits(semtech_loramac_t *mac, unsigned len)
+{
+    LoRaMacTxInfo_t txInfo;
+
+    return (len <= SEMTECH_LORAMAC_QUEUE_SIZE) &&
+           (LoRaMacQueryTxPossible(len, &txInfo) == LORAMAC_STATUS_OK);
+}
+
+static void _queue_flush(semtech_loramac_t *mac, void *arg)
+{
+    (void)arg;
+    semtech_loramac_queue_t *queue = &mac->queue;
+
+    if ((queue->len == 0) || queue->sending) {
+        return;
+    }
+    xtimer_remove(&queue->timer);
+
+    if (!_queue_fits(mac, queue->len)) {
+        /* the data rate dropped since the payloads were queued */
+        DEBUG("[semtech-loramac] queue: frame too large, dropped\n");
+        queue->len = 0;
+        return;
+    }
+
+    uint8_t status = _semtech_loramac_send(mac, queue->buf, queue->len);
+    switch (status) {
+        case SEMTECH_LORAMAC_TX_OK:
+            /* LoRaMac copied the payload into its frame buffer */
+            DEBUG("[semtech-loramac] queue: sent %u bytes\n", queue->len);
+            queue->len = 0;
+            queue->sending = true;
+#ifdef MODULE_PERIPH_EEPROM
+            _save_uplink_counter(mac);
+#endif
+            break;
+        case SEMTECH_LORAMAC_BUSY:
+        case SEMTECH_LORAMAC_DUTYCYCLE_RESTRICTED:
+            DEBUG("[semtech-loramac] queue: restricted, retry later\n");
+            _queue_arm(mac, SEMTECH_LORAMAC_QUEUE_RETRY);
+            break;
+        default:
+            DEBUG("[semtech-loramac] queue: TX error, dropped\n");
+            queue->len = 0;
+            break;
+    }
+}
+
+static void _queue_add(semtech_loramac_t *mac, void *arg)
+{
+    loramac_queue_params_t *params = arg;
+    semtech_loramac_queue_t *queue = &mac->queue;
+
+    if (!_queue_fits(mac, params->len)) {
+        params->status = SEMTECH_LORAMAC_TX_ERROR;
+        return;
+    }
+    if (!_queue_fits(mac, queue->len + params->len)) {
+        /* send what is queued to make room */
+        _queue_flush(mac, NULL);
+        if (queue->len > 0) {
+            params->status = SEMTECH_LORAMAC_BUSY;
+            return;
+        }
+    }
+
+    bool first = (queue->len == 0);
+    memcpy(&queue->buf[queue->len], params->data, params->len);
+    queue->len += params->len;
+    params->status = SEMTECH_LORAMAC_TX_SCHEDULE;
+
+    if (!_queue_fits(mac, queue->len + 1)) {
+        /* frame is full, no need to wait for more */
+        _queue_flush(mac, NULL);
+    }
+    else if (first && !queue->sending) {
+        _queue_arm(mac, SEMTECH_LORAMAC_QUEUE_DELAY);
+    }
+}
+#endif
+
 static void _semtech_loramac_call(semtech_loramac_func_t func, void *arg)
 {
     semtech_loramac_call_t call;
@@ -702,9 +799,26 @@ void *_semtech_loramac_event_loop(void *arg)
                           mac->link_chk.nb_gateways);
                     break;
                 }
+#ifdef MODULE_SEMTECH_LORAMAC_QUEUE
+                case MSG_TYPE_LORAMAC_QUEUE_FLUSH:
+                    DEBUG("[semtech-loramac] queue timer\n");
+                    _queue_flush(mac, NULL);
+                    break;
+#endif
                 case MSG_TYPE_LORAMAC_TX_STATUS:
                 {
                     DEBUG("[semtech-loramac] loramac TX status msg\n");
+#ifdef MODULE_SEMTECH_LORAMAC_QUEUE
+                    if (mac->queue.sending &&
+                        (msg.content.value != SEMTECH_LORAMAC_TX_SCHEDULE)) {
+                        /* status of a queued uplink, nobody waits for it */
+                        mac->queue.sending = false;
+                        if (mac->queue.len > 0) {
+                            _queue_arm(mac, SEMTECH_LORAMAC_QUEUE_DELAY);
+                        }
+                        break;
+                    }
+#endif
                     if (msg.content.value == SEMTECH_LORAMAC_TX_SCHEDULE) {
                         DEBUG("[semtech-loramac] schedule immediate TX\n");
                         uint8_t prev_port = mac->port;
@@ -736,7 +850,17 @@ void *_semtech_loramac_event_loop(void *arg)
                           (char *)mac->rx_data.payload,
                           mac->rx_data.payload_len,
                           mac->rx_data.port);
+#ifdef MODULE_SEMTECH_LORAMAC_QUEUE
+                    /* received data is reported as the status of the uplink */
+                    mac->queue.sending = false;
+                    if (mac->queue.len > 0) {
+                        _queue_arm(mac, SEMTECH_LORAMAC_QUEUE_DELAY);
+                    }
+                    /* don't block the MAC if nobody waits in recv */
+                    msg_try_send(&msg_ret, mac->caller_pid);
+#else
                     msg_send(&msg_ret, mac->caller_pid);
+#endif
                     break;
                 }
                 default:
@@ -833,6 +957,31 @@ uint8_t semtech_loramac_send(semtech_loramac_t *mac, uint8_t *data, uint8_t len)
     return SEMTECH_LORAMAC_TX_SCHEDULE;
 }
 
+#ifdef MODULE_SEMTECH_LORAMAC_QUEUE
+uint8_t semtech_loramac_queue_send(semtech_loramac_t *mac, const uint8_t *data,
+                                   uint8_t len)
+{
+    mac->link_chk.available = false;
+    if (!_is_mac_joined(mac)) {
+        DEBUG("[semtech-loramac] network is not joined\n");
+        return SEMTECH_LORAMAC_NOT_JOINED;
+    }
+
+    loramac_queue_params_t params;
+    params.data = data;
+    params.len = len;
+
+    _semtech_loramac_call(_queue_add, &params);
+
+    return params.status;
+}
+
+void semtech_loramac_queue_flush(semtech_loramac_t *mac)
+{
+    _semtech_loramac_call(_queue_flush, NULL);
+}
+#endif
+
 uint8_t semtech_loramac_recv(semtech_loramac_t *mac)
 {
     mac->caller_pid = thread_getpid();
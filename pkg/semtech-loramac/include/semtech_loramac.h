@@ -26,6 +26,9 @@ extern "C" {
 #include <inttypes.h>
 
 #include "mutex.h"
+#ifdef MODULE_SEMTECH_LORAMAC_QUEUE
+#include "xtimer.h"
+#endif
 
 #include "net/netdev.h"
 #include "net/loramac.h"
@@ -45,6 +48,7 @@ extern "C" {
 #define MSG_TYPE_LORAMAC_TX_STATUS     (0x3462) /**< MAC TX status */
 #define MSG_TYPE_LORAMAC_RX            (0x3463) /**< Some data received */
 #define MSG_TYPE_LORAMAC_LINK_CHECK    (0x3464) /**< Link check info received */
+#define MSG_TYPE_LORAMAC_QUEUE_FLUSH   (0x3465) /**< Send the queued uplinks */
 /** @} */
 
 /**
@@ -104,6 +108,45 @@ typedef struct {
     bool available;                              /**< new link check information avalable */
 } semtech_loramac_link_check_info_t;
 
+#if defined(MODULE_SEMTECH_LORAMAC_QUEUE) || defined(DOXYGEN)
+/**
+ * @name    Uplink queue configuration
+ * @{
+ */
+/**
+ * @brief   Size of the uplink queue in bytes
+ */
+#ifndef SEMTECH_LORAMAC_QUEUE_SIZE
+#define SEMTECH_LORAMAC_QUEUE_SIZE     (LORAWAN_APP_DATA_MAX_SIZE)
+#endif
+
+/**
+ * @brief   Time in ms a payload waits in the queue for more payloads
+ */
+#ifndef SEMTECH_LORAMAC_QUEUE_DELAY
+#define SEMTECH_LORAMAC_QUEUE_DELAY    (10000U)
+#endif
+
+/**
+ * @brief   Time in ms after which a restricted uplink is retried
+ */
+#ifndef SEMTECH_LORAMAC_QUEUE_RETRY
+#define SEMTECH_LORAMAC_QUEUE_RETRY    (5000U)
+#endif
+/** @} */
+
+/**
+ * @brief   Queue aggregating application payloads into one uplink
+ */
+typedef struct {
+    uint8_t buf[SEMTECH_LORAMAC_QUEUE_SIZE];     /**< queued payloads */
+    uint8_t len;                                 /**< length of the queued payloads */
+    bool sending;                                /**< a queued uplink is in progress */
+    xtimer_t timer;                              /**< flush timer */
+    msg_t timer_msg;                             /**< message of the flush timer */
+} semtech_loramac_queue_t;
+#endif
+
 /**
  * @brief   Semtech LoRaMAC descriptor
  */
@@ -120,6 +163,9 @@ typedef struct {
     uint8_t devaddr[LORAMAC_DEVADDR_LEN];        /**< device address */
     semtech_loramac_rx_data_t rx_data;           /**< struct handling the RX data */
     semtech_loramac_link_check_info_t link_chk;  /**< link check information */
+#if defined(MODULE_SEMTECH_LORAMAC_QUEUE) || defined(DOXYGEN)
+    semtech_loramac_queue_t queue;               /**< uplink queue */
+#endif
 } semtech_loramac_t;
 
 /**
@@ -163,6 +209,44 @@ uint8_t semtech_loramac_join(semtech_loramac_t *mac, uint8_t type);
  */
 uint8_t semtech_loramac_send(semtech_loramac_t *mac, uint8_t *data, uint8_t len);
 
+#if defined(MODULE_SEMTECH_LORAMAC_QUEUE) || defined(DOXYGEN)
+/**
+ * @brief   Queues data for an uplink to the LoRaWAN network
+ *
+ * The payloads of several calls are concatenated and sent in one uplink on the
+ * configured port, so they must be self-delimiting, e.g. Cayenne LPP records.
+ * The uplink is sent when the next payload would not fit into a frame at the
+ * current data rate or @ref SEMTECH_LORAMAC_QUEUE_DELAY after the first
+ * payload was queued. If the MAC is busy or restricted by the duty cycle, the
+ * uplink is retried after @ref SEMTECH_LORAMAC_QUEUE_RETRY.
+ *
+ * This function returns immediately. The TX status of queued uplinks is not
+ * reported, received data can still be read with @ref semtech_loramac_recv.
+ *
+ * Only available with the `semtech_loramac_queue` module.
+ *
+ * @param[in] mac          Pointer to the mac
+ * @param[in] data         The TX data
+ * @param[in] len          The length of the TX data
+ *
+ * @return SEMTECH_LORAMAC_NOT_JOINED when the network is not joined
+ * @return SEMTECH_LORAMAC_BUSY when the queue is full
+ * @return SEMTECH_LORAMAC_TX_ERROR when @p data does not fit into a frame
+ * @return SEMTECH_LORAMAC_TX_SCHEDULE when @p data was queued
+ */
+uint8_t semtech_loramac_queue_send(semtech_loramac_t *mac, const uint8_t *data,
+                                   uint8_t len);
+
+/**
+ * @brief   Sends the queued payloads without waiting for more
+ *
+ * Only available with the `semtech_loramac_queue` module.
+ *
+ * @param[in] mac          Pointer to the mac
+ */
+void semtech_loramac_queue_flush(semtech_loramac_t *mac);
+#endif
+
 /**
  * @brief   Wait for a message sent by the LoRaWAN network
  *
@@ -24,6 +24,14 @@
  * used. Boards should use tlsf_add_global_pool() at startup to add all the memory
  * regions they want to make available for dynamic allocation via malloc().
  *
+ * All operations of the allocator take bounded time, so unlike the default
+ * newlib heap it can also be used from real-time threads. Threads that need
+ * an allocator of their own can create a separate heap on a static buffer
+ * with tlsf_create_with_pool() and use tlsf_malloc() on it directly.
+ *
+ * The size, the current and the maximum use of the global heap are tracked
+ * (see tlsf_get_global_stats()) and printed by the `heap` shell command.
+ *
  * @{
  * @file
  *
@@ -52,6 +60,16 @@ typedef struct {
     unsigned used;          /**< total used size */
 } tlsf_size_container_t;
 
+/**
+ * @brief Statistics of the global heap
+ */
+typedef struct {
+    size_t size;            /**< total size of all pools */
+    size_t used;            /**< size of all currently allocated blocks */
+    size_t max_used;        /**< maximum of `used` since startup */
+    unsigned failed;        /**< number of failed allocations */
+} tlsf_malloc_stats_t;
+
 /**
  * Walk the memory pool to print all block sizes and to calculate
  * the total amount of free and used block sizes.
@@ -88,6 +106,16 @@ int tlsf_add_global_pool(void *mem, size_t bytes);
  */
 tlsf_t *_tlsf_get_global_control(void);
 
+/**
+ * Get the statistics of the global heap.
+ *
+ * The sizes include the per-block overhead of TLSF, but not the overhead of
+ * the pools themselves.
+ *
+ * @param[out] stats    The statistics.
+ */
+void tlsf_get_global_stats(tlsf_malloc_stats_t *stats);
+
 
 #ifdef __cplusplus
 }
@@ -30,6 +30,11 @@
  **/
 static tlsf_t gheap = NULL;
 
+/**
+ * Statistics of the global heap, only accessed with interrupts disabled
+ **/
+static tlsf_malloc_stats_t gstats;
+
 /* TODO: Add defines for other compilers */
 #if defined(__GNUC__) && !defined(__clang__)    /* Clang supports __GNUC__ but
                                                  * not the alloc_size()
@@ -49,15 +54,56 @@ static tlsf_t gheap = NULL;
 
 #endif /* __GNUC__ */
 
+/**
+ * Account for an allocated block of data, called with interrupts disabled
+ **/
+static void _stats_alloc(void *ptr)
+{
+    if (ptr == NULL) {
+        gstats.failed++;
+        return;
+    }
+    gstats.used += tlsf_block_size(ptr);
+    if (gstats.used > gstats.max_used) {
+        gstats.max_used = gstats.used;
+    }
+}
+
 int tlsf_add_global_pool(void *mem, size_t bytes)
 {
+    int res;
+
     if (gheap == NULL) {
         gheap = tlsf_create_with_pool(mem, bytes);
-        return gheap == NULL;
+        res = gheap == NULL;
     }
     else {
-        return tlsf_add_pool(gheap, mem, bytes) == NULL;
+        res = tlsf_add_pool(gheap, mem, bytes) == NULL;
+    }
+    if (res == 0) {
+        gstats.size += bytes;
     }
+    return res;
+}
+
+void tlsf_get_global_stats(tlsf_malloc_stats_t *stats)
+{
+    unsigned old_state = irq_disable();
+
+    *stats = gstats;
+    irq_restore(old_state);
+}
+
+void heap_stats(void)
+{
+    tlsf_malloc_stats_t stats;
+
+    tlsf_get_global_stats(&stats);
+    printf("heap: %u (used %u, free %u, max used %u) [bytes]\n"
+           "failed allocations: %u\n",
+           (unsigned)stats.size, (unsigned)stats.used,
+           (unsigned)(stats.size - stats.used), (unsigned)stats.max_used,
+           stats.failed);
 }
 
 tlsf_t *_tlsf_get_global_control(void)
@@ -85,6 +131,7 @@ ATTR_MALLOC void *malloc(size_t bytes)
     unsigned old_state = irq_disable();
     void *result = tlsf_malloc(gheap, bytes);
 
+    _stats_alloc(result);
     irq_restore(old_state);
     return result;
 }
@@ -110,6 +157,7 @@ ATTR_MALIGN void *memalign(size_t align, size_t bytes)
     unsigned old_state = irq_disable();
     void *result = tlsf_memalign(gheap, align, bytes);
 
+    _stats_alloc(result);
     irq_restore(old_state);
     return result;
 }
@@ -120,8 +168,16 @@ ATTR_MALIGN void *memalign(size_t align, size_t bytes)
 ATTR_REALLOC void *realloc(void *ptr, size_t size)
 {
     unsigned old_state = irq_disable();
+    size_t old_size = tlsf_block_size(ptr);
     void *result = tlsf_realloc(gheap, ptr, size);
 
+    if ((result != NULL) || (size == 0)) {
+        /* on failure the old block stays allocated */
+        gstats.used -= old_size;
+    }
+    if (size > 0) {
+        _stats_alloc(result);
+    }
     irq_restore(old_state);
     return result;
 }
@@ -134,6 +190,7 @@ void free(void *ptr)
 {
     unsigned old_state = irq_disable();
 
+    gstats.used -= tlsf_block_size(ptr);
     tlsf_free(gheap, ptr);
     irq_restore(old_state);
 }
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     pkg_u8g2
+ * @{
+ *
+ * @file
+ * @brief       Partial display updates for U8g2 full buffer mode
+ *
+ * u8g2_SendBuffer() transfers the whole frame, even if only a few pixels
+ * changed. Instead, record the changed regions with @ref u8g2_riotos_mark
+ * while drawing and send only the tiles (8x8 pixels) covering them with
+ * @ref u8g2_riotos_update.
+ *
+ * Only available in full buffer mode (`u8g2_Setup_*_f()`) and for displays
+ * with a vertical tile layout, like the SSD1306 family.
+ */
+
+#ifndef U8G2_RIOTOS_H
+#define U8G2_RIOTOS_H
+
+#include <stdint.h>
+
+#include "u8g2.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Region of the display that changed, in tiles
+ */
+typedef struct {
+    uint8_t tx0;    /**< first dirty tile column */
+    uint8_t ty0;    /**< first dirty tile row */
+    uint8_t tx1;    /**< first clean tile column after the region */
+    uint8_t ty1;    /**< first clean tile row after the region */
+} u8g2_riotos_area_t;
+
+/**
+ * @brief   Static initializer for an empty region
+ */
+#define U8G2_RIOTOS_AREA_INIT   { 0xff, 0xff, 0, 0 }
+
+/**
+ * @brief   Add a rectangle of pixels to the dirty region
+ *
+ * @param[in,out] area  dirty region
+ * @param[in]     x     left pixel column
+ * @param[in]     y     top pixel row
+ * @param[in]     w     width in pixels
+ * @param[in]     h     height in pixels
+ */
+void u8g2_riotos_mark(u8g2_riotos_area_t *area, u8g2_uint_t x, u8g2_uint_t y,
+                      u8g2_uint_t w, u8g2_uint_t h);
+
+/**
+ * @brief   Send the tiles of the dirty region to the display and clear it
+ *
+ * Falls back to u8g2_SendBuffer() if the display is not in full buffer mode.
+ *
+ * @param[in]     u8g2  display
+ * @param[in,out] area  dirty region
+ */
+void u8g2_riotos_update(u8g2_t *u8g2, u8g2_riotos_area_t *area);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* U8G2_RIOTOS_H */
+/** @} */
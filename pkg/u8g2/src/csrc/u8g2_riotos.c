@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include "u8g2.h"
+#include "u8g2_riotos.h"
 
 #include "xtimer.h"
 #include "periph/spi.h"
@@ -180,3 +181,58 @@ uint8_t u8x8_byte_riotos_hw_i2c(u8x8_t *u8g2, uint8_t msg, uint8_t arg_int, void
     return 1;
 }
 #endif /* I2C_NUMOF */
+
+void u8g2_riotos_mark(u8g2_riotos_area_t *area, u8g2_uint_t x, u8g2_uint_t y,
+                      u8g2_uint_t w, u8g2_uint_t h)
+{
+    if ((w == 0) || (h == 0)) {
+        return;
+    }
+
+    uint8_t tx0 = x / 8;
+    uint8_t ty0 = y / 8;
+    uint8_t tx1 = (x + w + 7) / 8;
+    uint8_t ty1 = (y + h + 7) / 8;
+
+    if (tx0 < area->tx0) {
+        area->tx0 = tx0;
+    }
+    if (ty0 < area->ty0) {
+        area->ty0 = ty0;
+    }
+    if (tx1 > area->tx1) {
+        area->tx1 = tx1;
+    }
+    if (ty1 > area->ty1) {
+        area->ty1 = ty1;
+    }
+}
+
+void u8g2_riotos_update(u8g2_t *u8g2, u8g2_riotos_area_t *area)
+{
+    u8x8_t *u8x8 = u8g2_GetU8x8(u8g2);
+    const u8x8_display_info_t *info = u8x8->display_info;
+
+    if (u8g2->tile_buf_height != info->tile_height) {
+        /* page buffer mode, there is no frame to pick tiles from */
+        u8g2_SendBuffer(u8g2);
+    }
+    else {
+        uint8_t tx1 = (area->tx1 < info->tile_width) ? area->tx1
+                                                     : info->tile_width;
+        uint8_t ty1 = (area->ty1 < info->tile_height) ? area->ty1
+                                                      : info->tile_height;
+        uint8_t *ptr = u8g2->tile_buf_ptr + area->ty0 * u8g2->pixel_buf_width +
+                       area->tx0 * 8;
+
+        for (uint8_t ty = area->ty0; (ty < ty1) && (area->tx0 < tx1); ty++) {
+            u8x8_DrawTile(u8x8, area->tx0, ty, tx1 - area->tx0, ptr);
+            ptr += u8g2->pixel_buf_width;
+        }
+    }
+
+    area->tx0 = 0xff;
+    area->ty0 = 0xff;
+    area->tx1 = 0;
+    area->ty1 = 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_arena
+ * @{
+ *
+ * @file
+ * @brief       Arena allocator implementation
+ *
+ * @}
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#define ALIGN_UP(x)     (((x) + (ARENA_ALIGNMENT - 1)) & ~(ARENA_ALIGNMENT - 1))
+/* chained memory starts at an aligned offset behind the chunk header */
+#define CHUNK_HDR_LEN   ALIGN_UP(sizeof(arena_chunk_t))
+
+/* align the start of the current block */
+static void _align(arena_t *arena)
+{
+    uintptr_t pos = ALIGN_UP((uintptr_t)arena->pos);
+
+    arena->pos = (pos > (uintptr_t)arena->end) ? arena->end : (uint8_t *)pos;
+}
+
+void arena_init(arena_t *arena, void *buf, size_t size)
+{
+    arena->buf = buf;
+    arena->size = size;
+    arena->chunks = NULL;
+    arena->chunk_size = 0;
+    arena->pos = buf;
+    arena->end = arena->pos + size;
+    _align(arena);
+}
+
+void *arena_alloc(arena_t *arena, size_t size)
+{
+    void *ptr;
+
+    if (size == 0) {
+        return NULL;
+    }
+    if (size > arena_available(arena)) {
+        if ((arena->chunk_size == 0) ||
+            (size > SIZE_MAX - CHUNK_HDR_LEN - ARENA_ALIGNMENT)) {
+            DEBUG("arena: %u bytes exceed the arena\n", (unsigned)size);
+            return NULL;
+        }
+
+        size_t len = (size > arena->chunk_size) ? size : arena->chunk_size;
+        arena_chunk_t *chunk = malloc(CHUNK_HDR_LEN + len);
+
+        if (chunk == NULL) {
+            DEBUG("arena: can't chain a block of %u bytes\n", (unsigned)len);
+            return NULL;
+        }
+        DEBUG("arena: chained a block of %u bytes\n", (unsigned)len);
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+        /* the rest of the previous block is given up */
+        arena->pos = (uint8_t *)chunk + CHUNK_HDR_LEN;
+        arena->end = arena->pos + len;
+    }
+
+    ptr = arena->pos;
+    arena->pos += size;
+    _align(arena);
+    return ptr;
+}
+
+void *arena_calloc(arena_t *arena, size_t nmemb, size_t size)
+{
+    if ((size != 0) && (nmemb > SIZE_MAX / size)) {
+        return NULL;
+    }
+
+    void *ptr = arena_alloc(arena, nmemb * size);
+
+    if (ptr != NULL) {
+        memset(ptr, 0, nmemb * size);
+    }
+    return ptr;
+}
+
+void arena_reset(arena_t *arena)
+{
+    while (arena->chunks != NULL) {
+        arena_chunk_t *chunk = arena->chunks;
+
+        arena->chunks = chunk->next;
+        free(chunk);
+    }
+    arena->pos = arena->buf;
+    arena->end = arena->buf + arena->size;
+    _align(arena);
+}
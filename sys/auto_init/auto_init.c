@@ -28,6 +28,10 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_LPTIMER
+#include "lptimer.h"
+#endif
+
 #ifdef MODULE_GNRC_SIXLOWPAN
 #include "net/gnrc/sixlowpan.h"
 #endif
@@ -48,6 +52,10 @@
 #include "net/gnrc/pktdump.h"
 #endif
 
+#ifdef MODULE_NETCAP
+#include "net/netcap.h"
+#endif
+
 #ifdef MODULE_GNRC_UDP
 #include "net/gnrc/udp.h"
 #endif
@@ -76,6 +84,10 @@
 #include "net/gnrc/ipv6/nib.h"
 #endif
 
+#ifdef MODULE_GNRC_IPV6_MPL
+#include "net/gnrc/ipv6/mpl.h"
+#endif
+
 #ifdef MODULE_SKALD
 #include "net/skald.h"
 #endif
@@ -88,9 +100,243 @@
 #include "net/asymcute.h"
 #endif
 
+#ifdef MODULE_AUTO_INIT_DEFERRED
+#include "mutex.h"
+#include "thread.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+/* initializes sensors and actuators, these are not needed before main() */
+static void _auto_init_sensors(void)
+{
+#ifdef MODULE_SHT1X
+    /* The sht1x module needs to be initialized regardless of SAUL being used,
+     * as the shell commands rely on auto-initialization. auto_init_sht1x also
+     * performs SAUL registration, but only if module auto_init_saul is used.
+     */
+    DEBUG("Auto init SHT1X module (SHT10/SHT11/SHT15 sensor driver).\n");
+    extern void auto_init_sht1x(void);
+    auto_init_sht1x();
+#endif
+
+#ifdef MODULE_AUTO_INIT_SAUL
+    DEBUG("auto_init SAUL\n");
+
+#ifdef MODULE_SAUL_ADC
+    extern void auto_init_adc(void);
+    auto_init_adc();
+#endif
+#ifdef MODULE_SAUL_GPIO
+    extern void auto_init_gpio(void);
+    auto_init_gpio();
+#endif
+#ifdef MODULE_ADCXX1C
+    extern void auto_init_adcxx1c(void);
+    auto_init_adcxx1c();
+#endif
+#ifdef MODULE_ADS101X
+    extern void auto_init_ads101x(void);
+    auto_init_ads101x();
+#endif
+#ifdef MODULE_ADXL345
+    extern void auto_init_adxl345(void);
+    auto_init_adxl345();
+#endif
+#ifdef MODULE_BMP180
+    extern void auto_init_bmp180(void);
+    auto_init_bmp180();
+#endif
+#if defined(MODULE_BME280) || defined(MODULE_BMP280)
+    extern void auto_init_bmx280(void);
+    auto_init_bmx280();
+#endif
+#ifdef MODULE_BMX055
+    extern void auto_init_bmx055(void);
+    auto_init_bmx055();
+#endif
+#ifdef MODULE_CCS811
+    extern void auto_init_ccs811(void);
+    auto_init_ccs811();
+#endif
+#ifdef MODULE_DHT
+    extern void auto_init_dht(void);
+    auto_init_dht();
+#endif
+#ifdef MODULE_DS18
+    extern void auto_init_ds18(void);
+    auto_init_ds18();
+#endif
+#ifdef MODULE_FXOS8700
+    extern void auto_init_fxos8700(void);
+    auto_init_fxos8700();
+#endif
+#ifdef MODULE_GROVE_LEDBAR
+    extern void auto_init_grove_ledbar(void);
+    auto_init_grove_ledbar();
+#endif
+#ifdef MODULE_HDC1000
+    extern void auto_init_hdc1000(void);
+    auto_init_hdc1000();
+#endif
+#ifdef MODULE_HTS221
+    extern void auto_init_hts221(void);
+    auto_init_hts221();
+#endif
+#ifdef MODULE_IO1_XPLAINED
+    extern void auto_init_io1_xplained(void);
+    auto_init_io1_xplained();
+#endif
+#ifdef MODULE_ISL29020
+    extern void auto_init_isl29020(void);
+    auto_init_isl29020();
+#endif
+#ifdef MODULE_JC42
+    extern void auto_init_jc42(void);
+    auto_init_jc42();
+#endif
+#ifdef MODULE_L3G4200D
+    extern void auto_init_l3g4200d(void);
+    auto_init_l3g4200d();
+#endif
+#ifdef MODULE_LIS2DH12
+    extern void auto_init_lis2dh12(void);
+    auto_init_lis2dh12();
+#endif
+#ifdef MODULE_LIS3DH
+    extern void auto_init_lis3dh(void);
+    auto_init_lis3dh();
+#endif
+#ifdef MODULE_LIS3MDL
+    extern void auto_init_lis3mdl(void);
+    auto_init_lis3mdl();
+#endif
+#ifdef MODULE_LPS331AP
+    extern void auto_init_lps331ap(void);
+    auto_init_lps331ap();
+#endif
+#ifdef MODULE_LSM303DLHC
+    extern void auto_init_lsm303dlhc(void);
+    auto_init_lsm303dlhc();
+#endif
+#ifdef MODULE_LSM6DSL
+    extern void auto_init_lsm6dsl(void);
+    auto_init_lsm6dsl();
+#endif
+#ifdef MODULE_MAG3110
+    extern void auto_init_mag3110(void);
+    auto_init_mag3110();
+#endif
+#ifdef MODULE_MMA7660
+    extern void auto_init_mma7660(void);
+    auto_init_mma7660();
+#endif
+#ifdef MODULE_MMA8X5X
+    extern void auto_init_mma8x5x(void);
+    auto_init_mma8x5x();
+#endif
+#ifdef MODULE_MPL3115A2
+    extern void auto_init_mpl3115a2(void);
+    auto_init_mpl3115a2();
+#endif
+#ifdef MODULE_MPU9150
+    extern void auto_init_mpu9150(void);
+    auto_init_mpu9150();
+#endif
+#ifdef MODULE_PIR
+    extern void auto_init_pir(void);
+    auto_init_pir();
+#endif
+#ifdef MODULE_PULSE_COUNTER
+    extern void auto_init_pulse_counter(void);
+    auto_init_pulse_counter();
+#endif
+#ifdef MODULE_SHT3X
+    extern void auto_init_sht3x(void);
+    auto_init_sht3x();
+#endif
+#ifdef MODULE_SI114X
+    extern void auto_init_si114x(void);
+    auto_init_si114x();
+#endif
+#ifdef MODULE_SI70XX
+    extern void auto_init_si70xx(void);
+    auto_init_si70xx();
+#endif
+#ifdef MODULE_TCS37727
+    extern void auto_init_tcs37727(void);
+    auto_init_tcs37727();
+#endif
+#ifdef MODULE_TMP006
+    extern void auto_init_tmp006(void);
+    auto_init_tmp006();
+#endif
+#ifdef MODULE_TSL2561
+    extern void auto_init_tsl2561(void);
+    auto_init_tsl2561();
+#endif
+#ifdef MODULE_TSL4531X
+    extern void auto_init_tsl4531x(void);
+    auto_init_tsl4531x();
+#endif
+#ifdef MODULE_VCNL40X0
+    extern void auto_init_vcnl40x0(void);
+    auto_init_vcnl40x0();
+#endif
+#ifdef MODULE_VEML6070
+    extern void auto_init_veml6070(void);
+    auto_init_veml6070();
+#endif
+
+#endif /* MODULE_AUTO_INIT_SAUL */
+}
+
+/* initializes storage devices, these are not needed before main() */
+static void _auto_init_storage(void)
+{
+#ifdef MODULE_AUTO_INIT_STORAGE
+    DEBUG("auto_init STORAGE\n");
+
+#ifdef MODULE_SDCARD_SPI
+    extern void auto_init_sdcard_spi(void);
+    auto_init_sdcard_spi();
+#endif
+
+#endif /* MODULE_AUTO_INIT_STORAGE */
+
+#ifdef MODULE_AUTO_INIT_CAN
+    DEBUG("auto_init CAN\n");
+
+    extern void auto_init_candev(void);
+    auto_init_candev();
+
+#endif /* MODULE_AUTO_INIT_CAN */
+}
+
+#ifdef MODULE_AUTO_INIT_DEFERRED
+static char _deferred_stack[AUTO_INIT_DEFERRED_STACKSIZE];
+static mutex_t _deferred_done = MUTEX_INIT_LOCKED;
+
+static void *_deferred_thread(void *arg)
+{
+    (void)arg;
+
+    _auto_init_sensors();
+    _auto_init_storage();
+    DEBUG("auto_init: deferred initialization done\n");
+    mutex_unlock(&_deferred_done);
+    return NULL;
+}
+
+void auto_init_wait(void)
+{
+    /* pass the unlocked mutex on to other waiting threads */
+    mutex_lock(&_deferred_done);
+    mutex_unlock(&_deferred_done);
+}
+#endif
+
 void auto_init(void)
 {
 #ifdef MODULE_PRNG
@@ -101,6 +347,10 @@ void auto_init(void)
     DEBUG("Auto init xtimer module.\n");
     xtimer_init();
 #endif
+#ifdef MODULE_LPTIMER
+    DEBUG("Auto init lptimer module.\n");
+    lptimer_init();
+#endif
 #ifdef MODULE_MCI
     DEBUG("Auto init mci module.\n");
     mci_initialize();
@@ -117,6 +367,10 @@ void auto_init(void)
     DEBUG("Auto init gnrc_pktdump module.\n");
     gnrc_pktdump_init();
 #endif
+#ifdef MODULE_NETCAP
+    DEBUG("Auto init netcap module.\n");
+    netcap_init();
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN
     DEBUG("Auto init gnrc_sixlowpan module.\n");
     gnrc_sixlowpan_init();
@@ -271,6 +525,11 @@ void auto_init(void)
     gnrc_nordic_ble_6lowpan_init();
 #endif
 
+#ifdef MODULE_NIMBLE_NETIF
+    extern void nimble_netif_init(void);
+    nimble_netif_init();
+#endif
+
 #ifdef MODULE_NRFMIN
     extern void gnrc_nrfmin_init(void);
     gnrc_nrfmin_init();
@@ -299,187 +558,10 @@ void auto_init(void)
     ndn_init();
 #endif
 
-/* initialize sensors and actuators */
-#ifdef MODULE_SHT1X
-    /* The sht1x module needs to be initialized regardless of SAUL being used,
-     * as the shell commands rely on auto-initialization. auto_init_sht1x also
-     * performs SAUL registration, but only if module auto_init_saul is used.
-     */
-    DEBUG("Auto init SHT1X module (SHT10/SHT11/SHT15 sensor driver).\n");
-    extern void auto_init_sht1x(void);
-    auto_init_sht1x();
+#ifndef MODULE_AUTO_INIT_DEFERRED
+    _auto_init_sensors();
 #endif
 
-#ifdef MODULE_AUTO_INIT_SAUL
-    DEBUG("auto_init SAUL\n");
-
-#ifdef MODULE_SAUL_ADC
-    extern void auto_init_adc(void);
-    auto_init_adc();
-#endif
-#ifdef MODULE_SAUL_GPIO
-    extern void auto_init_gpio(void);
-    auto_init_gpio();
-#endif
-#ifdef MODULE_ADCXX1C
-    extern void auto_init_adcxx1c(void);
-    auto_init_adcxx1c();
-#endif
-#ifdef MODULE_ADS101X
-    extern void auto_init_ads101x(void);
-    auto_init_ads101x();
-#endif
-#ifdef MODULE_ADXL345
-    extern void auto_init_adxl345(void);
-    auto_init_adxl345();
-#endif
-#ifdef MODULE_BMP180
-    extern void auto_init_bmp180(void);
-    auto_init_bmp180();
-#endif
-#if defined(MODULE_BME280) || defined(MODULE_BMP280)
-    extern void auto_init_bmx280(void);
-    auto_init_bmx280();
-#endif
-#ifdef MODULE_BMX055
-    extern void auto_init_bmx055(void);
-    auto_init_bmx055();
-#endif
-#ifdef MODULE_CCS811
-    extern void auto_init_ccs811(void);
-    auto_init_ccs811();
-#endif
-#ifdef MODULE_DHT
-    extern void auto_init_dht(void);
-    auto_init_dht();
-#endif
-#ifdef MODULE_DS18
-    extern void auto_init_ds18(void);
-    auto_init_ds18();
-#endif
-#ifdef MODULE_FXOS8700
-    extern void auto_init_fxos8700(void);
-    auto_init_fxos8700();
-#endif
-#ifdef MODULE_GROVE_LEDBAR
-    extern void auto_init_grove_ledbar(void);
-    auto_init_grove_ledbar();
-#endif
-#ifdef MODULE_HDC1000
-    extern void auto_init_hdc1000(void);
-    auto_init_hdc1000();
-#endif
-#ifdef MODULE_HTS221
-    extern void auto_init_hts221(void);
-    auto_init_hts221();
-#endif
-#ifdef MODULE_IO1_XPLAINED
-    extern void auto_init_io1_xplained(void);
-    auto_init_io1_xplained();
-#endif
-#ifdef MODULE_ISL29020
-    extern void auto_init_isl29020(void);
-    auto_init_isl29020();
-#endif
-#ifdef MODULE_JC42
-    extern void auto_init_jc42(void);
-    auto_init_jc42();
-#endif
-#ifdef MODULE_L3G4200D
-    extern void auto_init_l3g4200d(void);
-    auto_init_l3g4200d();
-#endif
-#ifdef MODULE_LIS2DH12
-    extern void auto_init_lis2dh12(void);
-    auto_init_lis2dh12();
-#endif
-#ifdef MODULE_LIS3DH
-    extern void auto_init_lis3dh(void);
-    auto_init_lis3dh();
-#endif
-#ifdef MODULE_LIS3MDL
-    extern void auto_init_lis3mdl(void);
-    auto_init_lis3mdl();
-#endif
-#ifdef MODULE_LPS331AP
-    extern void auto_init_lps331ap(void);
-    auto_init_lps331ap();
-#endif
-#ifdef MODULE_LSM303DLHC
-    extern void auto_init_lsm303dlhc(void);
-    auto_init_lsm303dlhc();
-#endif
-#ifdef MODULE_LSM6DSL
-    extern void auto_init_lsm6dsl(void);
-    auto_init_lsm6dsl();
-#endif
-#ifdef MODULE_MAG3110
-    extern void auto_init_mag3110(void);
-    auto_init_mag3110();
-#endif
-#ifdef MODULE_MMA7660
-    extern void auto_init_mma7660(void);
-    auto_init_mma7660();
-#endif
-#ifdef MODULE_MMA8X5X
-    extern void auto_init_mma8x5x(void);
-    auto_init_mma8x5x();
-#endif
-#ifdef MODULE_MPL3115A2
-    extern void auto_init_mpl3115a2(void);
-    auto_init_mpl3115a2();
-#endif
-#ifdef MODULE_MPU9150
-    extern void auto_init_mpu9150(void);
-    auto_init_mpu9150();
-#endif
-#ifdef MODULE_PIR
-    extern void auto_init_pir(void);
-    auto_init_pir();
-#endif
-#ifdef MODULE_PULSE_COUNTER
-    extern void auto_init_pulse_counter(void);
-    auto_init_pulse_counter();
-#endif
-#ifdef MODULE_SHT3X
-    extern void auto_init_sht3x(void);
-    auto_init_sht3x();
-#endif
-#ifdef MODULE_SI114X
-    extern void auto_init_si114x(void);
-    auto_init_si114x();
-#endif
-#ifdef MODULE_SI70XX
-    extern void auto_init_si70xx(void);
-    auto_init_si70xx();
-#endif
-#ifdef MODULE_TCS37727
-    extern void auto_init_tcs37727(void);
-    auto_init_tcs37727();
-#endif
-#ifdef MODULE_TMP006
-    extern void auto_init_tmp006(void);
-    auto_init_tmp006();
-#endif
-#ifdef MODULE_TSL2561
-    extern void auto_init_tsl2561(void);
-    auto_init_tsl2561();
-#endif
-#ifdef MODULE_TSL4531X
-    extern void auto_init_tsl4531x(void);
-    auto_init_tsl4531x();
-#endif
-#ifdef MODULE_VCNL40X0
-    extern void auto_init_vcnl40x0(void);
-    auto_init_vcnl40x0();
-#endif
-#ifdef MODULE_VEML6070
-    extern void auto_init_veml6070(void);
-    auto_init_veml6070();
-#endif
-
-#endif /* MODULE_AUTO_INIT_SAUL */
-
 #ifdef MODULE_AUTO_INIT_GNRC_RPL
 
 #ifdef MODULE_GNRC_RPL
@@ -489,22 +571,20 @@ void auto_init(void)
 
 #endif /* MODULE_AUTO_INIT_GNRC_RPL */
 
-/* initialize storage devices */
-#ifdef MODULE_AUTO_INIT_STORAGE
-    DEBUG("auto_init STORAGE\n");
-
-#ifdef MODULE_SDCARD_SPI
-    extern void auto_init_sdcard_spi(void);
-    auto_init_sdcard_spi();
+#ifdef MODULE_GNRC_IPV6_MPL
+    /* after the network interfaces, so they join all-MPL-forwarders */
+    DEBUG("Auto init gnrc_ipv6_mpl module.\n");
+    gnrc_ipv6_mpl_init();
 #endif
 
-#endif /* MODULE_AUTO_INIT_STORAGE */
-
-#ifdef MODULE_AUTO_INIT_CAN
-    DEBUG("auto_init CAN\n");
-
-    extern void auto_init_candev(void);
-    auto_init_candev();
-
-#endif /* MODULE_AUTO_INIT_CAN */
+#ifdef MODULE_AUTO_INIT_DEFERRED
+    if (thread_create(_deferred_stack, sizeof(_deferred_stack),
+                      AUTO_INIT_DEFERRED_PRIO, THREAD_CREATE_STACKTEST,
+                      _deferred_thread, NULL, "auto_init") < 0) {
+        _deferred_thread(NULL);
+    }
+#else
+    _auto_init_storage();
+#endif
 }
+
@@ -28,6 +28,9 @@
 #ifdef MODULE_GNRC_GOMACH
 #include "net/gnrc/gomach/gomach.h"
 #endif
+#ifdef MODULE_GNRC_TSCH
+#include "net/gnrc/tsch/tsch.h"
+#endif
 #include "net/gnrc.h"
 
 #include "at86rf2xx.h"
@@ -63,6 +66,11 @@ void auto_init_at86rf2xx(void)
                                 AT86RF2XX_MAC_STACKSIZE,
                                 AT86RF2XX_MAC_PRIO, "at86rf2xx-lwmac",
                                 (netdev_t *)&at86rf2xx_devs[i]);
+#elif defined(MODULE_GNRC_TSCH)
+        gnrc_netif_tsch_create(_at86rf2xx_stacks[i],
+                               AT86RF2XX_MAC_STACKSIZE,
+                               AT86RF2XX_MAC_PRIO, "at86rf2xx-tsch",
+                               (netdev_t *)&at86rf2xx_devs[i]);
 #else
         gnrc_netif_ieee802154_create(_at86rf2xx_stacks[i],
                                      AT86RF2XX_MAC_STACKSIZE,
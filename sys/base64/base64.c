@@ -18,46 +18,87 @@
  *
  */
 
+#include <stdint.h>
+
 #include "base64.h"
 
-#define BASE64_CAPITAL_UPPER_BOUND     (25)     /**< base64 'Z'           */
-#define BASE64_SMALL_UPPER_BOUND       (51)     /**< base64 'z'           */
-#define BASE64_NUMBER_UPPER_BOUND      (61)     /**< base64 '9'           */
-#define BASE64_PLUS                    (62)     /**< base64 '+'           */
-#define BASE64_SLASH                   (63)     /**< base64 '/'           */
 #define BASE64_EQUALS                  (0xFE)   /**< no base64 symbol '=' */
 #define BASE64_NOT_DEFINED             (0xFF)   /**< no base64 symbol     */
 
+/* the first symbol in the decoding table */
+#define BASE64_DEC_FIRST               ('+')
+
+static const char _enc_std[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const char _enc_url[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/*
+ * maps the symbols '+' to 'z' to their codes, accepting both the standard
+ * and the URL safe alphabet
+ */
+static const uint8_t _dec[] = {
+    62,   0xFF, 62,   0xFF, 63,                             /* + , - . / */
+    52,   53,   54,   55,   56,   57,   58,   59,   60,   61, /* 0 - 9 */
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,               /* : - @ */
+    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,  /* A - J */
+    10,   11,   12,   13,   14,   15,   16,   17,   18,   19, /* K - T */
+    20,   21,   22,   23,   24,   25,                       /* U - Z */
+    0xFF, 0xFF, 0xFF, 0xFF, 63,   0xFF,                     /* [ - ` */
+    26,   27,   28,   29,   30,   31,   32,   33,   34,   35, /* a - j */
+    36,   37,   38,   39,   40,   41,   42,   43,   44,   45, /* k - t */
+    46,   47,   48,   49,   50,   51,                       /* u - z */
+};
+
 /*
- * returns the corresponding ascii symbol value for the given base64 code
+ *  returns the corresponding base64 code for the given ascii symbol
  */
-static char getsymbol(unsigned char code)
+static inline uint8_t getcode(unsigned char symbol)
 {
-    if (code == BASE64_SLASH) {
-        return '/';
+    symbol -= BASE64_DEC_FIRST;
+    if (symbol >= sizeof(_dec)) {
+        /* indicates that the given symbol is not base64 and should be ignored */
+        return BASE64_NOT_DEFINED;
     }
+    return _dec[symbol];
+}
 
-    if (code == BASE64_PLUS) {
-        return '+';
-    }
+static void _encode_group(const char *alphabet, const unsigned char *in,
+                          unsigned char *out)
+{
+    uint32_t group = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
 
-    if (code <= BASE64_CAPITAL_UPPER_BOUND) {
-        return (code + 'A');
-    }
+    out[0] = alphabet[group >> 18];
+    out[1] = alphabet[(group >> 12) & 0x3f];
+    out[2] = alphabet[(group >> 6) & 0x3f];
+    out[3] = alphabet[group & 0x3f];
+}
 
-    if (code <= BASE64_SMALL_UPPER_BOUND) {
-        return (code + ('z' - BASE64_SMALL_UPPER_BOUND));
-    }
+static size_t _encode_tail(const char *alphabet, const unsigned char *in,
+                           size_t len, unsigned char *out)
+{
+    unsigned char group[3] = { 0 };
 
-    if (code <= BASE64_NUMBER_UPPER_BOUND) {
-        return (code + ('9' - BASE64_NUMBER_UPPER_BOUND));
+    if (len == 0) {
+        return 0;
     }
-
-    return (char)BASE64_NOT_DEFINED;
+    group[0] = in[0];
+    if (len > 1) {
+        group[1] = in[1];
+    }
+    _encode_group(alphabet, group, out);
+    /* if required we append '=' for the required dividability */
+    out[3] = '=';
+    if (len == 1) {
+        out[2] = '=';
+    }
+    return 4;
 }
 
-int base64_encode(const void *data_in, size_t data_in_size,
-                  unsigned char *base64_out, size_t *base64_out_size)
+static int _encode(const char *alphabet, const void *data_in,
+                   size_t data_in_size, unsigned char *base64_out,
+                   size_t *base64_out_size)
 {
     const unsigned char *in = data_in;
     size_t required_size = 4 * ((data_in_size + 2) / 3);
@@ -79,91 +120,35 @@ int base64_encode(const void *data_in, size_t data_in_size,
         return BASE64_ERROR_BUFFER_OUT;
     }
 
-    int iterate_base64_buffer = 0;
-    unsigned char nNum = 0;
-    int nLst = 0;
-    int njump = 0;
-
-    for (int i = 0; i < (int)(data_in_size); ++i) {
-        unsigned char tmpval;
-        njump++;
-        tmpval = *(in + i);
-
-        nNum = (tmpval >> (2 * njump));
-
-        if (njump == 4) {
-            nNum = nLst << (8 - 2 * njump);
-            njump = 0;
-            nLst = 0;
-            --i;
-        }
-        else {
-            nNum += nLst << (8 - 2 * njump);
-            nLst =  tmpval & ((1 << njump * 2) - 1);
-        }
-
-        base64_out[iterate_base64_buffer++] = getsymbol(nNum);
-    }
-
-    /* The last character is not finished yet */
-    njump++;
-
-    nNum = nLst << (8 - 2 * njump);
-    base64_out[iterate_base64_buffer++] = getsymbol(nNum);
-
-    /* if required we append '=' for the required dividability */
-    while (iterate_base64_buffer % 4) {
-        base64_out[iterate_base64_buffer++] = '=';
+    unsigned char *out = base64_out;
+    while (data_in_size >= 3) {
+        _encode_group(alphabet, in, out);
+        in += 3;
+        out += 4;
+        data_in_size -= 3;
     }
+    out += _encode_tail(alphabet, in, data_in_size, out);
 
-    *base64_out_size = iterate_base64_buffer;
+    *base64_out_size = out - base64_out;
 
     return BASE64_SUCCESS;
 }
 
-/*
- *  returns the corresponding base64 code for the given ascii symbol
- */
-static int getcode(char symbol)
+int base64_encode(const void *data_in, size_t data_in_size,
+                  unsigned char *base64_out, size_t *base64_out_size)
 {
-    if (symbol == '/') {
-        return BASE64_SLASH;
-    }
-
-    if (symbol == '+') {
-        return BASE64_PLUS;
-    }
-
-    if (symbol == '=') {
-        /* indicates a padded base64 end */
-        return BASE64_EQUALS;
-    }
-
-    if (symbol < '0') {
-        /* indicates that the given symbol is not base64 and should be ignored */
-        return BASE64_NOT_DEFINED;
-    }
-
-    if (symbol <= '9' && symbol >= '0') {
-        return (symbol + (BASE64_NUMBER_UPPER_BOUND - '9'));
-    }
-
-    if (symbol <= 'Z' && symbol >= 'A') {
-        return (symbol - 'A');
-    }
-
-    if (symbol <= 'z' && symbol >= 'a') {
-        return (symbol + (BASE64_SMALL_UPPER_BOUND - 'z'));
-    }
+    return _encode(_enc_std, data_in, data_in_size, base64_out, base64_out_size);
+}
 
-    /* indicates that the given symbol is not base64 and should be ignored */
-    return BASE64_NOT_DEFINED;
+int base64url_encode(const void *data_in, size_t data_in_size,
+                     unsigned char *base64_out, size_t *base64_out_size)
+{
+    return _encode(_enc_url, data_in, data_in_size, base64_out, base64_out_size);
 }
 
 int base64_decode(const unsigned char *base64_in, size_t base64_in_size,
                   void *data_out, size_t *data_out_size)
 {
-    unsigned char *out = data_out;
     size_t required_size = ((base64_in_size / 4) * 3);
 
     if (base64_in == NULL) {
@@ -183,34 +168,109 @@ int base64_decode(const unsigned char *base64_in, size_t base64_in_size,
         return BASE64_ERROR_BUFFER_OUT;
     }
 
-    int iterate_data_buffer = 0;
-    unsigned char nNum = 0;
-    int nLst = getcode(base64_in[0]) << 2;
-    int code = 0;
-
-    int mask = 2;
+    unsigned char *out = data_out;
+    unsigned char *out_end = out + *data_out_size;
+    const unsigned char *in = base64_in;
+    const unsigned char *in_end = base64_in + base64_in_size;
+    uint32_t group = 0;
+    unsigned codes = 0;
+
+    /* fast path for groups of four valid symbols */
+    while (((in_end - in) >= 4) && ((out_end - out) >= 3)) {
+        uint8_t a = getcode(in[0]);
+        uint8_t b = getcode(in[1]);
+        uint8_t c = getcode(in[2]);
+        uint8_t d = getcode(in[3]);
+        if ((a | b | c | d) & 0xc0) {
+            break;
+        }
+        group = ((uint32_t)a << 18) | ((uint32_t)b << 12) | (c << 6) | d;
+        out[0] = group >> 16;
+        out[1] = group >> 8;
+        out[2] = group;
+        in += 4;
+        out += 3;
+    }
 
-    for (int i = 1; i < (int)(base64_in_size); i++) {
-        code = getcode(base64_in[i]);
+    /* symbols that are not base64, like line breaks, are skipped */
+    group = 0;
+    for (; in < in_end; in++) {
+        uint8_t code = getcode(*in);
 
-        if (code == BASE64_NOT_DEFINED || code == BASE64_EQUALS) {
+        if (code >= 64) {
             continue;
         }
+        group = (group << 6) | code;
+        if (++codes == 4) {
+            if ((out_end - out) < 3) {
+                *data_out_size = (out - (unsigned char *)data_out) + 3;
+                return BASE64_ERROR_BUFFER_OUT_SIZE;
+            }
+            out[0] = group >> 16;
+            out[1] = group >> 8;
+            out[2] = group;
+            out += 3;
+            group = 0;
+            codes = 0;
+        }
+    }
 
-        int nm = (0xFF << (2 * mask));
+    /* two or three symbols in the last group give one or two bytes */
+    if (codes > 1) {
+        if ((unsigned)(out_end - out) < (codes - 1)) {
+            *data_out_size = (out - (unsigned char *)data_out) + codes - 1;
+            return BASE64_ERROR_BUFFER_OUT_SIZE;
+        }
+        group <<= 6 * (4 - codes);
+        *out++ = group >> 16;
+        if (codes == 3) {
+            *out++ = group >> 8;
+        }
+    }
 
-        nNum = nLst + ((code & (0xFF & nm)) >> (2 * mask));
-        nLst = (code & (0xFF & ~nm)) << (8 - (2 * mask));
+    *data_out_size = out - (unsigned char *)data_out;
+    return BASE64_SUCCESS;
+}
 
-        (mask != 3) ? out[iterate_data_buffer++] = nNum : nNum;
-        (mask == 0) ? mask = 3 : mask--;
-    }
+void base64_stream_init(base64_stream_t *stream, bool url)
+{
+    stream->alphabet = url ? _enc_url : _enc_std;
+    stream->len = 0;
+}
 
-    if (code == BASE64_EQUALS) {
-        /* add the last character to the data_out buffer */
-        out[iterate_data_buffer] = nNum;
+size_t base64_stream_encode(base64_stream_t *stream, const void *data_in,
+                            size_t data_in_size, unsigned char *base64_out)
+{
+    const unsigned char *in = data_in;
+    unsigned char *out = base64_out;
+
+    /* complete the group left over from the last call */
+    while (stream->len && data_in_size) {
+        stream->buf[stream->len++] = *in++;
+        data_in_size--;
+        if (stream->len == 3) {
+            _encode_group(stream->alphabet, stream->buf, out);
+            out += 4;
+            stream->len = 0;
+        }
+    }
+    while (data_in_size >= 3) {
+        _encode_group(stream->alphabet, in, out);
+        in += 3;
+        out += 4;
+        data_in_size -= 3;
+    }
+    while (data_in_size--) {
+        stream->buf[stream->len++] = *in++;
     }
 
-    *data_out_size = iterate_data_buffer;
-    return BASE64_SUCCESS;
+    return out - base64_out;
+}
+
+size_t base64_stream_finish(base64_stream_t *stream, unsigned char *base64_out)
+{
+    size_t len = _encode_tail(stream->alphabet, stream->buf, stream->len,
+                              base64_out);
+    stream->len = 0;
+    return len;
 }
@@ -21,6 +21,7 @@
 #include <stdio.h>
 
 #include "benchmark.h"
+#include "matstat.h"
 
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
 {
@@ -34,3 +35,74 @@ void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
            "  ---  %9" PRIu32 " calls per sec\n",
            name, time, full, div, per_sec);
 }
+
+static uint32_t _overhead = UINT32_MAX;
+
+void benchmark_init(void)
+{
+    if (_overhead != UINT32_MAX) {
+        return;
+    }
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    /* the fastest of a few empty measurements is the fixed overhead */
+    for (unsigned i = 0; i < 16; i++) {
+        uint32_t start = benchmark_cycles();
+        uint32_t time = benchmark_cycles() - start;
+        if (time < _overhead) {
+            _overhead = time;
+        }
+    }
+}
+
+static uint32_t _isqrt(uint64_t val)
+{
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > val) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (val >= res + bit) {
+            val -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)res;
+}
+
+void benchmark_report(const char *name, uint32_t *samples, unsigned num)
+{
+    matstat_state_t stats = MATSTAT_STATE_INIT;
+
+    if (num == 0) {
+        return;
+    }
+    /* insertion sort, sample counts are small and mostly nearly sorted */
+    for (unsigned i = 0; i < num; i++) {
+        uint32_t val = samples[i];
+        val = (val > _overhead) ? (val - _overhead) : 0;
+        unsigned j = i;
+        while ((j > 0) && (samples[j - 1] > val)) {
+            samples[j] = samples[j - 1];
+            j--;
+        }
+        samples[j] = val;
+        matstat_add(&stats, (int32_t)val);
+    }
+
+    printf("{\"name\": \"%s\", \"unit\": \"%s\", \"samples\": %u, "
+           "\"min\": %" PRIu32 ", \"median\": %" PRIu32 ", "
+           "\"max\": %" PRIu32 ", \"mean\": %" PRIi32 ", "
+           "\"stddev\": %" PRIu32 "}\n",
+           name, BENCHMARK_UNIT, num, samples[0], samples[num / 2],
+           samples[num - 1], matstat_mean(&stats),
+           _isqrt(matstat_variance(&stats)));
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup sys_bloom
+ * @{
+ * @file
+ * @brief   Blocked Bloom filter implementation
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bloom.h"
+
+/* multiplicative constant (2^32 / golden ratio) to rehash the key hash */
+#define REHASH_FACTOR   (0x9E3779B1UL)
+
+static inline uint32_t *_block(const bloom_blocked_t *bloom, uint32_t hash)
+{
+    /* maps the hash onto [0, num_blocks) without a division */
+    return &bloom->blocks[((uint64_t)hash * bloom->num_blocks) >> 32];
+}
+
+static uint32_t _mask(const bloom_blocked_t *bloom, uint32_t hash)
+{
+    uint32_t rehash = hash * REHASH_FACTOR;
+    unsigned pos = rehash >> 27;
+    /* an odd step visits k distinct bits of the word */
+    unsigned step = ((rehash >> 22) & 0x1f) | 1;
+    uint32_t mask = 0;
+
+    for (unsigned i = 0; i < bloom->k; i++) {
+        mask |= 1UL << pos;
+        pos = (pos + step) & 0x1f;
+    }
+    return mask;
+}
+
+void bloom_blocked_init(bloom_blocked_t *bloom, uint32_t *blocks,
+                        size_t num_blocks, unsigned k, hashfp_t hash)
+{
+    assert((k > 0) && (k <= BLOOM_BLOCKED_K_MAX));
+
+    memset(blocks, 0, num_blocks * sizeof(*blocks));
+    bloom->blocks = blocks;
+    bloom->num_blocks = num_blocks;
+    bloom->k = k;
+    bloom->hash = hash;
+}
+
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len)
+{
+    uint32_t hash = bloom->hash(buf, len);
+
+    *_block(bloom, hash) |= _mask(bloom, hash);
+}
+
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len)
+{
+    uint32_t hash = bloom->hash(buf, len);
+    uint32_t mask = _mask(bloom, hash);
+
+    return (*_block(bloom, hash) & mask) == mask;
+}
@@ -198,6 +198,22 @@ static void _rx_timeout(void *arg)
     mbox_put(&conn->mbox, &msg);
 }
 
+static int _rx_frame(conn_can_raw_t *conn, can_rx_data_t *rx, void *frame)
+{
+    int ret = rx->data.iov_len;
+
+    if ((ret > (int)CAN_MTU) && !(conn->flags & CONN_CAN_FD)) {
+        DEBUG("conn_can_raw_recv: dropping CAN-FD frame\n");
+        ret = 0;
+    }
+    else {
+        memcpy(frame, rx->data.iov_base, ret);
+    }
+    raw_can_free_frame(rx);
+
+    return ret;
+}
+
 int conn_can_raw_recv(conn_can_raw_t *conn, struct can_frame *frame, uint32_t timeout)
 {
     assert(conn != NULL);
@@ -214,43 +230,76 @@ int conn_can_raw_recv(conn_can_raw_t *conn, struct can_frame *frame, uint32_t ti
 
     int ret;
     msg_t msg;
-    can_rx_data_t *rx;
 
-    mbox_get(&conn->mbox, &msg);
+    do {
+        mbox_get(&conn->mbox, &msg);
+        switch (msg.type) {
+        case CAN_MSG_RX_INDICATION:
+            DEBUG("conn_can_raw_recv: CAN_MSG_RX_INDICATION\n");
+            ret = _rx_frame(conn, msg.content.ptr, frame);
+            break;
+        case _TIMEOUT_RX_MSG_TYPE:
+            if (msg.content.value == _TIMEOUT_MSG_VALUE) {
+                ret = -ETIMEDOUT;
+            }
+            else {
+                ret = -EINTR;
+            }
+            break;
+        case _CLOSE_CONN_MSG_TYPE:
+            if (msg.content.ptr == conn) {
+                ret = -ECONNABORTED;
+            }
+            else {
+                ret = -EINTR;
+            }
+            break;
+        default:
+            mbox_put(&conn->mbox, &msg);
+            ret = -EINTR;
+            break;
+        }
+    } while (ret == 0);
+
     if (timeout != 0) {
         xtimer_remove(&timer);
     }
-    switch (msg.type) {
-    case CAN_MSG_RX_INDICATION:
-        DEBUG("conn_can_raw_recv: CAN_MSG_RX_INDICATION\n");
-        rx = msg.content.ptr;
-        memcpy(frame, rx->data.iov_base, rx->data.iov_len);
-        ret = rx->data.iov_len;
-        raw_can_free_frame(rx);
-        break;
-    case _TIMEOUT_RX_MSG_TYPE:
-        if (msg.content.value == _TIMEOUT_MSG_VALUE) {
-            ret = -ETIMEDOUT;
-        }
-        else {
-            ret = -EINTR;
-        }
-        break;
-    case _CLOSE_CONN_MSG_TYPE:
-        if (msg.content.ptr == conn) {
-            ret = -ECONNABORTED;
+
+    return ret;
+}
+
+int conn_can_raw_recv_batch(conn_can_raw_t *conn, void *frames, size_t num,
+                            uint32_t timeout)
+{
+    assert(conn != NULL);
+    assert(frames != NULL);
+    assert(num > 0);
+
+    size_t size = (conn->flags & CONN_CAN_FD) ? CANFD_MTU : CAN_MTU;
+    uint8_t *buf = frames;
+    size_t n;
+    msg_t msg;
+
+    /* block for the first frame only */
+    int ret = conn_can_raw_recv(conn, frames, timeout);
+    if (ret < 0) {
+        return ret;
+    }
+
+    for (n = 1; (n < num) && mbox_try_get(&conn->mbox, &msg); ) {
+        if (msg.type != CAN_MSG_RX_INDICATION) {
+            /* let the next call handle it */
+            mbox_try_put(&conn->mbox, &msg);
+            break;
         }
-        else {
-            ret = -EINTR;
+        if (_rx_frame(conn, msg.content.ptr, buf + (n * size)) > 0) {
+            n++;
         }
-        break;
-    default:
-        mbox_put(&conn->mbox, &msg);
-        ret = -EINTR;
-        break;
     }
 
-    return ret;
+    DEBUG("conn_can_raw_recv_batch: %u frames\n", (unsigned)n);
+
+    return n;
 }
 
 int conn_can_raw_close(conn_can_raw_t *conn)
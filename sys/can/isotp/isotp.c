@@ -698,7 +698,10 @@ static void *_isotp_thread(void *args)
             }
             DEBUG("_isotp_thread: CAN_MSG_RX_INDICATION, frame=%p, data=%p\n",
                   (void *)rx_frame->data.iov_base, rx_frame->arg);
-            _isotp_rcv((struct isotp *)rx_frame->arg, rx_frame->data.iov_base);
+            /* ISO-TP is only defined on classic frames here */
+            if (rx_frame->data.iov_len == CAN_MTU) {
+                _isotp_rcv((struct isotp *)rx_frame->arg, rx_frame->data.iov_base);
+            }
             raw_can_free_frame(rx_frame);
             break;
         case CAN_MSG_TX_CONFIRMATION:
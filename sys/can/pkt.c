@@ -52,7 +52,7 @@ static can_pkt_t *_pkt_alloc(int ifnum, const struct can_frame *frame)
 
     pkt = snip->data;
     pkt->entry.ifnum = ifnum;
-    pkt->frame = *frame;
+    memcpy(&pkt->frame, frame, can_frame_size(frame));
     pkt->snip = snip;
 
     DEBUG("can_pkt_alloc: pkt allocated\n");
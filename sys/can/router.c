@@ -324,7 +324,9 @@ int can_router_dispatch_rx_indic(can_pkt_t *pkt)
             DEBUG("can_router_dispatch_rx_indic: rx_ind to pid: %"
                   PRIkernel_pid "\n", entry->target.pid);
             atomic_fetch_add(&pkt->ref_count, 1);
-            msg.content.ptr = can_pkt_alloc_rx_data(&pkt->frame, sizeof(pkt->frame), el->data);
+            msg.content.ptr = can_pkt_alloc_rx_data(&pkt->frame,
+                                                     can_frame_size(&pkt->frame),
+                                                     el->data);
 #if ENABLE_DEBUG
             msg_cnt++;
 #endif
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_checksum_crc8
+ * @{
+ *
+ * @file
+ * @}
+ */
+
+#include <assert.h>
+
+#include "checksum/crc8.h"
+
+uint8_t crc8(const uint8_t *buf, size_t len, uint8_t poly, uint8_t seed)
+{
+    assert(buf || (len == 0));
+    while (len--) {
+        seed ^= *buf++;
+        for (unsigned i = 0; i < 8; i++) {
+            seed = (seed & 0x80) ? ((seed << 1) ^ poly) : (seed << 1);
+        }
+    }
+    return seed;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   Allocator for standard containers backed by a @ref sys_arena
+ *
+ * Requires the `arena` module. Memory is only released by arena_reset(),
+ * so containers using the allocator must be destroyed before the arena
+ * is reset.
+ *
+ * @}
+ */
+
+#ifndef RIOT_ARENA_HPP
+#define RIOT_ARENA_HPP
+
+#include <cstddef>
+
+#include "arena.h"
+
+namespace riot {
+
+/**
+ * @brief Allocator handing out memory of an arena
+ *
+ * As RIOT is usually built without exceptions, allocate() returns
+ * `nullptr` if the arena is exhausted instead of throwing.
+ *
+ * @tparam T  element type, its alignment must not exceed ARENA_ALIGNMENT
+ */
+template <class T>
+class arena_allocator {
+  static_assert(alignof(T) <= ARENA_ALIGNMENT,
+                "alignment of T exceeds ARENA_ALIGNMENT");
+
+ public:
+  using value_type = T;
+
+  /**
+   * @brief Create an allocator for the given arena
+   */
+  explicit arena_allocator(arena_t& arena) noexcept : m_arena{&arena} {}
+
+  /**
+   * @brief Rebind an allocator of another type to the same arena
+   */
+  template <class U>
+  arena_allocator(const arena_allocator<U>& other) noexcept
+      : m_arena{other.arena()} {}
+
+  /**
+   * @brief Allocate memory for @p n objects
+   */
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena_alloc(m_arena, n * sizeof(T)));
+  }
+
+  /**
+   * @brief Does nothing, the memory is released with the arena
+   */
+  void deallocate(T*, std::size_t) noexcept {}
+
+  /**
+   * @brief The arena this allocator uses
+   */
+  arena_t* arena() const noexcept { return m_arena; }
+
+ private:
+  arena_t* m_arena;
+};
+
+/**
+ * @brief Allocators are equal if they use the same arena
+ */
+template <class T, class U>
+inline bool operator==(const arena_allocator<T>& lhs,
+                       const arena_allocator<U>& rhs) noexcept {
+  return lhs.arena() == rhs.arena();
+}
+
+/**
+ * @brief Allocators are equal if they use the same arena
+ */
+template <class T, class U>
+inline bool operator!=(const arena_allocator<T>& lhs,
+                       const arena_allocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+} // namespace riot
+
+#endif // RIOT_ARENA_HPP
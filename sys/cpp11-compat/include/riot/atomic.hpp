@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   C++11 atomic drop in replacement
+ * @see     <a href="http://en.cppreference.com/w/cpp/atomic/atomic">
+ *            std::atomic
+ *          </a>
+ *
+ * Where the compiler has lock-free instructions for a type (e.g. LDREX/STREX
+ * on Cortex-M3 and above) they are used directly. Elsewhere (e.g. Cortex-M0,
+ * MSP430, AVR) loads and stores that the CPU performs in a single access are
+ * used as they are, and only read-modify-write operations mask interrupts,
+ * instead of calling core/atomic_c11.c for every access.
+ *
+ * Only integral and pointer types are supported, and all operations are
+ * sequentially consistent.
+ *
+ * @}
+ */
+
+#ifndef RIOT_ATOMIC_HPP
+#define RIOT_ATOMIC_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "irq.h"
+
+namespace riot {
+
+namespace detail {
+
+/**
+ * @brief Largest size in bytes the CPU loads and stores in a single access
+ */
+#if defined(__arm__)
+constexpr std::size_t atomic_access_size = 4;
+#elif defined(__MSP430__)
+constexpr std::size_t atomic_access_size = 2;
+#else
+constexpr std::size_t atomic_access_size = 1;
+#endif
+
+/**
+ * @brief Implementation on top of the lock-free compiler builtins
+ */
+template <class T, bool = __atomic_always_lock_free(sizeof(T), 0)>
+class atomic_base {
+public:
+  constexpr atomic_base() noexcept : m_value{} {}
+  constexpr atomic_base(T value) noexcept : m_value{value} {}
+
+  /**
+   * @brief Whether the operations are lock-free
+   */
+  static constexpr bool is_always_lock_free = true;
+
+  /**
+   * @brief Read the value
+   */
+  inline T load() const noexcept {
+    return __atomic_load_n(&m_value, __ATOMIC_SEQ_CST);
+  }
+  /**
+   * @brief Replace the value
+   */
+  inline void store(T value) noexcept {
+    __atomic_store_n(&m_value, value, __ATOMIC_SEQ_CST);
+  }
+  /**
+   * @brief Replace the value and return the previous one
+   */
+  inline T exchange(T value) noexcept {
+    return __atomic_exchange_n(&m_value, value, __ATOMIC_SEQ_CST);
+  }
+  /**
+   * @brief Replace the value with @p desired if it equals @p expected
+   * @return `true` on success, `false` and the current value in @p expected
+   *         otherwise
+   */
+  inline bool compare_exchange_strong(T& expected, T desired) noexcept {
+    return __atomic_compare_exchange_n(&m_value, &expected, desired, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  }
+
+protected:
+  inline T fetch_add_impl(T arg) noexcept {
+    return __atomic_fetch_add(&m_value, arg, __ATOMIC_SEQ_CST);
+  }
+  inline T fetch_sub_impl(T arg) noexcept {
+    return __atomic_fetch_sub(&m_value, arg, __ATOMIC_SEQ_CST);
+  }
+
+private:
+  T m_value;
+};
+
+/**
+ * @brief Implementation for CPUs without atomic read-modify-write
+ *        instructions
+ */
+template <class T>
+class atomic_base<T, false> {
+public:
+  constexpr atomic_base() noexcept : m_value{} {}
+  constexpr atomic_base(T value) noexcept : m_value{value} {}
+
+  /**
+   * @brief Whether the operations are lock-free
+   */
+  static constexpr bool is_always_lock_free = false;
+
+  /**
+   * @brief Read the value
+   */
+  inline T load() const noexcept {
+    if (sizeof(T) <= atomic_access_size) {
+      /* single-core: keeping the compiler from reordering is enough */
+      __atomic_signal_fence(__ATOMIC_SEQ_CST);
+      T value = *static_cast<const volatile T*>(&m_value);
+      __atomic_signal_fence(__ATOMIC_SEQ_CST);
+      return value;
+    }
+    unsigned state = irq_disable();
+    T value = m_value;
+    irq_restore(state);
+    return value;
+  }
+  /**
+   * @brief Replace the value
+   */
+  inline void store(T value) noexcept {
+    if (sizeof(T) <= atomic_access_size) {
+      __atomic_signal_fence(__ATOMIC_SEQ_CST);
+      *static_cast<volatile T*>(&m_value) = value;
+      __atomic_signal_fence(__ATOMIC_SEQ_CST);
+      return;
+    }
+    unsigned state = irq_disable();
+    m_value = value;
+    irq_restore(state);
+  }
+  /**
+   * @brief Replace the value and return the previous one
+   */
+  inline T exchange(T value) noexcept {
+    unsigned state = irq_disable();
+    T old = m_value;
+    m_value = value;
+    irq_restore(state);
+    return old;
+  }
+  /**
+   * @brief Replace the value with @p desired if it equals @p expected
+   * @return `true` on success, `false` and the current value in @p expected
+   *         otherwise
+   */
+  inline bool compare_exchange_strong(T& expected, T desired) noexcept {
+    unsigned state = irq_disable();
+    bool res = (m_value == expected);
+    if (res) {
+      m_value = desired;
+    }
+    else {
+      expected = m_value;
+    }
+    irq_restore(state);
+    return res;
+  }
+
+protected:
+  inline T fetch_add_impl(T arg) noexcept {
+    unsigned state = irq_disable();
+    T old = m_value;
+    m_value = old + arg;
+    irq_restore(state);
+    return old;
+  }
+  inline T fetch_sub_impl(T arg) noexcept {
+    unsigned state = irq_disable();
+    T old = m_value;
+    m_value = old - arg;
+    irq_restore(state);
+    return old;
+  }
+
+private:
+  T m_value;
+};
+
+} // namespace detail
+
+/**
+ * @brief C++11 compliant subset of std::atomic for integral and pointer types
+ * @see   <a href="http://en.cppreference.com/w/cpp/atomic/atomic">
+ *          std::atomic
+ *        </a>
+ */
+template <class T>
+class atomic : public detail::atomic_base<T> {
+  static_assert(std::is_integral<T>::value || std::is_pointer<T>::value,
+                "riot::atomic only supports integral and pointer types");
+
+public:
+  constexpr atomic() noexcept = default;
+  constexpr atomic(T value) noexcept : detail::atomic_base<T>{value} {}
+
+  atomic(const atomic&) = delete;
+  atomic& operator=(const atomic&) = delete;
+
+  /**
+   * @brief Whether the operations of this object are lock-free
+   */
+  inline bool is_lock_free() const noexcept {
+    return detail::atomic_base<T>::is_always_lock_free;
+  }
+
+  /**
+   * @brief Add @p arg and return the previous value (integral types only)
+   */
+  template <class U = T>
+  inline typename std::enable_if<std::is_integral<U>::value, T>::type
+  fetch_add(T arg) noexcept {
+    return this->fetch_add_impl(arg);
+  }
+  /**
+   * @brief Subtract @p arg and return the previous value (integral types only)
+   */
+  template <class U = T>
+  inline typename std::enable_if<std::is_integral<U>::value, T>::type
+  fetch_sub(T arg) noexcept {
+    return this->fetch_sub_impl(arg);
+  }
+
+  /**
+   * @brief Read the value
+   */
+  inline operator T() const noexcept { return this->load(); }
+  /**
+   * @brief Replace the value
+   */
+  inline T operator=(T value) noexcept {
+    this->store(value);
+    return value;
+  }
+};
+
+} // namespace riot
+
+#endif // RIOT_ATOMIC_HPP
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   Lock-free queue and stack for producer/consumer code
+ *
+ * Both containers work between threads as well as between an ISR and a
+ * thread, without a mutex.
+ *
+ * @}
+ */
+
+#ifndef RIOT_LOCKFREE_HPP
+#define RIOT_LOCKFREE_HPP
+
+#include <cstddef>
+
+#include "riot/atomic.hpp"
+
+namespace riot {
+
+/**
+ * @brief Bounded queue for a single producer and a single consumer
+ *
+ * Only uses atomic loads and stores, so it never masks interrupts on CPUs
+ * that access `unsigned` in a single instruction.
+ *
+ * @tparam T  element type, must be copy assignable
+ * @tparam N  capacity, must be a power of two
+ */
+template <class T, std::size_t N>
+class spsc_queue {
+  static_assert((N > 0) && !(N & (N - 1)), "N must be a power of two");
+
+public:
+  constexpr spsc_queue() noexcept : m_head{0}, m_tail{0}, m_buf{} {}
+
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+
+  /**
+   * @brief Append an element, only to be called by the producer
+   * @return `false` if the queue is full
+   */
+  bool push(const T& value) {
+    unsigned tail = m_tail.load();
+    if ((tail - m_head.load()) == N) {
+      return false;
+    }
+    m_buf[tail & (N - 1)] = value;
+    m_tail.store(tail + 1);
+    return true;
+  }
+
+  /**
+   * @brief Take the oldest element, only to be called by the consumer
+   * @return `false` if the queue is empty
+   */
+  bool pop(T& value) {
+    unsigned head = m_head.load();
+    if (m_tail.load() == head) {
+      return false;
+    }
+    value = m_buf[head & (N - 1)];
+    m_head.store(head + 1);
+    return true;
+  }
+
+  /**
+   * @brief Number of elements in the queue
+   */
+  inline std::size_t size() const noexcept {
+    return m_tail.load() - m_head.load();
+  }
+
+  /**
+   * @brief Whether the queue is empty
+   */
+  inline bool empty() const noexcept { return size() == 0; }
+
+private:
+  atomic<unsigned> m_head;
+  atomic<unsigned> m_tail;
+  T m_buf[N];
+};
+
+/**
+ * @brief Node of an @ref mpsc_stack, to be embedded into the elements
+ */
+struct mpsc_stack_node {
+  mpsc_stack_node* next; /**< next element, set by the stack */
+};
+
+/**
+ * @brief Intrusive stack for any number of producers and a single consumer
+ *
+ * The consumer takes all elements at once, so there is no ABA problem in
+ * popping single elements while others push.
+ */
+class mpsc_stack {
+public:
+  constexpr mpsc_stack() noexcept : m_top{nullptr} {}
+
+  mpsc_stack(const mpsc_stack&) = delete;
+  mpsc_stack& operator=(const mpsc_stack&) = delete;
+
+  /**
+   * @brief Push @p node, may be called from any context
+   */
+  void push(mpsc_stack_node* node) noexcept {
+    mpsc_stack_node* top = m_top.load();
+    do {
+      node->next = top;
+    } while (!m_top.compare_exchange_strong(top, node));
+  }
+
+  /**
+   * @brief Take all nodes, the most recently pushed one first
+   * @return the list of nodes linked via mpsc_stack_node::next, or `nullptr`
+   */
+  inline mpsc_stack_node* take_all() noexcept {
+    return m_top.exchange(nullptr);
+  }
+
+  /**
+   * @brief Whether the stack is empty
+   */
+  inline bool empty() const noexcept { return m_top.load() == nullptr; }
+
+private:
+  atomic<mpsc_stack_node*> m_top;
+};
+
+} // namespace riot
+
+#endif // RIOT_LOCKFREE_HPP
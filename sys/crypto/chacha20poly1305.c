@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto_chacha20poly1305
+ * @{
+ *
+ * @file
+ * @brief       ChaCha20-Poly1305 AEAD construction (RFC 8439)
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "crypto/chacha20poly1305.h"
+#include "crypto/helper.h"
+
+static const uint8_t _zeros[POLY1305_BLOCK_SIZE];
+
+static void _poly_pad(chacha20poly1305_ctx_t *ctx, uint64_t len)
+{
+    unsigned rem = len % POLY1305_BLOCK_SIZE;
+
+    if (rem) {
+        poly1305_update(&ctx->poly, _zeros, POLY1305_BLOCK_SIZE - rem);
+    }
+}
+
+static void _aad_finish(chacha20poly1305_ctx_t *ctx)
+{
+    if (!ctx->aad_done) {
+        _poly_pad(ctx, ctx->aad_len);
+        ctx->aad_done = 1;
+    }
+}
+
+static void _crypt(chacha20poly1305_ctx_t *ctx, const uint8_t *in, size_t len,
+                   uint8_t *out)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (ctx->stream_pos == sizeof(ctx->stream)) {
+            chacha_keystream_bytes(&ctx->chacha, ctx->stream);
+            ctx->stream_pos = 0;
+        }
+        out[i] = in[i] ^ ctx->stream[ctx->stream_pos++];
+    }
+    ctx->data_len += len;
+}
+
+void chacha20poly1305_init(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
+                           const uint8_t *nonce)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    /* RFC 8439 uses a 32 bit block counter followed by a 96 bit nonce, the
+     * first nonce word thus takes the place of the upper counter word */
+    chacha_init(&ctx->chacha, 20, key, CHACHA20POLY1305_KEY_BYTES, &nonce[4]);
+    memcpy(&ctx->chacha.state[13], nonce, 4);
+
+    /* the one-time Poly1305 key is the first half of keystream block 0 */
+    chacha_keystream_bytes(&ctx->chacha, ctx->stream);
+    poly1305_init(&ctx->poly, ctx->stream);
+    crypto_secure_wipe(ctx->stream, sizeof(ctx->stream));
+    ctx->stream_pos = sizeof(ctx->stream);
+}
+
+int chacha20poly1305_update_aad(chacha20poly1305_ctx_t *ctx,
+                                const uint8_t *aad, size_t len)
+{
+    if (ctx->aad_done) {
+        return -1;
+    }
+    poly1305_update(&ctx->poly, aad, len);
+    ctx->aad_len += len;
+    return 0;
+}
+
+void chacha20poly1305_encrypt_update(chacha20poly1305_ctx_t *ctx,
+                                     const uint8_t *in, size_t len,
+                                     uint8_t *out)
+{
+    _aad_finish(ctx);
+    _crypt(ctx, in, len, out);
+    poly1305_update(&ctx->poly, out, len);
+}
+
+void chacha20poly1305_decrypt_update(chacha20poly1305_ctx_t *ctx,
+                                     const uint8_t *in, size_t len,
+                                     uint8_t *out)
+{
+    _aad_finish(ctx);
+    poly1305_update(&ctx->poly, in, len);
+    _crypt(ctx, in, len, out);
+}
+
+void chacha20poly1305_encrypt_finish(chacha20poly1305_ctx_t *ctx, uint8_t *tag)
+{
+    uint8_t lengths[16];
+
+    _aad_finish(ctx);
+    _poly_pad(ctx, ctx->data_len);
+    /* both lengths are encoded as 64 bit little endian */
+    for (unsigned i = 0; i < 8; i++) {
+        lengths[i] = ctx->aad_len >> (8 * i);
+        lengths[8 + i] = ctx->data_len >> (8 * i);
+    }
+    poly1305_update(&ctx->poly, lengths, sizeof(lengths));
+    poly1305_finish(&ctx->poly, tag);
+    crypto_secure_wipe(ctx, sizeof(*ctx));
+}
+
+int chacha20poly1305_decrypt_finish(chacha20poly1305_ctx_t *ctx,
+                                    const uint8_t *tag)
+{
+    uint8_t expected[CHACHA20POLY1305_TAG_BYTES];
+
+    chacha20poly1305_encrypt_finish(ctx, expected);
+    return crypto_equals(expected, tag, sizeof(expected)) ? 0 : -1;
+}
+
+void chacha20poly1305_encrypt_iolist(const uint8_t *key, const uint8_t *nonce,
+                                     const uint8_t *aad, size_t aad_len,
+                                     const iolist_t *data, uint8_t *tag)
+{
+    chacha20poly1305_ctx_t ctx;
+
+    chacha20poly1305_init(&ctx, key, nonce);
+    chacha20poly1305_update_aad(&ctx, aad, aad_len);
+    for (; data; data = data->iol_next) {
+        chacha20poly1305_encrypt_update(&ctx, data->iol_base, data->iol_len,
+                                        data->iol_base);
+    }
+    chacha20poly1305_encrypt_finish(&ctx, tag);
+}
+
+int chacha20poly1305_decrypt_iolist(const uint8_t *key, const uint8_t *nonce,
+                                    const uint8_t *aad, size_t aad_len,
+                                    const iolist_t *data, const uint8_t *tag)
+{
+    chacha20poly1305_ctx_t ctx;
+
+    chacha20poly1305_init(&ctx, key, nonce);
+    chacha20poly1305_update_aad(&ctx, aad, aad_len);
+    for (; data; data = data->iol_next) {
+        chacha20poly1305_decrypt_update(&ctx, data->iol_base, data->iol_len,
+                                        data->iol_base);
+    }
+    return chacha20poly1305_decrypt_finish(&ctx, tag);
+}
@@ -18,6 +18,9 @@
 #include <stdio.h>
 #include "crypto/ciphers.h"
 
+#ifdef MODULE_PERIPH_AES
+#include "periph/aes.h"
+#endif
 
 int cipher_init(cipher_t* cipher, cipher_id_t cipher_id, const uint8_t* key,
                 uint8_t key_size)
@@ -26,6 +29,17 @@ int cipher_init(cipher_t* cipher, cipher_id_t cipher_id, const uint8_t* key,
         return CIPHER_ERR_INVALID_KEY_SIZE;
     }
 
+#ifdef MODULE_PERIPH_AES
+    /* prefer the AES peripheral, fall back to software if it refuses */
+    if ((cipher_id == CIPHER_AES_128) &&
+        (key_size <= periph_aes_interface.max_key_size) &&
+        (periph_aes_interface.init(&cipher->context, key, key_size) ==
+         CIPHER_INIT_SUCCESS)) {
+        cipher->interface = &periph_aes_interface;
+        return CIPHER_INIT_SUCCESS;
+    }
+#endif
+
     cipher->interface = cipher_id;
     return cipher->interface->init(&cipher->context, key, key_size);
 
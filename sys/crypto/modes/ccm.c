@@ -21,7 +21,6 @@
 #include <string.h>
 #include "debug.h"
 #include "crypto/helper.h"
-#include "crypto/modes/ctr.h"
 #include "crypto/modes/ccm.h"
 
 static inline int min(int a, int b)
@@ -34,38 +33,10 @@ static inline int min(int a, int b)
     }
 }
 
-int ccm_compute_cbc_mac(cipher_t* cipher, const uint8_t iv[16],
-                        const uint8_t* input, size_t length, uint8_t* mac)
-{
-    uint8_t offset, block_size, mac_enc[16] = {0};
-
-    block_size = cipher_get_block_size(cipher);
-    memmove(mac, iv, 16);
-    offset = 0;
-    do {
-        uint8_t block_size_input = (length - offset > block_size) ?
-                                   block_size : length - offset;
-
-        /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (int i = 0; i < block_size_input; ++i) {
-            mac[i] ^= input[offset + i];
-        }
-
-        if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
-            return CIPHER_ERR_ENC_FAILED;
-        }
-
-        memcpy(mac, mac_enc, block_size);
-        offset += block_size_input;
-    } while (offset < length);
-
-    return offset;
-}
-
-
-int ccm_create_mac_iv(cipher_t* cipher, uint8_t auth_data_len, uint8_t M,
-                      uint8_t L, const uint8_t* nonce, uint8_t nonce_len,
-                      size_t plaintext_len, uint8_t X1[16])
+static int ccm_create_mac_iv(cipher_t* cipher, uint32_t auth_data_len,
+                             uint8_t M, uint8_t L,
+                             const uint8_t* nonce, uint8_t nonce_len,
+                             size_t plaintext_len, uint8_t X1[16])
 {
     uint8_t M_, L_;
 
@@ -99,40 +70,6 @@ int ccm_create_mac_iv(cipher_t* cipher, uint8_t auth_data_len, uint8_t M,
     return 0;
 }
 
-int ccm_compute_adata_mac(cipher_t* cipher, const uint8_t* auth_data,
-                          uint32_t auth_data_len, uint8_t X1[16])
-{
-    if (auth_data_len > 0) {
-        int len;
-
-        /* 16 octet block size + max. 10 len encoding  */
-        uint8_t auth_data_encoded[26], len_encoding = 0;
-
-        /* If 0 < l(a) < (2^16 - 2^8), then the length field is encoded as two
-         * octets. (RFC3610 page 2)
-         */
-        if (auth_data_len <= 0xFEFF) {
-            /* length (0x0001 ... 0xFEFF)  */
-            len_encoding = 2;
-
-            auth_data_encoded[1] = auth_data_len & 0xFF;
-            auth_data_encoded[0] = (auth_data_len >> 8) & 0xFF;
-        } else {
-            DEBUG("UNSUPPORTED Adata length: %" PRIu32 "\n", auth_data_len);
-            return -1;
-        }
-
-        memcpy(auth_data_encoded + len_encoding, auth_data, auth_data_len);
-        len = ccm_compute_cbc_mac(cipher, X1, auth_data_encoded, auth_data_len + len_encoding, X1);
-        if (len < 0) {
-            return -1;
-        }
-    }
-
-    return 0;
-}
-
-
 /* Check if 'value' can be stored in 'num_bytes' */
 static inline int _fits_in_nbytes(size_t value, uint8_t num_bytes)
 {
@@ -144,17 +81,38 @@ static inline int _fits_in_nbytes(size_t value, uint8_t num_bytes)
 }
 
 
-int cipher_encrypt_ccm(cipher_t* cipher,
-                       const uint8_t* auth_data, uint32_t auth_data_len,
-                       uint8_t mac_length, uint8_t length_encoding,
-                       const uint8_t* nonce, size_t nonce_len,
-                       const uint8_t* input, size_t input_len,
-                       uint8_t* output)
+/* Absorb 'len' bytes into the running CBC-MAC */
+static int _ccm_mac_update(ccm_ctx_t *ctx, const uint8_t *input, size_t len)
 {
-    int len = -1;
-    uint8_t nonce_counter[16] = {0}, mac_iv[16] = {0}, mac[16] = {0},
-                                stream_block[16] = {0}, zero_block[16] = {0}, block_size;
+    while (len--) {
+        ctx->mac[ctx->mac_pos++] ^= *input++;
+        if (ctx->mac_pos == 16) {
+            if (cipher_encrypt(ctx->cipher, ctx->mac, ctx->mac) != 1) {
+                return CIPHER_ERR_ENC_FAILED;
+            }
+            ctx->mac_pos = 0;
+        }
+    }
+    return 0;
+}
 
+/* Complete a partially filled MAC block by padding it with zeros */
+static int _ccm_mac_pad(ccm_ctx_t *ctx)
+{
+    if (ctx->mac_pos > 0) {
+        if (cipher_encrypt(ctx->cipher, ctx->mac, ctx->mac) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+        ctx->mac_pos = 0;
+    }
+    return 0;
+}
+
+int cipher_init_ccm(ccm_ctx_t *ctx, cipher_t *cipher,
+                    uint8_t mac_length, uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len,
+                    uint32_t auth_data_len, size_t input_len)
+{
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
     }
@@ -164,114 +122,267 @@ int cipher_encrypt_ccm(cipher_t* cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
+    if (auth_data_len > 0xFEFF) {
+        DEBUG("UNSUPPORTED Adata length: %" PRIu32 "\n", auth_data_len);
+        return -1;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->cipher = cipher;
+    ctx->mac_length = mac_length;
+    ctx->length_encoding = length_encoding;
+    ctx->auth_data_left = auth_data_len;
+    ctx->input_left = input_len;
+
     /* Create B0, encrypt it (X1) and use it as mac_iv */
-    block_size = cipher_get_block_size(cipher);
     if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, input_len, mac_iv) < 0) {
+                          nonce, nonce_len, input_len, ctx->mac) < 0) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+
+    if (auth_data_len > 0) {
+        uint8_t len_encoded[2] = { auth_data_len >> 8, auth_data_len & 0xFF };
+        _ccm_mac_update(ctx, len_encoded, sizeof(len_encoded));
+    }
+
+    /* Counter block A0, its keystream block S0 is only used for the MAC */
+    ctx->ctr[0] = length_encoding - 1;
+    memcpy(&ctx->ctr[1], nonce, min(nonce_len, (size_t) 15 - length_encoding));
+    ctx->stream_pos = 16;
+
+    return 0;
+}
+
+int cipher_update_ccm_aad(ccm_ctx_t *ctx,
+                          const uint8_t *auth_data, size_t auth_data_len)
+{
+    int res;
+
+    if (auth_data_len > ctx->auth_data_left) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+    res = _ccm_mac_update(ctx, auth_data, auth_data_len);
+    if (res < 0) {
+        return res;
+    }
+    ctx->auth_data_left -= auth_data_len;
+    if (ctx->auth_data_left == 0) {
+        return _ccm_mac_pad(ctx);
+    }
+    return 0;
+}
+
+/* XOR the CTR keystream onto 'len' bytes */
+static int _ccm_crypt(ccm_ctx_t *ctx, const uint8_t *input, size_t len,
+                      uint8_t *output)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (ctx->stream_pos == 16) {
+            crypto_block_inc_ctr(ctx->ctr, ctx->length_encoding);
+            if (cipher_encrypt(ctx->cipher, ctx->ctr, ctx->stream) != 1) {
+                return CIPHER_ERR_ENC_FAILED;
+            }
+            ctx->stream_pos = 0;
+        }
+        output[i] = input[i] ^ ctx->stream[ctx->stream_pos++];
+    }
+    return 0;
+}
+
+int cipher_encrypt_ccm_update(ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t input_len, uint8_t *output)
+{
+    int res;
+
+    if (ctx->auth_data_left || input_len > ctx->input_left) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+    res = _ccm_mac_update(ctx, input, input_len);
+    if (res < 0) {
+        return res;
+    }
+    ctx->input_left -= input_len;
+    return _ccm_crypt(ctx, input, input_len, output);
+}
+
+int cipher_decrypt_ccm_update(ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t input_len, uint8_t *output)
+{
+    int res;
+
+    if (ctx->auth_data_left || input_len > ctx->input_left) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+    res = _ccm_crypt(ctx, input, input_len, output);
+    if (res < 0) {
+        return res;
+    }
+    ctx->input_left -= input_len;
+    return _ccm_mac_update(ctx, output, input_len);
+}
+
+/* Compute the final MAC, i.e. the CBC-MAC encrypted with S0 */
+static int _ccm_finish(ccm_ctx_t *ctx, uint8_t mac[16])
+{
+    int res;
+
+    if (ctx->auth_data_left || ctx->input_left) {
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
+    res = _ccm_mac_pad(ctx);
+    if (res < 0) {
+        return res;
+    }
 
-    /* MAC calulation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
-    if (len < 0) {
-        return len;
+    /* rewind the counter to A0 */
+    memset(&ctx->ctr[16 - ctx->length_encoding], 0, ctx->length_encoding);
+    if (cipher_encrypt(ctx->cipher, ctx->ctr, ctx->stream) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
     }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, input, input_len, mac);
-    if (len < 0) {
-        return len;
+    for (uint8_t i = 0; i < 16; ++i) {
+        mac[i] = ctx->mac[i] ^ ctx->stream[i];
     }
+    crypto_secure_wipe(ctx->stream, sizeof(ctx->stream));
+    return 0;
+}
+
+int cipher_encrypt_ccm_finish(ccm_ctx_t *ctx, uint8_t *mac)
+{
+    uint8_t tag[16];
+    int res = _ccm_finish(ctx, tag);
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
-    memcpy(&nonce_counter[1], nonce,
-           min(nonce_len, (size_t) 15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size,
-                             zero_block, block_size, stream_block);
-    if (len < 0) {
-        return len;
+    if (res == 0) {
+        memcpy(mac, tag, ctx->mac_length);
     }
+    return res;
+}
+
+int cipher_decrypt_ccm_finish(ccm_ctx_t *ctx, const uint8_t *mac)
+{
+    uint8_t tag[16];
+    int res = _ccm_finish(ctx, tag);
 
-    /* Encrypt message in counter mode  */
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             input_len, output);
-    if (len < 0) {
-        return len;
+    if (res < 0) {
+        return res;
+    }
+    if (!crypto_equals(tag, mac, ctx->mac_length)) {
+        return CCM_ERR_INVALID_CBC_MAC;
     }
+    return 0;
+}
+
+static size_t _iolist_len(const iolist_t *data)
+{
+    size_t len = 0;
 
-    /* auth value: mac ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        output[len + i] = mac[i] ^ stream_block[i];
+    for (; data; data = data->iol_next) {
+        len += data->iol_len;
     }
+    return len;
+}
+
+int cipher_encrypt_ccm_iolist(cipher_t *cipher,
+                              const uint8_t *auth_data, uint32_t auth_data_len,
+                              uint8_t mac_length, uint8_t length_encoding,
+                              const uint8_t *nonce, size_t nonce_len,
+                              const iolist_t *data, uint8_t *mac)
+{
+    ccm_ctx_t ctx;
+    size_t len = _iolist_len(data);
+    int res = cipher_init_ccm(&ctx, cipher, mac_length, length_encoding,
+                              nonce, nonce_len, auth_data_len, len);
 
-    return len + mac_length;
+    if (res == 0) {
+        res = cipher_update_ccm_aad(&ctx, auth_data, auth_data_len);
+    }
+    for (; (res == 0) && data; data = data->iol_next) {
+        res = cipher_encrypt_ccm_update(&ctx, data->iol_base, data->iol_len,
+                                        data->iol_base);
+    }
+    if (res == 0) {
+        res = cipher_encrypt_ccm_finish(&ctx, mac);
+    }
+    return (res < 0) ? res : (int)len;
 }
 
+int cipher_decrypt_ccm_iolist(cipher_t *cipher,
+                              const uint8_t *auth_data, uint32_t auth_data_len,
+                              uint8_t mac_length, uint8_t length_encoding,
+                              const uint8_t *nonce, size_t nonce_len,
+                              const iolist_t *data, const uint8_t *mac)
+{
+    ccm_ctx_t ctx;
+    size_t len = _iolist_len(data);
+    int res = cipher_init_ccm(&ctx, cipher, mac_length, length_encoding,
+                              nonce, nonce_len, auth_data_len, len);
 
-int cipher_decrypt_ccm(cipher_t* cipher,
+    if (res == 0) {
+        res = cipher_update_ccm_aad(&ctx, auth_data, auth_data_len);
+    }
+    for (; (res == 0) && data; data = data->iol_next) {
+        res = cipher_decrypt_ccm_update(&ctx, data->iol_base, data->iol_len,
+                                        data->iol_base);
+    }
+    if (res == 0) {
+        res = cipher_decrypt_ccm_finish(&ctx, mac);
+    }
+    return (res < 0) ? res : (int)len;
+}
+
+int cipher_encrypt_ccm(cipher_t* cipher,
                        const uint8_t* auth_data, uint32_t auth_data_len,
                        uint8_t mac_length, uint8_t length_encoding,
                        const uint8_t* nonce, size_t nonce_len,
                        const uint8_t* input, size_t input_len,
-                       uint8_t* plain)
+                       uint8_t* output)
 {
-    int len = -1;
-    uint8_t nonce_counter[16] = {0}, mac_iv[16] = {0}, mac[16] = {0},
-                                mac_recv[16] = {0}, stream_block[16] = {0}, zero_block[16] = {0},
-                                        plain_len, block_size;
+    ccm_ctx_t ctx;
+    int res = cipher_init_ccm(&ctx, cipher, mac_length, length_encoding,
+                              nonce, nonce_len, auth_data_len, input_len);
 
-    if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
-        return CCM_ERR_INVALID_MAC_LENGTH;
+    if (res == 0) {
+        res = cipher_update_ccm_aad(&ctx, auth_data, auth_data_len);
     }
+    if (res == 0) {
+        res = cipher_encrypt_ccm_update(&ctx, input, input_len, output);
+    }
+    if (res == 0) {
+        res = cipher_encrypt_ccm_finish(&ctx, output + input_len);
+    }
+    return (res < 0) ? res : (int)(input_len + mac_length);
+}
+
+
+int cipher_decrypt_ccm(cipher_t* cipher,
+                       const uint8_t* auth_data, uint32_t auth_data_len,
+                       uint8_t mac_length, uint8_t length_encoding,
+                       const uint8_t* nonce, size_t nonce_len,
+                       const uint8_t* input, size_t input_len,
+                       uint8_t* plain)
+{
+    ccm_ctx_t ctx;
+    size_t plain_len;
+    int res;
 
     if (length_encoding < 2 || length_encoding > 8 ||
             !_fits_in_nbytes(input_len, length_encoding)) {
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
-
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
-    block_size = cipher_get_block_size(cipher);
-    memcpy(&nonce_counter[1], nonce, min(nonce_len, (size_t) 15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Decrypt message in counter mode */
-    plain_len = input_len - mac_length;
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             plain_len, plain);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, plain_len, mac_iv) < 0) {
+    if (input_len < mac_length) {
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
-    /* MAC calulation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
-    if (len < 0) {
-        return len;
-    }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, plain, plain_len, mac);
-    if (len < 0) {
-        return len;
+    plain_len = input_len - mac_length;
+    res = cipher_init_ccm(&ctx, cipher, mac_length, length_encoding,
+                          nonce, nonce_len, auth_data_len, plain_len);
+    if (res == 0) {
+        res = cipher_update_ccm_aad(&ctx, auth_data, auth_data_len);
     }
-
-    /* mac = input[plain_len...plain_len+mac_length] ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        mac_recv[i] = input[len + i] ^ stream_block[i];
+    if (res == 0) {
+        res = cipher_decrypt_ccm_update(&ctx, input, plain_len, plain);
     }
-
-    if (!crypto_equals(mac_recv, mac, mac_length)) {
-        return CCM_ERR_INVALID_CBC_MAC;
+    if (res == 0) {
+        res = cipher_decrypt_ccm_finish(&ctx, input + plain_len);
     }
-
-    return plain_len;
+    return (res < 0) ? res : (int)plain_len;
 }
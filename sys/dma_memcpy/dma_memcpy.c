@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_dma_memcpy
+ * @{
+ *
+ * @file
+ * @brief       DMA memcpy implementation
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "dma_memcpy.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/* longest transfer in items all DMA implementations can do in one go */
+#define CHUNK_MAX       (0x7fffU)
+
+/* the state below belongs to the thread holding the DMA stream */
+static uint8_t *_dst;
+static const uint8_t *_src;
+static size_t _len;
+static uint8_t _flags;
+static bool _running;
+static uint32_t _fill;
+
+static void _next(void)
+{
+    unsigned shift = (_flags & DMA_DATA_WIDTH_MASK) >> DMA_DATA_WIDTH_SHIFT;
+    size_t items = _len >> shift;
+
+    if (items > CHUNK_MAX) {
+        items = CHUNK_MAX;
+    }
+    dma_configure(DMA_MEMCPY_DEV, 0, _src, _dst, items, DMA_MEM_TO_MEM,
+                  _flags);
+    dma_start(DMA_MEMCPY_DEV);
+
+    _dst += items << shift;
+    if (_flags & DMA_INC_SRC_ADDR) {
+        _src += items << shift;
+    }
+    _len -= items << shift;
+}
+
+static void _start(void *dst, const void *src, size_t len, uint8_t inc)
+{
+    uintptr_t align = (uintptr_t)dst | len;
+
+    if (inc & DMA_INC_SRC_ADDR) {
+        align |= (uintptr_t)src;
+    }
+    /* use the widest item all of the buffers and the length are aligned to */
+    if ((align & 0x3) == 0) {
+        _flags = inc | DMA_DATA_WIDTH_WORD;
+    }
+    else if ((align & 0x1) == 0) {
+        _flags = inc | DMA_DATA_WIDTH_HALF_WORD;
+    }
+    else {
+        _flags = inc | DMA_DATA_WIDTH_BYTE;
+    }
+    DEBUG("dma_memcpy: moving %u bytes, flags 0x%02x\n", (unsigned)len,
+          (unsigned)_flags);
+
+    _dst = dst;
+    _src = src;
+    _len = len;
+    _running = true;
+    _next();
+}
+
+void *dma_memcpy(void *dst, const void *src, size_t len)
+{
+    if (len < DMA_MEMCPY_THRESHOLD) {
+        return memcpy(dst, src, len);
+    }
+    dma_memcpy_async(dst, src, len);
+    dma_memcpy_wait();
+    return dst;
+}
+
+void *dma_memset(void *dst, int c, size_t len)
+{
+    if (len < DMA_MEMCPY_THRESHOLD) {
+        return memset(dst, c, len);
+    }
+    dma_acquire(DMA_MEMCPY_DEV);
+    _fill = (uint8_t)c * 0x01010101UL;
+    _start(dst, &_fill, len, DMA_INC_DST_ADDR);
+    dma_memcpy_wait();
+    return dst;
+}
+
+void dma_memcpy_async(void *dst, const void *src, size_t len)
+{
+    dma_acquire(DMA_MEMCPY_DEV);
+    if (len < DMA_MEMCPY_THRESHOLD) {
+        memcpy(dst, src, len);
+        _running = false;
+        return;
+    }
+    _start(dst, src, len, DMA_INC_BOTH_ADDR);
+}
+
+void dma_memcpy_wait(void)
+{
+    while (_running) {
+        dma_wait(DMA_MEMCPY_DEV);
+        dma_stop(DMA_MEMCPY_DEV);
+        if (_len > 0) {
+            _next();
+        }
+        else {
+            _running = false;
+        }
+    }
+    dma_release(DMA_MEMCPY_DEV);
+}
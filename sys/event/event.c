@@ -21,6 +21,13 @@ void event_queue_init(event_queue_t *queue)
     queue->waiter = (thread_t *)sched_active_thread;
 }
 
+void event_queues_init(event_queue_t *queues, size_t n_queues)
+{
+    for (size_t i = 0; i < n_queues; i++) {
+        event_queue_init(&queues[i]);
+    }
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && queue->waiter && event);
@@ -70,6 +77,30 @@ event_t *event_wait(event_queue_t *queue)
     return result;
 }
 
+event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
+{
+    assert(queues && n_queues);
+
+    event_t *result = NULL;
+    while (1) {
+        unsigned state = irq_disable();
+        for (size_t i = 0; i < n_queues; i++) {
+            result = (event_t *) clist_lpop(&queues[i].event_list);
+            if (result) {
+                break;
+            }
+        }
+        irq_restore(state);
+        if (result) {
+            break;
+        }
+        /* a stale flag only causes another pass over the queues */
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+    result->list_node.next = NULL;
+    return result;
+}
+
 void event_loop(event_queue_t *queue)
 {
     event_t *event;
@@ -78,3 +109,12 @@ void event_loop(event_queue_t *queue)
         event->handler(event);
     }
 }
+
+void event_loop_multi(event_queue_t *queues, size_t n_queues)
+{
+    event_t *event;
+
+    while ((event = event_wait_multi(queues, n_queues))) {
+        event->handler(event);
+    }
+}
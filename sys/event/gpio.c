@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include "irq.h"
+#include "event/gpio.h"
+
+static void _event_gpio_callback(void *arg)
+{
+    event_gpio_t *event_gpio = (event_gpio_t *)arg;
+
+    if (event_gpio->oneshot) {
+        gpio_irq_disable(event_gpio->pin);
+    }
+    if (event_gpio->count < UINT16_MAX) {
+        event_gpio->count++;
+    }
+    /* posting an event that is still queued is a no-op */
+    event_post(event_gpio->queue, event_gpio->event);
+}
+
+int event_gpio_init(event_gpio_t *event_gpio, gpio_t pin, gpio_mode_t mode,
+                    gpio_flank_t flank, bool oneshot, event_queue_t *queue,
+                    event_t *event)
+{
+    event_gpio->queue = queue;
+    event_gpio->event = event;
+    event_gpio->pin = pin;
+    event_gpio->oneshot = oneshot;
+    event_gpio->count = 0;
+
+    return gpio_init_int(pin, mode, flank, _event_gpio_callback, event_gpio);
+}
+
+unsigned event_gpio_get_count(event_gpio_t *event_gpio)
+{
+    unsigned state = irq_disable();
+    unsigned count = event_gpio->count;
+    event_gpio->count = 0;
+    irq_restore(state);
+
+    return count;
+}
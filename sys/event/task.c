@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include "event/task.h"
+
+static void _event_task_handler(event_t *event)
+{
+    event_task_t *task = (event_task_t *)event;
+
+    task->fn(task);
+}
+
+void event_task_init(event_task_t *task, event_queue_t *queue,
+                     event_task_fn_t fn)
+{
+    task->super.handler = _event_task_handler;
+    task->super.list_node.next = NULL;
+    task->queue = queue;
+    task->fn = fn;
+    task->lc = 0;
+#ifdef MODULE_EVENT_TIMEOUT
+    event_timeout_init(&task->timeout, queue, &task->super);
+#endif
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <string.h>
+
+#include "irq.h"
+#include "event/workq.h"
+#ifdef MODULE_ESP_APP_CPU
+#include "esp_app_cpu.h"
+#endif
+
+#ifdef MODULE_ESP_APP_CPU
+static void _run(void *arg)
+{
+    event_t *event = arg;
+    event->handler(event);
+}
+#endif
+
+static void *_worker(void *arg)
+{
+    event_workq_worker_t *worker = arg;
+    event_workq_t *workq = worker->workq;
+
+    while (1) {
+        event_t *event = event_wait(&worker->queue);
+
+        worker->busy = true;
+#ifdef MODULE_ESP_APP_CPU
+        if (workq->app_cpu) {
+            esp_app_cpu_exec(_run, event);
+        }
+        else
+#endif
+        {
+            event->handler(event);
+        }
+        worker->busy = false;
+        workq->completed++;
+    }
+
+    return NULL;
+}
+
+int event_workq_init(event_workq_t *workq, event_workq_worker_t *workers,
+                     unsigned numof, char *stacks, size_t stacksize,
+                     uint8_t prio, const char *name)
+{
+    memset(workq, 0, sizeof(*workq));
+    workq->workers = workers;
+    workq->numof = numof;
+
+    for (unsigned i = 0; i < numof; i++) {
+        event_workq_worker_t *worker = &workers[i];
+
+        memset(worker, 0, sizeof(*worker));
+        worker->workq = workq;
+        worker->pid = thread_create(stacks + (i * stacksize), stacksize, prio,
+                                    THREAD_CREATE_STACKTEST, _worker, worker,
+                                    name);
+        if (worker->pid <= KERNEL_PID_UNDEF) {
+            return -1;
+        }
+        /* the queue belongs to the worker, not to the calling thread */
+        worker->queue.waiter = (thread_t *)thread_get(worker->pid);
+    }
+    return 0;
+}
+
+void event_workq_submit(event_workq_t *workq, event_t *work)
+{
+    unsigned state = irq_disable();
+    event_workq_worker_t *worker = NULL;
+
+    /* prefer a worker that has nothing to do */
+    for (unsigned i = 0; i < workq->numof; i++) {
+        if (!workq->workers[i].busy &&
+            !clist_rpeek(&workq->workers[i].queue.event_list)) {
+            worker = &workq->workers[i];
+            break;
+        }
+    }
+    if (worker == NULL) {
+        worker = &workq->workers[workq->next];
+        workq->next = (workq->next + 1) % workq->numof;
+    }
+    if (!work->list_node.next) {
+        workq->submitted++;
+    }
+    irq_restore(state);
+
+    event_post(&worker->queue, work);
+}
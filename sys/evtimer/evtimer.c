@@ -31,6 +31,279 @@
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+static void _set_timer(xtimer_t *timer, uint32_t offset_ms)
+{
+    uint64_t offset_us = (uint64_t)offset_ms * US_PER_MS;
+
+    DEBUG("evtimer: now=%" PRIu32 " us setting xtimer to %" PRIu32 ":%" PRIu32 " us\n",
+          xtimer_now_usec(), (uint32_t)(offset_us >> 32), (uint32_t)(offset_us));
+
+    xtimer_set64(timer, offset_us);
+}
+
+#ifdef MODULE_EVTIMER_HEAP
+/*
+ * The events form a pairing heap: evtimer_t::events points to the event that
+ * is due first, evtimer_event_t::child to the first of its children and
+ * evtimer_event_t::next to the next sibling. evtimer_event_t::prev points to
+ * the previous sibling or, for the first child, to the parent.
+ *
+ * Once added, an event stores its absolute target time in milliseconds in
+ * evtimer_event_t::long_offset (upper 32 bit) and evtimer_event_t::offset
+ * (lower 32 bit).
+ */
+static inline uint64_t _now_ms(void)
+{
+    return div_u64_by_125(xtimer_now_usec64() >> 3);
+}
+
+static inline uint64_t _target(const evtimer_event_t *event)
+{
+    return ((uint64_t)event->long_offset << 32) | event->offset;
+}
+
+/**
+ * @brief link two heap roots, return the root of the resulting heap
+ */
+static evtimer_event_t *_heap_meld(evtimer_event_t *a, evtimer_event_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (_target(a) > _target(b)) {
+        evtimer_event_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    /* b becomes first child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+/**
+ * @brief two-pass pairing of a list of siblings into a single heap
+ */
+static evtimer_event_t *_heap_merge_pairs(evtimer_event_t *first)
+{
+    evtimer_event_t *pairs = NULL;
+    evtimer_event_t *root = NULL;
+
+    /* first pass: meld siblings pairwise from left to right, keep the
+     * results in reverse order */
+    while (first) {
+        evtimer_event_t *a = first;
+        evtimer_event_t *b = first->next;
+
+        first = (b) ? b->next : NULL;
+        a->next = a->prev = NULL;
+        if (b) {
+            b->next = b->prev = NULL;
+        }
+        a = _heap_meld(a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+    /* second pass: meld the pairs from right to left */
+    while (pairs) {
+        evtimer_event_t *next = pairs->next;
+
+        pairs->next = NULL;
+        root = _heap_meld(root, pairs);
+        pairs = next;
+    }
+
+    return root;
+}
+
+static evtimer_event_t *_pop_first(evtimer_t *evtimer)
+{
+    evtimer_event_t *event = evtimer->events;
+
+    evtimer->events = _heap_merge_pairs(event->child);
+    event->next = event->prev = event->child = NULL;
+
+    return event;
+}
+
+/**
+ * @brief remove an event that is not the root of the heap
+ */
+static void _heap_cut(evtimer_event_t *event)
+{
+    evtimer_event_t *prev = event->prev;
+    evtimer_event_t *next = event->next;
+    evtimer_event_t *repl;
+
+    /* not in the heap, or links copied from an event that is */
+    if (!prev || ((prev->child != event) && (prev->next != event))) {
+        return;
+    }
+    /* replace event by the heap of its children, its root is still later
+     * than the parent of event */
+    repl = _heap_merge_pairs(event->child);
+    if (repl) {
+        repl->next = next;
+    }
+    else {
+        repl = next;
+    }
+    if (repl) {
+        repl->prev = prev;
+    }
+    if (next && (next != repl)) {
+        next->prev = repl;
+    }
+    if (prev->child == event) {
+        prev->child = repl;
+    }
+    else {
+        prev->next = repl;
+    }
+    event->next = event->prev = event->child = NULL;
+}
+
+static void _update_timer(evtimer_t *evtimer)
+{
+    if (evtimer->events) {
+        uint64_t target = _target(evtimer->events);
+        uint64_t now = _now_ms();
+
+        _set_timer(&evtimer->timer,
+                   (target > now) ? (uint32_t)(target - now) : 0);
+    }
+    else {
+        xtimer_remove(&evtimer->timer);
+    }
+}
+
+void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("evtimer_add(): adding event with offset %" PRIu32 "\n", event->offset);
+
+    uint64_t target = _now_ms() + event->offset;
+    event->offset = (uint32_t)target;
+    event->long_offset = (uint32_t)(target >> 32);
+    event->next = event->prev = event->child = NULL;
+    evtimer->events = _heap_meld(evtimer->events, event);
+    if (evtimer->events == event) {
+        _update_timer(evtimer);
+    }
+    irq_restore(state);
+    if (sched_context_switch_request) {
+        thread_yield_higher();
+    }
+}
+
+void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("evtimer_del(): removing event with target %" PRIu32 "\n", event->offset);
+
+    if (evtimer->events == event) {
+        _pop_first(evtimer);
+        _update_timer(evtimer);
+    }
+    else {
+        _heap_cut(event);
+    }
+    irq_restore(state);
+}
+
+static void _evtimer_handler(void *arg)
+{
+    DEBUG("_evtimer_handler()\n");
+
+    evtimer_t *evtimer = (evtimer_t *)arg;
+    uint64_t now = _now_ms();
+
+    while (evtimer->events && (_target(evtimer->events) <= now)) {
+        evtimer->callback(_pop_first(evtimer));
+    }
+
+    _update_timer(evtimer);
+}
+
+evtimer_event_t *evtimer_iter(const evtimer_t *evtimer,
+                              const evtimer_event_t *prev)
+{
+    if (prev == NULL) {
+        return evtimer->events;
+    }
+    if (prev->child) {
+        return prev->child;
+    }
+    while (prev) {
+        if (prev->next) {
+            return prev->next;
+        }
+        /* go back to the first sibling, its prev is the parent */
+        while (prev->prev && (prev->prev->child != prev)) {
+            prev = prev->prev;
+        }
+        prev = prev->prev;
+    }
+    return NULL;
+}
+
+uint32_t evtimer_remaining(const evtimer_t *evtimer,
+                           const evtimer_event_t *event)
+{
+    uint64_t now = _now_ms();
+
+    (void)evtimer;
+    return (_target(event) > now) ? (uint32_t)(_target(event) - now) : 0;
+}
+/**
+ * @brief   order of events that are due at the same time is arbitrary but fixed
+ */
+static bool _due_before(const evtimer_event_t *a, const evtimer_event_t *b)
+{
+    return (_target(a) < _target(b)) ||
+           ((_target(a) == _target(b)) && ((uintptr_t)a < (uintptr_t)b));
+}
+
+void evtimer_print(const evtimer_t *evtimer)
+{
+    const evtimer_event_t *last = NULL;
+    uint64_t base = _now_ms();
+
+    /* print the events in the order they are due, each offset relative to the
+     * previous event like with the list */
+    while (1) {
+        const evtimer_event_t *next = NULL;
+        evtimer_event_t *event = NULL;
+
+        while ((event = evtimer_iter(evtimer, event))) {
+            if ((!last || _due_before(last, event)) &&
+                (!next || _due_before(event, next))) {
+                next = event;
+            }
+        }
+        if (!next) {
+            break;
+        }
+        uint64_t target = _target(next);
+
+        printf("ev offset=%u\n", (unsigned)((target > base) ? (target - base) : 0));
+        if (target > base) {
+            base = target;
+        }
+        last = next;
+    }
+}
+#else
 /* XXX this function is intentionally non-static, since the optimizer can't
  * handle the pointer hack in this function */
 void evtimer_add_event_to_list(evtimer_t *evtimer, evtimer_event_t *event)
@@ -92,16 +365,6 @@ static void _del_event_from_list(evtimer_t *evtimer, evtimer_event_t *event)
     }
 }
 
-static void _set_timer(xtimer_t *timer, uint32_t offset_ms)
-{
-    uint64_t offset_us = (uint64_t)offset_ms * US_PER_MS;
-
-    DEBUG("evtimer: now=%" PRIu32 " us setting xtimer to %" PRIu32 ":%" PRIu32 " us\n",
-          xtimer_now_usec(), (uint32_t)(offset_us >> 32), (uint32_t)(offset_us));
-
-    xtimer_set64(timer, offset_us);
-}
-
 static void _update_timer(evtimer_t *evtimer)
 {
     if (evtimer->events) {
@@ -199,6 +462,33 @@ static void _evtimer_handler(void *arg)
     _update_timer(evtimer);
 }
 
+evtimer_event_t *evtimer_iter(const evtimer_t *evtimer,
+                              const evtimer_event_t *prev)
+{
+    return (prev == NULL) ? evtimer->events : prev->next;
+}
+
+uint32_t evtimer_remaining(const evtimer_t *evtimer,
+                           const evtimer_event_t *event)
+{
+    uint32_t offset = 0;
+
+    for (evtimer_event_t *ptr = evtimer->events; ptr; ptr = ptr->next) {
+        offset += ptr->offset;
+        if (ptr == event) {
+            break;
+        }
+    }
+    return offset;
+}
+void evtimer_print(const evtimer_t *evtimer)
+{
+    for (evtimer_event_t *event = evtimer->events; event; event = event->next) {
+        printf("ev offset=%u\n", (unsigned)event->offset);
+    }
+}
+#endif /* MODULE_EVTIMER_HEAP */
+
 void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
 {
     evtimer->callback = handler;
@@ -207,13 +497,3 @@ void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
     evtimer->events = NULL;
 }
 
-void evtimer_print(const evtimer_t *evtimer)
-{
-    evtimer_event_t *list = evtimer->events;
-
-    while (list->next) {
-        evtimer_event_t *list_entry = list->next;
-        printf("ev offset=%u\n", (unsigned)list_entry->offset);
-        list = list->next;
-    }
-}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_flashpage_stream
+ * @{
+ *
+ * @file
+ * @brief       Buffered flash page writer implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "flashpage_stream.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#if (FLASHPAGE_SIZE % FLASHPAGE_STREAM_BUFSIZE) != 0
+#error "FLASHPAGE_STREAM_BUFSIZE must divide FLASHPAGE_SIZE"
+#endif
+#ifdef MODULE_PERIPH_FLASHPAGE_RAW
+#if (FLASHPAGE_STREAM_BUFSIZE % FLASHPAGE_RAW_BLOCKSIZE) != 0
+#error "FLASHPAGE_STREAM_BUFSIZE must be a multiple of FLASHPAGE_RAW_BLOCKSIZE"
+#endif
+#define UNIT    (FLASHPAGE_RAW_BLOCKSIZE)
+#else
+#if FLASHPAGE_STREAM_BUFSIZE != FLASHPAGE_SIZE
+#error "FLASHPAGE_STREAM_BUFSIZE must equal FLASHPAGE_SIZE without raw writes"
+#endif
+#define UNIT    (FLASHPAGE_SIZE)
+#endif
+
+static void _enter_page(flashpage_stream_t *stream)
+{
+#ifdef MODULE_PERIPH_FLASHPAGE_RAW
+    /* erase ahead, so the buffers can be programmed directly */
+    if (stream->page < FLASHPAGE_NUMOF) {
+        flashpage_write(stream->page, NULL);
+    }
+#else
+    (void)stream;
+#endif
+}
+
+/* a buffer never spans two pages, as a flush may leave the offset
+ * unaligned to FLASHPAGE_STREAM_BUFSIZE */
+static size_t _buf_limit(const flashpage_stream_t *stream)
+{
+    size_t left = FLASHPAGE_SIZE - stream->offset;
+
+    return (left < FLASHPAGE_STREAM_BUFSIZE) ? left : FLASHPAGE_STREAM_BUFSIZE;
+}
+
+static void _write_buf(flashpage_stream_t *stream, size_t len)
+{
+    DEBUG("flashpage_stream: write %u bytes to page %u at %u\n",
+          (unsigned)len, stream->page, (unsigned)stream->offset);
+
+#ifdef MODULE_PERIPH_FLASHPAGE_RAW
+    flashpage_write_raw((uint8_t *)flashpage_addr(stream->page) +
+                        stream->offset, stream->buf, len);
+#else
+    flashpage_write(stream->page, stream->buf);
+#endif
+
+    stream->offset += len;
+    stream->fill = 0;
+    if (stream->offset >= FLASHPAGE_SIZE) {
+        stream->page++;
+        stream->offset = 0;
+        _enter_page(stream);
+    }
+}
+
+int flashpage_stream_init(flashpage_stream_t *stream, unsigned page)
+{
+    if (page >= FLASHPAGE_NUMOF) {
+        return -EINVAL;
+    }
+    stream->page = page;
+    stream->offset = 0;
+    stream->fill = 0;
+    _enter_page(stream);
+    return 0;
+}
+
+int flashpage_stream_write(flashpage_stream_t *stream, const void *data,
+                           size_t len)
+{
+    const uint8_t *pos = data;
+    size_t room = (FLASHPAGE_NUMOF - stream->page) * FLASHPAGE_SIZE -
+                  stream->offset - stream->fill;
+
+    if (len > room) {
+        return -ENOSPC;
+    }
+
+    while (len) {
+        size_t limit = _buf_limit(stream);
+        size_t chunk = limit - stream->fill;
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(&stream->buf[stream->fill], pos, chunk);
+        stream->fill += chunk;
+        pos += chunk;
+        len -= chunk;
+
+        if (stream->fill == limit) {
+            _write_buf(stream, limit);
+        }
+    }
+    return 0;
+}
+
+void flashpage_stream_flush(flashpage_stream_t *stream)
+{
+    if (stream->fill == 0) {
+        return;
+    }
+
+    size_t len = ((stream->fill + UNIT - 1) / UNIT) * UNIT;
+    memset(&stream->buf[stream->fill], 0xff, len - stream->fill);
+    _write_buf(stream, len);
+}
@@ -31,6 +31,7 @@
 ssize_t write(int fildes, const void *buf, size_t nbyte);
 #endif
 
+#include "div.h"
 #include "fmt.h"
 
 static const char _hex_chars[16] = "0123456789ABCDEF";
@@ -53,6 +54,18 @@ static inline int _is_digit(char c)
     return (c >= '0' && c <= '9');
 }
 
+/* writes the two digits of val < 100 in front of ptr. (val * 103) >> 10
+ * equals val / 10 for all val < 179, so this only needs a 16 bit multiply and
+ * no lookup table, which would end up in RAM on AVR */
+static inline char *_put_pair(char *ptr, unsigned val)
+{
+    unsigned tens = (val * 103) >> 10;
+
+    *--ptr = (val - tens * 10) + '0';
+    *--ptr = tens + '0';
+    return ptr;
+}
+
 static inline int _is_upper(char c)
 {
     return (c >= 'A' && c <= 'Z');
@@ -190,20 +203,20 @@ size_t fmt_u64_dec(char *out, uint64_t val)
     d[3] = (val>>48) & 0xFFFF;
 
     d[0] = 656 * d[3] + 7296 * d[2] + 5536 * d[1] + d[0];
-    q = d[0] / 10000;
-    d[0] = d[0] % 10000;
+    q = div_u32_by_const(d[0], 10000);
+    d[0] -= q * 10000;
 
     d[1] = q + 7671 * d[3] + 9496 * d[2] + 6 * d[1];
-    q = d[1] / 10000;
-    d[1] = d[1] % 10000;
+    q = div_u32_by_const(d[1], 10000);
+    d[1] -= q * 10000;
 
     d[2] = q + 4749 * d[3] + 42 * d[2];
-    q = d[2] / 10000;
-    d[2] = d[2] % 10000;
+    q = div_u32_by_const(d[2], 10000);
+    d[2] -= q * 10000;
 
     d[3] = q + 281 * d[3];
-    q = d[3] / 10000;
-    d[3] = d[3] % 10000;
+    q = div_u32_by_const(d[3], 10000);
+    d[3] -= q * 10000;
 
     d[4] = q;
 
@@ -249,9 +262,18 @@ size_t fmt_u32_dec(char *out, uint32_t val)
 
     if (out) {
         char *ptr = out + len;
-        do {
-            *--ptr = (val % 10) + '0';
-        } while ((val /= 10));
+        /* emit two digits per 32 bit reciprocal multiplication */
+        while (val >= 100) {
+            uint32_t q = div_u32_by_const(val, 100);
+            ptr = _put_pair(ptr, val - q * 100);
+            val = q;
+        }
+        if (val >= 10) {
+            _put_pair(ptr, val);
+        }
+        else {
+            *--ptr = val + '0';
+        }
     }
 
     return len;
@@ -447,15 +469,14 @@ size_t fmt_to_lower(char *out, const char *str)
 uint32_t scn_u32_dec(const char *str, size_t n)
 {
     uint32_t res = 0;
-    while(n--) {
-        char c = *str++;
-        if (!_is_digit(c)) {
+    while (n--) {
+        /* characters below '0' wrap around and fail the check as well */
+        unsigned digit = (unsigned char)*str++ - '0';
+        if (digit > 9) {
             break;
         }
-        else {
-            res *= 10;
-            res += (c - '0');
-        }
+        /* res * 10 without a multiplication on CPUs lacking a multiplier */
+        res = (res << 3) + (res << 1) + digit;
     }
     return res;
 }
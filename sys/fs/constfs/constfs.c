@@ -46,6 +46,8 @@ static off_t constfs_lseek(vfs_file_t *filp, off_t off, int whence);
 static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode, const char *abs_path);
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
 static ssize_t constfs_write(vfs_file_t *filp, const void *src, size_t nbytes);
+static ssize_t constfs_sendfile(vfs_file_t *filp, vfs_sendfile_cb_t cb, void *arg, size_t nbytes);
+static int constfs_mmap(vfs_file_t *filp, off_t off, size_t len, const void **addr);
 
 /* Directory operations */
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname, const char *abs_path);
@@ -67,6 +69,8 @@ static const vfs_file_ops_t constfs_file_ops = {
     .open  = constfs_open,
     .read  = constfs_read,
     .write = constfs_write,
+    .sendfile = constfs_sendfile,
+    .mmap = constfs_mmap,
 };
 
 static const vfs_dir_ops_t constfs_dir_ops = {
@@ -258,6 +262,38 @@ static ssize_t constfs_write(vfs_file_t *filp, const void *src, size_t nbytes)
     return -EBADF;
 }
 
+static ssize_t constfs_sendfile(vfs_file_t *filp, vfs_sendfile_cb_t cb, void *arg, size_t nbytes)
+{
+    constfs_file_t *fp = filp->private_data.ptr;
+    DEBUG("constfs_sendfile: %p, %lu\n", (void *)filp, (unsigned long)nbytes);
+    ssize_t total = 0;
+    while (((size_t)filp->pos < fp->size) && ((size_t)total < nbytes)) {
+        size_t len = nbytes - total;
+        if (len > (fp->size - filp->pos)) {
+            len = fp->size - filp->pos;
+        }
+        /* the file data is constant, hand it out directly */
+        ssize_t res = cb(arg, fp->data + filp->pos, len);
+        if (res <= 0) {
+            return (total > 0) ? total : ((res < 0) ? res : -EIO);
+        }
+        filp->pos += res;
+        total += res;
+    }
+    return total;
+}
+
+static int constfs_mmap(vfs_file_t *filp, off_t off, size_t len, const void **addr)
+{
+    constfs_file_t *fp = filp->private_data.ptr;
+    DEBUG("constfs_mmap: %p, %ld, %lu\n", (void *)filp, (long)off, (unsigned long)len);
+    if (((size_t)off > fp->size) || (len > (fp->size - off))) {
+        return -EINVAL;
+    }
+    *addr = fp->data + off;
+    return 0;
+}
+
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname, const char *abs_path)
 {
     (void) abs_path;
@@ -50,6 +50,10 @@
 
 #include "hashes/sha256.h"
 
+#ifdef MODULE_PERIPH_SHA256
+#include "periph/sha256.h"
+#endif
+
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
 #define be32enc_vect memcpy
@@ -122,43 +126,91 @@ static const uint32_t K[64] = {
     0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
+/* Expand the message schedule in place, W only holds the last 16 words */
+#define W_NEXT(i)   (W[(i) & 15] += s1(W[((i) - 2) & 15]) + W[((i) - 7) & 15] + \
+                                    s0(W[((i) - 15) & 15]))
+
+/* One SHA256 round, the caller rotates the roles of the working variables */
+#define ROUND(a, b, c, d, e, f, g, h, i, w) do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + (w) + K[i]; \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+} while (0)
+
+#ifdef MODULE_HASHES_SHA256_UNROLL
+#define ROUNDS8(i, w) do { \
+        ROUND(a, b, c, d, e, f, g, h, (i) + 0, w((i) + 0)); \
+        ROUND(h, a, b, c, d, e, f, g, (i) + 1, w((i) + 1)); \
+        ROUND(g, h, a, b, c, d, e, f, (i) + 2, w((i) + 2)); \
+        ROUND(f, g, h, a, b, c, d, e, (i) + 3, w((i) + 3)); \
+        ROUND(e, f, g, h, a, b, c, d, (i) + 4, w((i) + 4)); \
+        ROUND(d, e, f, g, h, a, b, c, (i) + 5, w((i) + 5)); \
+        ROUND(c, d, e, f, g, h, a, b, (i) + 6, w((i) + 6)); \
+        ROUND(b, c, d, e, f, g, h, a, (i) + 7, w((i) + 7)); \
+} while (0)
+
+#define W_LOAD(i)   (W[i])
+#endif /* MODULE_HASHES_SHA256_UNROLL */
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
 static void sha256_transform(uint32_t *state, const unsigned char block[64])
 {
-    uint32_t W[64];
-    uint32_t S[8];
+    uint32_t W[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
-    /* 1. Prepare message schedule W. */
     be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
-    }
-
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
-
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
 
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
-
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
+#ifdef MODULE_HASHES_SHA256_UNROLL
+    ROUNDS8(0, W_LOAD);
+    ROUNDS8(8, W_LOAD);
+    for (int i = 16; i < 64; i += 8) {
+        ROUNDS8(i, W_NEXT);
+    }
+#else
+    for (int i = 0; i < 64; i++) {
+        uint32_t tmp = h;
+
+        ROUND(a, b, c, d, e, f, g, tmp, i, (i < 16) ? W[i] : W_NEXT(i));
+        h = g;
+        g = f;
+        f = e;
+        e = d;
+        d = c;
+        c = b;
+        b = a;
+        a = tmp;
     }
+#endif
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+#ifdef MODULE_PERIPH_SHA256
+#define sha256_transform_blocks periph_sha256_transform
+#else
+/* Process a number of consecutive 64 byte blocks */
+static void sha256_transform_blocks(uint32_t *state, const void *blocks,
+                                    size_t num)
+{
+    const unsigned char *block = blocks;
 
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
+    while (num--) {
+        sha256_transform(state, block);
+        block += SHA256_INTERNAL_BLOCK_SIZE;
     }
 }
+#endif
 
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -231,15 +283,15 @@ void sha256_update(sha256_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha256_transform(ctx->state, ctx->buf);
+    sha256_transform_blocks(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
     /* Perform complete blocks */
-    while (len >= 64) {
-        sha256_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
+    if (len >= 64) {
+        sha256_transform_blocks(ctx->state, src, len / 64);
+        src += len & ~(size_t)63;
+        len &= 63;
     }
 
     /* Copy left over data into buffer */
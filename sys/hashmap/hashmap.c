@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashmap
+ * @{
+ *
+ * @file
+ * @brief       Hash map implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "hashes.h"
+#include "hashmap.h"
+
+static inline uint8_t *_entry(const hashmap_t *map, unsigned slot)
+{
+    return map->entries + (slot * map->entry_size);
+}
+
+static inline unsigned _home(const hashmap_t *map, const void *key)
+{
+    return fnv_hash(key, map->key_len) & (map->capacity - 1);
+}
+
+/* returns the slot of key, or -1 if it is not in the map */
+static int _find(const hashmap_t *map, const void *key)
+{
+    unsigned slot = _home(map, key);
+
+    for (unsigned i = 0; i < map->capacity; i++) {
+        if (map->states[slot] == HASHMAP_SLOT_EMPTY) {
+            break;
+        }
+        if ((map->states[slot] == HASHMAP_SLOT_USED) &&
+            (memcmp(_entry(map, slot), key, map->key_len) == 0)) {
+            return slot;
+        }
+        slot = (slot + 1) & (map->capacity - 1);
+    }
+    return -1;
+}
+
+void hashmap_init(hashmap_t *map, void *entries, uint8_t *states,
+                  unsigned capacity, size_t entry_size, size_t key_len)
+{
+    /* capacity must be a power of two */
+    assert(capacity && !(capacity & (capacity - 1)));
+    assert(key_len <= entry_size);
+
+    map->entries = entries;
+    map->states = states;
+    map->capacity = capacity;
+    map->entry_size = entry_size;
+    map->key_len = key_len;
+    hashmap_clear(map);
+}
+
+void hashmap_clear(hashmap_t *map)
+{
+    memset(map->states, HASHMAP_SLOT_EMPTY, map->capacity);
+    map->numof = 0;
+}
+
+void *hashmap_get(const hashmap_t *map, const void *key)
+{
+    int slot = _find(map, key);
+
+    return (slot < 0) ? NULL : _entry(map, slot);
+}
+
+void *hashmap_put(hashmap_t *map, const void *key)
+{
+    unsigned slot = _home(map, key);
+    int free = -1;
+
+    for (unsigned i = 0; i < map->capacity; i++) {
+        if (map->states[slot] == HASHMAP_SLOT_USED) {
+            if (memcmp(_entry(map, slot), key, map->key_len) == 0) {
+                return _entry(map, slot);
+            }
+        }
+        else {
+            /* reuse the first tombstone, but keep looking for the key */
+            if (free < 0) {
+                free = slot;
+            }
+            if (map->states[slot] == HASHMAP_SLOT_EMPTY) {
+                break;
+            }
+        }
+        slot = (slot + 1) & (map->capacity - 1);
+    }
+    if (free < 0) {
+        return NULL;
+    }
+
+    map->states[free] = HASHMAP_SLOT_USED;
+    map->numof++;
+    memcpy(_entry(map, free), key, map->key_len);
+    return _entry(map, free);
+}
+
+void hashmap_remove_entry(hashmap_t *map, void *entry)
+{
+    unsigned slot = ((uint8_t *)entry - map->entries) / map->entry_size;
+
+    assert(slot < map->capacity);
+    assert(map->states[slot] == HASHMAP_SLOT_USED);
+
+    /* a tombstone is only needed if a probe sequence may continue here */
+    if (map->states[(slot + 1) & (map->capacity - 1)] == HASHMAP_SLOT_EMPTY) {
+        map->states[slot] = HASHMAP_SLOT_EMPTY;
+    }
+    else {
+        map->states[slot] = HASHMAP_SLOT_DELETED;
+    }
+    map->numof--;
+}
+
+int hashmap_remove(hashmap_t *map, const void *key)
+{
+    int slot = _find(map, key);
+
+    if (slot < 0) {
+        return -1;
+    }
+    hashmap_remove_entry(map, _entry(map, slot));
+    return 0;
+}
+
+void *hashmap_iter(const hashmap_t *map, unsigned *pos)
+{
+    while (*pos < map->capacity) {
+        unsigned slot = (*pos)++;
+        if (map->states[slot] == HASHMAP_SLOT_USED) {
+            return _entry(map, slot);
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_arena Arena allocator
+ * @ingroup     sys_memory_management
+ * @brief       Bump allocator for objects with the same lifetime
+ *
+ * An arena hands out memory from a caller-provided buffer by advancing a
+ * pointer, like @ref oneway_malloc does for the whole heap. Objects are
+ * not freed one by one, arena_reset() releases all of them at once. This
+ * suits the temporaries of a request handler or a parser: one buffer on
+ * the stack or in a static variable replaces many malloc()/free() pairs
+ * and can't fragment the heap.
+ *
+ * When the buffer is exhausted, an arena with chaining enabled (see
+ * arena_set_chaining()) continues in blocks taken from malloc(), which are
+ * returned to the heap by arena_reset(). Without chaining, arena_alloc()
+ * returns NULL instead.
+ *
+ * The arena functions are not thread-safe. For C++ code, `riot/arena.hpp`
+ * of @ref cpp11-compat provides an allocator for the standard containers.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Arena allocator interface
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Alignment of all allocations, must be a power of two
+ */
+#ifndef ARENA_ALIGNMENT
+#define ARENA_ALIGNMENT     (sizeof(uint64_t))
+#endif
+
+/**
+ * @brief   Block chained to an arena, followed by its memory
+ */
+typedef struct arena_chunk {
+    struct arena_chunk *next;   /**< previously chained block */
+} arena_chunk_t;
+
+/**
+ * @brief   Arena
+ */
+typedef struct {
+    uint8_t *pos;               /**< next free byte of the current block */
+    uint8_t *end;               /**< end of the current block */
+    uint8_t *buf;               /**< caller-provided buffer */
+    size_t size;                /**< size of arena_t::buf */
+    arena_chunk_t *chunks;      /**< chained blocks, most recent first */
+    size_t chunk_size;          /**< size of chained blocks, 0 if disabled */
+} arena_t;
+
+/**
+ * @brief   Initialize an arena without chaining
+ *
+ * @param[out] arena    arena to initialize
+ * @param[in] buf       buffer to allocate from, must stay valid as long as
+ *                      the arena is used
+ * @param[in] size      size of @p buf in bytes
+ */
+void arena_init(arena_t *arena, void *buf, size_t size);
+
+/**
+ * @brief   Allow the arena to grow with blocks from malloc()
+ *
+ * @param[in,out] arena     arena
+ * @param[in] chunk_size    usable size of a chained block in bytes, larger
+ *                          allocations get a block of their own; 0 disables
+ *                          chaining
+ */
+static inline void arena_set_chaining(arena_t *arena, size_t chunk_size)
+{
+    arena->chunk_size = chunk_size;
+}
+
+/**
+ * @brief   Allocate memory from an arena
+ *
+ * @param[in,out] arena     arena
+ * @param[in] size          number of bytes to allocate
+ *
+ * @return  memory aligned to @ref ARENA_ALIGNMENT, valid until the next
+ *          arena_reset()
+ * @return  NULL if the arena is exhausted
+ */
+void *arena_alloc(arena_t *arena, size_t size);
+
+/**
+ * @brief   Allocate zeroed memory for an array from an arena
+ *
+ * @param[in,out] arena     arena
+ * @param[in] nmemb         number of elements
+ * @param[in] size          size of an element
+ *
+ * @return  zeroed memory, valid until the next arena_reset()
+ * @return  NULL if the arena is exhausted or the size overflows
+ */
+void *arena_calloc(arena_t *arena, size_t nmemb, size_t size);
+
+/**
+ * @brief   Release all allocations of an arena at once
+ *
+ * Chained blocks are returned to the heap, the arena continues at the
+ * start of its buffer.
+ *
+ * @param[in,out] arena     arena
+ */
+void arena_reset(arena_t *arena);
+
+/**
+ * @brief   Get the number of bytes left in the current block of an arena
+ *
+ * @param[in] arena     arena
+ *
+ * @return  bytes available without chaining another block
+ */
+static inline size_t arena_available(const arena_t *arena)
+{
+    return arena->end - arena->pos;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARENA_H */
+/** @} */
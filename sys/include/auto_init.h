@@ -59,6 +59,14 @@
  *
  * From low-level CPU peripheral, the default initialization parameters are
  * defined in each board configuration that provides them.
+ *
+ * Sensors, actuators and storage devices are not needed by most modules
+ * initialized before `main()`, but probing them over SPI or I2C can take a
+ * considerable part of the boot time. With the `auto_init_deferred` module
+ * they are initialized in a separate thread of lower priority than the main
+ * thread, so `main()` and the network stack start right away. Code that
+ * accesses these devices, e.g. via SAUL, has to call @ref auto_init_wait
+ * first, as the `saul` and SHT1X shell commands do.
  */
 
 /**
@@ -105,6 +113,30 @@ extern "C" {
  */
 void auto_init(void);
 
+#if defined(MODULE_AUTO_INIT_DEFERRED) || defined(DOXYGEN)
+/**
+ * @brief   Stack size of the thread initializing the deferred modules
+ */
+#ifndef AUTO_INIT_DEFERRED_STACKSIZE
+#define AUTO_INIT_DEFERRED_STACKSIZE    (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the thread initializing the deferred modules
+ */
+#ifndef AUTO_INIT_DEFERRED_PRIO
+#define AUTO_INIT_DEFERRED_PRIO         (THREAD_PRIORITY_MAIN + 1)
+#endif
+
+/**
+ * @brief   Waits until the deferred modules are initialized
+ *
+ * Only available with the `auto_init_deferred` module. Must not be called by
+ * the initialization functions of deferred modules.
+ */
+void auto_init_wait(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
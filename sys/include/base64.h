@@ -20,6 +20,7 @@
 #ifndef BASE64_H
 #define BASE64_H
 
+#include <stdbool.h>
 #include <stddef.h> /* for size_t */
 
 #ifdef __cplusplus
@@ -32,6 +33,21 @@ extern "C" {
 #define BASE64_ERROR_DATA_IN          (-3) /**< error value for invalid input buffer           */
 #define BASE64_ERROR_DATA_IN_SIZE     (-4) /**< error value for invalid input buffer size      */
 
+/**
+ * @brief   Maximum number of characters written by a single call to
+ *          @ref base64_stream_encode for `len` bytes of input
+ */
+#define BASE64_STREAM_OUT_SIZE(len)   (4 * (((len) + 2) / 3))
+
+/**
+ * @brief   State of a streaming base64 encoder
+ */
+typedef struct {
+    const char *alphabet;       /**< alphabet used for encoding */
+    unsigned char buf[3];       /**< input bytes not yet encoded */
+    unsigned len;               /**< number of bytes in `buf` */
+} base64_stream_t;
+
 /**
  * @brief           Encodes a given datum to base64 and save the result to the given destination.
  * @param[in]       data_in           pointer to the datum to encode
@@ -53,6 +69,16 @@ extern "C" {
 int base64_encode(const void *data_in, size_t data_in_size,
                   unsigned char *base64_out, size_t *base64_out_size);
 
+/**
+ * @brief           Encodes a given datum to base64 using the URL and filename
+ *                  safe alphabet (RFC 4648, section 5)
+ *
+ * Behaves like @ref base64_encode, but uses '-' and '_' instead of '+' and '/'.
+ * The result is padded with '='.
+ */
+int base64url_encode(const void *data_in, size_t data_in_size,
+                     unsigned char *base64_out, size_t *base64_out_size);
+
 /**
  * @brief           Decodes a given base64 string and save the result to the given destination.
  * @param[out]      base64_in        pointer to store the encoded base64 string
@@ -74,6 +100,42 @@ int base64_encode(const void *data_in, size_t data_in_size,
 int base64_decode(const unsigned char *base64_in, size_t base64_in_size,
                   void *data_out, size_t *data_out_size);
 
+/**
+ * @brief           Initializes a streaming base64 encoder
+ *
+ * @param[out]      stream  encoder state to initialize
+ * @param[in]       url     use the URL safe alphabet if true
+ */
+void base64_stream_init(base64_stream_t *stream, bool url);
+
+/**
+ * @brief           Encodes a chunk of data
+ *
+ * Input bytes that do not complete a group of three are kept in @p stream
+ * and encoded by the next call or by @ref base64_stream_finish.
+ *
+ * @param[in,out]   stream          encoder state
+ * @param[in]       data_in         chunk to encode
+ * @param[in]       data_in_size    size of `data_in`
+ * @param[out]      base64_out      destination, must hold at least
+ *                                  @ref BASE64_STREAM_OUT_SIZE(`data_in_size`)
+ *                                  characters
+ *
+ * @returns         number of characters written to `base64_out`
+ */
+size_t base64_stream_encode(base64_stream_t *stream, const void *data_in,
+                            size_t data_in_size, unsigned char *base64_out);
+
+/**
+ * @brief           Encodes the remaining bytes with padding
+ *
+ * @param[in,out]   stream          encoder state, reset afterwards
+ * @param[out]      base64_out      destination, must hold 4 characters
+ *
+ * @returns         number of characters written to `base64_out`
+ */
+size_t base64_stream_finish(base64_stream_t *stream, unsigned char *base64_out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,20 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * @ref BENCHMARK_SAMPLE measures every single call of the benchmarked code
+ * with the CPU cycle counter and reports minimum, median, maximum, mean and
+ * standard deviation as one JSON object per line, so results can be
+ * collected by scripts and compared across releases. Interrupts stay enabled,
+ * their influence shows up in the maximum and the standard deviation instead
+ * of being hidden.
+ *
+ * The cycle counter is used on Cortex-M3 and up (DWT), RISC-V, Xtensa (ESP)
+ * and MIPS. Other platforms fall back to xtimer ticks, see
+ * @ref BENCHMARK_UNIT.
+ *
+ * @ref BENCHMARK_FUNC only measures the average of many runs with interrupts
+ * disabled and is kept for simple use cases.
  * @{
  *
  * @file
@@ -23,6 +37,7 @@
 
 #include <stdint.h>
 
+#include "cpu.h"
 #include "irq.h"
 #include "xtimer.h"
 
@@ -30,6 +45,76 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Unit of the values returned by @ref benchmark_cycles
+ */
+#if defined(DWT_CTRL_CYCCNTENA_Msk) || defined(__riscv) || \
+    defined(__XTENSA__) || defined(__mips__)
+#define BENCHMARK_UNIT      "cycles"
+#else
+#define BENCHMARK_UNIT      "ticks"
+#endif
+
+/**
+ * @brief   Read the cycle counter
+ *
+ * @return  current value of the free running 32-bit cycle counter, or the
+ *          xtimer tick count on platforms without one
+ */
+static inline uint32_t benchmark_cycles(void)
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    return DWT->CYCCNT;
+#elif defined(__riscv)
+    uint32_t cycles;
+    __asm__ volatile ("rdcycle %0" : "=r" (cycles));
+    return cycles;
+#elif defined(__XTENSA__)
+    uint32_t cycles;
+    __asm__ volatile ("rsr %0, ccount" : "=a" (cycles));
+    return cycles;
+#elif defined(__mips__)
+    uint32_t count;
+    /* the CP0 Count register increments every other cycle */
+    __asm__ volatile ("mfc0 %0, $9" : "=r" (count));
+    return count << 1;
+#else
+    return xtimer_now().ticks32;
+#endif
+}
+
+/**
+ * @brief   Measure each call of a given function separately
+ *
+ * Runs @p func @p warmup times without measuring, then @p samples times
+ * measuring each run, and prints the statistics with
+ * @ref benchmark_report. The samples are kept on the stack, so the calling
+ * thread needs 4 bytes of stack per sample.
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] warmup    number of runs before the measurement starts
+ * @param[in] samples   number of measured runs
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_SAMPLE(name, warmup, samples, func)                   \
+    {                                                                   \
+        uint32_t _benchmark_samples[samples];                          \
+        unsigned _benchmark_warmup = (warmup);                          \
+        benchmark_init();                                               \
+        for (unsigned _benchmark_i = 0;                                 \
+             _benchmark_i < _benchmark_warmup + (samples);              \
+             _benchmark_i++) {                                          \
+            uint32_t _benchmark_start = benchmark_cycles();             \
+            func;                                                       \
+            uint32_t _benchmark_time = benchmark_cycles() - _benchmark_start; \
+            if (_benchmark_i >= _benchmark_warmup) {                    \
+                _benchmark_samples[_benchmark_i - _benchmark_warmup] =  \
+                    _benchmark_time;                                    \
+            }                                                           \
+        }                                                               \
+        benchmark_report(name, _benchmark_samples, samples);           \
+    }
+
 /**
  * @brief   Measure the runtime of a given function call
  *
@@ -62,6 +147,26 @@ extern "C" {
  */
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name);
 
+/**
+ * @brief   Enable the cycle counter and measure the measurement overhead
+ *
+ * Called by @ref BENCHMARK_SAMPLE, only the first call does something.
+ */
+void benchmark_init(void);
+
+/**
+ * @brief   Print statistics of the given samples on STDIO
+ *
+ * The overhead of reading the cycle counter is subtracted from each sample.
+ * The output is a single line JSON object with the keys `name`, `unit`,
+ * `samples`, `min`, `median`, `max`, `mean` and `stddev`.
+ *
+ * @param[in] name      name to label the output
+ * @param[in,out] samples   measured values, get sorted
+ * @param[in] num       number of samples
+ */
+void benchmark_report(const char *name, uint32_t *samples, unsigned num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -228,6 +228,69 @@ void bloom_add(bloom_t *bloom, const uint8_t *buf, size_t len);
  */
 bool bloom_check(bloom_t *bloom, const uint8_t *buf, size_t len);
 
+/**
+ * @brief Maximum number of bits set per element in a blocked Bloom filter
+ */
+#define BLOOM_BLOCKED_K_MAX     (16U)
+
+/**
+ * @brief Blocked Bloom filter object
+ *
+ * A blocked Bloom filter places all k bits of an element into a single
+ * 32 bit word. An element is hashed only once: the upper bits of the hash
+ * select the word, the bits within the word are derived from the same hash
+ * by double hashing. Adding or checking an element thus costs one hash and
+ * one memory access, at the price of a slightly higher false positive rate
+ * than a classic filter of the same size.
+ */
+typedef struct {
+    /** the words of the filter */
+    uint32_t *blocks;
+    /** number of words in @ref bloom_blocked_t::blocks */
+    size_t num_blocks;
+    /** number of bits set per element */
+    unsigned k;
+    /** the hash function */
+    hashfp_t hash;
+} bloom_blocked_t;
+
+/**
+ * @brief Initialize a blocked Bloom filter and clear all its bits.
+ *
+ * @param bloom             bloom_blocked_t to initialize
+ * @param blocks            underlying words of the filter
+ * @param num_blocks        number of elements in @p blocks
+ * @param k                 number of bits set per element
+ * @param hash              hash function, should mix all input bits
+ *                          well, e.g. one_at_a_time_hash()
+ *
+ * @pre     0 < @p k <= @ref BLOOM_BLOCKED_K_MAX
+ */
+void bloom_blocked_init(bloom_blocked_t *bloom, uint32_t *blocks,
+                        size_t num_blocks, unsigned k, hashfp_t hash);
+
+/**
+ * @brief Add a string to a blocked Bloom filter.
+ *
+ * @param bloom  blocked Bloom filter
+ * @param buf    string to add
+ * @param len    the length of the string @p buf
+ */
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Determine if a string is in a blocked Bloom filter.
+ *
+ * @param bloom  blocked Bloom filter
+ * @param buf    string to check
+ * @param len    the length of the string @p buf
+ *
+ * @return       false if string does not exist in the filter
+ * @return       true if string is may be in the filter
+ */
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,6 +30,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 #if defined(__linux__)
@@ -44,6 +45,11 @@ extern "C" {
  */
 #define CAN_MAX_DLEN (8)
 
+/**
+ * @brief Max data length for a CAN-FD frame
+ */
+#define CANFD_MAX_DLEN (64)
+
 /**
  * @name CAN_ID flags and masks
  * @{
@@ -95,6 +101,38 @@ struct can_frame {
     uint8_t data[CAN_MAX_DLEN] __attribute__((aligned(8)));
 };
 
+/**
+ * @name CAN-FD flags
+ * @{
+ */
+#define CANFD_BRS (0x01) /**< bit rate switch (second bitrate for payload data) */
+#define CANFD_ESI (0x02) /**< error state indicator of the transmitting node */
+/** @} */
+
+/**
+ * @brief CAN-FD frame
+ *
+ * The header is layout compatible with struct can_frame, @p flags takes the
+ * place of can_frame::__pad.
+ */
+struct canfd_frame {
+    canid_t can_id;  /**< 32 bit CAN_ID + EFF/RTR/ERR flags */
+    uint8_t len;     /**< frame payload length in byte (0 .. CANFD_MAX_DLEN) */
+    uint8_t flags;   /**< additional flags for CAN-FD */
+    uint8_t __res0;  /**< reserved / padding */
+    uint8_t __res1;  /**< reserved / padding */
+    /** Frame data */
+    uint8_t data[CANFD_MAX_DLEN] __attribute__((aligned(8)));
+};
+
+/**
+ * @name Frame sizes
+ * @{
+ */
+#define CAN_MTU   (sizeof(struct can_frame))   /**< classic CAN frame */
+#define CANFD_MTU (sizeof(struct canfd_frame)) /**< CAN-FD frame */
+/** @} */
+
 /**
  * @brief Controller Area Network filter
  */
@@ -139,6 +177,36 @@ struct can_bittiming_const {
 
 #endif /* defined(__linux__) */
 
+#ifndef CANFD_FDF
+/**
+ * @brief   Marks a struct canfd_frame as CAN-FD frame
+ *
+ * The stack passes CAN-FD frames as struct can_frame pointers, this flag in
+ * canfd_frame::flags (can_frame::__pad) tells them apart.
+ */
+#define CANFD_FDF (0x04)
+#endif
+
+/**
+ * @brief   Get the size of the frame structure behind @p frame
+ *
+ * @param[in] frame     classic or CAN-FD frame
+ *
+ * @return  CANFD_MTU for CAN-FD frames (if module `can_fd` is used)
+ * @return  CAN_MTU otherwise
+ */
+static inline size_t can_frame_size(const struct can_frame *frame)
+{
+#ifdef MODULE_CAN_FD
+    if (frame->__pad & CANFD_FDF) {
+        return CANFD_MTU;
+    }
+#else
+    (void)frame;
+#endif
+    return CAN_MTU;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ extern "C" {
  */
 #define CONN_CAN_DONTWAIT     (1)     /**< Do not wait for Tx confirmation when sending */
 #define CONN_CAN_RECVONLY     (2)     /**< Do not send anything on the bus */
+#define CONN_CAN_FD           (4)     /**< Receive CAN-FD frames too */
 /** @} */
 
 /**
@@ -70,7 +71,7 @@ typedef struct conn_can_raw {
  * @param[in] filter        list of filters to set
  * @param[in] count         number of filters in @p filter
  * @param[in] ifnum         can device Interface
- * @param[in] flags         conn flags to set (CONN_CAN_RECVONLY)
+ * @param[in] flags         conn flags to set (CONN_CAN_RECVONLY, CONN_CAN_FD)
  *
  * @post   @p filter must remain allocated until @p conn is closed
  *
@@ -93,15 +94,37 @@ int conn_can_raw_close(conn_can_raw_t *conn);
 /**
  *  @brief  Generic can receive
  *
+ * CAN-FD frames are only received if @p conn was created with CONN_CAN_FD,
+ * @p frame must point to a struct canfd_frame then.
+ *
  * @param[in] conn          CAN connection
  * @param[out] frame        CAN frame to receive
  * @param[in] timeout       timeout in us, 0 for infinite
  *
- * @return the number of bytes received
+ * @return the number of bytes received (CAN_MTU or CANFD_MTU)
  * @return any other negative number in case of an error
  */
 int conn_can_raw_recv(conn_can_raw_t *conn, struct can_frame *frame, uint32_t timeout);
 
+/**
+ * @brief  Receive all pending frames at once
+ *
+ * Blocks like conn_can_raw_recv() until the first frame is received, then
+ * takes the frames already queued for @p conn without blocking again.
+ *
+ * @param[in] conn          CAN connection
+ * @param[out] frames       array of @p num struct can_frame, or of
+ *                          struct canfd_frame if @p conn was created with
+ *                          CONN_CAN_FD
+ * @param[in] num           number of frames that fit into @p frames
+ * @param[in] timeout       timeout in us for the first frame, 0 for infinite
+ *
+ * @return the number of frames received
+ * @return any other negative number in case of an error
+ */
+int conn_can_raw_recv_batch(conn_can_raw_t *conn, void *frames, size_t num,
+                            uint32_t timeout);
+
 /**
  * @brief  Generic can send
  *
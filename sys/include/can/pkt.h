@@ -44,7 +44,14 @@ typedef struct {
     can_reg_entry_t entry;   /**< entry containing ifnum and upper layer info */
     atomic_uint ref_count;   /**< Reference counter (for rx frames) */
     int handle;              /**< handle (for tx frames */
+#if defined(MODULE_CAN_FD) || defined(DOXYGEN)
+    union {
+        struct can_frame frame;      /**< CAN Frame */
+        struct canfd_frame fd_frame; /**< CAN-FD frame, if CANFD_FDF is set */
+    };
+#else
     struct can_frame frame;  /**< CAN Frame */
+#endif
     gnrc_pktsnip_t *snip;    /**< Pointer to the allocated snip */
 } can_pkt_t;
 
@@ -60,6 +67,7 @@ void can_pkt_init(void);
  *
  * This function allocates a CAN packet and associates it to the @p ifnum and @p tx_pid.
  * The provided @p frame is copied into the CAN packet and a unique handle is set.
+ * CAN-FD frames (see can_frame_size()) are copied completely.
  *
  * @param[in] ifnum  the interface number
  * @param[in] frame  the frame to copy
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_checksum_crc32 CRC32
+ * @ingroup     sys_checksum
+ *
+ * @brief       CRC32 checksum algorithm
+ * @details     This implementation computes the CRC32 as used by IEEE 802.3,
+ *              zlib, and PNG (reflected polynomial 0xedb88320, initial value
+ *              and final XOR 0xffffffff).
+ *
+ *              By default, four bytes are processed per step using four
+ *              pre-calculated look-up tables (slice-by-4, 4 KiB of ROM). Set
+ *              @ref CRC32_SLICE_BY_4 to 0 to fall back to a single table
+ *              (1 KiB of ROM) and a byte-wise calculation, which is about
+ *              factor 3 slower.
+ *
+ * @{
+ * @file
+ */
+
+#ifndef CHECKSUM_CRC32_H
+#define CHECKSUM_CRC32_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CRC32_SLICE_BY_4
+/**
+ * @brief   Use slice-by-4 look-up tables
+ */
+#define CRC32_SLICE_BY_4    (1)
+#endif
+
+/**
+ * @brief           Update CRC32
+ *
+ * In contrast to @ref sys_checksum_crc16_ccitt, the final XOR is applied
+ * internally, so the result of a previous call can be passed as is:
+ * `crc32_update(crc32_calc(a, a_len), b, b_len)` equals the CRC32 of @p a
+ * followed by @p b.
+ *
+ * @param[in]  crc  CRC32 of the preceding data, usually the return value of
+ *                  a previous call to crc32_calc() or crc32_update(), or 0 to
+ *                  start a new calculation
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the specified memory area based on the
+ *                  given start value
+ */
+uint32_t crc32_update(uint32_t crc, const void *buf, size_t len);
+
+/**
+ * @brief           Calculate CRC32
+ *
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the specified memory area
+ */
+uint32_t crc32_calc(const void *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_CRC32_H */
+
+/** @} */
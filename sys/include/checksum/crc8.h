@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_checksum_crc8 CRC8
+ * @ingroup     sys_checksum
+ * @brief       Generalized CRC8 checksum algorithm
+ *
+ * This implementation calculates the CRC8 bit-wise, with the most significant
+ * bit first and without final XOR. Any generator polynomial and seed can be
+ * given, e.g. polynomial 0x31 and seed 0xff as used by a number of Sensirion
+ * sensors, or 0x07 and 0x00 as used by SMBus.
+ *
+ * @{
+ *
+ * @file
+ * @brief   CRC8 definitions
+ */
+#ifndef CHECKSUM_CRC8_H
+#define CHECKSUM_CRC8_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Calculate CRC8
+ *
+ * @param[in] buf   Start of memory area to checksum
+ * @param[in] len   Number of bytes in @p buf to calculate checksum for
+ * @param[in] poly  The generator polynomial for the checksum
+ * @param[in] seed  The seed (starting value) for the checksum
+ *
+ * @return  Checksum of the specified memory area based on @p seed and @p poly
+ */
+uint8_t crc8(const uint8_t *buf, size_t len, uint8_t poly, uint8_t seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_CRC8_H */
+/** @} */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @defgroup    sys_crypto_chacha20poly1305 ChaCha20-Poly1305
+ * @brief       ChaCha20-Poly1305 AEAD construction
+ *
+ * Authenticated encryption with associated data as specified in RFC 8439,
+ * built from ChaCha20 and @ref sys_crypto_poly1305. Associated data and
+ * message can be passed in chunks of arbitrary size and their lengths do not
+ * need to be known in advance.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ChaCha20-Poly1305 interface
+ *
+ * @see         https://tools.ietf.org/html/rfc8439#section-2.8
+ */
+#ifndef CRYPTO_CHACHA20POLY1305_H
+#define CRYPTO_CHACHA20POLY1305_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "crypto/chacha.h"
+#include "crypto/poly1305.h"
+#include "iolist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CHACHA20POLY1305_KEY_BYTES      (32U)   /**< Key length in bytes */
+#define CHACHA20POLY1305_NONCE_BYTES    (12U)   /**< Nonce length in bytes */
+#define CHACHA20POLY1305_TAG_BYTES      (16U)   /**< Tag length in bytes */
+
+/**
+ * @brief   ChaCha20-Poly1305 context
+ */
+typedef struct {
+    chacha_ctx chacha;          /**< ChaCha20 keystream context */
+    poly1305_ctx_t poly;        /**< Poly1305 context */
+    uint8_t stream[64];         /**< Current keystream block */
+    uint64_t aad_len;           /**< Associated data processed so far */
+    uint64_t data_len;          /**< Message bytes processed so far */
+    uint8_t stream_pos;         /**< Keystream bytes already used */
+    uint8_t aad_done;           /**< Associated data has been padded */
+} chacha20poly1305_ctx_t;
+
+/**
+ * @brief   Start a ChaCha20-Poly1305 encryption or decryption
+ *
+ * @param[out]  ctx     Context to initialize
+ * @param[in]   key     Key of @ref CHACHA20POLY1305_KEY_BYTES bytes
+ * @param[in]   nonce   Nonce of @ref CHACHA20POLY1305_NONCE_BYTES bytes
+ */
+void chacha20poly1305_init(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
+                           const uint8_t *nonce);
+
+/**
+ * @brief   Feed associated data into a ChaCha20-Poly1305 operation
+ *
+ * @param[in,out]   ctx     Initialized context
+ * @param[in]       aad     Associated data chunk
+ * @param[in]       len     Length of @p aad
+ *
+ * @return  0 on success
+ * @return  -1 if message data has already been processed
+ */
+int chacha20poly1305_update_aad(chacha20poly1305_ctx_t *ctx,
+                                const uint8_t *aad, size_t len);
+
+/**
+ * @brief   Encrypt a chunk of plaintext
+ *
+ * @param[in,out]   ctx     Initialized context
+ * @param[in]       in      Plaintext chunk
+ * @param[in]       len     Length of @p in
+ * @param[out]      out     Buffer of @p len bytes for the ciphertext, may be
+ *                          equal to @p in
+ */
+void chacha20poly1305_encrypt_update(chacha20poly1305_ctx_t *ctx,
+                                     const uint8_t *in, size_t len,
+                                     uint8_t *out);
+
+/**
+ * @brief   Decrypt a chunk of ciphertext
+ *
+ * @warning The plaintext is not authenticated before
+ *          chacha20poly1305_decrypt_finish() succeeded
+ *
+ * @param[in,out]   ctx     Initialized context
+ * @param[in]       in      Ciphertext chunk
+ * @param[in]       len     Length of @p in
+ * @param[out]      out     Buffer of @p len bytes for the plaintext, may be
+ *                          equal to @p in
+ */
+void chacha20poly1305_decrypt_update(chacha20poly1305_ctx_t *ctx,
+                                     const uint8_t *in, size_t len,
+                                     uint8_t *out);
+
+/**
+ * @brief   Finish an encryption and compute the tag
+ *
+ * @param[in,out]   ctx     Context all data has been passed to
+ * @param[out]      tag     Buffer of @ref CHACHA20POLY1305_TAG_BYTES bytes
+ */
+void chacha20poly1305_encrypt_finish(chacha20poly1305_ctx_t *ctx, uint8_t *tag);
+
+/**
+ * @brief   Finish a decryption and verify the tag
+ *
+ * @param[in,out]   ctx     Context all data has been passed to
+ * @param[in]       tag     Received tag of @ref CHACHA20POLY1305_TAG_BYTES bytes
+ *
+ * @return  0 if the tag is valid
+ * @return  -1 if the tag does not match
+ */
+int chacha20poly1305_decrypt_finish(chacha20poly1305_ctx_t *ctx,
+                                    const uint8_t *tag);
+
+/**
+ * @brief   Encrypt a scattered message in place
+ *
+ * @param[in]       key     Key of @ref CHACHA20POLY1305_KEY_BYTES bytes
+ * @param[in]       nonce   Nonce of @ref CHACHA20POLY1305_NONCE_BYTES bytes
+ * @param[in]       aad     Associated data
+ * @param[in]       aad_len Length of @p aad
+ * @param[in,out]   data    Plaintext, replaced by the ciphertext
+ * @param[out]      tag     Buffer of @ref CHACHA20POLY1305_TAG_BYTES bytes
+ */
+void chacha20poly1305_encrypt_iolist(const uint8_t *key, const uint8_t *nonce,
+                                     const uint8_t *aad, size_t aad_len,
+                                     const iolist_t *data, uint8_t *tag);
+
+/**
+ * @brief   Decrypt and verify a scattered message in place
+ *
+ * @param[in]       key     Key of @ref CHACHA20POLY1305_KEY_BYTES bytes
+ * @param[in]       nonce   Nonce of @ref CHACHA20POLY1305_NONCE_BYTES bytes
+ * @param[in]       aad     Associated data
+ * @param[in]       aad_len Length of @p aad
+ * @param[in,out]   data    Ciphertext, replaced by the plaintext
+ * @param[in]       tag     Received tag of @ref CHACHA20POLY1305_TAG_BYTES bytes
+ *
+ * @return  0 if the tag is valid
+ * @return  -1 if the tag does not match
+ */
+int chacha20poly1305_decrypt_iolist(const uint8_t *key, const uint8_t *nonce,
+                                    const uint8_t *aad, size_t aad_len,
+                                    const iolist_t *data, const uint8_t *tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_CHACHA20POLY1305_H */
+/** @} */
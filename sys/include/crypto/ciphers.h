@@ -119,6 +119,10 @@ typedef struct {
 /**
  * @brief Initialize new cipher state
  *
+ * If the CPU's AES peripheral is used (feature `periph_aes`, see
+ * @ref drivers_periph_aes), it is selected for @ref CIPHER_AES_128 instead of
+ * the software implementation.
+ *
  * @param cipher     cipher struct to init (already allocated memory)
  * @param cipher_id  cipher algorithm id
  * @param key        encryption key to use
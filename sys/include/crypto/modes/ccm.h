@@ -21,6 +21,7 @@
 #define CRYPTO_MODES_CCM_H
 
 #include "crypto/ciphers.h"
+#include "iolist.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,6 +94,172 @@ int cipher_decrypt_ccm(cipher_t* cipher,
                        const uint8_t* input, size_t input_len,
                        uint8_t* output);
 
+/**
+ * @brief   Context for incremental CCM operations
+ *
+ * Authenticated data and the message may be fed in arbitrary chunks, but the
+ * total length of both has to be known in advance, as it is part of the first
+ * MAC block.
+ */
+typedef struct {
+    cipher_t *cipher;           /**< Initialized block cipher */
+    uint8_t ctr[16];            /**< Counter block of the next keystream block */
+    uint8_t mac[16];            /**< Running CBC-MAC */
+    uint8_t stream[16];         /**< Current keystream block */
+    size_t auth_data_left;      /**< Authenticated data still expected */
+    size_t input_left;          /**< Message bytes still expected */
+    uint8_t mac_pos;            /**< Bytes absorbed into the current MAC block */
+    uint8_t stream_pos;         /**< Keystream bytes already used */
+    uint8_t mac_length;         /**< Length of the MAC */
+    uint8_t length_encoding;    /**< Octets of the length field */
+} ccm_ctx_t;
+
+/**
+ * @brief Start an incremental CCM encryption or decryption
+ *
+ * @param ctx              Context to initialize
+ * @param cipher           Already initialized cipher struct, must stay valid
+ *                         until the operation is finished
+ * @param mac_length       length of the MAC (between 4 and 16 - only even
+ *                         values)
+ * @param length_encoding  maximal supported length of plaintext
+ *                         (2^(8*length_enc)).
+ * @param nonce            Nounce for ctr mode encryption
+ * @param nonce_len        Length of the nonce in octets
+ *                         (maximum: 15-length_encoding)
+ * @param auth_data_len    Total length of additional data
+ * @param input_len        Total length of the plaintext
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_init_ccm(ccm_ctx_t *ctx, cipher_t *cipher,
+                    uint8_t mac_length, uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len,
+                    uint32_t auth_data_len, size_t input_len);
+
+/**
+ * @brief Feed additional data to authenticate into a CCM operation
+ *
+ * All additional data has to be passed before any message data.
+ *
+ * @param ctx              Initialized context
+ * @param auth_data        Additional data to authenticate in MAC
+ * @param auth_data_len    Length of this chunk of additional data
+ *
+ * @return                 0 on success
+ * @return                 CCM_ERR_INVALID_DATA_LENGTH if more data was passed
+ *                         than announced to cipher_init_ccm()
+ */
+int cipher_update_ccm_aad(ccm_ctx_t *ctx,
+                          const uint8_t *auth_data, size_t auth_data_len);
+
+/**
+ * @brief Encrypt a chunk of plaintext in an incremental CCM operation
+ *
+ * @param ctx              Initialized context
+ * @param input            Plaintext chunk
+ * @param input_len        Length of the chunk
+ * @param output           Buffer of @p input_len bytes for the ciphertext,
+ *                         may be equal to @p input
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_encrypt_ccm_update(ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t input_len, uint8_t *output);
+
+/**
+ * @brief Decrypt a chunk of ciphertext in an incremental CCM operation
+ *
+ * @warning The plaintext is not authenticated before
+ *          cipher_decrypt_ccm_finish() succeeded
+ *
+ * @param ctx              Initialized context
+ * @param input            Ciphertext chunk (without MAC)
+ * @param input_len        Length of the chunk
+ * @param output           Buffer of @p input_len bytes for the plaintext,
+ *                         may be equal to @p input
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_decrypt_ccm_update(ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t input_len, uint8_t *output);
+
+/**
+ * @brief Finish an incremental CCM encryption
+ *
+ * @param ctx              Context all data has been passed to
+ * @param mac              Buffer of ctx::mac_length bytes for the MAC
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_encrypt_ccm_finish(ccm_ctx_t *ctx, uint8_t *mac);
+
+/**
+ * @brief Finish an incremental CCM decryption and verify the MAC
+ *
+ * @param ctx              Context all data has been passed to
+ * @param mac              Received MAC of ctx::mac_length bytes
+ *
+ * @return                 0 on success
+ * @return                 CCM_ERR_INVALID_CBC_MAC if the MAC does not match
+ * @return                 A negative error code if something else went wrong
+ */
+int cipher_decrypt_ccm_finish(ccm_ctx_t *ctx, const uint8_t *mac);
+
+/**
+ * @brief Encrypt and authenticate a scattered message in place in ccm mode.
+ *
+ * @param cipher           Already initialized cipher struct
+ * @param auth_data        Additional data to authenticate in MAC
+ * @param auth_data_len    Length of additional data
+ * @param mac_length       length of the MAC (between 4 and 16 - only even
+ *                         values)
+ * @param length_encoding  maximal supported length of plaintext
+ *                         (2^(8*length_enc)).
+ * @param nonce            Nounce for ctr mode encryption
+ * @param nonce_len        Length of the nonce in octets
+ *                         (maximum: 15-length_encoding)
+ * @param data             Plaintext, replaced by the ciphertext
+ * @param mac              Buffer of @p mac_length bytes for the MAC
+ *
+ * @return                 Length of encrypted data on a successful encryption
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_encrypt_ccm_iolist(cipher_t *cipher,
+                              const uint8_t *auth_data, uint32_t auth_data_len,
+                              uint8_t mac_length, uint8_t length_encoding,
+                              const uint8_t *nonce, size_t nonce_len,
+                              const iolist_t *data, uint8_t *mac);
+
+/**
+ * @brief Decrypt and verify a scattered message in place in ccm mode.
+ *
+ * @param cipher           Already initialized cipher struct
+ * @param auth_data        Additional data to authenticate in MAC
+ * @param auth_data_len    Length of additional data
+ * @param mac_length       length of the MAC (between 4 and 16 - only even
+ *                         values)
+ * @param length_encoding  maximal supported length of plaintext
+ *                         (2^(8*length_enc)).
+ * @param nonce            Nounce for ctr mode encryption
+ * @param nonce_len        Length of the nonce in octets
+ *                         (maximum: 15-length_encoding)
+ * @param data             Ciphertext (without MAC), replaced by the plaintext
+ * @param mac              Received MAC of @p mac_length bytes
+ *
+ * @return                 Length of the decrypted data on a successful decryption
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_decrypt_ccm_iolist(cipher_t *cipher,
+                              const uint8_t *auth_data, uint32_t auth_data_len,
+                              uint8_t mac_length, uint8_t length_encoding,
+                              const uint8_t *nonce, size_t nonce_len,
+                              const iolist_t *data, const uint8_t *mac);
+
 #ifdef __cplusplus
 }
 #endif
@@ -177,6 +177,86 @@ static inline uint32_t div_u32_mod_44488(uint32_t val)
     return val - (div_u32_by_44488(val)*44488);
 }
 
+/**
+ * @brief Integer divide val by a constant divisor
+ *
+ * The division is done by multiplying with a fixed point reciprocal of @p d.
+ * If @p d is a compile time constant, the reciprocal is computed by the
+ * compiler, so only a 32x32->64 bit multiplication, an addition and shifts
+ * remain at run time. This avoids the software division routines on CPUs
+ * without a hardware divider (Cortex-M0, AVR, MSP430). Passing a variable
+ * divisor still gives the correct result, but is much slower than a plain
+ * division.
+ *
+ * @pre d != 0
+ *
+ * @param[in]   val     dividend
+ * @param[in]   d       divisor, should be a compile time constant
+ * @return      (val / d)
+ */
+static inline __attribute__((always_inline))
+uint32_t div_u32_by_const(uint32_t val, uint32_t d)
+{
+    assert(d != 0);
+
+    if ((d & (d - 1)) == 0) {
+        return val >> __builtin_ctz(d);
+    }
+
+    /* l = ceil(log2(d)), m = floor(2^32 * (2^l - d) / d) + 1 */
+    unsigned l = 32 - __builtin_clz(d - 1);
+    uint32_t m = (((((uint64_t)1) << l) - d) << 32) / d + 1;
+    uint32_t t = ((uint64_t)val * m) >> 32;
+
+    return (t + ((val - t) >> 1)) >> (l - 1);
+}
+
+/**
+ * @brief Modulo a constant divisor
+ *
+ * @see div_u32_by_const
+ *
+ * @param[in]   val     dividend
+ * @param[in]   d       divisor, should be a compile time constant
+ * @return      (val % d)
+ */
+static inline __attribute__((always_inline))
+uint32_t div_u32_mod_const(uint32_t val, uint32_t d)
+{
+    return val - div_u32_by_const(val, d) * d;
+}
+
+/**
+ * @brief Integer divide a 64 bit val by a constant 32 bit divisor
+ *
+ * Like @ref div_u32_by_const, but for 64 bit dividends. The reciprocal is
+ * applied with @ref _div_mulhi64, so no 64 bit division is linked in.
+ *
+ * @pre d != 0
+ *
+ * @param[in]   val     dividend
+ * @param[in]   d       divisor, should be a compile time constant
+ * @return      (val / d)
+ */
+static inline __attribute__((always_inline))
+uint64_t div_u64_by_const(uint64_t val, uint32_t d)
+{
+    assert(d != 0);
+
+    if ((d & (d - 1)) == 0) {
+        return val >> __builtin_ctz(d);
+    }
+
+    /* same as above with 64 bit fractional digits, computed as two 32 bit
+     * digits so that the compiler never needs a 128 bit type */
+    unsigned l = 32 - __builtin_clz(d - 1);
+    uint64_t r = ((((uint64_t)1) << l) - d) << 32;
+    uint64_t m = ((r / d) << 32) | (((r % d) << 32) / d);
+    uint64_t t = _div_mulhi64(val, m + 1);
+
+    return (t + ((val - t) >> 1)) >> (l - 1);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_dma_memcpy DMA memcpy
+ * @ingroup     sys
+ * @brief       Offloads large memory copies to a memory-to-memory DMA stream
+ *
+ * Merging packets, staging firmware images from flash into RAM and similar
+ * bulk moves keep the CPU busy for as long as the copy takes. This module
+ * moves such buffers with the @ref drivers_periph_dma "DMA" instead. The
+ * calling thread sleeps while the transfer is running, so other threads can
+ * do protocol processing in the meantime.
+ *
+ * Copies shorter than @ref DMA_MEMCPY_THRESHOLD fall back to `memcpy()` and
+ * `memset()`, where the setup of the DMA costs more than it saves. The data
+ * width is chosen from the common alignment of the buffers and the length.
+ *
+ * All transfers share the stream @ref DMA_MEMCPY_DEV, which must be able to do
+ * memory-to-memory transfers (e.g. a DMA2 stream on stm32) and must not be
+ * used by another driver. Both buffers must be reachable by the DMA, which
+ * rules out e.g. the CCM RAM of some stm32. None of the functions may be
+ * called from interrupt context.
+ *
+ * @{
+ *
+ * @file
+ * @brief       DMA memcpy interface
+ */
+
+#ifndef DMA_MEMCPY_H
+#define DMA_MEMCPY_H
+
+#include <stddef.h>
+
+#include "periph/dma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   DMA stream used for the copies
+ */
+#ifndef DMA_MEMCPY_DEV
+#define DMA_MEMCPY_DEV          DMA_DEV(0)
+#endif
+
+/**
+ * @brief   Minimum length in bytes to use the DMA for
+ */
+#ifndef DMA_MEMCPY_THRESHOLD
+#define DMA_MEMCPY_THRESHOLD    (128U)
+#endif
+
+/**
+ * @brief   Copy @p len bytes from @p src to @p dst
+ *
+ * Blocks until the copy is complete. The buffers must not overlap.
+ *
+ * @param[out] dst      destination buffer
+ * @param[in]  src      source buffer
+ * @param[in]  len      number of bytes to copy
+ *
+ * @return  @p dst
+ */
+void *dma_memcpy(void *dst, const void *src, size_t len);
+
+/**
+ * @brief   Fill @p len bytes at @p dst with @p c
+ *
+ * Blocks until the buffer is filled.
+ *
+ * @param[out] dst      destination buffer
+ * @param[in]  c        fill value, converted to `unsigned char`
+ * @param[in]  len      number of bytes to fill
+ *
+ * @return  @p dst
+ */
+void *dma_memset(void *dst, int c, size_t len);
+
+/**
+ * @brief   Start copying @p len bytes from @p src to @p dst
+ *
+ * Returns as soon as the transfer is running. The caller may do other work
+ * until it calls @ref dma_memcpy_wait, which must follow every call to this
+ * function. Neither buffer may be touched before that. Further copies from
+ * other threads block until the current one is waited for.
+ *
+ * @param[out] dst      destination buffer
+ * @param[in]  src      source buffer
+ * @param[in]  len      number of bytes to copy
+ */
+void dma_memcpy_async(void *dst, const void *src, size_t len);
+
+/**
+ * @brief   Wait for the copy started by @ref dma_memcpy_async to complete
+ */
+void dma_memcpy_wait(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DMA_MEMCPY_H */
+/** @} */
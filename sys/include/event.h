@@ -89,6 +89,7 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "irq.h"
@@ -146,6 +147,16 @@ typedef struct {
  */
 void event_queue_init(event_queue_t *queue);
 
+/**
+ * @brief   Initialize an array of event queues
+ *
+ * This will set the calling thread as owner of each queue in @p queues.
+ *
+ * @param[out]  queues  array of event queue objects to initialize
+ * @param[in]   n_queues    number of queues in @p queues
+ */
+void event_queues_init(event_queue_t *queues, size_t n_queues);
+
 /**
  * @brief   Queue an event
  *
@@ -198,6 +209,26 @@ event_t *event_get(event_queue_t *queue);
  */
 event_t *event_wait(event_queue_t *queue);
 
+/**
+ * @brief   Get next event from multiple event queues, blocking
+ *
+ * This function will block until an event becomes available in any of the
+ * given queues. The queues are ordered by priority, `queues[0]` having the
+ * highest priority. An event of a queue is only returned if all queues with
+ * higher priority are empty.
+ *
+ * All queues must be owned by the calling thread.
+ *
+ * In order to handle an event retrieved using this function,
+ * call event->handler(event).
+ *
+ * @param[in]   queues      array of event queues, highest priority first
+ * @param[in]   n_queues    number of queues in @p queues
+ *
+ * @returns     pointer to next event
+ */
+event_t *event_wait_multi(event_queue_t *queues, size_t n_queues);
+
 /**
  * @brief   Simple event loop
  *
@@ -216,6 +247,26 @@ event_t *event_wait(event_queue_t *queue);
  */
 void event_loop(event_queue_t *queue);
 
+/**
+ * @brief   Event loop with multiple prioritized queues
+ *
+ * This allows subsystems with different latency requirements to share a
+ * single thread. After each handled event, pending events of the highest
+ * priority queue are handled first.
+ *
+ * It is pretty much defined as:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ *     while ((event = event_wait_multi(queues, n_queues))) {
+ *         event->handler(event);
+ *     }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @param[in]   queues      array of event queues, highest priority first
+ * @param[in]   n_queues    number of queues in @p queues
+ */
+void event_loop_multi(event_queue_t *queues, size_t n_queues);
+
 #ifdef __cplusplus
 }
 #endif
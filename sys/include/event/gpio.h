@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Posts an event when a GPIO interrupt fires
+ *
+ * Instead of doing work in the GPIO interrupt callback, or posting their own
+ * message or thread flag from it, drivers can bind a pin to an event. The
+ * interrupt handler only posts the event, its handler runs in the thread
+ * serving the queue.
+ *
+ * Edges that fire while the event is still queued are coalesced into the
+ * pending event. The number of edges seen since the event was handled last
+ * can be read with event_gpio_get_count(). In one-shot mode, the pin
+ * interrupt is disabled when the event is posted and re-enabled by
+ * event_gpio_rearm(), so a noisy line costs a single interrupt per event.
+ *
+ * Like event_timeout, this does not extend the event structure, so the event
+ * can be part of a larger struct.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_gpio_t irq_event;
+ *
+ * event_gpio_init(&irq_event, pin, GPIO_IN, GPIO_RISING, false,
+ *                 &queue, (event_t *)&event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event GPIO API
+ */
+
+#ifndef EVENT_GPIO_H
+#define EVENT_GPIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "periph/gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   GPIO event structure
+ */
+typedef struct {
+    event_queue_t *queue;   /**< event queue to post event to       */
+    event_t *event;         /**< event to post on interrupt         */
+    gpio_t pin;             /**< pin the event is bound to          */
+    bool oneshot;           /**< disable the interrupt until rearm  */
+    volatile uint16_t count;    /**< edges since the last get_count */
+} event_gpio_t;
+
+/**
+ * @brief   Initialize a pin and bind its interrupt to an event
+ *
+ * @note    @p event_gpio must stay valid as long as the interrupt is enabled
+ *
+ * @param[out]  event_gpio  event_gpio object to initialize
+ * @param[in]   pin         pin to initialize
+ * @param[in]   mode        mode of the pin, see @ref gpio_init_int
+ * @param[in]   flank       edge(s) to post the event on
+ * @param[in]   oneshot     disable the interrupt until event_gpio_rearm()
+ * @param[in]   queue       queue to post @p event to
+ * @param[in]   event       event to post on interrupt
+ *
+ * @return  0 on success
+ * @return  -1 on error
+ */
+int event_gpio_init(event_gpio_t *event_gpio, gpio_t pin, gpio_mode_t mode,
+                    gpio_flank_t flank, bool oneshot, event_queue_t *queue,
+                    event_t *event);
+
+/**
+ * @brief   Get and reset the number of edges seen
+ *
+ * Call this from the event handler to find out how many edges were coalesced
+ * into the event.
+ *
+ * @param[in]   event_gpio  event_gpio object
+ *
+ * @return  number of edges since the last call, saturating at UINT16_MAX
+ */
+unsigned event_gpio_get_count(event_gpio_t *event_gpio);
+
+/**
+ * @brief   Re-enable the interrupt of a one-shot GPIO event
+ *
+ * @param[in]   event_gpio  event_gpio object
+ */
+static inline void event_gpio_rearm(event_gpio_t *event_gpio)
+{
+    gpio_irq_enable(event_gpio->pin);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_GPIO_H */
+/** @} */
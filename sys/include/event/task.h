@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Stackless cooperative tasks on top of event queues
+ *
+ * A task is a function that can wait for a condition or a timeout in the
+ * middle of its body without blocking the thread it runs on. Waiting returns
+ * from the function, and the next run continues right after the wait
+ * (protothread style). Many tasks can thus share the thread and the stack of
+ * a single event queue.
+ *
+ * A task is resumed whenever its event is posted, e.g. with
+ * event_task_wake() from a sock_async or GPIO callback, and checks its wait
+ * condition again. Condition waits therefore work with any non-blocking API,
+ * e.g. a sock receive with a timeout of 0.
+ *
+ * Local variables do not keep their values across a wait. State that needs
+ * to survive must live in a struct embedding the task. Also, only one wait
+ * may be placed on a single source line, and no `switch` statement may
+ * contain a wait.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static int blink(event_task_t *task)
+ * {
+ *     EVENT_TASK_BEGIN(task);
+ *     while (1) {
+ *         LED0_TOGGLE;
+ *         EVENT_TASK_SLEEP(task, US_PER_SEC);
+ *     }
+ *     EVENT_TASK_END(task);
+ * }
+ *
+ * event_task_init(&task, &queue, blink);
+ * event_task_wake(&task);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event task API
+ */
+
+#ifndef EVENT_TASK_H
+#define EVENT_TASK_H
+
+#include "event.h"
+#ifdef MODULE_EVENT_TIMEOUT
+#include "event/timeout.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Return values of task functions
+ */
+enum {
+    EVENT_TASK_WAITING = 0,     /**< the task waits to be resumed */
+    EVENT_TASK_DONE = 1,        /**< the task has finished */
+};
+
+/**
+ * @brief   Event task forward declaration
+ */
+typedef struct event_task event_task_t;
+
+/**
+ * @brief   Task function, built with the EVENT_TASK_* macros
+ */
+typedef int (*event_task_fn_t)(event_task_t *task);
+
+/**
+ * @brief   Event task structure
+ */
+struct event_task {
+    event_t super;              /**< event resuming the task            */
+    event_queue_t *queue;       /**< queue the task runs on             */
+    event_task_fn_t fn;         /**< task function                      */
+    unsigned lc;                /**< line to continue at                */
+#if defined(MODULE_EVENT_TIMEOUT) || defined(DOXYGEN)
+    event_timeout_t timeout;    /**< timeout for EVENT_TASK_SLEEP       */
+    uint32_t deadline;          /**< end of the current sleep           */
+#endif
+};
+
+/**
+ * @brief   Initialize a task
+ *
+ * The task starts running when it is woken up for the first time.
+ *
+ * @param[out]  task    task to initialize
+ * @param[in]   queue   queue to run the task on
+ * @param[in]   fn      task function
+ */
+void event_task_init(event_task_t *task, event_queue_t *queue,
+                     event_task_fn_t fn);
+
+/**
+ * @brief   Resume a task
+ *
+ * May be called from interrupt context.
+ *
+ * @param[in]   task    task to resume
+ */
+static inline void event_task_wake(event_task_t *task)
+{
+    event_post(task->queue, &task->super);
+}
+
+/**
+ * @brief   Start the body of a task function
+ */
+#define EVENT_TASK_BEGIN(task)      switch ((task)->lc) { case 0:
+
+/**
+ * @brief   End the body of a task function
+ */
+#define EVENT_TASK_END(task)        } (task)->lc = 0; return EVENT_TASK_DONE
+
+/**
+ * @brief   Wait until @p cond is true, checking it whenever the task is woken
+ */
+#define EVENT_TASK_WAIT_UNTIL(task, cond)               \
+    do {                                                \
+        (task)->lc = __LINE__; case __LINE__:           \
+        if (!(cond)) {                                  \
+            return EVENT_TASK_WAITING;                  \
+        }                                               \
+    } while (0)
+
+/**
+ * @brief   Let the other events of the queue run before continuing
+ */
+#define EVENT_TASK_YIELD(task)                          \
+    do {                                                \
+        (task)->lc = __LINE__;                          \
+        event_task_wake(task);                          \
+        return EVENT_TASK_WAITING; case __LINE__:;      \
+    } while (0)
+
+#if defined(MODULE_EVENT_TIMEOUT) || defined(DOXYGEN)
+/**
+ * @brief   Sleep for @p us microseconds
+ *
+ * Wakeups of the task before the time has passed are ignored.
+ */
+#define EVENT_TASK_SLEEP(task, us)                                          \
+    do {                                                                    \
+        (task)->deadline = xtimer_now_usec() + (us);                        \
+        event_timeout_set(&(task)->timeout, (us));                          \
+        EVENT_TASK_WAIT_UNTIL(task,                                         \
+                    (int32_t)(xtimer_now_usec() - (task)->deadline) >= 0);  \
+    } while (0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_TASK_H */
+/** @} */
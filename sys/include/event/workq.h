@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Pool of worker threads handling events
+ *
+ * Offloads lengthy work such as crypto, compression or flash writes to a set
+ * of worker threads of the same priority. Work items are plain events, so
+ * the handler of the event does the work and can signal completion in
+ * whatever way fits the caller (a callback, a thread flag, another event).
+ *
+ * As an event queue is served by a single thread, each worker has its own
+ * queue. event_workq_submit() hands a work item to an idle worker, or to the
+ * next worker in turn if all of them are busy. It may be called from
+ * interrupt context.
+ *
+ * On the ESP32 with module `esp_app_cpu`, a pool can be configured to run its
+ * handlers on the APP CPU. The restrictions of @ref esp_app_cpu_exec apply to
+ * the handlers in that case.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static char stacks[2][THREAD_STACKSIZE_DEFAULT];
+ * static event_workq_worker_t workers[2];
+ * static event_workq_t workq;
+ *
+ * event_workq_init(&workq, workers, 2, stacks[0], sizeof(stacks[0]),
+ *                  THREAD_PRIORITY_MAIN + 1, "worker");
+ * event_workq_submit(&workq, &work.super);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event work queue API
+ */
+
+#ifndef EVENT_WORKQ_H
+#define EVENT_WORKQ_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Worker thread of a work queue
+ */
+typedef struct {
+    event_queue_t queue;        /**< events waiting for this worker     */
+    kernel_pid_t pid;           /**< worker thread                      */
+    volatile bool busy;         /**< worker is running a handler        */
+    void *workq;                /**< work queue the worker belongs to   */
+} event_workq_worker_t;
+
+/**
+ * @brief   Work queue
+ */
+typedef struct {
+    event_workq_worker_t *workers;  /**< worker threads                 */
+    unsigned numof;                 /**< number of workers              */
+    unsigned next;                  /**< next worker to use when busy   */
+    volatile uint32_t submitted;    /**< number of submitted work items */
+    volatile uint32_t completed;    /**< number of handled work items   */
+#if defined(MODULE_ESP_APP_CPU) || defined(DOXYGEN)
+    bool app_cpu;                   /**< run handlers on the APP CPU    */
+#endif
+} event_workq_t;
+
+/**
+ * @brief   Initialize a work queue and start its workers
+ *
+ * @param[out]  workq       work queue to initialize
+ * @param[in]   workers     memory for @p numof workers
+ * @param[in]   numof       number of worker threads
+ * @param[in]   stacks      stacks of the workers, @p numof times
+ *                          @p stacksize bytes
+ * @param[in]   stacksize   stack size of each worker
+ * @param[in]   prio        priority of the workers
+ * @param[in]   name        name of the worker threads
+ *
+ * @return  0 on success
+ * @return  -1 if a worker thread could not be created
+ */
+int event_workq_init(event_workq_t *workq, event_workq_worker_t *workers,
+                     unsigned numof, char *stacks, size_t stacksize,
+                     uint8_t prio, const char *name);
+
+/**
+ * @brief   Submit a work item
+ *
+ * The handler of @p work is executed by one of the workers. Submitting an
+ * item that is still pending is a no-op. May be called from interrupt
+ * context.
+ *
+ * @param[in]   workq       work queue
+ * @param[in]   work        work item
+ */
+void event_workq_submit(event_workq_t *workq, event_t *work);
+
+/**
+ * @brief   Get the number of work items not handled yet
+ *
+ * @param[in]   workq       work queue
+ *
+ * @return  submitted minus completed work items
+ */
+static inline uint32_t event_workq_pending(const event_workq_t *workq)
+{
+    return workq->submitted - workq->completed;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_WORKQ_H */
+/** @} */
@@ -31,6 +31,13 @@
  *   example.
  * - uses @ref sys_xtimer "xtimer" as backend
  *
+ * Events are kept in a list sorted by their offsets, so adding and removing
+ * an event is O(n) with n being the number of pending events. With the
+ * `evtimer_heap` module they are kept in a pairing heap instead, which makes
+ * adding O(1) and removing O(log n) amortized, at the cost of two additional
+ * pointers and a 32 bit word per @ref evtimer_event_t. Events with the same
+ * target time may then be triggered in any order.
+ *
  * @{
  *
  * @file
@@ -56,7 +63,18 @@ extern "C" {
  */
 typedef struct evtimer_event {
     struct evtimer_event *next; /**< the next event in the queue */
-    uint32_t offset;            /**< offset in milliseconds from previous event */
+    uint32_t offset;            /**< offset in milliseconds from previous event
+                                     (lower 32 bit of the absolute target
+                                     time with `evtimer_heap`) */
+#if defined(MODULE_EVTIMER_HEAP) || defined(DOXYGEN)
+    struct evtimer_event *child;    /**< first child in the event heap
+                                         (only with `evtimer_heap`) */
+    struct evtimer_event *prev;     /**< previous sibling or parent in the
+                                         event heap (only with
+                                         `evtimer_heap`) */
+    uint32_t long_offset;           /**< upper 32 bit of the absolute target
+                                         time (only with `evtimer_heap`) */
+#endif
 } evtimer_event_t;
 
 /**
@@ -93,11 +111,41 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event);
 /**
  * @brief   Removes an event from an event timer
  *
+ * Nothing happens if @p event is not pending. With `evtimer_heap`, an event
+ * that was never added must be zero-initialized (e.g. by being static or
+ * cleared with memset()), as its heap links are checked.
+ *
  * @param[in] evtimer       An event timer
  * @param[in] event         An event
  */
 void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event);
 
+/**
+ * @brief   Iterates over the pending events of an event timer
+ *
+ * The events are returned in an unspecified order. The event timer must not
+ * be modified during the iteration.
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] prev      The previous event, NULL to get the first one
+ *
+ * @return  The next pending event
+ * @return  NULL, if there are no more events
+ */
+evtimer_event_t *evtimer_iter(const evtimer_t *evtimer,
+                              const evtimer_event_t *prev);
+
+/**
+ * @brief   Gets the time until a pending event is triggered
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] event     A pending event of @p evtimer
+ *
+ * @return  Time until @p event is triggered in milliseconds
+ */
+uint32_t evtimer_remaining(const evtimer_t *evtimer,
+                           const evtimer_event_t *event);
+
 /**
  * @brief   Print overview of current state of an event timer
  *
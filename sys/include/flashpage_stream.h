@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_flashpage_stream Buffered flash page writer
+ * @ingroup     sys
+ * @brief       Coalesces small sequential writes into whole flash writes
+ *
+ * Firmware updates and logs produce many small chunks of data. Writing each
+ * of them with @ref flashpage_write_raw costs a program cycle per chunk, and
+ * each must be aligned. This module collects the chunks in a RAM buffer and
+ * programs the flash only when the buffer is full.
+ *
+ * With `periph_flashpage_raw`, the buffer holds @ref FLASHPAGE_STREAM_BUFSIZE
+ * bytes, a multiple of the MCU's program unit (@ref FLASHPAGE_RAW_BLOCKSIZE).
+ * A page is erased as soon as the stream enters it. Without raw writes, the
+ * buffer holds a whole page, which is written with @ref flashpage_write.
+ *
+ * The stream only moves forward. @ref flashpage_stream_flush pads the
+ * remainder of the current block (or page) with 0xff, so data written after
+ * a flush continues at the next block.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Buffered flash page writer interface
+ */
+
+#ifndef FLASHPAGE_STREAM_H
+#define FLASHPAGE_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "periph/flashpage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the write buffer in bytes
+ *
+ * Must divide FLASHPAGE_SIZE and, with raw writes, be a multiple of
+ * FLASHPAGE_RAW_BLOCKSIZE.
+ */
+#ifndef FLASHPAGE_STREAM_BUFSIZE
+#ifdef MODULE_PERIPH_FLASHPAGE_RAW
+#define FLASHPAGE_STREAM_BUFSIZE    (64U)
+#else
+#define FLASHPAGE_STREAM_BUFSIZE    (FLASHPAGE_SIZE)
+#endif
+#endif
+
+/**
+ * @brief   Alignment of the write buffer
+ */
+#ifdef MODULE_PERIPH_FLASHPAGE_RAW
+#define FLASHPAGE_STREAM_ALIGNMENT  (FLASHPAGE_RAW_ALIGNMENT)
+#else
+#define FLASHPAGE_STREAM_ALIGNMENT  (4U)
+#endif
+
+/**
+ * @brief   Flash page stream descriptor
+ */
+typedef struct {
+    unsigned page;              /**< page currently written */
+    size_t offset;              /**< offset of the buffer within the page */
+    size_t fill;                /**< number of bytes in the buffer */
+    uint8_t buf[FLASHPAGE_STREAM_BUFSIZE]
+        __attribute__((aligned(FLASHPAGE_STREAM_ALIGNMENT))); /**< buffer */
+} flashpage_stream_t;
+
+/**
+ * @brief   Start a stream at the beginning of a page
+ *
+ * @param[out] stream   stream descriptor
+ * @param[in]  page     first page to write
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p page does not exist
+ */
+int flashpage_stream_init(flashpage_stream_t *stream, unsigned page);
+
+/**
+ * @brief   Append data to the stream
+ *
+ * @param[in,out] stream    stream descriptor
+ * @param[in]     data      data to write, no alignment required
+ * @param[in]     len       number of bytes
+ *
+ * @return  0 on success
+ * @return  -ENOSPC if the data runs past the last page, nothing is written
+ */
+int flashpage_stream_write(flashpage_stream_t *stream, const void *data,
+                           size_t len);
+
+/**
+ * @brief   Write the buffered data to the flash
+ *
+ * The rest of the block (or page) is padded with 0xff.
+ *
+ * @param[in,out] stream    stream descriptor
+ */
+void flashpage_stream_flush(flashpage_stream_t *stream);
+
+/**
+ * @brief   Get the flash address the next byte will be written to
+ *
+ * @param[in] stream    stream descriptor
+ *
+ * @return  address of the next byte
+ */
+static inline void *flashpage_stream_addr(const flashpage_stream_t *stream)
+{
+    return (uint8_t *)flashpage_addr(stream->page) + stream->offset +
+           stream->fill;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLASHPAGE_STREAM_H */
+/** @} */
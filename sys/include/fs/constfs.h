@@ -15,6 +15,9 @@
  * RIOT VFS layer. The implementation uses an array of @c constfs_file_t objects
  * as its storage back-end.
  *
+ * Since the file contents are plain arrays, files can be accessed in place
+ * using @ref vfs_mmap and passed on without copying using @ref vfs_sendfile.
+ *
  * @{
  * @file
  * @brief   ConstFS public API
@@ -34,6 +34,12 @@
  * @defgroup    sys_hashes_sha256 SHA-256
  * @ingroup     sys_hashes_unkeyed
  * @brief       Implementation of the SHA-256 hashing function
+ *
+ * The rounds of the compression function can be unrolled with the
+ * `hashes_sha256_unroll` pseudomodule, trading flash for speed. If the CPU
+ * provides a hash engine via the `periph_sha256` feature (see
+ * @ref drivers_periph_sha256), it is used for all block compressions.
+ *
  * @{
  *
  * @file
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_hashmap Hash map
+ * @ingroup     sys
+ * @brief       Fixed capacity hash map without dynamic allocation
+ *
+ * The map stores entries of a fixed size in a caller provided array. The key
+ * is the first `key_len` bytes of each entry and compared bytewise, so keys
+ * must not contain padding. Collisions are resolved by linear probing.
+ * Removed entries leave a tombstone behind, so removing entries while
+ * iterating is safe and does not move other entries around.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * typedef struct {
+ *     ipv6_addr_t addr;        // key
+ *     uint16_t metric;
+ * } route_t;
+ *
+ * static route_t routes[16];
+ * static uint8_t states[16];
+ * static hashmap_t map;
+ *
+ * hashmap_init(&map, routes, states, 16, sizeof(route_t),
+ *              sizeof(ipv6_addr_t));
+ * route_t *r = hashmap_put(&map, &addr);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Hash map interface
+ */
+
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Slot states
+ * @{
+ */
+#define HASHMAP_SLOT_EMPTY      (0U)    /**< slot was never used */
+#define HASHMAP_SLOT_USED       (1U)    /**< slot holds an entry */
+#define HASHMAP_SLOT_DELETED    (2U)    /**< slot held a removed entry */
+/** @} */
+
+/**
+ * @brief   Hash map
+ */
+typedef struct {
+    uint8_t *entries;       /**< entry array */
+    uint8_t *states;        /**< state of each slot */
+    uint16_t capacity;      /**< number of slots, a power of two */
+    uint16_t entry_size;    /**< size of an entry in bytes */
+    uint16_t key_len;       /**< size of the key at the start of an entry */
+    uint16_t numof;         /**< number of entries stored */
+} hashmap_t;
+
+/**
+ * @brief   Initialize an empty hash map
+ *
+ * @param[out]  map         map to initialize
+ * @param[in]   entries     array of @p capacity entries
+ * @param[in]   states      array of @p capacity bytes
+ * @param[in]   capacity    number of slots, must be a power of two
+ * @param[in]   entry_size  size of an entry in bytes
+ * @param[in]   key_len     size of the key at the start of an entry
+ */
+void hashmap_init(hashmap_t *map, void *entries, uint8_t *states,
+                  unsigned capacity, size_t entry_size, size_t key_len);
+
+/**
+ * @brief   Remove all entries
+ *
+ * @param[in]   map         map to clear
+ */
+void hashmap_clear(hashmap_t *map);
+
+/**
+ * @brief   Look up an entry
+ *
+ * @param[in]   map         map to search
+ * @param[in]   key         key of the entry
+ *
+ * @return  the entry with @p key
+ * @return  NULL if there is none
+ */
+void *hashmap_get(const hashmap_t *map, const void *key);
+
+/**
+ * @brief   Get the entry of a key, adding it if needed
+ *
+ * A newly added entry has its key set, the rest of it is left as is.
+ *
+ * @param[in]   map         map to add to
+ * @param[in]   key         key of the entry
+ *
+ * @return  the entry with @p key
+ * @return  NULL if @p key is new and the map is full
+ */
+void *hashmap_put(hashmap_t *map, const void *key);
+
+/**
+ * @brief   Remove an entry
+ *
+ * @param[in]   map         map to remove from
+ * @param[in]   entry       entry as returned by the other functions
+ */
+void hashmap_remove_entry(hashmap_t *map, void *entry);
+
+/**
+ * @brief   Remove the entry of a key
+ *
+ * @param[in]   map         map to remove from
+ * @param[in]   key         key of the entry
+ *
+ * @return  0 on success
+ * @return  -1 if there is no entry with @p key
+ */
+int hashmap_remove(hashmap_t *map, const void *key);
+
+/**
+ * @brief   Iterate over all entries
+ *
+ * Set @p pos to 0 before the first call. The current entry may be removed
+ * while iterating.
+ *
+ * @param[in]       map     map to iterate over
+ * @param[in,out]   pos     iteration state
+ *
+ * @return  the next entry
+ * @return  NULL if all entries were visited
+ */
+void *hashmap_iter(const hashmap_t *map, unsigned *pos);
+
+/**
+ * @brief   Get the number of entries
+ *
+ * @param[in]   map         map
+ *
+ * @return  number of entries stored in @p map
+ */
+static inline unsigned hashmap_numof(const hashmap_t *map)
+{
+    return map->numof;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HASHMAP_H */
+/** @} */
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_kvs Log-structured key-value store
+ * @ingroup     sys
+ * @brief       Small wear-leveling key-value store on top of a mtd device
+ *
+ * kvs stores small, frequently rewritten records (configuration, counters)
+ * in a range of sectors of a @ref mtd_dev_t. Records are only ever appended:
+ * changing a value writes a new record and deleting a key writes a tombstone.
+ * Sectors are filled one after the other, so the erase cycles spread evenly
+ * over all sectors of the store.
+ *
+ * An index in RAM maps the hash of each key to its latest record, so a
+ * lookup costs a hash table probe and a single read. The index is rebuilt by
+ * replaying all records when the store is initialized. Torn records, e.g.
+ * due to a power loss while writing, are detected by their CRC and ignored.
+ *
+ * When the store runs out of erased sectors, the oldest sector is compacted:
+ * its live records are copied to the head of the log and the sector is
+ * erased. This is done on demand when writing, but can also be done ahead of
+ * time by calling @ref kvs_gc from a low priority thread.
+ *
+ * @code {unparsed}
+ * Sector layout:
+ *    magic ("KVS1"), sequence number of the sector
+ *    record: key length, flags, value length, CRC16, key, value, padding
+ *    record ...
+ *    unused (erased) space
+ * @endcode
+ *
+ * At least two sectors are needed, one of them is always kept erased to be
+ * able to compact.
+ *
+ * @note    Records are stored in the byte order of the CPU.
+ *
+ * @{
+ *
+ * @file
+ * @brief       kvs interface definitions
+ */
+
+#ifndef KVS_H
+#define KVS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum length of a key
+ */
+#ifndef KVS_KEY_LEN_MAX
+#define KVS_KEY_LEN_MAX     (32U)
+#endif
+
+/**
+ * @brief   Alignment of records, must be a power of two
+ *
+ * Must match the write granularity of the mtd device.
+ */
+#ifndef KVS_WRITE_ALIGN
+#define KVS_WRITE_ALIGN     (4U)
+#endif
+
+/**
+ * @brief   Entry of the RAM index
+ */
+typedef struct {
+    uint32_t hash;          /**< hash of the key */
+    uint32_t addr;          /**< offset of the record in the store */
+} kvs_slot_t;
+
+/**
+ * @brief   Key-value store descriptor
+ */
+typedef struct {
+    mtd_dev_t *mtd;         /**< underlying device */
+    uint32_t first_sector;  /**< first sector of the store on @p mtd */
+    uint32_t sector_num;    /**< number of sectors of the store */
+    uint32_t sector_size;   /**< size of a sector in bytes */
+    kvs_slot_t *index;      /**< RAM index */
+    size_t index_len;       /**< number of slots in @p index */
+    uint32_t active;        /**< sector records are appended to */
+    uint32_t pos;           /**< write offset in the active sector */
+    uint32_t seq;           /**< sequence number of the active sector */
+    mutex_t lock;           /**< serializes access to the store */
+} kvs_t;
+
+/**
+ * @brief   Initialize a key-value store and rebuild its index
+ *
+ * Sectors that neither hold the store nor are erased are erased, so an
+ * unused range of sectors becomes an empty store.
+ *
+ * @param[out] kvs          store descriptor
+ * @param[in]  mtd          initialized mtd device holding the store
+ * @param[in]  first_sector first sector of the store on @p mtd
+ * @param[in]  sector_num   number of sectors of the store, at least 2
+ * @param[in]  index        buffer for the index
+ * @param[in]  index_len    number of entries of @p index, a power of two
+ *                          larger than the number of keys to store
+ *
+ * @return  0 on success
+ * @return  -EINVAL on invalid parameters
+ * @return  -ENOMEM if @p index is too small for the keys in the store
+ * @return  < 0 on device errors
+ */
+int kvs_init(kvs_t *kvs, mtd_dev_t *mtd, uint32_t first_sector,
+             uint32_t sector_num, kvs_slot_t *index, size_t index_len);
+
+/**
+ * @brief   Erase all keys
+ *
+ * @param[in] kvs           store descriptor
+ *
+ * @return  0 on success
+ * @return  < 0 on device errors
+ */
+int kvs_format(kvs_t *kvs);
+
+/**
+ * @brief   Read the value of a key
+ *
+ * @param[in]  kvs          store descriptor
+ * @param[in]  key          key to look up
+ * @param[out] val          buffer for the value
+ * @param[in]  len          size of @p val, the value is truncated to it
+ *
+ * @return  length of the stored value
+ * @return  -ENOENT if @p key is not in the store
+ * @return  < 0 on device errors
+ */
+int kvs_get(kvs_t *kvs, const char *key, void *val, size_t len);
+
+/**
+ * @brief   Set the value of a key
+ *
+ * Nothing is written if the key already has the given value.
+ *
+ * @param[in] kvs           store descriptor
+ * @param[in] key           key to set, at most @ref KVS_KEY_LEN_MAX characters
+ * @param[in] val           value
+ * @param[in] len           length of @p val
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p key or the record is too long
+ * @return  -ENOMEM if the index is full
+ * @return  -ENOSPC if the store is full
+ * @return  < 0 on device errors
+ */
+int kvs_set(kvs_t *kvs, const char *key, const void *val, size_t len);
+
+/**
+ * @brief   Remove a key
+ *
+ * @param[in] kvs           store descriptor
+ * @param[in] key           key to remove
+ *
+ * @return  0 on success
+ * @return  -ENOENT if @p key is not in the store
+ * @return  -ENOSPC if the store is full
+ * @return  < 0 on device errors
+ */
+int kvs_delete(kvs_t *kvs, const char *key);
+
+/**
+ * @brief   Compact the oldest sector ahead of time
+ *
+ * Does nothing unless the store is down to its last erased sector and the
+ * live records of the oldest sector fit into the rest of the active sector.
+ * Compacting then does not cost any additional erase, but saves the time of
+ * compacting in the next call to @ref kvs_set.
+ *
+ * @param[in] kvs           store descriptor
+ *
+ * @return  1 if a sector was reclaimed
+ * @return  0 if there was nothing to do
+ * @return  < 0 on device errors
+ */
+int kvs_gc(kvs_t *kvs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KVS_H */
+/** @} */
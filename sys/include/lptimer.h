@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_lptimer Low-power timer
+ * @ingroup     sys
+ * @brief       64 bit system clock and timers for long sleeps based on the RTT
+ *
+ * xtimer runs off a high frequency periph_timer, which has to stay powered
+ * while an xtimer is pending. lptimer keeps the time in the real time timer
+ * (periph_rtt), which keeps running in the deepest sleep modes, and extends
+ * its counter to 64 bit.
+ *
+ * A timer waits for its target time with an RTT alarm. When the remaining time
+ * drops below @ref LPTIMER_HANDOVER_US, the timer is handed over to an xtimer,
+ * so the callback is still executed with the precision of xtimer. The high
+ * frequency timer is thus only needed for the last few milliseconds of a
+ * timeout.
+ *
+ * Timeouts are rounded to RTT ticks. Pending timers are kept in a sorted list,
+ * so lptimer is meant for a handful of long running timeouts, not as a
+ * replacement of xtimer.
+ *
+ * @{
+ *
+ * @file
+ * @brief       lptimer interface definitions
+ */
+
+#ifndef LPTIMER_H
+#define LPTIMER_H
+
+#include <stdint.h>
+
+#include "periph/rtt.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Remaining time in microseconds below which a timer is handed over
+ *          to xtimer
+ *
+ * Must be well above the duration of an RTT tick.
+ */
+#ifndef LPTIMER_HANDOVER_US
+#define LPTIMER_HANDOVER_US     (10000U)
+#endif
+
+/**
+ * @brief   Low-power timer
+ *
+ * All fields are private, set a timer with lptimer_set().
+ */
+typedef struct lptimer {
+    struct lptimer *next;       /**< next timer in the list */
+    uint64_t target;            /**< absolute target time in RTT ticks */
+    xtimer_t xtimer;            /**< timer for the last part of the timeout */
+} lptimer_t;
+
+/**
+ * @brief   Initializes lptimer and the RTT
+ *
+ * If @ref auto_init is enabled, it will call this for you.
+ */
+void lptimer_init(void);
+
+/**
+ * @brief   Gets the current system time
+ *
+ * @return  milliseconds since lptimer_init()
+ */
+uint64_t lptimer_now_ms64(void);
+
+/**
+ * @brief   Sets a timer
+ *
+ * @p cb is called in interrupt context. A pending timer is rescheduled.
+ *
+ * @param[in] timer     timer to set
+ * @param[in] offset_ms time from now in milliseconds
+ * @param[in] cb        callback to call when the timer expires
+ * @param[in] arg       argument of @p cb
+ */
+void lptimer_set(lptimer_t *timer, uint32_t offset_ms, xtimer_callback_t cb,
+                 void *arg);
+
+/**
+ * @brief   Removes a timer
+ *
+ * Does nothing if @p timer is not pending.
+ *
+ * @param[in] timer     timer to remove
+ */
+void lptimer_remove(lptimer_t *timer);
+
+/**
+ * @brief   Pauses the calling thread
+ *
+ * @param[in] ms        time to sleep in milliseconds
+ */
+void lptimer_sleep_ms(uint32_t ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPTIMER_H */
+/** @} */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_malloc_thread_cache Thread caches for malloc
+ * @ingroup     sys_memory_management
+ * @brief       Per-thread free lists for small heap allocations
+ *
+ * The module wraps malloc() and free() of the C library. Freed blocks of
+ * up to `MALLOC_THREAD_CACHE_MIN_SIZE << (MALLOC_THREAD_CACHE_CLASSES - 1)`
+ * bytes are kept in a free list of the calling thread, per power-of-two
+ * size class, and handed out again by the next malloc() of that class in
+ * the same thread. Only the owning thread accesses its lists, so a cache
+ * hit needs no lock at all.
+ *
+ * Cache misses and frees of a full cache go to the C library. The newlib
+ * malloc lock hooks are implemented with a recursive mutex, so these
+ * calls are serialized between threads without disabling interrupts.
+ *
+ * The heap can't be locked in interrupt context, so malloc() returns NULL
+ * there and free() defers returning the block to the heap to the next
+ * malloc() or free() of a thread. Blocks cached by a thread stay reserved for
+ * its PID, a thread that frees small blocks should call
+ * malloc_thread_cache_flush() before it exits.
+ *
+ * Blocks are sized with malloc_usable_size(), which newlib and glibc
+ * (`native`) provide.
+ *
+ * With the `malloc_thread_cache_stats` module the number of calls, cache
+ * hits and the duration of malloc() are recorded.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Thread caches for malloc interface
+ */
+
+#ifndef MALLOC_THREAD_CACHE_H
+#define MALLOC_THREAD_CACHE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the smallest size class in bytes
+ *
+ * Must be at least `sizeof(void *)`.
+ */
+#ifndef MALLOC_THREAD_CACHE_MIN_SIZE
+#define MALLOC_THREAD_CACHE_MIN_SIZE    (16U)
+#endif
+
+/**
+ * @brief   Number of size classes, each twice as large as the previous one
+ */
+#ifndef MALLOC_THREAD_CACHE_CLASSES
+#define MALLOC_THREAD_CACHE_CLASSES     (4U)
+#endif
+
+/**
+ * @brief   Maximum number of blocks cached per thread and size class
+ */
+#ifndef MALLOC_THREAD_CACHE_DEPTH
+#define MALLOC_THREAD_CACHE_DEPTH       (4U)
+#endif
+
+/**
+ * @brief   Statistics of malloc()
+ */
+typedef struct {
+    uint32_t allocs;        /**< number of malloc() calls */
+    uint32_t hits;          /**< allocations served from a thread cache */
+    uint32_t max_usec;      /**< longest malloc() call in microseconds */
+    uint64_t total_usec;    /**< time spent in malloc() in microseconds */
+} malloc_thread_cache_stats_t;
+
+/**
+ * @brief   Return the blocks cached by the calling thread to the heap
+ */
+void malloc_thread_cache_flush(void);
+
+#if defined(MODULE_MALLOC_THREAD_CACHE_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Get the statistics of malloc()
+ *
+ * @param[out] stats    the statistics
+ */
+void malloc_thread_cache_get_stats(malloc_thread_cache_stats_t *stats);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MALLOC_THREAD_CACHE_H */
+/** @} */
@@ -32,6 +32,7 @@
 #ifndef MATSTAT_H
 #define MATSTAT_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -109,6 +110,69 @@ uint64_t matstat_variance(const matstat_state_t *state);
  */
 void matstat_merge(matstat_state_t *dest, const matstat_state_t *src);
 
+/**
+ * @brief   Add a block of samples to state
+ *
+ * The block is reduced in two plain loops without any division per sample,
+ * and the result is merged into @p state with a single normalization step.
+ * This is much cheaper than calling matstat_add() for every value when
+ * samples are collected in buffers anyway.
+ *
+ * @param[inout]    state   State struct to operate on
+ * @param[in]       values  Values to add to the state
+ * @param[in]       len     Number of values in @p values
+ */
+void matstat_add_array(matstat_state_t *state, const int32_t *values,
+                       size_t len);
+
+/**
+ * @brief   Histogram for computing percentiles of a distribution
+ *
+ * Bin `i` counts the values in `[offset + (i << shift), offset + ((i + 1) <<
+ * shift))`. Values below @p offset are counted in the first bin, values above
+ * the range in the last bin.
+ */
+typedef struct {
+    uint32_t *bins;     /**< Bin counters, provided by the user */
+    uint32_t count;     /**< Number of values added */
+    int32_t offset;     /**< Lower bound of the first bin */
+    uint16_t num_bins;  /**< Number of bins */
+    uint8_t shift;      /**< Bin width as power of two */
+} matstat_hist_t;
+
+/**
+ * @brief   Initialize a histogram
+ *
+ * @param[out]  hist        Histogram to initialize
+ * @param[in]   bins        Memory for @p num_bins counters
+ * @param[in]   num_bins    Number of bins, must not be 0
+ * @param[in]   offset      Lower bound of the first bin
+ * @param[in]   shift       Bin width is `1 << shift`
+ */
+void matstat_hist_init(matstat_hist_t *hist, uint32_t *bins,
+                       uint16_t num_bins, int32_t offset, uint8_t shift);
+
+/**
+ * @brief   Add a sample to a histogram
+ *
+ * @param[inout]    hist    Histogram to operate on
+ * @param[in]       value   Value to add
+ */
+void matstat_hist_add(matstat_hist_t *hist, int32_t value);
+
+/**
+ * @brief   Estimate a percentile from a histogram
+ *
+ * @param[in]   hist        Histogram to operate on
+ * @param[in]   percent     Percentile to compute (0 - 100)
+ *
+ * @return  upper bound of the bin containing the percentile, i.e. at least
+ *          @p percent % of the values are smaller than the returned value
+ *          (unless values were above the range of the histogram)
+ * @return  @p hist->offset if the histogram is empty
+ */
+int32_t matstat_hist_percentile(const matstat_hist_t *hist, unsigned percent);
+
 #ifdef __cplusplus
 }
 #endif
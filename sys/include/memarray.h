@@ -12,6 +12,16 @@
  * @{
  *
  * @brief       pseudo dynamic allocation in static memory arrays
+ *
+ * Allocation and release are O(1): free elements are kept in a singly linked
+ * list threaded through the first `sizeof(void *)` bytes of each element.
+ * The content of these bytes is therefore undefined while an element is free.
+ *
+ * With the `memarray_stats` module each pool additionally counts the
+ * elements in use, the high-water mark and failed allocations. All pools
+ * are registered on initialization and can be listed with the `memarray`
+ * shell command.
+ *
  * @author      Tobias Heider <heidert@nm.ifi.lmu.de>
  */
 
@@ -28,10 +38,17 @@ extern "C" {
 /**
  * @brief Memory pool
  */
-typedef struct {
+typedef struct memarray {
     void *free_data;    /**< memory pool data / head of the free list */
     size_t size;        /**< size of single list element */
     size_t num;         /**< max number of elements in list */
+#if defined(MODULE_MEMARRAY_STATS) || defined(DOXYGEN)
+    const char *name;           /**< name of the pool, may be NULL */
+    struct memarray *next;      /**< next registered pool */
+    size_t used;                /**< number of allocated elements */
+    size_t max_used;            /**< high-water mark of memarray_t::used */
+    unsigned failed;            /**< number of failed allocations */
+#endif
 } memarray_t;
 
 /**
@@ -72,6 +89,43 @@ void *memarray_alloc(memarray_t *mem);
  */
 void memarray_free(memarray_t *mem, void *ptr);
 
+/**
+ * @brief Names a memarray pool for the statistics
+ *
+ * Does nothing without the `memarray_stats` module.
+ *
+ * @pre @p mem was initialized with memarray_init()
+ *
+ * @param[in,out] mem   memarray pool
+ * @param[in]     name  name of the pool, must stay valid
+ */
+static inline void memarray_set_name(memarray_t *mem, const char *name)
+{
+#ifdef MODULE_MEMARRAY_STATS
+    mem->name = name;
+#else
+    (void)mem;
+    (void)name;
+#endif
+}
+
+#if defined(MODULE_MEMARRAY_STATS) || defined(DOXYGEN)
+/**
+ * @brief Iterates over all initialized memarray pools
+ *
+ * @param[in] prev  previous pool, NULL to get the first one
+ *
+ * @return next pool
+ * @return NULL, if @p prev was the last pool
+ */
+memarray_t *memarray_iter(const memarray_t *prev);
+
+/**
+ * @brief Prints the statistics of all pools
+ */
+void memarray_print_stats(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
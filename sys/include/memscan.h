@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_memscan Byte search helpers
+ * @ingroup     sys
+ * @brief       Search a buffer for control bytes a word at a time
+ *
+ * Framing protocols like SLIP or ethos mark frame boundaries and escape
+ * sequences with a few reserved bytes, while most of a frame is plain data.
+ * The functions in this header skip over the plain data four bytes per step
+ * instead of comparing every byte, so the data between the reserved bytes can
+ * be handled with block copies.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Byte search helpers
+ */
+
+#ifndef MEMSCAN_H
+#define MEMSCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Tests if any byte of @p w is zero
+ */
+#define MEMSCAN_HAS_ZERO(w) (((w) - 0x01010101UL) & ~(w) & 0x80808080UL)
+
+/**
+ * @brief   Get the offset of the first occurrence of @p a or @p b
+ *
+ * @param[in] buf   buffer to search
+ * @param[in] len   length of @p buf in bytes
+ * @param[in] a     byte to search for
+ * @param[in] b     other byte to search for, may equal @p a
+ *
+ * @return  offset of the first byte equal to @p a or @p b
+ * @return  @p len if @p buf contains neither
+ */
+static inline size_t memscan2(const void *buf, size_t len, uint8_t a,
+                              uint8_t b)
+{
+    const uint8_t *p = buf;
+    size_t i = 0;
+
+    /* bytewise up to the first word boundary */
+    for (; (i < len) && ((uintptr_t)&p[i] & (sizeof(uint32_t) - 1)); i++) {
+        if ((p[i] == a) || (p[i] == b)) {
+            return i;
+        }
+    }
+
+    /* skip words without a match */
+    const uint32_t pa = 0x01010101UL * a;
+    const uint32_t pb = 0x01010101UL * b;
+
+    for (; (i + sizeof(uint32_t)) <= len; i += sizeof(uint32_t)) {
+        uint32_t w;
+
+        /* aligned, compiles to a single load */
+        memcpy(&w, &p[i], sizeof(w));
+
+        if (MEMSCAN_HAS_ZERO(w ^ pa) || MEMSCAN_HAS_ZERO(w ^ pb)) {
+            break;
+        }
+    }
+
+    for (; i < len; i++) {
+        if ((p[i] == a) || (p[i] == b)) {
+            return i;
+        }
+    }
+    return len;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMSCAN_H */
+/** @} */
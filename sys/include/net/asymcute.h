@@ -23,6 +23,7 @@
  * - Connecting to multiple gateways simultaneously
  * - Registration of topic names
  * - Publishing of data (QoS 0 and QoS 1)
+ * - Pipelining of QoS 1 publish requests
  * - Subscription to topics
  * - Pre-defined topic IDs as well as short and normal topic names
  *
@@ -33,6 +34,16 @@
  * - No support for wildcard characters in topic names when subscribing
  * - Actual granted QoS level on subscription is ignored
  *
+ * # Pipelining
+ * A connection keeps up to @ref ASYMCUTE_PUBLISH_WINDOW QoS 1 PUBLISH
+ * messages in flight at the same time, so there is no need to wait for the
+ * PUBACK of one message before publishing the next. Further QoS 1 publish
+ * requests are queued and sent as soon as a PUBACK frees a slot of the
+ * window. PUBACKs are matched to their requests by message ID, but the
+ * resulting ASYMCUTE_PUBLISHED, ASYMCUTE_REJECTED, or ASYMCUTE_TIMEOUT events
+ * are always passed to the user callback in the order the requests were
+ * published.
+ *
  * @{
  * @file
  * @brief       Asymcute MQTT-SN interface definition
@@ -152,6 +163,15 @@ extern "C" {
 #define ASYMCUTE_N_RETRY            (3U)
 #endif
 
+#ifndef ASYMCUTE_PUBLISH_WINDOW
+/**
+ * @brief   Maximum number of QoS 1 PUBLISH messages in flight per connection
+ *
+ * @note    Must be less than 256
+ */
+#define ASYMCUTE_PUBLISH_WINDOW     (4U)
+#endif
+
 /**
  * @brief   Return values used by public Asymcute functions
  */
@@ -254,6 +274,8 @@ struct asymcute_req {
     size_t data_len;                /**< length of the request packet in byte */
     uint16_t msg_id;                /**< used message id for this request */
     uint8_t retry_cnt;              /**< retransmission counter */
+    uint8_t evt;                    /**< buffered completion event, only used
+                                     *   for pipelined PUBLISH requests */
 };
 
 /**
@@ -265,12 +287,18 @@ struct asymcute_con {
     sock_udp_ep_t server_ep;            /**< the gateway's UDP endpoint */
     asymcute_req_t *pending;            /**< list holding pending requests */
     asymcute_sub_t *subscriptions;      /**< list holding active subscriptions */
+    asymcute_req_t *pub_inflight[ASYMCUTE_PUBLISH_WINDOW]; /**< QoS 1 PUBLISH
+                                         *   requests in order of transmission */
+    asymcute_req_t *pub_queue;          /**< QoS 1 PUBLISH requests waiting
+                                         *   for a free window slot */
     asymcute_evt_cb_t user_cb;          /**< event callback provided by user */
     event_callback_t keepalive_evt;     /**< keep alive event */
     event_timeout_t keepalive_timer;    /**< keep alive timer */
     uint16_t last_id;                   /**< last used message ID for this
                                          *   connection */
     uint8_t keepalive_retry_cnt;        /**< keep alive transmission counter */
+    uint8_t pub_head;                   /**< oldest entry in pub_inflight */
+    uint8_t pub_cnt;                    /**< number of entries in pub_inflight */
     uint8_t state;                      /**< connection state */
     uint8_t rxbuf[ASYMCUTE_BUFSIZE];    /**< connection specific receive buf */
     char cli_id[ASYMCUTE_ID_MAXLEN + 1];/**< buffer to store client ID */
@@ -504,7 +532,11 @@ int asymcute_register(asymcute_con_t *con, asymcute_req_t *req,
  * @param[in] data_len  size of @p data in bytes
  * @param[in] flags     additional flags (QoS level, DUP, and RETAIN)
  *
- * @return  ASYMCUTE_OK if PUBLISH message has been sent
+ * For QoS 1, the PUBLISH message is queued if @ref ASYMCUTE_PUBLISH_WINDOW
+ * messages are already in flight on @p con. The request's completion is
+ * signaled after all requests published before it on @p con have completed.
+ *
+ * @return  ASYMCUTE_OK if PUBLISH message has been sent or queued
  * @return  ASYMCUTE_NOTSUP if unsupported flags have been set
  * @return  ASYMCUTE_OVERFLOW if data does not fit into transmit buffer
  * @return  ASYMCUTE_REGERR if given topic is not registered
@@ -16,6 +16,11 @@
  *
  * This module is independent from any BLE stack.
  *
+ * bluetil_ad_find() walks the advertising data for every lookup. Code that
+ * evaluates several fields of the same advertising data, e.g. the filter of a
+ * scanner, should build a @ref bluetil_ad_index_t with bluetil_ad_index()
+ * once and query or match that index instead.
+ *
  * @{
  *
  * @file
@@ -27,6 +32,7 @@
 #ifndef NET_BLUETIL_AD_H
 #define NET_BLUETIL_AD_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <string.h>
@@ -48,6 +54,15 @@ extern "C" {
 #define BLUETIL_AD_FLAGS_DEFAULT        (BLE_GAP_DISCOVERABLE | \
                                          BLE_GAP_FLAG_BREDR_NOTSUP)
 
+/**
+ * @brief   Maximum number of fields recorded by bluetil_ad_index()
+ *
+ * Legacy advertising data of 31 bytes holds at most 15 fields.
+ */
+#ifndef BLUETIL_AD_INDEX_NUMOF
+#define BLUETIL_AD_INDEX_NUMOF          (16U)
+#endif
+
 /**
  * @brief   Return values used by the bluetil_ad module
  */
@@ -55,6 +70,7 @@ enum {
     BLUETIL_AD_OK       =  0,   /**< everything went as expected */
     BLUETIL_AD_NOTFOUND = -1,   /**< entry not found */
     BLUETIL_AD_NOMEM    = -2,   /**< insufficient memory to write field */
+    BLUETIL_AD_INVALID  = -3,   /**< malformed advertising data */
 };
 
 /**
@@ -74,6 +90,39 @@ typedef struct {
     size_t size;                /**< overall length of the buffer */
 } bluetil_ad_t;
 
+/**
+ * @brief   Location of a single field in indexed advertising data
+ */
+typedef struct {
+    uint16_t pos;               /**< offset of the field's payload */
+    uint8_t len;                /**< length of the payload */
+    uint8_t type;               /**< field type */
+} bluetil_ad_field_t;
+
+/**
+ * @brief   Index of all fields of an advertising data buffer
+ */
+typedef struct {
+    uint8_t *buf;               /**< the indexed advertising data */
+    unsigned numof;             /**< number of indexed fields */
+    bluetil_ad_field_t fields[BLUETIL_AD_INDEX_NUMOF];  /**< the fields */
+} bluetil_ad_index_t;
+
+/**
+ * @brief   Condition on a single field of advertising data
+ *
+ * The condition is met by a field of the given type whose payload starts
+ * with bluetil_ad_filter_t::data. For the UUID list types
+ * (@ref BLE_GAP_AD_UUID16_INCOMP to @ref BLE_GAP_AD_UUID128_COMP) the data
+ * may match any entry of the list instead. A filter without data only
+ * requires the field to be present.
+ */
+typedef struct {
+    const void *data;           /**< expected payload prefix, may be NULL */
+    uint8_t len;                /**< length of bluetil_ad_filter_t::data */
+    uint8_t type;               /**< field type */
+} bluetil_ad_filter_t;
+
 /**
  * @brief   Initialize the given advertising data descriptor
  *
@@ -97,6 +146,50 @@ void bluetil_ad_init(bluetil_ad_t *ad, void *buf, size_t pos, size_t size);
 int bluetil_ad_find(const bluetil_ad_t *ad,
                     uint8_t type, bluetil_ad_data_t *data);
 
+/**
+ * @brief   Index all fields of the given advertising data in a single pass
+ *
+ * Fields without payload are skipped. The index points into the buffer of
+ * @p ad, so it is valid as long as that buffer is not changed.
+ *
+ * @param[in]  ad       advertising data descriptor
+ * @param[out] idx      index to fill
+ *
+ * @return  number of indexed fields
+ * @return  BLUETIL_AD_NOMEM if @p ad contains more than
+ *          @ref BLUETIL_AD_INDEX_NUMOF fields, @p idx holds the first ones
+ * @return  BLUETIL_AD_INVALID if a field exceeds the data, @p idx holds the
+ *          fields before it
+ */
+int bluetil_ad_index(const bluetil_ad_t *ad, bluetil_ad_index_t *idx);
+
+/**
+ * @brief   Find a specific field in indexed advertising data
+ *
+ * @param[in]  idx      index of the advertising data
+ * @param[in]  type     field type to look for
+ * @param[out] data     position and length of the field's payload
+ *
+ * @return  BLUETIL_AD_OK if field was found
+ * @return  BLUETIL_AD_NOTFOUND if field was not found
+ */
+int bluetil_ad_index_find(const bluetil_ad_index_t *idx,
+                          uint8_t type, bluetil_ad_data_t *data);
+
+/**
+ * @brief   Check indexed advertising data against a set of filters
+ *
+ * @param[in] idx       index of the advertising data
+ * @param[in] filters   conditions that must all be met
+ * @param[in] numof     number of entries in @p filters
+ *
+ * @return  true if every filter is met by at least one field
+ * @return  false otherwise
+ */
+bool bluetil_ad_index_match(const bluetil_ad_index_t *idx,
+                            const bluetil_ad_filter_t *filters,
+                            unsigned numof);
+
 /**
  * @brief   Find the given field and copy its payload into a string
  *
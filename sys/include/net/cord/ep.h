@@ -91,6 +91,10 @@ int cord_ep_register(const sock_udp_ep_t *remote, const char *regif);
 /**
  * @brief   Update our current entry at the RD
  *
+ * The update request only carries our resource description if the set of
+ * resources registered with gcoap changed since it was last sent to the RD,
+ * otherwise it is sent without payload.
+ *
  * @return  CORD_EP_OK on success
  * @return  CORD_EP_TIMEOUT if the update request times out
  * @return  CORD_EP_ERR on any other internal error
@@ -53,6 +53,7 @@
  * - disconnecting from gateway
  * - registering a last will topic and message during connection setup
  * - registering topic names with the gateway (obtaining topic IDs)
+ * - registering a batch of topic names in a single exchange
  * - subscribing to topics
  * - unsubscribing from topics
  * - updating will topic
@@ -164,6 +165,28 @@ extern "C" {
 #define EMCUTE_N_RETRY          (3U)
 #endif
 
+#ifndef EMCUTE_REG_BATCH_MAX
+/**
+ * @brief   Maximum number of topics registered by a single call to
+ *          emcute_reg_batch()
+ *
+ * @note    **Must** be less than or equal to 32.
+ */
+#define EMCUTE_REG_BATCH_MAX    (16U)
+#endif
+
+#ifndef EMCUTE_SUB_BUCKETS
+/**
+ * @brief   Number of buckets of the topic ID to subscription lookup table
+ *
+ * Incoming PUBLISH messages are dispatched to their subscription by hashing
+ * the topic ID into this table.
+ *
+ * @note    **Must** be a power of 2.
+ */
+#define EMCUTE_SUB_BUCKETS      (8U)
+#endif
+
 /**
  * @brief   MQTT-SN flags
  *
@@ -222,7 +245,8 @@ typedef void(*emcute_cb_t)(const emcute_topic_t *topic, void *data, size_t len);
  * @brief   Data-structure for keeping track of topics we register to
  */
 typedef struct emcute_sub {
-    struct emcute_sub *next;    /**< next subscription (saved in a list) */
+    struct emcute_sub *next;    /**< next subscription with the same topic ID
+                                 *   hash */
     emcute_topic_t topic;       /**< topic we subscribe to */
     emcute_cb_t cb;             /**< function called when receiving messages */
     void *arg;                  /**< optional custom argument */
@@ -274,6 +298,31 @@ int emcute_discon(void);
  */
 int emcute_reg(emcute_topic_t *topic);
 
+/**
+ * @brief   Get topic IDs for a number of topic names from the gateway
+ *
+ * All REGISTER messages are sent back-to-back, so registering @p numof topics
+ * takes a single round-trip to the gateway instead of @p numof. Only topics
+ * that were not acknowledged yet are retransmitted. This is typically called
+ * right after emcute_con() to register all topics an application publishes
+ * to.
+ *
+ * On return, the id field of every topic that was accepted by the gateway is
+ * populated, the id of all other topics is left untouched.
+ *
+ * @param[in,out] topics    topics to register, topic.name **must not** be NULL
+ * @param[in] numof         number of entries in @p topics, **must** be less
+ *                          or equal to @ref EMCUTE_REG_BATCH_MAX
+ *
+ * @return  EMCUTE_OK if all topics were registered
+ * @return  EMCUTE_NOGW if not connected to a gateway
+ * @return  EMCUTE_OVERFLOW if length of any topic name exceeds
+ *          @ref EMCUTE_TOPIC_MAXLEN
+ * @return  EMCUTE_REJECT if the gateway rejected at least one topic
+ * @return  EMCUTE_TIMEOUT if at least one topic was not acknowledged
+ */
+int emcute_reg_batch(emcute_topic_t *topics, size_t numof);
+
 /**
  * @brief   Publish data on the given topic
  *
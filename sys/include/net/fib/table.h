@@ -35,6 +35,15 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief Number of recent look-ups memoized per FIB table
+ *
+ * @note  Only applicable with the `fib_route_cache` module
+ */
+#ifndef FIB_ROUTE_CACHE_SIZE
+#define FIB_ROUTE_CACHE_SIZE (4)
+#endif
+
 /**
  * @brief Container descriptor for a FIB entry
  */
@@ -53,6 +62,23 @@ typedef struct {
     universal_address_container_t *next_hop;
 } fib_entry_t;
 
+#if defined(MODULE_FIB_ROUTE_CACHE) || defined(DOXYGEN)
+/**
+* @brief Memoized look-up of a destination in a FIB table
+*/
+typedef struct {
+    /** the entry found for fib_route_cache_entry_t::dst, NULL if unused */
+    fib_entry_t *entry;
+    /** the destination address that was looked up */
+    uint8_t dst[UNIVERSAL_ADDRESS_SIZE];
+    /** size of fib_route_cache_entry_t::dst in bytes */
+    uint8_t dst_size;
+    /** 1 if fib_route_cache_entry_t::entry matched the destination exactly,
+     *  0 if it matched by prefix */
+    uint8_t exact;
+} fib_route_cache_entry_t;
+#endif
+
 /**
 * @brief Container descriptor for a FIB source route entry
 */
@@ -133,6 +159,14 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if defined(MODULE_FIB_ROUTE_CACHE) || defined(DOXYGEN)
+    /** recent look-ups of single hop entries.
+    *   Flushed whenever entries are created or removed
+    */
+    fib_route_cache_entry_t route_cache[FIB_ROUTE_CACHE_SIZE];
+    /** the route cache slot to be replaced next */
+    uint8_t route_cache_next;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -126,12 +126,26 @@
  *    _content_type_ attributes.
  * -# Read the payload, if any.
  *
+ * ### Block-wise transfers ###
+ *
+ * A client may drive a coap_block_xfer_t from its response callback. After
+ * gcoap_req_init(), add the Block2 option with coap_opt_add_block2_xfer() and
+ * finish with gcoap_finish(), or write the Block1 option and payload with
+ * coap_block1_xfer_finish(), which returns the length to pass to
+ * gcoap_req_send2(). Send a request for each block number returned by
+ * coap_block_xfer_next(). In the callback, pass the response to
+ * coap_block1_xfer_recv() or coap_block2_xfer_recv() and send requests for
+ * any further blocks released by coap_block_xfer_next(). Each request
+ * occupies a memo, so the window of the transfer must not exceed
+ * GCOAP_REQ_WAITING_MAX. Abort the transfer if a request times out.
+ *
  * ## Observe Server Operation
  *
  * A CoAP client may register for Observe notifications for any resource that
  * an application has registered with gcoap. An application does not need to
- * take any action to support Observe client registration. However, gcoap
- * limits registration for a given resource to a _single_ observer.
+ * take any action to support Observe client registration. Several observers
+ * may register for the same resource, up to GCOAP_OBS_REGISTRATIONS_MAX
+ * registrations from GCOAP_OBS_CLIENTS_MAX endpoints overall.
  *
  * An Observe notification is considered a response to the original client
  * registration request. So, the Observe server only needs to create and send
@@ -151,7 +165,9 @@
  *    in the coap_pkt_t.
  * -# Call gcoap_finish(), which updates the packet for the payload.
  *
- * Finally, call gcoap_obs_send() for the resource.
+ * Finally, call gcoap_obs_send() for the resource. It sends the notification
+ * to every observer of the resource. The notification is encoded only once;
+ * gcoap patches in the token and message ID for each observer.
  *
  * ### Other considerations ###
  *
@@ -190,6 +206,20 @@
  * times out. We track the response with an entry in the
  * `_coap_state.open_reqs` array.
  *
+ * ### Congestion control ###
+ *
+ * By default a confirmable request is retransmitted with the fixed
+ * exponential backoff from RFC 7252, starting from a random timeout between
+ * COAP_ACK_TIMEOUT and COAP_ACK_TIMEOUT + COAP_ACK_VARIANCE. With the module
+ * `gcoap_cocoa` gcoap instead follows CoCoA (draft-ietf-core-cocoa): it keeps
+ * a retransmission timeout (RTO) per destination, which is adapted from the
+ * round-trip times of the exchanges with it. Exchanges without retransmission
+ * update a strong estimator and exchanges with one or two retransmissions a
+ * weak estimator. The backoff factor depends on the RTO, and RTOs that were
+ * not updated for a while age back towards the default. Up to
+ * @ref GCOAP_COCOA_DEST_MAX destinations are tracked; the least recently
+ * used one is replaced.
+ *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
  *
@@ -259,6 +289,18 @@ extern "C" {
 #define GCOAP_REQ_WAITING_MAX   (2)
 #endif
 
+/**
+ * @brief   Number of hash buckets to look up the request for a response
+ *
+ * Responses are matched to their request by hashing token and remote end
+ * point, so the lookup stays fast for a large @ref GCOAP_REQ_WAITING_MAX.
+ *
+ * @note    GCOAP_REQ_WAITING_MAX must not exceed 255.
+ */
+#ifndef GCOAP_REQ_BUCKETS
+#define GCOAP_REQ_BUCKETS       (GCOAP_REQ_WAITING_MAX)
+#endif
+
 /**
  * @brief   Maximum length in bytes for a token
  */
@@ -341,6 +383,17 @@ extern "C" {
 #define GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @brief   Number of buckets of the index of Observe registrations by
+ *          resource
+ *
+ * With many registrations and observed resources, use more buckets to keep
+ * the lookup for a notification short.
+ */
+#ifndef GCOAP_OBS_BUCKETS
+#define GCOAP_OBS_BUCKETS               (GCOAP_OBS_REGISTRATIONS_MAX)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -408,6 +461,15 @@ extern "C" {
 #define GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @brief   Number of destinations to keep a CoCoA RTO estimate for
+ *
+ * @note    Only used with module `gcoap_cocoa`.
+ */
+#ifndef GCOAP_COCOA_DEST_MAX
+#define GCOAP_COCOA_DEST_MAX       (4)
+#endif
+
 /**
  * @brief   A modular collection of resources for a server
  */
@@ -452,6 +514,14 @@ typedef struct {
     gcoap_resp_handler_t resp_handler;  /**< Callback for the response */
     xtimer_t response_timer;            /**< Limits wait for response */
     msg_t timeout_msg;                  /**< For response timer */
+#if defined(MODULE_GCOAP_COCOA) || defined(DOXYGEN)
+    uint32_t send_time;                 /**< Time of first transmission in ms,
+                                             only with `gcoap_cocoa` */
+    uint32_t timeout;                   /**< Current retransmission timeout in
+                                             ms, only with `gcoap_cocoa` */
+    uint32_t backoff;                   /**< Backoff factor times 2, only
+                                             with `gcoap_cocoa` */
+#endif
 } gcoap_request_memo_t;
 
 /**
@@ -609,9 +679,11 @@ static inline ssize_t gcoap_response(coap_pkt_t *pdu, uint8_t *buf,
 
 /**
  * @brief   Initializes a CoAP Observe notification packet on a buffer, for the
- *          observer registered for a resource
+ *          observers registered for a resource
  *
- * First verifies that an observer has been registered for the resource.
+ * First verifies that an observer has been registered for the resource. The
+ * payload space is reduced to leave room for gcoap_obs_send() to patch in the
+ * token of each observer.
  *
  * @param[out] pdu      Notification metadata
  * @param[out] buf      Buffer containing the PDU
@@ -626,19 +698,21 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                    const coap_resource_t *resource);
 
 /**
- * @brief   Sends a buffer containing a CoAP Observe notification to the
- *          observer registered for a resource
+ * @brief   Sends a buffer containing a CoAP Observe notification to all
+ *          observers registered for a resource
  *
- * Assumes a single observer for a resource.
+ * The token and message ID in @p buf are rewritten for each observer. The
+ * buffer must have been initialized with gcoap_obs_init(), which leaves room
+ * for the longest token.
  *
- * @param[in] buf Buffer containing the PDU
- * @param[in] len Length of the buffer
- * @param[in] resource Resource to send
+ * @param[in,out] buf   Buffer containing the PDU
+ * @param[in] len       Length of the PDU
+ * @param[in] resource  Resource to send
  *
- * @return  length of the packet
+ * @return  length of the packet sent to the last observer reached
  * @return  0 if cannot send
  */
-size_t gcoap_obs_send(const uint8_t *buf, size_t len,
+size_t gcoap_obs_send(uint8_t *buf, size_t len,
                       const coap_resource_t *resource);
 
 /**
@@ -214,6 +214,8 @@ typedef struct {
 typedef struct {
     uint8_t total_slots_num;        /**< Number of total allocated transmission slots. */
     uint8_t sub_channel_seq;        /**< Receiver's sub-channel sequence. */
+    uint8_t next_sender;            /**< Slot-schedule-unit to start the next slots
+                                         allocation with. */
 } gnrc_gomach_vtdma_manag_t;
 
 /**
@@ -33,6 +33,7 @@
 
 #include "net/gnrc/icmpv6/echo.h"
 #include "net/gnrc/icmpv6/error.h"
+#include "net/gnrc/icmpv6/ratelimit.h"
 
 #ifdef __cplusplus
 extern "C" {
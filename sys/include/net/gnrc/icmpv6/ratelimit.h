@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_icmpv6_ratelimit  ICMPv6 rate limiting
+ * @ingroup     net_gnrc_icmpv6
+ * @brief       Token bucket limiting the ICMPv6 messages a node generates
+ *
+ * Echo replies and error messages are both taken from the bucket of the
+ * interface they are sent over (see
+ * [RFC 4443, section 2.4 (f)](https://tools.ietf.org/html/rfc4443#section-2.4)),
+ * so a flood of echo requests or malformed packets can't use up the packet
+ * buffer and the airtime. Messages without an interface share one global
+ * bucket. Messages exceeding the rate are silently dropped.
+ * @{
+ *
+ * @file
+ * @brief   ICMPv6 rate limiting definitions
+ */
+#ifndef NET_GNRC_ICMPV6_RATELIMIT_H
+#define NET_GNRC_ICMPV6_RATELIMIT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default number of ICMPv6 messages per second
+ */
+#ifndef GNRC_ICMPV6_RATELIMIT_RATE
+#define GNRC_ICMPV6_RATELIMIT_RATE      (10U)
+#endif
+
+/**
+ * @brief   Default number of ICMPv6 messages that may be sent in a burst
+ */
+#ifndef GNRC_ICMPV6_RATELIMIT_BURST
+#define GNRC_ICMPV6_RATELIMIT_BURST     (10U)
+#endif
+
+/**
+ * @brief   Token bucket
+ */
+typedef struct {
+    uint32_t last;          /**< time of the last refill in microseconds */
+    uint16_t rate;          /**< tokens per second, 0 for no limit */
+    uint16_t burst;         /**< maximum number of tokens */
+    uint16_t tokens;        /**< number of tokens left */
+} gnrc_icmpv6_ratelimit_t;
+
+/**
+ * @brief   Initializes a token bucket
+ *
+ * @param[out] rl       The token bucket.
+ * @param[in] rate      Tokens per second. 0 disables the limit.
+ * @param[in] burst     Maximum number of tokens. The bucket starts full.
+ */
+void gnrc_icmpv6_ratelimit_init(gnrc_icmpv6_ratelimit_t *rl, uint16_t rate,
+                                uint16_t burst);
+
+/**
+ * @brief   Takes a token for an ICMPv6 message to send over an interface
+ *
+ * @param[in] netif_pid Interface the message is sent over. May be
+ *                      KERNEL_PID_UNDEF, if not known yet.
+ *
+ * @return  true, if the message may be sent.
+ * @return  false, if the message must be dropped.
+ */
+bool gnrc_icmpv6_ratelimit_take(kernel_pid_t netif_pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_ICMPV6_RATELIMIT_H */
+/** @} */
@@ -74,6 +74,25 @@ extern "C" {
 #define GNRC_IPV6_MSG_QUEUE_SIZE    (8U)
 #endif
 
+/**
+ * @brief   Number of packets each per-interface input queue can hold
+ *
+ * @note    Only used with module `gnrc_ipv6_rxq`. Must be a power of 2.
+ */
+#ifndef GNRC_IPV6_RXQ_SIZE
+#define GNRC_IPV6_RXQ_SIZE          (8U)
+#endif
+
+/**
+ * @brief   Default number of packets taken from an input queue per
+ *          round-robin turn
+ *
+ * @note    Only used with module `gnrc_ipv6_rxq`.
+ */
+#ifndef GNRC_IPV6_RXQ_WEIGHT
+#define GNRC_IPV6_RXQ_WEIGHT        (1U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -135,6 +154,34 @@ extern fib_table_t gnrc_ipv6_fib_table;
  */
 kernel_pid_t gnrc_ipv6_init(void);
 
+#if defined(MODULE_GNRC_IPV6_RXQ) || defined(DOXYGEN)
+/**
+ * @brief   Message type telling the IPv6 thread that its input queues hold
+ *          packets
+ *
+ * @note    Only available with module `gnrc_ipv6_rxq`.
+ */
+#define GNRC_IPV6_RXQ_MSG_TYPE      (0x4f00U)
+
+/**
+ * @brief   Sets the weight of the input queue of an interface
+ *
+ * With module `gnrc_ipv6_rxq` received packets are put into one queue per
+ * interface instead of the IPv6 thread's message queue. The IPv6 thread
+ * drains the queues in a weighted round-robin fashion, taking up to
+ * @p weight packets from a queue per turn, so a burst on one interface can
+ * neither overflow the input of the others nor delay them indefinitely.
+ *
+ * @param[in] netif_pid PID of the interface. Packets without interface
+ *                      header use the queue of @ref KERNEL_PID_UNDEF.
+ * @param[in] weight    Packets per turn, at least 1
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if all queues are taken by other interfaces
+ */
+int gnrc_ipv6_rxq_set_weight(kernel_pid_t netif_pid, unsigned weight);
+#endif
+
 /**
  * @brief   Get the IPv6 header from a given list of @ref gnrc_pktsnip_t
  *
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_mpl MPL forwarder
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Multicast Protocol for Low-Power and Lossy Networks (MPL)
+ *              forwarder for GNRC
+ *
+ * Multicast packets carrying an MPL hop-by-hop option are checked against a
+ * seed set. Each seed keeps a window of the last
+ * @ref GNRC_IPV6_MPL_SEED_WINDOW sequence numbers, so duplicates are dropped
+ * before they reach upper layers. New messages are buffered and retransmitted
+ * by a Trickle timer for @ref GNRC_IPV6_MPL_DATA_EXPIRATIONS intervals
+ * (proactive forwarding). Receiving a buffered message again counts as a
+ * consistent transmission and suppresses the own retransmission.
+ *
+ * MPL control messages (reactive forwarding) are not supported.
+ *
+ * @see [RFC 7731](https://tools.ietf.org/html/rfc7731)
+ * @{
+ *
+ * @file
+ * @brief   GNRC MPL forwarder definitions.
+ */
+#ifndef NET_GNRC_IPV6_MPL_H
+#define NET_GNRC_IPV6_MPL_H
+
+#include "kernel_types.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/pkt.h"
+#include "net/ipv6/ext/mpl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default stack size to use for the MPL thread
+ */
+#ifndef GNRC_IPV6_MPL_STACK_SIZE
+#define GNRC_IPV6_MPL_STACK_SIZE        (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Default priority for the MPL thread
+ */
+#ifndef GNRC_IPV6_MPL_PRIO
+#define GNRC_IPV6_MPL_PRIO              (GNRC_IPV6_PRIO + 1)
+#endif
+
+/**
+ * @brief   Default message queue size to use for the MPL thread.
+ */
+#ifndef GNRC_IPV6_MPL_MSG_QUEUE_SIZE
+#define GNRC_IPV6_MPL_MSG_QUEUE_SIZE    (8U)
+#endif
+
+/**
+ * @brief   Number of seeds tracked in the seed set
+ *
+ * When the seed set is full, the least recently heard seed is replaced.
+ */
+#ifndef GNRC_IPV6_MPL_SEED_SET_SIZE
+#define GNRC_IPV6_MPL_SEED_SET_SIZE     (8U)
+#endif
+
+/**
+ * @brief   Number of messages buffered for retransmission
+ */
+#ifndef GNRC_IPV6_MPL_BUFFER_SIZE
+#define GNRC_IPV6_MPL_BUFFER_SIZE       (4U)
+#endif
+
+/**
+ * @brief   Number of sequence numbers tracked per seed
+ *
+ * Sequence numbers older than the window are treated as duplicates.
+ */
+#define GNRC_IPV6_MPL_SEED_WINDOW       (32U)
+
+/**
+ * @brief   DATA_MESSAGE_IMIN in milliseconds
+ */
+#ifndef GNRC_IPV6_MPL_DATA_IMIN
+#define GNRC_IPV6_MPL_DATA_IMIN         (64U)
+#endif
+
+/**
+ * @brief   DATA_MESSAGE_IMAX as number of doublings of
+ *          @ref GNRC_IPV6_MPL_DATA_IMIN
+ */
+#ifndef GNRC_IPV6_MPL_DATA_IMAX
+#define GNRC_IPV6_MPL_DATA_IMAX         (0U)
+#endif
+
+/**
+ * @brief   DATA_MESSAGE_K, the Trickle redundancy constant
+ */
+#ifndef GNRC_IPV6_MPL_DATA_K
+#define GNRC_IPV6_MPL_DATA_K            (1U)
+#endif
+
+/**
+ * @brief   DATA_MESSAGE_TIMER_EXPIRATIONS, Trickle intervals a buffered
+ *          message is retransmitted in
+ */
+#ifndef GNRC_IPV6_MPL_DATA_EXPIRATIONS
+#define GNRC_IPV6_MPL_DATA_EXPIRATIONS  (3U)
+#endif
+
+/**
+ * @brief   Message type for Trickle events of buffered messages
+ */
+#define GNRC_IPV6_MPL_MSG_TYPE_TRICKLE  (0x0a00)
+
+/**
+ * @brief   Return values of @ref gnrc_ipv6_mpl_process()
+ */
+enum {
+    /**
+     * @brief   The packet has to be processed further
+     */
+    GNRC_IPV6_MPL_DELIVER = 0,
+    /**
+     * @brief   The packet was a duplicate, not addressed to this node or
+     *          invalid and was released
+     */
+    GNRC_IPV6_MPL_CONSUMED,
+};
+
+/**
+ * @brief   PID of the MPL thread
+ */
+extern kernel_pid_t gnrc_ipv6_mpl_pid;
+
+/**
+ * @brief   Initializes the MPL forwarder and starts its thread
+ *
+ * @return  PID of the MPL thread
+ * @return  KERNEL_PID_UNDEF, on error
+ */
+kernel_pid_t gnrc_ipv6_mpl_init(void);
+
+/**
+ * @brief   Processes the MPL option of a received packet
+ *
+ * @param[in] pkt   A packet in receive order with the hop-by-hop options
+ *                  header in its first snip, followed by the IPv6 header
+ * @param[in] opt   The MPL option within the hop-by-hop options header
+ *
+ * @return  @ref GNRC_IPV6_MPL_DELIVER, if @p pkt is a new message for this
+ *          node
+ * @return  @ref GNRC_IPV6_MPL_CONSUMED, if @p pkt was released
+ */
+int gnrc_ipv6_mpl_process(gnrc_pktsnip_t *pkt, const ipv6_ext_opt_mpl_t *opt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_IPV6_MPL_H */
+/** @} */
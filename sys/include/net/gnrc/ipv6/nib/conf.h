@@ -176,6 +176,22 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @brief   (de-)activate longest-prefix-match trie for forwarding table
+ *          look-ups
+ *
+ * Makes route look-ups independent of the number of off-link entries at the
+ * cost of 2 * @ref GNRC_IPV6_NIB_OFFL_NUMOF trie nodes of RAM. Activated by
+ * default for border routers, as they usually hold the most routes.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_FT_LPM
+#if GNRC_IPV6_NIB_CONF_6LBR
+#define GNRC_IPV6_NIB_CONF_FT_LPM       (1)
+#else
+#define GNRC_IPV6_NIB_CONF_FT_LPM       (0)
+#endif
+#endif
+
 /**
  * @brief   Support for DNS configuration options
  *
@@ -217,6 +233,32 @@ extern "C" {
 #define GNRC_IPV6_NIB_CONF_REACH_TIME_RESET (7200000U)
 #endif
 
+/**
+ * @brief   Maximum jitter in milliseconds subtracted from the re-registration
+ *          time of an address
+ *
+ * Spreads the re-registrations of nodes that registered at the same time,
+ * e.g. after a network-wide restart. The jitter is at most half of the
+ * re-registration time. When one address is re-registered, the other
+ * addresses of the interface due within this time are re-registered along
+ * with it.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_REREG_JITTER
+#define GNRC_IPV6_NIB_CONF_REREG_JITTER     (30000U)
+#endif
+
+/**
+ * @brief   Maximum number of new address registrations a 6LR processes per
+ *          second
+ *
+ * Neighbor solicitations with new registrations beyond that are dropped, so
+ * the 6LN retransmits them later. Refreshes of existing registrations are
+ * always processed. 0 disables the limit.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_6LR_AR_RATE
+#define GNRC_IPV6_NIB_CONF_6LR_AR_RATE      (0U)
+#endif
+
 /**
  * @brief   Disable router solicitations
  *
@@ -253,6 +295,22 @@ extern "C" {
 #define GNRC_IPV6_NIB_NUMOF                 (4)
 #endif
 
+/**
+ * @brief   Number of buckets in the hash index over the on-link entries of the
+ *          NIB
+ *
+ * With the index, looking up a neighbor only compares the entries in one
+ * bucket instead of all @ref GNRC_IPV6_NIB_NUMOF entries. 0 disables the
+ * index, which is the default for small NIBs.
+ */
+#ifndef GNRC_IPV6_NIB_ONL_HASH_NUMOF
+#if GNRC_IPV6_NIB_NUMOF > 16
+#define GNRC_IPV6_NIB_ONL_HASH_NUMOF        (GNRC_IPV6_NIB_NUMOF / 2)
+#else
+#define GNRC_IPV6_NIB_ONL_HASH_NUMOF        (0)
+#endif
+#endif
+
 /**
  * @brief   Number of off-link entries in NIB
  *
@@ -55,6 +55,12 @@ extern "C" {
  */
 #define GNRC_LWMAC_FRAMETYPE_BROADCAST      (0x05U)
 
+/**
+ * @brief   LWMAC broadcast frame type with further broadcast frames in
+ *          the same broadcast procedure
+ */
+#define GNRC_LWMAC_FRAMETYPE_BROADCAST_PENDING  (0x06U)
+
 /**
  * @brief   LWMAC internal L2 address structure
  */
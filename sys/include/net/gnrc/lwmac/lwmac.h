@@ -286,6 +286,22 @@ extern "C" {
 #define GNRC_LWMAC_BROADCAST_CSMA_RETRIES    (3U)
 #endif
 
+/**
+ * @brief Maximum WR duration towards a neighbor with known wake-up phase.
+ *
+ * When the phase of the destination has been learned from a previous WA, the
+ * sender starts the WR stream @ref GNRC_LWMAC_WR_PREPARATION_US ahead of the
+ * destination's wake-up period. The WR stream is then only kept up for this
+ * duration instead of the full @ref GNRC_LWMAC_PREAMBLE_DURATION_US. If no WA
+ * is received in time, the learned phase is considered stale and the next
+ * attempt falls back to the full preamble.
+ */
+#ifndef GNRC_LWMAC_PHASE_LOCKED_PREAMBLE_US
+#define GNRC_LWMAC_PHASE_LOCKED_PREAMBLE_US  ((2 * GNRC_LWMAC_WR_PREPARATION_US) + \
+                                              GNRC_LWMAC_TIME_BETWEEN_WR_US + \
+                                              GNRC_LWMAC_WAKEUP_DURATION_US)
+#endif
+
 /**
  * @brief Default message queue size to use for the LWMAC thread.
  *
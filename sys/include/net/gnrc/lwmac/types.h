@@ -24,6 +24,7 @@
 
 #include "msg.h"
 #include "xtimer.h"
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/lwmac/hdr.h"
 
 #ifdef __cplusplus
@@ -105,6 +106,21 @@ extern "C" {
 #define GNRC_LWMAC_TIMEOUT_COUNT             (3U)
 #endif
 
+/**
+ * @brief Maximum number of broadcast packets sent in one broadcast procedure.
+ *
+ * Each broadcast procedure keeps the sender awake for
+ * GNRC_LWMAC_BROADCAST_DURATION_US. Instead of paying this price once per
+ * packet, the sender takes up to this number of queued broadcast packets and
+ * sends them in rotation within one (slightly prolonged) broadcast procedure.
+ * The receivers keep listening until they overhear the first received packet
+ * of the rotation again, so they get every packet of the rotation in one wake-up.
+ * Set to 1 to disable the aggregation.
+ */
+#ifndef GNRC_LWMAC_BCAST_AGGREGATE_MAX
+#define GNRC_LWMAC_BCAST_AGGREGATE_MAX       (4U)
+#endif
+
 /**
  * @brief   Internal states of LWMAC
  */
@@ -203,6 +219,12 @@ typedef struct lwmac {
     uint32_t last_wakeup;                                       /**< Used to calculate wakeup times */
     uint8_t lwmac_info;                                         /**< LWMAC's internal informations (flags) */
     gnrc_lwmac_timeout_t timeouts[GNRC_LWMAC_TIMEOUT_COUNT];    /**< Store timeouts used for protocol */
+    gnrc_pktsnip_t *bcast_pkts[GNRC_LWMAC_BCAST_AGGREGATE_MAX]; /**< Broadcast packets sent in rotation */
+    uint8_t bcast_num;                                          /**< Number of packets in bcast_pkts */
+    uint8_t bcast_next;                                         /**< Next packet of the rotation to send */
+    gnrc_lwmac_l2_addr_t bcast_first_src;                       /**< Source of the first broadcast
+                                                                     received in the current wake-up */
+    uint8_t bcast_first_seq;                                    /**< Sequence number of that broadcast */
 
 #if (GNRC_LWMAC_ENABLE_DUTYCYLE_RECORD == 1)
     /* Parameters for recording duty-cycle */
@@ -35,6 +35,9 @@
 #ifdef MODULE_GNRC_GOMACH
 #include "net/gnrc/gomach/types.h"
 #endif
+#ifdef MODULE_GNRC_TSCH
+#include "net/gnrc/tsch/types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,6 +54,31 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_batch   Batched dispatch extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Batched packet dispatch for @ref net_gnrc_netapi
+ * @{
+ * @details The submodule `gnrc_netapi_batch` allows a module to hand a
+ *          number of packets to another thread with a single message (see
+ *          gnrc_netapi_dispatch_batch()). The receiving thread handles all
+ *          of them in one wake-up, which saves a message and context switch
+ *          per packet under bursty traffic.
+ *
+ * Only threads that registered with @ref GNRC_NETREG_TYPE_BATCH receive
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH or @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH
+ * messages, all other subscribers still get one message per packet. A batch
+ * is a snip in the packet buffer holding an array of packet pointers, the
+ * receiver must release it after handling the packets (see
+ * gnrc_netapi_batch_drain()).
+ *
+ * To use, add the module `gnrc_netapi_batch` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_batch
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
@@ -93,6 +118,31 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a batch of @ref net_gnrc_pkt up the
+ *          network stack
+ *
+ * @note    Only sent with @ref net_gnrc_netapi_batch.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0206)
+
+/**
+ * @brief   @ref core_msg type for passing a batch of @ref net_gnrc_pkt down
+ *          the network stack
+ *
+ * @note    Only sent with @ref net_gnrc_netapi_batch.
+ */
+#define GNRC_NETAPI_MSG_TYPE_SND_BATCH  (0x0207)
+
+/**
+ * @brief   Maximum number of packets a module collects into one batch
+ *
+ * @note    Only used with @ref net_gnrc_netapi_batch.
+ */
+#ifndef GNRC_NETAPI_BATCH_NUMOF
+#define GNRC_NETAPI_BATCH_NUMOF         (4U)
+#endif
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -215,6 +265,94 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Sends @p cmd for a number of packets to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * Subscribers registered with @ref GNRC_NETREG_TYPE_BATCH get all packets in
+ * one @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH or
+ * @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH message, all other subscribers get one
+ * @p cmd message per packet. If no batch can be allocated in the packet
+ * buffer, all packets are dispatched one by one.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @pre `cmd` &isin; { @ref GNRC_NETAPI_MSG_TYPE_RCV, @ref GNRC_NETAPI_MSG_TYPE_SND }
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] cmd       command for all subscribers
+ * @param[in] pkts      packets to dispatch
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx). If 0 the caller
+ *         keeps ownership of all packets in @p pkts.
+ */
+int gnrc_netapi_dispatch_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t **pkts,
+                               unsigned numof);
+
+/**
+ * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_RCV command for a number of
+ *          packets to all subscribers to (@p type, @p demux_ctx).
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      packets to dispatch
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+static inline int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type,
+                                                     uint32_t demux_ctx,
+                                                     gnrc_pktsnip_t **pkts,
+                                                     unsigned numof)
+{
+    return gnrc_netapi_dispatch_batch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV,
+                                      pkts, numof);
+}
+
+/**
+ * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_SND command for a number of
+ *          packets to all subscribers to (@p type, @p demux_ctx).
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      packets to dispatch
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+static inline int gnrc_netapi_dispatch_send_batch(gnrc_nettype_t type,
+                                                  uint32_t demux_ctx,
+                                                  gnrc_pktsnip_t **pkts,
+                                                  unsigned numof)
+{
+    return gnrc_netapi_dispatch_batch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_SND,
+                                      pkts, numof);
+}
+
+/**
+ * @brief   Hands every packet of a received batch to @p handler and
+ *          releases the batch afterwards
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] batch     the batch, i.e. `msg.content.ptr` of a
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH message
+ * @param[in] handler   handler for a single packet. Takes over ownership of
+ *                      the packet.
+ */
+void gnrc_netapi_batch_drain(gnrc_pktsnip_t *batch,
+                             void (*handler)(gnrc_pktsnip_t *pkt));
+#endif
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
@@ -46,6 +46,23 @@
 #endif
 #include "net/ndp.h"
 #include "net/netdev.h"
+#ifdef MODULE_GNRC_NETAPI_BATCH
+#include "net/gnrc/netapi.h"
+#endif
+#ifdef MODULE_GNRC_NETIF_IEEE802154_BURST
+#include "net/gnrc/netif/burst.h"
+#endif
+#ifdef MODULE_GNRC_NETIF_IEEE802154_MHR
+#include "net/gnrc/netif/mhr.h"
+#endif
+#ifdef MODULE_IEEE802154_SECURITY
+#include "net/ieee802154_security.h"
+#endif
+#ifdef MODULE_GNRC_NETIF_TXQ
+#include "memarray.h"
+#include "net/gnrc/priority_pktqueue.h"
+#include "xtimer.h"
+#endif
 #include "rmutex.h"
 
 #ifdef __cplusplus
@@ -94,6 +111,83 @@ typedef struct {
 #endif
 #if defined(MODULE_GNRC_SIXLOWPAN) || DOXYGEN
     gnrc_netif_6lo_t sixlo;                 /**< 6Lo component */
+#endif
+#if defined(MODULE_GNRC_NETAPI_BATCH) || DOXYGEN
+    /**
+     * @brief   Received packets not yet passed up the stack
+     *
+     * @note    Only available with @ref net_gnrc_netapi_batch
+     */
+    gnrc_pktsnip_t *rx_batch[GNRC_NETAPI_BATCH_NUMOF];
+    /**
+     * @brief   Number of packets in gnrc_netif_t::rx_batch
+     *
+     * @note    Only available with @ref net_gnrc_netapi_batch
+     */
+    uint8_t rx_batch_numof;
+#endif
+#if defined(MODULE_GNRC_NETIF_IEEE802154_BURST) || DOXYGEN
+    gnrc_netif_burst_t burst;               /**< Burst transmission component */
+#endif
+#if defined(MODULE_GNRC_NETIF_IEEE802154_MHR) || DOXYGEN
+    gnrc_netif_mhr_cache_t mhr;             /**< MAC header templates */
+#endif
+#if defined(MODULE_IEEE802154_SECURITY) || DOXYGEN
+    ieee802154_sec_context_t sec;           /**< Link layer security context */
+#endif
+#if defined(MODULE_GNRC_NETIF_TXQ) || DOXYGEN
+    /**
+     * @brief   Packets waiting for the device to finish the current
+     *          transmission
+     *
+     * @note    Only available with the `gnrc_netif_txq` module
+     */
+    gnrc_priority_pktqueue_t txq;
+    /**
+     * @brief   Storage for the nodes of gnrc_netif_t::txq
+     *
+     * @note    Only available with the `gnrc_netif_txq` module
+     */
+    gnrc_priority_pktqueue_node_t txq_nodes[GNRC_NETIF_TXQ_SIZE];
+    /**
+     * @brief   Free nodes of gnrc_netif_t::txq_nodes
+     *
+     * @note    Only available with the `gnrc_netif_txq` module
+     */
+    memarray_t txq_pool;
+    /**
+     * @brief   Fires if the device does not report the end of a transmission
+     *
+     * @note    Only available with the `gnrc_netif_txq` module
+     */
+    xtimer_t txq_timer;
+    /**
+     * @brief   Message sent by gnrc_netif_t::txq_timer
+     *
+     * @note    Only available with the `gnrc_netif_txq` module
+     */
+    msg_t txq_timeout_msg;
+    /**
+     * @brief   Device reports the end of transmissions, so sending is
+     *          asynchronous
+     *
+     * @note    Only available with the `gnrc_netif_txq` module
+     */
+    bool txq_async;
+    /**
+     * @brief   A transmission is in progress
+     *
+     * @note    Only available with the `gnrc_netif_txq` module
+     */
+    bool txq_busy;
+#endif
+#if defined(MODULE_GNRC_PKTLAT) || DOXYGEN
+    /**
+     * @brief   Time of the last device interrupt
+     *
+     * @note    Only available with @ref net_gnrc_pktlat
+     */
+    uint32_t isr_stamp;
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
@@ -227,9 +321,13 @@ gnrc_netif_t *gnrc_netif_create(char *stack, int stacksize, char priority,
                                 const char *name, netdev_t *dev,
                                 const gnrc_netif_ops_t *ops);
 
+#if (GNRC_NETIF_NUMOF > 1) || defined(DOXYGEN)
 /**
  * @brief   Get number of network interfaces actually allocated
  *
+ * @note    With @ref GNRC_NETIF_NUMOF == 1 this and the other lookup
+ *          functions are inlined and refer to the interface directly.
+ *
  * @return  Number of network interfaces actually allocated
  */
 unsigned gnrc_netif_numof(void);
@@ -253,6 +351,28 @@ gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev);
  * @return  NULL, if no network interface with PID exists.
  */
 gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid);
+#else   /* GNRC_NETIF_NUMOF */
+/* Storage of the only network interface, only exported so the lookup
+ * functions can be inlined. Don't access directly. */
+extern gnrc_netif_t gnrc_netif_single;
+
+static inline unsigned gnrc_netif_numof(void)
+{
+    return (gnrc_netif_single.ops != NULL);
+}
+
+static inline gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev)
+{
+    return ((prev == NULL) && (gnrc_netif_single.ops != NULL))
+           ? &gnrc_netif_single : NULL;
+}
+
+static inline gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid)
+{
+    return ((gnrc_netif_single.ops != NULL) && (gnrc_netif_single.pid == pid))
+           ? &gnrc_netif_single : NULL;
+}
+#endif  /* GNRC_NETIF_NUMOF */
 
 /**
  * @brief   Gets the (unicast on anycast) IPv6 addresss of an interface (if IPv6
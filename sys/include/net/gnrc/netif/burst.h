@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_netif
+ * @{
+ *
+ * @file
+ * @brief   Burst transmission definitions for @ref net_gnrc_netif
+ *
+ * With module `gnrc_netif_ieee802154_burst`, a unicast frame that follows
+ * an acknowledged frame with the frame pending bit set to the same neighbor
+ * (e.g. the next 6LoWPAN fragment of a datagram) is sent with a reduced
+ * CSMA/CA backoff: software CSMA/CA only performs a single CCA, hardware
+ * CSMA/CA is run with a minimum backoff exponent of
+ * @ref GNRC_NETIF_BURST_MINBE. The full backoff is restored for the first
+ * frame that is not part of the burst.
+ */
+#ifndef NET_GNRC_NETIF_BURST_H
+#define NET_GNRC_NETIF_BURST_H
+
+#include <stdint.h>
+
+#include "net/ieee802154.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Minimum CSMA/CA backoff exponent used by the device within a burst
+ */
+#ifndef GNRC_NETIF_BURST_MINBE
+#define GNRC_NETIF_BURST_MINBE  (0U)
+#endif
+
+/**
+ * @brief   Burst states
+ */
+enum {
+    GNRC_NETIF_BURST_IDLE = 0,  /**< no burst in progress */
+    GNRC_NETIF_BURST_PENDING,   /**< frame with frame pending bit sent,
+                                 *   waiting for its acknowledgement */
+    GNRC_NETIF_BURST_ACKED,     /**< that frame was acknowledged */
+};
+
+/**
+ * @brief   Burst component of @ref gnrc_netif_t
+ */
+typedef struct {
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination of the burst */
+    uint8_t dst_len;                            /**< length of gnrc_netif_burst_t::dst */
+    uint8_t state;                              /**< GNRC_NETIF_BURST_... */
+    uint8_t minbe;      /**< minimum backoff exponent of the device before
+                         *   the burst */
+    uint8_t lowered;    /**< the device's minimum backoff exponent is
+                         *   currently lowered */
+} gnrc_netif_burst_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_BURST_H */
+/** @} */
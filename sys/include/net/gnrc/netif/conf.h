@@ -24,6 +24,7 @@
 #include "net/ethernet/hdr.h"
 #include "net/gnrc/ipv6/nib/conf.h"
 #include "thread.h"
+#include "timex.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,11 @@ extern "C" {
  *
  * @note    Intentionally not calling it `GNRC_NETIF_NUMOF` to not require
  *          rewrites throughout the stack.
+ *
+ * With the default of 1 the stack is specialized for a single interface:
+ * gnrc_netif_iter(), gnrc_netif_get_by_pid() and gnrc_netif_numof() are
+ * inlined and refer to that interface directly, IPv6 multicast is sent
+ * without iterating the interfaces and the 6LN flag check is constant.
  */
 #ifndef GNRC_NETIF_NUMOF
 #define GNRC_NETIF_NUMOF            (1)
@@ -126,6 +132,36 @@ extern "C" {
 #define GNRC_NETIF_DEFAULT_HL      (64U)   /**< default hop limit */
 #endif
 
+/**
+ * @brief   Number of destinations per interface for which the selected
+ *          source address is cached
+ *
+ * @note    Only used with the `gnrc_netif_ipv6_cache` module
+ */
+#ifndef GNRC_NETIF_IPV6_SRC_CACHE_SIZE
+#define GNRC_NETIF_IPV6_SRC_CACHE_SIZE (4U)
+#endif
+
+/**
+ * @brief   Number of packets the transmit queue of an interface can hold
+ *          while the device is busy sending
+ *
+ * @note    Only used with the `gnrc_netif_txq` module
+ */
+#ifndef GNRC_NETIF_TXQ_SIZE
+#define GNRC_NETIF_TXQ_SIZE        (8U)
+#endif
+
+/**
+ * @brief   Time in microseconds after which a transmission is considered
+ *          finished if the device did not report it
+ *
+ * @note    Only used with the `gnrc_netif_txq` module
+ */
+#ifndef GNRC_NETIF_TXQ_TIMEOUT
+#define GNRC_NETIF_TXQ_TIMEOUT     (100U * US_PER_MS)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
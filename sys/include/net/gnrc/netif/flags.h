@@ -122,6 +122,13 @@ enum {
  * @brief   Network interface is configured in raw mode
  */
 #define GNRC_NETIF_FLAGS_RAWMODE                   (0x00010000U)
+
+/**
+ * @brief   Network interface secures its IEEE 802.15.4 frames
+ *
+ * @see     @ref net_ieee802154_security
+ */
+#define GNRC_NETIF_FLAGS_IEEE802154_SEC            (0x00020000U)
 /** @} */
 
 #ifdef __cplusplus
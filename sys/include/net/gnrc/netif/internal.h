@@ -36,6 +36,13 @@ extern "C" {
  */
 #define NETDEV_MSG_TYPE_EVENT   (0x1234)
 
+/**
+ * @brief   Message type for the transmission timeout of the transmit queue
+ *
+ * @see GNRC_NETIF_TXQ_TIMEOUT
+ */
+#define GNRC_NETIF_TXQ_MSG_TYPE_TIMEOUT (0x1235)
+
 /**
  * @brief   Acquires exclusive access to the interface
  *
@@ -54,6 +61,77 @@ void gnrc_netif_acquire(gnrc_netif_t *netif);
  */
 void gnrc_netif_release(gnrc_netif_t *netif);
 
+/**
+ * @brief   Reads a received frame from the interface's device into a new
+ *          packet snip
+ *
+ * If the device provides @ref NETOPT_RX_PREALLOC, the snip is reserved in
+ * advance and the frame is read with a single call to
+ * @ref netdev_driver_t::recv "recv()". Otherwise the length of the frame is
+ * requested from the device first. In both cases the snip is shrunk to the
+ * number of bytes read.
+ *
+ * @param[in] netif the network interface
+ * @param[out] pkt  the snip the frame was read into. Only valid if the return
+ *                  value is greater than 0
+ * @param[out] info status information for the received frame as passed to
+ *                  @ref netdev_driver_t::recv "recv()". May be NULL.
+ *
+ * @return  number of bytes read into @p pkt
+ * @return  0 if the frame was dropped (e.g. because the packet buffer is full)
+ * @return  negative errno on a device error
+ *
+ * @internal
+ */
+int gnrc_netif_recv_frame(gnrc_netif_t *netif, gnrc_pktsnip_t **pkt,
+                          void *info);
+
+#if defined(MODULE_NETSTATS_NEIGHBOR) || DOXYGEN
+/**
+ * @brief   Announces a frame about to be handed to the interface's device to
+ *          the @ref net_netstats_neighbor "neighbor statistics"
+ *
+ * Must be called by the link layer (or the MAC protocol) right before the
+ * frame is passed on to @ref netdev_driver_t::send "send()", so that the
+ * following TX event is attributed to the correct neighbor.
+ *
+ * @param[in] netif the network interface
+ * @param[in] pkt   the frame, starting with its generic network interface
+ *                  header
+ *
+ * @internal
+ */
+void gnrc_netif_nb_stats_tx(gnrc_netif_t *netif, const gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Reports the outcome of the last frame announced with
+ *          gnrc_netif_nb_stats_tx() to the neighbor statistics
+ *
+ * On success the number of transmissions is taken from
+ * @ref NETOPT_TX_RETRIES_NEEDED, if the device supports it.
+ *
+ * @param[in] netif     the network interface
+ * @param[in] result    the outcome of the transmission
+ *
+ * @internal
+ */
+void gnrc_netif_nb_stats_tx_result(gnrc_netif_t *netif,
+                                   netstats_nb_result_t result);
+
+/**
+ * @brief   Updates the neighbor statistics with a received frame
+ *
+ * @param[in] netif     the network interface
+ * @param[in] netif_hdr the generic network interface header of the frame,
+ *                      with gnrc_netif_hdr_t::rssi and gnrc_netif_hdr_t::lqi
+ *                      set
+ *
+ * @internal
+ */
+void gnrc_netif_nb_stats_rx(gnrc_netif_t *netif,
+                            const gnrc_pktsnip_t *netif_hdr);
+#endif
+
 #if defined(MODULE_GNRC_IPV6) || DOXYGEN
 /**
  * @brief   Adds an IPv6 address to the interface
@@ -30,6 +30,9 @@
 #ifdef MODULE_NETSTATS_IPV6
 #include "net/netstats.h"
 #endif
+#ifdef MODULE_GNRC_ICMPV6_RATELIMIT
+#include "net/gnrc/icmpv6/ratelimit.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -70,6 +73,26 @@ extern "C" {
 #define GNRC_NETIF_IPV6_ADDRS_FLAGS_ANYCAST                (0x20U)
 /** @} */
 
+/**
+ * @brief   Source address cache entry
+ *
+ * @note    Only available with module `gnrc_netif_ipv6_cache`.
+ */
+typedef struct {
+    ipv6_addr_t dst;        /**< destination address */
+    uint8_t idx;            /**< index of the selected source address */
+    uint8_t flags;          /**< entry flags */
+} gnrc_netif_ipv6_src_cache_t;
+
+/**
+ * @name    Source address cache entry flags
+ * @{
+ */
+#define GNRC_NETIF_IPV6_SRC_CACHE_VALID     (0x01U) /**< entry is in use */
+#define GNRC_NETIF_IPV6_SRC_CACHE_LL_ONLY   (0x02U) /**< link-local only
+                                                     *   selection */
+/** @} */
+
 /**
  * @brief   IPv6 component for @ref gnrc_netif_t
  *
@@ -98,6 +121,50 @@ typedef struct {
      * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
      */
     ipv6_addr_t groups[GNRC_NETIF_IPV6_GROUPS_NUMOF];
+#if defined(MODULE_GNRC_NETIF_IPV6_CACHE) || DOXYGEN
+    /**
+     * @brief   Bloom filter over gnrc_netif_ipv6_t::addrs
+     *
+     * Lets address lookups skip the interface without comparing against
+     * every address. Bits of removed addresses are cleared on removal.
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_cache`.
+     */
+    uint32_t addrs_bloom;
+
+    /**
+     * @brief   Bloom filter over gnrc_netif_ipv6_t::groups
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_cache`.
+     */
+    uint32_t groups_bloom;
+
+    /**
+     * @brief   Recently selected source addresses
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_cache`.
+     */
+    gnrc_netif_ipv6_src_cache_t src_cache[GNRC_NETIF_IPV6_SRC_CACHE_SIZE];
+
+    /**
+     * @brief   gnrc_netif_ipv6_t::addrs_flags the source address cache was
+     *          filled with
+     *
+     * Address states are also changed outside of @ref net_gnrc_netif (e.g.
+     * by the NIB on DAD completion), so the cache is flushed whenever these
+     * differ from the current flags.
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_cache`.
+     */
+    uint8_t src_cache_addrs_flags[GNRC_NETIF_IPV6_ADDRS_NUMOF];
+
+    /**
+     * @brief   Next source address cache entry to replace
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_cache`.
+     */
+    uint8_t src_cache_next;
+#endif
 #ifdef MODULE_NETSTATS_IPV6
     /**
      * @brief IPv6 packet statistics
@@ -106,6 +173,18 @@ typedef struct {
      */
     netstats_t stats;
 #endif
+#if defined(MODULE_GNRC_ICMPV6_RATELIMIT) || DOXYGEN
+    /**
+     * @brief   Token bucket for the ICMPv6 messages sent over this interface
+     *
+     * Starts with @ref GNRC_ICMPV6_RATELIMIT_RATE and
+     * @ref GNRC_ICMPV6_RATELIMIT_BURST and can be reconfigured with
+     * gnrc_icmpv6_ratelimit_init().
+     *
+     * @note    Only available with module `gnrc_icmpv6_ratelimit`.
+     */
+    gnrc_icmpv6_ratelimit_t icmpv6_rl;
+#endif
 #if defined(MODULE_GNRC_IPV6_NIB) || DOXYGEN
 #if GNRC_IPV6_NIB_CONF_ROUTER || DOXYGEN
     /**
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_netif
+ * @{
+ *
+ * @file
+ * @brief   IEEE 802.15.4 MAC header templates for @ref net_gnrc_netif
+ *
+ * With module `gnrc_netif_ieee802154_mhr`, the MAC headers of the last
+ * @ref GNRC_NETIF_MHR_NUMOF distinct destinations are kept as templates.
+ * A frame to one of these destinations with the same source address, PAN
+ * and frame control flags copies the template and only patches in the
+ * sequence number instead of building the header with
+ * ieee802154_set_frame_hdr().
+ */
+#ifndef NET_GNRC_NETIF_MHR_H
+#define NET_GNRC_NETIF_MHR_H
+
+#include <stdint.h>
+
+#include "byteorder.h"
+#include "net/ieee802154.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of MAC header templates per interface
+ *
+ * Templates are replaced round-robin. With the default of 1 the lookup is a
+ * single comparison, which suits nodes that mostly talk to their parent.
+ */
+#ifndef GNRC_NETIF_MHR_NUMOF
+#define GNRC_NETIF_MHR_NUMOF    (1U)
+#endif
+
+/**
+ * @brief   A MAC header template
+ *
+ * gnrc_netif_mhr_t::len == 0 marks an unused template.
+ */
+typedef struct {
+    uint8_t hdr[IEEE802154_MAX_HDR_LEN];        /**< the MAC header */
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination address */
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
+    le_uint16_t pan;                            /**< PAN ID */
+    uint8_t dst_len;                            /**< length of gnrc_netif_mhr_t::dst */
+    uint8_t src_len;                            /**< length of gnrc_netif_mhr_t::src */
+    uint8_t flags;                              /**< first byte of the FCF */
+    uint8_t len;                                /**< length of gnrc_netif_mhr_t::hdr */
+} gnrc_netif_mhr_t;
+
+/**
+ * @brief   MAC header template component of @ref gnrc_netif_t
+ */
+typedef struct {
+    gnrc_netif_mhr_t entries[GNRC_NETIF_MHR_NUMOF]; /**< the templates */
+    uint8_t next;                   /**< template to replace next */
+} gnrc_netif_mhr_cache_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_MHR_H */
+/** @} */
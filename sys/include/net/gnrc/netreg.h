@@ -10,6 +10,16 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * By default the entries of each protocol type are kept in a single list, so
+ * a lookup is linear in the number of registered entries. With the
+ * `gnrc_netreg_hash` module every protocol type instead gets
+ * @ref GNRC_NETREG_HASH_BUCKETS lists indexed by a hash of
+ * gnrc_netreg_entry_t::demux_ctx, so e.g. UDP port demultiplexing stays
+ * (close to) constant time with many open sockets. This costs
+ * `GNRC_NETTYPE_NUMOF * (GNRC_NETREG_HASH_BUCKETS - 1)` additional pointers of
+ * RAM.
+ *
  * @{
  *
  * @file
@@ -36,7 +46,7 @@ extern "C" {
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
 /**
  *  @brief  The type of the netreg entry.
  *
@@ -69,9 +79,29 @@ typedef enum {
      */
     GNRC_NETREG_TYPE_CB,
 #endif
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Use [default IPC](@ref core_msg) for
+     *          [netapi](@ref net_gnrc_netapi) operations, but the receiving
+     *          thread also understands @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH and
+     *          @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH messages.
+     *
+     * @note    Only available with `gnrc_netapi_batch` module.
+     */
+    GNRC_NETREG_TYPE_BATCH,
+#endif
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @brief   Number of hash buckets per protocol type
+ *
+ * @note    Only used with `gnrc_netreg_hash`. Must be a power of 2.
+ */
+#ifndef GNRC_NETREG_HASH_BUCKETS
+#define GNRC_NETREG_HASH_BUCKETS    (8U)
+#endif
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -93,7 +123,8 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
@@ -133,6 +164,27 @@ typedef enum {
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
                                                       { .cbd = cbd } }
+#endif
+
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry statically with PID of a thread that
+ *          handles batched packets
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @return  An initialized netreg entry
+ */
+#define GNRC_NETREG_ENTRY_INIT_BATCH(demux_ctx, pid) { NULL, demux_ctx, \
+                                                       GNRC_NETREG_TYPE_BATCH, \
+                                                       { pid } }
+#endif
+
+#if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
 /** @} */
 
 /**
@@ -181,7 +233,7 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
      *
@@ -237,7 +289,8 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
@@ -286,6 +339,29 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->target.cbd = cbd;
 }
 #endif
+
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry dynamically with PID of a thread that
+ *          handles batched packets
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ */
+static inline void gnrc_netreg_entry_init_batch(gnrc_netreg_entry_t *entry,
+                                                uint32_t demux_ctx,
+                                                kernel_pid_t pid)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->type = GNRC_NETREG_TYPE_BATCH;
+    entry->target.pid = pid;
+}
+#endif
 /** @} */
 
 /**
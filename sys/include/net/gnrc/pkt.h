@@ -120,6 +120,14 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#if defined(MODULE_GNRC_PKTLAT) || DOXYGEN
+    uint32_t stamp;                 /**< time of the last hand-over between
+                                     *   layers, see @ref net_gnrc_pktlat */
+#endif
+#if defined(MODULE_GNRC_PKTBUF_STATS) || DOXYGEN
+    uint32_t alloc_time;            /**< time of allocation in microseconds,
+                                     *   see @ref gnrc_pktbuf_stats_t */
+#endif
 } gnrc_pktsnip_t;
 
 /**
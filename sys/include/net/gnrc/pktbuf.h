@@ -363,6 +363,81 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
 void gnrc_pktbuf_stats(void);
 #endif
 
+#if defined(MODULE_GNRC_PKTBUF_STATIC) || defined(DOXYGEN)
+/**
+ * @brief   Get the high-water mark of the packet buffer usage
+ *
+ * @note    Only available with the static packet buffer implementation.
+ *
+ * @return  maximum number of bytes in use at the same time since boot or the
+ *          last call of @ref gnrc_pktbuf_max_used_reset
+ */
+size_t gnrc_pktbuf_max_used(void);
+
+/**
+ * @brief   Reset the high-water mark to the current packet buffer usage
+ *
+ * @note    Only available with the static packet buffer implementation.
+ */
+void gnrc_pktbuf_max_used_reset(void);
+#endif
+
+#if defined(MODULE_GNRC_PKTBUF_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Number of buckets of the hold time histogram
+ *
+ * Bucket 0 counts snips released within 1024 us, bucket n > 0 hold times in
+ * [2^(n-1), 2^n) * 1024 us. The last bucket also counts all longer hold
+ * times.
+ */
+#ifndef GNRC_PKTBUF_STATS_BUCKETS
+#define GNRC_PKTBUF_STATS_BUCKETS   (12U)
+#endif
+
+/**
+ * @brief   Packet buffer telemetry
+ *
+ * Only available with the `gnrc_pktbuf_stats` module and the static packet
+ * buffer implementation.
+ */
+typedef struct {
+    size_t used;                /**< bytes currently allocated */
+    size_t max_used;            /**< high-water mark of `used` */
+    size_t free_largest;        /**< largest free chunk, i.e. the largest
+                                     allocation that can currently succeed */
+    unsigned free_chunks;       /**< number of free chunks, a measure of
+                                     the fragmentation */
+    uint32_t alloc_fails;       /**< failed allocations */
+    /**
+     * @brief   Failed allocations by type of the snip to allocate, indexed
+     *          by `type - GNRC_NETTYPE_IOVEC`
+     */
+    uint32_t alloc_fails_type[GNRC_NETTYPE_NUMOF - GNRC_NETTYPE_IOVEC];
+    /**
+     * @brief   log2 histogram of the time from allocating a snip to its
+     *          final release, see @ref GNRC_PKTBUF_STATS_BUCKETS
+     */
+    uint32_t hold_time[GNRC_PKTBUF_STATS_BUCKETS];
+} gnrc_pktbuf_stats_t;
+
+/**
+ * @brief   Get the packet buffer telemetry
+ *
+ * The statistics are also available via @ref NETOPT_STATS with context
+ * @ref NETSTATS_PKTBUF on any interface. Other than for the remaining
+ * contexts, a copy is returned there.
+ *
+ * @param[out] stats    the current statistics
+ */
+void gnrc_pktbuf_get_stats(gnrc_pktbuf_stats_t *stats);
+
+/**
+ * @brief   Reset the allocation failure and hold time counters and the
+ *          high-water mark
+ */
+void gnrc_pktbuf_reset_stats(void);
+#endif
+
 /* for testing */
 #ifdef TEST_SUITES
 /**
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_pktbuf_slab  Size-class packet buffer
+ * @ingroup     net_gnrc_pktbuf
+ * @brief       Packet buffer backend using segregated size-class slabs
+ *
+ * As an alternative to `gnrc_pktbuf_static` this backend splits the packet
+ * buffer into one slab of fixed-size blocks for @ref gnrc_pktsnip_t headers
+ * and three slabs of fixed-size blocks for payload data. Each slab keeps its
+ * free blocks in a singly linked list, so allocating and releasing a block
+ * is O(1) and the buffer can never fragment beyond the internal padding of a
+ * block.
+ *
+ * A payload is always placed in the smallest class it fits in. If that class
+ * is exhausted the next larger class is used.
+ *
+ * Use it by adding
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_pktbuf_slab
+ * ~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * to your application's Makefile. The API is the same as for all other
+ * @ref net_gnrc_pktbuf implementations.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Configuration of the size-class packet buffer
+ */
+#ifndef NET_GNRC_PKTBUF_SLAB_H
+#define NET_GNRC_PKTBUF_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of @ref gnrc_pktsnip_t headers in the packet buffer
+ */
+#ifndef GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define GNRC_PKTBUF_SLAB_SNIP_NUMOF     (48U)
+#endif
+
+/**
+ * @brief   Block size of the small payload class
+ *
+ * @note    Must be a multiple of `sizeof(void *)`
+ */
+#ifndef GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define GNRC_PKTBUF_SLAB_SMALL_SIZE     (64U)
+#endif
+
+/**
+ * @brief   Number of blocks in the small payload class
+ */
+#ifndef GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define GNRC_PKTBUF_SLAB_SMALL_NUMOF    (24U)
+#endif
+
+/**
+ * @brief   Block size of the medium payload class
+ *
+ * @note    Must be a multiple of `sizeof(void *)`
+ */
+#ifndef GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define GNRC_PKTBUF_SLAB_MEDIUM_SIZE    (256U)
+#endif
+
+/**
+ * @brief   Number of blocks in the medium payload class
+ */
+#ifndef GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define GNRC_PKTBUF_SLAB_MEDIUM_NUMOF   (6U)
+#endif
+
+/**
+ * @brief   Block size of the large payload class
+ *
+ * @details Defines the largest snip that can be allocated. The default fits
+ *          a full Ethernet frame and a reassembled 6LoWPAN datagram.
+ *
+ * @note    Must be a multiple of `sizeof(void *)`
+ */
+#ifndef GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define GNRC_PKTBUF_SLAB_LARGE_SIZE     (1536U)
+#endif
+
+/**
+ * @brief   Number of blocks in the large payload class
+ */
+#ifndef GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define GNRC_PKTBUF_SLAB_LARGE_NUMOF    (2U)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_PKTBUF_SLAB_H */
+/** @} */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_pktlat Per-layer packet latency
+ * @ingroup     net_gnrc
+ * @brief       Measures how long packets wait between the layers of GNRC
+ *
+ * Every packet dispatched via @ref net_gnrc_netapi is time stamped. When the
+ * next layer picks it up from its message queue, the time since the stamp
+ * and the number of messages still queued are recorded for that layer and
+ * direction. For received packets the network interface additionally records
+ * the time from the device interrupt to the packet being passed up.
+ *
+ * The statistics are available via the `pktlat` shell command and via
+ * @ref NETOPT_STATS with context @ref NETSTATS_PKTLAT on any interface.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Per-layer packet latency definitions
+ */
+#ifndef NET_GNRC_PKTLAT_H
+#define NET_GNRC_PKTLAT_H
+
+#include <stdint.h>
+
+#include "msg.h"
+#include "net/gnrc/pkt.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets of the latency histograms
+ *
+ * Bucket 0 counts latencies of 0 ticks, bucket n > 0 latencies in
+ * [2^(n-1), 2^n) ticks. The last bucket also counts all larger latencies.
+ */
+#ifndef GNRC_PKTLAT_BUCKETS
+#define GNRC_PKTLAT_BUCKETS     (16U)
+#endif
+
+/**
+ * @brief   Measured layers
+ */
+typedef enum {
+    GNRC_PKTLAT_NETIF = 0,      /**< network interface */
+    GNRC_PKTLAT_SIXLOWPAN,      /**< 6LoWPAN */
+    GNRC_PKTLAT_IPV6,           /**< IPv6 */
+    GNRC_PKTLAT_UDP,            /**< UDP */
+    GNRC_PKTLAT_SOCK,           /**< sock hand-off to the application */
+    GNRC_PKTLAT_LAYER_NUMOF,    /**< number of layers */
+} gnrc_pktlat_layer_t;
+
+/**
+ * @brief   Directions
+ */
+typedef enum {
+    GNRC_PKTLAT_RX = 0,         /**< received packets */
+    GNRC_PKTLAT_TX,             /**< sent packets */
+    GNRC_PKTLAT_DIR_NUMOF,      /**< number of directions */
+} gnrc_pktlat_dir_t;
+
+/**
+ * @brief   Latency statistics of one layer and direction
+ */
+typedef struct {
+    uint32_t count;                         /**< number of recorded packets */
+    uint32_t max;                           /**< maximum latency in xtimer ticks */
+    uint16_t hist[GNRC_PKTLAT_BUCKETS];     /**< log2 latency histogram,
+                                                 saturates at UINT16_MAX */
+    uint16_t queue_max;                     /**< maximum number of messages
+                                                 still queued on pick-up */
+} gnrc_pktlat_stats_t;
+
+/**
+ * @brief   Statistics table, indexed by layer and direction
+ */
+extern gnrc_pktlat_stats_t gnrc_pktlat_stats[GNRC_PKTLAT_LAYER_NUMOF][GNRC_PKTLAT_DIR_NUMOF];
+
+/**
+ * @brief   Time stamps a packet before it is handed to the next layer
+ *
+ * @param[in,out] pkt   the packet
+ */
+static inline void gnrc_pktlat_stamp(gnrc_pktsnip_t *pkt)
+{
+    pkt->stamp = xtimer_now().ticks32;
+}
+
+/**
+ * @brief   Records the latency of a packet picked up by a layer
+ *
+ * @param[in] layer     the layer picking the packet up
+ * @param[in] dir       the direction of the packet
+ * @param[in] stamp     time stamp set when the packet was handed over
+ * @param[in] queued    number of messages still waiting for the layer
+ */
+void gnrc_pktlat_record(gnrc_pktlat_layer_t layer, gnrc_pktlat_dir_t dir,
+                        uint32_t stamp, int queued);
+
+/**
+ * @brief   Records the latency of the packets carried by a message that a
+ *          layer's thread just received
+ *
+ * Messages other than (batched) @ref GNRC_NETAPI_MSG_TYPE_RCV and
+ * @ref GNRC_NETAPI_MSG_TYPE_SND are ignored. The queue depth is taken from
+ * the calling thread's message queue.
+ *
+ * @param[in] layer     the layer of the calling thread
+ * @param[in] msg       the received message
+ */
+void gnrc_pktlat_record_msg(gnrc_pktlat_layer_t layer, const msg_t *msg);
+
+/**
+ * @brief   Resets all statistics
+ */
+void gnrc_pktlat_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_PKTLAT_H */
+/** @} */
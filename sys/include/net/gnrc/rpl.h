@@ -193,12 +193,26 @@ extern "C" {
 /**
  * @brief   Number of implemented Objective Functions
  */
+#ifdef MODULE_GNRC_RPL_MRHOF
+#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (2)
+#else
 #define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1)
+#endif
 
 /**
- * @brief   Default Objective Code Point (OF0)
+ * @brief   Default Objective Code Point
+ *
+ * OF0 by default, MRHOF if the `gnrc_rpl_mrhof` module is used. A DODAG root
+ * uses this objective function, other nodes use the one announced by the
+ * root if they implement it.
  */
+#ifndef GNRC_RPL_DEFAULT_OCP
+#ifdef MODULE_GNRC_RPL_MRHOF
+#define GNRC_RPL_DEFAULT_OCP (1)
+#else
 #define GNRC_RPL_DEFAULT_OCP (0)
+#endif
+#endif
 
 /**
  * @brief   Default Instance ID
@@ -349,6 +363,23 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
  */
 #define GNRC_RPL_DAO_DELAY_JITTER   (1000UL)
 #endif
+#ifndef GNRC_RPL_DAO_MIN_INTERVAL
+/**
+ * @brief Minimum interval between two scheduled DAOs in milli seconds
+ *
+ * Caps the DAO rate of a node towards its parent, e.g. after a global repair.
+ * Routes that change in the meantime are aggregated into the next DAO.
+ */
+#define GNRC_RPL_DAO_MIN_INTERVAL   (2000UL)
+#endif
+#ifndef GNRC_RPL_DAO_TARGETS_MAX
+/**
+ * @brief Maximum number of target options aggregated into a single DAO
+ *
+ * If a node announces more targets, they are split into several DAOs.
+ */
+#define GNRC_RPL_DAO_TARGETS_MAX    (8U)
+#endif
 /** @} */
 
 /**
@@ -601,6 +632,9 @@ void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6
 /**
  * @brief   Delay the DAO sending interval
  *
+ * If a DAO is already scheduled it is not postponed any further, so that
+ * changes arriving in quick succession are aggregated into that DAO.
+ *
  * @param[in] dodag     The DODAG of the DAO
  */
 void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag);
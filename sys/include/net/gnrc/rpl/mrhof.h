@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_rpl_mrhof Minimum Rank with Hysteresis Objective Function
+ * @ingroup     net_gnrc_rpl
+ * @brief       Implementation of MRHOF using the ETX metric
+ * @see <a href="https://tools.ietf.org/html/rfc6719">
+ *          RFC 6719
+ *      </a>
+ *
+ * Parents are selected by the path cost, i.e. the rank advertised by a parent
+ * plus the ETX of the link to it. The ETX of a link is taken from the
+ * @ref net_netstats_neighbor "neighbor statistics" of the interface of the
+ * DODAG. The preferred parent is only replaced if another parent offers a
+ * path cost lower by at least @ref GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD.
+ *
+ * The link layer driver must report the transmission results
+ * (@ref NETDEV_EVENT_TX_COMPLETE, @ref NETDEV_EVENT_TX_NOACK) for the ETX to
+ * reflect the link quality. Otherwise all links are assumed to have an ETX of
+ * @ref NETSTATS_NB_ETX_INIT.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Definitions for MRHOF
+ */
+#ifndef NET_GNRC_RPL_MRHOF_H
+#define NET_GNRC_RPL_MRHOF_H
+
+#include "net/gnrc/rpl/structs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Objective Code Point of MRHOF
+ */
+#define GNRC_RPL_MRHOF_OCP                      (0x1)
+
+/**
+ * @brief   Maximum ETX of a link to a parent, in 1/@ref NETSTATS_NB_ETX_DIVISOR
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef GNRC_RPL_MRHOF_MAX_LINK_METRIC
+#define GNRC_RPL_MRHOF_MAX_LINK_METRIC          (512U)
+#endif
+
+/**
+ * @brief   Maximum path cost through a parent
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef GNRC_RPL_MRHOF_MAX_PATH_COST
+#define GNRC_RPL_MRHOF_MAX_PATH_COST            (32768U)
+#endif
+
+/**
+ * @brief   Path cost improvement needed to switch the preferred parent
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD
+#define GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD  (192U)
+#endif
+
+/**
+ * @brief   Return the address to the MRHOF objective function
+ *
+ * @return  Address of the MRHOF objective function
+ */
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_RPL_MRHOF_H */
+/** @} */
@@ -65,6 +65,30 @@ typedef struct __attribute__((packed)) {
  */
 int gnrc_rpl_srh_process(ipv6_hdr_t *ipv6, gnrc_rpl_srh_t *rh);
 
+/**
+ * @brief   Builds a RPL source routing header with elided prefixes.
+ *
+ * CmprI and CmprE are chosen as large as the addresses of @p route allow.
+ * As the header only depends on the route, a root can build it once per
+ * destination and copy it into every packet towards that destination.
+ *
+ * @pre `route_len >= 2`
+ *
+ * @param[out] rh       Buffer for the routing header.
+ * @param[in] rh_size   Size of @p rh in bytes.
+ * @param[in] route     Addresses of the route in forwarding order. The first
+ *                      one goes into the destination field of the IPv6
+ *                      header, the last one is the final destination.
+ * @param[in] route_len Number of addresses in @p route.
+ *
+ * @note    gnrc_rpl_srh_t::nh is left for the caller to set.
+ *
+ * @return  Size of the routing header in bytes, on success.
+ * @return  -ENOBUFS, if @p rh_size is too small or @p route too long.
+ */
+int gnrc_rpl_srh_build(gnrc_rpl_srh_t *rh, size_t rh_size,
+                       const ipv6_addr_t *route, unsigned route_len);
+
 #ifdef __cplusplus
 }
 #endif
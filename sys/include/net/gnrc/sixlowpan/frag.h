@@ -95,6 +95,36 @@ typedef struct {
     kernel_pid_t pid;       /**< PID of the interface */
 } gnrc_sixlowpan_msg_frag_t;
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Statistics on the 6LoWPAN reassembly buffer
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_stats`
+ */
+typedef struct {
+    unsigned fragments;     /**< fragments received */
+    unsigned datagrams;     /**< datagrams reassembled completely */
+    unsigned rbuf_full;     /**< entries evicted because the buffer was full */
+    unsigned int_full;      /**< fragments dropped because the interval
+                             *   buffer was full */
+    unsigned timeouts;      /**< entries removed on timeout */
+} gnrc_sixlowpan_frag_stats_t;
+
+/**
+ * @brief   Get the current statistics on the reassembly buffer
+ *
+ * @return  The current statistics
+ */
+gnrc_sixlowpan_frag_stats_t *gnrc_sixlowpan_frag_stats_get(void);
+#endif
+
+/**
+ * @brief   Generates a new datagram tag for a fragmented datagram
+ *
+ * @return  The new datagram tag
+ */
+uint16_t gnrc_sixlowpan_frag_next_tag(void);
+
 /**
  * @brief   Allocates a @ref gnrc_sixlowpan_msg_frag_t object
  *
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_vrb   Virtual reassembly buffer
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       Fragment forwarding for 6LoWPAN routers
+ *
+ * Without this module a 6LoWPAN router reassembles every fragmented datagram
+ * completely before forwarding it, even if the datagram is not destined to
+ * itself. With this module only the first fragment is reassembled, to learn
+ * the IPv6 destination of the datagram. If the datagram needs to be forwarded
+ * a virtual reassembly buffer (VRB) entry is created, the first fragment is
+ * recompressed and sent to the next hop with a new datagram tag, and the
+ * reassembly buffer entry is freed. All subsequent fragments of that datagram
+ * are identified by the VRB entry and relayed immediately with their link
+ * layer addresses and tag rewritten.
+ *
+ * Use it by adding
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_sixlowpan_frag_vrb
+ * ~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * to your application's Makefile.
+ *
+ * @see [draft-ietf-lwig-6lowpan-virtual-reassembly-01]
+ *      (https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01)
+ * @{
+ *
+ * @file
+ * @brief   Virtual reassembly buffer definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_VRB_H
+#define NET_GNRC_SIXLOWPAN_FRAG_VRB_H
+
+#include <stdint.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/ieee802154.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of VRB entries
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_SIZE
+#define GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
+#endif
+
+/**
+ * @brief   Timeout for a VRB entry in microseconds
+ *
+ * The timer is restarted with every fragment that is forwarded using the
+ * entry.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US
+#define GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (3U * US_PER_SEC)
+#endif
+
+/**
+ * @brief   An entry in the virtual reassembly buffer
+ */
+typedef struct {
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
+    uint8_t out_dst[IEEE802154_LONG_ADDRESS_LEN];   /**< next hop address */
+    uint8_t src_len;            /**< length of gnrc_sixlowpan_frag_vrb_t::src */
+    uint8_t out_dst_len;        /**< length of gnrc_sixlowpan_frag_vrb_t::out_dst */
+    uint16_t datagram_size;     /**< size of the uncompressed datagram */
+    uint16_t tag;               /**< tag of the incoming fragments */
+    uint16_t out_tag;           /**< tag of the forwarded fragments */
+    /**
+     * @brief   Number of bytes forwarded so far, in terms of the uncompressed
+     *          datagram. 0 marks an unused entry.
+     */
+    uint16_t current_size;
+    gnrc_netif_t *out_netif;    /**< interface fragments are forwarded to */
+    uint32_t arrival;           /**< time in microseconds of the last fragment */
+} gnrc_sixlowpan_frag_vrb_t;
+
+/**
+ * @brief   Creates a VRB entry for a datagram that is currently reassembled,
+ *          if it is to be forwarded
+ *
+ * The datagram is to be forwarded if its IPv6 destination is neither
+ * multicast nor assigned to one of the interfaces, its hop limit allows for
+ * forwarding, and the NIB knows a next hop for it.
+ *
+ * @pre `(rbuf != NULL) && (rbuf->pkt != NULL)`
+ * @pre The uncompressed IPv6 header is at the start of gnrc_sixlowpan_rbuf_t::pkt
+ *
+ * @param[in] rbuf  The reassembly buffer entry of the datagram.
+ *
+ * @return  The new VRB entry, with gnrc_sixlowpan_frag_vrb_t::current_size
+ *          set to gnrc_sixlowpan_rbuf_t::current_size of @p rbuf.
+ * @return  NULL, if the datagram is not to be forwarded or if the VRB is full.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_rbuf(const gnrc_sixlowpan_rbuf_t *rbuf);
+
+/**
+ * @brief   Gets the VRB entry for a received fragment
+ *
+ * Timed out entries are removed before the look-up.
+ *
+ * @param[in] src           The link-layer source address of the fragment.
+ * @param[in] src_len       Length of @p src.
+ * @param[in] datagram_size The datagram size from the fragment header.
+ * @param[in] tag           The datagram tag from the fragment header.
+ *
+ * @return  The VRB entry identified by the parameters.
+ * @return  NULL, if there is none.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(const uint8_t *src,
+                                                       size_t src_len,
+                                                       uint16_t datagram_size,
+                                                       uint16_t tag);
+
+/**
+ * @brief   Removes an entry from the VRB
+ *
+ * @param[in] vrbe  A VRB entry. Must not be NULL.
+ */
+static inline void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    vrbe->current_size = 0;
+}
+
+/**
+ * @brief   Removes timed out entries from the VRB
+ */
+void gnrc_sixlowpan_frag_vrb_gc(void);
+
+/**
+ * @brief   Sends the first fragment of a datagram to the next hop of a VRB
+ *          entry
+ *
+ * The IPv6 header is copied, its hop limit decremented, and the result is
+ * recompressed for the outgoing link.
+ *
+ * @pre `(vrbe != NULL) && (data != NULL)`
+ *
+ * @param[in] vrbe  The VRB entry of the datagram.
+ * @param[in] data  The uncompressed start of the datagram, beginning with
+ *                  the IPv6 header.
+ * @param[in] len   Number of bytes in @p data that were carried by the
+ *                  received first fragment.
+ *
+ * @return  0 on success.
+ * @return  -EINVAL, if @p len is too short to hold the headers to recompress.
+ * @return  -ENOMEM, if the packet buffer is full.
+ * @return  -EMSGSIZE, if the recompressed fragment does not fit into a frame
+ *          of the outgoing interface.
+ */
+int gnrc_sixlowpan_frag_vrb_send_1st(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                     const uint8_t *data, size_t len);
+
+/**
+ * @brief   Sends a subsequent fragment of a datagram to the next hop of a
+ *          VRB entry, copying its payload
+ *
+ * @pre `(vrbe != NULL) && (data != NULL)`
+ *
+ * @param[in] vrbe      The VRB entry of the datagram.
+ * @param[in] data      The payload of the fragment.
+ * @param[in] len       Length of @p data.
+ * @param[in] offset    Offset of @p data in the uncompressed datagram.
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, if the packet buffer is full.
+ */
+int gnrc_sixlowpan_frag_vrb_send_n(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                   const uint8_t *data, size_t len,
+                                   uint16_t offset);
+
+/**
+ * @brief   Forwards a received subsequent fragment using a VRB entry
+ *
+ * The fragment is relayed in place: only its tag and link-layer header are
+ * replaced. The VRB entry is removed once the whole datagram was forwarded.
+ *
+ * @pre `(vrbe != NULL) && (pkt != NULL)`
+ *
+ * @param[in] vrbe      The VRB entry of the datagram.
+ * @param[in] pkt       The received fragment, starting with the FRAGN header
+ *                      and followed by its @ref gnrc_netif_hdr_t. Will be
+ *                      released in any case.
+ */
+void gnrc_sixlowpan_frag_vrb_forward(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                     gnrc_pktsnip_t *pkt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_VRB_H */
+/** @} */
@@ -10,6 +10,22 @@
  * @defgroup    net_gnrc_sixlowpan_iphc   IPv6 header compression (IPHC)
  * @ingroup     net_gnrc_sixlowpan
  * @brief       IPv6 header compression for 6LoWPAN.
+ *
+ * With the `gnrc_sixlowpan_iphc_cache` (pseudo-)module the compressed headers
+ * of the most recently sent flows are memoized, so subsequent packets of the
+ * same flow (same IPv6 header apart from its payload length, same link-layer
+ * destination and, if applicable, same UDP ports) skip the context lookups
+ * and address compression. Entries are invalidated whenever the context
+ * buffer changes (see @ref gnrc_sixlowpan_ctx_generation()).
+ *
+ * With the `gnrc_sixlowpan_iphc_fwd` (pseudo-)module a 6LR forwards
+ * unfragmented IPHC frames that are not addressed to it within the 6LoWPAN
+ * thread: the hop limit is decremented in the compressed header and the next
+ * hop is taken from a small route cache filled by the NIB. This skips the
+ * decompression, the IPv6 thread and the recompression. Frames whose
+ * compressed header depends on the link-layer addresses, that carry a
+ * hop-by-hop options header, or that would need fragmentation take the normal
+ * path.
  * @{
  *
  * @file
@@ -24,11 +40,40 @@
 
 #include "net/gnrc/pkt.h"
 #include "net/sixlowpan.h"
+#include "timex.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of flows whose compressed headers are cached
+ *
+ * @note    Only applicable with `gnrc_sixlowpan_iphc_cache` module
+ */
+#ifndef GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define GNRC_SIXLOWPAN_IPHC_CACHE_SIZE  (4U)
+#endif
+
+/**
+ * @brief   Number of routes cached for fast-path forwarding
+ *
+ * @note    Only applicable with `gnrc_sixlowpan_iphc_fwd` module
+ */
+#ifndef GNRC_SIXLOWPAN_IPHC_FWD_CACHE_SIZE
+#define GNRC_SIXLOWPAN_IPHC_FWD_CACHE_SIZE          (4U)
+#endif
+
+/**
+ * @brief   Time in microseconds a cached route is used before the NIB is
+ *          asked again
+ *
+ * @note    Only applicable with `gnrc_sixlowpan_iphc_fwd` module
+ */
+#ifndef GNRC_SIXLOWPAN_IPHC_FWD_CACHE_TIMEOUT_US
+#define GNRC_SIXLOWPAN_IPHC_FWD_CACHE_TIMEOUT_US    (1U * US_PER_SEC)
+#endif
+
 /**
  * @brief   Decompresses a received 6LoWPAN IPHC frame.
  *
@@ -44,6 +89,39 @@ extern "C" {
  */
 void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+/**
+ * @brief   Forwards a received 6LoWPAN IPHC frame without decompressing it
+ *
+ * @pre (pkt != NULL)
+ * @pre @p pkt is writable and in receive order, i.e. the first snip is the
+ *      IPHC frame followed by its @ref gnrc_netif_hdr_t
+ *
+ * @note    Only available with `gnrc_sixlowpan_iphc_fwd` module
+ *
+ * @param[in] pkt   A received 6LoWPAN IPHC frame.
+ *
+ * @return  true, if @p pkt was forwarded (or dropped while doing so).
+ * @return  false, if @p pkt is not eligible for fast-path forwarding. @p pkt
+ *          is left untouched in that case.
+ */
+bool gnrc_sixlowpan_iphc_fwd(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Compresses the IPv6 header (and UDP header, if applicable) of a
+ *          packet in place without sending it.
+ *
+ * @pre (pkt != NULL)
+ * @pre All snips after the @ref gnrc_netif_hdr_t are write protected
+ *
+ * @param[in] pkt   A packet starting with a @ref gnrc_netif_hdr_t, followed
+ *                  by an uncompressed IPv6 header.
+ *
+ * @return  @p pkt with the IPv6 header replaced by an IPHC dispatch on
+ *          success.
+ * @return  NULL on error. @p pkt is released in that case.
+ */
+gnrc_pktsnip_t *gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief   Compresses a 6LoWPAN for IPHC.
  *
@@ -11,6 +11,14 @@
  * @ingroup     net_gnrc
  * @brief       RIOT's TCP implementation for the GNRC network stack.
  *
+ * With the `gnrc_tcp_event` module, a single thread can serve many
+ * connections instead of blocking in one thread per connection:
+ * gnrc_tcp_listen() puts a backlog of TCBs into LISTEN and posts a TCBs
+ * event to an @ref sys_event queue whenever something happens on its
+ * connection. The event handler then uses gnrc_tcp_poll(),
+ * gnrc_tcp_recv() with a zero timeout, gnrc_tcp_try_send() and
+ * gnrc_tcp_try_close(), none of which block.
+ *
  * @{
  *
  * @file
@@ -23,6 +31,7 @@
 #define NET_GNRC_TCP_H
 
 #include <stdint.h>
+#include "kernel_defines.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -109,7 +118,7 @@ int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb,  uint8_t address_family,
  *                    or @p target_addr is invalid.
  *            -EISCONN if TCB is already in use.
  *            -ENOMEM if the receive buffer for the TCB could not be allocated.
- *            Hint: Increase "GNRC_TCP_RCV_BUFFERS".
+ *            Hint: Increase "GNRC_TCP_RCV_CHUNKS".
  */
 int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, uint8_t address_family,
                           const char *local_addr, uint16_t local_port);
@@ -121,20 +130,25 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, uint8_t address_family,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occured.
+ * @note Blocks until all @p len bytes were passed to the send buffer or an error occured.
+ *       The function does not wait for the data to be acknowledged: Up to
+ *       @ref GNRC_TCP_SND_QUEUE_SIZE segments (@ref GNRC_TCP_SND_BUF_SIZE bytes) are kept in
+ *       flight and retransmitted in the background.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
  * @param[in]     len                        Number of bytes that should be transmitted.
- * @param[in]     user_timeout_duration_us   If not zero and there was not data transmitted
- *                                           the function returns after user_timeout_duration_us.
+ * @param[in]     user_timeout_duration_us   If not zero, the function returns after
+ *                                           user_timeout_duration_us, even if not all
+ *                                           data was passed to the send buffer.
  *                                           If zero, no timeout will be triggered.
  *
- * @returns   The number of successfully transmitted bytes.
+ * @returns   The number of bytes passed to the send buffer.
  *            -ENOTCONN if connection is not established.
  *            -ECONNRESET if connection was resetted by the peer.
  *            -ECONNABORTED if the connection was aborted.
- *            -ETIMEDOUT if @p user_timeout_duration_us expired.
+ *            -ETIMEDOUT if @p user_timeout_duration_us expired before any data
+ *            was passed to the send buffer.
  */
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_us);
@@ -214,6 +228,112 @@ int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_h
  */
 gnrc_pktsnip_t *gnrc_tcp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src, uint16_t dst);
 
+#if defined(MODULE_GNRC_TCP_EVENT) || defined(DOXYGEN)
+/**
+ * @name Flags returned by gnrc_tcp_poll()
+ * @{
+ */
+#define GNRC_TCP_POLL_IN   (0x01) /**< Received data can be read */
+#define GNRC_TCP_POLL_OUT  (0x02) /**< Data can be sent */
+#define GNRC_TCP_POLL_HUP  (0x04) /**< Peer closed the connection or connection is closed */
+/** @} */
+
+/**
+ * @brief Opens connections passively without blocking, using a backlog of TCBs.
+ *
+ * Every TCB in @p tcbs is initialized and put into LISTEN on @p local_port.
+ * Each incomming connection request is handled by one of these TCBs. Whenever
+ * something happens on a connection (connection established, data received,
+ * send buffer space freed, connection closed) gnrc_tcp_tcb_t::event is posted
+ * to @p evq. Use gnrc_tcp_event_get_tcb() in @p handler to get the TCB.
+ *
+ * Once a connection is closed the TCB is in state CLOSED and can be handed back
+ * to the backlog by calling this function for it again.
+ *
+ * @pre @p tcbs must not be NULL.
+ * @pre @p evq must have been initialized.
+ * @pre @p local_port is not zero.
+ *
+ * @note Each TCB in LISTEN holds one receive buffer chunk
+ *       (see @ref GNRC_TCP_RCV_CHUNKS).
+ * @note Do not use the blocking functions on TCBs of a backlog.
+ *
+ * @param[in,out] tcbs             TCBs that accept connections.
+ * @param[in]     num              Number of TCBs in @p tcbs.
+ * @param[in]     address_family   Address family of @p local_addr.
+ *                                 If local_addr == NULL, address_family is ignored.
+ * @param[in]     local_addr       If not NULL the connections are bound to @p local_addr.
+ * @param[in]     local_port       Port number to listen on.
+ * @param[in]     evq              Event queue to post connection events to.
+ * @param[in]     handler          Event handler, called in the thread owning @p evq.
+ *
+ * @returns   Zero on success.
+ *            -EAFNOSUPPORT if local_addr != NULL and @p address_family is not supported.
+ *            -EINVAL if @p local_addr is invalid.
+ *            -EISCONN if a TCB in @p tcbs is already in use.
+ *            -ENOMEM if the receive buffer for a TCB could not be allocated.
+ */
+int gnrc_tcp_listen(gnrc_tcp_tcb_t *tcbs, size_t num, uint8_t address_family,
+                    const char *local_addr, uint16_t local_port, event_queue_t *evq,
+                    event_handler_t handler);
+
+/**
+ * @brief Gets the TCB an event belongs to.
+ *
+ * @param[in] event   Event passed to the handler given to gnrc_tcp_listen().
+ *
+ * @returns   TCB holding @p event.
+ */
+static inline gnrc_tcp_tcb_t *gnrc_tcp_event_get_tcb(event_t *event)
+{
+    return container_of(event, gnrc_tcp_tcb_t, event);
+}
+
+/**
+ * @brief Checks which operations on a connection can proceed without blocking.
+ *
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Combination of GNRC_TCP_POLL_IN, GNRC_TCP_POLL_OUT and GNRC_TCP_POLL_HUP.
+ *            Zero while the connection is not established yet.
+ */
+unsigned gnrc_tcp_poll(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Transmit data to connected peer without blocking.
+ *
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     data   Pointer to the data that should be transmitted.
+ * @param[in]     len    Number of bytes that should be transmitted.
+ *
+ * @returns   The number of bytes passed to the send buffer, may be less than @p len.
+ *            -EAGAIN if the send buffer is full, retry on the next event.
+ *            -ENOTCONN if connection is not established.
+ */
+ssize_t gnrc_tcp_try_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len);
+
+/**
+ * @brief Starts closing a connection without blocking.
+ *
+ * The connection teardown finishes in the background, an event is posted
+ * once the TCB reached state CLOSED.
+ *
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success or if the connection is already closing.
+ *            -EAGAIN if the FIN does not fit into the send buffer yet, retry on the
+ *            next event.
+ */
+int gnrc_tcp_try_close(gnrc_tcp_tcb_t *tcb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
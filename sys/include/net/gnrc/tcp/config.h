@@ -68,19 +68,78 @@ extern "C" {
 #endif
 
 /**
- * @brief Number of preallocated receive buffers
+ * @brief Number of receive buffers of size @ref GNRC_TCP_RCV_BUF_SIZE the
+ *        receive buffer pool is dimensioned for
  */
 #ifndef GNRC_TCP_RCV_BUFFERS
 #define GNRC_TCP_RCV_BUFFERS (1U)
 #endif
 
 /**
- * @brief Default receive buffer size
+ * @brief Maximum receive buffer size of a single connection
  */
 #ifndef GNRC_TCP_RCV_BUF_SIZE
 #define GNRC_TCP_RCV_BUF_SIZE (GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Size of a chunk in the shared receive buffer pool
+ *
+ * Connections borrow chunks from the pool as data arrives and return them
+ * once the data was read. Every open connection holds at least one chunk.
+ */
+#ifndef GNRC_TCP_RCV_CHUNK_SIZE
+#define GNRC_TCP_RCV_CHUNK_SIZE (128U)
+#endif
+
+/**
+ * @brief Number of chunks in the shared receive buffer pool
+ *
+ * This is also the maximum number of connections with a receive buffer.
+ */
+#ifndef GNRC_TCP_RCV_CHUNKS
+#define GNRC_TCP_RCV_CHUNKS ((GNRC_TCP_RCV_BUFFERS * GNRC_TCP_RCV_BUF_SIZE + \
+                              GNRC_TCP_RCV_CHUNK_SIZE - 1) / GNRC_TCP_RCV_CHUNK_SIZE)
+#endif
+
+/**
+ * @brief Maximum number of unacknowledged segments in flight
+ *
+ * Each of these segments is kept in the packet buffer until it is
+ * acknowledged. Must be at least 1.
+ */
+#ifndef GNRC_TCP_SND_QUEUE_SIZE
+#define GNRC_TCP_SND_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Send buffer size = Maximum number of unacknowledged payload bytes
+ *
+ * gnrc_tcp_send() returns as soon as the data fits into the send buffer. It
+ * only blocks while the send buffer, the retransmission queue
+ * (see @ref GNRC_TCP_SND_QUEUE_SIZE) or the peers receive window is full.
+ */
+#ifndef GNRC_TCP_SND_BUF_SIZE
+#define GNRC_TCP_SND_BUF_SIZE (GNRC_TCP_DEFAULT_WINDOW)
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681)
+ */
+#ifndef GNRC_TCP_DUPACK_THRESHOLD
+#define GNRC_TCP_DUPACK_THRESHOLD (3U)
+#endif
+
+/**
+ * @brief Maximum number of received out-of-order segments held per connection
+ *
+ * These segments are kept in the packet buffer and reported to the peer via
+ * the SACK option (see RFC 2018). Must be at least 1.
+ */
+#ifndef GNRC_TCP_OOO_QUEUE_SIZE
+#define GNRC_TCP_OOO_QUEUE_SIZE (2U)
+#endif
+
 /**
  * @brief Lower bound for RTO = 1 sec (see RFC 6298)
  */
@@ -22,9 +22,9 @@
 #ifndef NET_GNRC_TCP_TCB_H
 #define NET_GNRC_TCP_TCB_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "kernel_types.h"
-#include "ringbuffer.h"
 #include "xtimer.h"
 #include "mutex.h"
 #include "msg.h"
@@ -36,6 +36,10 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_EVENT
+#include "event.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -70,19 +74,40 @@ typedef struct _transmission_control_block {
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number that ends the timed segment */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
     xtimer_t tim_tout;     /**< Timer struct for timeouts */
     msg_t msg_tout;        /**< Message, sent on timeouts */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    gnrc_pktsnip_t *pkt_retransmit[GNRC_TCP_SND_QUEUE_SIZE]; /**< Unacknowledged segments,
+                                                              *   oldest first */
+    uint8_t pkt_retransmit_num;       /**< Number of segments in pkt_retransmit */
+    bool pkt_sacked[GNRC_TCP_SND_QUEUE_SIZE];  /**< Scoreboard: Segment in pkt_retransmit
+                                                *   was selectively acknowledged */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    uint32_t recover;      /**< Value of snd_nxt when fast recovery was entered */
+    uint32_t high_rxt;     /**< End of last segment retransmitted during fast recovery */
+    gnrc_pktsnip_t *pkt_ooo[GNRC_TCP_OOO_QUEUE_SIZE]; /**< Received out-of-order segments,
+                                                    *   oldest first */
+    uint8_t pkt_ooo_num;   /**< Number of segments in pkt_ooo */
     msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
     mbox_t mbox;             /**< TCB mbox for synchronization */
-    uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
-    ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+    struct rcvbuf_chunk *rcv_head;  /**< Oldest receive buffer chunk, read from */
+    struct rcvbuf_chunk *rcv_tail;  /**< Newest receive buffer chunk, written to */
+    uint16_t rcv_rd;         /**< Read offset in rcv_head */
+    uint16_t rcv_len;        /**< Number of bytes in the receive buffer */
+    uint16_t rcv_chunks;     /**< Number of receive buffer chunks held */
+    uint16_t rcv_reserved;   /**< Number of unused pool chunks reserved */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
+#if defined(MODULE_GNRC_TCP_EVENT) || defined(DOXYGEN)
+    event_queue_t *evq;      /**< Queue @ref gnrc_tcp_tcb_t::event is posted to */
+    event_t event;           /**< Event posted on connection activity */
+    xtimer_t tim_conn;       /**< Timer for the connection timeout */
+    msg_t msg_conn;          /**< Message, sent on connection timeout */
+#endif
     struct _transmission_control_block *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
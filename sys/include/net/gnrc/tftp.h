@@ -29,6 +29,14 @@
  *  - https://tools.ietf.org/html/rfc2349
  *     (RFC2349 TFTP Timeout Interval and Transfer Size Options)
  *
+ *  - https://tools.ietf.org/html/rfc7440
+ *     (RFC7440 TFTP Windowsize Option)
+ *
+ * With the windowsize option, up to @ref GNRC_TFTP_WINDOW_SIZE blocks are
+ * sent before waiting for an ACK instead of sending one block per round
+ * trip. With module `vfs`, gnrc_tftp_client_read_file() and
+ * gnrc_tftp_client_write_file() transfer files without data callbacks.
+ *
  * @author      Nick van IJzendoorn <nijzendoorn@engineering-spirit.nl>
  */
 
@@ -88,6 +96,17 @@ extern "C" {
 #define GNRC_TFTP_DEFAULT_TIMEOUT           (1 * US_PER_SEC)
 #endif
 
+/**
+ * @brief The largest window proposed or accepted with the windowsize option
+ *
+ * Each block of a window is in the packet buffer at the same time, so a
+ * window needs about @ref GNRC_TFTP_WINDOW_SIZE times the block size of
+ * packet buffer space. A value of 1 disables the option.
+ */
+#ifndef GNRC_TFTP_WINDOW_SIZE
+#define GNRC_TFTP_WINDOW_SIZE               (4)
+#endif
+
 /**
  * @brief TFTP action to perform
  */
@@ -195,6 +214,39 @@ int gnrc_tftp_client_write(ipv6_addr_t *addr, const char *file_name, tftp_mode_t
                            tftp_data_cb_t data_cb, size_t total_size, tftp_stop_cb_t stop_cb,
                            bool use_option);
 
+#if defined(MODULE_VFS) || defined(DOXYGEN)
+/**
+ * @brief Start an TFTP client read action storing the file with VFS
+ *
+ * @param [in] addr         the address of the server
+ * @param [in] file_name    the filename of the file to get
+ * @param [in] mode         the transfer mode
+ * @param [in] path         the VFS path to store the file at, an existing
+ *                          file is overwritten
+ * @param [in] use_option   when set the client uses the option extensions
+ *
+ * @return 1 on success
+ * @return < 0 on failure
+ */
+int gnrc_tftp_client_read_file(ipv6_addr_t *addr, const char *file_name, tftp_mode_t mode,
+                               const char *path, bool use_option);
+
+/**
+ * @brief Start an TFTP client write action sending a file from VFS
+ *
+ * @param [in] addr         the address of the server
+ * @param [in] file_name    the filename of the file to write
+ * @param [in] mode         the transfer mode
+ * @param [in] path         the VFS path of the file to send
+ * @param [in] use_option   when set the client uses the option extensions
+ *
+ * @return 1 on success
+ * @return < 0 on failure
+ */
+int gnrc_tftp_client_write_file(ipv6_addr_t *addr, const char *file_name, tftp_mode_t mode,
+                                const char *path, bool use_option);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
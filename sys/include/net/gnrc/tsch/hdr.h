@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tsch
+ * @{
+ *
+ * @file
+ * @brief       Header definition of TSCH
+ */
+
+#ifndef NET_GNRC_TSCH_HDR_H
+#define NET_GNRC_TSCH_HDR_H
+
+#include <stdint.h>
+
+#include "byteorder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   TSCH enhanced beacon (EB) frame type
+ *
+ * The value lies in the NALP ("not a LoWPAN frame") dispatch range of
+ * 6LoWPAN, so EBs can not be mistaken for 6LoWPAN frames.
+ */
+#define GNRC_TSCH_FRAME_EB          (0x01U)
+
+/**
+ * @brief   Join priority of a node that is not synchronized
+ */
+#define GNRC_TSCH_JOIN_PRIO_NONE    (0xffU)
+
+/**
+ * @brief   TSCH enhanced beacon (EB) frame
+ *
+ * Carries the information a node needs to join the network: the absolute
+ * slot number of the timeslot the EB is sent in and the sender's distance
+ * to the PAN coordinator.
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t type;               /**< frame type, @ref GNRC_TSCH_FRAME_EB */
+    network_uint32_t asn;       /**< absolute slot number of the timeslot */
+    uint8_t join_priority;      /**< join priority of the sender */
+} gnrc_tsch_frame_eb_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TSCH_HDR_H */
+/** @} */
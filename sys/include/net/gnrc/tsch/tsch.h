@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tsch TSCH
+ * @ingroup     net_gnrc
+ * @brief       Time Slotted Channel Hopping (IEEE 802.15.4e) MAC protocol
+ *
+ * ## Timeslots and slotframes
+ * All nodes of a TSCH network share a common notion of time, divided into
+ * timeslots of @ref GNRC_TSCH_TIMESLOT_US. Timeslots are counted by the
+ * absolute slot number (ASN) and grouped into slotframes of
+ * @ref GNRC_TSCH_SLOTFRAME_LEN timeslots that repeat over time. Each frame
+ * and its acknowledgement are exchanged within one timeslot.
+ *
+ * ## Cells and channel hopping
+ * The schedule consists of cells, each given by a slot offset in the
+ * slotframe and a channel offset. In a cell the radio uses channel
+ * `GNRC_TSCH_HOPPING_SEQUENCE[(ASN + channel offset) % len]`, so consecutive
+ * uses of a cell hop over the channels of the hopping sequence and
+ * narrow-band interference or fading only affects some of them. Outside of
+ * its cells a node turns its radio off.
+ *
+ * Cells are either dedicated to one neighbor or shared. Transmissions in
+ * shared cells that are not acknowledged are followed by an exponential
+ * backoff counted in shared cells. Every node starts with the minimal
+ * schedule of 6TiSCH (RFC 8180): one shared cell at slot offset 0 and
+ * channel offset 0 for any neighbor. Further cells are added with
+ * @ref gnrc_tsch_cell_add().
+ *
+ * ## Synchronization
+ * A PAN coordinator, started with @ref gnrc_tsch_start(), periodically
+ * sends enhanced beacons (EB) with the current ASN in the shared cells.
+ * Synchronized nodes do so too. A joining node listens on the channels of
+ * the hopping sequence until it receives an EB, takes over the ASN and
+ * derives the start of the timeslot from the reception time of the EB.
+ * The sender of that EB becomes its time source; further EBs of the time
+ * source correct its clock drift. Without synchronization for
+ * @ref GNRC_TSCH_DESYNC_TIMEOUT_US a node falls back to scanning.
+ *
+ * The radio must report @ref NETDEV_EVENT_RX_STARTED for synchronization
+ * and acknowledge frames itself.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definition for the TSCH protocol
+ */
+
+#ifndef NET_GNRC_TSCH_TSCH_H
+#define NET_GNRC_TSCH_TSCH_H
+
+#include "kernel_types.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/tsch/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Duration of a timeslot in microseconds
+ */
+#ifndef GNRC_TSCH_TIMESLOT_US
+#define GNRC_TSCH_TIMESLOT_US           (10U * US_PER_MS)
+#endif
+
+/**
+ * @brief   Time from the start of a timeslot to the transmission of a frame
+ *          in microseconds
+ */
+#ifndef GNRC_TSCH_TX_OFFSET_US
+#define GNRC_TSCH_TX_OFFSET_US          (2120U)
+#endif
+
+/**
+ * @brief   Guard time a receiver listens around the expected frame start in
+ *          microseconds
+ *
+ * Must cover the clock drift between two synchronizations plus the
+ * latency of the radio.
+ */
+#ifndef GNRC_TSCH_RX_WAIT_US
+#define GNRC_TSCH_RX_WAIT_US            (2200U)
+#endif
+
+/**
+ * @brief   Number of timeslots in a slotframe
+ */
+#ifndef GNRC_TSCH_SLOTFRAME_LEN
+#define GNRC_TSCH_SLOTFRAME_LEN         (7U)
+#endif
+
+/**
+ * @brief   Channel hopping sequence
+ */
+#ifndef GNRC_TSCH_HOPPING_SEQUENCE
+#define GNRC_TSCH_HOPPING_SEQUENCE      { 15, 25, 26, 20 }
+#endif
+
+/**
+ * @brief   Interval between enhanced beacons in microseconds
+ */
+#ifndef GNRC_TSCH_EB_PERIOD_US
+#define GNRC_TSCH_EB_PERIOD_US          (4U * US_PER_SEC)
+#endif
+
+/**
+ * @brief   Time without synchronization after which a node leaves the
+ *          network in microseconds
+ */
+#ifndef GNRC_TSCH_DESYNC_TIMEOUT_US
+#define GNRC_TSCH_DESYNC_TIMEOUT_US     (4U * GNRC_TSCH_EB_PERIOD_US)
+#endif
+
+/**
+ * @brief   Time spent on each channel while scanning for enhanced beacons in
+ *          microseconds
+ */
+#ifndef GNRC_TSCH_SCAN_CHANNEL_US
+#define GNRC_TSCH_SCAN_CHANNEL_US       (1U * US_PER_SEC)
+#endif
+
+/**
+ * @brief   Maximum number of retransmissions of a unicast frame
+ */
+#ifndef GNRC_TSCH_MAX_FRAME_RETRIES
+#define GNRC_TSCH_MAX_FRAME_RETRIES     (3U)
+#endif
+
+/**
+ * @brief   Minimum backoff exponent in shared cells
+ */
+#ifndef GNRC_TSCH_MIN_BE
+#define GNRC_TSCH_MIN_BE                (1U)
+#endif
+
+/**
+ * @brief   Maximum backoff exponent in shared cells
+ */
+#ifndef GNRC_TSCH_MAX_BE
+#define GNRC_TSCH_MAX_BE                (5U)
+#endif
+
+/**
+ * @brief   Creates an IEEE 802.15.4 TSCH network interface
+ *
+ * @param[in] stack     The stack for the TSCH network interface's thread.
+ * @param[in] stacksize Size of @p stack.
+ * @param[in] priority  Priority for the TSCH network interface's thread.
+ * @param[in] name      Name for the TSCH network interface. May be NULL.
+ * @param[in] dev       Device for the interface
+ *
+ * @see @ref gnrc_netif_create()
+ *
+ * @return  The network interface on success.
+ * @return  NULL, on error.
+ */
+gnrc_netif_t *gnrc_netif_tsch_create(char *stack, int stacksize,
+                                     char priority, char *name,
+                                     netdev_t *dev);
+
+/**
+ * @brief   Starts a TSCH network with @p netif as PAN coordinator
+ *
+ * @param[in] netif     A TSCH network interface
+ *
+ * @return  0 on success.
+ * @return  -EBUSY, if the interface's message queue is full.
+ */
+int gnrc_tsch_start(gnrc_netif_t *netif);
+
+/**
+ * @brief   Adds a cell to the schedule of @p netif
+ *
+ * @param[in] netif     A TSCH network interface
+ * @param[in] cell      The cell to add
+ *
+ * @return  0 on success.
+ * @return  -EINVAL, if @p cell is not within the slotframe or has no options.
+ * @return  -EEXIST, if a cell with the same offsets already exists.
+ * @return  -ENOMEM, if the schedule is full.
+ */
+int gnrc_tsch_cell_add(gnrc_netif_t *netif, const gnrc_tsch_cell_t *cell);
+
+/**
+ * @brief   Removes a cell from the schedule of @p netif
+ *
+ * @param[in] netif             A TSCH network interface
+ * @param[in] slot_offset       Slot offset of the cell
+ * @param[in] channel_offset    Channel offset of the cell
+ *
+ * @return  0 on success.
+ * @return  -ENOENT, if there is no such cell.
+ */
+int gnrc_tsch_cell_remove(gnrc_netif_t *netif, uint16_t slot_offset,
+                          uint16_t channel_offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TSCH_TSCH_H */
+/** @} */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tsch
+ * @{
+ *
+ * @file
+ * @brief       Definition of internal types used by TSCH
+ */
+
+#ifndef NET_GNRC_TSCH_TYPES_H
+#define NET_GNRC_TSCH_TYPES_H
+
+#include <stdint.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "xtimer.h"
+#include "net/gnrc/pkt.h"
+#include "net/ieee802154.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   TSCH timer event message type
+ */
+#define GNRC_TSCH_EVENT_TIMER_TYPE      (0x4500)
+
+/**
+ * @brief   Message type to start a TSCH network as PAN coordinator
+ */
+#define GNRC_TSCH_MSG_TYPE_START        (0x4501)
+
+/**
+ * @name    TSCH timer events
+ * @{
+ */
+#define GNRC_TSCH_EVENT_SLOT            (0x01U) /**< a timeslot begins */
+#define GNRC_TSCH_EVENT_TX              (0x02U) /**< time to send the frame */
+#define GNRC_TSCH_EVENT_RX_END          (0x03U) /**< receive guard time ended */
+#define GNRC_TSCH_EVENT_SLOT_END        (0x04U) /**< the active timeslot ends */
+#define GNRC_TSCH_EVENT_SCAN            (0x05U) /**< switch the scan channel */
+#define GNRC_TSCH_EVENT_MASK            (0x0fU) /**< event bits of the timer
+                                                     message's value */
+/** @} */
+
+/**
+ * @brief   Maximum number of cells in the slotframe
+ */
+#ifndef GNRC_TSCH_CELL_NUMOF
+#define GNRC_TSCH_CELL_NUMOF            (8U)
+#endif
+
+/**
+ * @name    Cell options
+ * @{
+ */
+#define GNRC_TSCH_CELL_TX               (0x01U) /**< transmit in the cell */
+#define GNRC_TSCH_CELL_RX               (0x02U) /**< receive in the cell */
+#define GNRC_TSCH_CELL_SHARED           (0x04U) /**< cell is contended, use
+                                                     backoff on failures */
+/** @} */
+
+/**
+ * @brief   A cell of the slotframe
+ */
+typedef struct {
+    uint16_t slot_offset;                       /**< timeslot in the slotframe */
+    uint16_t channel_offset;                    /**< channel offset */
+    uint8_t options;                            /**< cell options, 0 if unused */
+    uint8_t addr_len;                           /**< length of @p addr, 0 for
+                                                     any neighbor */
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];  /**< neighbor of the cell */
+} gnrc_tsch_cell_t;
+
+/**
+ * @brief   Synchronization states of TSCH
+ */
+typedef enum {
+    GNRC_TSCH_STATE_SCANNING = 0,   /**< scanning for enhanced beacons */
+    GNRC_TSCH_STATE_SYNCED,         /**< synchronized to the network */
+} gnrc_tsch_state_t;
+
+/**
+ * @brief   Activity in the current timeslot
+ */
+typedef enum {
+    GNRC_TSCH_SLOT_IDLE = 0,        /**< radio is off */
+    GNRC_TSCH_SLOT_TX,              /**< transmitting a frame */
+    GNRC_TSCH_SLOT_RX,              /**< listening for a frame */
+} gnrc_tsch_slot_state_t;
+
+/**
+ * @brief   TSCH specific structure for storing internal states
+ */
+typedef struct tsch {
+    xtimer_t timer;                             /**< timer for slot events */
+    msg_t timer_msg;                            /**< message of @p timer */
+    uint32_t timer_event;                       /**< expected timer event */
+    mutex_t lock;                               /**< protects @p cells */
+    gnrc_tsch_cell_t cells[GNRC_TSCH_CELL_NUMOF];   /**< the slotframe */
+    gnrc_pktsnip_t *eb;                         /**< EB sent in this timeslot */
+    uint32_t asn;                               /**< absolute slot number */
+    uint32_t slot_start;                        /**< start of the timeslot in us */
+    uint32_t rx_start;                          /**< start of the last received
+                                                     frame in us */
+    uint32_t last_sync;                         /**< time of the last
+                                                     synchronization in us */
+    uint32_t next_eb;                           /**< time the next EB is due */
+    uint16_t channel_offset;                    /**< channel offset of the
+                                                     active cell */
+    uint8_t cell_options;                       /**< options of the active cell */
+    uint8_t state;                              /**< @ref gnrc_tsch_state_t */
+    uint8_t slot_state;                         /**< @ref gnrc_tsch_slot_state_t */
+    uint8_t join_priority;                      /**< own join priority */
+    uint8_t scan_channel;                       /**< hopping sequence index
+                                                     while scanning */
+    uint8_t retries;                            /**< transmissions of the
+                                                     current frame */
+    uint8_t be;                                 /**< backoff exponent */
+    uint8_t backoff;                            /**< shared cells to skip */
+    uint8_t last_neighbor;                      /**< last neighbor served in a
+                                                     cell for any neighbor */
+    uint8_t src_addr_len;                       /**< length of @p src_addr */
+    uint8_t src_addr[IEEE802154_LONG_ADDRESS_LEN];  /**< time source neighbor */
+} gnrc_tsch_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TSCH_TYPES_H */
+/** @} */
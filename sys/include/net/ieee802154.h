@@ -203,7 +203,8 @@ size_t ieee802154_set_frame_hdr(uint8_t *buf, const uint8_t *src, size_t src_len
 /**
  * @brief   Get length of MAC header.
  *
- * @todo include security header implications
+ * If @ref IEEE802154_FCF_SECURITY_EN is set, the auxiliary security header
+ * is included.
  *
  * @param[in] mhr   MAC header.
  *
@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_ieee802154_security IEEE 802.15.4 security
+ * @ingroup     net_ieee802154
+ * @brief       IEEE 802.15.4 frame security (AES-CCM*)
+ *
+ * Implements the outgoing and incoming frame security procedures of
+ * IEEE 802.15.4-2006 for the security levels with encryption and
+ * authentication (ENC-MIC-32, ENC-MIC-64 and ENC-MIC-128), with key
+ * identifier mode 1 (key index with the default key source).
+ *
+ * Keys are kept in a small table indexed by their key index, the frame
+ * counters of up to @ref IEEE802154_SEC_NEIGHBOR_NUMOF senders are
+ * remembered to reject replayed frames. Entries are never replaced
+ * implicitly, as that would let a replayed frame of a forgotten sender pass:
+ * once the table is full, frames of other senders are dropped until an entry
+ * is removed with ieee802154_sec_del_neighbor(). Only frames secured with
+ * @ref IEEE802154_SEC_LEVEL are accepted, so the MIC can't be downgraded.
+ *
+ * AES is done with @ref sys_crypto, which uses the CPU's AES peripheral if it
+ * provides one (feature `periph_aes`).
+ *
+ * The CCM* nonce contains the extended address of the sender, so secured
+ * frames are always sent with the extended source address, and secured
+ * frames with a short source address are rejected.
+ *
+ * With @ref net_gnrc_netif, the key is set with @ref NETOPT_ENCRYPTION_KEY
+ * (16 bytes for key index 1, or the key index followed by the key) and
+ * security is switched on with @ref NETOPT_ENCRYPTION, e.g. from the shell:
+ *
+ *     ifconfig 4 set key c0c1c2c3c4c5c6c7c8c9cacbcccdcecf
+ *     ifconfig 4 set encrypt on
+ *
+ * Once switched on, unsecured frames are dropped.
+ *
+ * @{
+ *
+ * @file
+ * @brief       IEEE 802.15.4 security interface
+ */
+#ifndef NET_IEEE802154_SECURITY_H
+#define NET_IEEE802154_SECURITY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "crypto/ciphers.h"
+#include "net/ieee802154.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Security level used for outgoing frames
+ *
+ * One of @ref IEEE802154_SEC_LEVEL_ENC_MIC_32,
+ * @ref IEEE802154_SEC_LEVEL_ENC_MIC_64 or
+ * @ref IEEE802154_SEC_LEVEL_ENC_MIC_128.
+ */
+#ifndef IEEE802154_SEC_LEVEL
+#define IEEE802154_SEC_LEVEL            (IEEE802154_SEC_LEVEL_ENC_MIC_32)
+#endif
+
+/**
+ * @brief   Number of keys in the key table
+ */
+#ifndef IEEE802154_SEC_KEY_NUMOF
+#define IEEE802154_SEC_KEY_NUMOF        (2U)
+#endif
+
+/**
+ * @brief   Number of senders whose frame counters are remembered
+ */
+#ifndef IEEE802154_SEC_NEIGHBOR_NUMOF
+#define IEEE802154_SEC_NEIGHBOR_NUMOF   (8U)
+#endif
+
+/**
+ * @name    Security levels
+ * @{
+ */
+#define IEEE802154_SEC_LEVEL_ENC_MIC_32     (5U)    /**< encryption, 4 byte MIC */
+#define IEEE802154_SEC_LEVEL_ENC_MIC_64     (6U)    /**< encryption, 8 byte MIC */
+#define IEEE802154_SEC_LEVEL_ENC_MIC_128    (7U)    /**< encryption, 16 byte MIC */
+/** @} */
+
+/**
+ * @brief   Key identifier mode 1: key index with the default key source
+ */
+#define IEEE802154_SEC_KEY_ID_MODE_1    (1U << 3)
+
+/**
+ * @brief   Length of the key of a key table entry (AES-128)
+ */
+#define IEEE802154_SEC_KEY_LEN          (16U)
+
+/**
+ * @brief   Length of the auxiliary security header of outgoing frames
+ *
+ * Security control, frame counter and key index.
+ */
+#define IEEE802154_SEC_AUX_HDR_LEN      (6U)
+
+/**
+ * @brief   Length of the MIC of outgoing frames
+ */
+#define IEEE802154_SEC_MIC_LEN          (2U << (IEEE802154_SEC_LEVEL & 0x3))
+
+/**
+ * @brief   Additional bytes of a secured frame compared to an unsecured frame
+ *          with the same addressing
+ */
+#define IEEE802154_SEC_OVERHEAD         (IEEE802154_SEC_AUX_HDR_LEN + \
+                                         IEEE802154_SEC_MIC_LEN)
+
+/**
+ * @brief   Key table entry
+ */
+typedef struct {
+    cipher_t cipher;            /**< cipher initialized with the key */
+    uint8_t index;              /**< key index, 0 marks an unused entry */
+} ieee802154_sec_key_t;
+
+/**
+ * @brief   Last frame counter received from a sender
+ */
+typedef struct {
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];  /**< extended address */
+    uint32_t frame_counter;                     /**< last frame counter */
+} ieee802154_sec_neighbor_t;
+
+/**
+ * @brief   Security context of an interface
+ */
+typedef struct {
+    ieee802154_sec_key_t keys[IEEE802154_SEC_KEY_NUMOF];    /**< key table */
+    /**
+     * @brief   Frame counters of the known senders
+     */
+    ieee802154_sec_neighbor_t neighbors[IEEE802154_SEC_NEIGHBOR_NUMOF];
+    uint32_t frame_counter;     /**< frame counter of the next outgoing frame */
+    uint8_t tx_key;             /**< key index for outgoing frames, 0 if none */
+    uint8_t neighbors_numof;    /**< used entries of ieee802154_sec_context_t::neighbors */
+} ieee802154_sec_context_t;
+
+/**
+ * @brief   Initialize a security context without any keys
+ *
+ * @param[out] ctx  security context
+ */
+void ieee802154_sec_init(ieee802154_sec_context_t *ctx);
+
+/**
+ * @brief   Add or replace a key
+ *
+ * The first key added is used for outgoing frames.
+ *
+ * @param[in,out] ctx   security context
+ * @param[in] index     key index, must not be 0
+ * @param[in] key       key of @ref IEEE802154_SEC_KEY_LEN bytes
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p index is 0 or the cipher can not be initialized
+ * @return  -ENOMEM if the key table is full
+ */
+int ieee802154_sec_set_key(ieee802154_sec_context_t *ctx, uint8_t index,
+                           const uint8_t *key);
+
+/**
+ * @brief   Secure an outgoing frame in place
+ *
+ * Appends the auxiliary security header to the MAC header, encrypts the
+ * payload and appends the MIC to it. The MAC header must have
+ * @ref IEEE802154_FCF_SECURITY_EN set and an extended source address.
+ *
+ * @param[in,out] ctx       security context
+ * @param[in,out] mhr       MAC header, with room for
+ *                          @ref IEEE802154_SEC_AUX_HDR_LEN more bytes
+ * @param[in] mhr_len       length of @p mhr
+ * @param[in] src           extended source address in network byte order
+ * @param[in,out] payload   payload, with room for
+ *                          @ref IEEE802154_SEC_MIC_LEN more bytes
+ * @param[in] payload_len   length of @p payload
+ *
+ * @return  length of the MAC header including the auxiliary security header
+ * @return  -ENOENT if no key is set
+ * @return  -EOVERFLOW if the frame counter is exhausted
+ */
+int ieee802154_sec_encrypt(ieee802154_sec_context_t *ctx, uint8_t *mhr,
+                           size_t mhr_len, const uint8_t *src,
+                           uint8_t *payload, size_t payload_len);
+
+/**
+ * @brief   Verify and decrypt an incoming frame in place
+ *
+ * @param[in,out] ctx       security context
+ * @param[in] mhr           MAC header including the auxiliary security header
+ * @param[in] mhr_len       length of @p mhr, see ieee802154_get_frame_hdr_len()
+ * @param[in,out] payload   encrypted payload followed by the MIC
+ * @param[in] len           length of @p payload including the MIC
+ *
+ * @return  length of the decrypted payload
+ * @return  -ENOTSUP if the frame uses a security level other than
+ *          @ref IEEE802154_SEC_LEVEL, or a key identifier mode or source
+ *          addressing that is not supported
+ * @return  -ENOENT if the key is unknown
+ * @return  -EBADMSG if the frame is too short or the MIC does not match
+ * @return  -EALREADY if the frame is a replay
+ * @return  -ENOSPC if the sender is unknown and the table of frame counters
+ *          is full
+ */
+int ieee802154_sec_decrypt(ieee802154_sec_context_t *ctx, const uint8_t *mhr,
+                           size_t mhr_len, uint8_t *payload, size_t len);
+
+/**
+ * @brief   Forget the frame counter of a sender
+ *
+ * Makes room for another sender. Frames of @p addr are accepted with any
+ * frame counter afterwards, so only remove senders that are gone or that
+ * use a new key.
+ *
+ * @param[in,out] ctx   security context
+ * @param[in] addr      extended address of the sender in network byte order
+ *
+ * @return  0 on success
+ * @return  -ENOENT if the sender is not known
+ */
+int ieee802154_sec_del_neighbor(ieee802154_sec_context_t *ctx,
+                                const uint8_t *addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_IEEE802154_SECURITY_H */
+/** @} */
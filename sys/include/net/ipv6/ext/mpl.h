@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_ipv6_ext_mpl IPv6 MPL option
+ * @ingroup     net_ipv6_ext
+ * @brief       Definitions for the Multicast Protocol for Low-Power and Lossy
+ *              Networks (MPL) hop-by-hop option.
+ * @see [RFC 7731](https://tools.ietf.org/html/rfc7731)
+ * @{
+ *
+ * @file
+ * @brief   MPL option definitions.
+ */
+#ifndef NET_IPV6_EXT_MPL_H
+#define NET_IPV6_EXT_MPL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Hop-by-hop option types
+ * @{
+ */
+#define IPV6_EXT_OPT_PAD1           (0x00U) /**< Pad1 option */
+#define IPV6_EXT_OPT_PADN           (0x01U) /**< PadN option */
+#define IPV6_EXT_OPT_MPL            (0x6dU) /**< MPL option */
+/** @} */
+
+/**
+ * @name MPL option flags
+ * @see [RFC 7731, section 4.2](https://tools.ietf.org/html/rfc7731#section-4.2)
+ * @{
+ */
+#define IPV6_EXT_OPT_MPL_S_MASK     (0xc0U) /**< seed ID length field */
+#define IPV6_EXT_OPT_MPL_S_POS      (6U)    /**< position of the S field */
+#define IPV6_EXT_OPT_MPL_FLAG_M     (0x20U) /**< largest known sequence */
+#define IPV6_EXT_OPT_MPL_FLAG_V     (0x10U) /**< version, must be 0 */
+/** @} */
+
+/**
+ * @brief   Maximum length of an MPL seed ID in bytes
+ */
+#define IPV6_EXT_OPT_MPL_SEED_ID_MAX    (16U)
+
+/**
+ * @brief   Realm-local scope all MPL forwarders address (ff03::fc)
+ */
+#define IPV6_ADDR_ALL_MPL_FORWARDERS_REALM_LOCAL \
+    {{ 0xff, 0x03, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xfc }}
+
+/**
+ * @brief   MPL hop-by-hop option.
+ *
+ * The seed ID of a length given by ipv6_ext_opt_mpl_t::flags follows the
+ * header.
+ *
+ * @see [RFC 7731, section 4.2](https://tools.ietf.org/html/rfc7731#section-4.2)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t type;       /**< option type (@ref IPV6_EXT_OPT_MPL) */
+    uint8_t len;        /**< length of option data in bytes */
+    uint8_t flags;      /**< S, M and V flags */
+    uint8_t seq;        /**< sequence number */
+} ipv6_ext_opt_mpl_t;
+
+/**
+ * @brief   Gets the length of the seed ID of an MPL option
+ *
+ * @param[in] opt   An MPL option
+ *
+ * @return  Length of the seed ID in bytes. 0 means the seed ID is the IPv6
+ *          source address.
+ */
+static inline unsigned ipv6_ext_opt_mpl_seed_id_len(const ipv6_ext_opt_mpl_t *opt)
+{
+    static const uint8_t lens[] = { 0, 2, 8, 16 };
+
+    return lens[(opt->flags & IPV6_EXT_OPT_MPL_S_MASK) >> IPV6_EXT_OPT_MPL_S_POS];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_IPV6_EXT_MPL_H */
+/** @} */
@@ -121,6 +121,24 @@ int l2filter_rm(l2filter_t *list, const void *addr, size_t addr_len);
  */
 bool l2filter_pass(const l2filter_t *list, const void *addr, size_t addr_len);
 
+/**
+ * @brief   Get the only address that passes a whitelist
+ *
+ * Device drivers use this to move the filter into hardware filters that can
+ * only match a single source address.
+ *
+ * @param[in] list      list with white-/blacklisted addresses
+ * @param[in] addr_len  address length supported by the hardware filter
+ *
+ * @pre     @p list != NULL
+ *
+ * @return  the only entry of @p list, if in whitelist mode and @p list holds
+ *          exactly one entry of length @p addr_len
+ * @return  NULL otherwise
+ */
+const l2filter_t *l2filter_whitelist_single(const l2filter_t *list,
+                                            size_t addr_len);
+
 #ifdef __cplusplus
 }
 #endif
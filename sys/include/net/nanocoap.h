@@ -106,6 +106,16 @@
  * attribute. The _payload_len_ attribute provides the available length in the
  * buffer. The option functions keep these values current as they are used.
  *
+ * ### Option builder ###
+ *
+ * If options are not known in order, initialize the coap_pkt_t with
+ * coap_builder_init() instead and add options in any order with the
+ * coap_builder_add_xxx() functions. The values are staged at the end of the
+ * buffer and coap_builder_finish() encodes all options in a single pass,
+ * keeping repeated options in the order they were added. Until then, the
+ * _payload_ attribute of the coap_pkt_t is not valid. Staging needs twice the
+ * space of an option value plus seven bytes until the builder is finished.
+ *
  * # Create a Block-wise Response (Block2)
  *
  * Block-wise is a CoAP extension (RFC 7959) to divide a large payload across
@@ -131,6 +141,26 @@
  * finalizes the packet and calls coap_block2_finish() internally to update
  * the block2 option.
  *
+ * # Client Block-wise Transfers
+ *
+ * A coap_block_xfer_t tracks the client side of a block-wise transfer, either
+ * uploading a payload with Block1 or downloading a representation with Block2.
+ * It is independent of the transport, so it can be driven by the blocking
+ * nanocoap_get_blockwise() and nanocoap_send_blockwise() functions as well as
+ * from the response handler of a gcoap request.
+ *
+ * Initialize the transfer with coap_block1_xfer_init() or
+ * coap_block2_xfer_init(). Then, as long as coap_block_xfer_next() yields a
+ * block number, build a request for that block with
+ * coap_block1_xfer_finish() or coap_opt_add_block2_xfer() and send it. Pass
+ * each response to coap_block1_xfer_recv() or coap_block2_xfer_recv() until
+ * one of them reports the transfer complete.
+ *
+ * The first block is always transferred alone, so the server may reduce the
+ * block size in its response. Afterwards up to _window_ blocks are kept in
+ * flight, which hides the round trip time of the link. Use a window of 1 for
+ * servers that can not handle blocks out of order.
+ *
  * @{
  *
  * @file
@@ -183,6 +213,11 @@ extern "C" {
  */
 #define NANOCOAP_NOPTS_MAX          (16)
 #define NANOCOAP_URI_MAX            (64)
+#ifndef NANOCOAP_OPT_INDEX_MAX
+#define NANOCOAP_OPT_INDEX_MAX      (28)  /**< Options with a lower number are
+                                            *  found in O(1), covers all core
+                                            *  options up to Block1 */
+#endif
 #define NANOCOAP_BLOCK_SIZE_EXP_MAX  (6)  /**< Maximum size for a blockwise
                                             *  transfer as power of 2 */
 /** @} */
@@ -231,6 +266,11 @@ typedef struct {
     uint16_t payload_len;                       /**< length of payload       */
     uint16_t options_len;                       /**< length of options array */
     coap_optpos_t options[NANOCOAP_NOPTS_MAX];  /**< option offset array     */
+    uint8_t opt_index[(NANOCOAP_OPT_INDEX_MAX + 1) / 2];
+                                                /**< first entry in options
+                                                     for each option number,
+                                                     4 bit each, see
+                                                     NANOCOAP_OPT_INDEX_MAX  */
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                     /**< observe value           */
 #endif
@@ -272,6 +312,32 @@ typedef struct {
     uint8_t *opt;                   /**< Pointer to the placed option       */
 } coap_block_slicer_t;
 
+/**
+ * @brief   Maximum number of blocks in flight for a coap_block_xfer_t
+ */
+#define COAP_BLOCK_XFER_WINDOW_MAX  (32U)
+
+/**
+ * @brief   Client side block-wise transfer state
+ *
+ * Blocks from _base_ up to _next_ have been requested, completed ones among
+ * them are marked in the _done_ bitmap.
+ */
+typedef struct {
+    uint8_t *buf;                   /**< Block1: data to send, Block2: buffer
+                                         for the received representation    */
+    size_t len;                     /**< length of @p buf                   */
+    size_t total;                   /**< Block2: length of the received
+                                         representation                     */
+    uint32_t base;                  /**< first block not completed yet      */
+    uint32_t next;                  /**< next block to request              */
+    uint32_t last;                  /**< last block, UINT32_MAX if unknown  */
+    uint32_t done;                  /**< completed blocks, bit 0 is _base_  */
+    uint8_t szx;                    /**< szx value in use                   */
+    uint8_t window;                 /**< maximum number of blocks in flight */
+    uint8_t inflight;               /**< number of blocks in flight         */
+} coap_block_xfer_t;
+
 /**
  * @brief   Global CoAP resource list
  */
@@ -628,6 +694,80 @@ ssize_t coap_opt_add_uint(coap_pkt_t *pkt, uint16_t optnum, uint32_t value);
  */
 ssize_t coap_opt_finish(coap_pkt_t *pkt, uint16_t flags);
 
+/**
+ * @brief   Initialize a packet struct to add options in any order
+ *
+ * @pre  buf              CoAP header already initialized
+ *
+ * @param[out]   pkt        pkt to initialize
+ * @param[in]    buf        buffer to write for pkt, with CoAP header already
+ *                          initialized
+ * @param[in]    len        length of buf
+ * @param[in]    header_len length of header in buf, including token
+ */
+void coap_builder_init(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                       size_t header_len);
+
+/**
+ * @brief   Add an opaque option to a packet initialized with
+ *          coap_builder_init()
+ *
+ * @param[in,out] pkt         pkt referencing target buffer
+ * @param[in]     optnum      option number to use
+ * @param[in]     val         option value
+ * @param[in]     val_len     length of @p val
+ *
+ * @return        length of the option value
+ * @return        -ENOSPC if no space or no available options are left
+ */
+ssize_t coap_builder_add_opaque(coap_pkt_t *pkt, uint16_t optnum,
+                                const uint8_t *val, size_t val_len);
+
+/**
+ * @brief   Add a string option to a packet initialized with
+ *          coap_builder_init()
+ *
+ * Like coap_opt_add_string(), each part of @p string separated by
+ * @p separator is added as an option of its own.
+ *
+ * @param[in,out] pkt         pkt referencing target buffer
+ * @param[in]     optnum      option number to use
+ * @param[in]     string      string to encode as option
+ * @param[in]     separator   character used in @p string to separate parts
+ *
+ * @return        length of the option values
+ * @return        -ENOSPC if no space or no available options are left
+ */
+ssize_t coap_builder_add_string(coap_pkt_t *pkt, uint16_t optnum,
+                                const char *string, char separator);
+
+/**
+ * @brief   Add a uint option to a packet initialized with coap_builder_init()
+ *
+ * @param[in,out] pkt         pkt referencing target buffer
+ * @param[in]     optnum      option number to use
+ * @param[in]     value       uint to encode
+ *
+ * @return        length of the option value
+ * @return        -ENOSPC if no space or no available options are left
+ */
+ssize_t coap_builder_add_uint(coap_pkt_t *pkt, uint16_t optnum,
+                              uint32_t value);
+
+/**
+ * @brief   Encodes the options added with the builder in order and prepares
+ *          for payload
+ *
+ * @post pkt.payload advanced to first available byte after options
+ * @post pkt.payload_len is maximum bytes available for payload
+ *
+ * @param[in,out] pkt         pkt to update
+ * @param[in]     flags       see COAP_OPT_FINISH... macros
+ *
+ * @return        total number of bytes written to buffer
+ */
+ssize_t coap_builder_finish(coap_pkt_t *pkt, uint16_t flags);
+
 /**
  * @brief   Insert block2 option into buffer
  *
@@ -836,6 +976,121 @@ size_t coap_blockwise_put_char(coap_block_slicer_t *slicer, uint8_t *bufpos, cha
 size_t coap_blockwise_put_bytes(coap_block_slicer_t *slicer, uint8_t *bufpos,
                                 const uint8_t *c, size_t len);
 
+/**
+ * @brief   Initialize a Block1 (upload) transfer
+ *
+ * @param[out]  xfer        transfer to initialize
+ * @param[in]   data        data to send, must stay valid during the transfer
+ * @param[in]   len         length of @p data
+ * @param[in]   szx         szx value of the block size to start with
+ * @param[in]   window      maximum number of blocks in flight, at most
+ *                          COAP_BLOCK_XFER_WINDOW_MAX
+ */
+void coap_block1_xfer_init(coap_block_xfer_t *xfer, const uint8_t *data,
+                           size_t len, unsigned szx, unsigned window);
+
+/**
+ * @brief   Initialize a Block2 (download) transfer
+ *
+ * @param[out]  xfer        transfer to initialize
+ * @param[out]  buf         buffer for the received representation
+ * @param[in]   len         length of @p buf
+ * @param[in]   szx         szx value of the block size to start with
+ * @param[in]   window      maximum number of blocks in flight, at most
+ *                          COAP_BLOCK_XFER_WINDOW_MAX
+ */
+void coap_block2_xfer_init(coap_block_xfer_t *xfer, uint8_t *buf, size_t len,
+                           unsigned szx, unsigned window);
+
+/**
+ * @brief   Get the next block to request
+ *
+ * Marks the block as in flight on success.
+ *
+ * @param[in,out] xfer      transfer
+ * @param[out]    blknum    number of the block to request
+ *
+ * @returns     1 if a request for @p blknum should be sent
+ * @returns     0 if no further request can be sent before a response arrives
+ */
+int coap_block_xfer_next(coap_block_xfer_t *xfer, uint32_t *blknum);
+
+/**
+ * @brief   Check whether a transfer is complete
+ *
+ * @param[in]   xfer    transfer
+ *
+ * @returns     true if all blocks have been transferred
+ */
+static inline bool coap_block_xfer_complete(const coap_block_xfer_t *xfer)
+{
+    return (xfer->base > xfer->last);
+}
+
+/**
+ * @brief   Write the Block1 option and the payload of a block to a request
+ *
+ * The Block1 option must be the last option of the request. Options must have
+ * been added with the struct-based API.
+ *
+ * @param[in,out] pkt       request to finish
+ * @param[in]     xfer      transfer
+ * @param[in]     blknum    block to send, as returned by
+ *                          coap_block_xfer_next()
+ *
+ * @returns     total length of the request
+ * @returns     -ENOSPC if the block does not fit into @p pkt
+ */
+ssize_t coap_block1_xfer_finish(coap_pkt_t *pkt, const coap_block_xfer_t *xfer,
+                                uint32_t blknum);
+
+/**
+ * @brief   Add the Block2 option requesting a block to a request
+ *
+ * @param[in,out] pkt       request to add the option to
+ * @param[in]     xfer      transfer
+ * @param[in]     blknum    block to request, as returned by
+ *                          coap_block_xfer_next()
+ *
+ * @returns     number of bytes written to the buffer
+ */
+ssize_t coap_opt_add_block2_xfer(coap_pkt_t *pkt, const coap_block_xfer_t *xfer,
+                                 uint32_t blknum);
+
+/**
+ * @brief   Process the response to a Block1 request
+ *
+ * @param[in,out] xfer      transfer
+ * @param[in]     pkt       response
+ *
+ * @returns     1 if the transfer is complete
+ * @returns     0 if the transfer continues
+ * @returns     -EBADMSG if the response is not valid for the transfer
+ * @returns     -EPROTO if the server responded with an error, see
+ *              coap_get_code() of @p pkt
+ */
+int coap_block1_xfer_recv(coap_block_xfer_t *xfer, coap_pkt_t *pkt);
+
+/**
+ * @brief   Process the response to a Block2 request
+ *
+ * Copies the payload of the block into the buffer of the transfer. A 4.02
+ * (Bad Option) response to a block requested beyond the end of the
+ * representation only stops further requests.
+ *
+ * @param[in,out] xfer      transfer
+ * @param[in]     pkt       response
+ *
+ * @returns     1 if the transfer is complete, see _total_ of @p xfer for the
+ *              length of the representation
+ * @returns     0 if the transfer continues
+ * @returns     -EBADMSG if the response is not valid for the transfer
+ * @returns     -ENOBUFS if the representation does not fit into the buffer
+ * @returns     -EPROTO if the server responded with an error, see
+ *              coap_get_code() of @p pkt
+ */
+int coap_block2_xfer_recv(coap_block_xfer_t *xfer, coap_pkt_t *pkt);
+
 /**
  * @brief   Helper to decode SZX value to size in bytes
  *
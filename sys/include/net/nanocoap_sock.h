@@ -30,6 +30,14 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum window of nanocoap_get_blockwise() and
+ *          nanocoap_send_blockwise()
+ */
+#ifndef NANOCOAP_SOCK_BLOCK_WINDOW_MAX
+#define NANOCOAP_SOCK_BLOCK_WINDOW_MAX  (4U)
+#endif
+
 /**
  * @brief   Start a nanocoap server instance
  *
@@ -74,6 +82,53 @@ ssize_t nanocoap_get(sock_udp_ep_t *remote, const char *path, uint8_t *buf,
 ssize_t nanocoap_request(coap_pkt_t *pkt, sock_udp_ep_t *local,
                          sock_udp_ep_t *remote, size_t len);
 
+/**
+ * @brief   Synchronous block-wise CoAP (confirmable) get
+ *
+ * Keeps up to the window of @p xfer requests in flight, each of them is
+ * retransmitted on its own.
+ *
+ * @param[in]       remote  remote UDP endpoint
+ * @param[in]       path    remote path
+ * @param[in,out]   xfer    transfer initialized with coap_block2_xfer_init(),
+ *                          with a window of at most
+ *                          NANOCOAP_SOCK_BLOCK_WINDOW_MAX
+ * @param[in]       buf     buffer for requests and responses
+ * @param[in]       len     length of @p buf, must fit a block plus headers
+ *
+ * @returns     length of the received representation on success
+ * @returns     negative CoAP response code if the server responded with an
+ *              error
+ * @returns     <0 on other errors
+ */
+ssize_t nanocoap_get_blockwise(sock_udp_ep_t *remote, const char *path,
+                               coap_block_xfer_t *xfer, uint8_t *buf,
+                               size_t len);
+
+/**
+ * @brief   Synchronous block-wise CoAP (confirmable) upload
+ *
+ * Keeps up to the window of @p xfer requests in flight, each of them is
+ * retransmitted on its own.
+ *
+ * @param[in]       remote  remote UDP endpoint
+ * @param[in]       method  request method, e.g. COAP_METHOD_PUT
+ * @param[in]       path    remote path
+ * @param[in,out]   xfer    transfer initialized with coap_block1_xfer_init(),
+ *                          with a window of at most
+ *                          NANOCOAP_SOCK_BLOCK_WINDOW_MAX
+ * @param[in]       buf     buffer for requests and responses
+ * @param[in]       len     length of @p buf, must fit a block plus headers
+ *
+ * @returns     CoAP response code to the last block on success
+ * @returns     negative CoAP response code if the server responded with an
+ *              error
+ * @returns     <0 on other errors
+ */
+ssize_t nanocoap_send_blockwise(sock_udp_ep_t *remote, unsigned method,
+                                const char *path, coap_block_xfer_t *xfer,
+                                uint8_t *buf, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_netcap Packet capture
+ * @ingroup     net
+ * @brief       Streams raw frames of network devices to a host in pcapng
+ *              format
+ *
+ * Unlike @ref net_gnrc_pktdump, this module does not format anything on the
+ * node. It wraps the `send()` and `recv()` functions of a @ref netdev_t and
+ * copies every frame, together with a time stamp, the direction and the
+ * interface, as a pcapng Enhanced Packet Block into a ring buffer. A low
+ * priority thread streams the ring buffer to the host, where it can be read by
+ * Wireshark directly, e.g.
+ *
+ *     socat /dev/ttyACM1,raw,b115200 - | wireshark -k -i -
+ *
+ * With GNRC, all interfaces are captured automatically. Other stacks need to
+ * call @ref netcap_add for each device before it is initialized.
+ *
+ * The stream is written with `stdio_write()` by default, so it goes to
+ * whatever @ref sys_stdio backend is used (UART, `stdio_rtt`, `stdio_cdc_acm`
+ * or `stdio_ethos`). Nothing else may print to stdio in that case. With the
+ * `netcap_uart` module, the stream goes to the dedicated UART
+ * @ref NETCAP_UART_DEV instead.
+ *
+ * Frames that do not fit into the ring buffer are dropped and counted, the
+ * network stack itself is never blocked by the capture.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Packet capture interface
+ */
+#ifndef NET_NETCAP_H
+#define NET_NETCAP_H
+
+#include <stdint.h>
+
+#include "net/netdev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the capture ring buffer, must be a power of two
+ */
+#ifndef NETCAP_BUF_SIZE
+#define NETCAP_BUF_SIZE         (4096U)
+#endif
+
+/**
+ * @brief   Maximum number of bytes captured per frame
+ */
+#ifndef NETCAP_SNAPLEN
+#define NETCAP_SNAPLEN          (256U)
+#endif
+
+/**
+ * @brief   Maximum number of captured devices
+ */
+#ifndef NETCAP_DEV_NUMOF
+#define NETCAP_DEV_NUMOF        (2U)
+#endif
+
+/**
+ * @brief   Priority of the streaming thread
+ */
+#ifndef NETCAP_PRIO
+#define NETCAP_PRIO             (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Stack size of the streaming thread
+ */
+#ifndef NETCAP_STACKSIZE
+#define NETCAP_STACKSIZE        (THREAD_STACKSIZE_SMALL)
+#endif
+
+#if defined(MODULE_NETCAP_UART) || defined(DOXYGEN)
+/**
+ * @brief   UART to stream to with the `netcap_uart` module
+ */
+#ifndef NETCAP_UART_DEV
+#define NETCAP_UART_DEV         UART_DEV(1)
+#endif
+
+/**
+ * @brief   Baudrate of @ref NETCAP_UART_DEV
+ */
+#ifndef NETCAP_UART_BAUDRATE
+#define NETCAP_UART_BAUDRATE    (921600U)
+#endif
+#endif
+
+/**
+ * @brief   Initialize the capture and start the streaming thread
+ *
+ * Called by auto_init.
+ */
+void netcap_init(void);
+
+/**
+ * @brief   Capture the frames of a network device
+ *
+ * Must be called before the device is used, i.e. before its `init()`
+ * function runs.
+ *
+ * @param[in,out] dev   device to capture
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if @ref NETCAP_DEV_NUMOF devices are captured already
+ */
+int netcap_add(netdev_t *dev);
+
+/**
+ * @brief   Get the number of frames dropped because the ring buffer was full
+ *
+ * @return  number of dropped frames
+ */
+uint32_t netcap_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_NETCAP_H */
+/** @} */
@@ -557,6 +557,29 @@ typedef enum {
      */
     NETOPT_PHY_BUSY,
 
+    /**
+     * @brief   (uint16_t) size of a buffer that can hold any received frame
+     *
+     * A device that provides this option (get only) can receive a frame
+     * with a single call to @ref netdev_driver_t::recv "recv()" into a buffer
+     * of the returned size, i.e. without requesting the length of the frame
+     * first. This allows a network stack to reserve the buffer in advance and
+     * have the driver burst the frame directly into it.
+     *
+     * Devices that need the length request return `-ENOTSUP`.
+     */
+    NETOPT_RX_PREALLOC,
+
+    /**
+     * @brief   (@ref netopt_enable_t) link layer filter enforced by hardware
+     *
+     * Get only. Returns @ref NETOPT_ENABLE when the device applies its
+     * current @ref NETOPT_L2FILTER list in hardware, so frames that do not
+     * pass never reach the host. Devices without hardware filters return
+     * `-ENOTSUP`.
+     */
+    NETOPT_L2FILTER_HW,
+
     /* add more options if needed */
 
     /**
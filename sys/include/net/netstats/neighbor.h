@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_netstats_neighbor Per neighbor link statistics
+ * @ingroup     net_netstats
+ * @brief       Records the transmission results per link layer neighbor
+ *
+ * This module keeps a small table of link layer neighbors for every network
+ * device and estimates the expected transmission count (ETX) for each of them
+ * from the link layer acknowledgements, e.g. as input for the RPL MRHOF
+ * objective function.
+ *
+ * The network stack announces the destination of every frame it hands to the
+ * device via netstats_nb_record() and reports the outcome reported by the
+ * device via netstats_nb_update_tx(). Received frames update the signal
+ * quality of their sender via netstats_nb_update_rx(). As with
+ * @ref net_l2filter, the memory for the table is allocated centrally in the
+ * netdev_t type. The table of an interface can be retrieved with
+ * @ref NETOPT_STATS and @ref NETSTATS_NEIGHBOR as context.
+ *
+ * Use it by adding
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += netstats_neighbor
+ * ~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * to your application's Makefile.
+ *
+ * @{
+ * @file
+ * @brief       Per neighbor link statistics definitions
+ */
+
+#ifndef NET_NETSTATS_NEIGHBOR_H
+#define NET_NETSTATS_NEIGHBOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximal length of link layer addresses stored in the table
+ */
+#ifndef NETSTATS_NB_L2ADDR_MAXLEN
+#define NETSTATS_NB_L2ADDR_MAXLEN       (8U)
+#endif
+
+/**
+ * @brief   Number of neighbors tracked per device
+ */
+#ifndef NETSTATS_NB_SIZE
+#define NETSTATS_NB_SIZE                (8U)
+#endif
+
+/**
+ * @brief   Fixed point divisor of netstats_nb_t::etx
+ *
+ * An ETX of 1.0 is represented as NETSTATS_NB_ETX_DIVISOR. The value matches
+ * the unit used by RPL for the ETX metric (see RFC 6551, section 4.3.2).
+ */
+#define NETSTATS_NB_ETX_DIVISOR         (128U)
+
+/**
+ * @brief   ETX assumed for neighbors without any transmissions yet, as a
+ *          multiple of @ref NETSTATS_NB_ETX_DIVISOR
+ */
+#ifndef NETSTATS_NB_ETX_INIT
+#define NETSTATS_NB_ETX_INIT            (2U)
+#endif
+
+/**
+ * @brief   ETX sample used for a frame that was never acknowledged, as a
+ *          multiple of @ref NETSTATS_NB_ETX_DIVISOR
+ */
+#ifndef NETSTATS_NB_ETX_NOACK_PENALTY
+#define NETSTATS_NB_ETX_NOACK_PENALTY   (6U)
+#endif
+
+/**
+ * @brief   Weight of a new sample in the moving averages of the ETX, RSSI and
+ *          LQI, in 1/@ref NETSTATS_NB_EWMA_SCALE
+ */
+#ifndef NETSTATS_NB_EWMA_ALPHA
+#define NETSTATS_NB_EWMA_ALPHA          (15U)
+#endif
+
+/**
+ * @brief   Scale of @ref NETSTATS_NB_EWMA_ALPHA
+ */
+#define NETSTATS_NB_EWMA_SCALE          (100U)
+
+/**
+ * @brief   Transmission results
+ */
+typedef enum {
+    NETSTATS_NB_SUCCESS = 0,    /**< frame was acknowledged */
+    NETSTATS_NB_NOACK,          /**< frame was not acknowledged */
+    NETSTATS_NB_BUSY,           /**< medium was busy, frame was not sent */
+} netstats_nb_result_t;
+
+/**
+ * @brief   Statistics of a single neighbor
+ */
+typedef struct {
+    uint8_t l2_addr[NETSTATS_NB_L2ADDR_MAXLEN]; /**< link layer address */
+    uint8_t l2_addr_len;    /**< length of netstats_nb_t::l2_addr, 0 if unused */
+    uint16_t etx;           /**< ETX in 1/@ref NETSTATS_NB_ETX_DIVISOR */
+    uint16_t tx_count;      /**< number of frames sent to the neighbor */
+    uint16_t tx_attempts;   /**< number of transmissions of these frames,
+                             *   including retransmissions */
+    uint16_t tx_failed;     /**< number of frames not acknowledged */
+    uint16_t rx_count;      /**< number of frames received from the neighbor */
+    int16_t rssi;           /**< moving average of the RSSI in dBm */
+    uint8_t lqi;            /**< moving average of the LQI */
+    uint16_t last_used;     /**< value of netstats_nb_table_t::use_counter
+                             *   when the neighbor was last used */
+    uint32_t last_heard;    /**< system time in ms when the last frame was
+                             *   received from the neighbor */
+} netstats_nb_t;
+
+/**
+ * @brief   Neighbor table of a device
+ */
+typedef struct {
+    netstats_nb_t entries[NETSTATS_NB_SIZE];    /**< the neighbors */
+    netstats_nb_t *pending;     /**< destination of the frame currently in
+                                 *   transmission, NULL for multicast */
+    uint16_t use_counter;       /**< counter to find the least recently used
+                                 *   neighbor */
+} netstats_nb_table_t;
+
+/**
+ * @brief   Initializes a neighbor table
+ *
+ * @param[out] table    the table
+ *
+ * @pre     @p table != NULL
+ */
+void netstats_nb_init(netstats_nb_table_t *table);
+
+/**
+ * @brief   Records the destination of the frame that is about to be sent
+ *
+ * If @p l2_addr is not yet in @p table, the least recently used neighbor is
+ * replaced.
+ *
+ * @param[in,out] table     the table
+ * @param[in] l2_addr       link layer destination of the frame, NULL for
+ *                          multicast or broadcast frames
+ * @param[in] l2_addr_len   length of @p l2_addr
+ *
+ * @pre     @p table != NULL
+ * @pre     @p l2_addr_len <= @ref NETSTATS_NB_L2ADDR_MAXLEN
+ *
+ * @return  the statistics of @p l2_addr
+ * @return  NULL for multicast or broadcast frames
+ */
+netstats_nb_t *netstats_nb_record(netstats_nb_table_t *table,
+                                  const uint8_t *l2_addr, size_t l2_addr_len);
+
+/**
+ * @brief   Updates the statistics of the recorded destination with the
+ *          result of the transmission
+ *
+ * @param[in,out] table         the table
+ * @param[in] result            result of the transmission
+ * @param[in] transmissions     number of transmissions of the frame
+ *                              (including retransmissions), 0 if unknown
+ *
+ * @pre     @p table != NULL
+ *
+ * @return  the updated statistics
+ * @return  NULL if no destination was recorded
+ */
+netstats_nb_t *netstats_nb_update_tx(netstats_nb_table_t *table,
+                                     netstats_nb_result_t result,
+                                     unsigned transmissions);
+
+/**
+ * @brief   Updates the statistics of the sender of a received frame
+ *
+ * If @p l2_addr is not yet in @p table, the least recently used neighbor is
+ * replaced.
+ *
+ * @param[in,out] table     the table
+ * @param[in] l2_addr       link layer source of the frame
+ * @param[in] l2_addr_len   length of @p l2_addr
+ * @param[in] rssi          RSSI of the frame in dBm
+ * @param[in] lqi           LQI of the frame
+ *
+ * @pre     @p table != NULL
+ * @pre     @p l2_addr_len <= @ref NETSTATS_NB_L2ADDR_MAXLEN
+ *
+ * @return  the updated statistics
+ * @return  NULL if @p l2_addr is empty
+ */
+netstats_nb_t *netstats_nb_update_rx(netstats_nb_table_t *table,
+                                     const uint8_t *l2_addr, size_t l2_addr_len,
+                                     int16_t rssi, uint8_t lqi);
+
+/**
+ * @brief   Gets the statistics of a neighbor
+ *
+ * @param[in] table         the table
+ * @param[in] l2_addr       link layer address of the neighbor
+ * @param[in] l2_addr_len   length of @p l2_addr
+ *
+ * @pre     @p table != NULL
+ * @pre     @p l2_addr != NULL
+ *
+ * @return  the statistics of @p l2_addr
+ * @return  NULL if @p l2_addr is not in @p table
+ */
+const netstats_nb_t *netstats_nb_get(const netstats_nb_table_t *table,
+                                     const uint8_t *l2_addr,
+                                     size_t l2_addr_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_NETSTATS_NEIGHBOR_H */
+/** @} */
@@ -23,6 +23,11 @@
  *   `CFLAGS+=-DSKALD_INTERVAL=xxx`
  * - advertising channels are configured during compile time, override by
  *   setting `CFLAGS+=-DSKALD_ADV_CHAN={37,39}`
+ * - several payloads can share the advertising events of one context (see
+ *   skald_adv_add()), so the radio wakes up only once per interval for all
+ *   of them
+ * - legacy advertising PDUs only, the supported radios can't do extended
+ *   advertising
  *
  * # Implementation state
  * Supported:
@@ -78,11 +83,14 @@ typedef struct {
 /**
  * @brief   Advertising context holding the advertising data and state
  */
-typedef struct {
+typedef struct skald_ctx {
     netdev_ble_pkt_t pkt;   /**< packet holding the advertisement (GAP) data */
     xtimer_t timer;         /**< timer for scheduling advertising events */
     uint32_t last;          /**< last timer trigger (for offset compensation) */
     uint8_t cur_chan;       /**< keep track of advertising channels */
+    struct skald_ctx *next; /**< next context sent in the same events */
+    struct skald_ctx *cur;  /**< context currently sent in this event */
+    const netdev_ble_pkt_t *update; /**< packet to apply at the next event */
 } skald_ctx_t;
 
 /**
@@ -107,6 +115,40 @@ void skald_adv_start(skald_ctx_t *ctx);
  */
 void skald_adv_stop(skald_ctx_t *ctx);
 
+/**
+ * @brief   Send the packet of @p member in each advertising event of @p ctx
+ *
+ * All packets are sent back-to-back on each advertising channel, so they take
+ * a single radio wakeup per interval. If @p member was advertising on its own,
+ * this is stopped.
+ *
+ * @param[in,out] ctx       advertising context to add @p member to
+ * @param[in,out] member    context holding the packet to add
+ */
+void skald_adv_add(skald_ctx_t *ctx, skald_ctx_t *member);
+
+/**
+ * @brief   Stop sending the packet of @p member in the events of @p ctx
+ *
+ * @param[in,out] ctx       advertising context @p member was added to
+ * @param[in,out] member    context to remove
+ */
+void skald_adv_remove(skald_ctx_t *ctx, skald_ctx_t *member);
+
+/**
+ * @brief   Replace the packet of a context without restarting advertising
+ *
+ * The new packet is copied into @p ctx at the start of the next advertising
+ * event, so a single event never mixes old and new payload and the
+ * advertising interval keeps running.
+ *
+ * @param[in,out] ctx   context to update, may be advertising or added to
+ *                      another context
+ * @param[in] pkt       new packet (only length and PDU are used), must stay
+ *                      valid until it was applied
+ */
+void skald_adv_update(skald_ctx_t *ctx, const netdev_ble_pkt_t *pkt);
+
 /**
  * @brief   Generate a random public address
  *
@@ -11,6 +11,15 @@
  * @defgroup    net_sntp Simple Network Time Protocol
  * @ingroup     net
  * @brief       Simple Network Time Protocol (SNTP) implementation
+ *
+ * With module `sntp_discipline`, the offsets and round-trip delays of the
+ * last @ref SNTP_DISCIPLINE_SAMPLES synchronizations are kept to estimate
+ * the frequency error of the local clock. Samples with a much larger delay
+ * than the fastest exchange and samples far off the fitted line are
+ * rejected. sntp_get_offset() and sntp_get_unix_usec() correct the
+ * estimated drift continuously, so synchronizations can be hours apart
+ * instead of minutes.
+ *
  * @{
  *
  * @file
@@ -34,6 +43,44 @@
 extern "C" {
 #endif
 
+/**
+ * @name    Clock discipline configuration (module `sntp_discipline`)
+ * @{
+ */
+/**
+ * @brief   Number of synchronizations used to estimate the drift
+ */
+#ifndef SNTP_DISCIPLINE_SAMPLES
+#define SNTP_DISCIPLINE_SAMPLES         (8U)
+#endif
+
+/**
+ * @brief   Minimum time between the samples to estimate the drift in
+ *          microseconds
+ */
+#ifndef SNTP_DISCIPLINE_MIN_SPAN
+#define SNTP_DISCIPLINE_MIN_SPAN        (60U * US_PER_SEC)
+#endif
+
+/**
+ * @brief   Tolerance for the delay and offset of a sample in microseconds
+ *
+ * A sample is rejected if its round-trip delay exceeds twice the smallest
+ * delay plus this margin, or if it is further off the fitted line than
+ * three times the mean deviation plus this margin.
+ */
+#ifndef SNTP_DISCIPLINE_DELAY_MARGIN
+#define SNTP_DISCIPLINE_DELAY_MARGIN    (10U * US_PER_MS)
+#endif
+
+/**
+ * @brief   Largest drift estimate accepted in ppb
+ */
+#ifndef SNTP_DISCIPLINE_MAX_DRIFT
+#define SNTP_DISCIPLINE_MAX_DRIFT       (500000L)
+#endif
+/** @} */
+
 /**
  * @brief Synchronize with time server
  *
@@ -48,10 +95,22 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout);
 /**
  * @brief Get real time offset from system time as returned by @ref xtimer_now64()
  *
+ * With module `sntp_discipline` the offset is corrected by the estimated
+ * drift since the last synchronization.
+ *
  * @return Real time offset in microseconds relative to 1900-01-01 00:00 UTC
  */
 int64_t sntp_get_offset(void);
 
+#if defined(MODULE_SNTP_DISCIPLINE) || defined(DOXYGEN)
+/**
+ * @brief   Get the estimated frequency error of the local clock
+ *
+ * @return  Drift in ppb, positive if the local clock is slow
+ */
+int32_t sntp_get_drift(void);
+#endif
+
 /**
  * @brief   Get time in microseconds from 1970-01-01 00:00:00 UTC.
  *
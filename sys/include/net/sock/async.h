@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sock_async  Sock extension for asynchronous access
+ * @ingroup     net_sock
+ *
+ * @brief       Provides backend functionality for asynchronous sock access.
+ *
+ * The regular sock API is blocking, so every protocol implementation on top
+ * of it needs its own thread. With this extension a stack informs the user
+ * of a sock about events (e.g. a received message) via a callback, so
+ * several socks can be served by a single thread.
+ *
+ * Use it by adding
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += sock_async
+ * ~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * to your application's Makefile.
+ *
+ * @warning The callbacks are called from within the context of the network
+ *          stack (e.g. its thread or an interrupt). Keep them short and
+ *          defer calls to the sock API to another thread. See
+ *          @ref net_sock_async_event for a front-end that does that for you
+ *          using @ref sys_event.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Definitions for asynchronous sock
+ */
+#ifndef NET_SOCK_ASYNC_H
+#define NET_SOCK_ASYNC_H
+
+#include "net/sock/async_types.h"
+#include "net/sock/ip.h"
+#include "net/sock/udp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sets the asynchronous callback of a raw IPv4/IPv6 sock
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @note    Only available with module `sock_async` and a stack that
+ *          provides `sock_ip`.
+ *
+ * @param[in] sock      A raw IPv4/IPv6 sock object.
+ * @param[in] cb        An event callback. May be NULL to unset the callback.
+ * @param[in] cb_arg    Argument to provide to @p cb. May be NULL.
+ */
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *cb_arg);
+
+/**
+ * @brief   Sets the asynchronous callback of a UDP sock
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @note    Only available with module `sock_async` and a stack that
+ *          provides `sock_udp`.
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] cb        An event callback. May be NULL to unset the callback.
+ * @param[in] cb_arg    Argument to provide to @p cb. May be NULL.
+ */
+void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *cb_arg);
+
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Gets the asynchronous event context from an IP sock object
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @note    Only available with module `sock_async_event`. Provided by the
+ *          stack.
+ *
+ * @param[in] sock  A raw IPv4/IPv6 sock object.
+ *
+ * @return  The asynchronous event context of @p sock
+ */
+sock_async_ctx_t *sock_ip_get_async_ctx(sock_ip_t *sock);
+
+/**
+ * @brief   Gets the asynchronous event context from a UDP sock object
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @note    Only available with module `sock_async_event`. Provided by the
+ *          stack.
+ *
+ * @param[in] sock  A UDP sock object.
+ *
+ * @return  The asynchronous event context of @p sock
+ */
+sock_async_ctx_t *sock_udp_get_async_ctx(sock_udp_t *sock);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_H */
+/** @} */
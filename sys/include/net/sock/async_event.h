@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sock_async_event    Asynchronous sock with event API
+ * @ingroup     net_sock_async
+ * @brief       Provides an implementation of asynchronous sock for
+ *              @ref sys_event
+ *
+ * This allows several application protocols to share one thread: each sock
+ * is attached to an @ref event_queue_t and its handler is called from the
+ * thread that runs the queue whenever something happened on the sock.
+ *
+ * How To Use
+ * ----------
+ *
+ * You need to include at least one module that implements a sock API (e.g.
+ * `gnrc_sock_udp` and `gnrc_ipv6` for the GNRC network stack) and the module
+ * `sock_async_event` in your application's Makefile.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * #include "event.h"
+ * #include "net/sock/udp.h"
+ * #include "net/sock/async_event.h"
+ *
+ * static event_queue_t queue;
+ * static uint8_t buf[128];
+ *
+ * void handler(sock_udp_t *sock, sock_async_flags_t type, void *arg)
+ * {
+ *     (void)arg;
+ *     if (type & SOCK_ASYNC_MSG_RECV) {
+ *         sock_udp_ep_t remote;
+ *         ssize_t res;
+ *
+ *         while ((res = sock_udp_recv(sock, buf, sizeof(buf), 0,
+ *                                     &remote)) >= 0) {
+ *             sock_udp_send(sock, buf, res, &remote);
+ *         }
+ *     }
+ * }
+ *
+ * int main(void)
+ * {
+ *     sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+ *     sock_udp_t sock;
+ *
+ *     local.port = 12345;
+ *
+ *     if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+ *         puts("Error creating UDP sock");
+ *         return 1;
+ *     }
+ *
+ *     event_queue_init(&queue);
+ *     sock_udp_event_init(&sock, &queue, handler, NULL);
+ *     event_loop(&queue);
+ *     return 0;
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Note that the handler only learns that at least one message was received.
+ * As several events may be coalesced into one call, it should read from the
+ * sock with a timeout of 0 until no message is left.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Asynchronous sock using @ref sys_event definitions
+ */
+#ifndef NET_SOCK_ASYNC_EVENT_H
+#define NET_SOCK_ASYNC_EVENT_H
+
+#include "event.h"
+#include "net/sock/async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Makes a raw IPv4/IPv6 sock able to handle asynchronous events
+ *          using @ref sys_event
+ *
+ * @pre `(sock != NULL) && (ev_queue != NULL) && (handler != NULL)`
+ *
+ * @param[in] sock          A raw IPv4/IPv6 sock object.
+ * @param[in] ev_queue      The queue the events on @p sock will be added to.
+ * @param[in] handler       The event handler function to call on an event on
+ *                          @p sock.
+ * @param[in] handler_arg   Argument to provide to @p handler. May be NULL.
+ *
+ * @note    Only available with module `sock_ip`.
+ */
+void sock_ip_event_init(sock_ip_t *sock, event_queue_t *ev_queue,
+                        sock_ip_cb_t handler, void *handler_arg);
+
+/**
+ * @brief   Makes a UDP sock able to handle asynchronous events using
+ *          @ref sys_event
+ *
+ * @pre `(sock != NULL) && (ev_queue != NULL) && (handler != NULL)`
+ *
+ * @param[in] sock          A UDP sock object.
+ * @param[in] ev_queue      The queue the events on @p sock will be added to.
+ * @param[in] handler       The event handler function to call on an event on
+ *                          @p sock.
+ * @param[in] handler_arg   Argument to provide to @p handler. May be NULL.
+ *
+ * @note    Only available with module `sock_udp`.
+ */
+void sock_udp_event_init(sock_udp_t *sock, event_queue_t *ev_queue,
+                         sock_udp_cb_t handler, void *handler_arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_EVENT_H */
+/** @} */
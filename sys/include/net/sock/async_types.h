@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_sock_async
+ * @{
+ *
+ * @file
+ * @brief       Type definitions for asynchronous sock
+ *
+ * This header only provides types and can thus be included by the stack
+ * specific `sock_types.h` without creating a circular dependency.
+ */
+#ifndef NET_SOCK_ASYNC_TYPES_H
+#define NET_SOCK_ASYNC_TYPES_H
+
+#ifdef MODULE_SOCK_ASYNC_EVENT
+#include "event.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Flags for asynchronous sock events
+ *
+ * @note    The values can be combined into a bit field, so a callback may be
+ *          informed about several events with one call.
+ */
+typedef enum {
+    SOCK_ASYNC_MSG_RECV = 0x01,     /**< message received on the sock */
+    SOCK_ASYNC_MSG_SENT = 0x02,     /**< message was sent on the sock */
+} sock_async_flags_t;
+
+struct sock_ip;     /* forward declaration, see @ref sock_ip_t */
+struct sock_udp;    /* forward declaration, see @ref sock_udp_t */
+
+/**
+ * @brief   Event callback for @ref sock_ip_t
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @note    Only available with module `sock_async`.
+ *
+ * @param[in] sock  The sock the event happened on
+ * @param[in] flags The event flags. Expected values are
+ *                  - @ref SOCK_ASYNC_MSG_RECV,
+ *                  - @ref SOCK_ASYNC_MSG_SENT
+ * @param[in] arg   Argument provided when setting the callback using
+ *                  @ref sock_ip_set_cb(). May be NULL.
+ */
+typedef void (*sock_ip_cb_t)(struct sock_ip *sock, sock_async_flags_t flags,
+                             void *arg);
+
+/**
+ * @brief   Event callback for @ref sock_udp_t
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @note    Only available with module `sock_async`.
+ *
+ * @param[in] sock  The sock the event happened on
+ * @param[in] flags The event flags. Expected values are
+ *                  - @ref SOCK_ASYNC_MSG_RECV,
+ *                  - @ref SOCK_ASYNC_MSG_SENT
+ * @param[in] arg   Argument provided when setting the callback using
+ *                  @ref sock_udp_set_cb(). May be NULL.
+ */
+typedef void (*sock_udp_cb_t)(struct sock_udp *sock, sock_async_flags_t flags,
+                              void *arg);
+
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Event definition for @ref net_sock_async_event
+ *
+ * @note    Only available with module `sock_async_event`.
+ */
+typedef struct {
+    event_t super;                  /**< event structure that gets extended */
+    union {
+        struct sock_ip *ip;         /**< IP sock the event happened on */
+        struct sock_udp *udp;       /**< UDP sock the event happened on */
+    } sock;                         /**< sock the event happened on */
+    union {
+        sock_ip_cb_t ip;            /**< handler for IP socks */
+        sock_udp_cb_t udp;          /**< handler for UDP socks */
+    } cb;                           /**< handler to call from the event queue */
+    void *cb_arg;                   /**< argument for the handler */
+    unsigned flags;                 /**< pending event flags */
+} sock_event_t;
+
+/**
+ * @brief   Asynchronous context for @ref net_sock_async_event
+ *
+ * @note    Only available with module `sock_async_event`. Stacks embed this
+ *          into their sock types.
+ */
+typedef struct {
+    sock_event_t event;             /**< event storage */
+    event_queue_t *queue;           /**< event queue to post the event to */
+} sock_async_ctx_t;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_TYPES_H */
+/** @} */
@@ -12,6 +12,13 @@
  *
  * @brief       Sock DNS client
  *
+ * With the `sock_dns_cache` module, answers received by @ref sock_dns_query
+ * are kept in a small cache for as long as their TTL permits (capped to
+ * @ref SOCK_DNS_CACHE_TTL_MAX). A reply stating that a name has no record of
+ * the requested type is cached as well, for @ref SOCK_DNS_CACHE_NEG_TTL
+ * seconds. AAAA and A answers of a name are cached independently. If the
+ * cache is full, the entry closest to expiry is replaced.
+ *
  * @{
  *
  * @file
@@ -61,6 +68,32 @@ typedef struct {
 #define SOCK_DNS_QUERYBUF_LEN   (sizeof(sock_dns_hdr_t) + 4 + SOCK_DNS_MAX_NAME_LEN)
 /** @} */
 
+/**
+ * @name DNS cache configuration
+ * @{
+ */
+/**
+ * @brief   Number of names kept in the DNS cache
+ */
+#ifndef SOCK_DNS_CACHE_SIZE
+#define SOCK_DNS_CACHE_SIZE     (4U)
+#endif
+
+/**
+ * @brief   Time in seconds a negative answer is cached
+ */
+#ifndef SOCK_DNS_CACHE_NEG_TTL
+#define SOCK_DNS_CACHE_NEG_TTL  (60U)
+#endif
+
+/**
+ * @brief   Upper bound in seconds for the TTL of cached answers
+ */
+#ifndef SOCK_DNS_CACHE_TTL_MAX
+#define SOCK_DNS_CACHE_TTL_MAX  (86400UL)
+#endif
+/** @} */
+
 /**
  * @brief Get IP address for DNS name
  *
@@ -80,11 +113,18 @@ typedef struct {
  * @param[out]  addr_out        buffer to write result into
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
- * @return      0 on success
- * @return      !=0 otherwise
+ * @return      length of the address written to @p addr_out on success
+ * @return      <0 otherwise
  */
 int sock_dns_query(const char *domain_name, void *addr_out, int family);
 
+/**
+ * @brief Drop all entries from the DNS cache
+ *
+ * @note Only available with the `sock_dns_cache` module.
+ */
+void sock_dns_cache_flush(void);
+
 /**
  * @brief global DNS server endpoint
  */
@@ -506,6 +506,49 @@ int sock_tcp_accept(sock_tcp_queue_t *queue, sock_tcp_t **sock,
 ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
                       uint32_t timeout);
 
+/**
+ * @brief   Reads data from an established TCP stream without copying it
+ *
+ * Instead of copying the data into a user buffer, @p data is pointed into the
+ * network stack's own buffer. Only the contiguous chunk at the current read
+ * position is returned, so the function may return less data than
+ * sock_tcp_read() would. Reading with sock_tcp_read() and this function may be
+ * mixed freely.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * void *data;
+ * ssize_t res;
+ *
+ * while ((res = sock_tcp_read_buf(&sock, &data, SOCK_NO_TIMEOUT)) > 0) {
+ *     handle_chunk(data, res);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @pre `(sock != NULL) && (data != NULL)`
+ *
+ * @param[in] sock      A TCP sock object.
+ * @param[out] data     Pointer to the chunk of read data. Valid until the
+ *                      next read from or disconnect of @p sock.
+ * @param[in] timeout   Timeout for receive in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @note    Function may block.
+ *
+ * @return  The number of bytes at @p data on success.
+ * @return  0, if no read data is available, but everything is in order.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -ECONNABORTED, if the connection is aborted while waiting for the
+ *          next data.
+ * @return  -ECONNRESET, if the connection was forcibly closed by remote end
+ *          point of @p sock.
+ * @return  -ENOTCONN, when @p sock is not connected to a remote end point.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+ssize_t sock_tcp_read_buf(sock_tcp_t *sock, void **data, uint32_t timeout);
+
 /**
  * @brief   Writes data to an established TCP stream
  *
@@ -289,6 +289,21 @@ typedef struct _sock_tl_ep sock_udp_ep_t;   /**< An end point for a UDP sock obj
  */
 typedef struct sock_udp sock_udp_t;
 
+/**
+ * @brief   A UDP message for sock_udp_send_batch()
+ */
+typedef struct {
+    const void *data;               /**< payload, may be `NULL` if `len == 0` */
+    size_t len;                     /**< length of sock_udp_msg_t::data */
+    /**
+     * @brief   remote end point of the message
+     *
+     * May be `NULL`, if the sock has a remote end point. See the @p remote
+     * parameter of sock_udp_send().
+     */
+    const sock_udp_ep_t *remote;
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -402,6 +417,69 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *ep);
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote);
 
+/**
+ * @brief   Receives a UDP message from a remote end point without copying it
+ *
+ * Instead of copying the payload into a user buffer, @p data is pointed into
+ * the network stack's own buffer. The stack may deliver a message in several
+ * chunks, so the function must be called repeatedly with the same @p buf_ctx
+ * until it returns 0. This also releases the stack's buffer. To stop early,
+ * release it with sock_udp_recv_buf_free() instead.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * void *data, *ctx = NULL;
+ * ssize_t res;
+ *
+ * while ((res = sock_udp_recv_buf(&sock, &data, &ctx, SOCK_NO_TIMEOUT,
+ *                                 NULL)) > 0) {
+ *     handle_chunk(data, res);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @pre `(sock != NULL) && (data != NULL) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock          A UDP sock object.
+ * @param[out] data         Pointer to the current chunk of the received data.
+ *                          Valid until the next call with @p buf_ctx.
+ * @param[in,out] buf_ctx   Stack internal buffer context. Must be `NULL`
+ *                          before receiving a new message.
+ * @param[in] timeout       Timeout for receive in microseconds.
+ *                          If 0 and no data is available, the function returns
+ *                          immediately.
+ *                          May be @ref SOCK_NO_TIMEOUT for no timeout (wait
+ *                          until data is available).
+ * @param[out] remote       Remote end point of the received data.
+ *                          May be `NULL`, if it is not required by the
+ *                          application.
+ *
+ * @note    Function blocks if no packet is currently waiting.
+ *
+ * @return  The number of bytes in the current chunk on success.
+ * @return  0, if all chunks were handed out. The buffer was released and
+ *          @p buf_ctx is `NULL` again.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p remote is invalid or @p sock is not properly
+ *          initialized (or closed while sock_udp_recv_buf() blocks).
+ * @return  -ENOMEM, if no memory was available to receive @p data.
+ * @return  -EPROTO, if source address of received packet did not equal
+ *          the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote);
+
+/**
+ * @brief   Releases a message received with sock_udp_recv_buf()
+ *
+ * Only needed if not all chunks of the message were fetched. Does nothing if
+ * @p buf_ctx is `NULL`.
+ *
+ * @param[in] sock          The UDP sock object the message was received with.
+ * @param[in] buf_ctx       Buffer context set by sock_udp_recv_buf().
+ */
+void sock_udp_recv_buf_free(sock_udp_t *sock, void *buf_ctx);
+
 /**
  * @brief   Sends a UDP message to remote end point
  *
@@ -438,6 +516,34 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote);
 
+/**
+ * @brief   Sends several UDP messages in one call
+ *
+ * Semantically this is the same as calling sock_udp_send() for every message
+ * in @p msgs, but the implementation may build the messages in one go and
+ * hand them to the network stack at once (e.g. GNRC does so when the module
+ * `gnrc_netapi_batch` is used), which reduces the overhead per message for
+ * applications that send many small datagrams back to back.
+ *
+ * The messages are sent in order. Sending stops at the first message that
+ * fails.
+ *
+ * @pre `(numof == 0) || (msgs != NULL)`
+ * @pre For every message the preconditions of sock_udp_send() apply.
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`, if all messages
+ *                      have a remote end point.
+ * @param[in] msgs      The messages to send.
+ * @param[in] numof     Number of messages in @p msgs.
+ *
+ * @return  The number of messages sent. May be less than @p numof if sending
+ *          a message failed.
+ * @return  The error of the first message, as for sock_udp_send(), if no
+ *          message was sent.
+ */
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned numof);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
@@ -23,6 +23,15 @@
  * - if a mode is blocked, so are implicitly all lower modes
  * - the idle thread automatically selects and sets the lowest unblocked mode
  *
+ * If the CPU defines @ref PM_WAKEUP_LATENCY_US and xtimer is used, the idle
+ * thread additionally skips all modes that can't be left before the next
+ * timer expires (see xtimer_until_next()).
+ *
+ * With the `pm_layered_stats` module, the time spent in each mode is recorded
+ * and can be turned into an estimate of the consumed charge using the current
+ * table of the board (see @ref PM_CURRENT_UA). Per-thread run times are
+ * recorded by `schedstatistics`.
+ *
  * In order to use this module, you'll need to implement pm_set().
  *
  * @file
@@ -34,6 +43,8 @@
 #ifndef PM_LAYERED_H
 #define PM_LAYERED_H
 
+#include <stdint.h>
+
 #include "assert.h"
 #include "periph_cpu.h"
 
@@ -49,6 +60,30 @@ extern "C" {
 #define PROVIDES_PM_SET_LOWEST
 #endif
 
+#ifdef DOXYGEN
+/**
+ * @brief   Wake-up latency of each power mode in microseconds
+ *
+ * Initializer for an array of PM_NUM_MODES `uint32_t` values, starting with
+ * mode 0. Optionally defined by the CPU in periph_cpu.h.
+ */
+#define PM_WAKEUP_LATENCY_US    { 0 }
+
+/**
+ * @brief   Current drawn in each power mode in microampere
+ *
+ * Initializer for an array of PM_NUM_MODES + 1 `uint32_t` values, starting
+ * with mode 0 and ending with the idle mode. Optionally defined by the board
+ * in board.h, used by @ref pm_layered_stats_charge.
+ */
+#define PM_CURRENT_UA           { 0 }
+
+/**
+ * @brief   Current drawn while the CPU is running in microampere
+ */
+#define PM_ACTIVE_CURRENT_UA    (0)
+#endif
+
 /**
  * @brief   Block a power mode
  *
@@ -75,6 +110,42 @@ void pm_unblock(unsigned mode);
  */
 void pm_set(unsigned mode);
 
+#if defined(MODULE_PM_LAYERED_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Time spent in each power mode
+ */
+typedef struct {
+    uint64_t time_us[PM_NUM_MODES + 1]; /**< time per mode, idle mode last */
+    uint32_t count[PM_NUM_MODES + 1];   /**< number of times each mode was set */
+} pm_layered_stats_t;
+
+/**
+ * @brief   Get a snapshot of the power mode statistics
+ *
+ * The time is measured with xtimer, so modes that stop the xtimer's timer are
+ * not accounted correctly.
+ *
+ * @param[out]  stats     statistics to fill
+ */
+void pm_layered_stats_get(pm_layered_stats_t *stats);
+
+/**
+ * @brief   Reset the power mode statistics
+ */
+void pm_layered_stats_reset(void);
+
+/**
+ * @brief   Estimate the charge consumed since boot or the last reset
+ *
+ * Multiplies the time spent in each mode with @ref PM_CURRENT_UA and the
+ * remaining time with @ref PM_ACTIVE_CURRENT_UA. Returns 0 if the board does
+ * not provide a current table.
+ *
+ * @return  consumed charge in microcoulomb
+ */
+uint64_t pm_layered_stats_charge(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
  *  - Simple Park-Miller PRNG
  *  - Musl C PRNG
  *  - Fortuna (CS)PRNG
+ *  - ChaCha20 CSPRNG, reseeded from the hardware RNG if available
  */
 
 #ifndef RANDOM_H
@@ -42,6 +43,14 @@ extern "C" {
 #define RANDOM_SEED_DEFAULT (1)
 #endif
 
+#ifndef RANDOM_CHACHA20_RESEED_BLOCKS
+/**
+ * @brief   Number of 64 byte blocks the ChaCha20 PRNG generates before mixing
+ *          in fresh entropy from the hardware RNG
+ */
+#define RANDOM_CHACHA20_RESEED_BLOCKS   (1024U)
+#endif
+
 /**
  * @brief Enables support for floating point random number generation
  */
@@ -79,6 +88,9 @@ uint32_t random_uint32(void);
 
 /**
  * @brief writes random bytes in the [0,0xff]-interval to memory
+ *
+ * With `prng_chacha20` whole keystream blocks are written to @p buf, so
+ * requesting many bytes at once is much faster than repeated small requests.
  */
 void random_bytes(uint8_t *buf, size_t size);
 
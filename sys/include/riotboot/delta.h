@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_riotboot_delta Delta firmware patches
+ * @ingroup     sys
+ * @{
+ *
+ * Reconstructs a new firmware image from the image currently in flash and a
+ * binary patch, so that only the patch has to be transferred.
+ *
+ * Patches use the streaming friendly format of Colin Percival's bsdiff as
+ * modified by Matthew Endsley ("ENDSLEY/BSDIFF43", as produced by
+ * https://github.com/mendsley/bsdiff), where control records, diff and
+ * extra bytes are interleaved in one stream. The patch may additionally be
+ * compressed as a whole with heatshrink, see @ref pkg_heatshrink.
+ * Decompression is available if the application uses the package:
+ *
+ *     USEPKG += heatshrink
+ *
+ * The patch is fed in chunks of any size, e.g. as they are received. The
+ * reconstructed image is collected in a caller provided buffer, usually of
+ * FLASHPAGE_SIZE bytes, and handed to a write callback whenever the buffer
+ * is full. RAM use is thus constant and independent of the image size.
+ *
+ * @note    The old image must stay untouched while the patch is applied, so
+ *          the new image has to be written to a different slot.
+ *
+ * @file
+ * @brief       riotboot delta patch interface
+ *
+ * @}
+ */
+
+#ifndef RIOTBOOT_DELTA_H
+#define RIOTBOOT_DELTA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef MODULE_HEATSHRINK
+#include "heatshrink_decoder.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  Magic string at the start of a patch
+ */
+#define RIOTBOOT_DELTA_MAGIC       "ENDSLEY/BSDIFF43"
+
+/**
+ * @brief  Callback to store a chunk of the reconstructed image
+ *
+ * @param[in] arg       argument passed to riotboot_delta_init()
+ * @param[in] offset    offset of @p data within the new image
+ * @param[in] data      reconstructed data
+ * @param[in] len       length of @p data, equals the buffer size except for
+ *                      the last chunk
+ *
+ * @returns 0 on success
+ * @returns a negative errno value to abort
+ */
+typedef int (*riotboot_delta_write_t)(void *arg, size_t offset,
+                                      const uint8_t *data, size_t len);
+
+/**
+ * @brief  Delta patch context
+ */
+typedef struct {
+    const uint8_t *old;             /**< old image */
+    size_t old_len;                 /**< length of the old image */
+    int32_t old_pos;                /**< current read position in old image */
+    uint8_t *buf;                   /**< output buffer */
+    size_t buf_len;                 /**< size of the output buffer */
+    size_t buf_pos;                 /**< bytes in the output buffer */
+    riotboot_delta_write_t write;   /**< write callback */
+    void *arg;                      /**< argument of the write callback */
+    size_t new_len;                 /**< length of the new image */
+    size_t new_pos;                 /**< bytes of the new image produced */
+    size_t remaining;               /**< bytes left in the current block */
+    size_t extra_len;               /**< extra bytes following the diff */
+    int32_t seek;                   /**< old image seek after the block */
+    uint8_t hdr[24];                /**< buffer for header/control words */
+    uint8_t hdr_pos;                /**< bytes in hdr */
+    uint8_t state;                  /**< parser state */
+#if defined(MODULE_HEATSHRINK) || defined(DOXYGEN)
+    bool compressed;                /**< patch is heatshrink compressed */
+    heatshrink_decoder hsd;         /**< heatshrink decoder state */
+#endif
+} riotboot_delta_t;
+
+/**
+ * @brief  Start applying a patch
+ *
+ * @param[out] delta        context to initialize
+ * @param[in]  old          old image, e.g. the running slot
+ * @param[in]  old_len      length of @p old
+ * @param[in]  buf          output buffer
+ * @param[in]  buf_len      size of @p buf
+ * @param[in]  write        callback storing the new image
+ * @param[in]  arg          argument for @p write
+ * @param[in]  compressed   patch is heatshrink compressed
+ *
+ * @returns 0 on success
+ * @returns -ENOTSUP if @p compressed is set without heatshrink
+ */
+int riotboot_delta_init(riotboot_delta_t *delta,
+                        const uint8_t *old, size_t old_len,
+                        uint8_t *buf, size_t buf_len,
+                        riotboot_delta_write_t write, void *arg,
+                        bool compressed);
+
+/**
+ * @brief  Feed the next chunk of the patch
+ *
+ * @param[in,out] delta     context
+ * @param[in]     patch     patch chunk
+ * @param[in]     len       length of @p patch
+ *
+ * @returns 0 on success
+ * @returns -EINVAL if the patch is malformed
+ * @returns the error of the write callback
+ */
+int riotboot_delta_feed(riotboot_delta_t *delta, const uint8_t *patch,
+                        size_t len);
+
+/**
+ * @brief  Finish applying a patch and write the last chunk
+ *
+ * @param[in,out] delta     context the whole patch has been fed to
+ *
+ * @returns length of the new image on success
+ * @returns -EINVAL if the patch is malformed or incomplete
+ * @returns the error of the write callback
+ */
+int riotboot_delta_finish(riotboot_delta_t *delta);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIOTBOOT_DELTA_H */
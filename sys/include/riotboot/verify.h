@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_riotboot_verify Image digest verification
+ * @ingroup     sys
+ * @{
+ *
+ * The header tool stores a @ref riotboot_digest_t directly after the
+ * @ref riotboot_hdr_t, in the space reserved for the header. It contains
+ *
+ * - "SHA2" as magic number
+ * - the length of the image following the header space
+ * - the SHA256 digest of the image
+ *
+ * riotboot_verify() streams the image through SHA256 in chunks, so checking
+ * an image only takes time linear in its size and constant RAM. A callback
+ * can process each chunk before it is hashed, e.g. to decrypt it in place or
+ * to copy it to another slot.
+ *
+ * @note    This protects against corrupted images only. As anyone can compute
+ *          a matching digest, it does not authenticate the image.
+ *
+ * @file
+ * @brief       riotboot image digest verification
+ *
+ * @}
+ */
+
+#ifndef RIOTBOOT_VERIFY_H
+#define RIOTBOOT_VERIFY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashes/sha256.h"
+#include "riotboot/hdr.h"
+#include "riotboot/slot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  Magic number for riotboot_digest
+ */
+#define RIOTBOOT_DIGEST_MAGIC   0x32414853 /* "SHA2" */
+
+/**
+ * @brief Image digest, stored after the image header - All members are little endian
+ */
+typedef struct {
+    uint32_t magic_number;                  /**< Digest magic number (always "SHA2") */
+    uint32_t img_len;                       /**< Length of the image in bytes         */
+    uint8_t sha256[SHA256_DIGEST_LENGTH];   /**< SHA256 digest of the image           */
+} riotboot_digest_t;
+
+/**
+ * @brief  Callback to process a chunk of the image before it is hashed
+ *
+ * @param[in]       arg     argument passed to riotboot_verify()
+ * @param[in,out]   chunk   copy of the image chunk, may be modified in place
+ * @param[in]       len     length of @p chunk
+ * @param[in]       offset  offset of @p chunk within the image
+ *
+ * @returns 0 to continue
+ * @returns any other value to abort the verification
+ */
+typedef int (*riotboot_verify_cb_t)(void *arg, uint8_t *chunk, size_t len,
+                                    size_t offset);
+
+/**
+ * @brief  Get the digest record belonging to an image header
+ *
+ * @param[in] riotboot_hdr  ptr to image header
+ *
+ * @returns ptr to the digest record
+ */
+static inline const riotboot_digest_t *riotboot_digest_get(const riotboot_hdr_t *riotboot_hdr)
+{
+    return (const riotboot_digest_t *)(riotboot_hdr + 1);
+}
+
+/**
+ * @brief  Verify the digest of the image belonging to a header
+ *
+ * The image is read from `riotboot_hdr->start_addr`. Without @p cb, it is
+ * hashed straight from flash and @p buf is not used. Otherwise, each chunk
+ * is copied to @p buf and passed to @p cb before hashing.
+ *
+ * @param[in] riotboot_hdr  ptr to an already validated image header
+ * @param[in] buf           chunk buffer, e.g. of FLASHPAGE_SIZE bytes
+ * @param[in] buf_len       size of @p buf
+ * @param[in] cb            chunk callback, may be NULL
+ * @param[in] arg           argument for @p cb
+ *
+ * @returns 0 if the digest matches
+ * @returns -1 if there is no digest record, it does not match or @p cb
+ *          aborted
+ */
+int riotboot_verify(const riotboot_hdr_t *riotboot_hdr, uint8_t *buf,
+                    size_t buf_len, riotboot_verify_cb_t cb, void *arg);
+
+/**
+ * @brief  Validate the header of slot @p slot and verify its image digest
+ *
+ * @note   Requires the `riotboot_slot` module.
+ *
+ * @param[in] slot    slot nr to work on
+ *
+ * @returns 0 if ok.
+ */
+static inline int riotboot_verify_slot(unsigned slot)
+{
+    const riotboot_hdr_t *hdr = riotboot_slot_get_hdr(slot);
+
+    if (riotboot_hdr_validate(hdr) != 0) {
+        return -1;
+    }
+    return riotboot_verify(hdr, NULL, 0, NULL, NULL);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIOTBOOT_VERIFY_H */
@@ -13,6 +13,18 @@
  *
  * @see @ref drivers_saul
  *
+ * With the `saul_reg_cache` module, every registry entry caches the result of
+ * its last read. saul_reg_read() returns the cached result as long as it is
+ * younger than the entry's maximum age instead of reading the device again, so
+ * frontends that poll the same values repeatedly do not load the sensor buses.
+ * saul_reg_read_batch() reads several entries at once.
+ *
+ * Enumerating the registry with saul_reg_find_nth() and increasing positions
+ * takes linear time. The `saul_reg_index` module additionally indexes the
+ * entries by type and name, so saul_reg_find_type() and saul_reg_find_name()
+ * do not walk the registry from its head. The index is only maintained by
+ * saul_reg_add() and saul_reg_rm(), entries must not be linked manually then.
+ *
  * @{
  *
  * @file
@@ -24,6 +36,7 @@
 #ifndef SAUL_REG_H
 #define SAUL_REG_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "saul.h"
@@ -41,8 +54,24 @@ typedef struct saul_reg {
     void *dev;                      /**< pointer to the device descriptor */
     const char *name;               /**< string identifier for the device */
     saul_driver_t const *driver;    /**< the devices read callback */
+#if defined(MODULE_SAUL_REG_CACHE) || defined(DOXYGEN)
+    uint32_t max_age;               /**< maximum age of a cached result in
+                                         microseconds, 0 for
+                                         @ref SAUL_REG_CACHE_MAX_AGE */
+    uint64_t cache_time;            /**< time of the cached read */
+    phydat_t cache;                 /**< result of the cached read */
+    int8_t cache_dim;               /**< return value of the cached read, 0
+                                         if nothing is cached */
+#endif
 } saul_reg_t;
 
+/**
+ * @brief   Default maximum age of cached read results in microseconds
+ */
+#ifndef SAUL_REG_CACHE_MAX_AGE
+#define SAUL_REG_CACHE_MAX_AGE      (100U * 1000U)
+#endif
+
 /**
  * @brief   Additional data to collect for each entry
  */
@@ -50,6 +79,13 @@ typedef struct {
     const char *name;           /**< string identifier for a device */
 } saul_reg_info_t;
 
+/**
+ * @brief   Number of buckets of the type and name index
+ */
+#ifndef SAUL_REG_INDEX_BUCKETS
+#define SAUL_REG_INDEX_BUCKETS      (16U)
+#endif
+
 /**
  * @brief   Export the SAUL registry as global variable
  */
@@ -112,6 +148,9 @@ saul_reg_t *saul_reg_find_name(const char *name);
 /**
  * @brief   Read data from the given device
  *
+ * With `saul_reg_cache` the result is served from the cache of @p dev if it is
+ * not older than the entry's maximum age.
+ *
  * @param[in] dev       device to read from
  * @param[out] res      location to store the results in
  *
@@ -122,6 +161,24 @@ saul_reg_t *saul_reg_find_name(const char *name);
  */
 int saul_reg_read(saul_reg_t *dev, phydat_t *res);
 
+/**
+ * @brief   Read data from several devices
+ *
+ * With `saul_reg_cache` all entries of the batch are checked against the same
+ * point in time, so a batch either gets the cached results or fresh ones
+ * consistently.
+ *
+ * @param[in] devs      devices to read from
+ * @param[out] res      locations to store the results in, one per device
+ * @param[out] dims     return values of saul_reg_read() for each device,
+ *                      may be NULL
+ * @param[in] num       number of devices in @p devs
+ *
+ * @return      the number of devices read successfully
+ */
+int saul_reg_read_batch(saul_reg_t *const *devs, phydat_t *res, int *dims,
+                        size_t num);
+
 /**
  * @brief   Write data to the given device
  *
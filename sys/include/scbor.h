@@ -0,0 +1,425 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_scbor Streaming CBOR library
+ * @ingroup     sys_serialization
+ * @brief       Encode and decode CBOR (RFC 7049) in place, without heap
+ *
+ * The encoder writes each item straight into the buffer passed to
+ * scbor_enc_init(), e.g. the payload space of a CoAP packet, so no scratch
+ * buffer and copy is needed. It keeps counting after the buffer is full, so
+ * passing a NULL buffer computes the encoded length up front.
+ *
+ * The decoder is a pull parser: the application asks for the next item with
+ * the type it expects. Strings are returned as pointers into the input
+ * buffer, containers are iterated with a nested @ref scbor_value_t on the
+ * stack, so decoding does not allocate or copy anything.
+ *
+ * Only the subset of CBOR used for telemetry is supported: integers of up to
+ * 64 bit, byte and text strings, arrays, maps, tags, booleans, null and
+ * single precision floats. Indefinite length containers are supported, but
+ * indefinite length strings are not.
+ *
+ * @code{.c}
+ * scbor_enc_t enc;
+ * scbor_enc_init(&enc, pdu.payload, pdu.payload_len);
+ * scbor_fmt_map(&enc, 1);
+ * scbor_put_tstr(&enc, "temp");
+ * scbor_fmt_int(&enc, temp);
+ * if (scbor_enc_len(&enc) > pdu.payload_len) {
+ *     return -ENOBUFS;
+ * }
+ * len += scbor_enc_len(&enc);
+ * @endcode
+ *
+ * @{
+ *
+ * @file
+ * @brief       Streaming CBOR encoder and decoder
+ */
+
+#ifndef SCBOR_H
+#define SCBOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    CBOR major types
+ * @{
+ */
+#define SCBOR_TYPE_UINT     (0U)    /**< unsigned integer */
+#define SCBOR_TYPE_NINT     (1U)    /**< negative integer */
+#define SCBOR_TYPE_BSTR     (2U)    /**< byte string */
+#define SCBOR_TYPE_TSTR     (3U)    /**< text string */
+#define SCBOR_TYPE_ARR      (4U)    /**< array */
+#define SCBOR_TYPE_MAP      (5U)    /**< map */
+#define SCBOR_TYPE_TAG      (6U)    /**< tag */
+#define SCBOR_TYPE_FLOAT    (7U)    /**< simple values and floats */
+/** @} */
+
+/**
+ * @brief   Maximum nesting depth scbor_skip() handles
+ */
+#ifndef SCBOR_RECURSION_MAX
+#define SCBOR_RECURSION_MAX (8U)
+#endif
+
+/**
+ * @brief   Encoder context
+ */
+typedef struct {
+    uint8_t *cur;       /**< next byte to write */
+    uint8_t *end;       /**< end of the buffer */
+    size_t len;         /**< number of bytes encoded, including those that
+                             did not fit */
+} scbor_enc_t;
+
+/**
+ * @brief   Decoder context, one per container level
+ */
+typedef struct {
+    const uint8_t *cur; /**< next byte to read */
+    const uint8_t *end; /**< end of the input */
+    uint32_t remaining; /**< items left in the container */
+    uint8_t flags;      /**< internal flags */
+} scbor_value_t;
+
+/**
+ * @brief   Initialize an encoder
+ *
+ * @param[out] enc      encoder to initialize
+ * @param[out] buf      buffer to encode into, may be NULL to only compute
+ *                      the length
+ * @param[in] len       size of @p buf in bytes
+ */
+void scbor_enc_init(scbor_enc_t *enc, uint8_t *buf, size_t len);
+
+/**
+ * @brief   Get the length of the encoded data
+ *
+ * @param[in] enc       encoder
+ *
+ * @return  number of bytes encoded so far, if it is larger than the buffer
+ *          the output was truncated
+ */
+static inline size_t scbor_enc_len(const scbor_enc_t *enc)
+{
+    return enc->len;
+}
+
+/**
+ * @brief   Encode an unsigned integer
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] num       value
+ */
+void scbor_fmt_uint(scbor_enc_t *enc, uint64_t num);
+
+/**
+ * @brief   Encode a signed integer
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] num       value
+ */
+void scbor_fmt_int(scbor_enc_t *enc, int64_t num);
+
+/**
+ * @brief   Encode a boolean
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] val       value
+ */
+void scbor_fmt_bool(scbor_enc_t *enc, bool val);
+
+/**
+ * @brief   Encode null
+ *
+ * @param[in,out] enc   encoder
+ */
+void scbor_fmt_null(scbor_enc_t *enc);
+
+/**
+ * @brief   Encode a single precision float
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] num       value
+ */
+void scbor_fmt_float(scbor_enc_t *enc, float num);
+
+/**
+ * @brief   Encode a tag, to be followed by the tagged item
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] tag       tag number
+ */
+void scbor_fmt_tag(scbor_enc_t *enc, uint32_t tag);
+
+/**
+ * @brief   Start an array of @p len items
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] len       number of items that follow
+ */
+void scbor_fmt_array(scbor_enc_t *enc, size_t len);
+
+/**
+ * @brief   Start a map of @p len key/value pairs
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] len       number of pairs that follow
+ */
+void scbor_fmt_map(scbor_enc_t *enc, size_t len);
+
+/**
+ * @brief   Start an array of unknown length, ended by scbor_fmt_end()
+ *
+ * @param[in,out] enc   encoder
+ */
+void scbor_fmt_array_indefinite(scbor_enc_t *enc);
+
+/**
+ * @brief   Start a map of unknown length, ended by scbor_fmt_end()
+ *
+ * @param[in,out] enc   encoder
+ */
+void scbor_fmt_map_indefinite(scbor_enc_t *enc);
+
+/**
+ * @brief   End an indefinite length container
+ *
+ * @param[in,out] enc   encoder
+ */
+void scbor_fmt_end(scbor_enc_t *enc);
+
+/**
+ * @brief   Encode a byte string
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] str       bytes
+ * @param[in] len       number of bytes
+ */
+void scbor_put_bstr(scbor_enc_t *enc, const void *str, size_t len);
+
+/**
+ * @brief   Encode a text string of given length
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] str       UTF-8 text
+ * @param[in] len       length of @p str in bytes
+ */
+void scbor_put_tstrn(scbor_enc_t *enc, const char *str, size_t len);
+
+/**
+ * @brief   Encode a null terminated text string
+ *
+ * @param[in,out] enc   encoder
+ * @param[in] str       UTF-8 text
+ */
+void scbor_put_tstr(scbor_enc_t *enc, const char *str);
+
+/**
+ * @brief   Initialize a decoder on a buffer with CBOR data
+ *
+ * The buffer may hold any number of consecutive top level items.
+ *
+ * @param[out] val      decoder to initialize
+ * @param[in] buf       CBOR data
+ * @param[in] len       length of @p buf in bytes
+ */
+void scbor_decoder_init(scbor_value_t *val, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Get the major type of the next item
+ *
+ * @param[in] val       decoder
+ *
+ * @return  major type, one of the SCBOR_TYPE_* values
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_type(const scbor_value_t *val);
+
+/**
+ * @brief   Check whether all items of @p val were read
+ *
+ * @param[in] val       decoder
+ *
+ * @return  true at the end of the buffer or container
+ */
+bool scbor_at_end(const scbor_value_t *val);
+
+/**
+ * @brief   Read an unsigned integer
+ *
+ * @param[in,out] val   decoder
+ * @param[out] num      value
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is no unsigned integer
+ * @return  -EOVERFLOW if the value does not fit into @p num
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_uint32(scbor_value_t *val, uint32_t *num);
+
+/**
+ * @brief   Read a signed or unsigned integer
+ *
+ * @param[in,out] val   decoder
+ * @param[out] num      value
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is no integer
+ * @return  -EOVERFLOW if the value does not fit into @p num
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_int32(scbor_value_t *val, int32_t *num);
+
+/**
+ * @brief   Read a boolean
+ *
+ * @param[in,out] val   decoder
+ * @param[out] res      value
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is no boolean
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_bool(scbor_value_t *val, bool *res);
+
+/**
+ * @brief   Read null
+ *
+ * @param[in,out] val   decoder
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is not null
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_null(scbor_value_t *val);
+
+/**
+ * @brief   Read a single precision float
+ *
+ * @param[in,out] val   decoder
+ * @param[out] num      value
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is no single precision float
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_float(scbor_value_t *val, float *num);
+
+/**
+ * @brief   Read a tag number
+ *
+ * @param[in,out] val   decoder
+ * @param[out] tag      tag number, the tagged item follows
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is no tag
+ * @return  -EOVERFLOW if the tag number does not fit into @p tag
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_tag(scbor_value_t *val, uint32_t *tag);
+
+/**
+ * @brief   Read a byte string without copying it
+ *
+ * @param[in,out] val   decoder
+ * @param[out] buf      start of the string inside the input buffer
+ * @param[out] len      length of the string
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is no definite length byte string or
+ *          exceeds the input
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_bstr(scbor_value_t *val, const uint8_t **buf, size_t *len);
+
+/**
+ * @brief   Read a text string without copying it
+ *
+ * @note    The string is not null terminated.
+ *
+ * @param[in,out] val   decoder
+ * @param[out] buf      start of the string inside the input buffer
+ * @param[out] len      length of the string
+ *
+ * @return  number of bytes read
+ * @return  -EINVAL if the next item is no definite length text string or
+ *          exceeds the input
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_get_tstr(scbor_value_t *val, const char **buf, size_t *len);
+
+/**
+ * @brief   Enter an array
+ *
+ * Read the items with @p array, then continue with @p val after
+ * scbor_leave_container().
+ *
+ * @param[in] val       decoder
+ * @param[out] array    decoder for the items of the array
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the next item is no array
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_enter_array(const scbor_value_t *val, scbor_value_t *array);
+
+/**
+ * @brief   Enter a map
+ *
+ * The keys and values are read alternately with @p map.
+ *
+ * @param[in] val       decoder
+ * @param[out] map      decoder for the keys and values of the map
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the next item is no map
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_enter_map(const scbor_value_t *val, scbor_value_t *map);
+
+/**
+ * @brief   Continue after a container
+ *
+ * Items of @p container that were not read are skipped.
+ *
+ * @param[in,out] val       decoder the container was entered from
+ * @param[in] container     decoder of the container
+ *
+ * @return  0 on success
+ * @return  -EINVAL on malformed input
+ */
+int scbor_leave_container(scbor_value_t *val, scbor_value_t *container);
+
+/**
+ * @brief   Skip the next item, including all nested items
+ *
+ * @param[in,out] val   decoder
+ *
+ * @return  0 on success
+ * @return  -EINVAL on malformed input or nesting deeper than
+ *          @ref SCBOR_RECURSION_MAX
+ * @return  -ENOENT if there are no more items
+ */
+int scbor_skip(scbor_value_t *val);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCBOR_H */
+/** @} */
@@ -0,0 +1,466 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sensor_pipeline Sensor streaming pipeline
+ * @ingroup     sys
+ * @brief       Moves sensor data through processing stages to the network
+ *
+ * A pipeline collects samples in a buffer and, once a batch is complete,
+ * passes the buffer through a chain of stages: transforms that work on the
+ * buffer in place (filtering, delta encoding, aggregation over a window)
+ * and sinks that hand the result over (CoAP Observe notification, UDP
+ * datagram, log file). The samples are never copied between stages, and
+ * sinks only run once per batch, so the radio wakes up once per batch
+ * instead of once per sample.
+ *
+ * Samples get into a pipeline in one of two ways:
+ *
+ * - Polled: a source stage (@ref sensor_pipeline_saul_t) is read
+ *   periodically and appends one sample per period to the pipeline's
+ *   buffer. The batch is complete when the buffer can't take another
+ *   sample.
+ * - Pushed: a block of samples that already sits in memory, e.g. a half of
+ *   the double buffer of @ref sensor_pipeline_adc_start() or the data sets
+ *   read from an IMU FIFO, is handed over with sensor_pipeline_push() and
+ *   processed where it is.
+ *
+ * All pipelines run on one shared event thread, created when the first
+ * pipeline starts.
+ *
+ * A buffer holds the values of consecutive samples interleaved, e.g.
+ * `x0 y0 z0 x1 y1 z1 ...` for a three-dimensional sensor. All values share
+ * the unit and scale of @ref phydat_t. The sinks send a batch encoded as
+ * a header of unit, scale, number of values per sample and the 16 bit
+ * number of values, followed by the values as big-endian int16.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sensor streaming pipeline interface
+ */
+
+#ifndef SENSOR_PIPELINE_H
+#define SENSOR_PIPELINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "event.h"
+#include "matstat.h"
+#include "phydat.h"
+#include "xtimer.h"
+#ifdef MODULE_SAUL_REG
+#include "saul_reg.h"
+#endif
+#ifdef MODULE_PERIPH_ADC_CONTINUOUS
+#include "periph/adc.h"
+#endif
+#ifdef MODULE_SOCK_UDP
+#include "net/sock/udp.h"
+#endif
+#ifdef MODULE_GCOAP
+#include "net/gcoap.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Priority of the pipeline thread
+ */
+#ifndef SENSOR_PIPELINE_PRIO
+#define SENSOR_PIPELINE_PRIO        (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Stack size of the pipeline thread
+ *
+ * The sinks run on this stack, including the network stack's send path.
+ */
+#ifndef SENSOR_PIPELINE_STACKSIZE
+#define SENSOR_PIPELINE_STACKSIZE   (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Size of the header of an encoded batch in bytes
+ */
+#define SENSOR_PIPELINE_HDR_LEN     (5U)
+
+/**
+ * @brief   Space needed to encode @p numof values
+ */
+#define SENSOR_PIPELINE_ENCODED_LEN(numof)  \
+    (SENSOR_PIPELINE_HDR_LEN + 2 * (numof))
+
+/**
+ * @brief   Return values of a stage
+ */
+enum {
+    SENSOR_PIPELINE_NEXT = 0,   /**< pass the buffer to the next stage */
+    SENSOR_PIPELINE_DROP = 1,   /**< nothing left to pass on for this batch */
+};
+
+/**
+ * @brief   Samples moving through a pipeline
+ */
+typedef struct {
+    int16_t *values;            /**< the values, samples interleaved */
+    uint16_t numof;             /**< number of values */
+    uint16_t size;              /**< capacity of sensor_pipeline_buf_t::values */
+    uint8_t dim;                /**< number of values per sample */
+    uint8_t unit;               /**< unit, see @ref phydat_t::unit */
+    int8_t scale;               /**< scale, see @ref phydat_t::scale */
+} sensor_pipeline_buf_t;
+
+/**
+ * @brief   Forward declaration of a stage
+ */
+typedef struct sensor_pipeline_stage sensor_pipeline_stage_t;
+
+/**
+ * @brief   Process a buffer in a stage
+ *
+ * For a source stage: append one sample to @p buf. The first sample of a
+ * batch (sensor_pipeline_buf_t::numof is 0) sets dim, unit and scale.
+ *
+ * @param[in] stage     the stage
+ * @param[in,out] buf   the samples
+ *
+ * @return  SENSOR_PIPELINE_NEXT to continue with the next stage
+ * @return  SENSOR_PIPELINE_DROP to end processing of this batch
+ * @return  negative errno on error, also ends processing of this batch
+ */
+typedef int (*sensor_pipeline_process_t)(sensor_pipeline_stage_t *stage,
+                                         sensor_pipeline_buf_t *buf);
+
+/**
+ * @brief   Stage of a pipeline, embedded as first member of each stage type
+ */
+struct sensor_pipeline_stage {
+    sensor_pipeline_stage_t *next;      /**< next stage */
+    sensor_pipeline_process_t process;  /**< processing function */
+};
+
+/**
+ * @brief   Pipeline
+ */
+typedef struct {
+    event_t event;                  /**< processing event, must be first */
+    sensor_pipeline_buf_t buf;      /**< current batch */
+    sensor_pipeline_stage_t *source;    /**< polled source, may be NULL */
+    sensor_pipeline_stage_t *stages;    /**< chain of stages */
+    int16_t *mem;                   /**< buffer for polled samples */
+    uint16_t mem_len;               /**< capacity of sensor_pipeline_t::mem */
+    volatile bool busy;             /**< a pushed block is being processed */
+    xtimer_t timer;                 /**< timer to poll the source */
+    uint32_t period;                /**< polling period in microseconds */
+    unsigned errors;                /**< number of failed stages */
+} sensor_pipeline_t;
+
+/**
+ * @brief   Initialize a pipeline
+ *
+ * @param[out] pipe     pipeline to initialize
+ * @param[in] source    source to poll, NULL if samples are pushed
+ * @param[in] mem       buffer for a batch of polled samples, NULL if
+ *                      samples are pushed
+ * @param[in] numof     number of values in @p mem
+ */
+void sensor_pipeline_init(sensor_pipeline_t *pipe,
+                          sensor_pipeline_stage_t *source,
+                          int16_t *mem, size_t numof);
+
+/**
+ * @brief   Append a stage to the chain of a pipeline
+ *
+ * Must not be called while the pipeline runs.
+ *
+ * @param[in,out] pipe  pipeline
+ * @param[in] stage     stage to append
+ */
+void sensor_pipeline_add(sensor_pipeline_t *pipe,
+                         sensor_pipeline_stage_t *stage);
+
+/**
+ * @brief   Start a pipeline
+ *
+ * @param[in,out] pipe  pipeline
+ * @param[in] period    polling period of the source in microseconds,
+ *                      ignored if samples are pushed
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the pipeline thread can't be created
+ */
+int sensor_pipeline_start(sensor_pipeline_t *pipe, uint32_t period);
+
+/**
+ * @brief   Stop polling the source of a pipeline
+ *
+ * Samples of an incomplete batch are kept for the next start.
+ *
+ * @param[in,out] pipe  pipeline
+ */
+void sensor_pipeline_stop(sensor_pipeline_t *pipe);
+
+/**
+ * @brief   Process a block of samples in a started pipeline
+ *
+ * The block is processed in place, it must not be changed until
+ * sensor_pipeline_t::busy is false again. May be called from interrupt
+ * context.
+ *
+ * @param[in,out] pipe  pipeline without a source
+ * @param[in] values    the samples, interleaved
+ * @param[in] numof     number of values
+ * @param[in] dim       number of values per sample
+ * @param[in] unit      unit of the values
+ * @param[in] scale     scale of the values
+ *
+ * @return  0 on success
+ * @return  -EBUSY if the previous block is still being processed
+ */
+int sensor_pipeline_push(sensor_pipeline_t *pipe, int16_t *values,
+                         size_t numof, uint8_t dim, uint8_t unit,
+                         int8_t scale);
+
+/**
+ * @brief   Encode a batch for transmission
+ *
+ * @param[in] buf       the batch
+ * @param[out] out      buffer of at least
+ *                      SENSOR_PIPELINE_ENCODED_LEN(buf->numof) bytes
+ * @param[in] len       size of @p out
+ *
+ * @return  number of bytes written
+ * @return  -ENOBUFS if @p out is too small
+ */
+ssize_t sensor_pipeline_encode(const sensor_pipeline_buf_t *buf,
+                               void *out, size_t len);
+
+/**
+ * @name    Sources
+ * @{
+ */
+#if defined(MODULE_SAUL_REG) || defined(DOXYGEN)
+/**
+ * @brief   Source reading a SAUL device
+ *
+ * Values of a read with a different scale than the batch are rescaled to
+ * the batch's scale.
+ */
+typedef struct {
+    sensor_pipeline_stage_t stage;  /**< stage */
+    saul_reg_t *dev;                /**< device to read */
+} sensor_pipeline_saul_t;
+
+/**
+ * @brief   Initialize a SAUL source
+ *
+ * @param[out] src      source to initialize
+ * @param[in] dev       device to read
+ */
+void sensor_pipeline_saul_init(sensor_pipeline_saul_t *src, saul_reg_t *dev);
+#endif
+
+#if defined(MODULE_PERIPH_ADC_CONTINUOUS) || defined(DOXYGEN)
+/**
+ * @brief   Push continuous ADC samples into a pipeline
+ *
+ * Each half of @p buf is pushed to @p pipe as soon as the ADC filled it,
+ * so processing must be done before the other half is full. Blocks that
+ * arrive while the pipeline is still busy are dropped.
+ *
+ * @param[in,out] pipe  started pipeline without a source
+ * @param[in] line      initialized ADC line
+ * @param[in] res       resolution, results must fit into int16_t
+ * @param[in] freq      sampling rate in Hz
+ * @param[out] buf      buffer for 2 * @p len samples
+ * @param[in] len       number of samples per batch
+ *
+ * @return  0 on success
+ * @return  -1 if resolution or sampling rate are not applicable
+ */
+int sensor_pipeline_adc_start(sensor_pipeline_t *pipe, adc_t line,
+                              adc_res_t res, uint32_t freq,
+                              int16_t *buf, size_t len);
+#endif
+/** @} */
+
+/**
+ * @name    Transforms
+ * @{
+ */
+
+/**
+ * @brief   Exponential moving average filter
+ *
+ * Computes `y += (x - y) / 2^shift` per dimension, the state carries over
+ * between batches.
+ */
+typedef struct {
+    sensor_pipeline_stage_t stage;  /**< stage */
+    int32_t acc[PHYDAT_DIM];        /**< filter state, `y * 2^shift` */
+    uint8_t shift;                  /**< smoothing, 0 passes values through */
+    bool primed;                    /**< state holds a sample */
+} sensor_pipeline_ema_t;
+
+/**
+ * @brief   Initialize a moving average filter
+ *
+ * @param[out] ema      filter to initialize
+ * @param[in] shift     smoothing factor as power of two, at most 15
+ */
+void sensor_pipeline_ema_init(sensor_pipeline_ema_t *ema, uint8_t shift);
+
+/**
+ * @brief   Delta encoding
+ *
+ * Replaces every sample but the first of a batch by its difference to the
+ * previous sample, so each batch can be decoded on its own. Differences
+ * saturate at the int16_t limits.
+ */
+typedef struct {
+    sensor_pipeline_stage_t stage;  /**< stage */
+} sensor_pipeline_delta_t;
+
+/**
+ * @brief   Initialize a delta encoding stage
+ *
+ * @param[out] delta    stage to initialize
+ */
+void sensor_pipeline_delta_init(sensor_pipeline_delta_t *delta);
+
+/**
+ * @brief   Flags of the values an aggregation outputs per dimension
+ */
+enum {
+    SENSOR_PIPELINE_AGGR_MIN  = 0x1,    /**< minimum */
+    SENSOR_PIPELINE_AGGR_MEAN = 0x2,    /**< arithmetic mean */
+    SENSOR_PIPELINE_AGGR_MAX  = 0x4,    /**< maximum */
+};
+
+/**
+ * @brief   Aggregation over a window of samples
+ *
+ * Replaces each complete window of samples by one sample holding the
+ * selected statistics for every dimension, e.g. `min_x mean_x max_x min_y
+ * ...`. A window may span several batches, batches that don't complete a
+ * window are not passed on.
+ */
+typedef struct {
+    sensor_pipeline_stage_t stage;      /**< stage */
+    matstat_state_t state[PHYDAT_DIM];  /**< statistics of the window */
+    uint16_t window;                    /**< samples per window */
+    uint16_t count;                     /**< samples in the current window */
+    uint8_t fields;                     /**< SENSOR_PIPELINE_AGGR_* flags */
+} sensor_pipeline_aggr_t;
+
+/**
+ * @brief   Initialize an aggregation stage
+ *
+ * @param[out] aggr     stage to initialize
+ * @param[in] window    samples per window, at least the number of
+ *                      selected statistics
+ * @param[in] fields    statistics to output, SENSOR_PIPELINE_AGGR_* flags
+ */
+void sensor_pipeline_aggr_init(sensor_pipeline_aggr_t *aggr, uint16_t window,
+                               uint8_t fields);
+/** @} */
+
+/**
+ * @name    Sinks
+ *
+ * Sinks pass the buffer on unchanged, so several of them can be chained.
+ * @{
+ */
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Sink sending each batch as UDP datagram
+ */
+typedef struct {
+    sensor_pipeline_stage_t stage;  /**< stage */
+    sock_udp_t *sock;               /**< socket to send with, may be NULL */
+    sock_udp_ep_t remote;           /**< destination */
+    uint8_t *pkt;                   /**< buffer to encode the batch in */
+    size_t pkt_len;                 /**< size of sensor_pipeline_udp_t::pkt */
+} sensor_pipeline_udp_t;
+
+/**
+ * @brief   Initialize a UDP sink
+ *
+ * @param[out] sink     sink to initialize
+ * @param[in] sock      socket to send with, NULL for an implicit one
+ * @param[in] remote    destination
+ * @param[in] pkt       buffer to encode the batch in
+ * @param[in] pkt_len   size of @p pkt
+ */
+void sensor_pipeline_udp_init(sensor_pipeline_udp_t *sink, sock_udp_t *sock,
+                              const sock_udp_ep_t *remote,
+                              uint8_t *pkt, size_t pkt_len);
+#endif
+
+#if defined(MODULE_GCOAP) || defined(DOXYGEN)
+/**
+ * @brief   Sink sending each batch as Observe notification of a resource
+ *
+ * Batches are only encoded when the resource has an observer.
+ */
+typedef struct {
+    sensor_pipeline_stage_t stage;      /**< stage */
+    const coap_resource_t *resource;    /**< observed resource */
+    uint8_t *pdu;                       /**< buffer for the notification */
+    size_t pdu_len;                     /**< size of sensor_pipeline_coap_t::pdu */
+} sensor_pipeline_coap_t;
+
+/**
+ * @brief   Initialize a CoAP Observe sink
+ *
+ * @param[out] sink     sink to initialize
+ * @param[in] resource  resource registered with gcoap
+ * @param[in] pdu       buffer for the notification
+ * @param[in] pdu_len   size of @p pdu
+ */
+void sensor_pipeline_coap_init(sensor_pipeline_coap_t *sink,
+                               const coap_resource_t *resource,
+                               uint8_t *pdu, size_t pdu_len);
+#endif
+
+#if defined(MODULE_VFS) || defined(DOXYGEN)
+/**
+ * @brief   Sink appending each batch to a file
+ */
+typedef struct {
+    sensor_pipeline_stage_t stage;  /**< stage */
+    int fd;                         /**< file opened for writing */
+    uint8_t *scratch;               /**< buffer to encode the batch in */
+    size_t scratch_len;             /**< size of sensor_pipeline_vfs_t::scratch */
+} sensor_pipeline_vfs_t;
+
+/**
+ * @brief   Initialize a file sink
+ *
+ * @param[out] sink         sink to initialize
+ * @param[in] fd            file descriptor opened for writing
+ * @param[in] scratch       buffer to encode the batch in
+ * @param[in] scratch_len   size of @p scratch
+ */
+void sensor_pipeline_vfs_init(sensor_pipeline_vfs_t *sink, int fd,
+                              uint8_t *scratch, size_t scratch_len);
+#endif
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_PIPELINE_H */
+/** @} */
@@ -20,6 +20,7 @@
 #ifndef SHELL_H
 #define SHELL_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "kernel_defines.h"
@@ -33,6 +34,31 @@ extern "C" {
  */
 #define SHELL_DEFAULT_BUFSIZE   (128)
 
+/**
+ * @brief Size of the output buffer used with the `shell_buffered` module
+ *
+ * With `shell_buffered`, stdout is fully buffered while the shell runs and
+ * flushed after each command and before each prompt. The output of a command
+ * is thus handed to stdio in few large writes instead of one per print call.
+ */
+#ifndef SHELL_BUFFERED_OUT_SIZE
+#define SHELL_BUFFERED_OUT_SIZE (256)
+#endif
+
+/**
+ * @name Binary response format for machine callers (`shell_tlv` module)
+ *
+ * Every record starts with @ref SHELL_TLV_START followed by a one byte type,
+ * the length of the value as 16 bit big endian integer and the value itself.
+ * After each command line a @ref SHELL_TLV_TYPE_RESULT record carries the
+ * return value of the command handler as 32 bit big endian integer
+ * (`-ENOENT` for unknown commands, `-EINVAL` for malformed lines).
+ * @{
+ */
+#define SHELL_TLV_START         (0x01)  /**< start of a record (ASCII SOH) */
+#define SHELL_TLV_TYPE_RESULT   (0x00)  /**< return value of a command */
+/** @} */
+
 /**
  * @brief           Protype of a shell callback handler.
  * @details         The functions supplied to shell_run() must use this signature.
@@ -72,6 +98,24 @@ typedef struct shell_command_t {
  */
 void shell_run(const shell_command_t *commands, char *line_buf, int len);
 
+/**
+ * @brief           Writes a binary record to the shell output
+ *
+ * Command handlers can use this to return data to machine callers. Types
+ * other than @ref SHELL_TLV_TYPE_RESULT are application defined.
+ *
+ * @note            Only available with the `shell_tlv` module.
+ *
+ * @param[in]       type    type of the record
+ * @param[in]       data    value of the record
+ * @param[in]       len     length of @p data, at most `UINT16_MAX`
+ *
+ * @return 0 on success
+ * @return -EINVAL if @p len is too large
+ * @return -EIO on write errors
+ */
+int shell_tlv_write(uint8_t type, const void *data, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sigproc Sigproc - Block based signal processing
+ * @ingroup     sys_math
+ * @brief       Filtering and feature extraction on blocks of Q15 samples
+ *
+ * The functions work on blocks of 16 bit samples in Q15 format, as delivered
+ * by ADCs and IMUs, instead of one value at a time. If the `cmsis-dsp`
+ * package is used (it is pulled in automatically on Cortex-M4 and Cortex-M7,
+ * which have SIMD instructions), its kernels are used. Everywhere else a
+ * scalar implementation computes the same results.
+ *
+ * All filter coefficients are Q15 values, FIR coefficients are stored in time
+ * reversed order `{b[num_taps - 1], ..., b[1], b[0]}` as CMSIS-DSP expects.
+ *
+ * @{
+ * @file
+ * @brief       Sigproc library declarations
+ */
+
+#ifndef SIGPROC_H
+#define SIGPROC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef MODULE_CMSIS_DSP
+#include "arm_math.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the state buffer of a FIR filter in samples
+ *
+ * @param[in] num_taps      number of filter coefficients
+ * @param[in] block_size    maximum number of input samples per call
+ */
+#define SIGPROC_FIR_STATE_LEN(num_taps, block_size) \
+    ((num_taps) + (block_size) - 1)
+
+/**
+ * @brief   Size of the state buffer of a biquad cascade in samples
+ *
+ * @param[in] num_stages    number of second order sections
+ */
+#define SIGPROC_BIQUAD_STATE_LEN(num_stages)    (4 * (num_stages))
+
+/**
+ * @brief   FIR filter with optional decimation
+ */
+typedef struct {
+#if defined(MODULE_CMSIS_DSP) || defined(DOXYGEN)
+    union {
+        arm_fir_instance_q15 fir;           /**< instance for factor 1 */
+        arm_fir_decimate_instance_q15 dec;  /**< instance for factor > 1 */
+    } arm;                                  /**< CMSIS-DSP instance */
+#endif
+    const int16_t *coeffs;  /**< coefficients in time reversed order */
+    int16_t *state;         /**< state buffer */
+    uint16_t num_taps;      /**< number of coefficients */
+    uint8_t factor;         /**< decimation factor */
+} sigproc_fir_t;
+
+/**
+ * @brief   Cascade of biquad (second order) IIR filters in direct form I
+ */
+typedef struct {
+#if defined(MODULE_CMSIS_DSP) || defined(DOXYGEN)
+    arm_biquad_casd_df1_inst_q15 arm;   /**< CMSIS-DSP instance */
+#endif
+    const int16_t *coeffs;  /**< coefficients, 6 per stage */
+    int16_t *state;         /**< state buffer, 4 per stage */
+    uint8_t num_stages;     /**< number of stages */
+    uint8_t post_shift;     /**< shift applied to the accumulator */
+} sigproc_biquad_t;
+
+/**
+ * @brief   Initialize a FIR filter
+ *
+ * With a @p factor larger than 1 only every @p factor-th output sample is
+ * computed, so the filter also decimates its input.
+ *
+ * @param[out] fir          filter to initialize
+ * @param[in] coeffs        coefficients in time reversed order
+ * @param[in] num_taps      number of coefficients, must be even and >= 4
+ * @param[in] factor        decimation factor, 1 for plain filtering
+ * @param[out] state        state buffer of
+ *                          SIGPROC_FIR_STATE_LEN(@p num_taps, @p block_size)
+ *                          samples
+ * @param[in] block_size    maximum number of input samples per call, must be
+ *                          a multiple of @p factor
+ *
+ * @return  0 on success
+ * @return  -EINVAL on invalid parameters
+ */
+int sigproc_fir_init(sigproc_fir_t *fir, const int16_t *coeffs,
+                     uint16_t num_taps, uint8_t factor, int16_t *state,
+                     size_t block_size);
+
+/**
+ * @brief   Filter a block of samples
+ *
+ * @param[in,out] fir   filter to use
+ * @param[in] in        input samples
+ * @param[out] out      output samples, `len / factor` are written
+ * @param[in] len       number of input samples, at most the block size given
+ *                      to sigproc_fir_init() and a multiple of the factor
+ */
+void sigproc_fir(sigproc_fir_t *fir, const int16_t *in, int16_t *out,
+                 size_t len);
+
+/**
+ * @brief   Initialize a biquad cascade
+ *
+ * Each stage uses the coefficients `{b0, 0, b1, b2, a1, a2}` and computes
+ * `y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]`.
+ * Note that the feedback coefficients are added, so they are the negated
+ * values of common filter design tools.
+ *
+ * @param[out] iir          filter to initialize
+ * @param[in] coeffs        coefficients, 6 per stage
+ * @param[in] num_stages    number of stages
+ * @param[out] state        state buffer of
+ *                          SIGPROC_BIQUAD_STATE_LEN(@p num_stages) samples
+ * @param[in] post_shift    left shift of the accumulator, allows for
+ *                          coefficients in Q(15 - @p post_shift) format
+ *                          (0 - 15)
+ *
+ * @return  0 on success
+ * @return  -EINVAL on invalid parameters
+ */
+int sigproc_biquad_init(sigproc_biquad_t *iir, const int16_t *coeffs,
+                        uint8_t num_stages, int16_t *state,
+                        uint8_t post_shift);
+
+/**
+ * @brief   Filter a block of samples
+ *
+ * @param[in,out] iir   filter to use
+ * @param[in] in        input samples
+ * @param[out] out      output samples, may equal @p in
+ * @param[in] len       number of samples
+ */
+void sigproc_biquad(sigproc_biquad_t *iir, const int16_t *in, int16_t *out,
+                    size_t len);
+
+/**
+ * @brief   Compute the root mean square of a block of samples
+ *
+ * @note    CMSIS-DSP approximates the square root, so the result may differ
+ *          in the last bits from the scalar implementation.
+ *
+ * @param[in] in        samples
+ * @param[in] len       number of samples, must not be 0
+ *
+ * @return  root mean square in Q15
+ */
+int16_t sigproc_rms(const int16_t *in, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIGPROC_H */
+/** @} */
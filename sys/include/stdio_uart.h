@@ -52,6 +52,66 @@ extern "C" {
 #define STDIO_UART_RX_BUFSIZE   (64)
 #endif
 
+#ifndef STDIO_UART_DMA_BUFSIZE
+/**
+ * @brief Size of the DMA receive buffer used with the `periph_uart_dma` feature
+ */
+#define STDIO_UART_DMA_BUFSIZE  (32)
+#endif
+
+/**
+ * @name Overflow policies of the `stdio_uart_async` TX buffer
+ * @{
+ */
+#define STDIO_UART_TX_DROP      (0) /**< drop the bytes that do not fit */
+#define STDIO_UART_TX_BLOCK     (1) /**< wait for space, write synchronously
+                                     *   in interrupt context */
+#define STDIO_UART_TX_OVERWRITE (2) /**< discard the oldest buffered bytes */
+/** @} */
+
+#ifndef STDIO_UART_TX_BUFSIZE
+/**
+ * @brief Size of the TX ring buffer used with `stdio_uart_async`
+ *
+ * With `stdio_uart_async`, stdio_write() only copies the output into this
+ * buffer. A separate thread hands it to the UART, using DMA if the
+ * `periph_uart_dma` module is used, so the writing thread is not stalled
+ * until the bytes are clocked out. Must be a power of two.
+ */
+#define STDIO_UART_TX_BUFSIZE   (256)
+#endif
+
+#ifndef STDIO_UART_TX_CHUNK
+/**
+ * @brief Maximum number of bytes handed to the UART at once
+ */
+#define STDIO_UART_TX_CHUNK     (32)
+#endif
+
+#ifndef STDIO_UART_TX_OVERFLOW
+/**
+ * @brief Behavior of stdio_write() if the TX buffer is full
+ */
+#define STDIO_UART_TX_OVERFLOW  STDIO_UART_TX_BLOCK
+#endif
+
+#ifndef STDIO_UART_TX_PRIO
+/**
+ * @brief Priority of the thread writing the TX buffer to the UART
+ *
+ * Threads of a higher priority are never delayed by output, but the buffer
+ * only drains while they are idle.
+ */
+#define STDIO_UART_TX_PRIO      (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+#ifndef STDIO_UART_TX_STACKSIZE
+/**
+ * @brief Stack size of the thread writing the TX buffer to the UART
+ */
+#define STDIO_UART_TX_STACKSIZE (THREAD_STACKSIZE_SMALL)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,8 @@
 #include <stdint.h>
 #include <inttypes.h>
 
+#include "div.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -130,8 +132,10 @@ int timex_cmp(const timex_t a, const timex_t b);
  */
 static inline void timex_normalize(timex_t *time)
 {
-    time->seconds += (time->microseconds / US_PER_SEC);
-    time->microseconds %= US_PER_SEC;
+    uint32_t seconds = div_u32_by_const(time->microseconds, US_PER_SEC);
+
+    time->seconds += seconds;
+    time->microseconds -= seconds * US_PER_SEC;
 }
 
 /**
@@ -168,7 +172,9 @@ static inline uint64_t timex_uint64(const timex_t a)
  */
 static inline timex_t timex_from_uint64(const uint64_t timestamp)
 {
-    return timex_set(timestamp / US_PER_SEC, timestamp % US_PER_SEC);
+    uint64_t seconds = div_u64_by_1000000(timestamp);
+
+    return timex_set(seconds, timestamp - seconds * US_PER_SEC);
 }
 
 /**
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_tracebuf Event trace buffer
+ * @ingroup     sys
+ * @brief       Binary ring buffer of time stamped events
+ *
+ * The tracebuf module records events as a time stamp, a 32-bit event ID and a
+ * 32-bit argument into a static ring buffer. Recording an event takes a few
+ * instructions with interrupts disabled, so it can stay enabled in the field
+ * and be used from any context, unlike printf() based DEBUG() output. When
+ * the buffer is full, the oldest events are overwritten.
+ *
+ * With this module in use, the kernel and network stack record the events
+ * listed in @ref tracebuf_event_t. Applications can add their own events
+ * starting at @ref TRACEBUF_USER.
+ *
+ * @ref tracebuf_dump prints the buffer (also available as `tracebuf` shell
+ * command). `dist/tools/tracebuf/decode.py` turns this output into a readable
+ * time line on the host.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event trace buffer interface definition
+ */
+
+#ifndef TRACEBUF_H
+#define TRACEBUF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of events kept in the buffer, must be a power of two
+ */
+#ifndef TRACEBUF_SIZE
+#define TRACEBUF_SIZE       (64U)
+#endif
+
+/**
+ * @brief   IDs of the events recorded by RIOT itself
+ */
+typedef enum {
+    TRACEBUF_SCHED_SWITCH = 1,  /**< context switch,
+                                     arg: PID of the next thread */
+    TRACEBUF_MSG_SEND,          /**< message sent,
+                                     arg: target PID << 16 | type */
+    TRACEBUF_MSG_RECV,          /**< message received,
+                                     arg: sender PID << 16 | type */
+    TRACEBUF_ISR_END,           /**< end of an interrupt service routine,
+                                     arg: exception number (Cortex-M only) */
+    TRACEBUF_NETAPI_DISPATCH,   /**< GNRC packet dispatched,
+                                     arg: nettype << 16 | command */
+    TRACEBUF_PKTBUF_ALLOC,      /**< GNRC packet buffer chunk allocated,
+                                     arg: address */
+    TRACEBUF_PKTBUF_FREE,       /**< GNRC packet buffer chunk freed,
+                                     arg: address */
+    TRACEBUF_USER = 0x100,      /**< first ID for application defined events */
+} tracebuf_event_t;
+
+/**
+ * @brief   A recorded event
+ */
+typedef struct {
+    uint32_t time;      /**< xtimer ticks at the time of the event */
+    uint32_t id;        /**< event ID */
+    uint32_t arg;       /**< event argument */
+} tracebuf_entry_t;
+
+/**
+ * @brief   Record an event
+ *
+ * Can be called from any context.
+ *
+ * @param[in] id        event ID
+ * @param[in] arg       event argument
+ */
+void tracebuf_add(uint32_t id, uint32_t arg);
+
+/**
+ * @brief   Get the number of events in the buffer
+ *
+ * @return  number of events, at most @ref TRACEBUF_SIZE
+ */
+unsigned tracebuf_count(void);
+
+/**
+ * @brief   Get an event from the buffer
+ *
+ * @param[in]  n        index of the event, 0 is the oldest one
+ * @param[out] entry    the event
+ *
+ * @return  0 on success
+ * @return  -1 if there are not more than @p n events
+ */
+int tracebuf_get(unsigned n, tracebuf_entry_t *entry);
+
+/**
+ * @brief   Remove all events from the buffer
+ */
+void tracebuf_clear(void);
+
+/**
+ * @brief   Enable or disable recording
+ *
+ * Recording is enabled by default. Disabling it freezes the buffer, e.g. to
+ * keep the events that led to an error.
+ *
+ * @param[in] enable    true to enable recording
+ */
+void tracebuf_enable(bool enable);
+
+/**
+ * @brief   Print all events to stdout, oldest first
+ *
+ * Recording is paused during the dump. Each event is printed as a line
+ * `tracebuf: <time> <id> <arg>`, with all three values in hex.
+ */
+void tracebuf_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACEBUF_H */
+/** @} */
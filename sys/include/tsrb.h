@@ -15,6 +15,19 @@
  * @note        This ringbuffer implementation can be used without locking if
  *              there's only one producer and one consumer.
  *
+ * Bulk transfers with @ref tsrb_get and @ref tsrb_add copy the data with at
+ * most two calls to memcpy().
+ *
+ * A consumer that wants to operate on the buffered data in place, e.g. a
+ * parser, uses @ref tsrb_peek_region to get a pointer to the next contiguous
+ * chunk of buffered data and @ref tsrb_drop to release it afterwards.
+ * Likewise, a producer such as a DMA transfer can fill the buffer directly
+ * using @ref tsrb_space_region and @ref tsrb_commit.
+ *
+ * @warning     Producer and consumer must run on the same CPU core (e.g. an
+ *              ISR and a thread), accesses are not ordered by hardware memory
+ *              barriers.
+ *
  * @attention   Buffer size must be a power of two!
  *
  * @file
@@ -153,6 +166,41 @@ int tsrb_add_one(tsrb_t *rb, char c);
  */
 int tsrb_add(tsrb_t *rb, const char *src, size_t n);
 
+/**
+ * @brief       Get the next contiguous chunk of buffered data
+ *
+ * The data stays in the ringbuffer until it is released with
+ * @ref tsrb_drop. If the buffered data wraps around the end of the buffer,
+ * only the part up to the end is returned. Must only be called by the
+ * consumer.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the buffered data
+ * @return      nr of bytes available at @p data
+ */
+size_t tsrb_peek_region(tsrb_t *rb, char **data);
+
+/**
+ * @brief       Get the next contiguous chunk of free space
+ *
+ * Data written to the chunk is added to the ringbuffer with
+ * @ref tsrb_commit. If the free space wraps around the end of the buffer, only
+ * the part up to the end is returned. Must only be called by the producer.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  space   start of the free space
+ * @return      nr of bytes that can be written to @p space
+ */
+size_t tsrb_space_region(tsrb_t *rb, char **space);
+
+/**
+ * @brief       Add bytes written to the region returned by
+ *              @ref tsrb_space_region to the ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written, must not exceed the size of the region
+ */
+void tsrb_commit(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -159,6 +159,22 @@ typedef enum {
      * Objects can be nested.
      */
     UBJSON_KEY,
+
+    /**
+     * @brief The end of an array was reached.
+     *
+     * Only emitted by ubjson_read_iterative().
+     * `content1` is the number of items in the array.
+     */
+    UBJSON_LEAVE_ARRAY,
+
+    /**
+     * @brief The end of an object was reached.
+     *
+     * Only emitted by ubjson_read_iterative().
+     * `content1` is the number of keys in the object.
+     */
+    UBJSON_LEAVE_OBJECT,
 } ubjson_type_t;
 
 /**
@@ -264,8 +280,60 @@ struct ubjson_cookie {
      * @internal
      */
     char marker;
+
+    /**
+     * @brief     Output buffer of ubjson_write_init_buffered()
+     * @internal
+     */
+    struct {
+        ubjson_write_t write; /**< write function of the user */
+        char *buf;            /**< buffer */
+        size_t size;          /**< size of the buffer */
+        size_t pos;           /**< number of buffered bytes */
+    } wbuf;
 };
 
+/**
+ * @brief        State of one nesting level for ubjson_read_iterative()
+ */
+typedef struct {
+    ssize_t count;    /**< number of items, or -1 if not specified */
+    ssize_t index;    /**< index of the next item */
+    char type_marker; /**< marker of typed containers, or 0 */
+    bool object;      /**< the level is an object, not an array */
+} ubjson_read_level_t;
+
+/**
+ * @brief         Read UBJSON serialized data without recursion.
+ * @details       Works like ubjson_read(), but nested arrays and objects are
+ *                tracked in @p stack instead of recursive calls, so the stack
+ *                usage does not depend on the input.
+ *
+ *                The callback is invoked with the same types, with these
+ *                differences:
+ *                @arg For UBJSON_ENTER_ARRAY and UBJSON_ENTER_OBJECT the
+ *                     callback must not call ubjson_read_array() or
+ *                     ubjson_read_object(), the contents follow in subsequent
+ *                     invocations.
+ *                @arg For UBJSON_INDEX the callback must not call
+ *                     ubjson_read_next(), and for UBJSON_KEY it only reads the
+ *                     key. The value follows in the next invocation.
+ *                @arg The end of a container is signaled by
+ *                     UBJSON_LEAVE_ARRAY and UBJSON_LEAVE_OBJECT.
+ * @param[in]     cookie     The cookie that is passed to the callback function.
+ * @param[in]     read       The function that is called to receive more data.
+ * @param[in]     callback   The callback function.
+ * @param[out]    stack      Memory for @p depth nesting levels.
+ * @param[in]     depth      Maximum nesting depth.
+ * @returns       See \ref ubjson_read_callback_result_t,
+ *                UBJSON_SIZE_ERROR if the data is nested deeper than @p depth.
+ */
+ubjson_read_callback_result_t ubjson_read_iterative(ubjson_cookie_t *__restrict cookie,
+                                                    ubjson_read_t read,
+                                                    ubjson_read_callback_t callback,
+                                                    ubjson_read_level_t *stack,
+                                                    size_t depth);
+
 /**
  * @brief         Used to read with a setup cookie.
  * @details       You need to use this function instead of ubjson_read() only if
@@ -439,8 +507,33 @@ ubjson_read_callback_result_t ubjson_read_object(ubjson_cookie_t *__restrict coo
 static inline void ubjson_write_init(ubjson_cookie_t *__restrict cookie, ubjson_write_t write_fun)
 {
     cookie->rw.write = write_fun;
+    cookie->wbuf.pos = 0;
 }
 
+/**
+ * @brief         Setup a cookie for writing through a buffer.
+ * @details       The small pieces written for each value are collected in @p buf,
+ *                and @p write_fun is invoked with full chunks of @p size bytes,
+ *                with large strings directly if the buffer is empty,
+ *                and by ubjson_write_flush().
+ * @param[out]    cookie      The cookie that will be passed to ubjson_write_null() and friends.
+ * @param[in]     write_fun   The function that will be called to write data.
+ * @param[in]     buf         The buffer, determines the size of the chunks written.
+ * @param[in]     size        The size of @p buf, must not be 0.
+ */
+void ubjson_write_init_buffered(ubjson_cookie_t *__restrict cookie, ubjson_write_t write_fun,
+                                void *buf, size_t size);
+
+/**
+ * @brief         Write out the buffered data.
+ * @details       Needs to be called after the last value was written
+ *                with a cookie setup by ubjson_write_init_buffered().
+ * @param[in]     cookie     The cookie.
+ * @returns       The result of the write function,
+ *                or `0` if there was nothing to write.
+ */
+ssize_t ubjson_write_flush(ubjson_cookie_t *__restrict cookie);
+
 /**
  * @brief         Write a null value.
  * @param[in]     cookie     The cookie that was initialized with ubjson_write_init().
@@ -70,6 +70,7 @@ using std::atomic_int;
 
 #include "kernel_types.h"
 #include "clist.h"
+#include "iolist.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -153,6 +154,14 @@ extern "C" {
 #define VFS_NAME_MAX (31)
 #endif
 
+#ifndef VFS_PATH_MAX
+/**
+ * @brief Maximum length of a path assembled by @ref vfs_openat (not including
+ *        terminating null)
+ */
+#define VFS_PATH_MAX (63)
+#endif
+
 /**
  * @brief Used with vfs_bind to bind to any available fd number
  */
@@ -230,6 +239,7 @@ typedef struct {
 typedef struct {
     const vfs_dir_ops_t *d_op; /**< Directory operations table */
     vfs_mount_t *mp;           /**< Pointer to mount table entry */
+    const char *path;          /**< Name passed to vfs_opendir, for vfs_openat */
     union {
         void *ptr;             /**< pointer to private data */
         int value;             /**< alternatively, you can use private_data as an int */
@@ -250,6 +260,20 @@ typedef struct {
     char  d_name[VFS_NAME_MAX + 1]; /**< file name, relative to its containing directory */
 } vfs_dirent_t;
 
+/**
+ * @brief Consumer of file data for @ref vfs_sendfile
+ *
+ * Typically wraps a sock send function, e.g. `sock_udp_send()`.
+ *
+ * @param[in]  arg      opaque argument passed to @ref vfs_sendfile
+ * @param[in]  data     file data, only valid during the call
+ * @param[in]  len      number of bytes at @p data
+ *
+ * @return number of bytes consumed, may be less than @p len
+ * @return <0 on error, the transfer is aborted
+ */
+typedef ssize_t (*vfs_sendfile_cb_t)(void *arg, const void *data, size_t len);
+
 /**
  * @brief Operations on open files
  *
@@ -370,6 +394,41 @@ struct vfs_file_ops {
      * @return <0 on error
      */
     ssize_t (*write) (vfs_file_t *filp, const void *src, size_t nbytes);
+
+    /**
+     * @brief Pass file contents to a consumer without copying them
+     *
+     * Optional. File systems that keep file contents in addressable memory
+     * can implement this to hand out pointers to the data directly. Starts at
+     * the current position and advances it by the number of bytes consumed.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  cb       consumer of the data
+     * @param[in]  arg      argument to @p cb
+     * @param[in]  nbytes   maximum number of bytes to pass
+     *
+     * @return number of bytes consumed by @p cb on success
+     * @return <0 on error
+     */
+    ssize_t (*sendfile) (vfs_file_t *filp, vfs_sendfile_cb_t cb, void *arg, size_t nbytes);
+
+    /**
+     * @brief Get a read-only pointer to file contents in memory
+     *
+     * Optional. Only file systems that keep file contents in addressable
+     * memory, e.g. in internal flash, can implement this. The VFS layer has
+     * already checked that the file is open for reading.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  off      offset of the first byte to map
+     * @param[in]  len      number of bytes to map
+     * @param[out] addr     address of the byte at @p off
+     *
+     * @return 0 on success
+     * @return -EINVAL if the range exceeds the file
+     * @return <0 on other errors
+     */
+    int (*mmap) (vfs_file_t *filp, off_t off, size_t len, const void **addr);
 };
 
 /**
@@ -669,6 +728,80 @@ ssize_t vfs_read(int fd, void *dest, size_t count);
  */
 ssize_t vfs_write(int fd, const void *src, size_t count);
 
+/**
+ * @brief Read bytes from an open file into a list of buffers
+ *
+ * Similar to POSIX readv(2). The buffers of @p iolist are filled in order
+ * until the end of the file is reached.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  iolist   list of destination buffers
+ *
+ * @return number of bytes read on success
+ * @return <0 on error, if no bytes were read
+ */
+ssize_t vfs_readv(int fd, const iolist_t *iolist);
+
+/**
+ * @brief Write a list of buffers to an open file
+ *
+ * Similar to POSIX writev(2). Lets the caller write e.g. header, payload and
+ * checksum of a record without assembling it in a temporary buffer first.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  iolist   list of source buffers
+ *
+ * @return number of bytes written on success
+ * @return <0 on error, if no bytes were written
+ */
+ssize_t vfs_writev(int fd, const iolist_t *iolist);
+
+/**
+ * @brief Pass the contents of an open file to a consumer
+ *
+ * Similar to sendfile(2), starting at the current position of @p fd. If the
+ * file system driver supports it, @p cb is called with pointers directly into
+ * the file data and @p buf is not used. Otherwise the data is read into @p buf
+ * in chunks of at most @p buf_len bytes.
+ *
+ * @note If @p cb fails, the file position may be advanced past the last byte
+ * that was consumed.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  cb       consumer of the data
+ * @param[in]  arg      argument to @p cb
+ * @param[in]  buf      scratch buffer, may be NULL for drivers with native support
+ * @param[in]  buf_len  size of @p buf
+ * @param[in]  count    maximum number of bytes to pass
+ *
+ * @return number of bytes consumed by @p cb on success
+ * @return <0 on error, if no bytes were consumed
+ */
+ssize_t vfs_sendfile(int fd, vfs_sendfile_cb_t cb, void *arg,
+                     void *buf, size_t buf_len, size_t count);
+
+/**
+ * @brief Access the contents of an open file in place
+ *
+ * Similar to a read-only POSIX mmap(2). Files that are stored in addressable
+ * memory, e.g. constfs files in flash, can be used directly without copying
+ * them to RAM first. The file position is not changed.
+ *
+ * @note The returned memory must not be written to. It remains valid until
+ * @p fd is closed.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  off      offset of the first byte to map
+ * @param[in]  len      number of bytes to map
+ * @param[out] addr     address of the byte at @p off
+ *
+ * @return 0 on success
+ * @return -ENOTSUP if the file system does not support in place access
+ * @return -EINVAL if the range exceeds the file
+ * @return <0 on other errors
+ */
+int vfs_mmap(int fd, off_t off, size_t len, const void **addr);
+
 /**
  * @brief Open a directory for reading with readdir
  *
@@ -682,6 +815,27 @@ ssize_t vfs_write(int fd, const void *src, size_t count);
  */
 int vfs_opendir(vfs_DIR *dirp, const char *dirname);
 
+/**
+ * @brief Open a file in a directory opened with vfs_opendir
+ *
+ * Similar to POSIX openat(2). The mount point lookup of @p dirp is reused, so
+ * opening several files in the same directory does less work than
+ * @ref vfs_open with full paths.
+ *
+ * @attention The @p dirname passed to vfs_opendir must remain valid and
+ * unchanged while @p dirp is in use with this function.
+ *
+ * @param[in]  dirp     directory opened with vfs_opendir
+ * @param[in]  name     null-terminated name of the file, relative to @p dirp
+ * @param[in]  flags    flags for opening, see man 2 open, man 3p open
+ * @param[in]  mode     mode for creating a new file, see man 2 open, man 3p open
+ *
+ * @return fd number on success (>= 0)
+ * @return -ENAMETOOLONG if the resulting path is longer than @ref VFS_PATH_MAX
+ * @return <0 on error
+ */
+int vfs_openat(const vfs_DIR *dirp, const char *name, int flags, mode_t mode);
+
 /**
  * @brief Read a single entry from the open directory dirp and advance the
  * read position by one
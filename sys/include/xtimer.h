@@ -20,6 +20,11 @@
  * number of active timers.  The reason for this is that multiplexing is
  * realized by next-first singly linked lists.
  *
+ * With the `xtimer_heap` module the timers are kept in pairing heaps instead,
+ * which makes insertion O(1) and removal O(log n) amortized, at the cost of two
+ * additional pointers per @ref xtimer_t. Timers with the exact same target
+ * time may then fire in any order.
+ *
  * @{
  * @file
  * @brief   xtimer interface definitions
@@ -74,6 +79,12 @@ typedef struct xtimer {
     xtimer_callback_t callback;  /**< callback function to call when timer
                                      expires */
     void *arg;                   /**< argument to pass to callback function */
+#if defined(MODULE_XTIMER_HEAP) || defined(DOXYGEN)
+    struct xtimer *child;        /**< first child in timer heap
+                                      (only with `xtimer_heap`) */
+    struct xtimer *prev;         /**< previous sibling or parent in timer heap
+                                      (only with `xtimer_heap`) */
+#endif
 } xtimer_t;
 
 /**
@@ -312,6 +323,42 @@ static inline void xtimer_set(xtimer_t *timer, uint32_t offset);
  */
 static inline void xtimer_set64(xtimer_t *timer, uint64_t offset_us);
 
+/**
+ * @brief Set a timer that may execute its callback somewhat later than
+ *        requested
+ *
+ * Like xtimer_set(), but the callback may be executed up to @p slack
+ * microseconds after @p offset. The actual expiry is rounded within that
+ * window to a tick with as many trailing zero bits as possible, so timers
+ * with overlapping windows expire at the same time and are handled in a
+ * single wake-up.
+ *
+ * @warning BEWARE! Callbacks from xtimer_set_slack() are being executed in
+ * interrupt context (unless offset < XTIMER_BACKOFF). DON'T USE THIS FUNCTION
+ * unless you know *exactly* what that means.
+ *
+ * @param[in] timer     the timer structure to use.
+ *                      Its xtimer_t::target and xtimer_t::long_target
+ *                      fields need to be initialized with 0 on first use
+ * @param[in] offset    earliest time in microseconds from now specifying
+ *                      that timer's callback's execution time
+ * @param[in] slack     maximum time in microseconds the execution may be
+ *                      delayed beyond @p offset
+ */
+static inline void xtimer_set_slack(xtimer_t *timer, uint32_t offset,
+                                    uint32_t slack);
+
+/**
+ * @brief Get the time until xtimer needs the CPU next
+ *
+ * This is either the expiry of the next timer or the next overflow of the
+ * low-level timer, whichever comes first. Power management can use this to
+ * select a power mode it can wake up from in time.
+ *
+ * @return  ticks until the next low-level timer interrupt
+ */
+xtimer_ticks32_t xtimer_until_next(void);
+
 /**
  * @brief remove a timer
  *
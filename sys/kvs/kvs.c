@@ -0,0 +1,738 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_kvs
+ * @{
+ *
+ * @file
+ * @brief       Log-structured key-value store implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "hashes.h"
+#include "kvs.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define KVS_MAGIC           (0x3153564bUL)  /* "KVS1" */
+
+#define SLOT_EMPTY          (UINT32_MAX)
+#define SLOT_DELETED        (UINT32_MAX - 1)
+
+#define REC_VALUE           (0xff)
+#define REC_DELETED         (0x00)
+
+#define KEY_ERASED          (0xff)
+
+/* size of the buffer used to move data from and to the device */
+#define CHUNK_SIZE          (32U)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+} sector_hdr_t;
+
+typedef struct {
+    uint8_t key_len;
+    uint8_t flags;
+    uint16_t val_len;
+    uint16_t crc;
+    uint16_t reserved;
+} rec_hdr_t;
+
+/* number of header bytes covered by the CRC */
+#define REC_HDR_CRC_LEN     (offsetof(rec_hdr_t, crc))
+
+static inline uint32_t _align(uint32_t n)
+{
+    return (n + KVS_WRITE_ALIGN - 1) & ~(KVS_WRITE_ALIGN - 1);
+}
+
+static inline uint32_t _rec_size(const rec_hdr_t *rec)
+{
+    return _align(sizeof(rec_hdr_t) + rec->key_len + rec->val_len);
+}
+
+static inline uint32_t _min(uint32_t a, uint32_t b)
+{
+    return (a < b) ? a : b;
+}
+
+static int _read(kvs_t *kvs, uint32_t addr, void *buf, uint32_t len)
+{
+    uint8_t *out = buf;
+
+    addr += kvs->first_sector * kvs->sector_size;
+    while (len) {
+        int res = mtd_read(kvs->mtd, out, addr, len);
+        if (res <= 0) {
+            return (res < 0) ? res : -EIO;
+        }
+        out += res;
+        addr += res;
+        len -= res;
+    }
+    return 0;
+}
+
+static int _write(kvs_t *kvs, uint32_t addr, const void *buf, uint32_t len)
+{
+    const uint8_t *in = buf;
+
+    addr += kvs->first_sector * kvs->sector_size;
+    while (len) {
+        /* page programs must not cross a page boundary */
+        uint32_t n = _min(len, kvs->mtd->page_size - (addr % kvs->mtd->page_size));
+        int res = mtd_write(kvs->mtd, in, addr, n);
+        if (res <= 0) {
+            return (res < 0) ? res : -EIO;
+        }
+        in += res;
+        addr += res;
+        len -= res;
+    }
+    return 0;
+}
+
+static int _erase(kvs_t *kvs, uint32_t sector)
+{
+    DEBUG("kvs: erase sector %lu\n", (unsigned long)sector);
+    return mtd_erase(kvs->mtd, (kvs->first_sector + sector) * kvs->sector_size,
+                     kvs->sector_size);
+}
+
+/**
+ * @brief   Read the header of @p sector
+ *
+ * @return  1 if the sector is in use, 0 if it is erased, < 0 otherwise
+ */
+static int _sector_seq(kvs_t *kvs, uint32_t sector, uint32_t *seq)
+{
+    sector_hdr_t hdr;
+    int res = _read(kvs, sector * kvs->sector_size, &hdr, sizeof(hdr));
+
+    if (res < 0) {
+        return res;
+    }
+    if (hdr.magic == KVS_MAGIC) {
+        *seq = hdr.seq;
+        return 1;
+    }
+    if ((hdr.magic == UINT32_MAX) && (hdr.seq == UINT32_MAX)) {
+        return 0;
+    }
+    return -EILSEQ;
+}
+
+static int _open_sector(kvs_t *kvs, uint32_t sector)
+{
+    sector_hdr_t hdr = { .magic = KVS_MAGIC, .seq = kvs->seq + 1 };
+
+    DEBUG("kvs: open sector %lu (seq %lu)\n", (unsigned long)sector,
+          (unsigned long)hdr.seq);
+    int res = _write(kvs, sector * kvs->sector_size, &hdr, sizeof(hdr));
+    if (res < 0) {
+        return res;
+    }
+    kvs->seq = hdr.seq;
+    kvs->active = sector;
+    kvs->pos = sizeof(hdr);
+    return 0;
+}
+
+/**
+ * @brief   Compare @p len bytes on the device at @p addr with @p buf
+ */
+static int _equal(kvs_t *kvs, uint32_t addr, const void *buf, uint32_t len)
+{
+    const uint8_t *cmp = buf;
+    uint8_t chunk[CHUNK_SIZE];
+
+    while (len) {
+        uint32_t n = _min(len, sizeof(chunk));
+        int res = _read(kvs, addr, chunk, n);
+        if (res < 0) {
+            return res;
+        }
+        if (memcmp(chunk, cmp, n) != 0) {
+            return 0;
+        }
+        cmp += n;
+        addr += n;
+        len -= n;
+    }
+    return 1;
+}
+
+static int _key_matches(kvs_t *kvs, uint32_t addr, const char *key, uint8_t key_len)
+{
+    rec_hdr_t rec;
+    int res = _read(kvs, addr, &rec, sizeof(rec));
+
+    if (res < 0) {
+        return res;
+    }
+    if (rec.key_len != key_len) {
+        return 0;
+    }
+    return _equal(kvs, addr + sizeof(rec), key, key_len);
+}
+
+/**
+ * @brief   Look up the index slot of @p key
+ *
+ * @param[out] free     first slot usable for inserting @p key, may be NULL
+ *
+ * @return  slot of @p key, NULL if @p key is not in the index
+ */
+static kvs_slot_t *_find(kvs_t *kvs, const char *key, uint8_t key_len,
+                         uint32_t hash, kvs_slot_t **free)
+{
+    size_t mask = kvs->index_len - 1;
+    kvs_slot_t *first_free = NULL;
+
+    for (size_t n = 0, i = hash & mask; n < kvs->index_len; n++, i = (i + 1) & mask) {
+        kvs_slot_t *slot = &kvs->index[i];
+
+        if (slot->addr == SLOT_EMPTY) {
+            if (!first_free) {
+                first_free = slot;
+            }
+            break;
+        }
+        if (slot->addr == SLOT_DELETED) {
+            if (!first_free) {
+                first_free = slot;
+            }
+            continue;
+        }
+        if ((slot->hash == hash) &&
+            (_key_matches(kvs, slot->addr, key, key_len) == 1)) {
+            return slot;
+        }
+    }
+    if (free) {
+        *free = first_free;
+    }
+    return NULL;
+}
+
+static int _index_update(kvs_t *kvs, const char *key, uint8_t key_len,
+                         uint32_t addr, bool deleted)
+{
+    uint32_t hash = djb2_hash((const uint8_t *)key, key_len);
+    kvs_slot_t *free;
+    kvs_slot_t *slot = _find(kvs, key, key_len, hash, &free);
+
+    if (deleted) {
+        if (slot) {
+            slot->addr = SLOT_DELETED;
+        }
+        return 0;
+    }
+    if (!slot) {
+        if (!free) {
+            return -ENOMEM;
+        }
+        slot = free;
+        slot->hash = hash;
+    }
+    slot->addr = addr;
+    return 0;
+}
+
+/**
+ * @brief   Read and verify the record at @p addr
+ *
+ * @param[out] key      buffer for the key, may be NULL
+ *
+ * @return  1 if there is a valid record
+ * @return  0 if the space at @p addr is unused or holds a broken record
+ * @return  < 0 on device errors
+ */
+static int _read_record(kvs_t *kvs, uint32_t addr, rec_hdr_t *rec, char *key)
+{
+    uint32_t end = (addr / kvs->sector_size + 1) * kvs->sector_size;
+    uint8_t chunk[CHUNK_SIZE];
+    int res;
+
+    if (addr + sizeof(*rec) > end) {
+        return 0;
+    }
+    res = _read(kvs, addr, rec, sizeof(*rec));
+    if (res < 0) {
+        return res;
+    }
+    if ((rec->key_len == KEY_ERASED) || (rec->key_len == 0) ||
+        (rec->key_len > KVS_KEY_LEN_MAX) || (addr + _rec_size(rec) > end)) {
+        return 0;
+    }
+
+    uint16_t crc = crc16_ccitt_calc((const uint8_t *)rec, REC_HDR_CRC_LEN);
+    uint32_t len = rec->key_len + rec->val_len;
+    addr += sizeof(*rec);
+    for (uint32_t done = 0; done < len;) {
+        uint32_t n = _min(len - done, sizeof(chunk));
+        res = _read(kvs, addr + done, chunk, n);
+        if (res < 0) {
+            return res;
+        }
+        if (key && (done < rec->key_len)) {
+            memcpy(key + done, chunk, _min(n, rec->key_len - done));
+        }
+        crc = crc16_ccitt_update(crc, chunk, n);
+        done += n;
+    }
+    return (crc == rec->crc);
+}
+
+static int _write_record(kvs_t *kvs, const char *key, uint8_t key_len,
+                         const void *val, uint16_t val_len, uint8_t flags)
+{
+    rec_hdr_t rec = {
+        .key_len = key_len,
+        .flags = flags,
+        .val_len = val_len,
+        .reserved = UINT16_MAX,
+    };
+    rec.crc = crc16_ccitt_calc((const uint8_t *)&rec, REC_HDR_CRC_LEN);
+    rec.crc = crc16_ccitt_update(rec.crc, (const uint8_t *)key, key_len);
+    rec.crc = crc16_ccitt_update(rec.crc, val, val_len);
+
+    /* assemble header, key, value and padding in chunks, the device may
+     * not be able to write at unaligned addresses */
+    const uint8_t *src[] = { (const uint8_t *)&rec, (const uint8_t *)key, val };
+    uint32_t left[] = { sizeof(rec), key_len, val_len };
+    uint32_t addr = kvs->active * kvs->sector_size + kvs->pos;
+    uint32_t end = addr + _rec_size(&rec);
+    uint8_t chunk[CHUNK_SIZE];
+    unsigned part = 0;
+
+    while (addr < end) {
+        uint32_t n = 0;
+        uint32_t max = _min(end - addr, sizeof(chunk));
+        while (n < max) {
+            if (part == sizeof(left) / sizeof(left[0])) {
+                chunk[n++] = 0xff;
+            }
+            else if (left[part] == 0) {
+                part++;
+            }
+            else {
+                uint32_t c = _min(left[part], max - n);
+                memcpy(&chunk[n], src[part], c);
+                src[part] += c;
+                left[part] -= c;
+                n += c;
+            }
+        }
+        int res = _write(kvs, addr, chunk, n);
+        if (res < 0) {
+            return res;
+        }
+        addr += n;
+    }
+    kvs->pos += _rec_size(&rec);
+    return 0;
+}
+
+/**
+ * @brief   Add all records of @p sector to the index
+ *
+ * @return  offset behind the last valid record of @p sector
+ */
+static int _replay(kvs_t *kvs, uint32_t sector, uint32_t *end)
+{
+    uint32_t off = sizeof(sector_hdr_t);
+    char key[KVS_KEY_LEN_MAX];
+    rec_hdr_t rec = { .key_len = KEY_ERASED };
+    int res;
+
+    while ((res = _read_record(kvs, sector * kvs->sector_size + off, &rec, key)) == 1) {
+        res = _index_update(kvs, key, rec.key_len, sector * kvs->sector_size + off,
+                            rec.flags == REC_DELETED);
+        if (res < 0) {
+            return res;
+        }
+        off += _rec_size(&rec);
+    }
+    if (res < 0) {
+        return res;
+    }
+    if ((off + sizeof(rec) <= kvs->sector_size) && (rec.key_len != KEY_ERASED)) {
+        /* broken record, nothing can be appended behind it */
+        DEBUG("kvs: broken record in sector %lu at %lu\n", (unsigned long)sector,
+              (unsigned long)off);
+        off = kvs->sector_size;
+    }
+    *end = off;
+    return 0;
+}
+
+/**
+ * @brief   Find the used sector with the lowest sequence number above @p seq
+ *
+ * @return  sector, UINT32_MAX if there is none
+ */
+static uint32_t _next_used(kvs_t *kvs, uint32_t seq, uint32_t *next_seq)
+{
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t s = 0; s < kvs->sector_num; s++) {
+        uint32_t tmp;
+        if ((_sector_seq(kvs, s, &tmp) == 1) && (tmp > seq) &&
+            ((best == UINT32_MAX) || (tmp < *next_seq))) {
+            best = s;
+            *next_seq = tmp;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief   Find an erased sector, starting after the active one
+ *
+ * @return  sector, UINT32_MAX if there is none
+ */
+static uint32_t _next_free(kvs_t *kvs, unsigned *count)
+{
+    uint32_t first = UINT32_MAX;
+
+    *count = 0;
+    for (uint32_t i = 1; i <= kvs->sector_num; i++) {
+        uint32_t s = (kvs->active + i) % kvs->sector_num;
+        uint32_t seq;
+        if (_sector_seq(kvs, s, &seq) == 0) {
+            if (first == UINT32_MAX) {
+                first = s;
+            }
+            (*count)++;
+        }
+    }
+    return first;
+}
+
+/**
+ * @brief   Iterate over the live records of @p sector
+ *
+ * With @p copy set the records are moved to the active sector, otherwise
+ * only their size is summed up in @p live.
+ */
+static int _live_records(kvs_t *kvs, uint32_t sector, bool copy, uint32_t *live)
+{
+    uint32_t off = sizeof(sector_hdr_t);
+    char key[KVS_KEY_LEN_MAX];
+    rec_hdr_t rec;
+    int res;
+
+    *live = 0;
+    while ((res = _read_record(kvs, sector * kvs->sector_size + off, &rec, key)) == 1) {
+        uint32_t addr = sector * kvs->sector_size + off;
+        off += _rec_size(&rec);
+
+        /* tombstones in the oldest sector can go, there is nothing older
+         * left they could hide */
+        if (rec.flags == REC_DELETED) {
+            continue;
+        }
+        uint32_t hash = djb2_hash((const uint8_t *)key, rec.key_len);
+        kvs_slot_t *slot = _find(kvs, key, rec.key_len, hash, NULL);
+        if (!slot || (slot->addr != addr)) {
+            continue;
+        }
+        if (copy) {
+            uint8_t chunk[CHUNK_SIZE];
+            uint32_t to = kvs->active * kvs->sector_size + kvs->pos;
+            for (uint32_t done = 0; done < _rec_size(&rec);) {
+                uint32_t n = _min(_rec_size(&rec) - done, sizeof(chunk));
+                res = _read(kvs, addr + done, chunk, n);
+                if (res == 0) {
+                    res = _write(kvs, to + done, chunk, n);
+                }
+                if (res < 0) {
+                    return res;
+                }
+                done += n;
+            }
+            slot->addr = to;
+            kvs->pos += _rec_size(&rec);
+        }
+        *live += _rec_size(&rec);
+    }
+    return res;
+}
+
+/**
+ * @brief   Reclaim the oldest sector
+ *
+ * @param[in] open      allow opening a new sector for the live records
+ *
+ * @return  1 if a sector was reclaimed, 0 if not
+ */
+static int _gc(kvs_t *kvs, bool open)
+{
+    uint32_t seq = 0;
+    uint32_t oldest = _next_used(kvs, 0, &seq);
+    uint32_t live;
+    int res;
+
+    if (oldest == UINT32_MAX) {
+        return 0;
+    }
+    res = _live_records(kvs, oldest, false, &live);
+    if (res < 0) {
+        return res;
+    }
+    if ((oldest == kvs->active) || (kvs->pos + live > kvs->sector_size)) {
+        unsigned count;
+        uint32_t free = _next_free(kvs, &count);
+        if (!open || (free == UINT32_MAX)) {
+            return 0;
+        }
+        res = _open_sector(kvs, free);
+        if (res < 0) {
+            return res;
+        }
+    }
+    res = _live_records(kvs, oldest, true, &live);
+    if (res < 0) {
+        return res;
+    }
+    res = _erase(kvs, oldest);
+    return (res < 0) ? res : 1;
+}
+
+/**
+ * @brief   Make room for a record of @p size bytes in the active sector
+ */
+static int _reserve(kvs_t *kvs, uint32_t size)
+{
+    for (uint32_t i = 0; i <= kvs->sector_num; i++) {
+        unsigned count;
+        uint32_t free;
+        int res;
+
+        if (kvs->pos + size <= kvs->sector_size) {
+            return 0;
+        }
+        free = _next_free(kvs, &count);
+        if (count >= 2) {
+            res = _open_sector(kvs, free);
+        }
+        else {
+            /* keep the last erased sector for compacting */
+            res = _gc(kvs, true);
+            if (res == 0) {
+                return -ENOSPC;
+            }
+        }
+        if (res < 0) {
+            return res;
+        }
+    }
+    return -ENOSPC;
+}
+
+int kvs_init(kvs_t *kvs, mtd_dev_t *mtd, uint32_t first_sector,
+             uint32_t sector_num, kvs_slot_t *index, size_t index_len)
+{
+    if ((sector_num < 2) || (index_len == 0) || (index_len & (index_len - 1)) ||
+        (first_sector + sector_num > mtd->sector_count)) {
+        return -EINVAL;
+    }
+
+    kvs->mtd = mtd;
+    kvs->first_sector = first_sector;
+    kvs->sector_num = sector_num;
+    kvs->sector_size = mtd->pages_per_sector * mtd->page_size;
+    kvs->index = index;
+    kvs->index_len = index_len;
+    kvs->active = 0;
+    kvs->pos = 0;
+    kvs->seq = 0;
+    mutex_init(&kvs->lock);
+
+    for (size_t i = 0; i < index_len; i++) {
+        index[i].addr = SLOT_EMPTY;
+    }
+
+    for (uint32_t s = 0; s < sector_num; s++) {
+        uint32_t seq;
+        int res = _sector_seq(kvs, s, &seq);
+        if (res == -EILSEQ) {
+            res = _erase(kvs, s);
+        }
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    uint32_t seq = 0;
+    uint32_t sector;
+    while ((sector = _next_used(kvs, seq, &seq)) != UINT32_MAX) {
+        int res = _replay(kvs, sector, &kvs->pos);
+        if (res < 0) {
+            return res;
+        }
+        kvs->active = sector;
+        kvs->seq = seq;
+    }
+
+    if (kvs->seq == 0) {
+        return _open_sector(kvs, 0);
+    }
+    return 0;
+}
+
+int kvs_format(kvs_t *kvs)
+{
+    int res = 0;
+
+    mutex_lock(&kvs->lock);
+    for (uint32_t s = 0; (s < kvs->sector_num) && (res == 0); s++) {
+        res = _erase(kvs, s);
+    }
+    for (size_t i = 0; i < kvs->index_len; i++) {
+        kvs->index[i].addr = SLOT_EMPTY;
+    }
+    kvs->seq = 0;
+    if (res == 0) {
+        res = _open_sector(kvs, 0);
+    }
+    mutex_unlock(&kvs->lock);
+
+    return res;
+}
+
+int kvs_get(kvs_t *kvs, const char *key, void *val, size_t len)
+{
+    size_t key_len = strlen(key);
+    int res = -ENOENT;
+
+    if ((key_len == 0) || (key_len > KVS_KEY_LEN_MAX)) {
+        return -ENOENT;
+    }
+
+    mutex_lock(&kvs->lock);
+    kvs_slot_t *slot = _find(kvs, key, key_len,
+                             djb2_hash((const uint8_t *)key, key_len), NULL);
+    if (slot) {
+        rec_hdr_t rec;
+        res = _read(kvs, slot->addr, &rec, sizeof(rec));
+        if (res == 0) {
+            res = _read(kvs, slot->addr + sizeof(rec) + key_len, val,
+                        _min(len, rec.val_len));
+        }
+        if (res == 0) {
+            res = rec.val_len;
+        }
+    }
+    mutex_unlock(&kvs->lock);
+
+    return res;
+}
+
+int kvs_set(kvs_t *kvs, const char *key, const void *val, size_t len)
+{
+    size_t key_len = strlen(key);
+    rec_hdr_t rec = { .key_len = key_len, .val_len = len };
+    kvs_slot_t *free;
+    int res;
+
+    if ((key_len == 0) || (key_len > KVS_KEY_LEN_MAX) || (len >= UINT16_MAX) ||
+        (_rec_size(&rec) > kvs->sector_size - sizeof(sector_hdr_t))) {
+        return -EINVAL;
+    }
+
+    mutex_lock(&kvs->lock);
+    uint32_t hash = djb2_hash((const uint8_t *)key, key_len);
+    kvs_slot_t *slot = _find(kvs, key, key_len, hash, &free);
+    if (slot) {
+        /* skip rewriting an unchanged value */
+        rec_hdr_t old;
+        res = _read(kvs, slot->addr, &old, sizeof(old));
+        if ((res == 0) && (old.val_len == len)) {
+            res = _equal(kvs, slot->addr + sizeof(old) + key_len, val, len);
+            if (res == 1) {
+                res = 0;
+                goto out;
+            }
+        }
+        if (res < 0) {
+            goto out;
+        }
+    }
+    else if (!free) {
+        res = -ENOMEM;
+        goto out;
+    }
+
+    res = _reserve(kvs, _rec_size(&rec));
+    if (res == 0) {
+        uint32_t addr = kvs->active * kvs->sector_size + kvs->pos;
+        res = _write_record(kvs, key, key_len, val, len, REC_VALUE);
+        if (res == 0) {
+            res = _index_update(kvs, key, key_len, addr, false);
+        }
+    }
+
+out:
+    mutex_unlock(&kvs->lock);
+    return res;
+}
+
+int kvs_delete(kvs_t *kvs, const char *key)
+{
+    size_t key_len = strlen(key);
+    rec_hdr_t rec = { .key_len = key_len, .val_len = 0 };
+    int res = -ENOENT;
+
+    if ((key_len == 0) || (key_len > KVS_KEY_LEN_MAX)) {
+        return -ENOENT;
+    }
+
+    mutex_lock(&kvs->lock);
+    kvs_slot_t *slot = _find(kvs, key, key_len,
+                             djb2_hash((const uint8_t *)key, key_len), NULL);
+    if (slot) {
+        res = _reserve(kvs, _rec_size(&rec));
+        if (res == 0) {
+            res = _write_record(kvs, key, key_len, NULL, 0, REC_DELETED);
+        }
+        if (res == 0) {
+            /* compacting in _reserve() does not move slots */
+            slot->addr = SLOT_DELETED;
+        }
+    }
+    mutex_unlock(&kvs->lock);
+
+    return res;
+}
+
+int kvs_gc(kvs_t *kvs)
+{
+    unsigned count;
+    int res = 0;
+
+    mutex_lock(&kvs->lock);
+    _next_free(kvs, &count);
+    if (count < 2) {
+        res = _gc(kvs, false);
+    }
+    mutex_unlock(&kvs->lock);
+
+    return res;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_log_binary
+ * @{
+ *
+ * @file
+ * @brief       Deferred binary log implementation
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+
+#include "log_module.h"
+
+#define FLAG_DATA       (0x1)
+
+/* a record is a header byte (level << 4 | nargs), the ID and the arguments */
+#define HDR_SIZE        (1U + sizeof(uint32_t))
+
+static char _buf_mem[LOG_BINARY_BUFSIZE];
+static tsrb_t _rb = TSRB_INIT(_buf_mem);
+static unsigned _dropped;
+static char _stack[LOG_BINARY_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+/* serializes the readers: the thread and log_binary_flush() */
+static mutex_t _print_lock = MUTEX_INIT;
+
+static void *_thread(void *arg);
+
+static void _start_thread(void)
+{
+    static mutex_t init_lock = MUTEX_INIT;
+
+    mutex_lock(&init_lock);
+    if (_pid == KERNEL_PID_UNDEF) {
+        kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                         THREAD_PRIORITY_MIN - 1,
+                                         THREAD_CREATE_STACKTEST,
+                                         _thread, NULL, "log");
+        _pid = (pid < 0) ? KERNEL_PID_UNDEF : pid;
+    }
+    mutex_unlock(&init_lock);
+}
+
+void log_binary_write(unsigned level, const char *fmt, unsigned nargs,
+                      const uint32_t *args)
+{
+    uint8_t rec[HDR_SIZE + LOG_BINARY_ARGS_MAX * sizeof(uint32_t)];
+    uint32_t id = (uint32_t)(uintptr_t)fmt;
+    size_t len = HDR_SIZE + nargs * sizeof(uint32_t);
+
+    rec[0] = (level << 4) | nargs;
+    memcpy(&rec[1], &id, sizeof(id));
+    memcpy(&rec[HDR_SIZE], args, nargs * sizeof(uint32_t));
+
+    unsigned state = irq_disable();
+    if (tsrb_free(&_rb) >= len) {
+        tsrb_add(&_rb, (char *)rec, len);
+    }
+    else {
+        _dropped++;
+    }
+    irq_restore(state);
+
+    if (_pid != KERNEL_PID_UNDEF) {
+        thread_flags_set((thread_t *)thread_get(_pid), FLAG_DATA);
+    }
+    else if (!irq_is_in() && (sched_active_thread != NULL)) {
+        _start_thread();
+    }
+}
+
+unsigned log_binary_dropped(void)
+{
+    return _dropped;
+}
+
+/* records are only added as a whole, so a header implies a complete record */
+static bool _print_one(void)
+{
+    uint8_t rec[HDR_SIZE + LOG_BINARY_ARGS_MAX * sizeof(uint32_t)];
+    uint32_t id;
+
+    unsigned state = irq_disable();
+    if (tsrb_get(&_rb, (char *)rec, 1) != 1) {
+        irq_restore(state);
+        return false;
+    }
+    unsigned nargs = rec[0] & 0xf;
+    tsrb_get(&_rb, (char *)&rec[1], HDR_SIZE - 1 + nargs * sizeof(uint32_t));
+    irq_restore(state);
+
+    memcpy(&id, &rec[1], sizeof(id));
+    printf("log: %08lx %u", (unsigned long)id, (unsigned)(rec[0] >> 4));
+    for (unsigned i = 0; i < nargs; i++) {
+        uint32_t arg;
+        memcpy(&arg, &rec[HDR_SIZE + i * sizeof(uint32_t)], sizeof(arg));
+        printf(" %08lx", (unsigned long)arg);
+    }
+    puts("");
+    return true;
+}
+
+void log_binary_flush(void)
+{
+    mutex_lock(&_print_lock);
+    while (_print_one()) {}
+    mutex_unlock(&_print_lock);
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_flags_wait_any(FLAG_DATA);
+        log_binary_flush();
+    }
+    return NULL;
+}
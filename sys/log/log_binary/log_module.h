@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_log_binary Deferred binary log module
+ * @ingroup     sys
+ * @brief       Log module storing raw arguments instead of formatted text
+ *
+ * A log statement records the address of its format string, which serves as
+ * ID, and its arguments as 32 bit words into a ring buffer. This costs a few
+ * instructions with interrupts disabled instead of a call to printf(). A
+ * thread of the lowest priority prints the records as lines
+ * `log: <id> <level> <args...>` in hex. `dist/tools/log_binary/decode.py`
+ * looks the format strings up in the ELF file and formats the messages on the
+ * host. Unless the application uses printf() elsewhere, its formatting code is
+ * not linked in.
+ *
+ * Limitations:
+ * - at most @ref LOG_BINARY_ARGS_MAX arguments per statement
+ * - every argument is converted to `uint32_t`, so floating point arguments are
+ *   not supported and `%s` only shows the address of the string
+ * - records that do not fit into the buffer are dropped and counted
+ *
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ */
+
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the record buffer in bytes, must be a power of two
+ */
+#ifndef LOG_BINARY_BUFSIZE
+#define LOG_BINARY_BUFSIZE      (256U)
+#endif
+
+/**
+ * @brief   Maximum number of arguments of a log statement
+ */
+#define LOG_BINARY_ARGS_MAX     (8U)
+
+/**
+ * @brief   Stack size of the thread printing the records
+ */
+#ifndef LOG_BINARY_STACKSIZE
+#define LOG_BINARY_STACKSIZE    (THREAD_STACKSIZE_SMALL)
+#endif
+
+/**
+ * @brief   Records a log statement
+ *
+ * Can be called from any context. Usually called by the LOG_* macros.
+ *
+ * @param[in] level     log level
+ * @param[in] fmt       format string, its address is stored as ID
+ * @param[in] nargs     number of arguments, at most @ref LOG_BINARY_ARGS_MAX
+ * @param[in] args      arguments
+ */
+void log_binary_write(unsigned level, const char *fmt, unsigned nargs,
+                      const uint32_t *args);
+
+/**
+ * @brief   Get the number of records dropped because the buffer was full
+ *
+ * @return  number of dropped records
+ */
+unsigned log_binary_dropped(void);
+
+/**
+ * @brief   Print all buffered records in the calling thread
+ *
+ * Useful before a reboot or in a crash handler.
+ */
+void log_binary_flush(void);
+
+/**
+ * @cond INTERNAL
+ * @{
+ */
+#define _LOG_BINARY_ARG(x)              ((uint32_t)(uintptr_t)(x))
+#define _LOG_BINARY_MAP0()
+#define _LOG_BINARY_MAP1(a)             , _LOG_BINARY_ARG(a)
+#define _LOG_BINARY_MAP2(a, ...)        , _LOG_BINARY_ARG(a) _LOG_BINARY_MAP1(__VA_ARGS__)
+#define _LOG_BINARY_MAP3(a, ...)        , _LOG_BINARY_ARG(a) _LOG_BINARY_MAP2(__VA_ARGS__)
+#define _LOG_BINARY_MAP4(a, ...)        , _LOG_BINARY_ARG(a) _LOG_BINARY_MAP3(__VA_ARGS__)
+#define _LOG_BINARY_MAP5(a, ...)        , _LOG_BINARY_ARG(a) _LOG_BINARY_MAP4(__VA_ARGS__)
+#define _LOG_BINARY_MAP6(a, ...)        , _LOG_BINARY_ARG(a) _LOG_BINARY_MAP5(__VA_ARGS__)
+#define _LOG_BINARY_MAP7(a, ...)        , _LOG_BINARY_ARG(a) _LOG_BINARY_MAP6(__VA_ARGS__)
+#define _LOG_BINARY_MAP8(a, ...)        , _LOG_BINARY_ARG(a) _LOG_BINARY_MAP7(__VA_ARGS__)
+#define _LOG_BINARY_NARGS(...) \
+    _LOG_BINARY_NARGS_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define _LOG_BINARY_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+#define _LOG_BINARY_CAT(a, b)           _LOG_BINARY_CAT_(a, b)
+#define _LOG_BINARY_CAT_(a, b)          a ## b
+/**
+ * @}
+ * @endcond
+ */
+
+/**
+ * @brief   log_write overridden function
+ *
+ * Collects the arguments into a compound literal; its first element is a
+ * placeholder, so statements without arguments need no special case.
+ */
+#define log_write(level, fmt, ...) \
+    log_binary_write((level), (fmt), _LOG_BINARY_NARGS(__VA_ARGS__), \
+                     &((const uint32_t[]){ 0 \
+                        _LOG_BINARY_CAT(_LOG_BINARY_MAP, \
+                                        _LOG_BINARY_NARGS(__VA_ARGS__)) \
+                        (__VA_ARGS__) })[1])
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
+#endif /* LOG_MODULE_H */
@@ -0,0 +1,527 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_log_flash
+ * @{
+ *
+ * @file
+ * @brief       Compressed flash log implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "assert.h"
+#include "checksum/crc16_ccitt.h"
+#include "heatshrink_encoder.h"
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#ifdef MODULE_VFS
+#include "vfs.h"
+#endif
+
+#include "log_module.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#define FLAG_DATA       (0x1)
+#define ERASED_MAGIC    (0xffffffffUL)
+
+static uint8_t _raw[2][LOG_FLASH_BLOCK_SIZE];
+/* a block other than _raw[_fill] with a length waits for the thread */
+static uint16_t _raw_len[2];
+static unsigned _fill;
+static unsigned _dropped;
+
+/* serializes the storage and the encoder */
+static mutex_t _store_lock = MUTEX_INIT;
+static heatshrink_encoder _hse;
+static uint8_t _data[LOG_FLASH_BLOCK_SIZE];
+static uint32_t _seq;
+static bool _ready;
+
+static char _stack[LOG_FLASH_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+static struct {
+#ifdef MODULE_MTD
+    mtd_dev_t *mtd;
+    uint32_t first;         /* first sector of the ring */
+    uint32_t numof;         /* number of sectors of the ring */
+    uint32_t sector_size;
+    uint32_t head;          /* sector written to, relative to first */
+#endif
+#ifdef MODULE_VFS
+    int fd;
+#endif
+    uint32_t pos;           /* append offset in the head sector or file */
+} _store;
+
+#ifdef MODULE_MTD
+#define IS_MTD()        (_store.mtd != NULL)
+#else
+#define IS_MTD()        (false)
+#endif
+
+/* blocks in mtd sectors start at word boundaries */
+static uint32_t _block_len(uint16_t len)
+{
+    uint32_t res = sizeof(log_flash_hdr_t) + len;
+
+    return IS_MTD() ? ((res + 3) & ~3UL) : res;
+}
+
+static int _read(uint32_t sector, uint32_t offset, void *buf, size_t len)
+{
+#ifdef MODULE_MTD
+    if (IS_MTD()) {
+        if (offset + len > _store.sector_size) {
+            return -ENOENT;
+        }
+        int res = mtd_read(_store.mtd, buf,
+                           (_store.first + sector) * _store.sector_size +
+                           offset, len);
+        return (res < 0) ? res : 0;
+    }
+#endif
+    (void)sector;
+#ifdef MODULE_VFS
+    if (vfs_lseek(_store.fd, offset, SEEK_SET) < 0) {
+        return -EIO;
+    }
+
+    ssize_t res = vfs_read(_store.fd, buf, len);
+
+    if (res < 0) {
+        return res;
+    }
+    return ((size_t)res == len) ? 0 : -ENOENT;
+#else
+    (void)offset;
+    (void)buf;
+    (void)len;
+    return -ENODEV;
+#endif
+}
+
+static int _write(uint32_t offset, const void *buf, size_t len)
+{
+#ifdef MODULE_MTD
+    if (IS_MTD()) {
+        int res = mtd_write(_store.mtd, buf,
+                            (_store.first + _store.head) * _store.sector_size +
+                            offset, len);
+        return (res < 0) ? res : 0;
+    }
+#endif
+#ifdef MODULE_VFS
+    if (vfs_lseek(_store.fd, offset, SEEK_SET) < 0) {
+        return -EIO;
+    }
+
+    ssize_t res = vfs_write(_store.fd, buf, len);
+
+    if (res < 0) {
+        return res;
+    }
+    return ((size_t)res == len) ? 0 : -ENOSPC;
+#else
+    (void)offset;
+    (void)buf;
+    (void)len;
+    return -ENODEV;
+#endif
+}
+
+static uint16_t _crc(const log_flash_hdr_t *hdr, const void *data)
+{
+    uint16_t crc = crc16_ccitt_calc((const uint8_t *)hdr,
+                                    offsetof(log_flash_hdr_t, crc));
+
+    return crc16_ccitt_update(crc, data, hdr->len);
+}
+
+/* reads and verifies the block at offset, -ENOENT marks erased space or the
+ * end of the file, -EBADMSG a torn block */
+static int _read_block(uint32_t sector, uint32_t offset, log_flash_hdr_t *hdr,
+                       void *data, size_t len)
+{
+    int res = _read(sector, offset, hdr, sizeof(*hdr));
+
+    if (res < 0) {
+        return res;
+    }
+    if (hdr->magic != LOG_FLASH_MAGIC) {
+        return (hdr->magic == ERASED_MAGIC) ? -ENOENT : -EBADMSG;
+    }
+    if ((hdr->len > len) || (hdr->len > LOG_FLASH_BLOCK_SIZE)) {
+        return -EBADMSG;
+    }
+    res = _read(sector, offset + sizeof(*hdr), data, hdr->len);
+    if (res < 0) {
+        return (res == -ENOENT) ? -EBADMSG : res;
+    }
+    return (_crc(hdr, data) == hdr->crc) ? 0 : -EBADMSG;
+}
+
+/* finds the end of the blocks in a sector or file */
+static int _scan(uint32_t sector, uint32_t *end, uint32_t *last_seq,
+                 bool *found)
+{
+    log_flash_hdr_t hdr;
+    uint32_t offset = 0;
+    int res;
+
+    while ((res = _read_block(sector, offset, &hdr, _data,
+                              sizeof(_data))) == 0) {
+        if (!*found || ((int32_t)(hdr.seq - *last_seq) > 0)) {
+            *last_seq = hdr.seq;
+        }
+        *found = true;
+        offset += _block_len(hdr.len);
+    }
+    *end = offset;
+    return res;
+}
+
+#ifdef MODULE_MTD
+static int _next_sector(void)
+{
+    _store.head = (_store.head + 1) % _store.numof;
+    _store.pos = 0;
+    DEBUG("log_flash: erasing sector %lu\n",
+          (unsigned long)(_store.first + _store.head));
+    return mtd_erase(_store.mtd,
+                     (_store.first + _store.head) * _store.sector_size,
+                     _store.sector_size);
+}
+#endif
+
+/* returns the compressed length, 0 if the data doesn't shrink */
+static size_t _compress(uint8_t *in, size_t len, uint8_t *out, size_t out_len)
+{
+    size_t in_pos = 0;
+    size_t out_pos = 0;
+
+    heatshrink_encoder_reset(&_hse);
+    while (1) {
+        if (in_pos < len) {
+            size_t sunk = 0;
+
+            heatshrink_encoder_sink(&_hse, &in[in_pos], len - in_pos, &sunk);
+            in_pos += sunk;
+        }
+        else if (heatshrink_encoder_finish(&_hse) == HSER_FINISH_DONE) {
+            return out_pos;
+        }
+
+        HSE_poll_res res;
+
+        do {
+            size_t written = 0;
+
+            if (out_pos >= out_len) {
+                return 0;
+            }
+            res = heatshrink_encoder_poll(&_hse, &out[out_pos],
+                                          out_len - out_pos, &written);
+            out_pos += written;
+        } while (res == HSER_POLL_MORE);
+    }
+}
+
+static int _store_block(uint8_t *raw, uint16_t raw_len)
+{
+    log_flash_hdr_t hdr = {
+        .magic = LOG_FLASH_MAGIC,
+        .seq = _seq,
+        .raw_len = raw_len,
+    };
+    const uint8_t *data = _data;
+    int res;
+
+    /* only keep the compressed data if it is shorter */
+    hdr.len = _compress(raw, raw_len, _data, raw_len - 1);
+    if (hdr.len > 0) {
+        hdr.flags = LOG_FLASH_COMPRESSED;
+    }
+    else {
+        hdr.len = raw_len;
+        data = raw;
+    }
+    hdr.crc = _crc(&hdr, data);
+
+#ifdef MODULE_MTD
+    if (IS_MTD() && ((_store.pos + _block_len(hdr.len)) > _store.sector_size)) {
+        res = _next_sector();
+        if (res < 0) {
+            return res;
+        }
+    }
+#endif
+    res = _write(_store.pos, &hdr, sizeof(hdr));
+    if (res == 0) {
+        res = _write(_store.pos + sizeof(hdr), data, hdr.len);
+    }
+    if (res < 0) {
+        DEBUG("log_flash: writing block %lu failed (%d)\n",
+              (unsigned long)hdr.seq, res);
+        /* don't append to a torn block */
+#ifdef MODULE_MTD
+        if (IS_MTD()) {
+            _store.pos = _store.sector_size;
+        }
+#endif
+        return res;
+    }
+    DEBUG("log_flash: block %lu, %u -> %u bytes\n", (unsigned long)hdr.seq,
+          (unsigned)raw_len, (unsigned)hdr.len);
+    _store.pos += _block_len(hdr.len);
+    _seq++;
+    return 0;
+}
+
+/* writes the block waiting for the thread, call with _store_lock held */
+static int _write_pending(void)
+{
+    unsigned state = irq_disable();
+    unsigned idx = _fill ^ 1;
+    uint16_t len = _raw_len[idx];
+    irq_restore(state);
+
+    if (len == 0) {
+        return 0;
+    }
+
+    int res = _store_block(_raw[idx], len);
+
+    /* the block is released even if it couldn't be written */
+    state = irq_disable();
+    _raw_len[idx] = 0;
+    irq_restore(state);
+    return res;
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_flags_wait_any(FLAG_DATA);
+        mutex_lock(&_store_lock);
+        _write_pending();
+        mutex_unlock(&_store_lock);
+    }
+    return NULL;
+}
+
+static int _start(void)
+{
+    if (_pid == KERNEL_PID_UNDEF) {
+        kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                         THREAD_PRIORITY_MIN - 1,
+                                         THREAD_CREATE_STACKTEST,
+                                         _thread, NULL, "log_flash");
+        if (pid < 0) {
+            return -ENOMEM;
+        }
+        _pid = pid;
+    }
+    _ready = true;
+    /* messages logged before may already fill a block */
+    thread_flags_set((thread_t *)thread_get(_pid), FLAG_DATA);
+    return 0;
+}
+
+#ifdef MODULE_MTD
+int log_flash_init_mtd(mtd_dev_t *mtd, uint32_t first, uint32_t numof)
+{
+    uint32_t last_seq = 0;
+    bool found = false;
+    int res;
+
+    assert(mtd && (numof >= 2));
+
+    mutex_lock(&_store_lock);
+    _store.mtd = mtd;
+    _store.first = first;
+    _store.numof = numof;
+    _store.sector_size = mtd->pages_per_sector * mtd->page_size;
+    assert(_store.sector_size >=
+           sizeof(log_flash_hdr_t) + LOG_FLASH_BLOCK_SIZE);
+
+    for (uint32_t sector = 0; sector < numof; sector++) {
+        uint32_t prev = last_seq;
+        bool prev_found = found;
+        uint32_t end;
+
+        res = _scan(sector, &end, &last_seq, &found);
+        /* the head is the sector holding the newest block */
+        if (found && (!prev_found || (last_seq != prev))) {
+            _store.head = sector;
+            _store.pos = (res == -ENOENT) ? end : _store.sector_size;
+        }
+    }
+
+    res = 0;
+    if (!found) {
+        /* start a new ring in the first sector */
+        _store.head = numof - 1;
+        res = _next_sector();
+    }
+    _seq = found ? last_seq + 1 : 0;
+    if (res == 0) {
+        res = _start();
+    }
+    mutex_unlock(&_store_lock);
+    return res;
+}
+#endif
+
+#ifdef MODULE_VFS
+int log_flash_init_vfs(const char *path)
+{
+    uint32_t last_seq = 0;
+    bool found = false;
+    int res;
+
+    mutex_lock(&_store_lock);
+    _store.fd = vfs_open(path, O_RDWR | O_CREAT, 0);
+    if (_store.fd < 0) {
+        mutex_unlock(&_store_lock);
+        return _store.fd;
+    }
+    /* a torn block at the end is overwritten by the next one */
+    _scan(0, &_store.pos, &last_seq, &found);
+    _seq = found ? last_seq + 1 : 0;
+    res = _start();
+    mutex_unlock(&_store_lock);
+    return res;
+}
+#endif
+
+void log_flash_write(unsigned level, const char *format, ...)
+{
+    char line[LOG_FLASH_LINE_MAX];
+    va_list args;
+    int len = snprintf(line, sizeof(line), "%u ", level);
+
+    va_start(args, format);
+    int res = vsnprintf(&line[len], sizeof(line) - len, format, args);
+    va_end(args);
+    if (res < 0) {
+        return;
+    }
+    len += res;
+    if (len >= (int)sizeof(line)) {
+        /* truncated */
+        len = sizeof(line) - 1;
+        line[len - 1] = '\n';
+    }
+
+    unsigned state = irq_disable();
+    if ((_raw_len[_fill] + (unsigned)len) > LOG_FLASH_BLOCK_SIZE) {
+        unsigned other = _fill ^ 1;
+
+        if (_raw_len[other] != 0) {
+            /* still waiting for the thread */
+            _dropped++;
+            irq_restore(state);
+            return;
+        }
+        _fill = other;
+        if (_ready) {
+            thread_flags_set((thread_t *)thread_get(_pid), FLAG_DATA);
+        }
+    }
+    memcpy(&_raw[_fill][_raw_len[_fill]], line, len);
+    _raw_len[_fill] += len;
+    irq_restore(state);
+}
+
+int log_flash_flush(void)
+{
+    int res;
+
+    mutex_lock(&_store_lock);
+    if (!_ready) {
+        mutex_unlock(&_store_lock);
+        return -ENODEV;
+    }
+    res = _write_pending();
+
+    /* the other block is free now, hand over the current one */
+    unsigned state = irq_disable();
+    if (_raw_len[_fill] != 0) {
+        _fill ^= 1;
+    }
+    irq_restore(state);
+
+    if (res == 0) {
+        res = _write_pending();
+    }
+    mutex_unlock(&_store_lock);
+    return res;
+}
+
+unsigned log_flash_dropped(void)
+{
+    return _dropped;
+}
+
+void log_flash_iter_init(log_flash_iter_t *iter)
+{
+    iter->offset = 0;
+    iter->sectors = 0;
+}
+
+ssize_t log_flash_iter_next(log_flash_iter_t *iter, log_flash_hdr_t *hdr,
+                            void *data, size_t len)
+{
+    ssize_t res = -ENOENT;
+
+    mutex_lock(&_store_lock);
+    while (_ready) {
+        uint32_t sector = 0;
+
+#ifdef MODULE_MTD
+        if (IS_MTD()) {
+            if (iter->sectors >= _store.numof) {
+                res = -ENOENT;
+                break;
+            }
+            /* the oldest blocks are in the sector after the head */
+            sector = (_store.head + 1 + iter->sectors) % _store.numof;
+        }
+#endif
+        res = _read_block(sector, iter->offset, hdr, data, len);
+        if (res == 0) {
+            iter->offset += _block_len(hdr->len);
+            res = hdr->len;
+            break;
+        }
+        if (!IS_MTD() || ((res != -ENOENT) && (res != -EBADMSG))) {
+            break;
+        }
+        iter->sectors++;
+        iter->offset = 0;
+    }
+    mutex_unlock(&_store_lock);
+    return (res == -EBADMSG) ? -ENOENT : res;
+}
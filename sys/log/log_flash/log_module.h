@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_log_flash Compressed flash log module
+ * @ingroup     sys
+ * @brief       Log module storing compressed blocks of messages in flash
+ *
+ * Log messages are formatted as text lines and collected in a RAM block of
+ * @ref LOG_FLASH_BLOCK_SIZE bytes. A full block is compressed with
+ * @ref pkg_heatshrink by a thread of the lowest priority and appended to the
+ * storage in a single write, so the flash is written once per block instead
+ * of once per message, and the text takes a fraction of its size. Blocks
+ * that don't shrink are stored uncompressed.
+ *
+ * The storage is either a range of sectors of a @ref mtd_dev_t, used as a
+ * ring that erases the oldest sector when it wraps around, or a file on a
+ * @ref sys_vfs file system. Each block starts with a header:
+ *
+ * @code {unparsed}
+ *    magic ("LGZ1"), sequence number, raw length, stored length, flags,
+ *    CRC16 of header and data
+ * @endcode
+ *
+ * The headers chain the blocks and serve as index: log_flash_iter_next()
+ * steps from header to header, oldest block first, and returns the stored
+ * (compressed) data of each, ready to be downloaded and decompressed on the
+ * host. Torn blocks, e.g. due to a power loss while writing, are detected
+ * by their CRC. On initialization the storage is scanned for the newest
+ * block, logging continues behind it.
+ *
+ * @note    Headers are stored in the byte order of the CPU.
+ *
+ * Messages logged before the storage is initialized are kept in RAM as long
+ * as they fit. Messages logged while both RAM blocks are full are dropped
+ * and counted.
+ *
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ */
+
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#ifdef MODULE_MTD
+#include "mtd.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of a block of messages before compression in bytes
+ *
+ * Two blocks are kept in RAM. A block has to fit into a sector of the
+ * mtd device, including its header.
+ */
+#ifndef LOG_FLASH_BLOCK_SIZE
+#define LOG_FLASH_BLOCK_SIZE    (512U)
+#endif
+
+/**
+ * @brief   Maximum length of a formatted message in bytes
+ */
+#ifndef LOG_FLASH_LINE_MAX
+#define LOG_FLASH_LINE_MAX      (96U)
+#endif
+
+/**
+ * @brief   Stack size of the thread writing the blocks
+ */
+#ifndef LOG_FLASH_STACKSIZE
+#define LOG_FLASH_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Magic number of a block header ("LGZ1")
+ */
+#define LOG_FLASH_MAGIC         (0x315a474cUL)
+
+/**
+ * @brief   Block header flag: data is compressed with heatshrink
+ */
+#define LOG_FLASH_COMPRESSED    (0x01)
+
+/**
+ * @brief   Header of a stored block
+ */
+typedef struct {
+    uint32_t magic;         /**< @ref LOG_FLASH_MAGIC */
+    uint32_t seq;           /**< sequence number of the block */
+    uint16_t raw_len;       /**< length of the messages */
+    uint16_t len;           /**< length of the stored data */
+    uint8_t flags;          /**< LOG_FLASH_COMPRESSED or 0 */
+    uint8_t reserved;       /**< 0 */
+    uint16_t crc;           /**< CRC16-CCITT of the header up to here and
+                                 the data */
+} log_flash_hdr_t;
+
+/**
+ * @brief   Position in the stored blocks
+ */
+typedef struct {
+    uint32_t offset;        /**< offset of the next block */
+    uint32_t sectors;       /**< mtd sectors visited */
+} log_flash_iter_t;
+
+#if defined(MODULE_MTD) || defined(DOXYGEN)
+/**
+ * @brief   Store the log in a range of sectors of a mtd device
+ *
+ * @param[in] mtd       initialized device
+ * @param[in] first     first sector to use
+ * @param[in] numof     number of sectors to use, at least 2
+ *
+ * @return  0 on success
+ * @return  negative errno on error
+ */
+int log_flash_init_mtd(mtd_dev_t *mtd, uint32_t first, uint32_t numof);
+#endif
+
+#if defined(MODULE_VFS) || defined(DOXYGEN)
+/**
+ * @brief   Store the log in a file
+ *
+ * The file is created if it does not exist yet.
+ *
+ * @param[in] path      path of the file on a mounted file system
+ *
+ * @return  0 on success
+ * @return  negative errno on error
+ */
+int log_flash_init_vfs(const char *path);
+#endif
+
+/**
+ * @brief   Records a log message
+ *
+ * Usually called by the LOG_* macros.
+ *
+ * @param[in] level     log level
+ * @param[in] format    printf() format string
+ */
+void log_flash_write(unsigned level, const char *format, ...);
+
+/**
+ * @brief   Write all buffered messages to the storage
+ *
+ * Useful before a reboot or before downloading the log. Also writes an
+ * incomplete block.
+ *
+ * @return  0 on success
+ * @return  negative errno on error
+ */
+int log_flash_flush(void);
+
+/**
+ * @brief   Get the number of messages dropped
+ *
+ * @return  number of dropped messages
+ */
+unsigned log_flash_dropped(void);
+
+/**
+ * @brief   Start iterating over the stored blocks, oldest first
+ *
+ * @param[out] iter     iterator to initialize
+ */
+void log_flash_iter_init(log_flash_iter_t *iter);
+
+/**
+ * @brief   Read the next stored block
+ *
+ * @param[in,out] iter  iterator
+ * @param[out] hdr      header of the block
+ * @param[out] data     stored data of the block, decompress it with
+ *                      heatshrink if hdr->flags has
+ *                      @ref LOG_FLASH_COMPRESSED set
+ * @param[in] len       size of @p data, at least @ref LOG_FLASH_BLOCK_SIZE
+ *
+ * @return  length of the stored data
+ * @return  -ENOENT after the last block
+ * @return  negative errno on error
+ */
+ssize_t log_flash_iter_next(log_flash_iter_t *iter, log_flash_hdr_t *hdr,
+                            void *data, size_t len);
+
+/**
+ * @brief   log_write overridden function
+ */
+#define log_write(level, ...)   log_flash_write((level), __VA_ARGS__)
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
+#endif /* LOG_MODULE_H */
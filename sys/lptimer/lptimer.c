@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_lptimer
+ * @{
+ *
+ * @file
+ * @brief       Low-power timer implementation
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "irq.h"
+#include "mutex.h"
+
+#include "lptimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#define RTT_PERIOD      ((uint64_t)RTT_MAX_VALUE + 1)
+#define HANDOVER_TICKS  ((uint64_t)RTT_US_TO_TICKS(LPTIMER_HANDOVER_US))
+
+static uint64_t _base;      /* RTT ticks of all completed RTT periods */
+static uint32_t _last;      /* last RTT counter value read */
+static bool _wrapped;       /* overflow seen before the overflow callback */
+static lptimer_t *_list;    /* pending timers, sorted by target */
+
+static uint64_t _now(void)
+{
+    unsigned state = irq_disable();
+    uint32_t counter = rtt_get_counter();
+
+    if (counter < _last) {
+        /* the RTT overflowed, but the callback did not run yet */
+        _base += RTT_PERIOD;
+        _wrapped = true;
+    }
+    _last = counter;
+
+    uint64_t now = _base + counter;
+    irq_restore(state);
+    return now;
+}
+
+static void _alarm_cb(void *arg);
+
+/* must be called with interrupts disabled */
+static void _update(void)
+{
+    uint64_t now = _now();
+
+    /* hand timers that are due soon over to xtimer */
+    while (_list && (_list->target < now + HANDOVER_TICKS)) {
+        lptimer_t *timer = _list;
+        uint64_t remaining = (timer->target > now) ? (timer->target - now) : 0;
+
+        _list = timer->next;
+        timer->next = NULL;
+        DEBUG("lptimer: hand %p over to xtimer\n", (void *)timer);
+        xtimer_set(&timer->xtimer, RTT_TICKS_TO_US(remaining));
+    }
+
+    if (_list) {
+        /* wake up halfway into the handover period, but at least once per
+         * half RTT period to keep the alarm value unambiguous */
+        uint64_t alarm = _list->target - (HANDOVER_TICKS / 2);
+
+        if ((alarm - now) > (RTT_MAX_VALUE / 2)) {
+            alarm = now + (RTT_MAX_VALUE / 2);
+        }
+        rtt_set_alarm((uint32_t)alarm & RTT_MAX_VALUE, _alarm_cb, NULL);
+    }
+    else {
+        rtt_clear_alarm();
+    }
+}
+
+static void _alarm_cb(void *arg)
+{
+    (void)arg;
+    _update();
+}
+
+static void _overflow_cb(void *arg)
+{
+    (void)arg;
+    if (_wrapped) {
+        _wrapped = false;
+    }
+    else {
+        _base += RTT_PERIOD;
+    }
+    _last = rtt_get_counter();
+}
+
+static void _remove(lptimer_t *timer)
+{
+    for (lptimer_t **ptr = &_list; *ptr; ptr = &(*ptr)->next) {
+        if (*ptr == timer) {
+            *ptr = timer->next;
+            timer->next = NULL;
+            break;
+        }
+    }
+    xtimer_remove(&timer->xtimer);
+}
+
+void lptimer_init(void)
+{
+    rtt_init();
+    _base = 0;
+    _last = 0;
+    _wrapped = false;
+    _list = NULL;
+    rtt_set_counter(0);
+    rtt_set_overflow_cb(_overflow_cb, NULL);
+}
+
+uint64_t lptimer_now_ms64(void)
+{
+    return (_now() * MS_PER_SEC) / RTT_FREQUENCY;
+}
+
+void lptimer_set(lptimer_t *timer, uint32_t offset_ms, xtimer_callback_t cb,
+                 void *arg)
+{
+    unsigned state = irq_disable();
+
+    _remove(timer);
+    timer->xtimer.callback = cb;
+    timer->xtimer.arg = arg;
+    timer->target = _now() + ((uint64_t)offset_ms * RTT_FREQUENCY) / MS_PER_SEC;
+
+    lptimer_t **ptr = &_list;
+    while (*ptr && ((*ptr)->target <= timer->target)) {
+        ptr = &(*ptr)->next;
+    }
+    timer->next = *ptr;
+    *ptr = timer;
+
+    if (_list == timer) {
+        _update();
+    }
+    irq_restore(state);
+}
+
+void lptimer_remove(lptimer_t *timer)
+{
+    unsigned state = irq_disable();
+    bool head = (_list == timer);
+
+    _remove(timer);
+    if (head) {
+        _update();
+    }
+    irq_restore(state);
+}
+
+static void _unlock(void *arg)
+{
+    mutex_unlock(arg);
+}
+
+void lptimer_sleep_ms(uint32_t ms)
+{
+    mutex_t mutex = MUTEX_INIT_LOCKED;
+    lptimer_t timer = { .next = NULL };
+
+    lptimer_set(&timer, ms, _unlock, &mutex);
+    mutex_lock(&mutex);
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_malloc_thread_cache
+ * @{
+ *
+ * @file
+ * @brief       Thread caches for malloc implementation
+ *
+ * @}
+ */
+
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#ifdef MODULE_NEWLIB
+#include <reent.h>
+#endif
+
+#include "irq.h"
+#include "malloc_thread_cache.h"
+#include "rmutex.h"
+#include "thread.h"
+
+#ifdef MODULE_MALLOC_THREAD_CACHE_STATS
+#include "xtimer.h"
+#endif
+
+#if !defined(_NEWLIB_VERSION) && !defined(__GLIBC__)
+#error "malloc_thread_cache needs malloc_usable_size() of newlib or glibc"
+#endif
+
+#define CLASS_SIZE(c)   (MALLOC_THREAD_CACHE_MIN_SIZE << (c))
+
+typedef struct {
+    void *head;         /* free blocks, linked through their first word */
+    uint8_t numof;
+} _cache_t;
+
+void *__real_malloc(size_t size);
+void __real_free(void *ptr);
+
+static _cache_t _caches[MAXTHREADS][MALLOC_THREAD_CACHE_CLASSES];
+#ifdef MODULE_NEWLIB
+static rmutex_t _malloc_lock = RMUTEX_INIT;
+#endif
+
+/* blocks freed in interrupt context, linked through their first word */
+static void *_deferred;
+
+#ifdef MODULE_MALLOC_THREAD_CACHE_STATS
+static malloc_thread_cache_stats_t _stats;
+#endif
+
+/* the caches of the calling thread, NULL if they can't be used */
+static _cache_t *_get_caches(void)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    if ((pid == KERNEL_PID_UNDEF) || irq_is_in()) {
+        return NULL;
+    }
+    return _caches[pid - KERNEL_PID_FIRST];
+}
+
+/* return the blocks freed in interrupt context to the heap */
+static void _free_deferred(void)
+{
+    unsigned state = irq_disable();
+    void *ptr = _deferred;
+
+    _deferred = NULL;
+    irq_restore(state);
+    while (ptr != NULL) {
+        void *next = *(void **)ptr;
+
+        __real_free(ptr);
+        ptr = next;
+    }
+}
+
+void *__wrap_malloc(size_t size)
+{
+    /* the heap lock can't be taken in interrupt context, and the thread it
+     * interrupted may be in the middle of changing the heap */
+    if (irq_is_in()) {
+        return NULL;
+    }
+
+#ifdef MODULE_MALLOC_THREAD_CACHE_STATS
+    uint32_t start = xtimer_now_usec();
+    bool hit = false;
+#endif
+    _cache_t *caches = _get_caches();
+    void *ptr = NULL;
+
+    for (unsigned c = 0; (caches != NULL) && (c < MALLOC_THREAD_CACHE_CLASSES); c++) {
+        if (size <= CLASS_SIZE(c)) {
+            _cache_t *cache = &caches[c];
+
+            if (cache->head != NULL) {
+                ptr = cache->head;
+                cache->head = *(void **)ptr;
+                cache->numof--;
+#ifdef MODULE_MALLOC_THREAD_CACHE_STATS
+                hit = true;
+#endif
+            }
+            else {
+                /* allocate the whole class, so the block can be cached */
+                size = CLASS_SIZE(c);
+            }
+            break;
+        }
+    }
+    if (ptr == NULL) {
+        _free_deferred();
+        ptr = __real_malloc(size);
+    }
+
+#ifdef MODULE_MALLOC_THREAD_CACHE_STATS
+    uint32_t duration = xtimer_now_usec() - start;
+    unsigned state = irq_disable();
+
+    _stats.allocs++;
+    _stats.hits += hit;
+    _stats.total_usec += duration;
+    if (duration > _stats.max_usec) {
+        _stats.max_usec = duration;
+    }
+    irq_restore(state);
+#endif
+    return ptr;
+}
+
+void __wrap_free(void *ptr)
+{
+    if ((ptr != NULL) && irq_is_in()) {
+        /* same as for malloc(), the next thread to use the heap frees it */
+        unsigned state = irq_disable();
+
+        *(void **)ptr = _deferred;
+        _deferred = ptr;
+        irq_restore(state);
+        return;
+    }
+
+    _cache_t *caches = _get_caches();
+
+    if ((ptr != NULL) && (caches != NULL)) {
+        size_t usable = malloc_usable_size(ptr);
+
+        /* any block of the heap can be cached, its class is the largest one
+         * it is big enough for */
+        for (unsigned c = MALLOC_THREAD_CACHE_CLASSES; c-- > 0;) {
+            if (usable >= CLASS_SIZE(c)) {
+                _cache_t *cache = &caches[c];
+
+                if ((usable < 2 * CLASS_SIZE(c)) &&
+                    (cache->numof < MALLOC_THREAD_CACHE_DEPTH)) {
+                    *(void **)ptr = cache->head;
+                    cache->head = ptr;
+                    cache->numof++;
+                    return;
+                }
+                break;
+            }
+        }
+    }
+    _free_deferred();
+    __real_free(ptr);
+}
+
+void malloc_thread_cache_flush(void)
+{
+    _cache_t *caches = _get_caches();
+
+    if (caches == NULL) {
+        return;
+    }
+    _free_deferred();
+    for (unsigned c = 0; c < MALLOC_THREAD_CACHE_CLASSES; c++) {
+        while (caches[c].head != NULL) {
+            void *ptr = caches[c].head;
+
+            caches[c].head = *(void **)ptr;
+            __real_free(ptr);
+        }
+        caches[c].numof = 0;
+    }
+}
+
+#ifdef MODULE_MALLOC_THREAD_CACHE_STATS
+void malloc_thread_cache_get_stats(malloc_thread_cache_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = _stats;
+    irq_restore(state);
+}
+#endif
+
+#ifdef MODULE_NEWLIB
+/* newlib serializes its heap with these hooks, a mutex keeps interrupts
+ * enabled while it walks the free list; before the first thread runs there
+ * is nobody to wait for, and in interrupt context the heap is not used */
+void __malloc_lock(struct _reent *r)
+{
+    (void)r;
+    if (_get_caches() != NULL) {
+        rmutex_lock(&_malloc_lock);
+    }
+}
+
+void __malloc_unlock(struct _reent *r)
+{
+    (void)r;
+    if (_get_caches() != NULL) {
+        rmutex_unlock(&_malloc_lock);
+    }
+}
+#endif
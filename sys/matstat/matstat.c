@@ -7,6 +7,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include "matstat.h"
 
 #define ENABLE_DEBUG    (0)
@@ -94,3 +95,83 @@ void matstat_merge(matstat_state_t *dest, const matstat_state_t *src)
         dest->min = src->min;
     }
 }
+
+void matstat_add_array(matstat_state_t *state, const int32_t *values,
+                       size_t len)
+{
+    if (len == 0) {
+        return;
+    }
+    matstat_state_t block = MATSTAT_STATE_INIT;
+    /* First pass: sum and extremes, no data dependencies between iterations
+     * except for the accumulators */
+    for (size_t k = 0; k < len; ++k) {
+        int32_t value = values[k];
+        block.sum += value;
+        if (value > block.max) {
+            block.max = value;
+        }
+        if (value < block.min) {
+            block.min = value;
+        }
+    }
+    block.count = len;
+    block.mean = block.sum / (int64_t)len;
+    /* Second pass: squared differences to the block mean, which avoids the
+     * cancellation problems of summing plain squares */
+    for (size_t k = 0; k < len; ++k) {
+        int64_t diff = (int64_t)values[k] - block.mean;
+        block.sum_sq += (uint64_t)(diff * diff);
+    }
+    matstat_merge(state, &block);
+}
+
+void matstat_hist_init(matstat_hist_t *hist, uint32_t *bins,
+                       uint16_t num_bins, int32_t offset, uint8_t shift)
+{
+    hist->bins = bins;
+    hist->count = 0;
+    hist->offset = offset;
+    hist->num_bins = num_bins;
+    hist->shift = shift;
+    memset(bins, 0, num_bins * sizeof(*bins));
+}
+
+void matstat_hist_add(matstat_hist_t *hist, int32_t value)
+{
+    uint64_t idx = 0;
+    if (value > hist->offset) {
+        idx = (uint64_t)((int64_t)value - hist->offset) >> hist->shift;
+        if (idx >= hist->num_bins) {
+            idx = hist->num_bins - 1;
+        }
+    }
+    ++hist->bins[idx];
+    ++hist->count;
+}
+
+int32_t matstat_hist_percentile(const matstat_hist_t *hist, unsigned percent)
+{
+    if (hist->count == 0) {
+        return hist->offset;
+    }
+    if (percent > 100) {
+        percent = 100;
+    }
+    /* Number of values that must be covered, rounded up */
+    uint64_t target = ((uint64_t)hist->count * percent + 99) / 100;
+    if (target == 0) {
+        target = 1;
+    }
+    uint64_t cum = 0;
+    unsigned idx;
+    for (idx = 0; idx < hist->num_bins - 1u; ++idx) {
+        cum += hist->bins[idx];
+        if (cum >= target) {
+            break;
+        }
+    }
+    int64_t bound = (int64_t)hist->offset + ((int64_t)(idx + 1) << hist->shift);
+    DEBUG("P%u: bin %u, bound %" PRId32 "\n", percent, idx, (int32_t)bound);
+    return (bound > INT32_MAX) ? INT32_MAX : (int32_t)bound;
+}
@@ -9,9 +9,34 @@
 #include <string.h>
 #include "memarray.h"
 
+#ifdef MODULE_MEMARRAY_STATS
+#include <stdio.h>
+#include "irq.h"
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifdef MODULE_MEMARRAY_STATS
+static memarray_t *_pools;
+
+static void _register(memarray_t *mem)
+{
+    unsigned state = irq_disable();
+
+    for (memarray_t *pool = _pools; pool != NULL; pool = pool->next) {
+        if (pool == mem) {
+            irq_restore(state);
+            return;
+        }
+    }
+    mem->name = NULL;
+    mem->next = _pools;
+    _pools = mem;
+    irq_restore(state);
+}
+#endif
+
 void memarray_init(memarray_t *mem, void *data, size_t size, size_t num)
 {
     assert((mem != NULL) && (data != NULL) && (size >= sizeof(void *)) &&
@@ -28,6 +53,16 @@ void memarray_init(memarray_t *mem, void *data, size_t size, size_t num)
         void *next = ((char *)mem->free_data) + ((i + 1) * mem->size);
         memcpy(((char *)mem->free_data) + (i * mem->size), &next, sizeof(void *));
     }
+    /* terminate the free list, data may have been in use before */
+    void *last = NULL;
+    memcpy(((char *)mem->free_data) + ((mem->num - 1) * mem->size), &last,
+           sizeof(void *));
+#ifdef MODULE_MEMARRAY_STATS
+    _register(mem);
+    mem->used = 0;
+    mem->max_used = 0;
+    mem->failed = 0;
+#endif
 }
 
 void *memarray_alloc(memarray_t *mem)
@@ -35,10 +70,18 @@ void *memarray_alloc(memarray_t *mem)
     assert(mem != NULL);
 
     if (mem->free_data == NULL) {
+#ifdef MODULE_MEMARRAY_STATS
+        mem->failed++;
+#endif
         return NULL;
     }
     void *free = mem->free_data;
     mem->free_data = *((void **)mem->free_data);
+#ifdef MODULE_MEMARRAY_STATS
+    if (++mem->used > mem->max_used) {
+        mem->max_used = mem->used;
+    }
+#endif
     DEBUG("memarray: Allocate %u Bytes at %p\n", (unsigned)mem->size, free);
     return free;
 }
@@ -49,5 +92,32 @@ void memarray_free(memarray_t *mem, void *ptr)
 
     memcpy(ptr, &mem->free_data, sizeof(void *));
     mem->free_data = ptr;
+#ifdef MODULE_MEMARRAY_STATS
+    assert(mem->used > 0);
+    mem->used--;
+#endif
     DEBUG("memarray: Free %u Bytes at %p\n", (unsigned)mem->size, ptr);
 }
+
+#ifdef MODULE_MEMARRAY_STATS
+memarray_t *memarray_iter(const memarray_t *prev)
+{
+    return (prev == NULL) ? _pools : prev->next;
+}
+
+void memarray_print_stats(void)
+{
+    puts("          name |  size |   num |  used |   max | failed");
+    for (memarray_t *mem = _pools; mem != NULL; mem = mem->next) {
+        if (mem->name != NULL) {
+            printf("%14s |", mem->name);
+        }
+        else {
+            printf("    %10p |", (void *)mem);
+        }
+        printf(" %5u | %5u | %5u | %5u | %6u\n", (unsigned)mem->size,
+               (unsigned)mem->num, (unsigned)mem->used,
+               (unsigned)mem->max_used, mem->failed);
+    }
+}
+#endif
@@ -51,6 +51,9 @@
 
 #define LEN_PINGRESP            (2U)
 
+/* marks a pipelined PUBLISH request that has not yet completed */
+#define EVT_NONE                (UINT8_MAX)
+
 /* Internally used connection states */
 enum {
     UNINITIALIZED = 0,      /**< connection context is not initialized */
@@ -66,6 +69,7 @@ static char _stack[ASYMCUTE_HANDLER_STACKSIZE];
 
 /* necessary forward function declarations */
 static void _on_req_timeout(void *arg);
+static unsigned _on_pub_timeout(asymcute_con_t *con, asymcute_req_t *req);
 
 static size_t _len_set(uint8_t *buf, size_t len)
 {
@@ -191,6 +195,84 @@ static void _req_send(asymcute_req_t *req, asymcute_con_t *con,
     _req_resend(req, con);
 }
 
+/* @pre con is locked and a slot of the publish window is free */
+static void _pub_send(asymcute_req_t *req, asymcute_con_t *con)
+{
+    unsigned slot = (con->pub_head + con->pub_cnt) % ASYMCUTE_PUBLISH_WINDOW;
+
+    req->evt = EVT_NONE;
+    con->pub_inflight[slot] = req;
+    con->pub_cnt++;
+    _req_send(req, con, _on_pub_timeout);
+}
+
+/* @pre con is locked, con is unlocked when this function returns */
+static void _pub_finish(asymcute_con_t *con, asymcute_req_t *req, unsigned evt)
+{
+    asymcute_req_t *done = NULL;
+    asymcute_req_t **tail = &done;
+
+    /* keep the request marked as used until its event is passed on */
+    req->evt = (uint8_t)evt;
+    req->con = con;
+
+    /* collect all completed requests at the head of the window, so that events
+     * are passed to the user in the order the requests were published */
+    while (con->pub_cnt &&
+           (con->pub_inflight[con->pub_head]->evt != EVT_NONE)) {
+        asymcute_req_t *head = con->pub_inflight[con->pub_head];
+        con->pub_head = (con->pub_head + 1) % ASYMCUTE_PUBLISH_WINDOW;
+        con->pub_cnt--;
+        head->next = NULL;
+        *tail = head;
+        tail = &head->next;
+    }
+
+    /* refill the window with queued requests */
+    while (con->pub_queue && (con->pub_cnt < ASYMCUTE_PUBLISH_WINDOW)) {
+        asymcute_req_t *next = con->pub_queue;
+        con->pub_queue = next->next;
+        _pub_send(next, con);
+    }
+
+    mutex_unlock(&con->lock);
+
+    while (done) {
+        asymcute_req_t *cur = done;
+        unsigned cur_evt = cur->evt;
+        done = cur->next;
+        cur->con = NULL;
+        mutex_unlock(&cur->lock);
+        con->user_cb(cur, cur_evt);
+    }
+}
+
+/* @pre con is locked */
+static void _pub_cancel(asymcute_con_t *con)
+{
+    while (con->pub_cnt) {
+        asymcute_req_t *req = con->pub_inflight[con->pub_head];
+        unsigned evt = req->evt;
+        con->pub_head = (con->pub_head + 1) % ASYMCUTE_PUBLISH_WINDOW;
+        con->pub_cnt--;
+        if (evt == EVT_NONE) {
+            _req_remove(con, req);
+            event_timeout_clear(&req->to_timer);
+            evt = ASYMCUTE_CANCELED;
+        }
+        req->con = NULL;
+        mutex_unlock(&req->lock);
+        con->user_cb(req, evt);
+    }
+    while (con->pub_queue) {
+        asymcute_req_t *req = con->pub_queue;
+        con->pub_queue = req->next;
+        req->con = NULL;
+        mutex_unlock(&req->lock);
+        con->user_cb(req, ASYMCUTE_CANCELED);
+    }
+}
+
 static void _req_send_once(asymcute_req_t *req, asymcute_con_t *con)
 {
     sock_udp_send(&con->sock, req->data, req->data_len, &con->server_ep);
@@ -216,8 +298,10 @@ static void _sub_cancel(asymcute_sub_t *sub)
 static void _disconnect(asymcute_con_t *con, uint8_t state)
 {
     if (con->state == CONNECTED) {
-        /* cancel all pending requests */
+        /* cancel all pending requests, pipelined PUBLISH requests first to
+         * keep them in order */
         event_timeout_clear(&con->keepalive_timer);
+        _pub_cancel(con);
         for (asymcute_req_t *req = con->pending; req; req = req->next) {
             _req_cancel(req);
         }
@@ -248,6 +332,10 @@ static void _on_req_timeout(void *arg)
         asymcute_con_t *con = req->con;
         mutex_lock(&con->lock);
         _req_remove(con, req);
+        if (req->cb == _on_pub_timeout) {
+            _pub_finish(con, req, ASYMCUTE_TIMEOUT);
+            return;
+        }
         /* communicate timeout to outer world */
         unsigned ret = ASYMCUTE_TIMEOUT;
         if (req->cb) {
@@ -275,6 +363,14 @@ static unsigned _on_discon_timeout(asymcute_con_t *con, asymcute_req_t *req)
     return ASYMCUTE_DISCONNECTED;
 }
 
+static unsigned _on_pub_timeout(asymcute_con_t *con, asymcute_req_t *req)
+{
+    (void)con;
+    (void)req;
+
+    return ASYMCUTE_TIMEOUT;
+}
+
 static unsigned _on_suback_timeout(asymcute_con_t *con, asymcute_req_t *req)
 {
     (void)con;
@@ -448,9 +544,7 @@ static void _on_puback(asymcute_con_t *con, const uint8_t *data, size_t len)
 
     unsigned ret = (data[6] == MQTTSN_ACCEPTED) ?
                     ASYMCUTE_PUBLISHED : ASYMCUTE_REJECTED;
-    mutex_unlock(&req->lock);
-    mutex_unlock(&con->lock);
-    con->user_cb(req, ret);
+    _pub_finish(con, req, ret);
 }
 
 static void _on_suback(asymcute_con_t *con, const uint8_t *data, size_t len)
@@ -874,7 +968,19 @@ int asymcute_publish(asymcute_con_t *con, asymcute_req_t *req,
 
     /* publish selected data */
     if (flags & MQTTSN_QOS_1) {
-        _req_send(req, con, NULL);
+        if (con->pub_cnt < ASYMCUTE_PUBLISH_WINDOW) {
+            _pub_send(req, con);
+        }
+        else {
+            /* window is full, append to the queue */
+            asymcute_req_t **tail = &con->pub_queue;
+            while (*tail) {
+                tail = &(*tail)->next;
+            }
+            req->con = con;
+            req->next = NULL;
+            *tail = req;
+        }
     }
     else {
         _req_send_once(req, con);
@@ -22,6 +22,7 @@
 
 #include "mutex.h"
 #include "assert.h"
+#include "hashes.h"
 #include "thread_flags.h"
 
 #include "net/gcoap.h"
@@ -51,6 +52,8 @@ static size_t _regif_buf_len;
 static char _rd_loc[NANOCOAP_URI_MAX];
 static char _rd_regif[NANOCOAP_URI_MAX];
 static sock_udp_ep_t _rd_remote;
+/* hash of the resource description last sent to the RD */
+static uint32_t _rd_res_hash;
 
 static mutex_t _mutex = MUTEX_INIT;
 static volatile thread_t *_waiter;
@@ -135,6 +138,8 @@ static void _on_remove(unsigned req_state, coap_pkt_t *pdu, sock_udp_ep_t *remot
 static int _update_remove(unsigned code, gcoap_resp_handler_t handle)
 {
     coap_pkt_t pkt;
+    size_t payload_len = 0;
+    uint32_t res_hash = _rd_res_hash;
 
     if (_rd_loc[0] == 0) {
         return CORD_EP_NORD;
@@ -146,13 +151,31 @@ static int _update_remove(unsigned code, gcoap_resp_handler_t handle)
         return CORD_EP_ERR;
     }
     coap_hdr_set_type(pkt.hdr, COAP_TYPE_CON);
-    ssize_t pkt_len = gcoap_finish(&pkt, 0, COAP_FORMAT_NONE);
+
+    /* updates only carry the resource description if it changed since we
+     * last sent it to the RD */
+    if (code == COAP_METHOD_POST) {
+        res = gcoap_get_resource_list(pkt.payload, pkt.payload_len,
+                                      COAP_FORMAT_LINK);
+        if (res < 0) {
+            return CORD_EP_ERR;
+        }
+        res_hash = djb2_hash(pkt.payload, (size_t)res);
+        if (res_hash != _rd_res_hash) {
+            payload_len = (size_t)res;
+        }
+    }
+    ssize_t pkt_len = gcoap_finish(&pkt, payload_len, COAP_FORMAT_LINK);
 
     /* send request */
     gcoap_req_send2(buf, pkt_len, &_rd_remote, handle);
 
     /* synchronize response */
-    return _sync();
+    res = _sync();
+    if (res == CORD_EP_OK) {
+        _rd_res_hash = res_hash;
+    }
+    return res;
 }
 
 static void _on_discover(unsigned req_state, coap_pkt_t *pdu,
@@ -286,6 +309,7 @@ int cord_ep_register(const sock_udp_ep_t *remote, const char *regif)
         goto end;
     }
     pkt_len += res;
+    _rd_res_hash = djb2_hash(pkt.payload, (size_t)res);
 
     /* send out the request */
     res = gcoap_req_send2(buf, pkt_len, remote, _on_register);
@@ -15,6 +15,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -25,12 +26,157 @@
 #include "byteorder.h"
 #endif
 
+#ifdef MODULE_SOCK_DNS_CACHE
+#include "mutex.h"
+#include "xtimer.h"
+#endif
+
 /* min domain name length is 1, so minimum record length is 7 */
 #define DNS_MIN_REPLY_LEN   (unsigned)(sizeof(sock_dns_hdr_t ) + 7)
 
+/* response code of a reply, see RFC 1035, section 4.1.1 */
+#define DNS_RCODE_MASK      (0x000f)
+#define DNS_RCODE_NOERROR   (0)
+#define DNS_RCODE_NXDOMAIN  (3)
+
 /* global DNS server UDP endpoint */
 sock_udp_ep_t sock_dns_server;
 
+#ifdef MODULE_SOCK_DNS_CACHE
+/* index of the AAAA and A slot in a cache entry */
+#define CACHE_AAAA          (0)
+#define CACHE_A             (1)
+
+/* cache entry, AAAA and A records of a name are cached independently */
+typedef struct {
+    char name[SOCK_DNS_MAX_NAME_LEN + 1];   /* empty string if unused */
+    uint32_t expires[2];                    /* 0 if slot is unset */
+    uint8_t addrlen[2];                     /* 0 for negative entries */
+    uint8_t addr6[16];
+    uint8_t addr4[4];
+} _cache_entry_t;
+
+static _cache_entry_t _cache[SOCK_DNS_CACHE_SIZE];
+static mutex_t _cache_lock = MUTEX_INIT;
+
+static uint32_t _cache_now(void)
+{
+    return (uint32_t)(xtimer_now_usec64() / US_PER_SEC);
+}
+
+static uint8_t *_cache_addr(_cache_entry_t *entry, unsigned slot)
+{
+    return (slot == CACHE_AAAA) ? entry->addr6 : entry->addr4;
+}
+
+static _cache_entry_t *_cache_find(const char *name)
+{
+    for (unsigned i = 0; i < SOCK_DNS_CACHE_SIZE; i++) {
+        if (strcmp(_cache[i].name, name) == 0) {
+            return &_cache[i];
+        }
+    }
+    return NULL;
+}
+
+/* returns 1 if the slot holds an answer that has not expired yet */
+static int _cache_valid(_cache_entry_t *entry, unsigned slot, uint32_t now)
+{
+    if (entry->expires[slot] == 0) {
+        return 0;
+    }
+    if ((int32_t)(entry->expires[slot] - now) <= 0) {
+        entry->expires[slot] = 0;
+        return 0;
+    }
+    return 1;
+}
+
+/* returns address length on hit, -1 on negative hit, 0 on miss */
+static int _cache_get(const char *name, void *addr_out, int family)
+{
+    uint32_t now = _cache_now();
+    int res = 0;
+
+    mutex_lock(&_cache_lock);
+    _cache_entry_t *entry = _cache_find(name);
+    if (entry == NULL) {
+        goto out;
+    }
+    for (unsigned slot = CACHE_AAAA; slot <= CACHE_A; slot++) {
+        if (((slot == CACHE_AAAA) && (family == AF_INET)) ||
+            ((slot == CACHE_A) && (family == AF_INET6))) {
+            continue;
+        }
+        if (!_cache_valid(entry, slot, now)) {
+            /* answer for a requested family is unknown, ask the server */
+            res = 0;
+            goto out;
+        }
+        if (entry->addrlen[slot]) {
+            res = entry->addrlen[slot];
+            memcpy(addr_out, _cache_addr(entry, slot), res);
+            goto out;
+        }
+        res = -1;
+    }
+
+out:
+    mutex_unlock(&_cache_lock);
+    return res;
+}
+
+static void _cache_add(const char *name, unsigned slot, const void *addr,
+                       unsigned addrlen, uint32_t ttl)
+{
+    uint32_t now = _cache_now();
+
+    if (ttl == 0) {
+        return;
+    }
+    if (ttl > SOCK_DNS_CACHE_TTL_MAX) {
+        ttl = SOCK_DNS_CACHE_TTL_MAX;
+    }
+
+    mutex_lock(&_cache_lock);
+    _cache_entry_t *entry = _cache_find(name);
+    if (entry == NULL) {
+        /* take an unused or fully expired entry, otherwise replace the one
+         * that would expire first */
+        uint32_t best = UINT32_MAX;
+        entry = &_cache[0];
+        for (unsigned i = 0; i < SOCK_DNS_CACHE_SIZE; i++) {
+            uint32_t left = 0;
+            for (unsigned s = CACHE_AAAA; s <= CACHE_A; s++) {
+                if (_cache_valid(&_cache[i], s, now) &&
+                    ((_cache[i].expires[s] - now) > left)) {
+                    left = _cache[i].expires[s] - now;
+                }
+            }
+            if (left < best) {
+                best = left;
+                entry = &_cache[i];
+            }
+        }
+        memset(entry, 0, sizeof(*entry));
+        strcpy(entry->name, name);
+    }
+    entry->expires[slot] = now + ttl;
+    entry->addrlen[slot] = addrlen;
+    if (addrlen) {
+        memcpy(_cache_addr(entry, slot), addr, addrlen);
+    }
+    mutex_unlock(&_cache_lock);
+}
+
+void sock_dns_cache_flush(void)
+{
+    mutex_lock(&_cache_lock);
+    memset(_cache, 0, sizeof(_cache));
+    mutex_unlock(&_cache_lock);
+}
+#endif /* MODULE_SOCK_DNS_CACHE */
+
 static ssize_t _enc_domain_name(uint8_t *out, const char *domain_name)
 {
     /*
@@ -88,7 +234,15 @@ static size_t _skip_hostname(uint8_t *buf)
     return (bufpos - buf + 1);
 }
 
-static int _parse_dns_reply(uint8_t *buf, size_t len, void* addr_out, int family)
+static uint32_t _get_long(uint8_t *buf)
+{
+    uint32_t _tmp;
+    memcpy(&_tmp, buf, 4);
+    return _tmp;
+}
+
+static int _parse_dns_reply(uint8_t *buf, size_t len, void* addr_out, int family,
+                            uint32_t *ttl)
 {
     sock_dns_hdr_t *hdr = (sock_dns_hdr_t*) buf;
     uint8_t *bufpos = buf + sizeof(*hdr);
@@ -105,7 +259,8 @@ static int _parse_dns_reply(uint8_t *buf, size_t len, void* addr_out, int family
         bufpos += 2;
         uint16_t class = ntohs(_get_short(bufpos));
         bufpos += 2;
-        bufpos += 4; /* skip ttl */
+        uint32_t _ttl = ntohl(_get_long(bufpos));
+        bufpos += 4;
 
         unsigned addrlen = ntohs(_get_short(bufpos));
         bufpos += 2;
@@ -124,12 +279,24 @@ static int _parse_dns_reply(uint8_t *buf, size_t len, void* addr_out, int family
         }
 
         memcpy(addr_out, bufpos, addrlen);
+        /* a TTL with the most significant bit set is treated as zero
+         * (RFC 2181, section 8) */
+        *ttl = (_ttl & 0x80000000UL) ? 0 : _ttl;
         return addrlen;
     }
 
     return -1;
 }
 
+/* returns true if the reply states that no matching record exists */
+static bool _is_negative_reply(uint8_t *buf)
+{
+    sock_dns_hdr_t *hdr = (sock_dns_hdr_t*) buf;
+    unsigned rcode = ntohs(hdr->flags) & DNS_RCODE_MASK;
+
+    return (rcode == DNS_RCODE_NOERROR) || (rcode == DNS_RCODE_NXDOMAIN);
+}
+
 int sock_dns_query(const char *domain_name, void *addr_out, int family)
 {
     uint8_t buf[SOCK_DNS_QUERYBUF_LEN];
@@ -143,6 +310,13 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
         return -ENOSPC;
     }
 
+#ifdef MODULE_SOCK_DNS_CACHE
+    int cached = _cache_get(domain_name, addr_out, family);
+    if (cached != 0) {
+        return cached;
+    }
+#endif
+
     sock_dns_hdr_t *hdr = (sock_dns_hdr_t*) buf;
     memset(hdr, 0, sizeof(*hdr));
     hdr->id = 0; /* random? */
@@ -174,7 +348,6 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
 
     ssize_t res = sock_udp_create(&sock_dns, NULL, &sock_dns_server, 0);
     if (res) {
-            puts("a");
         goto out;
     }
 
@@ -185,7 +358,29 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
         }
         res = sock_udp_recv(&sock_dns, reply_buf, sizeof(reply_buf), 1000000LU, NULL);
         if ((res > 0) && (res > (int)DNS_MIN_REPLY_LEN)) {
-            if ((res = _parse_dns_reply(reply_buf, res, addr_out, family)) > 0) {
+            uint32_t ttl;
+            if ((res = _parse_dns_reply(reply_buf, res, addr_out, family,
+                                        &ttl)) > 0) {
+#ifdef MODULE_SOCK_DNS_CACHE
+                _cache_add(domain_name,
+                           (res == 16) ? CACHE_AAAA : CACHE_A,
+                           addr_out, res, ttl);
+#endif
+                goto out;
+            }
+            if ((res == -1) && _is_negative_reply(reply_buf)) {
+                /* the server answered, but has no record: asking again
+                 * won't change the outcome */
+#ifdef MODULE_SOCK_DNS_CACHE
+                if (family != AF_INET) {
+                    _cache_add(domain_name, CACHE_AAAA, NULL, 0,
+                               SOCK_DNS_CACHE_NEG_TTL);
+                }
+                if (family != AF_INET6) {
+                    _cache_add(domain_name, CACHE_A, NULL, 0,
+                               SOCK_DNS_CACHE_NEG_TTL);
+                }
+#endif
                 goto out;
             }
         }
@@ -50,7 +50,8 @@ static sock_udp_ep_t gateway;
 static uint8_t rbuf[EMCUTE_BUFSIZE];
 static uint8_t tbuf[EMCUTE_BUFSIZE];
 
-static emcute_sub_t *subs = NULL;
+/* subscriptions, hashed by their topic ID */
+static emcute_sub_t *subs[EMCUTE_SUB_BUCKETS];
 
 static mutex_t txlock;
 
@@ -60,6 +61,38 @@ static volatile uint8_t waiton = 0xff;
 static volatile uint16_t waitonid = 0;
 static volatile int result;
 
+/* state of a running batch registration */
+static emcute_topic_t *batch = NULL;
+static size_t batch_numof;
+static uint16_t batch_id;
+static volatile uint32_t batch_open;
+static volatile uint32_t batch_rej;
+
+static unsigned sub_bucket(uint16_t id)
+{
+    return (id & (EMCUTE_SUB_BUCKETS - 1));
+}
+
+static emcute_sub_t *sub_find(uint16_t id)
+{
+    emcute_sub_t *sub;
+    for (sub = subs[sub_bucket(id)]; sub && (sub->topic.id != id);
+         sub = sub->next) {}
+    return sub;
+}
+
+static int sub_remove(emcute_sub_t *sub)
+{
+    for (emcute_sub_t **s = &subs[sub_bucket(sub->topic.id)]; *s;
+         s = &(*s)->next) {
+        if (*s == sub) {
+            *s = sub->next;
+            return 1;
+        }
+    }
+    return 0;
+}
+
 static size_t set_len(uint8_t *buf, size_t len)
 {
     if (len < (0xff - 7)) {
@@ -147,6 +180,30 @@ static void on_ack(uint8_t type, int id_pos, int ret_pos, int res_pos)
     }
 }
 
+static void on_regack(void)
+{
+    if ((waiton != REGACK) || (batch == NULL)) {
+        on_ack(REGACK, 4, 6, 2);
+        return;
+    }
+
+    uint16_t idx = (uint16_t)(byteorder_bebuftohs(&rbuf[4]) - batch_id);
+    if ((idx >= batch_numof) || !(batch_open & (1UL << idx))) {
+        /* unknown message ID or duplicate ACK */
+        return;
+    }
+    if (rbuf[6] == ACCEPT) {
+        batch[idx].id = byteorder_bebuftohs(&rbuf[2]);
+    }
+    else {
+        batch_rej |= (1UL << idx);
+    }
+    batch_open &= ~(1UL << idx);
+    if (batch_open == 0) {
+        thread_flags_set((thread_t *)timer.arg, TFLAGS_RESP);
+    }
+}
+
 static void on_publish(size_t len, size_t pos)
 {
     /* make sure packet length is valid - if not, drop packet silently */
@@ -171,7 +228,7 @@ static void on_publish(size_t len, size_t pos)
     }
 
     /* find the registered topic */
-    for (sub = subs; sub && (sub->topic.id != tid); sub = sub->next) {}
+    sub = sub_find(tid);
     if (sub == NULL) {
         buf[6] = REJ_INVTID;
         sock_udp_send(&sock, &buf, 7, &gateway);
@@ -296,6 +353,18 @@ int emcute_discon(void)
     return syncsend(DISCONNECT, 2, true);
 }
 
+static size_t compile_reg(const emcute_topic_t *topic, uint16_t msg_id)
+{
+    size_t len = strlen(topic->name);
+
+    tbuf[0] = (len + 6);
+    tbuf[1] = REGISTER;
+    byteorder_htobebufs(&tbuf[2], 0);
+    byteorder_htobebufs(&tbuf[4], msg_id);
+    memcpy(&tbuf[6], topic->name, len);
+    return (size_t)tbuf[0];
+}
+
 int emcute_reg(emcute_topic_t *topic)
 {
     assert(topic && topic->name);
@@ -309,14 +378,8 @@ int emcute_reg(emcute_topic_t *topic)
 
     mutex_lock(&txlock);
 
-    tbuf[0] = (strlen(topic->name) + 6);
-    tbuf[1] = REGISTER;
-    byteorder_htobebufs(&tbuf[2], 0);
-    byteorder_htobebufs(&tbuf[4], id_next);
     waitonid = id_next++;
-    memcpy(&tbuf[6], topic->name, strlen(topic->name));
-
-    int res = syncsend(REGACK, (size_t)tbuf[0], true);
+    int res = syncsend(REGACK, compile_reg(topic, waitonid), true);
     if (res > 0) {
         topic->id = (uint16_t)res;
         res = EMCUTE_OK;
@@ -324,6 +387,67 @@ int emcute_reg(emcute_topic_t *topic)
     return res;
 }
 
+int emcute_reg_batch(emcute_topic_t *topics, size_t numof)
+{
+    assert(topics && (numof > 0) && (numof <= EMCUTE_REG_BATCH_MAX));
+
+    if (gateway.port == 0) {
+        return EMCUTE_NOGW;
+    }
+    for (size_t i = 0; i < numof; i++) {
+        assert(topics[i].name);
+        if (strlen(topics[i].name) > EMCUTE_TOPIC_MAXLEN) {
+            return EMCUTE_OVERFLOW;
+        }
+    }
+
+    mutex_lock(&txlock);
+
+    /* use one message ID per topic, so REGACKs can be mapped to topics */
+    batch_id = id_next;
+    id_next += numof;
+    batch_numof = numof;
+    batch_open = (numof == 32) ? UINT32_MAX : ((1UL << numof) - 1);
+    batch_rej = 0;
+    batch = topics;
+
+    waiton = REGACK;
+    timer.arg = (void *)sched_active_thread;
+    thread_flags_clear(TFLAGS_ANY);
+
+    for (unsigned retries = 0; retries <= EMCUTE_N_RETRY; retries++) {
+        DEBUG("[emcute] reg_batch: sending round %i\n", retries);
+        /* (re)send all registrations that were not acknowledged yet */
+        for (size_t i = 0; i < numof; i++) {
+            if (batch_open & (1UL << i)) {
+                size_t len = compile_reg(&topics[i], batch_id + i);
+                sock_udp_send(&sock, tbuf, len, &gateway);
+            }
+        }
+
+        xtimer_set(&timer, (EMCUTE_T_RETRY * US_PER_SEC));
+        thread_flags_t flags = thread_flags_wait_any(TFLAGS_ANY);
+        if (flags & TFLAGS_RESP) {
+            xtimer_remove(&timer);
+            break;
+        }
+    }
+
+    /* cleanup sync state */
+    waiton = 0xff;
+    batch = NULL;
+
+    int res = EMCUTE_OK;
+    if (batch_open) {
+        res = EMCUTE_TIMEOUT;
+    }
+    else if (batch_rej) {
+        res = EMCUTE_REJECT;
+    }
+    mutex_unlock(&txlock);
+    return res;
+}
+
 int emcute_pub(emcute_topic_t *topic, const void *data, size_t len,
                unsigned flags)
 {
@@ -388,16 +512,13 @@ int emcute_sub(emcute_sub_t *sub, unsigned flags)
     int res = syncsend(SUBACK, (size_t)tbuf[0], false);
     if (res > 0) {
         DEBUG("[emcute] sub: success, topic id is %i\n", res);
+        /* the subscription might be in the table already, possibly under a
+         * different topic ID, so re-insert to match the assigned ID */
+        sub_remove(sub);
         sub->topic.id = res;
-
-        /* check if subscription is already in the list, only insert if not*/
-        emcute_sub_t *s;
-        for (s = subs; s && (s != sub); s = s->next) {}
-        if (!s) {
-            sub->next = subs;
-            subs = sub;
-            res = EMCUTE_OK;
-        }
+        sub->next = subs[sub_bucket(sub->topic.id)];
+        subs[sub_bucket(sub->topic.id)] = sub;
+        res = EMCUTE_OK;
     }
 
     mutex_unlock(&txlock);
@@ -423,18 +544,7 @@ int emcute_unsub(emcute_sub_t *sub)
 
     int res = syncsend(UNSUBACK, (size_t)tbuf[0], false);
     if (res == EMCUTE_OK) {
-        if (subs == sub) {
-            subs = sub->next;
-        }
-        else {
-            emcute_sub_t *s;
-            for (s = subs; s; s = s->next) {
-                if (s->next == sub) {
-                    s->next = sub->next;
-                    break;
-                }
-            }
-        }
+        sub_remove(sub);
     }
 
     mutex_unlock(&txlock);
@@ -536,7 +646,7 @@ void emcute_run(uint16_t port, const char *id)
                 case CONNACK:       on_ack(type, 0, 2, 0);              break;
                 case WILLTOPICREQ:  on_ack(type, 0, 0, 0);              break;
                 case WILLMSGREQ:    on_ack(type, 0, 0, 0);              break;
-                case REGACK:        on_ack(type, 4, 6, 2);              break;
+                case REGACK:        on_regack();                        break;
                 case PUBLISH:       on_publish((size_t)pkt_len, pos);   break;
                 case PUBACK:        on_ack(type, 4, 6, 0);              break;
                 case SUBACK:        on_ack(type, 5, 7, 3);              break;
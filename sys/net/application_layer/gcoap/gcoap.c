@@ -56,13 +56,18 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 static void _expire_request(gcoap_request_memo_t *memo);
 static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *pdu,
                            const sock_udp_ep_t *remote);
+static void _add_req_memo(gcoap_request_memo_t *memo);
+static void _remove_req_memo(gcoap_request_memo_t *memo);
 static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
                                             gcoap_listener_t **listener_ptr);
 static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote);
 static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                                                        coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
-                                   const coap_resource_t *resource);
+                                   const coap_resource_t *resource,
+                                   const sock_udp_ep_t *remote);
+static void _obs_link(gcoap_observe_memo_t *memo);
+static void _obs_unlink(gcoap_observe_memo_t *memo);
 
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
@@ -75,6 +80,27 @@ static gcoap_listener_t _default_listener = {
     NULL
 };
 
+#ifdef MODULE_GCOAP_COCOA
+/* CoCoA: initial RTO, and bounds for the RTO and backed off timeouts (in ms) */
+#define COCOA_RTO_INIT          (COAP_ACK_TIMEOUT * MS_PER_SEC)
+#define COCOA_RTO_MAX           (60LU * MS_PER_SEC)
+#define COCOA_TIMEOUT_MAX       (4 * COCOA_RTO_MAX)
+
+/* CoCoA RTO state for a destination, times in ms */
+typedef struct {
+    sock_udp_ep_t remote;               /* Destination */
+    uint32_t rto;                       /* Overall RTO; 0 if entry unused */
+    uint32_t last_update;               /* Time RTO was last updated or aged */
+    uint32_t last_used;                 /* For least recently used replacement */
+    uint32_t strong_srtt;               /* Strong estimator; 0 if unset */
+    uint32_t strong_rttvar;
+    uint32_t weak_srtt;                 /* Weak estimator; 0 if unset */
+    uint32_t weak_rttvar;
+} gcoap_cocoa_dest_t;
+
+static void _cocoa_update(gcoap_request_memo_t *memo);
+#endif
+
 /* Container for the state of gcoap itself */
 typedef struct {
     mutex_t lock;                       /* Shares state attributes safely */
@@ -83,16 +109,35 @@ typedef struct {
                                         /* Storage for open requests; if first
                                            byte of an entry is zero, the entry
                                            is available */
+    uint8_t req_buckets[GCOAP_REQ_BUCKETS];
+                                        /* Hash index of open requests; index
+                                           of the first memo in open_reqs + 1,
+                                           or 0 if bucket is empty */
+    uint8_t req_next[GCOAP_REQ_WAITING_MAX];
+                                        /* Next memo in the same bucket, same
+                                           encoding as req_buckets */
     atomic_uint next_message_id;        /* Next message ID to use */
     sock_udp_ep_t observers[GCOAP_OBS_CLIENTS_MAX];
                                         /* Observe clients; allows reuse for
                                            observe memos */
     gcoap_observe_memo_t observe_memos[GCOAP_OBS_REGISTRATIONS_MAX];
                                         /* Observed resource registrations */
+    uint8_t obs_buckets[GCOAP_OBS_BUCKETS];
+                                        /* Index of registrations by resource;
+                                           index of the first memo in
+                                           observe_memos + 1, or 0 if bucket
+                                           is empty */
+    uint8_t obs_next[GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* Next memo in the same bucket, same
+                                           encoding as obs_buckets */
     uint8_t resend_bufs[GCOAP_RESEND_BUFS_MAX][GCOAP_PDU_BUF_SIZE];
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
                                            the entry is available */
+#ifdef MODULE_GCOAP_COCOA
+    gcoap_cocoa_dest_t cocoa_dests[GCOAP_COCOA_DEST_MAX];
+                                        /* RTO estimates per destination */
+#endif
 } gcoap_state_t;
 
 static gcoap_state_t _coap_state = {
@@ -141,10 +186,19 @@ static void *_event_loop(void *arg)
                 /* reduce retries remaining, double timeout and resend */
                 else {
                     memo->send_limit--;
+#ifdef MODULE_GCOAP_COCOA
+                    /* variable backoff, starting from the dithered RTO */
+                    memo->timeout = (memo->timeout * memo->backoff) / 2;
+                    if (memo->timeout > COCOA_TIMEOUT_MAX) {
+                        memo->timeout = COCOA_TIMEOUT_MAX;
+                    }
+                    uint32_t timeout  = memo->timeout * US_PER_MS;
+#else
                     unsigned i        = COAP_MAX_RETRANSMIT - memo->send_limit;
                     uint32_t timeout  = ((uint32_t)COAP_ACK_TIMEOUT << i) * US_PER_SEC;
                     uint32_t variance = ((uint32_t)COAP_ACK_VARIANCE << i) * US_PER_SEC;
                     timeout = random_uint32_range(timeout, timeout + variance);
+#endif
 
                     ssize_t bytes = sock_udp_send(&_sock, memo->msg.data.pdu_buf,
                                                   memo->msg.data.pdu_len,
@@ -238,11 +292,17 @@ static void _listen(sock_udp_t *sock)
             case COAP_TYPE_NON:
             case COAP_TYPE_ACK:
                 xtimer_remove(&memo->response_timer);
+#ifdef MODULE_GCOAP_COCOA
+                if (memo->send_limit >= 0) {        /* if confirmable */
+                    _cocoa_update(memo);
+                }
+#endif
                 memo->state = GCOAP_MEMO_RESP;
                 if (memo->resp_handler) {
                     memo->resp_handler(memo->state, &pdu, &remote);
                 }
 
+                _remove_req_memo(memo);
                 if (memo->send_limit >= 0) {        /* if confirmable */
                     *memo->msg.data.pdu_buf = 0;    /* clear resend PDU buffer */
                 }
@@ -279,7 +339,6 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     gcoap_listener_t *listener          = NULL;
     sock_udp_ep_t *observer             = NULL;
     gcoap_observe_memo_t *memo          = NULL;
-    gcoap_observe_memo_t *resource_memo = NULL;
 
     switch (_find_resource(pdu, &resource, &listener)) {
         case GCOAP_RESOURCE_WRONG_METHOD:
@@ -287,8 +346,6 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         case GCOAP_RESOURCE_NO_PATH:
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
-            /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
             break;
     }
 
@@ -296,25 +353,22 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         /* lookup remote+token */
         int empty_slot = _find_obs_memo(&memo, remote, pdu);
         /* validate re-registration request */
-        if (resource_memo != NULL) {
-            if (memo != NULL) {
-                if (memo != resource_memo) {
-                    /* reject token already used for a different resource */
-                    memo = NULL;
-                    coap_clear_observe(pdu);
-                    DEBUG("gcoap: can't change resource for token\n");
-                }
-                /* otherwise OK to re-register resource with the same token */
-            }
-            else if (sock_udp_ep_equal(remote, resource_memo->observer)) {
-                /* accept new token for resource */
-                memo = resource_memo;
+        if (memo != NULL) {
+            if (memo->resource != resource) {
+                /* reject token already used for a different resource */
+                memo = NULL;
+                coap_clear_observe(pdu);
+                DEBUG("gcoap: can't change resource for token\n");
             }
+            /* otherwise OK to re-register resource with the same token */
+        }
+        else {
+            /* accept new token for resource registered by this endpoint */
+            _find_obs_memo_resource(&memo, resource, remote);
         }
         /* initialize new registration request */
         if ((memo == NULL) && coap_has_observe(pdu)) {
-            /* verify resource not already registerered (for another endpoint) */
-            if ((empty_slot >= 0) && (resource_memo == NULL)) {
+            if (empty_slot >= 0) {
                 int obs_slot = _find_observer(&observer, remote);
                 /* cache new observer */
                 if (observer == NULL) {
@@ -328,6 +382,8 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                 if (observer != NULL) {
                     memo = &_coap_state.observe_memos[empty_slot];
                     memo->observer = observer;
+                    memo->resource = resource;
+                    _obs_link(memo);
                 }
             }
             if (memo == NULL) {
@@ -337,8 +393,6 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         }
         /* finish registration */
         if (memo != NULL) {
-            /* resource may be assigned here if it is not already registered */
-            memo->resource = resource;
             memo->token_len = coap_get_token_len(pdu);
             if (memo->token_len) {
                 memcpy(&memo->token[0], pdu->token, memo->token_len);
@@ -351,6 +405,7 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
+            _obs_unlink(memo);
             memo->observer = NULL;
             memo           = NULL;
             _find_obs_memo(&memo, remote, NULL);
@@ -403,29 +458,34 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
 
     while (listener) {
         const coap_resource_t *resource = listener->resources;
-        for (size_t i = 0; i < listener->resources_len; i++) {
-            if (i) {
-                resource++;
-            }
+        const coap_resource_t *end = resource + listener->resources_len;
 
-            int res = strcmp((char *)&uri[0], resource->path);
-            if (res > 0) {
-                continue;
+        /* resources expected in alphabetical order, so binary search for
+         * the first resource with a path not less than uri */
+        for (size_t len = listener->resources_len; len > 0;) {
+            size_t half = len / 2;
+
+            if (strcmp(resource[half].path, (char *)&uri[0]) < 0) {
+                resource += half + 1;
+                len -= half + 1;
             }
-            else if (res < 0) {
-                /* resources expected in alphabetical order */
+            else {
+                len = half;
+            }
+        }
+        /* a path may be listed several times with different methods */
+        for (; resource < end; resource++) {
+            if (strcmp((char *)&uri[0], resource->path) != 0) {
                 break;
             }
-            else {
-                if (! (resource->methods & method_flag)) {
-                    ret = GCOAP_RESOURCE_WRONG_METHOD;
-                    continue;
-                }
-
-                *resource_ptr = resource;
-                *listener_ptr = listener;
-                return GCOAP_RESOURCE_FOUND;
+            if (! (resource->methods & method_flag)) {
+                ret = GCOAP_RESOURCE_WRONG_METHOD;
+                continue;
             }
+
+            *resource_ptr = resource;
+            *listener_ptr = listener;
+            return GCOAP_RESOURCE_FOUND;
         }
         listener = listener->next;
     }
@@ -433,6 +493,79 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
     return ret;
 }
 
+/* Returns the header of the request PDU stored in a memo. */
+static coap_hdr_t *_memo_hdr(gcoap_request_memo_t *memo)
+{
+    if (memo->send_limit == GCOAP_SEND_LIMIT_NON) {
+        return (coap_hdr_t *)&memo->msg.hdr_buf[0];
+    }
+    return (coap_hdr_t *)memo->msg.data.pdu_buf;
+}
+
+/* Returns the token length from a PDU header. */
+static inline unsigned _hdr_token_len(coap_hdr_t *hdr)
+{
+    return (hdr->ver_t_tkl & 0xf);
+}
+
+/*
+ * Hashes token and remote endpoint of a request into a bucket of
+ * _coap_state.req_buckets. The token is random, so mixing in the port and the
+ * last address byte is enough to tell apart requests without token.
+ */
+static unsigned _req_bucket(const uint8_t *token, unsigned token_len,
+                            const sock_udp_ep_t *remote)
+{
+    uint32_t hash = remote->port ^ remote->addr.ipv6[15];
+
+    for (unsigned i = 0; i < token_len; i++) {
+        hash = (hash * 31) + token[i];
+    }
+    return hash % GCOAP_REQ_BUCKETS;
+}
+
+static unsigned _memo_bucket(gcoap_request_memo_t *memo)
+{
+    coap_hdr_t *hdr = _memo_hdr(memo);
+
+    return _req_bucket(coap_hdr_data_ptr(hdr), _hdr_token_len(hdr),
+                       &memo->remote_ep);
+}
+
+/*
+ * Adds an initialized memo to the hash index. Caller must hold
+ * _coap_state.lock.
+ */
+static void _add_req_memo(gcoap_request_memo_t *memo)
+{
+    unsigned idx = memo - &_coap_state.open_reqs[0];
+    unsigned bucket = _memo_bucket(memo);
+
+    _coap_state.req_next[idx] = _coap_state.req_buckets[bucket];
+    _coap_state.req_buckets[bucket] = idx + 1;
+}
+
+/*
+ * Removes a memo from the hash index. Must be called before the memo's PDU
+ * buffer is cleared.
+ */
+static void _remove_req_memo(gcoap_request_memo_t *memo)
+{
+    unsigned idx = memo - &_coap_state.open_reqs[0];
+    uint8_t *ptr;
+
+    mutex_lock(&_coap_state.lock);
+    ptr = &_coap_state.req_buckets[_memo_bucket(memo)];
+    while (*ptr != 0) {
+        if (*ptr == (idx + 1)) {
+            *ptr = _coap_state.req_next[idx];
+            break;
+        }
+        ptr = &_coap_state.req_next[*ptr - 1];
+    }
+    mutex_unlock(&_coap_state.lock);
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -445,33 +578,159 @@ static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *src_pdu,
                            const sock_udp_ep_t *remote)
 {
     *memo_ptr = NULL;
-    /* no need to initialize struct; we only care about buffer contents below */
-    coap_pkt_t memo_pdu_data;
-    coap_pkt_t *memo_pdu = &memo_pdu_data;
-    unsigned cmplen      = coap_get_token_len(src_pdu);
+    unsigned cmplen = coap_get_token_len(src_pdu);
+    uint8_t idx;
+
+    mutex_lock(&_coap_state.lock);
+    idx = _coap_state.req_buckets[_req_bucket(src_pdu->token, cmplen, remote)];
+    while (idx != 0) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[idx - 1];
+        coap_hdr_t *memo_hdr = _memo_hdr(memo);
+
+        if ((memo->state != GCOAP_MEMO_UNUSED) &&
+            (_hdr_token_len(memo_hdr) == cmplen) &&
+            (memcmp(src_pdu->token, coap_hdr_data_ptr(memo_hdr), cmplen) == 0) &&
+            sock_udp_ep_equal(&memo->remote_ep, remote)) {
+            *memo_ptr = memo;
+            break;
+        }
+        idx = _coap_state.req_next[idx - 1];
+    }
+    mutex_unlock(&_coap_state.lock);
+}
 
-    for (int i = 0; i < GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED)
-            continue;
+#ifdef MODULE_GCOAP_COCOA
+static inline uint32_t _cocoa_now(void)
+{
+    return (uint32_t)(xtimer_now_usec64() / US_PER_MS);
+}
+
+/*
+ * Finds the CoCoA state for a destination. If not found and create is set,
+ * replaces an unused or the least recently used entry. Caller must hold
+ * _coap_state.lock.
+ */
+static gcoap_cocoa_dest_t *_cocoa_dest(const sock_udp_ep_t *remote,
+                                       bool create, uint32_t now)
+{
+    gcoap_cocoa_dest_t *dest = NULL, *lru = &_coap_state.cocoa_dests[0];
 
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
-        if (memo->send_limit == GCOAP_SEND_LIMIT_NON) {
-            memo_pdu->hdr = (coap_hdr_t *) &memo->msg.hdr_buf[0];
+    for (unsigned i = 0; i < GCOAP_COCOA_DEST_MAX; i++) {
+        gcoap_cocoa_dest_t *tmp = &_coap_state.cocoa_dests[i];
+
+        if (tmp->rto == 0) {
+            if (lru->rto != 0) {
+                lru = tmp;
+            }
         }
-        else {
-            memo_pdu->hdr = (coap_hdr_t *) memo->msg.data.pdu_buf;
+        else if (sock_udp_ep_equal(&tmp->remote, remote)) {
+            dest = tmp;
+            break;
         }
+        else if ((lru->rto != 0) &&
+                 ((now - tmp->last_used) > (now - lru->last_used))) {
+            lru = tmp;
+        }
+    }
+    if ((dest == NULL) && create) {
+        dest = lru;
+        memset(dest, 0, sizeof(*dest));
+        memcpy(&dest->remote, remote, sizeof(dest->remote));
+        dest->rto = COCOA_RTO_INIT;
+        dest->last_update = now;
+    }
+    if (dest != NULL) {
+        dest->last_used = now;
+    }
+    return dest;
+}
 
-        if (coap_get_token_len(memo_pdu) == cmplen) {
-            memo_pdu->token = coap_hdr_data_ptr(memo_pdu->hdr);
-            if ((memcmp(src_pdu->token, memo_pdu->token, cmplen) == 0)
-                    && sock_udp_ep_equal(&memo->remote_ep, remote)) {
-                *memo_ptr = memo;
-                break;
-            }
+/*
+ * Returns the initial timeout for a CON request to remote in ms and the
+ * variable backoff factor (times 2) to use for it. Caller must hold
+ * _coap_state.lock.
+ */
+static uint32_t _cocoa_timeout(const sock_udp_ep_t *remote, uint32_t *backoff)
+{
+    uint32_t now = _cocoa_now();
+    gcoap_cocoa_dest_t *dest = _cocoa_dest(remote, true, now);
+    uint32_t idle = now - dest->last_update;
+
+    /* age RTOs that were not updated for a while towards the default */
+    if ((dest->rto < MS_PER_SEC) && (idle > (16 * dest->rto))) {
+        dest->rto = (MS_PER_SEC + (2 * dest->rto)) / 3;
+        dest->last_update = now;
+    }
+    else if ((dest->rto > (3 * MS_PER_SEC)) && (idle > (4 * dest->rto))) {
+        dest->rto = MS_PER_SEC + (dest->rto / 2);
+        dest->last_update = now;
+    }
+    if (dest->rto < MS_PER_SEC) {
+        *backoff = 6;
+    }
+    else if (dest->rto > (3 * MS_PER_SEC)) {
+        *backoff = 3;
+    }
+    else {
+        *backoff = 4;
+    }
+    /* dither by ACK_RANDOM_FACTOR of 1.5 */
+    return random_uint32_range(dest->rto, dest->rto + (dest->rto / 2));
+}
+
+/* RFC 6298 estimator with variance factor k, returns the RTO estimate */
+static uint32_t _cocoa_estimate(uint32_t *srtt, uint32_t *rttvar, uint32_t rtt,
+                                unsigned k)
+{
+    if (*srtt == 0) {
+        *srtt = rtt;
+        *rttvar = rtt / 2;
+    }
+    else {
+        uint32_t delta = (*srtt > rtt) ? (*srtt - rtt) : (rtt - *srtt);
+
+        *rttvar = ((3 * *rttvar) + delta) / 4;
+        *srtt = ((7 * *srtt) + rtt) / 8;
+    }
+    return *srtt + (k * *rttvar);
+}
+
+/*
+ * Updates the RTO of the destination of a CON request that was answered.
+ * RTTs of requests retransmitted more than twice are ambiguous and skipped.
+ */
+static void _cocoa_update(gcoap_request_memo_t *memo)
+{
+    unsigned retransmissions = COAP_MAX_RETRANSMIT - memo->send_limit;
+    uint32_t now = _cocoa_now();
+    /* RTT from first transmission; 0 is reserved for unset estimators */
+    uint32_t rtt = (now - memo->send_time) + 1;
+    gcoap_cocoa_dest_t *dest;
+
+    if (retransmissions > 2) {
+        return;
+    }
+    mutex_lock(&_coap_state.lock);
+    dest = _cocoa_dest(&memo->remote_ep, false, now);
+    if (dest != NULL) {
+        if (retransmissions == 0) {
+            uint32_t est = _cocoa_estimate(&dest->strong_srtt,
+                                           &dest->strong_rttvar, rtt, 4);
+            dest->rto = (est + dest->rto) / 2;
+        }
+        else {
+            uint32_t est = _cocoa_estimate(&dest->weak_srtt,
+                                           &dest->weak_rttvar, rtt, 1);
+            dest->rto = (est + (3 * dest->rto)) / 4;
         }
+        if (dest->rto > COCOA_RTO_MAX) {
+            dest->rto = COCOA_RTO_MAX;
+        }
+        dest->last_update = now;
     }
+    mutex_unlock(&_coap_state.lock);
 }
+#endif /* MODULE_GCOAP_COCOA */
 
 /* Calls handler callback on receipt of a timeout message. */
 static void _expire_request(gcoap_request_memo_t *memo)
@@ -490,6 +749,7 @@ static void _expire_request(gcoap_request_memo_t *memo)
             }
             memo->resp_handler(memo->state, &req, NULL);
         }
+        _remove_req_memo(memo);
         if (memo->send_limit != GCOAP_SEND_LIMIT_NON) {
             *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
         }
@@ -587,20 +847,60 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
     return empty_slot;
 }
 
+/* Bucket of the observe memo index for a resource */
+static inline unsigned _obs_bucket(const coap_resource_t *resource)
+{
+    return ((uintptr_t)resource / sizeof(coap_resource_t)) % GCOAP_OBS_BUCKETS;
+}
+
+/* Adds a memo to the index; memo->resource must be set */
+static void _obs_link(gcoap_observe_memo_t *memo)
+{
+    unsigned i = memo - _coap_state.observe_memos;
+    unsigned bucket = _obs_bucket(memo->resource);
+
+    _coap_state.obs_next[i] = _coap_state.obs_buckets[bucket];
+    _coap_state.obs_buckets[bucket] = i + 1;
+}
+
+/* Removes a memo from the index */
+static void _obs_unlink(gcoap_observe_memo_t *memo)
+{
+    uint8_t *pos = &_coap_state.obs_buckets[_obs_bucket(memo->resource)];
+    unsigned i = memo - _coap_state.observe_memos;
+
+    while (*pos) {
+        if (*pos == i + 1) {
+            *pos = _coap_state.obs_next[i];
+            return;
+        }
+        pos = &_coap_state.obs_next[*pos - 1];
+    }
+}
+
 /*
- * Find registered observe memo for a resource.
+ * Find next registered observe memo for a resource.
  *
- * memo[out] -- Registered observe memo, or NULL if not found
+ * memo[in,out] -- Registered observe memo, or NULL if not found; if not NULL
+ *                 on input, search starts after this memo
  * resource[in] -- Resource to match
+ * remote[in] -- Endpoint to match, or NULL to match any observer
  */
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
-                                   const coap_resource_t *resource)
+                                   const coap_resource_t *resource,
+                                   const sock_udp_ep_t *remote)
 {
+    uint8_t i = (*memo == NULL)
+              ? _coap_state.obs_buckets[_obs_bucket(resource)]
+              : _coap_state.obs_next[*memo - _coap_state.observe_memos];
+
     *memo = NULL;
-    for (int i = 0; i < GCOAP_OBS_REGISTRATIONS_MAX; i++) {
-        if (_coap_state.observe_memos[i].observer != NULL
-                && _coap_state.observe_memos[i].resource == resource) {
-            *memo = &_coap_state.observe_memos[i];
+    for (; i != 0; i = _coap_state.obs_next[i - 1]) {
+        gcoap_observe_memo_t *tmp = &_coap_state.observe_memos[i - 1];
+
+        if ((tmp->resource == resource) &&
+            ((remote == NULL) || sock_udp_ep_equal(tmp->observer, remote))) {
+            *memo = tmp;
             break;
         }
     }
@@ -621,8 +921,10 @@ kernel_pid_t gcoap_init(void)
     mutex_init(&_coap_state.lock);
     /* Blank lists so we know if an entry is available. */
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
+    memset(&_coap_state.req_buckets[0], 0, sizeof(_coap_state.req_buckets));
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
+    memset(&_coap_state.obs_buckets[0], 0, sizeof(_coap_state.obs_buckets));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
@@ -632,6 +934,13 @@ kernel_pid_t gcoap_init(void)
 
 void gcoap_register_listener(gcoap_listener_t *listener)
 {
+#ifdef DEVELHELP
+    /* _find_resource() relies on the resources being sorted */
+    for (size_t i = 1; i < listener->resources_len; i++) {
+        assert(strcmp(listener->resources[i - 1].path,
+                      listener->resources[i].path) <= 0);
+    }
+#endif
     /* Add the listener to the end of the linked list. */
     gcoap_listener_t *_last = _coap_state.listeners;
     while (_last->next) {
@@ -778,9 +1087,15 @@ size_t gcoap_req_send2(const uint8_t *buf, size_t len,
             }
             if (memo->msg.data.pdu_buf) {
                 memo->send_limit  = COAP_MAX_RETRANSMIT;
+#ifdef MODULE_GCOAP_COCOA
+                memo->timeout     = _cocoa_timeout(remote, &memo->backoff);
+                memo->send_time   = _cocoa_now();
+                timeout           = memo->timeout * US_PER_MS;
+#else
                 timeout           = (uint32_t)COAP_ACK_TIMEOUT * US_PER_SEC;
                 uint32_t variance = (uint32_t)COAP_ACK_VARIANCE * US_PER_SEC;
                 timeout = random_uint32_range(timeout, timeout + variance);
+#endif
             }
             else {
                 memo->state = GCOAP_MEMO_UNUSED;
@@ -798,6 +1113,10 @@ size_t gcoap_req_send2(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            /* index before sending, the response may arrive any time after */
+            _add_req_memo(memo);
+        }
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
@@ -833,6 +1152,7 @@ size_t gcoap_req_send2(const uint8_t *buf, size_t len,
     }
     if (res <= 0) {
         if (memo != NULL) {
+            _remove_req_memo(memo);
             if (msg_type == COAP_TYPE_CON) {
                 *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
             }
@@ -853,6 +1173,7 @@ int gcoap_resp_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code)
     unsigned header_len  = coap_get_total_hdr_len(pdu);
 
     pdu->options_len = 0;
+    memset(pdu->opt_index, 0, sizeof(pdu->opt_index));
     pdu->payload     = buf + header_len;
     pdu->payload_len = len - header_len - GCOAP_RESP_OPTIONS_BUF;
 
@@ -871,7 +1192,7 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 {
     gcoap_observe_memo_t *memo = NULL;
 
-    _find_obs_memo_resource(&memo, resource);
+    _find_obs_memo_resource(&memo, resource, NULL);
     if (memo == NULL) {
         /* Unique return value to specify there is not an observer */
         return GCOAP_OBS_INIT_UNUSED;
@@ -883,7 +1204,10 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                     memo->token_len, COAP_CODE_CONTENT, msgid);
 
     if (hdrlen > 0) {
-        coap_pkt_init(pdu, buf, len - GCOAP_OBS_OPTIONS_BUF, hdrlen);
+        /* leave room to patch in the longest token of any observer */
+        coap_pkt_init(pdu, buf, len - GCOAP_OBS_OPTIONS_BUF
+                                    - (GCOAP_TOKENLEN_MAX - memo->token_len),
+                      hdrlen);
 
         uint32_t now       = xtimer_now_usec();
         pdu->observe_value = (now >> GCOAP_OBS_TICK_EXPONENT) & 0xFFFFFF;
@@ -897,20 +1221,41 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     }
 }
 
-size_t gcoap_obs_send(const uint8_t *buf, size_t len,
+size_t gcoap_obs_send(uint8_t *buf, size_t len,
                       const coap_resource_t *resource)
 {
+    coap_hdr_t *hdr = (coap_hdr_t *)buf;
     gcoap_observe_memo_t *memo = NULL;
+    unsigned token_len = hdr->ver_t_tkl & 0xf;
+    bool first = true;
+    size_t sent = 0;
+
+    /* the notification was encoded once; only patch in the token and
+     * message ID for each observer */
+    _find_obs_memo_resource(&memo, resource, NULL);
+    while (memo) {
+        if (memo->token_len != token_len) {
+            memmove(buf + sizeof(coap_hdr_t) + memo->token_len,
+                    buf + sizeof(coap_hdr_t) + token_len,
+                    len - sizeof(coap_hdr_t) - token_len);
+            len = len - token_len + memo->token_len;
+            token_len = memo->token_len;
+            hdr->ver_t_tkl = (hdr->ver_t_tkl & 0xf0) | token_len;
+        }
+        memcpy(buf + sizeof(coap_hdr_t), memo->token, token_len);
+        if (!first) {
+            uint16_t msgid = (uint16_t)atomic_fetch_add(&_coap_state.next_message_id, 1);
+            hdr->id = htons(msgid);
+        }
+        first = false;
 
-    _find_obs_memo_resource(&memo, resource);
-
-    if (memo) {
         ssize_t bytes = sock_udp_send(&_sock, buf, len, memo->observer);
-        return (size_t)((bytes > 0) ? bytes : 0);
-    }
-    else {
-        return 0;
+        if (bytes > 0) {
+            sent = (size_t)bytes;
+        }
+        _find_obs_memo_resource(&memo, resource, NULL);
     }
+    return sent;
 }
 
 uint8_t gcoap_op_state(void)
@@ -39,6 +39,9 @@
 #define COAP_RST                (3)
 /** @} */
 
+/* Option index entry if the option is in a slot beyond the ones indexed */
+#define OPT_INDEX_SCAN          (0xf)
+
 static int _decode_value(unsigned val, uint8_t **pkt_pos_ptr, uint8_t *pkt_end);
 int coap_get_option_uint(coap_pkt_t *pkt, unsigned opt_num, uint32_t *target);
 static uint32_t _decode_uint(uint8_t *pkt_pos, unsigned nbytes);
@@ -57,6 +60,29 @@ static size_t _encode_uint(uint32_t *val);
  * |1 1 1 1 1 1 1 1|    Payload (if any) ...
  * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  */
+
+/*
+ * The option index holds one nibble per option number: 0 if the option is not
+ * present, otherwise the slot of its first entry in pkt->options + 1. Slots
+ * from OPT_INDEX_SCAN - 1 on are found by scanning from there.
+ */
+static void _opt_index_set(coap_pkt_t *pkt, unsigned opt_num, unsigned slot)
+{
+    if (opt_num >= NANOCOAP_OPT_INDEX_MAX) {
+        return;
+    }
+
+    uint8_t *entry = &pkt->opt_index[opt_num / 2];
+    unsigned shift = (opt_num & 1) * 4;
+
+    if ((*entry >> shift) & 0xf) {
+        /* keep first entry for repeated options */
+        return;
+    }
+    slot = (slot + 1 < OPT_INDEX_SCAN) ? slot + 1 : OPT_INDEX_SCAN;
+    *entry |= slot << shift;
+}
+
 int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
 {
     coap_hdr_t *hdr = (coap_hdr_t *)buf;
@@ -81,6 +107,8 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
     unsigned option_count = 0;
     unsigned option_nr = 0;
 
+    memset(pkt->opt_index, 0, sizeof(pkt->opt_index));
+
     /* parse options */
     while (pkt_pos != pkt_end) {
         uint8_t *option_start = pkt_pos;
@@ -106,6 +134,11 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
             DEBUG("option count=%u nr=%u len=%i\n", option_count, option_nr, option_len);
 
             if (option_delta) {
+                if (option_count == NANOCOAP_NOPTS_MAX) {
+                    DEBUG("nanocoap: too many options\n");
+                    return -ENOMEM;
+                }
+                _opt_index_set(pkt, option_nr, option_count);
                 optpos->opt_num = option_nr;
                 optpos->offset = (uintptr_t)option_start - (uintptr_t)hdr;
                 DEBUG("optpos option_nr=%u %u\n", (unsigned)option_nr, (unsigned)optpos->offset);
@@ -146,6 +179,19 @@ uint8_t *coap_find_option(const coap_pkt_t *pkt, unsigned opt_num)
     const coap_optpos_t *optpos = pkt->options;
     unsigned opt_count = pkt->options_len;
 
+    if (opt_num < NANOCOAP_OPT_INDEX_MAX) {
+        unsigned slot = (pkt->opt_index[opt_num / 2] >> ((opt_num & 1) * 4)) & 0xf;
+
+        if (slot == 0) {
+            return NULL;
+        }
+        if (slot != OPT_INDEX_SCAN) {
+            return (uint8_t*)pkt->hdr + pkt->options[slot - 1].offset;
+        }
+        optpos += OPT_INDEX_SCAN - 1;
+        opt_count -= OPT_INDEX_SCAN - 1;
+    }
+
     while (opt_count--) {
         if (optpos->opt_num == opt_num) {
             return (uint8_t*)pkt->hdr + optpos->offset;
@@ -675,7 +721,15 @@ size_t coap_opt_put_string(uint8_t *buf, uint16_t lastonum, uint16_t optnum,
 }
 
 /* Common functionality for addition of an option */
-static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, uint8_t *val,
+/* Size of the length field of an option value staged by the builder */
+#define BUILDER_LEN_SIZE    (2U)
+/* Maximum size of an encoded option header */
+#define OPT_HDR_SIZE_MAX    (5U)
+
+typedef ssize_t (*_add_opt_t)(coap_pkt_t *pkt, uint16_t optnum,
+                              const uint8_t *val, size_t val_len);
+
+static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, const uint8_t *val,
                             size_t val_len)
 {
     assert(pkt->options_len < NANOCOAP_NOPTS_MAX);
@@ -684,9 +738,11 @@ static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, uint8_t *val,
             ? pkt->options[pkt->options_len - 1].opt_num : 0;
     assert(optnum >= lastonum);
 
-    size_t optlen = coap_put_option(pkt->payload, lastonum, optnum, val, val_len);
+    size_t optlen = coap_put_option(pkt->payload, lastonum, optnum,
+                                    (uint8_t *)val, val_len);
     assert(pkt->payload_len > optlen);
 
+    _opt_index_set(pkt, optnum, pkt->options_len);
     pkt->options[pkt->options_len].opt_num = optnum;
     pkt->options[pkt->options_len].offset = pkt->payload - (uint8_t *)pkt->hdr;
     pkt->options_len++;
@@ -696,8 +752,9 @@ static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, uint8_t *val,
     return optlen;
 }
 
-ssize_t coap_opt_add_string(coap_pkt_t *pkt, uint16_t optnum, const char *string,
-                           char separator)
+static ssize_t _add_opt_string(coap_pkt_t *pkt, uint16_t optnum,
+                               const char *string, char separator,
+                               _add_opt_t add)
 {
     size_t unread_len = strlen(string);
     if (!unread_len) {
@@ -731,13 +788,23 @@ ssize_t coap_opt_add_string(coap_pkt_t *pkt, uint16_t optnum, const char *string
             if (pkt->options_len == NANOCOAP_NOPTS_MAX) {
                 return -ENOSPC;
             }
-            write_len += _add_opt_pkt(pkt, optnum, part_start, part_len);
+            ssize_t res = add(pkt, optnum, part_start, part_len);
+            if (res < 0) {
+                return res;
+            }
+            write_len += res;
         }
     }
 
     return write_len;
 }
 
+ssize_t coap_opt_add_string(coap_pkt_t *pkt, uint16_t optnum, const char *string,
+                           char separator)
+{
+    return _add_opt_string(pkt, optnum, string, separator, _add_opt_pkt);
+}
+
 ssize_t coap_opt_add_uint(coap_pkt_t *pkt, uint16_t optnum, uint32_t value)
 {
     uint32_t tmp = value;
@@ -760,6 +827,85 @@ ssize_t coap_opt_finish(coap_pkt_t *pkt, uint16_t flags)
     return pkt->payload - (uint8_t *)pkt->hdr;
 }
 
+/*
+ * The builder stages option values downwards from the end of the buffer, each
+ * preceded by its length. pkt->payload points to the last staged value and
+ * pkt->payload_len is the space left, keeping room to encode every staged
+ * option with a maximum size header in front of the staged values.
+ * pkt->options is kept sorted by option number and points to staged values.
+ */
+void coap_builder_init(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                       size_t header_len)
+{
+    coap_pkt_init(pkt, buf, len, header_len);
+    pkt->payload = buf + len;
+}
+
+ssize_t coap_builder_add_opaque(coap_pkt_t *pkt, uint16_t optnum,
+                                const uint8_t *val, size_t val_len)
+{
+    size_t need = BUILDER_LEN_SIZE + OPT_HDR_SIZE_MAX + (2 * val_len);
+
+    if ((pkt->options_len == NANOCOAP_NOPTS_MAX) || (pkt->payload_len < need)) {
+        return -ENOSPC;
+    }
+    pkt->payload -= BUILDER_LEN_SIZE + val_len;
+    pkt->payload_len -= need;
+    pkt->payload[0] = val_len >> 8;
+    pkt->payload[1] = val_len & 0xff;
+    memcpy(pkt->payload + BUILDER_LEN_SIZE, val, val_len);
+
+    /* insert after options with the same number to keep their order */
+    unsigned i = pkt->options_len++;
+    while (i && (pkt->options[i - 1].opt_num > optnum)) {
+        pkt->options[i] = pkt->options[i - 1];
+        i--;
+    }
+    pkt->options[i].opt_num = optnum;
+    pkt->options[i].offset = pkt->payload - (uint8_t *)pkt->hdr;
+
+    return val_len;
+}
+
+ssize_t coap_builder_add_string(coap_pkt_t *pkt, uint16_t optnum,
+                                const char *string, char separator)
+{
+    return _add_opt_string(pkt, optnum, string, separator,
+                           coap_builder_add_opaque);
+}
+
+ssize_t coap_builder_add_uint(coap_pkt_t *pkt, uint16_t optnum,
+                              uint32_t value)
+{
+    uint32_t tmp = value;
+    unsigned tmp_len = _encode_uint(&tmp);
+    return coap_builder_add_opaque(pkt, optnum, (uint8_t *)&tmp, tmp_len);
+}
+
+ssize_t coap_builder_finish(coap_pkt_t *pkt, uint16_t flags)
+{
+    uint8_t *pos = (uint8_t *)pkt->hdr + coap_get_total_hdr_len(pkt);
+    uint8_t *end = pkt->payload;
+    uint16_t lastonum = 0;
+
+    /* encoded options never reach a staged value not encoded yet */
+    for (unsigned i = 0; i < pkt->options_len; i++) {
+        uint8_t *staged = (uint8_t *)pkt->hdr + pkt->options[i].offset;
+        size_t val_len = (staged[0] << 8) | staged[1];
+
+        end += BUILDER_LEN_SIZE + val_len;
+        pkt->options[i].offset = pos - (uint8_t *)pkt->hdr;
+        _opt_index_set(pkt, pkt->options[i].opt_num, i);
+        pos += coap_put_option(pos, lastonum, pkt->options[i].opt_num,
+                               staged + BUILDER_LEN_SIZE, val_len);
+        lastonum = pkt->options[i].opt_num;
+    }
+    pkt->payload = pos;
+    pkt->payload_len = end - pos;
+
+    return coap_opt_finish(pkt, flags);
+}
+
 void coap_block2_init(coap_pkt_t *pkt, coap_block_slicer_t *slicer)
 {
     uint32_t blknum;
@@ -845,6 +991,199 @@ size_t coap_blockwise_put_bytes(coap_block_slicer_t *slicer, uint8_t *bufpos,
     return str_len;
 }
 
+static void _block_xfer_init(coap_block_xfer_t *xfer, uint8_t *buf, size_t len,
+                             unsigned szx, unsigned window)
+{
+    assert((window > 0) && (window <= COAP_BLOCK_XFER_WINDOW_MAX));
+    assert(szx <= COAP_BLOCKWISE_SZX_MAX - 1);
+
+    memset(xfer, 0, sizeof(*xfer));
+    xfer->buf = buf;
+    xfer->len = len;
+    xfer->szx = szx;
+    xfer->window = window;
+}
+
+static uint32_t _block1_last(coap_block_xfer_t *xfer)
+{
+    return (xfer->len) ? (xfer->len - 1) >> (xfer->szx + 4) : 0;
+}
+
+void coap_block1_xfer_init(coap_block_xfer_t *xfer, const uint8_t *data,
+                           size_t len, unsigned szx, unsigned window)
+{
+    /* data is only read for Block1 */
+    _block_xfer_init(xfer, (uint8_t *)data, len, szx, window);
+    xfer->last = _block1_last(xfer);
+}
+
+void coap_block2_xfer_init(coap_block_xfer_t *xfer, uint8_t *buf, size_t len,
+                           unsigned szx, unsigned window)
+{
+    _block_xfer_init(xfer, buf, len, szx, window);
+    xfer->last = UINT32_MAX;
+}
+
+int coap_block_xfer_next(coap_block_xfer_t *xfer, uint32_t *blknum)
+{
+    if ((xfer->next > xfer->last) || (xfer->inflight >= xfer->window) ||
+        ((xfer->next - xfer->base) >= COAP_BLOCK_XFER_WINDOW_MAX)) {
+        return 0;
+    }
+    /* until the first block is confirmed, the block size may change */
+    if ((xfer->base == 0) && (xfer->next > 0)) {
+        return 0;
+    }
+    *blknum = xfer->next++;
+    xfer->inflight++;
+    return 1;
+}
+
+/* Marks a block as completed and determines the state of the transfer */
+static int _block_xfer_done(coap_block_xfer_t *xfer, uint32_t blknum)
+{
+    if ((blknum >= xfer->base) && (blknum < xfer->next) &&
+        (blknum <= xfer->last)) {
+        xfer->done |= (1UL << (blknum - xfer->base));
+        while (xfer->done & 1) {
+            xfer->done >>= 1;
+            xfer->base++;
+        }
+    }
+    if (coap_block_xfer_complete(xfer)) {
+        return 1;
+    }
+    /* all requests answered, but blocks are missing */
+    if ((xfer->inflight == 0) && (xfer->next > xfer->last)) {
+        return -EBADMSG;
+    }
+    return 0;
+}
+
+/* Adopts a smaller block size proposed by the server in reply to block 0 */
+static int _block_xfer_szx(coap_block_xfer_t *xfer, uint32_t blknum,
+                           unsigned szx)
+{
+    if (szx == xfer->szx) {
+        return 0;
+    }
+    if ((szx > xfer->szx) || (blknum != 0) || (xfer->base != 0)) {
+        DEBUG("nanocoap: unexpected block size change\n");
+        return -EBADMSG;
+    }
+    xfer->szx = szx;
+    return 0;
+}
+
+ssize_t coap_block1_xfer_finish(coap_pkt_t *pkt, const coap_block_xfer_t *xfer,
+                                uint32_t blknum)
+{
+    size_t offset = (size_t)blknum << (xfer->szx + 4);
+    size_t len = coap_szx2size(xfer->szx);
+    int more = (blknum < xfer->last);
+
+    assert(offset <= xfer->len);
+    if (!more) {
+        len = xfer->len - offset;
+    }
+    coap_opt_add_uint(pkt, COAP_OPT_BLOCK1,
+                      (blknum << COAP_BLOCKWISE_NUM_OFF) |
+                      (more << COAP_BLOCKWISE_MORE_OFF) | xfer->szx);
+    if (len == 0) {
+        return coap_opt_finish(pkt, COAP_OPT_FINISH_NONE);
+    }
+    if (pkt->payload_len <= len) {
+        return -ENOSPC;
+    }
+    ssize_t pdu_len = coap_opt_finish(pkt, COAP_OPT_FINISH_PAYLOAD);
+    memcpy(pkt->payload, xfer->buf + offset, len);
+    pkt->payload_len = len;
+    return pdu_len + len;
+}
+
+ssize_t coap_opt_add_block2_xfer(coap_pkt_t *pkt, const coap_block_xfer_t *xfer,
+                                 uint32_t blknum)
+{
+    return coap_opt_add_uint(pkt, COAP_OPT_BLOCK2,
+                             (blknum << COAP_BLOCKWISE_NUM_OFF) | xfer->szx);
+}
+
+int coap_block1_xfer_recv(coap_block_xfer_t *xfer, coap_pkt_t *pkt)
+{
+    uint32_t blknum;
+    unsigned szx;
+    int more = coap_get_blockopt(pkt, COAP_OPT_BLOCK1, &blknum, &szx);
+
+    if (xfer->inflight) {
+        xfer->inflight--;
+    }
+    if (coap_get_code_class(pkt) != COAP_CLASS_SUCCESS) {
+        return -EPROTO;
+    }
+    if (more < 0) {
+        /* servers may omit the option in the final response */
+        if (coap_get_code_raw(pkt) == COAP_CODE_231) {
+            return -EBADMSG;
+        }
+        blknum = xfer->last;
+    }
+    else {
+        if (_block_xfer_szx(xfer, blknum, szx) < 0) {
+            return -EBADMSG;
+        }
+        xfer->last = _block1_last(xfer);
+    }
+    return _block_xfer_done(xfer, blknum);
+}
+
+int coap_block2_xfer_recv(coap_block_xfer_t *xfer, coap_pkt_t *pkt)
+{
+    uint32_t blknum;
+    unsigned szx;
+    int more = coap_get_blockopt(pkt, COAP_OPT_BLOCK2, &blknum, &szx);
+
+    if (xfer->inflight) {
+        xfer->inflight--;
+    }
+    if (coap_get_code_class(pkt) != COAP_CLASS_SUCCESS) {
+        /* a block beyond the end was requested, ask for no further ones */
+        if ((coap_get_code_raw(pkt) == COAP_CODE_BAD_OPTION) &&
+            (xfer->base > 0)) {
+            if (xfer->last > xfer->next - 1) {
+                xfer->last = xfer->next - 1;
+            }
+            return _block_xfer_done(xfer, UINT32_MAX);
+        }
+        return -EPROTO;
+    }
+    if (more < 0) {
+        /* representation fits into a single response */
+        if (xfer->base != 0) {
+            return -EBADMSG;
+        }
+        more = 0;
+        szx = xfer->szx;
+    }
+    if (_block_xfer_szx(xfer, blknum, szx) < 0) {
+        return -EBADMSG;
+    }
+
+    size_t offset = (size_t)blknum << (szx + 4);
+
+    if (more && (pkt->payload_len != coap_szx2size(szx))) {
+        return -EBADMSG;
+    }
+    if ((offset > xfer->len) || (pkt->payload_len > (xfer->len - offset))) {
+        return -ENOBUFS;
+    }
+    memcpy(xfer->buf + offset, pkt->payload, pkt->payload_len);
+    if (!more && (blknum <= xfer->last)) {
+        xfer->last = blknum;
+        xfer->total = offset + pkt->payload_len;
+    }
+    return _block_xfer_done(xfer, blknum);
+}
+
 ssize_t coap_well_known_core_default_handler(coap_pkt_t *pkt, uint8_t *buf, \
                                              size_t len, void *context)
 {
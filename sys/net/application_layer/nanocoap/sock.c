@@ -24,6 +24,7 @@
 
 #include "net/nanocoap_sock.h"
 #include "net/sock/udp.h"
+#include "xtimer.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -118,6 +119,181 @@ ssize_t nanocoap_get(sock_udp_ep_t *remote, const char *path, uint8_t *buf, size
     return res;
 }
 
+/* A block-wise request in flight */
+typedef struct {
+    uint32_t blknum;
+    uint32_t deadline;                  /* time of next retransmission */
+    uint32_t timeout;
+    uint8_t tries;                      /* 0 if unused */
+} _block_req_t;
+
+/* Message IDs of block-wise requests are derived from their block number */
+static uint16_t _block_id_base;
+
+static ssize_t _block_send(sock_udp_t *sock, unsigned method, const char *path,
+                           coap_block_xfer_t *xfer, bool block1,
+                           uint32_t blknum, uint8_t *buf, size_t len)
+{
+    coap_pkt_t pkt;
+    ssize_t pdu_len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                                     method, _block_id_base + blknum);
+
+    coap_pkt_init(&pkt, buf, len, pdu_len);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, path, '/');
+    if (block1) {
+        pdu_len = coap_block1_xfer_finish(&pkt, xfer, blknum);
+    }
+    else {
+        coap_opt_add_block2_xfer(&pkt, xfer, blknum);
+        pdu_len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    }
+    if (pdu_len < 0) {
+        return pdu_len;
+    }
+    return sock_udp_send(sock, buf, pdu_len, NULL);
+}
+
+static ssize_t _blockwise(sock_udp_ep_t *remote, unsigned method,
+                          const char *path, coap_block_xfer_t *xfer,
+                          bool block1, uint8_t *buf, size_t len)
+{
+    _block_req_t reqs[NANOCOAP_SOCK_BLOCK_WINDOW_MAX];
+    sock_udp_t sock;
+    ssize_t res;
+
+    assert(xfer->window <= NANOCOAP_SOCK_BLOCK_WINDOW_MAX);
+    memset(reqs, 0, sizeof(reqs));
+
+    if (!remote->port) {
+        remote->port = COAP_PORT;
+    }
+
+    res = sock_udp_create(&sock, NULL, remote, 0);
+    if (res < 0) {
+        return res;
+    }
+
+    while (1) {
+        uint32_t now = xtimer_now_usec();
+        uint32_t wait = UINT32_MAX;
+        coap_pkt_t pkt;
+        _block_req_t *req = NULL;
+
+        /* fill the window */
+        for (unsigned i = 0; i < xfer->window; i++) {
+            if ((reqs[i].tries == 0) &&
+                coap_block_xfer_next(xfer, &reqs[i].blknum)) {
+                reqs[i].tries = 1;
+                reqs[i].timeout = COAP_ACK_TIMEOUT * US_PER_SEC;
+                reqs[i].deadline = now + reqs[i].timeout;
+                res = _block_send(&sock, method, path, xfer, block1,
+                                  reqs[i].blknum, buf, len);
+                if (res < 0) {
+                    DEBUG("nanocoap: error sending block request\n");
+                    goto out;
+                }
+            }
+            if (reqs[i].tries) {
+                int32_t left = (int32_t)(reqs[i].deadline - now);
+
+                if ((left > 0) && ((uint32_t)left < wait)) {
+                    wait = left;
+                }
+                else if (left <= 0) {
+                    wait = 0;
+                }
+            }
+        }
+        /* responses to all requests processed, but transfer incomplete */
+        if (wait == UINT32_MAX) {
+            res = -EBADMSG;
+            goto out;
+        }
+
+        res = sock_udp_recv(&sock, buf, len, wait, NULL);
+        if ((res == -ETIMEDOUT) || (res == -EAGAIN)) {
+            now = xtimer_now_usec();
+            for (unsigned i = 0; i < xfer->window; i++) {
+                if ((reqs[i].tries == 0) ||
+                    ((int32_t)(reqs[i].deadline - now) > 0)) {
+                    continue;
+                }
+                if (reqs[i].tries > COAP_MAX_RETRANSMIT) {
+                    DEBUG("nanocoap: maximum retries reached.\n");
+                    res = -ETIMEDOUT;
+                    goto out;
+                }
+                reqs[i].tries++;
+                reqs[i].timeout *= 2;
+                reqs[i].deadline = now + reqs[i].timeout;
+                res = _block_send(&sock, method, path, xfer, block1,
+                                  reqs[i].blknum, buf, len);
+                if (res < 0) {
+                    goto out;
+                }
+            }
+            continue;
+        }
+        else if (res < 0) {
+            DEBUG("nanocoap: error receiving block response\n");
+            goto out;
+        }
+
+        if ((coap_parse(&pkt, buf, res) < 0) ||
+            (coap_get_type(&pkt) != COAP_TYPE_ACK) ||
+            (coap_get_code_raw(&pkt) == 0)) {
+            /* separate responses are not supported */
+            continue;
+        }
+        for (unsigned i = 0; i < xfer->window; i++) {
+            if (reqs[i].tries && (coap_get_id(&pkt) ==
+                                  (uint16_t)(_block_id_base + reqs[i].blknum))) {
+                req = &reqs[i];
+                break;
+            }
+        }
+        if (req == NULL) {
+            /* duplicate */
+            continue;
+        }
+        req->tries = 0;
+
+        res = (block1) ? coap_block1_xfer_recv(xfer, &pkt)
+                       : coap_block2_xfer_recv(xfer, &pkt);
+        if (res == -EPROTO) {
+            res = -(ssize_t)coap_get_code(&pkt);
+            goto out;
+        }
+        else if (res < 0) {
+            goto out;
+        }
+        else if (res == 1) {
+            res = (block1) ? (ssize_t)coap_get_code(&pkt) : (ssize_t)xfer->total;
+            goto out;
+        }
+    }
+
+out:
+    _block_id_base += xfer->next;
+    sock_udp_close(&sock);
+
+    return res;
+}
+
+ssize_t nanocoap_get_blockwise(sock_udp_ep_t *remote, const char *path,
+                               coap_block_xfer_t *xfer, uint8_t *buf,
+                               size_t len)
+{
+    return _blockwise(remote, COAP_METHOD_GET, path, xfer, false, buf, len);
+}
+
+ssize_t nanocoap_send_blockwise(sock_udp_ep_t *remote, unsigned method,
+                                const char *path, coap_block_xfer_t *xfer,
+                                uint8_t *buf, size_t len)
+{
+    return _blockwise(remote, method, path, xfer, true, buf, len);
+}
+
 int nanocoap_server(sock_udp_ep_t *local, uint8_t *buf, size_t bufsize)
 {
     sock_udp_t sock;
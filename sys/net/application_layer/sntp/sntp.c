@@ -18,6 +18,8 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <stdbool.h>
 #include <string.h>
 #include "net/sntp.h"
 #include "net/ntp_packet.h"
@@ -34,6 +36,157 @@ static int64_t _sntp_offset = 0;
 static mutex_t _sntp_mutex = MUTEX_INIT;
 static ntp_packet_t _sntp_packet;
 
+static int64_t _ntp_usec(const ntp_timestamp_t *ts)
+{
+    /* the fraction is in units of 2^-32 s */
+    return (((int64_t)byteorder_ntohl(ts->seconds)) * US_PER_SEC) +
+           ((((uint64_t)byteorder_ntohl(ts->fraction)) * US_PER_SEC) >> 32);
+}
+
+#ifdef MODULE_SNTP_DISCIPLINE
+typedef struct {
+    uint64_t local;         /* local time in the middle of the exchange */
+    int64_t offset;         /* real time offset at that local time */
+    uint32_t delay;         /* round-trip delay of the exchange */
+} _sntp_sample_t;
+
+static _sntp_sample_t _sntp_samples[SNTP_DISCIPLINE_SAMPLES];
+static unsigned _sntp_samples_numof;
+static unsigned _sntp_samples_next;
+static uint64_t _sntp_ref;      /* local time _sntp_offset is valid at */
+static int32_t _sntp_drift;     /* frequency error of the local clock in ppb */
+
+/* least squares fit of the offsets of the used samples over local time in
+ * ms, both relative to the reference sample; returns the number of samples
+ * used and sets the fitted offset at the reference sample */
+static unsigned _sntp_fit(const _sntp_sample_t *ref, const bool *used,
+                          int64_t *offset)
+{
+    int64_t sum_x = 0, sum_y = 0, num = 0, den = 0;
+    int64_t min_x = 0, max_x = 0;
+    unsigned n = 0;
+
+    for (unsigned i = 0; i < _sntp_samples_numof; i++) {
+        if (used[i]) {
+            int64_t x = (int64_t)(_sntp_samples[i].local - ref->local) / US_PER_MS;
+
+            sum_x += x;
+            sum_y += _sntp_samples[i].offset - ref->offset;
+            min_x = (x < min_x) ? x : min_x;
+            max_x = (x > max_x) ? x : max_x;
+            n++;
+        }
+    }
+    if (n == 0) {
+        *offset = ref->offset;
+        return 0;
+    }
+
+    int64_t mean_x = sum_x / n;
+    int64_t mean_y = sum_y / n;
+
+    /* a drift estimate from samples close in time is dominated by jitter,
+     * keep the previous one until the samples span enough time */
+    if ((max_x - min_x) >= (SNTP_DISCIPLINE_MIN_SPAN / US_PER_MS)) {
+        for (unsigned i = 0; i < _sntp_samples_numof; i++) {
+            if (used[i]) {
+                int64_t dx = (int64_t)(_sntp_samples[i].local - ref->local) /
+                             US_PER_MS - mean_x;
+                int64_t dy = _sntp_samples[i].offset - ref->offset - mean_y;
+
+                num += dx * dy;
+                den += dx * dx;
+            }
+        }
+        /* the slope is in us/ms, i.e. 10^6 ppb */
+        int64_t drift = num / (den / 1000000);
+
+        if (drift > SNTP_DISCIPLINE_MAX_DRIFT) {
+            drift = SNTP_DISCIPLINE_MAX_DRIFT;
+        }
+        else if (drift < -SNTP_DISCIPLINE_MAX_DRIFT) {
+            drift = -SNTP_DISCIPLINE_MAX_DRIFT;
+        }
+        _sntp_drift = drift;
+    }
+    *offset = ref->offset + mean_y - ((mean_x * _sntp_drift) / 1000000);
+    return n;
+}
+
+static void _sntp_discipline(uint64_t t1, uint64_t t4)
+{
+    int64_t t3 = _ntp_usec(&_sntp_packet.transmit);
+    /* some servers leave the receive timestamp empty */
+    int64_t t2 = (_sntp_packet.receive.seconds.u32 != 0) ?
+                 _ntp_usec(&_sntp_packet.receive) : t3;
+    int64_t delay = (int64_t)(t4 - t1) - (t3 - t2);
+    _sntp_sample_t *ref = &_sntp_samples[_sntp_samples_next];
+    bool used[SNTP_DISCIPLINE_SAMPLES];
+    uint32_t max_delay = UINT32_MAX;
+    int64_t offset;
+
+    ref->local = t1 + ((t4 - t1) / 2);
+    ref->offset = ((t2 - (int64_t)t1) + (t3 - (int64_t)t4)) / 2;
+    ref->delay = (delay < 0) ? 0 : delay;
+    _sntp_samples_next = (_sntp_samples_next + 1) % SNTP_DISCIPLINE_SAMPLES;
+    if (_sntp_samples_numof < SNTP_DISCIPLINE_SAMPLES) {
+        _sntp_samples_numof++;
+    }
+
+    /* samples that took much longer than the fastest exchange were queued
+     * somewhere on the path, their offset is off by up to half the excess */
+    for (unsigned i = 0; i < _sntp_samples_numof; i++) {
+        if (_sntp_samples[i].delay < max_delay) {
+            max_delay = _sntp_samples[i].delay;
+        }
+    }
+    max_delay = (2 * max_delay) + SNTP_DISCIPLINE_DELAY_MARGIN;
+    for (unsigned i = 0; i < _sntp_samples_numof; i++) {
+        used[i] = (_sntp_samples[i].delay <= max_delay);
+    }
+    if (!used[ref - _sntp_samples]) {
+        DEBUG("sntp: sample with delay %" PRIu32 " us rejected\n", ref->delay);
+        return;
+    }
+
+    unsigned n = _sntp_fit(ref, used, &offset);
+
+    /* reject samples far off the fitted line and fit again */
+    if (n > 2) {
+        uint64_t sum = 0;
+        int64_t res[SNTP_DISCIPLINE_SAMPLES];
+
+        for (unsigned i = 0; i < _sntp_samples_numof; i++) {
+            if (used[i]) {
+                int64_t dx = (int64_t)(_sntp_samples[i].local - ref->local) / US_PER_MS;
+
+                res[i] = _sntp_samples[i].offset - offset -
+                         ((dx * _sntp_drift) / 1000000);
+                res[i] = (res[i] < 0) ? -res[i] : res[i];
+                sum += res[i];
+            }
+        }
+        int64_t limit = ((3 * sum) / n) + SNTP_DISCIPLINE_DELAY_MARGIN;
+        bool refit = false;
+
+        for (unsigned i = 0; i < _sntp_samples_numof; i++) {
+            if (used[i] && (res[i] > limit) && (&_sntp_samples[i] != ref)) {
+                used[i] = false;
+                refit = true;
+            }
+        }
+        if (refit) {
+            _sntp_fit(ref, used, &offset);
+        }
+    }
+
+    _sntp_ref = ref->local;
+    _sntp_offset = offset;
+    DEBUG("sntp: offset %" PRId64 " us, drift %" PRId32 " ppb\n", offset,
+          _sntp_drift);
+}
+#endif /* MODULE_SNTP_DISCIPLINE */
+
 int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
 {
     int result;
@@ -49,6 +202,10 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
     ntp_packet_set_vn(&_sntp_packet);
     ntp_packet_set_mode(&_sntp_packet, NTP_MODE_CLIENT);
 
+#ifdef MODULE_SNTP_DISCIPLINE
+    uint64_t t1 = xtimer_now_usec64();
+#endif
+
     if ((result = (int)sock_udp_send(&_sntp_sock,
                                      &_sntp_packet,
                                      sizeof(_sntp_packet),
@@ -66,11 +223,16 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
         sock_udp_close(&_sntp_sock);
         return result;
     }
+#ifdef MODULE_SNTP_DISCIPLINE
+    uint64_t t4 = xtimer_now_usec64();
+#endif
     sock_udp_close(&_sntp_sock);
     mutex_lock(&_sntp_mutex);
-    _sntp_offset = (((int64_t)byteorder_ntohl(_sntp_packet.transmit.seconds)) * US_PER_SEC) +
-                   ((((int64_t)byteorder_ntohl(_sntp_packet.transmit.fraction)) * 232)
-                   / 1000000) - xtimer_now_usec64();
+#ifdef MODULE_SNTP_DISCIPLINE
+    _sntp_discipline(t1, t4);
+#else
+    _sntp_offset = _ntp_usec(&_sntp_packet.transmit) - xtimer_now_usec64();
+#endif
     mutex_unlock(&_sntp_mutex);
     return 0;
 }
@@ -81,6 +243,23 @@ int64_t sntp_get_offset(void)
 
     mutex_lock(&_sntp_mutex);
     result = _sntp_offset;
+#ifdef MODULE_SNTP_DISCIPLINE
+    /* the local clock drifted away since the last synchronization */
+    result += ((int64_t)(xtimer_now_usec64() - _sntp_ref) * _sntp_drift) /
+              1000000000;
+#endif
+    mutex_unlock(&_sntp_mutex);
+    return result;
+}
+
+#ifdef MODULE_SNTP_DISCIPLINE
+int32_t sntp_get_drift(void)
+{
+    int32_t result;
+
+    mutex_lock(&_sntp_mutex);
+    result = _sntp_drift;
     mutex_unlock(&_sntp_mutex);
     return result;
 }
+#endif
@@ -47,7 +47,11 @@ int bluetil_ad_find(const bluetil_ad_t *ad, uint8_t type,
     while ((pos + POS_TYPE) < ad->pos) {
         uint8_t len = ad->buf[pos];
 
-        if (ad->buf[pos + POS_TYPE] == type) {
+        if ((pos + len) >= ad->pos) {
+            /* truncated field */
+            break;
+        }
+        if ((len > 0) && (ad->buf[pos + POS_TYPE] == type)) {
             data->data = ad->buf + pos + POS_DATA;
             data->len = len - 1;           /* take away the type field */
             return BLUETIL_AD_OK;
@@ -59,6 +63,105 @@ int bluetil_ad_find(const bluetil_ad_t *ad, uint8_t type,
     return BLUETIL_AD_NOTFOUND;
 }
 
+int bluetil_ad_index(const bluetil_ad_t *ad, bluetil_ad_index_t *idx)
+{
+    assert(ad);
+    assert(idx);
+
+    size_t pos = 0;
+
+    idx->buf = ad->buf;
+    idx->numof = 0;
+    while (pos < ad->pos) {
+        uint8_t len = ad->buf[pos];
+
+        if (len == 0) {
+            /* empty fields only pad the data */
+            pos++;
+            continue;
+        }
+        if ((pos + len) >= ad->pos) {
+            return BLUETIL_AD_INVALID;
+        }
+        if (idx->numof == BLUETIL_AD_INDEX_NUMOF) {
+            return BLUETIL_AD_NOMEM;
+        }
+
+        bluetil_ad_field_t *field = &idx->fields[idx->numof++];
+
+        field->type = ad->buf[pos + POS_TYPE];
+        field->pos = pos + POS_DATA;
+        field->len = len - 1;
+        pos += (len + 1);
+    }
+
+    return idx->numof;
+}
+
+int bluetil_ad_index_find(const bluetil_ad_index_t *idx, uint8_t type,
+                          bluetil_ad_data_t *data)
+{
+    assert(idx);
+    assert(data);
+
+    for (unsigned i = 0; i < idx->numof; i++) {
+        if (idx->fields[i].type == type) {
+            data->data = idx->buf + idx->fields[i].pos;
+            data->len = idx->fields[i].len;
+            return BLUETIL_AD_OK;
+        }
+    }
+
+    return BLUETIL_AD_NOTFOUND;
+}
+
+static bool _field_match(const uint8_t *payload, size_t len,
+                         uint8_t type, const bluetil_ad_filter_t *filter)
+{
+    if ((filter->data == NULL) || (filter->len == 0)) {
+        return true;
+    }
+    if (filter->len > len) {
+        return false;
+    }
+    /* UUID lists match any of their entries */
+    size_t step = ((type >= BLE_GAP_AD_UUID16_INCOMP) &&
+                   (type <= BLE_GAP_AD_UUID128_COMP)) ? filter->len : len;
+
+    for (size_t pos = 0; (pos + filter->len) <= len; pos += step) {
+        if (memcmp(payload + pos, filter->data, filter->len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool bluetil_ad_index_match(const bluetil_ad_index_t *idx,
+                            const bluetil_ad_filter_t *filters,
+                            unsigned numof)
+{
+    assert(idx);
+    assert(filters || (numof == 0));
+
+    for (unsigned f = 0; f < numof; f++) {
+        bool found = false;
+
+        for (unsigned i = 0; (i < idx->numof) && !found; i++) {
+            const bluetil_ad_field_t *field = &idx->fields[i];
+
+            if (field->type == filters[f].type) {
+                found = _field_match(idx->buf + field->pos, field->len,
+                                     field->type, &filters[f]);
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 int bluetil_ad_find_str(const bluetil_ad_t *ad, uint8_t type,
                         char *str, size_t str_len)
 {
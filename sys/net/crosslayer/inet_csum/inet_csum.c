@@ -13,13 +13,77 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+static inline uint32_t _load16(const uint8_t *buf)
+{
+    uint16_t tmp;
+    memcpy(&tmp, buf, sizeof(tmp));
+    return tmp;
+}
+
+/*
+ * Sums up @p buf as 16-bit big-endian words, a trailing odd byte is added as
+ * top half of a word. Internally the buffer is summed in host byte order
+ * using aligned 32-bit loads: since the one's complement sum is independent
+ * of byte order (RFC 1071, section 2(B)), the folded result only needs to be
+ * swapped once at the end. Starting at an odd address rotates the byte
+ * pairing by one, which likewise amounts to a byte swap of the result.
+ */
+static uint16_t _sum_words(const uint8_t *buf, size_t len)
+{
+    uint32_t acc = 0;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    bool swap = true;
+#else
+    bool swap = false;
+#endif
+
+    if (((uintptr_t)buf & 1) && len) {
+        uint8_t tmp[2] = { 0, *buf };
+        acc += _load16(tmp);
+        swap = !swap;
+        buf++;
+        len--;
+    }
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        acc += _load16(buf);
+        buf += 2;
+        len -= 2;
+    }
+    /* len is at most UINT16_MAX, so acc can't overflow */
+    while (len >= 4) {
+        uint32_t word;
+        memcpy(&word, buf, sizeof(word));
+        acc += (word & 0xffff) + (word >> 16);
+        buf += 4;
+        len -= 4;
+    }
+    if (len >= 2) {
+        acc += _load16(buf);
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {
+        uint8_t tmp[2] = { *buf, 0 };
+        acc += _load16(tmp);
+    }
+
+    while (acc >> 16) {
+        acc = (acc & 0xffff) + (acc >> 16);
+    }
+
+    return (swap) ? byteorder_swaps((uint16_t)acc) : (uint16_t)acc;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -41,16 +105,10 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
-    }
-
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
     }
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+    /* the remainder starts at a word boundary of the checksum domain */
+    csum += _sum_words(buf, len);
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
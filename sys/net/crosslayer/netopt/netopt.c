@@ -92,6 +92,8 @@ static const char *_netopt_strmap[] = {
     [NETOPT_BLE_CTX]               = "NETOPT_BLE_CTX",
     [NETOPT_CHECKSUM]              = "NETOPT_CHECKSUM",
     [NETOPT_PHY_BUSY]              = "NETOPT_PHY_BUSY",
+    [NETOPT_RX_PREALLOC]           = "NETOPT_RX_PREALLOC",
+    [NETOPT_L2FILTER_HW]           = "NETOPT_L2FILTER_HW",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
@@ -28,6 +28,11 @@
 #include "net/gnrc/ipv6.h"
 #include "random.h"
 
+#ifdef MODULE_VFS
+#include <fcntl.h>
+#include "vfs.h"
+#endif
+
 #define ENABLE_DEBUG                (0)
 #include "debug.h"
 
@@ -112,6 +117,7 @@ typedef enum {
     TOPT_BLKSIZE,
     TOPT_TIMEOUT,
     TOPT_TSIZE,
+    TOPT_WINDOWSIZE,
 } tftp_options_t;
 
 /* ordered as @see tftp_options_t */
@@ -119,12 +125,14 @@ tftp_opt_t _tftp_options[] = {
     [TOPT_BLKSIZE] = MODE(blksize),
     [TOPT_TIMEOUT] = MODE(timeout),
     [TOPT_TSIZE]   = MODE(tsize),
+    [TOPT_WINDOWSIZE] = MODE(windowsize),
 };
 
 /**
  * @brief The TFTP state
  */
 typedef enum {
+    TS_IGNORED     = -4,
     TS_APP_FAILED  = -3,
     TS_DUP         = -2,
     TS_FAILED      = -1,
@@ -168,6 +176,15 @@ typedef struct {
     bool use_options;
     bool enable_options;
     bool write_finished;
+
+    /* RFC 7440 window state */
+    uint16_t window_size;       /**< blocks sent per acknowledgment */
+    uint16_t window_start;      /**< last block acknowledged by the receiver */
+    uint16_t window_pos;        /**< blocks received since the last ACK */
+    bool resync;                /**< a lost block was already reported */
+#ifdef MODULE_VFS
+    int fd;                     /**< file to transfer, -1 to use data_cb */
+#endif
 } tftp_context_t;
 
 /**
@@ -214,6 +231,9 @@ static void _tftp_set_default_options(tftp_context_t *ctxt);
 /* set the TFTP options to use */
 static int _tftp_set_opts(tftp_context_t *ctxt, size_t blksize, uint32_t timeout, size_t total_size);
 
+/* set the options of a client transfer and run it */
+static int _tftp_client(tftp_context_t *ctxt, size_t total_size);
+
 /* this function registers the UDP port and won't return till the TFTP transfer is finished */
 static int _tftp_do_client_transfer(tftp_context_t *ctxt);
 
@@ -226,6 +246,9 @@ static tftp_state _tftp_send_start(tftp_context_t *ctxt, gnrc_pktsnip_t *buf);
 /* send data or and ack depending if we are reading or writing */
 static tftp_state _tftp_send_dack(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, tftp_opcodes_t op);
 
+/* send the blocks of the window following the last acknowledged block */
+static tftp_state _tftp_send_window(tftp_context_t *ctxt, gnrc_pktsnip_t *buf);
+
 /* send and TFTP error to the client */
 static tftp_state _tftp_send_error(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, tftp_err_codes_t err, const char *err_msg);
 
@@ -241,6 +264,9 @@ static int _tftp_decode_options(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, uint3
 /* decode the received ACK packet */
 static bool _tftp_validate_ack(tftp_context_t *ctxt, uint8_t *buf);
 
+/* pass data to or get data from the user application or the file */
+static int _tftp_data(tftp_context_t *ctxt, uint32_t offset, void *data, size_t len);
+
 /* processes the received data packet and calls the callback defined by the user */
 static int _tftp_process_data(tftp_context_t *ctxt, gnrc_pktsnip_t *buf);
 
@@ -250,6 +276,12 @@ static int _tftp_decode_error(uint8_t *buf, tftp_err_codes_t *err, const char *
 /* TFTP super loop server */
 static int _tftp_server(tftp_context_t *ctxt);
 
+/* check if we are sending the DATA packets of the transfer */
+static inline bool _tftp_is_sender(tftp_context_t *ctxt)
+{
+    return (ctxt->ct == CT_CLIENT) ? (ctxt->op == TO_WRQ) : (ctxt->op == TO_RRQ);
+}
+
 /* get the maximum allowed transfer unit to avoid 6Lo fragmentation */
 static uint16_t _tftp_get_maximum_block_size(void)
 {
@@ -278,24 +310,7 @@ int gnrc_tftp_client_read(ipv6_addr_t *addr, const char *file_name, tftp_mode_t
         return -EINVAL;
     }
 
-    /* set the transfer options */
-    uint16_t mtu = _tftp_get_maximum_block_size();
-    if (!use_option_extensions ||
-        _tftp_set_opts(&ctxt, mtu, GNRC_TFTP_DEFAULT_TIMEOUT, 0) != TS_FINISHED) {
-        _tftp_set_default_options(&ctxt);
-
-        if (use_option_extensions) {
-            return -EINVAL;
-        }
-    }
-
-    /* start the process */
-    int ret = _tftp_do_client_transfer(&ctxt);
-
-    /* remove possibly stale timer */
-    xtimer_remove(&(ctxt.timer));
-
-    return ret;
+    return _tftp_client(&ctxt, 0);
 }
 
 int gnrc_tftp_client_write(ipv6_addr_t *addr, const char *file_name, tftp_mode_t mode,
@@ -311,23 +326,78 @@ int gnrc_tftp_client_write(ipv6_addr_t *addr, const char *file_name, tftp_mode_t
         return -EINVAL;
     }
 
+    return _tftp_client(&ctxt, total_size);
+}
+
+#ifdef MODULE_VFS
+int gnrc_tftp_client_read_file(ipv6_addr_t *addr, const char *file_name, tftp_mode_t mode,
+                               const char *path, bool use_option_extensions)
+{
+    tftp_context_t ctxt;
+
+    /* prepare the context */
+    if (_tftp_init_ctxt(addr, file_name, TO_RRQ, mode, CT_CLIENT, NULL, NULL, NULL, use_option_extensions, &ctxt) != TS_FINISHED) {
+        return -EINVAL;
+    }
+
+    ctxt.fd = vfs_open(path, O_WRONLY | O_CREAT | O_TRUNC, 0);
+    if (ctxt.fd < 0) {
+        DEBUG("tftp: unable to open %s\n", path);
+        return ctxt.fd;
+    }
+
+    int ret = _tftp_client(&ctxt, 0);
+
+    vfs_close(ctxt.fd);
+    return ret;
+}
+
+int gnrc_tftp_client_write_file(ipv6_addr_t *addr, const char *file_name, tftp_mode_t mode,
+                                const char *path, bool use_option_extensions)
+{
+    tftp_context_t ctxt;
+    struct stat st;
+
+    /* prepare the context */
+    if (_tftp_init_ctxt(addr, file_name, TO_WRQ, mode, CT_CLIENT, NULL, NULL, NULL, use_option_extensions, &ctxt) != TS_FINISHED) {
+        return -EINVAL;
+    }
+
+    ctxt.fd = vfs_open(path, O_RDONLY, 0);
+    if (ctxt.fd < 0) {
+        DEBUG("tftp: unable to open %s\n", path);
+        return ctxt.fd;
+    }
+
+    int ret = vfs_fstat(ctxt.fd, &st);
+    if (ret == 0) {
+        ret = _tftp_client(&ctxt, st.st_size);
+    }
+
+    vfs_close(ctxt.fd);
+    return ret;
+}
+#endif
+
+int _tftp_client(tftp_context_t *ctxt, size_t total_size)
+{
     /* set the transfer options */
     uint16_t mtu = _tftp_get_maximum_block_size();
-    if (!use_option_extensions ||
-        _tftp_set_opts(&ctxt, mtu, GNRC_TFTP_DEFAULT_TIMEOUT, total_size) != TS_FINISHED) {
+    if (!ctxt->enable_options ||
+        _tftp_set_opts(ctxt, mtu, GNRC_TFTP_DEFAULT_TIMEOUT, total_size) != TS_FINISHED) {
 
-        _tftp_set_default_options(&ctxt);
+        _tftp_set_default_options(ctxt);
 
-        if (use_option_extensions) {
+        if (ctxt->enable_options) {
             return -EINVAL;
         }
     }
 
     /* start the process */
-    int ret = _tftp_do_client_transfer(&ctxt);
+    int ret = _tftp_do_client_transfer(ctxt);
 
     /* remove possibly stale timer */
-    xtimer_remove(&(ctxt.timer));
+    xtimer_remove(&(ctxt->timer));
 
     return ret;
 }
@@ -363,6 +433,10 @@ int _tftp_init_ctxt(ipv6_addr_t *addr, const char *file_name,
     ctxt->block_size = GNRC_TFTP_MAX_TRANSFER_UNIT;
     ctxt->block_timeout = GNRC_TFTP_DEFAULT_TIMEOUT;
     ctxt->write_finished = false;
+    ctxt->window_size = 1;
+#ifdef MODULE_VFS
+    ctxt->fd = -1;
+#endif
 
     /* generate a random source UDP source port */
     do {
@@ -378,6 +452,7 @@ void _tftp_set_default_options(tftp_context_t *ctxt)
     ctxt->timeout = GNRC_TFTP_DEFAULT_TIMEOUT;
     ctxt->block_timeout = GNRC_TFTP_DEFAULT_TIMEOUT;
     ctxt->transfer_size = 0;
+    ctxt->window_size = 1;
     ctxt->use_options = false;
 }
 
@@ -391,6 +466,7 @@ int _tftp_set_opts(tftp_context_t *ctxt, size_t blksize, uint32_t timeout, size_
     ctxt->timeout = timeout;
     ctxt->block_timeout = timeout;
     ctxt->transfer_size = total_size;
+    ctxt->window_size = GNRC_TFTP_WINDOW_SIZE;
     ctxt->use_options = true;
 
     return TS_FINISHED;
@@ -587,8 +663,11 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
         else {
             DEBUG("tftp: last data or ack packet lost, resending\n");
             /* we are sending / receiving data */
-            /* if we are reading resent the ACK, if writing the DATA */
-            return _tftp_send_dack(ctxt, outbuf, (ctxt->op == TO_RRQ) ? TO_ACK : TO_DATA);
+            /* if we are reading resent the ACK, if writing the whole window */
+            if (_tftp_is_sender(ctxt)) {
+                return _tftp_send_window(ctxt, outbuf);
+            }
+            return _tftp_send_dack(ctxt, outbuf, TO_ACK);
         }
     }
     else if (m->type != GNRC_NETAPI_MSG_TYPE_RCV) {
@@ -704,6 +783,11 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
                 return TS_BUSY;
             }
 
+            if (proc == TS_IGNORED) {
+                gnrc_pktbuf_release(outbuf);
+                return TS_BUSY;
+            }
+
             /* check if this is the first block */
             if (!ctxt->block_nr
                 && ctxt->dst_port == GNRC_TFTP_DEFAULT_DST_PORT
@@ -716,10 +800,17 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
                 ctxt->dst_port = byteorder_ntohs(udp->src_port);
             }
 
-            /* wait for the next data block */
+            /* wait for the next data block, only the last block of a window
+             * and the last block of the transfer are acknowledged */
             DEBUG("tftp: wait for the next data block\n");
             ++(ctxt->block_nr);
-            _tftp_send_dack(ctxt, outbuf, TO_ACK);
+            if ((proc < (int)ctxt->block_size) ||
+                (++(ctxt->window_pos) >= ctxt->window_size)) {
+                _tftp_send_dack(ctxt, outbuf, TO_ACK);
+            }
+            else {
+                gnrc_pktbuf_release(outbuf);
+            }
 
             /* check if the data transfer has finished */
             if (proc < (int)ctxt->block_size) {
@@ -744,8 +835,10 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
                 return TS_BUSY;
             }
 
+            uint16_t ack = byteorder_ntohs(((tftp_packet_data_t *)data)->block_nr);
+
             /* check if the write action is finished */
-            if (ctxt->write_finished) {
+            if (ctxt->write_finished && (ack == ctxt->block_nr)) {
                 gnrc_pktbuf_release(outbuf);
 
                 if (ctxt->stop_cb) {
@@ -764,10 +857,11 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
                 ctxt->dst_port = byteorder_ntohs(udp->src_port);
             }
 
-            /* send the next data block */
-            ++(ctxt->block_nr);
+            /* send the next window, starting after the acknowledged block */
+            ctxt->window_start = ack;
+            ctxt->retries = 0;
 
-            return _tftp_send_dack(ctxt, outbuf, TO_DATA);
+            return _tftp_send_window(ctxt, outbuf);
         } break;
 
         case TO_ERROR: {
@@ -792,22 +886,24 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
             if (ctxt->dst_port != byteorder_ntohs(udp->src_port)) {
                 DEBUG("tftp: TO_OACK received\n");
 
+                /* a server that does not know the windowsize option omits it */
+                ctxt->window_size = 1;
+
                 /* decode the options */
                 _tftp_decode_options(ctxt, pkt, 0);
 
                 /* take the new source port */
                 ctxt->dst_port = byteorder_ntohs(udp->src_port);
-
-                /* we must send block one to finish the negotiation in send mode */
-                if (ctxt->op == TO_WRQ) {
-                    ++(ctxt->block_nr);
-                }
             }
             else {
                 DEBUG("tftp: dropping double TO_OACK\n");
             }
 
-            return _tftp_send_dack(ctxt, outbuf, (ctxt->op == TO_WRQ) ? TO_DATA : TO_ACK);
+            /* we must send the first window to finish the negotiation in send mode */
+            if (ctxt->op == TO_WRQ) {
+                return _tftp_send_window(ctxt, outbuf);
+            }
+            return _tftp_send_dack(ctxt, outbuf, TO_ACK);
         } break;
     }
 
@@ -846,6 +942,11 @@ uint32_t _tftp_append_options(tftp_context_t *ctxt, tftp_header_t *hdr, uint32_t
         offset += _tftp_add_option(hdr->data + offset, _tftp_options + TOPT_TSIZE, ctxt->transfer_size);
     }
 
+    /* a window of one block is the default, no need to negotiate it */
+    if (ctxt->window_size > 1) {
+        offset += _tftp_add_option(hdr->data + offset, _tftp_options + TOPT_WINDOWSIZE, ctxt->window_size);
+    }
+
     return offset;
 }
 
@@ -886,7 +987,8 @@ tftp_state _tftp_send_dack(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, tftp_opcod
     if (op == TO_DATA) {
         DEBUG("tftp: getting data from callback\n");
         /* get the required data from the user */
-        len = ctxt->data_cb(ctxt->block_size * (ctxt->block_nr - 1), pkt->data, ctxt->block_size);
+        int res = _tftp_data(ctxt, ctxt->block_size * (ctxt->block_nr - 1), pkt->data, ctxt->block_size);
+        len = (res < 0) ? 0 : (size_t)res;
 
         /* check if we are finished on ACK receive */
         ctxt->write_finished = (len < ctxt->block_size);
@@ -904,12 +1006,42 @@ tftp_state _tftp_send_dack(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, tftp_opcod
     else if (op == TO_ACK) {
         /* disable timeout*/
         ctxt->block_timeout = 0;
+
+        /* the next window starts after this ACK */
+        ctxt->window_pos = 0;
     }
 
     /* send the data */
     return _tftp_send(buf, ctxt, sizeof(tftp_packet_data_t) + len);
 }
 
+tftp_state _tftp_send_window(tftp_context_t *ctxt, gnrc_pktsnip_t *buf)
+{
+    tftp_state state;
+
+    /* (re)start after the last acknowledged block */
+    ctxt->block_nr = ctxt->window_start;
+
+    for (unsigned i = 0; ; ) {
+        ++(ctxt->block_nr);
+        state = _tftp_send_dack(ctxt, buf, TO_DATA);
+
+        /* the last block of the transfer also ends the window */
+        if ((state != TS_BUSY) || ctxt->write_finished ||
+            (++i >= ctxt->window_size)) {
+            return state;
+        }
+
+        buf = gnrc_pktbuf_add(NULL, NULL, TFTP_DEFAULT_DATA_SIZE, GNRC_NETTYPE_UNDEF);
+        if (buf == NULL) {
+            /* the blocks sent so far are just a smaller window, the receiver
+             * acknowledges them after the timeout */
+            DEBUG("tftp: packet buffer full, window shortened to %u\n", i);
+            return TS_BUSY;
+        }
+    }
+}
+
 tftp_state _tftp_send_error(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, tftp_err_codes_t err, const char *err_msg)
 {
     int strl = err_msg ? strlen(err_msg) + 1 : 0;
@@ -1018,8 +1150,16 @@ tftp_state _tftp_send(gnrc_pktsnip_t *buf, tftp_context_t *ctxt, size_t len)
 bool _tftp_validate_ack(tftp_context_t *ctxt, uint8_t *buf)
 {
     tftp_packet_data_t *pkt = (tftp_packet_data_t *) buf;
+    uint16_t ack = byteorder_ntohs(pkt->block_nr);
+
+    if (ctxt->window_size == 1) {
+        return ctxt->block_nr == ack;
+    }
 
-    return ctxt->block_nr == byteorder_ntohs(pkt->block_nr);
+    /* any block of the window in flight may be acknowledged, the sender
+     * continues after it */
+    return (uint16_t)(ack - ctxt->window_start) <=
+           (uint16_t)(ctxt->block_nr - ctxt->window_start);
 }
 
 int _tftp_decode_start(tftp_context_t *ctxt, uint8_t *buf, gnrc_pktsnip_t *outbuf)
@@ -1078,7 +1218,8 @@ int _tftp_decode_options(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, uint32_t sta
                 /* set the option value of the known options */
                 switch (idx) {
                     case TOPT_BLKSIZE:
-                        ctxt->block_size = atoi(value);
+                        /* answer larger requests with what fits our buffers */
+                        ctxt->block_size = MIN(atoi(value), GNRC_TFTP_MAX_TRANSFER_UNIT);
                         DEBUG("tftp: got option TOPT_BLKSIZE = %" PRIu16 "\n", ctxt->block_size);
                         break;
 
@@ -1095,6 +1236,13 @@ int _tftp_decode_options(tftp_context_t *ctxt, gnrc_pktsnip_t *buf, uint32_t sta
                         ctxt->timeout = atoi(value) * US_PER_SEC;
                         DEBUG("tftp: option TOPT_TIMEOUT = %" PRIu32 " ms\n", ctxt->timeout / US_PER_MS);
                         break;
+
+                    case TOPT_WINDOWSIZE: {
+                        /* the peer may only get a window as large as ours */
+                        int window = atoi(value);
+                        ctxt->window_size = (window < 1) ? 1 : MIN(window, GNRC_TFTP_WINDOW_SIZE);
+                        DEBUG("tftp: got option TOPT_WINDOWSIZE = %" PRIu16 "\n", ctxt->window_size);
+                    } break;
                 }
 
                 break;
@@ -1118,17 +1266,33 @@ int _tftp_process_data(tftp_context_t *ctxt, gnrc_pktsnip_t *buf)
     if (block_nr > (ctxt->block_nr + 1)) {
         DEBUG("tftp: incorrect block_nr %d received from server, expected %d\n",
                block_nr, (ctxt->block_nr + 1));
-        return TS_FAILED;
+        if (ctxt->window_size == 1) {
+            return TS_FAILED;
+        }
+
+        /* a block of the window got lost, acknowledge the blocks received in
+         * order once, so the sender restarts the window after them */
+        if (ctxt->resync) {
+            return TS_IGNORED;
+        }
+        ctxt->resync = true;
+        return TS_DUP;
     }
     if (block_nr < (ctxt->block_nr + 1)) {
         DEBUG("tftp: not the packet we were waiting for, expected %d, received %d\n",
               (uint16_t)(ctxt->block_nr + 1), block_nr);
+        /* a resent window repeats blocks we already have, only acknowledge
+         * the last one and only if we got nothing new since our last ACK */
+        if ((block_nr != ctxt->block_nr) || (ctxt->window_pos != 0)) {
+            return TS_IGNORED;
+        }
         return TS_DUP;
     }
+    ctxt->resync = false;
 
     /* send the user data trough to the user application */
-    if (ctxt->data_cb(ctxt->block_nr * ctxt->block_size, pkt->data,
-                      buf->size - sizeof(tftp_packet_data_t)) < 0) {
+    if (_tftp_data(ctxt, ctxt->block_nr * ctxt->block_size, pkt->data,
+                   buf->size - sizeof(tftp_packet_data_t)) < 0) {
         DEBUG("tftp: error in data callback\n");
         return TS_APP_FAILED;
     }
@@ -1137,6 +1301,24 @@ int _tftp_process_data(tftp_context_t *ctxt, gnrc_pktsnip_t *buf)
     return buf->size - sizeof(tftp_packet_data_t);
 }
 
+int _tftp_data(tftp_context_t *ctxt, uint32_t offset, void *data, size_t len)
+{
+#ifdef MODULE_VFS
+    if (ctxt->fd >= 0) {
+        if (vfs_lseek(ctxt->fd, offset, SEEK_SET) < 0) {
+            return -EIO;
+        }
+        /* a reading client writes the file, a writing client reads it */
+        if (ctxt->op == TO_RRQ) {
+            return vfs_write(ctxt->fd, data, len);
+        }
+        return vfs_read(ctxt->fd, data, len);
+    }
+#endif
+
+    return ctxt->data_cb(offset, data, len);
+}
+
 int _tftp_decode_error(uint8_t *buf, tftp_err_codes_t *err, const char * *err_msg)
 {
     tftp_packet_error_t *pkt = (tftp_packet_error_t *) buf;
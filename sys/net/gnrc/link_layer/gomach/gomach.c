@@ -2073,6 +2073,9 @@ static void _gomach_event_cb(netdev_t *dev, netdev_event_t event)
             }
             case NETDEV_EVENT_TX_COMPLETE: {
                 gnrc_netif_set_tx_feedback(netif, TX_FEEDBACK_SUCCESS);
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_SUCCESS);
+#endif
                 gnrc_gomach_set_tx_finish(netif, true);
                 gnrc_gomach_set_netdev_state(netif, NETOPT_STATE_IDLE);
                 gnrc_gomach_set_update(netif, true);
@@ -2080,6 +2083,9 @@ static void _gomach_event_cb(netdev_t *dev, netdev_event_t event)
             }
             case NETDEV_EVENT_TX_NOACK: {
                 gnrc_netif_set_tx_feedback(netif, TX_FEEDBACK_NOACK);
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_NOACK);
+#endif
                 gnrc_gomach_set_tx_finish(netif, true);
                 gnrc_gomach_set_netdev_state(netif, NETOPT_STATE_IDLE);
                 gnrc_gomach_set_update(netif, true);
@@ -2087,6 +2093,9 @@ static void _gomach_event_cb(netdev_t *dev, netdev_event_t event)
             }
             case NETDEV_EVENT_TX_MEDIUM_BUSY: {
                 gnrc_netif_set_tx_feedback(netif, TX_FEEDBACK_BUSY);
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_BUSY);
+#endif
                 gnrc_gomach_set_tx_finish(netif, true);
                 gnrc_gomach_set_netdev_state(netif, NETOPT_STATE_IDLE);
                 gnrc_gomach_set_update(netif, true);
@@ -30,6 +30,7 @@
 #include "net/gnrc/gomach/timeout.h"
 #include "net/gnrc/gomach/types.h"
 #include "include/gomach_internal.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/ieee802154.h"
 #include "net/netdev/ieee802154.h"
 
@@ -109,6 +110,9 @@ int _gnrc_gomach_transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         netif->dev->stats.tx_unicast_count++;
     }
 #endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    gnrc_netif_nb_stats_tx(netif, pkt);
+#endif
 #ifdef MODULE_GNRC_MAC
     if (netif->mac.mac_info & GNRC_NETIF_MAC_INFO_CSMA_ENABLED) {
         res = csma_sender_csma_ca_send(dev, &iolist, &netif->mac.csma_conf);
@@ -173,6 +177,9 @@ static int _parse_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
     netif_hdr->lqi = netif->mac.prot.gomach.rx_pkt_lqi;
     netif_hdr->rssi = netif->mac.prot.gomach.rx_pkt_rssi;
     netif_hdr->if_pid = netif->pid;
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    gnrc_netif_nb_stats_rx(netif, netif_snip);
+#endif
     pkt->type = state->proto;
     gnrc_pktbuf_remove_snip(pkt, pkt->next);
     LL_APPEND(pkt, netif_snip);
@@ -466,18 +473,23 @@ int gnrc_gomach_send_beacon(gnrc_netif_t *netif)
     uint16_t max_slot_num = (GNRC_GOMACH_SUPERFRAME_DURATION_US - gnrc_gomach_phase_now(netif)) /
                             GNRC_GOMACH_VTDMA_SLOT_SIZE_US;
 
+    /* Take turns in which sender is served first, so that no sender starves
+     * if there are more slot requests than slots. */
+    uint8_t idx = netif->mac.rx.vtdma_manag.next_sender;
+
     for (i = 0; i < GNRC_GOMACH_SLOSCH_UNIT_COUNT; i++) {
-        if (netif->mac.rx.slosch_list[i].queue_indicator > 0) {
+        gnrc_gomach_slosch_unit_t *unit = &netif->mac.rx.slosch_list[idx];
+
+        if (unit->queue_indicator > 0) {
             /* Record the device's (that will be allocated slots) address to the ID list. */
-            memcpy(id_list[j].addr,
-                   netif->mac.rx.slosch_list[i].node_addr.addr,
-                   netif->mac.rx.slosch_list[i].node_addr.len);
+            memcpy(id_list[j].addr, unit->node_addr.addr, unit->node_addr.len);
 
             /* Record the number of allocated slots to the slots list. */
-            slots_list[j] = netif->mac.rx.slosch_list[i].queue_indicator;
+            slots_list[j] = unit->queue_indicator;
 
             total_tdma_node_num++;
             total_tdma_slot_num += slots_list[j];
+            netif->mac.rx.vtdma_manag.next_sender = (idx + 1) % GNRC_GOMACH_SLOSCH_UNIT_COUNT;
 
             /* If there is no room for allocating more slots, stop. */
             if (total_tdma_slot_num >= max_slot_num) {
@@ -485,6 +497,10 @@ int gnrc_gomach_send_beacon(gnrc_netif_t *netif)
                 redueced_slots_num = total_tdma_slot_num - max_slot_num;
                 slots_list[j] -= redueced_slots_num;
                 total_tdma_slot_num -= redueced_slots_num;
+                if (redueced_slots_num > 0) {
+                    /* serve this sender first in the next cycle */
+                    netif->mac.rx.vtdma_manag.next_sender = idx;
+                }
                 break;
             }
 
@@ -495,6 +511,7 @@ int gnrc_gomach_send_beacon(gnrc_netif_t *netif)
                 break;
             }
         }
+        idx = (idx + 1) % GNRC_GOMACH_SLOSCH_UNIT_COUNT;
     }
 
     gomach_beaocn_hdr.schedulelist_size = total_tdma_node_num;
@@ -576,6 +593,17 @@ int gnrc_gomach_dispatch_defer(gnrc_pktsnip_t *buffer[], gnrc_pktsnip_t *pkt)
     return -ENOBUFS;
 }
 
+/* Returns the slot-schedule-unit a sender's address hashes to */
+static unsigned _slosch_hash(const gnrc_gomach_l2_addr_t *addr)
+{
+    unsigned hash = 0;
+
+    for (unsigned i = 0; i < addr->len; i++) {
+        hash = (hash * 31) + addr->addr[i];
+    }
+    return hash % GNRC_GOMACH_SLOSCH_UNIT_COUNT;
+}
+
 void gnrc_gomach_indicator_update(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                   gnrc_gomach_packet_info_t *pa_info)
 {
@@ -599,31 +627,43 @@ void gnrc_gomach_indicator_update(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
         return;
     }
 
-    uint8_t i;
-    /* Check whether the device has been registered or not. */
-    for (i = 0; i < GNRC_GOMACH_SLOSCH_UNIT_COUNT; i++) {
-        if (memcmp(&netif->mac.rx.slosch_list[i].node_addr.addr,
-                   &pa_info->src_addr.addr,
-                   pa_info->src_addr.len) == 0) {
+    gnrc_gomach_slosch_unit_t *free_unit = NULL;
+    unsigned idx = _slosch_hash(&pa_info->src_addr);
+
+    /* Check whether the device has been registered or not, starting at the
+     * unit its address hashes to. */
+    for (unsigned i = 0; i < GNRC_GOMACH_SLOSCH_UNIT_COUNT; i++) {
+        gnrc_gomach_slosch_unit_t *unit = &netif->mac.rx.slosch_list[idx];
+
+        if (unit->node_addr.len == 0) {
+            /* Units are never released, so the sender can't be registered
+             * behind a unit that was never used. */
+            if (free_unit == NULL) {
+                free_unit = unit;
+            }
+            break;
+        }
+        if ((unit->node_addr.len == pa_info->src_addr.len) &&
+            (memcmp(unit->node_addr.addr, pa_info->src_addr.addr,
+                    pa_info->src_addr.len) == 0)) {
             /* Update the sender's queue-length indicator. */
-            netif->mac.rx.slosch_list[i].queue_indicator = gomach_data_hdr->queue_indicator;
+            unit->queue_indicator = gomach_data_hdr->queue_indicator;
             return;
         }
+        if ((free_unit == NULL) && (unit->queue_indicator == 0)) {
+            free_unit = unit;
+        }
+        idx = (idx + 1) % GNRC_GOMACH_SLOSCH_UNIT_COUNT;
     }
 
     /* The sender has not registered yet. */
-    for (i = 0; i < GNRC_GOMACH_SLOSCH_UNIT_COUNT; i++) {
-        if ((netif->mac.rx.slosch_list[i].node_addr.len == 0) ||
-            (netif->mac.rx.slosch_list[i].queue_indicator == 0)) {
-            netif->mac.rx.slosch_list[i].node_addr.len = pa_info->src_addr.len;
-            memcpy(netif->mac.rx.slosch_list[i].node_addr.addr,
-                   pa_info->src_addr.addr,
-                   pa_info->src_addr.len);
+    if (free_unit != NULL) {
+        free_unit->node_addr.len = pa_info->src_addr.len;
+        memcpy(free_unit->node_addr.addr, pa_info->src_addr.addr,
+               pa_info->src_addr.len);
 
-            /* Update the sender's queue-length indicator. */
-            netif->mac.rx.slosch_list[i].queue_indicator = gomach_data_hdr->queue_indicator;
-            return;
-        }
+        /* Update the sender's queue-length indicator. */
+        free_unit->queue_indicator = gomach_data_hdr->queue_indicator;
     }
 }
 
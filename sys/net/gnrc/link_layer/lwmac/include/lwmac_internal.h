@@ -80,6 +80,16 @@ extern "C" {
  */
 #define GNRC_LWMAC_QUIT_RX              (0x0040U)
 
+/**
+ * @brief   Flag to track if the current WR stream relies on the learned phase
+ *          of the destination.
+ *
+ * If the wake-up phase of the destination is known, the sender only keeps up
+ * the WR stream for @ref GNRC_LWMAC_PHASE_LOCKED_PREAMBLE_US. This flag marks
+ * such a shortened WR stream, so that the phase can be dropped if it fails.
+ */
+#define GNRC_LWMAC_PHASE_LOCKED         (0x0080U)
+
 /**
  * @brief Type to pass information about parsing.
  */
@@ -217,6 +227,36 @@ static inline bool gnrc_lwmac_get_quit_rx(gnrc_netif_t *netif)
     return (netif->mac.mac_info & GNRC_LWMAC_QUIT_RX);
 }
 
+/**
+ * @brief set the @ref GNRC_LWMAC_PHASE_LOCKED flag of the device
+ *
+ * @param[in] netif        ptr to the network interface
+ * @param[in] locked       value for LWMAC phase-locked flag
+ *
+ */
+static inline void gnrc_lwmac_set_phase_locked(gnrc_netif_t *netif, bool locked)
+{
+    if (locked) {
+        netif->mac.mac_info |= GNRC_LWMAC_PHASE_LOCKED;
+    }
+    else {
+        netif->mac.mac_info &= ~GNRC_LWMAC_PHASE_LOCKED;
+    }
+}
+
+/**
+ * @brief get the @ref GNRC_LWMAC_PHASE_LOCKED flag of the device
+ *
+ * @param[in] netif        ptr to the network interface
+ *
+ * @return                 true if the WR stream is shortened to the known phase
+ * @return                 false if the full WR stream is used
+ */
+static inline bool gnrc_lwmac_get_phase_locked(gnrc_netif_t *netif)
+{
+    return (netif->mac.mac_info & GNRC_LWMAC_PHASE_LOCKED);
+}
+
 /**
  * @brief set the @ref GNRC_LWMAC_DUTYCYCLE_ACTIVE flag of LWMAC
  *
@@ -374,6 +414,19 @@ static inline uint32_t _gnrc_lwmac_ticks_until_phase(uint32_t phase)
     return (uint32_t)tmp;
 }
 
+/**
+ * @brief Check if a LWMAC header belongs to a broadcast frame
+ *
+ * @param[in] hdr   LWMAC header
+ *
+ * @return          true, if @p hdr is a (pending) broadcast frame
+ */
+static inline bool _gnrc_lwmac_is_bcast(const gnrc_lwmac_hdr_t *hdr)
+{
+    return (hdr->type == GNRC_LWMAC_FRAMETYPE_BROADCAST) ||
+           (hdr->type == GNRC_LWMAC_FRAMETYPE_BROADCAST_PENDING);
+}
+
 /**
  * @brief Store the received packet to the dispatch buffer and remove possible
  *        duplicate packets.
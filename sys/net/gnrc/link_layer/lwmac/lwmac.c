@@ -175,6 +175,9 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             hdr->lqi = rx_info.lqi;
             hdr->rssi = rx_info.rssi;
             hdr->if_pid = thread_getpid();
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            gnrc_netif_nb_stats_rx(netif, netif_hdr);
+#endif
             pkt->type = state->proto;
 #if ENABLE_DEBUG
             DEBUG("_recv_ieee802154: received packet from %s of length %u\n",
@@ -708,6 +711,7 @@ void rtt_handler(uint32_t event, gnrc_netif_t *netif)
             gnrc_lwmac_set_quit_rx(netif, false);
             gnrc_lwmac_set_phase_backoff(netif, false);
             netif->mac.rx.rx_bad_exten_count = 0;
+            netif->mac.prot.lwmac.bcast_first_src.len = 0;
             lwmac_set_state(netif, GNRC_LWMAC_LISTENING);
             break;
         }
@@ -814,18 +818,27 @@ static void _lwmac_event_cb(netdev_t *dev, netdev_event_t event)
             }
             case NETDEV_EVENT_TX_COMPLETE: {
                 gnrc_netif_set_tx_feedback(netif, TX_FEEDBACK_SUCCESS);
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_SUCCESS);
+#endif
                 gnrc_netif_set_rx_started(netif, false);
                 lwmac_schedule_update(netif);
                 break;
             }
             case NETDEV_EVENT_TX_NOACK: {
                 gnrc_netif_set_tx_feedback(netif, TX_FEEDBACK_NOACK);
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_NOACK);
+#endif
                 gnrc_netif_set_rx_started(netif, false);
                 lwmac_schedule_update(netif);
                 break;
             }
             case NETDEV_EVENT_TX_MEDIUM_BUSY: {
                 gnrc_netif_set_tx_feedback(netif, TX_FEEDBACK_BUSY);
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_BUSY);
+#endif
                 gnrc_netif_set_rx_started(netif, false);
                 lwmac_schedule_update(netif);
                 break;
@@ -26,6 +26,7 @@
 #include "net/gnrc/mac/mac.h"
 #include "net/gnrc/lwmac/lwmac.h"
 #include "include/lwmac_internal.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/ieee802154.h"
 #include "net/netdev/ieee802154.h"
 
@@ -96,6 +97,9 @@ int _gnrc_lwmac_transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         netif->dev->stats.tx_unicast_count++;
     }
 #endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    gnrc_netif_nb_stats_tx(netif, pkt);
+#endif
 #ifdef MODULE_GNRC_MAC
     if (netif->mac.mac_info & GNRC_NETIF_MAC_INFO_CSMA_ENABLED) {
         res = csma_sender_csma_ca_send(dev, &iolist, &netif->mac.csma_conf);
@@ -145,6 +149,7 @@ int _gnrc_lwmac_parse_packet(gnrc_pktsnip_t *pkt, gnrc_lwmac_packet_info_t *info
                                           GNRC_NETTYPE_LWMAC);
             break;
         }
+        case GNRC_LWMAC_FRAMETYPE_BROADCAST_PENDING:
         case GNRC_LWMAC_FRAMETYPE_BROADCAST: {
             lwmac_snip = gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_broadcast_t),
                                           GNRC_NETTYPE_LWMAC);
@@ -235,7 +240,7 @@ int _gnrc_lwmac_dispatch_defer(gnrc_pktsnip_t *buffer[], gnrc_pktsnip_t *pkt)
     assert(pkt->next->next->type == GNRC_NETTYPE_NETIF);
 
     gnrc_lwmac_frame_broadcast_t *bcast = NULL;
-    if (((gnrc_lwmac_hdr_t *)pkt->next->data)->type == GNRC_LWMAC_FRAMETYPE_BROADCAST) {
+    if (_gnrc_lwmac_is_bcast(pkt->next->data)) {
         bcast = pkt->next->data;
     }
 
@@ -246,7 +251,7 @@ int _gnrc_lwmac_dispatch_defer(gnrc_pktsnip_t *buffer[], gnrc_pktsnip_t *pkt)
             return 0;
         }
         else if (bcast &&
-                 (((gnrc_lwmac_hdr_t *)buffer[i]->next->data)->type == GNRC_LWMAC_FRAMETYPE_BROADCAST) &&
+                 _gnrc_lwmac_is_bcast(buffer[i]->next->data) &&
                  (bcast->seq_nr == ((gnrc_lwmac_frame_broadcast_t *)buffer[i]->next->data)->seq_nr)) {
             /* Filter same broadcasts, compare sequence number */
             gnrc_netif_hdr_t *hdr_queued, *hdr_new;
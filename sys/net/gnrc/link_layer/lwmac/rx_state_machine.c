@@ -52,6 +52,37 @@
  */
 #define GNRC_LWMAC_RX_FOUND_DATA              (0x04U)
 
+/* Dispatches a received broadcast packet. Returns true if no further
+ * broadcast packets of the sender's broadcast procedure are to be expected */
+static bool _bcast_received(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                            gnrc_lwmac_packet_info_t *info)
+{
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+    uint8_t seq_nr = ((gnrc_lwmac_frame_broadcast_t *)info->header)->seq_nr;
+
+    if (info->header->type == GNRC_LWMAC_FRAMETYPE_BROADCAST_PENDING) {
+        if (lwmac->bcast_first_src.len == 0) {
+            /* first packet of a rotation, remember it to detect its end */
+            lwmac->bcast_first_src = info->src_addr;
+            lwmac->bcast_first_seq = seq_nr;
+        }
+        else if ((lwmac->bcast_first_seq == seq_nr) &&
+                 (lwmac->bcast_first_src.len == info->src_addr.len) &&
+                 (memcmp(lwmac->bcast_first_src.addr, info->src_addr.addr,
+                         info->src_addr.len) == 0)) {
+            /* rotation wrapped around, all its packets were received */
+            LOG_DEBUG("[LWMAC-rx] Broadcast rotation complete\n");
+            gnrc_pktbuf_release(pkt);
+            return true;
+        }
+    }
+
+    _gnrc_lwmac_dispatch_defer(netif->mac.rx.dispatch_buffer, pkt);
+    gnrc_mac_dispatch(&netif->mac.rx);
+
+    return (info->header->type == GNRC_LWMAC_FRAMETYPE_BROADCAST);
+}
+
 static uint8_t _packet_process_in_wait_for_wr(gnrc_netif_t *netif)
 {
     uint8_t rx_info = 0;
@@ -71,12 +102,12 @@ static uint8_t _packet_process_in_wait_for_wr(gnrc_netif_t *netif)
             continue;
         }
 
-        if (info.header->type == GNRC_LWMAC_FRAMETYPE_BROADCAST) {
-            _gnrc_lwmac_dispatch_defer(netif->mac.rx.dispatch_buffer, pkt);
-            gnrc_mac_dispatch(&netif->mac.rx);
+        if (_gnrc_lwmac_is_bcast(info.header)) {
             rx_info |= GNRC_LWMAC_RX_FOUND_BROADCAST;
-            /* quit listening period to avoid receiving duplicate broadcast packets */
-            gnrc_lwmac_set_quit_rx(netif, true);
+            if (_bcast_received(netif, pkt, &info)) {
+                /* quit listening period to avoid receiving duplicate broadcast packets */
+                gnrc_lwmac_set_quit_rx(netif, true);
+            }
             /* quit TX in this cycle to avoid collisions with broadcast packets */
             gnrc_lwmac_set_quit_tx(netif, true);
             break;
@@ -219,11 +250,11 @@ static uint8_t _packet_process_in_wait_for_data(gnrc_netif_t *netif)
             continue;
         }
 
-        if (info.header->type == GNRC_LWMAC_FRAMETYPE_BROADCAST) {
-            _gnrc_lwmac_dispatch_defer(netif->mac.rx.dispatch_buffer, pkt);
-            gnrc_mac_dispatch(&netif->mac.rx);
-            /* quit listening period to avoid receiving duplicate broadcast packets */
-            gnrc_lwmac_set_quit_rx(netif, true);
+        if (_gnrc_lwmac_is_bcast(info.header)) {
+            if (_bcast_received(netif, pkt, &info)) {
+                /* quit listening period to avoid receiving duplicate broadcast packets */
+                gnrc_lwmac_set_quit_rx(netif, true);
+            }
             continue;
         }
 
@@ -49,18 +49,107 @@
  */
 #define GNRC_LWMAC_TX_FAIL            (0x02U)
 
+/* Prepends the LWMAC broadcast header to a broadcast packet */
+static bool _bcast_add_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *lwmac_snip;
+    gnrc_lwmac_frame_broadcast_t hdr;
+
+    hdr.header.type = GNRC_LWMAC_FRAMETYPE_BROADCAST;
+    hdr.seq_nr = netif->mac.tx.bcast_seqnr++;
+
+    lwmac_snip = gnrc_pktbuf_add(pkt->next, &hdr, sizeof(hdr), GNRC_NETTYPE_LWMAC);
+    if (lwmac_snip == NULL) {
+        return false;
+    }
+    pkt->next = lwmac_snip;
+    return true;
+}
+
+/* Removes the LWMAC header from a broadcast packet again */
+static void _bcast_remove_hdr(gnrc_pktsnip_t *pkt)
+{
+    /* save pointer to payload */
+    gnrc_pktsnip_t *payload = pkt->next->next;
+
+    /* remove LWMAC header */
+    pkt->next->next = NULL;
+    gnrc_pktbuf_release(pkt->next);
+
+    /* make append netif header before payload again */
+    pkt->next = payload;
+}
+
+/* Puts the broadcast packets starting at index @p first back into the TX
+ * queue */
+static void _bcast_requeue(gnrc_netif_t *netif, unsigned first)
+{
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+
+    for (unsigned i = first; i < lwmac->bcast_num; i++) {
+        gnrc_pktsnip_t *pkt = lwmac->bcast_pkts[i];
+
+        _bcast_remove_hdr(pkt);
+        if (!gnrc_mac_queue_tx_packet(&netif->mac.tx, 0, pkt)) {
+            gnrc_pktbuf_release(pkt);
+            LOG_WARNING("WARNING: [LWMAC-tx] TX queue full, drop packet\n");
+        }
+    }
+    if (first < lwmac->bcast_num) {
+        lwmac->bcast_num = first;
+    }
+}
+
+/* Collects further queued broadcast packets to send them along with the
+ * current one in one broadcast procedure */
+static void _bcast_aggregate(gnrc_netif_t *netif)
+{
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+    gnrc_pktsnip_t *pkt;
+
+    lwmac->bcast_pkts[0] = netif->mac.tx.packet;
+    lwmac->bcast_num = 1;
+    lwmac->bcast_next = 0;
+
+    while ((lwmac->bcast_num < GNRC_LWMAC_BCAST_AGGREGATE_MAX) &&
+           ((pkt = gnrc_priority_pktqueue_pop(&netif->mac.tx.current_neighbor->queue)) != NULL)) {
+        if (!_bcast_add_hdr(netif, pkt)) {
+            if (!gnrc_mac_queue_tx_packet(&netif->mac.tx, 0, pkt)) {
+                gnrc_pktbuf_release(pkt);
+                LOG_WARNING("WARNING: [LWMAC-tx] TX queue full, drop packet\n");
+            }
+            break;
+        }
+        lwmac->bcast_pkts[lwmac->bcast_num++] = pkt;
+    }
+
+    if (lwmac->bcast_num > 1) {
+        /* tell receivers to stay awake for the whole rotation */
+        for (unsigned i = 0; i < lwmac->bcast_num; i++) {
+            gnrc_lwmac_hdr_t *hdr = lwmac->bcast_pkts[i]->next->data;
+            hdr->type = GNRC_LWMAC_FRAMETYPE_BROADCAST_PENDING;
+        }
+        LOG_INFO("[LWMAC-tx] Aggregated %u broadcast packets\n",
+                 (unsigned)lwmac->bcast_num);
+    }
+}
+
 static uint8_t _send_bcast(gnrc_netif_t *netif)
 {
     assert(netif != NULL);
 
     uint8_t tx_info = 0;
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
     gnrc_pktsnip_t *pkt = netif->mac.tx.packet;
     bool first = false;
 
     if (gnrc_lwmac_timeout_is_running(netif, GNRC_LWMAC_TIMEOUT_BROADCAST_END)) {
         if (gnrc_lwmac_timeout_is_expired(netif, GNRC_LWMAC_TIMEOUT_BROADCAST_END)) {
             gnrc_lwmac_clear_timeout(netif, GNRC_LWMAC_TIMEOUT_NEXT_BROADCAST);
-            gnrc_pktbuf_release(pkt);
+            for (unsigned i = 0; i < lwmac->bcast_num; i++) {
+                gnrc_pktbuf_release(lwmac->bcast_pkts[i]);
+            }
+            lwmac->bcast_num = 0;
             netif->mac.tx.packet = NULL;
             tx_info |= GNRC_LWMAC_TX_SUCCESS;
             return tx_info;
@@ -68,21 +157,10 @@ static uint8_t _send_bcast(gnrc_netif_t *netif)
     }
     else {
         LOG_INFO("[LWMAC-tx] Initialize broadcasting\n");
-        gnrc_lwmac_set_timeout(netif, GNRC_LWMAC_TIMEOUT_BROADCAST_END,
-                               GNRC_LWMAC_BROADCAST_DURATION_US);
-
-        gnrc_pktsnip_t *pkt_payload;
 
         /* Prepare packet with LWMAC header*/
-        gnrc_lwmac_frame_broadcast_t hdr;
-        hdr.header.type = GNRC_LWMAC_FRAMETYPE_BROADCAST;
-        hdr.seq_nr = netif->mac.tx.bcast_seqnr++;
-
-        pkt_payload = pkt->next;
-        pkt->next = gnrc_pktbuf_add(pkt->next, &hdr, sizeof(hdr), GNRC_NETTYPE_LWMAC);
-        if (pkt->next == NULL) {
+        if (!_bcast_add_hdr(netif, pkt)) {
             LOG_ERROR("ERROR: [LWMAC-tx] Cannot allocate pktbuf of type FRAMETYPE_BROADCAST\n");
-            netif->mac.tx.packet->next = pkt_payload;
             /* Drop the broadcast packet */
             LOG_ERROR("ERROR: [LWMAC-tx] Memory maybe full, drop the broadcast packet\n");
             gnrc_pktbuf_release(netif->mac.tx.packet);
@@ -91,6 +169,15 @@ static uint8_t _send_bcast(gnrc_netif_t *netif)
             tx_info |= GNRC_LWMAC_TX_FAIL;
             return tx_info;
         }
+        _bcast_aggregate(netif);
+
+        /* every receiver waking up during the broadcast duration has to be
+         * able to overhear the complete rotation */
+        uint32_t duration = GNRC_LWMAC_BROADCAST_DURATION_US;
+        if (lwmac->bcast_num > 1) {
+            duration += lwmac->bcast_num * GNRC_LWMAC_TIME_BETWEEN_BROADCAST_US;
+        }
+        gnrc_lwmac_set_timeout(netif, GNRC_LWMAC_TIMEOUT_BROADCAST_END, duration);
 
         /* No Auto-ACK for broadcast packets */
         netopt_enable_t autoack = NETOPT_DISABLE;
@@ -102,34 +189,28 @@ static uint8_t _send_bcast(gnrc_netif_t *netif)
     if (gnrc_lwmac_timeout_is_expired(netif, GNRC_LWMAC_TIMEOUT_NEXT_BROADCAST) ||
         first) {
         /* if found ongoing transmission, quit this cycle for collision avoidance.
-        * Broadcast packet will be re-queued and try to send in the next cycle. */
+        * Broadcast packets will be re-queued and try to send in the next cycle. */
         if (_gnrc_lwmac_get_netdev_state(netif) == NETOPT_STATE_RX) {
-            /* save pointer to netif header */
-            gnrc_pktsnip_t *netif_snip = pkt->next->next;
-
-            /* remove LWMAC header */
-            pkt->next->next = NULL;
-            gnrc_pktbuf_release(pkt->next);
-
-            /* make append netif header after payload again */
-            pkt->next = netif_snip;
-
-            if (!gnrc_mac_queue_tx_packet(&netif->mac.tx, 0, netif->mac.tx.packet)) {
-                gnrc_pktbuf_release(netif->mac.tx.packet);
-                LOG_WARNING("WARNING: [LWMAC-tx] TX queue full, drop packet\n");
-            }
+            _bcast_requeue(netif, 0);
             /* drop pointer so it wont be free'd */
             netif->mac.tx.packet = NULL;
             tx_info |= GNRC_LWMAC_TX_FAIL;
             return tx_info;
         }
 
+        pkt = lwmac->bcast_pkts[lwmac->bcast_next];
+        lwmac->bcast_next = (lwmac->bcast_next + 1) % lwmac->bcast_num;
+
         /* Don't let the packet be released yet, we want to send it again */
         gnrc_pktbuf_hold(pkt, 1);
 
         int res = _gnrc_lwmac_transmit(netif, pkt);
         if (res < 0) {
             LOG_ERROR("ERROR: [LWMAC-tx] Send broadcast pkt failed.");
+            /* only the first packet is kept for a retry */
+            _bcast_requeue(netif, 1);
+            _bcast_remove_hdr(netif->mac.tx.packet);
+            lwmac->bcast_num = 0;
             tx_info |= GNRC_LWMAC_TX_FAIL;
             return tx_info;
         }
@@ -256,7 +337,7 @@ static uint8_t _packet_process_in_wait_for_wa(gnrc_netif_t *netif)
             from_expected_destination = true;
         }
 
-        if (info.header->type == GNRC_LWMAC_FRAMETYPE_BROADCAST) {
+        if (_gnrc_lwmac_is_bcast(info.header)) {
             _gnrc_lwmac_dispatch_defer(netif->mac.rx.dispatch_buffer, pkt);
             gnrc_mac_dispatch(&netif->mac.rx);
             /* Drop pointer to it can't get released */
@@ -576,8 +657,18 @@ static bool _lwmac_tx_update(gnrc_netif_t *netif)
                 netopt_enable_t csma_disable = NETOPT_ENABLE;
                 netif->dev->driver->set(netif->dev, NETOPT_CSMA,
                                         &csma_disable, sizeof(csma_disable));
-                /* Set a timeout for the maximum transmission procedure */
-                gnrc_lwmac_set_timeout(netif, GNRC_LWMAC_TIMEOUT_NO_RESPONSE, GNRC_LWMAC_PREAMBLE_DURATION_US);
+                /* Set a timeout for the maximum transmission procedure. If the
+                 * phase of the destination is known, the WR stream started
+                 * right before its wake-up period, so a short one suffices. */
+                uint32_t preamble = GNRC_LWMAC_PREAMBLE_DURATION_US;
+                bool locked = !gnrc_lwmac_get_tx_continue(netif) &&
+                              (netif->mac.tx.current_neighbor->phase <=
+                               RTT_US_TO_TICKS(GNRC_LWMAC_WAKEUP_INTERVAL_US));
+                if (locked) {
+                    preamble = GNRC_LWMAC_PHASE_LOCKED_PREAMBLE_US;
+                }
+                gnrc_lwmac_set_phase_locked(netif, locked);
+                gnrc_lwmac_set_timeout(netif, GNRC_LWMAC_TIMEOUT_NO_RESPONSE, preamble);
 
                 netif->mac.tx.state = GNRC_LWMAC_TX_STATE_SEND_WR;
                 reschedule = true;
@@ -683,6 +774,11 @@ static bool _lwmac_tx_update(gnrc_netif_t *netif)
 
             if (gnrc_lwmac_timeout_is_expired(netif, GNRC_LWMAC_TIMEOUT_NO_RESPONSE)) {
                 LOG_WARNING("WARNING: [LWMAC-tx] No response from destination\n");
+                if (gnrc_lwmac_get_phase_locked(netif)) {
+                    /* the destination's phase drifted, relearn it with a
+                     * full WR stream on the next attempt */
+                    netif->mac.tx.current_neighbor->phase = GNRC_MAC_PHASE_MAX;
+                }
                 netif->mac.tx.state = GNRC_LWMAC_TX_STATE_FAILED;
                 reschedule = true;
                 break;
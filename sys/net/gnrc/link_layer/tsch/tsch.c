@@ -0,0 +1,864 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tsch
+ * @{
+ *
+ * @file
+ * @brief       Implementation of the TSCH protocol
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "random.h"
+#include "utlist.h"
+#include "xtimer.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/mac/internal.h"
+#include "net/gnrc/tsch/hdr.h"
+#include "net/gnrc/tsch/tsch.h"
+#include "net/ieee802154.h"
+#include "net/netdev/ieee802154.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#ifndef LOG_LEVEL
+/**
+ * @brief Default log level define
+ */
+#define LOG_LEVEL LOG_WARNING
+#endif
+
+#include "log.h"
+
+/**
+ * @brief   Duration of preamble and SFD at 250 kbit/s
+ *
+ * The radio reports the start of a reception after the SFD.
+ */
+#define SHR_DURATION_US     (160U)
+
+/**
+ * @brief   Offset of the end of an active timeslot, the radio is turned off
+ *          at the latest then
+ */
+#define SLOT_END_US         (GNRC_TSCH_TIMESLOT_US - US_PER_MS)
+
+static const uint8_t _hopping_seq[] = GNRC_TSCH_HOPPING_SEQUENCE;
+
+static void _tsch_init(gnrc_netif_t *netif);
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
+static void _tsch_msg_handler(gnrc_netif_t *netif, msg_t *msg);
+static void _scan_start(gnrc_netif_t *netif);
+
+static const gnrc_netif_ops_t tsch_ops = {
+    .init = _tsch_init,
+    .send = _send,
+    .recv = _recv,
+    .get = gnrc_netif_get_from_netdev,
+    .set = gnrc_netif_set_from_netdev,
+    .msg_handler = _tsch_msg_handler,
+};
+
+gnrc_netif_t *gnrc_netif_tsch_create(char *stack, int stacksize,
+                                     char priority, char *name,
+                                     netdev_t *dev)
+{
+    return gnrc_netif_create(stack, stacksize, priority, name, dev,
+                             &tsch_ops);
+}
+
+int gnrc_tsch_start(gnrc_netif_t *netif)
+{
+    msg_t msg = { .type = GNRC_TSCH_MSG_TYPE_START };
+
+    return (msg_try_send(&msg, netif->pid) > 0) ? 0 : -EBUSY;
+}
+
+int gnrc_tsch_cell_add(gnrc_netif_t *netif, const gnrc_tsch_cell_t *cell)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    gnrc_tsch_cell_t *free = NULL;
+    int res = 0;
+
+    if ((cell->slot_offset >= GNRC_TSCH_SLOTFRAME_LEN) ||
+        !(cell->options & (GNRC_TSCH_CELL_TX | GNRC_TSCH_CELL_RX)) ||
+        (cell->addr_len > sizeof(cell->addr))) {
+        return -EINVAL;
+    }
+    mutex_lock(&tsch->lock);
+    for (unsigned i = 0; i < GNRC_TSCH_CELL_NUMOF; i++) {
+        gnrc_tsch_cell_t *c = &tsch->cells[i];
+
+        if (c->options == 0) {
+            if (free == NULL) {
+                free = c;
+            }
+        }
+        else if ((c->slot_offset == cell->slot_offset) &&
+                 (c->channel_offset == cell->channel_offset)) {
+            res = -EEXIST;
+            break;
+        }
+    }
+    if (res == 0) {
+        if (free != NULL) {
+            *free = *cell;
+        }
+        else {
+            res = -ENOMEM;
+        }
+    }
+    mutex_unlock(&tsch->lock);
+    return res;
+}
+
+int gnrc_tsch_cell_remove(gnrc_netif_t *netif, uint16_t slot_offset,
+                          uint16_t channel_offset)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    int res = -ENOENT;
+
+    mutex_lock(&tsch->lock);
+    for (unsigned i = 0; i < GNRC_TSCH_CELL_NUMOF; i++) {
+        gnrc_tsch_cell_t *c = &tsch->cells[i];
+
+        if ((c->options != 0) && (c->slot_offset == slot_offset) &&
+            (c->channel_offset == channel_offset)) {
+            c->options = 0;
+            res = 0;
+            break;
+        }
+    }
+    mutex_unlock(&tsch->lock);
+    return res;
+}
+
+static gnrc_pktsnip_t *_make_netif_hdr(uint8_t *mhr)
+{
+    gnrc_pktsnip_t *snip;
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN], dst[IEEE802154_LONG_ADDRESS_LEN];
+    int src_len, dst_len;
+    le_uint16_t _pan_tmp;
+
+    dst_len = ieee802154_get_dst(mhr, dst, &_pan_tmp);
+    src_len = ieee802154_get_src(mhr, src, &_pan_tmp);
+    if ((dst_len < 0) || (src_len < 0)) {
+        DEBUG("_make_netif_hdr: unable to get addresses\n");
+        return NULL;
+    }
+    snip = gnrc_netif_hdr_build(src, (size_t)src_len, dst, (size_t)dst_len);
+    if (snip == NULL) {
+        DEBUG("_make_netif_hdr: no space left in packet buffer\n");
+        return NULL;
+    }
+    /* set broadcast flag for broadcast destination */
+    if ((dst_len == 2) && (dst[0] == 0xff) && (dst[1] == 0xff)) {
+        gnrc_netif_hdr_t *hdr = snip->data;
+        hdr->flags |= GNRC_NETIF_HDR_FLAGS_BROADCAST;
+    }
+    return snip;
+}
+
+static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    netdev_ieee802154_rx_info_t rx_info;
+    netdev_ieee802154_t *state = (netdev_ieee802154_t *)netif->dev;
+    gnrc_pktsnip_t *pkt = NULL;
+    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+
+    if (bytes_expected > 0) {
+        int nread;
+
+        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+        if (pkt == NULL) {
+            DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
+            return NULL;
+        }
+        nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
+        if (nread <= 0) {
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        if (!(state->flags & NETDEV_IEEE802154_RAW)) {
+            gnrc_pktsnip_t *ieee802154_hdr, *netif_hdr;
+            gnrc_netif_hdr_t *hdr;
+            size_t mhr_len = ieee802154_get_frame_hdr_len(pkt->data);
+
+            if (mhr_len == 0) {
+                DEBUG("_recv_ieee802154: illegally formatted frame received\n");
+                gnrc_pktbuf_release(pkt);
+                return NULL;
+            }
+            nread -= mhr_len;
+            /* mark IEEE 802.15.4 header */
+            ieee802154_hdr = gnrc_pktbuf_mark(pkt, mhr_len, GNRC_NETTYPE_UNDEF);
+            if (ieee802154_hdr == NULL) {
+                DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+                gnrc_pktbuf_release(pkt);
+                return NULL;
+            }
+            netif_hdr = _make_netif_hdr(ieee802154_hdr->data);
+            if (netif_hdr == NULL) {
+                DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+                gnrc_pktbuf_release(pkt);
+                return NULL;
+            }
+
+            hdr = netif_hdr->data;
+
+#ifdef MODULE_L2FILTER
+            if (!l2filter_pass(dev->filter, gnrc_netif_hdr_get_src_addr(hdr),
+                               hdr->src_l2addr_len)) {
+                gnrc_pktbuf_release(pkt);
+                gnrc_pktbuf_release(netif_hdr);
+                DEBUG("_recv_ieee802154: packet dropped by l2filter\n");
+                return NULL;
+            }
+#endif
+
+            hdr->lqi = rx_info.lqi;
+            hdr->rssi = rx_info.rssi;
+            hdr->if_pid = thread_getpid();
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            gnrc_netif_nb_stats_rx(netif, netif_hdr);
+#endif
+            pkt->type = state->proto;
+            gnrc_pktbuf_remove_snip(pkt, ieee802154_hdr);
+            LL_APPEND(pkt, netif_hdr);
+        }
+
+        gnrc_pktbuf_realloc_data(pkt, nread);
+    }
+
+    return pkt;
+}
+
+static int _transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    netdev_t *dev = netif->dev;
+    netdev_ieee802154_t *state = (netdev_ieee802154_t *)netif->dev;
+    gnrc_netif_hdr_t *netif_hdr;
+    const uint8_t *src, *dst = NULL;
+    int res = 0;
+    size_t src_len, dst_len;
+    uint8_t mhr[IEEE802154_MAX_HDR_LEN];
+    uint8_t flags = (uint8_t)(state->flags & NETDEV_IEEE802154_SEND_MASK);
+    le_uint16_t dev_pan = byteorder_btols(byteorder_htons(state->pan));
+
+    flags |= IEEE802154_FCF_TYPE_DATA;
+    if (pkt->type != GNRC_NETTYPE_NETIF) {
+        DEBUG("_send_ieee802154: first header is not generic netif header\n");
+        gnrc_pktbuf_release(pkt);
+        return -EBADMSG;
+    }
+    netif_hdr = pkt->data;
+    /* prepare destination address */
+    if (netif_hdr->flags & /* If any of these flags is set assume broadcast */
+        (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
+        dst = ieee802154_addr_bcast;
+        dst_len = IEEE802154_ADDR_BCAST_LEN;
+    }
+    else {
+        dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
+        dst_len = netif_hdr->dst_l2addr_len;
+    }
+    src_len = netif_hdr->src_l2addr_len;
+    if (src_len > 0) {
+        src = gnrc_netif_hdr_get_src_addr(netif_hdr);
+    }
+    else {
+        src_len = netif->l2addr_len;
+        src = netif->l2addr;
+    }
+    if ((res = ieee802154_set_frame_hdr(mhr, src, src_len,
+                                        dst, dst_len, dev_pan,
+                                        dev_pan, flags, state->seq++)) == 0) {
+        DEBUG("_send_ieee802154: Error preperaring frame\n");
+        gnrc_pktbuf_release(pkt);
+        return -EINVAL;
+    }
+
+    /* prepare packet for sending */
+    iolist_t iolist = {
+        .iol_next = (iolist_t *)pkt->next,
+        .iol_base = mhr,
+        .iol_len = (size_t)res
+    };
+
+#ifdef MODULE_NETSTATS_L2
+    if (netif_hdr->flags &
+            (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
+        netif->dev->stats.tx_mcast_count++;
+    }
+    else {
+        netif->dev->stats.tx_unicast_count++;
+    }
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    gnrc_netif_nb_stats_tx(netif, pkt);
+#endif
+    /* no CSMA-CA: the timeslot is reserved for this transmission */
+    res = dev->driver->send(dev, &iolist);
+
+    /* release old data */
+    gnrc_pktbuf_release(pkt);
+    return res;
+}
+
+static void _set_netdev_state(gnrc_netif_t *netif, netopt_state_t devstate)
+{
+    netif->dev->driver->set(netif->dev, NETOPT_STATE, &devstate,
+                            sizeof(devstate));
+}
+
+static void _set_channel(gnrc_netif_t *netif, uint32_t idx)
+{
+    uint16_t channel = _hopping_seq[idx % sizeof(_hopping_seq)];
+
+    netif->dev->driver->set(netif->dev, NETOPT_CHANNEL, &channel,
+                            sizeof(channel));
+}
+
+static void _set_timer(gnrc_netif_t *netif, uint32_t target, uint32_t event)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    int32_t offset = (int32_t)(target - xtimer_now_usec());
+
+    /* the upper bits count timer settings, so a message of a timer that was
+     * replaced while already queued is recognized as stale */
+    tsch->timer_event = ((tsch->timer_event + GNRC_TSCH_EVENT_MASK + 1) &
+                         ~GNRC_TSCH_EVENT_MASK) | event;
+    tsch->timer_msg.type = GNRC_TSCH_EVENT_TIMER_TYPE;
+    tsch->timer_msg.content.value = tsch->timer_event;
+    xtimer_set_msg(&tsch->timer, (offset > 0) ? (uint32_t)offset : 0,
+                   &tsch->timer_msg, netif->pid);
+}
+
+static unsigned _slots_to_next_cell(gnrc_tsch_t *tsch)
+{
+    unsigned cur = tsch->asn % GNRC_TSCH_SLOTFRAME_LEN;
+    unsigned next = GNRC_TSCH_SLOTFRAME_LEN;
+
+    mutex_lock(&tsch->lock);
+    for (unsigned i = 0; i < GNRC_TSCH_CELL_NUMOF; i++) {
+        const gnrc_tsch_cell_t *cell = &tsch->cells[i];
+        unsigned dist;
+
+        if (cell->options == 0) {
+            continue;
+        }
+        dist = (cell->slot_offset + GNRC_TSCH_SLOTFRAME_LEN - cur) %
+               GNRC_TSCH_SLOTFRAME_LEN;
+        if (dist == 0) {
+            dist = GNRC_TSCH_SLOTFRAME_LEN;
+        }
+        if (dist < next) {
+            next = dist;
+        }
+    }
+    mutex_unlock(&tsch->lock);
+    return next;
+}
+
+static void _schedule_next_slot(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    uint32_t now = xtimer_now_usec();
+
+    /* skip the timeslots without cells, and cells already too late to
+     * serve */
+    do {
+        unsigned skip = _slots_to_next_cell(tsch);
+
+        tsch->asn += skip;
+        tsch->slot_start += skip * GNRC_TSCH_TIMESLOT_US;
+    } while ((int32_t)(now - tsch->slot_start) >
+             (int32_t)(GNRC_TSCH_TX_OFFSET_US / 2));
+    _set_timer(netif, tsch->slot_start, GNRC_TSCH_EVENT_SLOT);
+}
+
+static bool _cell_matches(const gnrc_tsch_cell_t *cell,
+                          const gnrc_mac_tx_t *tx,
+                          const gnrc_mac_tx_neighbor_t *neighbor)
+{
+    if (cell->addr_len == 0) {
+        return true;
+    }
+    return (neighbor != &tx->neighbors[0]) &&
+           (neighbor->l2_addr_len == cell->addr_len) &&
+           (memcmp(neighbor->l2_addr, cell->addr, cell->addr_len) == 0);
+}
+
+static gnrc_mac_tx_neighbor_t *_next_tx_neighbor(gnrc_netif_t *netif,
+                                                 const gnrc_tsch_cell_t *cell)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    gnrc_mac_tx_t *tx = &netif->mac.tx;
+
+    if ((cell->addr_len == 0) &&
+        (gnrc_priority_pktqueue_length(&tx->neighbors[0].queue) > 0)) {
+        return &tx->neighbors[0];
+    }
+    /* serve unicast neighbors round-robin */
+    for (unsigned i = 1; i <= GNRC_MAC_NEIGHBOR_COUNT; i++) {
+        unsigned id = ((tsch->last_neighbor + i - 1) % GNRC_MAC_NEIGHBOR_COUNT) + 1;
+        gnrc_mac_tx_neighbor_t *neighbor = &tx->neighbors[id];
+
+        if ((neighbor->l2_addr_len > 0) &&
+            (gnrc_priority_pktqueue_length(&neighbor->queue) > 0) &&
+            _cell_matches(cell, tx, neighbor)) {
+            tsch->last_neighbor = id;
+            return neighbor;
+        }
+    }
+    return NULL;
+}
+
+static bool _tx_select(gnrc_netif_t *netif, const gnrc_tsch_cell_t *cell)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    gnrc_mac_tx_t *tx = &netif->mac.tx;
+
+    if (tx->packet == NULL) {
+        gnrc_mac_tx_neighbor_t *neighbor = _next_tx_neighbor(netif, cell);
+
+        if (neighbor == NULL) {
+            return false;
+        }
+        tx->packet = gnrc_priority_pktqueue_pop(&neighbor->queue);
+        tx->current_neighbor = neighbor;
+        tsch->retries = 0;
+        tsch->be = GNRC_TSCH_MIN_BE;
+        tsch->backoff = 0;
+    }
+    else if (!_cell_matches(cell, tx, tx->current_neighbor)) {
+        return false;
+    }
+    if ((cell->options & GNRC_TSCH_CELL_SHARED) && (tsch->backoff > 0)) {
+        tsch->backoff--;
+        return false;
+    }
+    return true;
+}
+
+static gnrc_pktsnip_t *_eb_build(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    gnrc_tsch_frame_eb_t eb = {
+        .type = GNRC_TSCH_FRAME_EB,
+        .asn = byteorder_htonl(tsch->asn),
+        .join_priority = tsch->join_priority,
+    };
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, &eb, sizeof(eb), GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)hdr->data)->flags |= GNRC_NETIF_HDR_FLAGS_BROADCAST;
+    LL_PREPEND(pkt, hdr);
+    return pkt;
+}
+
+static void _slot_begin(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    unsigned slot_offset = tsch->asn % GNRC_TSCH_SLOTFRAME_LEN;
+    uint32_t now = xtimer_now_usec();
+    bool tx = false, rx = false;
+
+    if ((tsch->join_priority != 0) &&
+        ((now - tsch->last_sync) > GNRC_TSCH_DESYNC_TIMEOUT_US)) {
+        LOG_WARNING("WARNING: [TSCH] lost synchronization\n");
+        _scan_start(netif);
+        return;
+    }
+
+    mutex_lock(&tsch->lock);
+    for (unsigned i = 0; (i < GNRC_TSCH_CELL_NUMOF) && !tx; i++) {
+        const gnrc_tsch_cell_t *cell = &tsch->cells[i];
+
+        if ((cell->options == 0) || (cell->slot_offset != slot_offset)) {
+            continue;
+        }
+        if (cell->options & GNRC_TSCH_CELL_TX) {
+            if ((cell->options & GNRC_TSCH_CELL_SHARED) &&
+                (cell->addr_len == 0) &&
+                ((int32_t)(now - tsch->next_eb) >= 0)) {
+                tsch->eb = _eb_build(netif);
+                tsch->next_eb = now + GNRC_TSCH_EB_PERIOD_US;
+                tx = (tsch->eb != NULL);
+            }
+            if (!tx) {
+                tx = _tx_select(netif, cell);
+            }
+        }
+        if (tx || ((cell->options & GNRC_TSCH_CELL_RX) && !rx)) {
+            rx = !tx;
+            tsch->channel_offset = cell->channel_offset;
+            tsch->cell_options = cell->options;
+        }
+    }
+    mutex_unlock(&tsch->lock);
+
+    if (tx) {
+        tsch->slot_state = GNRC_TSCH_SLOT_TX;
+        _set_channel(netif, tsch->asn + tsch->channel_offset);
+        _set_netdev_state(netif, NETOPT_STATE_IDLE);
+        _set_timer(netif, tsch->slot_start + GNRC_TSCH_TX_OFFSET_US,
+                   GNRC_TSCH_EVENT_TX);
+    }
+    else if (rx) {
+        tsch->slot_state = GNRC_TSCH_SLOT_RX;
+        gnrc_netif_set_rx_started(netif, false);
+        _set_channel(netif, tsch->asn + tsch->channel_offset);
+        _set_netdev_state(netif, NETOPT_STATE_IDLE);
+        _set_timer(netif, tsch->slot_start + GNRC_TSCH_TX_OFFSET_US +
+                   SHR_DURATION_US + (GNRC_TSCH_RX_WAIT_US / 2),
+                   GNRC_TSCH_EVENT_RX_END);
+    }
+    else {
+        tsch->slot_state = GNRC_TSCH_SLOT_IDLE;
+        _set_netdev_state(netif, NETOPT_STATE_SLEEP);
+        _schedule_next_slot(netif);
+    }
+}
+
+static void _tx_done(gnrc_netif_t *netif, gnrc_mac_tx_feedback_t feedback)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    gnrc_mac_tx_t *tx = &netif->mac.tx;
+
+    if (tsch->slot_state != GNRC_TSCH_SLOT_TX) {
+        return;
+    }
+    tsch->slot_state = GNRC_TSCH_SLOT_IDLE;
+    _set_netdev_state(netif, NETOPT_STATE_SLEEP);
+
+    if (tsch->eb != NULL) {
+        gnrc_pktbuf_release(tsch->eb);
+        tsch->eb = NULL;
+        return;
+    }
+    if ((feedback == TX_FEEDBACK_SUCCESS) ||
+        (++tsch->retries > GNRC_TSCH_MAX_FRAME_RETRIES)) {
+        if (feedback != TX_FEEDBACK_SUCCESS) {
+            LOG_DEBUG("[TSCH] dropping frame after %u retries\n",
+                      (unsigned)GNRC_TSCH_MAX_FRAME_RETRIES);
+        }
+        gnrc_pktbuf_release(tx->packet);
+        tx->packet = NULL;
+        tx->current_neighbor = NULL;
+        return;
+    }
+    /* exponential backoff counted in shared cells */
+    if (tsch->cell_options & GNRC_TSCH_CELL_SHARED) {
+        tsch->backoff = random_uint32_range(0, 1U << tsch->be);
+        if (tsch->be < GNRC_TSCH_MAX_BE) {
+            tsch->be++;
+        }
+    }
+}
+
+static void _slot_tx(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    gnrc_pktsnip_t *pkt = (tsch->eb != NULL) ? tsch->eb : netif->mac.tx.packet;
+
+    /* keep the frame for retransmissions, _transmit() releases it */
+    gnrc_pktbuf_hold(pkt, 1);
+    _set_timer(netif, tsch->slot_start + SLOT_END_US, GNRC_TSCH_EVENT_SLOT_END);
+    if (_transmit(netif, pkt) < 0) {
+        _tx_done(netif, TX_FEEDBACK_BUSY);
+    }
+}
+
+static void _slot_end(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+
+    /* no feedback from the radio in time */
+    _tx_done(netif, TX_FEEDBACK_NOACK);
+    tsch->slot_state = GNRC_TSCH_SLOT_IDLE;
+    _set_netdev_state(netif, NETOPT_STATE_SLEEP);
+    _schedule_next_slot(netif);
+}
+
+static void _slot_rx_end(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+
+    if (gnrc_netif_get_rx_started(netif)) {
+        /* a frame is incoming, keep listening */
+        _set_timer(netif, tsch->slot_start + SLOT_END_US,
+                   GNRC_TSCH_EVENT_SLOT_END);
+        return;
+    }
+    _slot_end(netif);
+}
+
+static void _scan_channel(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+
+    _set_channel(netif, tsch->scan_channel++);
+    _set_netdev_state(netif, NETOPT_STATE_IDLE);
+    _set_timer(netif, xtimer_now_usec() + GNRC_TSCH_SCAN_CHANNEL_US,
+               GNRC_TSCH_EVENT_SCAN);
+}
+
+static void _scan_start(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+
+    tsch->state = GNRC_TSCH_STATE_SCANNING;
+    tsch->slot_state = GNRC_TSCH_SLOT_IDLE;
+    tsch->join_priority = GNRC_TSCH_JOIN_PRIO_NONE;
+    tsch->src_addr_len = 0;
+    _scan_channel(netif);
+}
+
+static void _start_coordinator(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+
+    _tx_done(netif, TX_FEEDBACK_NOACK);
+    tsch->state = GNRC_TSCH_STATE_SYNCED;
+    tsch->join_priority = 0;
+    tsch->src_addr_len = 0;
+    tsch->asn = 0;
+    tsch->slot_start = xtimer_now_usec();
+    tsch->last_sync = tsch->slot_start;
+    tsch->next_eb = tsch->slot_start;
+    LOG_INFO("[TSCH] started network as PAN coordinator\n");
+    _slot_begin(netif);
+}
+
+static void _eb_handle(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    gnrc_pktsnip_t *netif_snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    gnrc_netif_hdr_t *hdr;
+    gnrc_tsch_frame_eb_t eb;
+
+    /* the PAN coordinator is the reference clock, and the reception time is
+     * needed to synchronize */
+    if ((netif_snip == NULL) || (tsch->join_priority == 0) ||
+        !gnrc_netif_get_rx_started(netif)) {
+        return;
+    }
+    hdr = netif_snip->data;
+    memcpy(&eb, pkt->data, sizeof(eb));
+    if (eb.join_priority == GNRC_TSCH_JOIN_PRIO_NONE) {
+        return;
+    }
+    if (tsch->state == GNRC_TSCH_STATE_SYNCED) {
+        /* only the time source corrects our clock */
+        if ((hdr->src_l2addr_len != tsch->src_addr_len) ||
+            (memcmp(gnrc_netif_hdr_get_src_addr(hdr), tsch->src_addr,
+                    tsch->src_addr_len) != 0)) {
+            return;
+        }
+    }
+    else if (hdr->src_l2addr_len <= sizeof(tsch->src_addr)) {
+        memcpy(tsch->src_addr, gnrc_netif_hdr_get_src_addr(hdr),
+               hdr->src_l2addr_len);
+        tsch->src_addr_len = hdr->src_l2addr_len;
+        tsch->join_priority = eb.join_priority + 1;
+    }
+    else {
+        return;
+    }
+
+    tsch->asn = byteorder_ntohl(eb.asn);
+    tsch->slot_start = tsch->rx_start - GNRC_TSCH_TX_OFFSET_US - SHR_DURATION_US;
+    tsch->last_sync = xtimer_now_usec();
+    if (tsch->state == GNRC_TSCH_STATE_SCANNING) {
+        LOG_INFO("[TSCH] joined network at ASN %lu with join priority %u\n",
+                 (unsigned long)tsch->asn, (unsigned)tsch->join_priority);
+        tsch->state = GNRC_TSCH_STATE_SYNCED;
+        /* spread the EBs of nodes that joined at the same time */
+        tsch->next_eb = tsch->last_sync +
+                        random_uint32_range(0, GNRC_TSCH_EB_PERIOD_US);
+        _set_netdev_state(netif, NETOPT_STATE_SLEEP);
+        _schedule_next_slot(netif);
+    }
+}
+
+static void _rx_handle(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+
+    if ((pkt->size >= sizeof(gnrc_tsch_frame_eb_t)) &&
+        (((uint8_t *)pkt->data)[0] == GNRC_TSCH_FRAME_EB)) {
+        _eb_handle(netif, pkt);
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    if ((tsch->state != GNRC_TSCH_STATE_SYNCED) ||
+        !gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        DEBUG("[TSCH] unable to forward packet of type %i\n", pkt->type);
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static void _tsch_event_cb(netdev_t *dev, netdev_event_t event)
+{
+    gnrc_netif_t *netif = (gnrc_netif_t *) dev->context;
+
+    if (event == NETDEV_EVENT_ISR) {
+        msg_t msg;
+
+        msg.type = NETDEV_MSG_TYPE_EVENT;
+        msg.content.ptr = (void *) netif;
+
+        if (msg_send(&msg, netif->pid) <= 0) {
+            LOG_WARNING("WARNING: [TSCH] gnrc_netdev: possibly lost interrupt.\n");
+        }
+        return;
+    }
+
+    DEBUG("gnrc_netdev: event triggered -> %i\n", event);
+    switch (event) {
+        case NETDEV_EVENT_RX_STARTED:
+            netif->mac.prot.tsch.rx_start = xtimer_now_usec();
+            gnrc_netif_set_rx_started(netif, true);
+            break;
+        case NETDEV_EVENT_RX_COMPLETE: {
+            gnrc_pktsnip_t *pkt = netif->ops->recv(netif);
+
+            if (pkt != NULL) {
+                _rx_handle(netif, pkt);
+            }
+            gnrc_netif_set_rx_started(netif, false);
+            break;
+        }
+        case NETDEV_EVENT_TX_COMPLETE:
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_SUCCESS);
+#endif
+            _tx_done(netif, TX_FEEDBACK_SUCCESS);
+            break;
+        case NETDEV_EVENT_TX_NOACK:
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_NOACK);
+#endif
+            _tx_done(netif, TX_FEEDBACK_NOACK);
+            break;
+        case NETDEV_EVENT_TX_MEDIUM_BUSY:
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_BUSY);
+#endif
+            _tx_done(netif, TX_FEEDBACK_BUSY);
+            break;
+        default:
+            DEBUG("[TSCH] unhandled netdev event: %u\n", event);
+    }
+}
+
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    /* frames wait for a cell to their destination */
+    if (!gnrc_mac_queue_tx_packet(&netif->mac.tx, 0, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        LOG_WARNING("WARNING: [TSCH] TX queue full, drop packet\n");
+        return -ENOBUFS;
+    }
+    return 0;
+}
+
+static void _tsch_msg_handler(gnrc_netif_t *netif, msg_t *msg)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+
+    switch (msg->type) {
+        case GNRC_TSCH_EVENT_TIMER_TYPE:
+            if (msg->content.value != tsch->timer_event) {
+                DEBUG("[TSCH] ignoring stale timer event\n");
+                break;
+            }
+            switch (msg->content.value & GNRC_TSCH_EVENT_MASK) {
+                case GNRC_TSCH_EVENT_SLOT:
+                    _slot_begin(netif);
+                    break;
+                case GNRC_TSCH_EVENT_TX:
+                    _slot_tx(netif);
+                    break;
+                case GNRC_TSCH_EVENT_RX_END:
+                    _slot_rx_end(netif);
+                    break;
+                case GNRC_TSCH_EVENT_SLOT_END:
+                    _slot_end(netif);
+                    break;
+                case GNRC_TSCH_EVENT_SCAN:
+                    _scan_channel(netif);
+                    break;
+                default:
+                    break;
+            }
+            break;
+        case GNRC_TSCH_MSG_TYPE_START:
+            _start_coordinator(netif);
+            break;
+        default:
+            DEBUG("[TSCH]: unknown message type 0x%04x"
+                  "(no message handler defined)\n", msg->type);
+            break;
+    }
+}
+
+static void _tsch_init(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    netopt_enable_t enable = NETOPT_ENABLE;
+    netopt_enable_t disable = NETOPT_DISABLE;
+    uint8_t retrans = 0;
+
+    dev->event_callback = _tsch_event_cb;
+
+    /* the start of a reception is the time reference for synchronization */
+    dev->driver->set(dev, NETOPT_RX_START_IRQ, &enable, sizeof(enable));
+    dev->driver->set(dev, NETOPT_TX_END_IRQ, &enable, sizeof(enable));
+    /* one transmission per cell, retransmissions use later cells */
+    dev->driver->set(dev, NETOPT_CSMA, &disable, sizeof(disable));
+    dev->driver->set(dev, NETOPT_RETRANS, &retrans, sizeof(retrans));
+
+    uint16_t src_len = IEEE802154_LONG_ADDRESS_LEN;
+    dev->driver->set(dev, NETOPT_SRC_LEN, &src_len, sizeof(src_len));
+
+    /* Get own address from netdev */
+    netif->l2addr_len = dev->driver->get(dev, NETOPT_ADDRESS_LONG,
+                                         &netif->l2addr,
+                                         IEEE802154_LONG_ADDRESS_LEN);
+
+    mutex_init(&tsch->lock);
+    memset(tsch->cells, 0, sizeof(tsch->cells));
+    /* minimal 6TiSCH schedule (RFC 8180) */
+    tsch->cells[0].options = GNRC_TSCH_CELL_TX | GNRC_TSCH_CELL_RX |
+                             GNRC_TSCH_CELL_SHARED;
+
+    _scan_start(netif);
+}
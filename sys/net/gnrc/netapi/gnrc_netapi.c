@@ -18,11 +18,19 @@
  * @}
  */
 
+#include <assert.h>
+
 #include "mbox.h"
 #include "msg.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#ifdef MODULE_GNRC_PKTLAT
+#include "net/gnrc/pktlat.h"
+#endif
+#ifdef MODULE_TRACEBUF
+#include "tracebuf.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -79,57 +87,152 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+static void _dispatch_single(gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                             gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
+    int release = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        case GNRC_NETREG_TYPE_BATCH:
+#endif
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+                /* unable to dispatch packet */
+                release = 1;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                release = 1;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            release = 1;
+            break;
+    }
+    if (release) {
+        gnrc_pktbuf_release(pkt);
+    }
+#else
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release(pkt);
+    }
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
     int numof = gnrc_netreg_num(type, demux_ctx);
 
+#ifdef MODULE_TRACEBUF
+    tracebuf_add(TRACEBUF_NETAPI_DISPATCH, ((uint32_t)type << 16) | cmd);
+#endif
+#ifdef MODULE_GNRC_PKTLAT
+    gnrc_pktlat_stamp(pkt);
+#endif
+
     if (numof != 0) {
         gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
 
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            int release = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        release = 1;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        release = 1;
-                    }
-                    break;
-#endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
+            _dispatch_single(sendto, cmd, pkt);
+            sendto = gnrc_netreg_getnext(sendto);
+        }
+    }
+
+    return numof;
+}
+
+#ifdef MODULE_GNRC_NETAPI_BATCH
+int gnrc_netapi_dispatch_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t **pkts,
+                               unsigned numof)
+{
+    int subs = gnrc_netreg_num(type, demux_ctx);
+    unsigned batch_subs = 0;
+    gnrc_pktsnip_t *batch = NULL;
+    gnrc_netreg_entry_t *sendto;
+    uint16_t batch_cmd = (cmd == GNRC_NETAPI_MSG_TYPE_SND) ?
+                         GNRC_NETAPI_MSG_TYPE_SND_BATCH :
+                         GNRC_NETAPI_MSG_TYPE_RCV_BATCH;
+
+    assert((cmd == GNRC_NETAPI_MSG_TYPE_RCV) ||
+           (cmd == GNRC_NETAPI_MSG_TYPE_SND));
+    if ((subs == 0) || (numof == 0)) {
+        return subs;
+    }
+    sendto = gnrc_netreg_lookup(type, demux_ctx);
+    while (sendto) {
+        if (sendto->type == GNRC_NETREG_TYPE_BATCH) {
+            batch_subs++;
+        }
+        sendto = gnrc_netreg_getnext(sendto);
+    }
+    /* a single packet is not worth the detour through the batch */
+    if ((batch_subs > 0) && (numof > 1)) {
+        batch = gnrc_pktbuf_add(NULL, pkts, numof * sizeof(gnrc_pktsnip_t *),
+                                GNRC_NETTYPE_UNDEF);
+        if (batch == NULL) {
+            DEBUG("gnrc_netapi: unable to allocate batch, dispatching "
+                  "packets separately\n");
+        }
+        else {
+            gnrc_pktbuf_hold(batch, batch_subs - 1);
+        }
+    }
+    for (unsigned i = 0; i < numof; i++) {
+#ifdef MODULE_GNRC_PKTLAT
+        gnrc_pktlat_stamp(pkts[i]);
 #endif
-                default:
-                    /* unknown dispatch type */
-                    release = 1;
-                    break;
-            }
-            if (release) {
-                gnrc_pktbuf_release(pkt);
+        gnrc_pktbuf_hold(pkts[i], subs - 1);
+    }
+    sendto = gnrc_netreg_lookup(type, demux_ctx);
+    while (sendto) {
+        if ((batch != NULL) && (sendto->type == GNRC_NETREG_TYPE_BATCH)) {
+            if (_gnrc_netapi_send_recv(sendto->target.pid, batch,
+                                       batch_cmd) < 1) {
+                /* unable to dispatch batch */
+                for (unsigned i = 0; i < numof; i++) {
+                    gnrc_pktbuf_release(pkts[i]);
+                }
+                gnrc_pktbuf_release(batch);
             }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release(pkt);
+        }
+        else {
+            for (unsigned i = 0; i < numof; i++) {
+                _dispatch_single(sendto, cmd, pkts[i]);
             }
-#endif
-            sendto = gnrc_netreg_getnext(sendto);
         }
+        sendto = gnrc_netreg_getnext(sendto);
     }
 
-    return numof;
+    return subs;
 }
+
+void gnrc_netapi_batch_drain(gnrc_pktsnip_t *batch,
+                             void (*handler)(gnrc_pktsnip_t *pkt))
+{
+    gnrc_pktsnip_t **pkts = batch->data;
+    unsigned numof = batch->size / sizeof(gnrc_pktsnip_t *);
+
+    for (unsigned i = 0; i < numof; i++) {
+        handler(pkts[i]);
+    }
+    gnrc_pktbuf_release(batch);
+}
+#endif
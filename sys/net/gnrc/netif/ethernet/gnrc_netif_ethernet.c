@@ -20,6 +20,7 @@
 #include "net/ethernet/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/internal.h"
 #ifdef MODULE_GNRC_IPV6
 #include "net/ipv6/hdr.h"
 #endif
@@ -150,6 +151,9 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     else {
         dev->stats.tx_unicast_count++;
     }
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    gnrc_netif_nb_stats_tx(netif, pkt);
 #endif
     res = dev->driver->send(dev, &iolist);
 
@@ -160,38 +164,18 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
+#ifdef MODULE_L2FILTER
     netdev_t *dev = netif->dev;
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+#endif
     gnrc_pktsnip_t *pkt = NULL;
+    int nread = gnrc_netif_recv_frame(netif, &pkt, NULL);
 
-    if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
-
-        if (!pkt) {
-            DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
-
-            /* drop the packet */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
-
-            goto out;
-        }
-
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, NULL);
-        if (nread <= 0) {
-            DEBUG("gnrc_netif_ethernet: read error.\n");
+    if (nread > 0) {
+        if ((unsigned)nread < sizeof(ethernet_hdr_t)) {
+            DEBUG("gnrc_netif_ethernet: received frame is too short\n");
             goto safe_out;
         }
 
-        if (nread < bytes_expected) {
-            /* we've got less than the expected packet size,
-             * so free the unused space.*/
-
-            DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
-        }
-
         /* mark ethernet header */
         gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
         if (!eth_hdr) {
@@ -240,7 +224,6 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         LL_APPEND(pkt, netif_hdr);
     }
 
-out:
     return pkt;
 
 safe_out:
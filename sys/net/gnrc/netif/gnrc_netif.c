@@ -25,7 +25,8 @@
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
 #endif /* MODULE_GNRC_IPV6_NIB */
-#ifdef MODULE_NETSTATS_IPV6
+#if defined(MODULE_NETSTATS_IPV6) || defined(MODULE_GNRC_PKTLAT) || \
+    defined(MODULE_GNRC_PKTBUF_STATS)
 #include "net/netstats.h"
 #endif
 #include "fmt.h"
@@ -34,18 +35,41 @@
 
 #include "net/gnrc/netif.h"
 #include "net/gnrc/netif/internal.h"
+#ifdef MODULE_GNRC_PKTLAT
+#include "net/gnrc/pktlat.h"
+#endif
+#ifdef MODULE_NETCAP
+#include "net/netcap.h"
+#endif
+#ifdef MODULE_GNRC_ICMPV6_RATELIMIT
+#include "net/gnrc/icmpv6/ratelimit.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
 #define _NETIF_NETAPI_MSG_QUEUE_SIZE    (8)
 
+#if GNRC_NETIF_NUMOF > 1
 static gnrc_netif_t _netifs[GNRC_NETIF_NUMOF];
+#else
+gnrc_netif_t gnrc_netif_single;
+#define _netifs             (&gnrc_netif_single)
+#endif
 
 static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _configure_netdev(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+#ifdef MODULE_GNRC_NETIF_TXQ
+static void _txq_init(gnrc_netif_t *netif);
+static void _txq_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+static void _txq_done(gnrc_netif_t *netif);
+static void _txq_flush(gnrc_netif_t *netif);
+#endif
+#ifdef MODULE_GNRC_NETAPI_BATCH
+static void _flush_rx_batch(gnrc_netif_t *netif);
+#endif
 
 gnrc_netif_t *gnrc_netif_create(char *stack, int stacksize, char priority,
                                 const char *name, netdev_t *netdev,
@@ -67,6 +91,9 @@ gnrc_netif_t *gnrc_netif_create(char *stack, int stacksize, char priority,
     netif->ops = ops;
     assert(netif->dev == NULL);
     netif->dev = netdev;
+#ifdef MODULE_NETCAP
+    netcap_add(netdev);
+#endif
     res = thread_create(stack, stacksize, priority, THREAD_CREATE_STACKTEST,
                         _gnrc_netif_thread, (void *)netif, name);
     (void)res;
@@ -74,6 +101,7 @@ gnrc_netif_t *gnrc_netif_create(char *stack, int stacksize, char priority,
     return netif;
 }
 
+#if GNRC_NETIF_NUMOF > 1
 unsigned gnrc_netif_numof(void)
 {
     gnrc_netif_t *netif = NULL;
@@ -99,6 +127,7 @@ gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev)
     }
     return NULL;
 }
+#endif  /* GNRC_NETIF_NUMOF > 1 */
 
 int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
 {
@@ -120,6 +149,29 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                     *((netstats_t **)opt->data) = &netif->ipv6.stats;
                     res = sizeof(&netif->ipv6.stats);
                     break;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                case NETSTATS_NEIGHBOR:
+                    assert(opt->data_len == sizeof(netstats_nb_table_t *));
+                    *((netstats_nb_table_t **)opt->data) = &netif->dev->nb_stats;
+                    res = sizeof(&netif->dev->nb_stats);
+                    break;
+#endif
+#ifdef MODULE_GNRC_PKTLAT
+                case NETSTATS_PKTLAT:
+                    /* the statistics are shared by all interfaces */
+                    assert(opt->data_len == sizeof(gnrc_pktlat_stats_t *));
+                    *((gnrc_pktlat_stats_t **)opt->data) = &gnrc_pktlat_stats[0][0];
+                    res = sizeof(gnrc_pktlat_stats_t *);
+                    break;
+#endif
+#ifdef MODULE_GNRC_PKTBUF_STATS
+                case NETSTATS_PKTBUF:
+                    /* computed on request, so a copy is returned */
+                    assert(opt->data_len == sizeof(gnrc_pktbuf_stats_t));
+                    gnrc_pktbuf_get_stats(opt->data);
+                    res = sizeof(gnrc_pktbuf_stats_t);
+                    break;
 #endif
                 default:
                     /* take from device */
@@ -356,6 +408,7 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
     return res;
 }
 
+#if GNRC_NETIF_NUMOF > 1
 gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid)
 {
     gnrc_netif_t *netif = NULL;
@@ -367,6 +420,7 @@ gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid)
     }
     return NULL;
 }
+#endif  /* GNRC_NETIF_NUMOF > 1 */
 
 char *gnrc_netif_addr_to_str(const uint8_t *addr, size_t addr_len, char *out)
 {
@@ -462,10 +516,58 @@ void gnrc_netif_release(gnrc_netif_t *netif)
     }
 }
 
+int gnrc_netif_recv_frame(gnrc_netif_t *netif, gnrc_pktsnip_t **pkt,
+                          void *info)
+{
+    netdev_t *dev = netif->dev;
+    uint16_t prealloc;
+    int bytes_expected;
+    int nread;
+
+    if (dev->driver->get(dev, NETOPT_RX_PREALLOC, &prealloc,
+                         sizeof(prealloc)) == sizeof(prealloc)) {
+        /* device can burst the frame directly into a reserved buffer */
+        bytes_expected = prealloc;
+    }
+    else {
+        bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+    }
+    if (bytes_expected <= 0) {
+        return bytes_expected;
+    }
+    *pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+    if (*pkt == NULL) {
+        DEBUG("gnrc_netif: cannot allocate pktsnip.\n");
+        /* drop the frame */
+        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        return 0;
+    }
+    nread = dev->driver->recv(dev, (*pkt)->data, bytes_expected, info);
+    if (nread <= 0) {
+        DEBUG("gnrc_netif: read error.\n");
+        gnrc_pktbuf_release(*pkt);
+        *pkt = NULL;
+        return nread;
+    }
+    if (nread < bytes_expected) {
+        /* free the unused space */
+        gnrc_pktbuf_realloc_data(*pkt, nread);
+    }
+    return nread;
+}
+
 #ifdef MODULE_GNRC_IPV6
 static inline bool _addr_anycast(const gnrc_netif_t *netif, unsigned idx);
 static int _addr_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
 static int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+static void _bloom_update(gnrc_netif_t *netif);
+static void _src_cache_flush(gnrc_netif_t *netif);
+static ipv6_addr_t *_src_cache_get(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                                   bool ll_only);
+static void _src_cache_put(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                           bool ll_only, const ipv6_addr_t *src);
+#endif
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -605,6 +707,10 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* GNRC_IPV6_NIB_CONF_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+    _bloom_update(netif);
+    _src_cache_flush(netif);
+#endif
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -666,6 +772,10 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
     if (remove_sol_nodes) {
         gnrc_netif_ipv6_group_leave_internal(netif, &sol_nodes);
     }
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+    _bloom_update(netif);
+    _src_cache_flush(netif);
+#endif
     gnrc_netif_release(netif);
 }
 
@@ -707,6 +817,13 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
     memset(candidate_set, 0, sizeof(candidate_set));
     gnrc_netif_acquire(netif);
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+    best_src = _src_cache_get(netif, dst, ll_only);
+    if (best_src != NULL) {
+        gnrc_netif_release(netif);
+        return best_src;
+    }
+#endif
     int first_candidate = _create_candidate_set(netif, dst, ll_only,
                                                 candidate_set);
     if (first_candidate >= 0) {
@@ -714,6 +831,9 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
         if (best_src == NULL) {
             best_src = &(netif->ipv6.addrs[first_candidate]);
         }
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+        _src_cache_put(netif, dst, ll_only, best_src);
+#endif
     }
     gnrc_netif_release(netif);
     return best_src;
@@ -773,6 +893,9 @@ int gnrc_netif_ipv6_group_join_internal(gnrc_netif_t *netif,
         return -ENOMEM;
     }
     memcpy(&netif->ipv6.groups[idx], addr, sizeof(netif->ipv6.groups[idx]));
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+    _bloom_update(netif);
+#endif
     /* TODO:
      *  - MLD action
      */
@@ -790,6 +913,9 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
     idx = _group_idx(netif, addr);
     if (idx >= 0) {
         ipv6_addr_set_unspecified(&netif->ipv6.groups[idx]);
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+        _bloom_update(netif);
+#endif
         /* TODO:
          *  - MLD action */
     }
@@ -834,9 +960,89 @@ static inline bool _addr_anycast(const gnrc_netif_t *netif, unsigned idx)
     return (netif->ipv6.addrs_flags[idx] & GNRC_NETIF_IPV6_ADDRS_FLAGS_ANYCAST);
 }
 
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+/* two bits of a 32 bit bloom filter, taken from the interface identifier
+ * since that is where the addresses of an interface differ the most */
+static inline uint32_t _bloom_bits(const ipv6_addr_t *addr)
+{
+    return (1UL << (addr->u8[15] & 0x1f)) |
+           (1UL << ((addr->u8[14] ^ addr->u8[1]) & 0x1f));
+}
+
+static void _bloom_update(gnrc_netif_t *netif)
+{
+    netif->ipv6.addrs_bloom = 0;
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
+        if (!ipv6_addr_is_unspecified(&netif->ipv6.addrs[i])) {
+            netif->ipv6.addrs_bloom |= _bloom_bits(&netif->ipv6.addrs[i]);
+        }
+    }
+    netif->ipv6.groups_bloom = 0;
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_GROUPS_NUMOF; i++) {
+        if (!ipv6_addr_is_unspecified(&netif->ipv6.groups[i])) {
+            netif->ipv6.groups_bloom |= _bloom_bits(&netif->ipv6.groups[i]);
+        }
+    }
+}
+
+static void _src_cache_flush(gnrc_netif_t *netif)
+{
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_SRC_CACHE_SIZE; i++) {
+        netif->ipv6.src_cache[i].flags = 0;
+    }
+    memcpy(netif->ipv6.src_cache_addrs_flags, netif->ipv6.addrs_flags,
+           sizeof(netif->ipv6.src_cache_addrs_flags));
+}
+
+static ipv6_addr_t *_src_cache_get(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                                   bool ll_only)
+{
+    uint8_t flags = GNRC_NETIF_IPV6_SRC_CACHE_VALID |
+                    ((ll_only) ? GNRC_NETIF_IPV6_SRC_CACHE_LL_ONLY : 0);
+
+    /* address states changed since the cache was filled */
+    if (memcmp(netif->ipv6.src_cache_addrs_flags, netif->ipv6.addrs_flags,
+               sizeof(netif->ipv6.src_cache_addrs_flags)) != 0) {
+        _src_cache_flush(netif);
+        return NULL;
+    }
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_SRC_CACHE_SIZE; i++) {
+        gnrc_netif_ipv6_src_cache_t *entry = &netif->ipv6.src_cache[i];
+
+        if ((entry->flags == flags) && ipv6_addr_equal(&entry->dst, dst)) {
+            return &netif->ipv6.addrs[entry->idx];
+        }
+    }
+    return NULL;
+}
+
+static void _src_cache_put(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                           bool ll_only, const ipv6_addr_t *src)
+{
+    gnrc_netif_ipv6_src_cache_t *entry;
+
+    entry = &netif->ipv6.src_cache[netif->ipv6.src_cache_next];
+    netif->ipv6.src_cache_next = (netif->ipv6.src_cache_next + 1) %
+                                 GNRC_NETIF_IPV6_SRC_CACHE_SIZE;
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    entry->idx = src - netif->ipv6.addrs;
+    entry->flags = GNRC_NETIF_IPV6_SRC_CACHE_VALID |
+                   ((ll_only) ? GNRC_NETIF_IPV6_SRC_CACHE_LL_ONLY : 0);
+}
+#endif /* MODULE_GNRC_NETIF_IPV6_CACHE */
+
 static int _idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr, bool mcast)
 {
     if (!ipv6_addr_is_unspecified(addr)) {
+#ifdef MODULE_GNRC_NETIF_IPV6_CACHE
+        uint32_t bloom = (mcast) ? netif->ipv6.groups_bloom
+                                 : netif->ipv6.addrs_bloom;
+        uint32_t bits = _bloom_bits(addr);
+
+        if ((bloom & bits) != bits) {
+            return -1;
+        }
+#endif
         const ipv6_addr_t *iplist = (mcast) ? netif->ipv6.groups : netif->ipv6.addrs;
         unsigned ipmax = (mcast) ? GNRC_NETIF_IPV6_GROUPS_NUMOF : GNRC_NETIF_IPV6_ADDRS_NUMOF;
         for (unsigned i = 0; i < ipmax; i++) {
@@ -1128,7 +1334,7 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
 
     switch (netif->device_type) {
 #if defined(MODULE_NETDEV_IEEE802154) || defined(MODULE_XBEE) \
-    || defined(MODULE_NORDIC_SOFTDEVICE_BLE)
+    || defined(MODULE_NORDIC_SOFTDEVICE_BLE) || defined(MODULE_NIMBLE_NETIF)
         case NETDEV_TYPE_BLE:
         case NETDEV_TYPE_IEEE802154: {
                 uint16_t tmp;
@@ -1198,7 +1404,7 @@ static void _init_from_device(gnrc_netif_t *netif)
 #endif
             break;
 #endif
-#ifdef MODULE_NORDIC_SOFTDEVICE_BLE
+#if defined(MODULE_NORDIC_SOFTDEVICE_BLE) || defined(MODULE_NIMBLE_NETIF)
         case NETDEV_TYPE_BLE:
             netif->ipv6.mtu = IPV6_MIN_MTU;
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
@@ -1230,7 +1436,8 @@ static void _configure_netdev(netdev_t *dev)
     if (res < 0) {
         DEBUG("gnrc_netif: enable NETOPT_RX_END_IRQ failed: %d\n", res);
     }
-#ifdef MODULE_NETSTATS_L2
+#if defined(MODULE_NETSTATS_L2) || defined(MODULE_NETSTATS_NEIGHBOR) || \
+    defined(MODULE_GNRC_NETIF_IEEE802154_BURST)
     res = dev->driver->set(dev, NETOPT_TX_END_IRQ, &enable, sizeof(enable));
     if (res < 0) {
         DEBUG("gnrc_netif: enable NETOPT_TX_END_IRQ failed: %d\n", res);
@@ -1238,6 +1445,54 @@ static void _configure_netdev(netdev_t *dev)
 #endif
 }
 
+#ifdef MODULE_NETSTATS_NEIGHBOR
+void gnrc_netif_nb_stats_tx(gnrc_netif_t *netif, const gnrc_pktsnip_t *pkt)
+{
+    netstats_nb_table_t *table = &netif->dev->nb_stats;
+    const gnrc_netif_hdr_t *hdr = pkt->data;
+
+    if ((hdr->flags & (GNRC_NETIF_HDR_FLAGS_BROADCAST |
+                       GNRC_NETIF_HDR_FLAGS_MULTICAST)) ||
+        (hdr->dst_l2addr_len > NETSTATS_NB_L2ADDR_MAXLEN)) {
+        netstats_nb_record(table, NULL, 0);
+        return;
+    }
+    netstats_nb_record(table, gnrc_netif_hdr_get_dst_addr(hdr),
+                       hdr->dst_l2addr_len);
+}
+
+void gnrc_netif_nb_stats_tx_result(gnrc_netif_t *netif,
+                                   netstats_nb_result_t result)
+{
+    netdev_t *dev = netif->dev;
+    unsigned transmissions = 0;
+
+    if (result == NETSTATS_NB_SUCCESS) {
+        uint8_t retries;
+
+        if (dev->driver->get(dev, NETOPT_TX_RETRIES_NEEDED, &retries,
+                             sizeof(retries)) > 0) {
+            transmissions = retries + 1;
+        }
+    }
+    netstats_nb_update_tx(&dev->nb_stats, result, transmissions);
+}
+
+void gnrc_netif_nb_stats_rx(gnrc_netif_t *netif,
+                            const gnrc_pktsnip_t *netif_hdr)
+{
+    const gnrc_netif_hdr_t *hdr = netif_hdr->data;
+
+    if ((hdr->src_l2addr_len == 0) ||
+        (hdr->src_l2addr_len > NETSTATS_NB_L2ADDR_MAXLEN)) {
+        return;
+    }
+    netstats_nb_update_rx(&netif->dev->nb_stats,
+                          gnrc_netif_hdr_get_src_addr(hdr),
+                          hdr->src_l2addr_len, hdr->rssi, hdr->lqi);
+}
+#endif
+
 static void *_gnrc_netif_thread(void *args)
 {
     gnrc_netapi_opt_t *opt;
@@ -1270,20 +1525,45 @@ static void *_gnrc_netif_thread(void *args)
         return NULL;
     }
     _configure_netdev(dev);
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    netstats_nb_init(&dev->nb_stats);
+#endif
     _init_from_device(netif);
     netif->cur_hl = GNRC_NETIF_DEFAULT_HL;
+#ifdef MODULE_GNRC_ICMPV6_RATELIMIT
+    gnrc_icmpv6_ratelimit_init(&netif->ipv6.icmpv6_rl,
+                               GNRC_ICMPV6_RATELIMIT_RATE,
+                               GNRC_ICMPV6_RATELIMIT_BURST);
+#endif
 #ifdef MODULE_GNRC_IPV6_NIB
     gnrc_ipv6_nib_init_iface(netif);
 #endif
     if (netif->ops->init) {
         netif->ops->init(netif);
     }
+#ifdef MODULE_GNRC_NETIF_TXQ
+    _txq_init(netif);
+#endif
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
 
     while (1) {
+#ifdef MODULE_GNRC_NETIF_TXQ
+        /* start the next queued transmission once the device is idle */
+        _txq_flush(netif);
+#endif
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        /* keep collecting received packets as long as further events are
+         * queued, pass them up once the thread would block */
+        if (msg_avail() <= 0) {
+            _flush_rx_batch(netif);
+        }
+#endif
         DEBUG("gnrc_netif: waiting for incoming messages\n");
         msg_receive(&msg);
+#ifdef MODULE_GNRC_PKTLAT
+        gnrc_pktlat_record_msg(GNRC_PKTLAT_NETIF, &msg);
+#endif
         /* dispatch netdev, MAC and gnrc_netapi messages */
         switch (msg.type) {
             case NETDEV_MSG_TYPE_EVENT:
@@ -1292,12 +1572,22 @@ static void *_gnrc_netif_thread(void *args)
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
+#ifdef MODULE_GNRC_NETIF_TXQ
+                _txq_send(netif, msg.content.ptr);
+#else
                 res = netif->ops->send(netif, msg.content.ptr);
                 if (res < 0) {
                     DEBUG("gnrc_netif: error sending packet %p (code: %u)\n",
                           msg.content.ptr, res);
                 }
+#endif
+                break;
+#ifdef MODULE_GNRC_NETIF_TXQ
+            case GNRC_NETIF_TXQ_MSG_TYPE_TIMEOUT:
+                DEBUG("gnrc_netif: end of transmission not reported\n");
+                _txq_done(netif);
                 break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
@@ -1345,8 +1635,44 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+#ifdef MODULE_GNRC_NETAPI_BATCH
+static void _flush_rx_batch(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t **pkts = netif->rx_batch;
+    unsigned numof = netif->rx_batch_numof;
+
+    if (numof == 0) {
+        return;
+    }
+    netif->rx_batch_numof = 0;
+    /* throw away packets if no one is interested */
+    if (!gnrc_netapi_dispatch_receive_batch(pkts[0]->type,
+                                            GNRC_NETREG_DEMUX_CTX_ALL,
+                                            pkts, numof)) {
+        DEBUG("gnrc_netif: unable to forward packets of type %i\n",
+              pkts[0]->type);
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+    }
+}
+
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
+    /* a batch only holds packets of the same type */
+    if ((netif->rx_batch_numof > 0) &&
+        (netif->rx_batch[0]->type != pkt->type)) {
+        _flush_rx_batch(netif);
+    }
+    netif->rx_batch[netif->rx_batch_numof++] = pkt;
+    if (netif->rx_batch_numof >= GNRC_NETAPI_BATCH_NUMOF) {
+        _flush_rx_batch(netif);
+    }
+}
+#else
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    (void)netif;
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
         DEBUG("gnrc_netif: unable to forward packet of type %i\n", pkt->type);
@@ -1354,6 +1680,7 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
         return;
     }
 }
+#endif
 
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
@@ -1363,6 +1690,10 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
         msg_t msg = { .type = NETDEV_MSG_TYPE_EVENT,
                       .content = { .ptr = netif } };
 
+#ifdef MODULE_GNRC_PKTLAT
+        netif->isr_stamp = xtimer_now().ticks32;
+#endif
+
         if (msg_send(&msg, netif->pid) <= 0) {
             puts("gnrc_netif: possibly lost interrupt.");
         }
@@ -1374,25 +1705,157 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                     gnrc_pktsnip_t *pkt = netif->ops->recv(netif);
 
                     if (pkt) {
-                        _pass_on_packet(pkt);
+#ifdef MODULE_GNRC_PKTLAT
+                        gnrc_pktlat_record(GNRC_PKTLAT_NETIF, GNRC_PKTLAT_RX,
+                                           netif->isr_stamp, msg_avail());
+#endif
+                        _pass_on_packet(netif, pkt);
                     }
                 }
                 break;
-#ifdef MODULE_NETSTATS_L2
+#if defined(MODULE_NETSTATS_L2) || defined(MODULE_NETSTATS_NEIGHBOR)
             case NETDEV_EVENT_TX_MEDIUM_BUSY:
+#ifdef MODULE_NETSTATS_L2
                 /* we are the only ones supposed to touch this variable,
                  * so no acquire necessary */
                 dev->stats.tx_failed++;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_BUSY);
+#endif
                 break;
             case NETDEV_EVENT_TX_COMPLETE:
+#ifdef MODULE_NETSTATS_L2
                 /* we are the only ones supposed to touch this variable,
                  * so no acquire necessary */
                 dev->stats.tx_success++;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_SUCCESS);
+#endif
+                break;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            case NETDEV_EVENT_TX_NOACK:
+                gnrc_netif_nb_stats_tx_result(netif, NETSTATS_NB_NOACK);
                 break;
 #endif
             default:
                 DEBUG("gnrc_netif: warning: unhandled event %u.\n", event);
         }
+#ifdef MODULE_GNRC_NETIF_IEEE802154_BURST
+        if (netif->burst.state == GNRC_NETIF_BURST_PENDING) {
+            switch (event) {
+                case NETDEV_EVENT_TX_COMPLETE:
+                case NETDEV_EVENT_TX_COMPLETE_DATA_PENDING:
+                    netif->burst.state = GNRC_NETIF_BURST_ACKED;
+                    break;
+                case NETDEV_EVENT_TX_NOACK:
+                case NETDEV_EVENT_TX_MEDIUM_BUSY:
+                case NETDEV_EVENT_TX_TIMEOUT:
+                    netif->burst.state = GNRC_NETIF_BURST_IDLE;
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+#ifdef MODULE_GNRC_NETIF_TXQ
+        switch (event) {
+            case NETDEV_EVENT_TX_COMPLETE:
+            case NETDEV_EVENT_TX_COMPLETE_DATA_PENDING:
+            case NETDEV_EVENT_TX_NOACK:
+            case NETDEV_EVENT_TX_MEDIUM_BUSY:
+            case NETDEV_EVENT_TX_TIMEOUT:
+                /* the next transmission is started from the thread's loop,
+                 * not from within the driver's ISR handling */
+                _txq_done(netif);
+                break;
+            default:
+                break;
+        }
+#endif
     }
 }
+
+#ifdef MODULE_GNRC_NETIF_TXQ
+static void _txq_init(gnrc_netif_t *netif)
+{
+    static const netopt_enable_t enable = NETOPT_ENABLE;
+    netdev_t *dev = netif->dev;
+
+    gnrc_priority_pktqueue_init(&netif->txq);
+    memarray_init(&netif->txq_pool, netif->txq_nodes,
+                  sizeof(gnrc_priority_pktqueue_node_t), GNRC_NETIF_TXQ_SIZE);
+    netif->txq_timeout_msg.type = GNRC_NETIF_TXQ_MSG_TYPE_TIMEOUT;
+    netif->txq_busy = false;
+    /* only queue if the device reports the end of a transmission to us;
+     * e.g. MAC layers replace the event callback with their own */
+    netif->txq_async = (dev->event_callback == _event_cb) &&
+                       (dev->driver->set(dev, NETOPT_TX_END_IRQ, &enable,
+                                         sizeof(enable)) >= 0);
+    DEBUG("gnrc_netif: transmit queue %s\n",
+          netif->txq_async ? "enabled" : "disabled, device sends synchronously");
+}
+
+static void _txq_start(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    int res;
+
+    if (netif->txq_async) {
+        /* mark busy before sending, the end of the transmission may
+         * already be reported during send() */
+        netif->txq_busy = true;
+        xtimer_set_msg(&netif->txq_timer, GNRC_NETIF_TXQ_TIMEOUT,
+                       &netif->txq_timeout_msg, netif->pid);
+    }
+    res = netif->ops->send(netif, pkt);
+    if (res < 0) {
+        DEBUG("gnrc_netif: error sending packet %p (code: %u)\n",
+              (void *)pkt, res);
+        _txq_done(netif);
+    }
+}
+
+static void _txq_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_priority_pktqueue_node_t *node;
+
+    if (!netif->txq_busy && (gnrc_priority_pktqueue_length(&netif->txq) == 0)) {
+        _txq_start(netif, pkt);
+        return;
+    }
+    node = memarray_alloc(&netif->txq_pool);
+    if (node == NULL) {
+        DEBUG("gnrc_netif: transmit queue full, dropping packet %p\n",
+              (void *)pkt);
+        gnrc_pktbuf_release_error(pkt, ENOBUFS);
+        return;
+    }
+    /* same priority for all packets, so the queue is FIFO */
+    gnrc_priority_pktqueue_node_init(node, 0, pkt);
+    gnrc_priority_pktqueue_push(&netif->txq, node);
+}
+
+static void _txq_done(gnrc_netif_t *netif)
+{
+    if (netif->txq_busy) {
+        xtimer_remove(&netif->txq_timer);
+        netif->txq_busy = false;
+    }
+}
+
+static void _txq_flush(gnrc_netif_t *netif)
+{
+    while (!netif->txq_busy && (gnrc_priority_pktqueue_length(&netif->txq) > 0)) {
+        gnrc_priority_pktqueue_node_t *node;
+        gnrc_pktsnip_t *pkt;
+
+        node = (gnrc_priority_pktqueue_node_t *)priority_queue_remove_head(&netif->txq);
+        pkt = node->pkt;
+        memarray_free(&netif->txq_pool, node);
+        _txq_start(netif, pkt);
+    }
+}
+#endif
 /** @} */
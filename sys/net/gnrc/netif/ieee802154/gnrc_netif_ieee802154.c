@@ -13,13 +13,19 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <string.h>
+
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/netdev/ieee802154.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/ipv6/hdr.h"
 #endif
+#ifdef MODULE_IEEE802154_SECURITY
+#include "net/ieee802154_security.h"
+#endif
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -28,14 +34,33 @@
 #include "od.h"
 #endif
 
+#ifdef MODULE_IEEE802154_SECURITY
+#define MHR_LEN     (IEEE802154_MAX_HDR_LEN + IEEE802154_SEC_AUX_HDR_LEN)
+#else
+#define MHR_LEN     (IEEE802154_MAX_HDR_LEN)
+#endif
+
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
+#ifdef MODULE_IEEE802154_SECURITY
+static void _init(gnrc_netif_t *netif);
+static int _get(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt);
+static int _set(gnrc_netif_t *netif, const gnrc_netapi_opt_t *opt);
+#endif
 
 static const gnrc_netif_ops_t ieee802154_ops = {
+#ifdef MODULE_IEEE802154_SECURITY
+    .init = _init,
+    .send = _send,
+    .recv = _recv,
+    .get = _get,
+    .set = _set,
+#else
     .send = _send,
     .recv = _recv,
     .get = gnrc_netif_get_from_netdev,
     .set = gnrc_netif_set_from_netdev,
+#endif
 };
 
 gnrc_netif_t *gnrc_netif_ieee802154_create(char *stack, int stacksize,
@@ -78,23 +103,9 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     netdev_t *dev = netif->dev;
     netdev_ieee802154_rx_info_t rx_info;
     gnrc_pktsnip_t *pkt = NULL;
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
-
-    if (bytes_expected >= (int)IEEE802154_MIN_FRAME_LEN) {
-        int nread;
+    int nread = gnrc_netif_recv_frame(netif, &pkt, &rx_info);
 
-        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
-        if (pkt == NULL) {
-            DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
-            /* Discard packet on netdev device */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
-            return NULL;
-        }
-        nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
-        if (nread <= 0) {
-            gnrc_pktbuf_release(pkt);
-            return NULL;
-        }
+    if (nread >= (int)IEEE802154_MIN_FRAME_LEN) {
         if (netif->flags & GNRC_NETIF_FLAGS_RAWMODE) {
             /* Raw mode, skip packet processing, but provide rx_info via
              * GNRC_NETTYPE_NETIF */
@@ -119,11 +130,38 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 #endif
             size_t mhr_len = ieee802154_get_frame_hdr_len(pkt->data);
 
-            if (mhr_len == 0) {
+            if ((mhr_len == 0) || ((int)mhr_len > nread)) {
                 DEBUG("_recv_ieee802154: illegally formatted frame received\n");
                 gnrc_pktbuf_release(pkt);
                 return NULL;
             }
+#ifdef MODULE_IEEE802154_SECURITY
+            if (((uint8_t *)pkt->data)[0] & IEEE802154_FCF_SECURITY_EN) {
+                int res = ieee802154_sec_decrypt(&netif->sec, pkt->data,
+                                                 mhr_len,
+                                                 (uint8_t *)pkt->data + mhr_len,
+                                                 nread - mhr_len);
+                if (res < 0) {
+                    DEBUG("_recv_ieee802154: unable to unsecure frame (%d)\n",
+                          res);
+                    gnrc_pktbuf_release(pkt);
+                    return NULL;
+                }
+                /* strip the MIC */
+                nread = mhr_len + res;
+            }
+            else if (netif->flags & GNRC_NETIF_FLAGS_IEEE802154_SEC) {
+                DEBUG("_recv_ieee802154: dropping unsecured frame\n");
+                gnrc_pktbuf_release(pkt);
+                return NULL;
+            }
+#else
+            if (((uint8_t *)pkt->data)[0] & IEEE802154_FCF_SECURITY_EN) {
+                DEBUG("_recv_ieee802154: secured frames not supported\n");
+                gnrc_pktbuf_release(pkt);
+                return NULL;
+            }
+#endif
             nread -= mhr_len;
             /* mark IEEE 802.15.4 header */
             ieee802154_hdr = gnrc_pktbuf_mark(pkt, mhr_len, GNRC_NETTYPE_UNDEF);
@@ -154,6 +192,9 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             hdr->lqi = rx_info.lqi;
             hdr->rssi = rx_info.rssi;
             hdr->if_pid = thread_getpid();
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            gnrc_netif_nb_stats_rx(netif, netif_hdr);
+#endif
             dev->driver->get(dev, NETOPT_PROTO, &pkt->type, sizeof(pkt->type));
 #if ENABLE_DEBUG
             DEBUG("_recv_ieee802154: received packet from %s of length %u\n",
@@ -171,14 +212,198 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 
         DEBUG("_recv_ieee802154: reallocating.\n");
         gnrc_pktbuf_realloc_data(pkt, nread);
-    } else if (bytes_expected > 0) {
+    } else if (nread > 0) {
         DEBUG("_recv_ieee802154: received frame is too short\n");
-        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        gnrc_pktbuf_release(pkt);
+        pkt = NULL;
     }
 
     return pkt;
 }
 
+#ifdef MODULE_GNRC_NETIF_IEEE802154_BURST
+/* checks whether a frame to dst continues an acknowledged burst */
+static bool _burst_continues(gnrc_netif_t *netif, const uint8_t *dst,
+                             size_t dst_len)
+{
+    gnrc_netif_burst_t *burst = &netif->burst;
+
+    return (burst->state == GNRC_NETIF_BURST_ACKED) &&
+           (burst->dst_len == dst_len) &&
+           (memcmp(burst->dst, dst, dst_len) == 0);
+}
+
+/* lowers or restores the device's backoff for hardware CSMA/CA */
+static void _burst_set_backoff(gnrc_netif_t *netif, bool lower)
+{
+    netdev_t *dev = netif->dev;
+    gnrc_netif_burst_t *burst = &netif->burst;
+
+    if (lower && !burst->lowered) {
+        uint8_t minbe = GNRC_NETIF_BURST_MINBE;
+
+        if ((dev->driver->get(dev, NETOPT_CSMA_MINBE, &burst->minbe,
+                              sizeof(burst->minbe)) > 0) &&
+            (dev->driver->set(dev, NETOPT_CSMA_MINBE, &minbe,
+                              sizeof(minbe)) > 0)) {
+            burst->lowered = 1;
+        }
+    }
+    else if (!lower && burst->lowered) {
+        dev->driver->set(dev, NETOPT_CSMA_MINBE, &burst->minbe,
+                         sizeof(burst->minbe));
+        burst->lowered = 0;
+    }
+}
+
+/* remembers a frame announcing further frames to the same destination */
+static void _burst_update(gnrc_netif_t *netif, const uint8_t *dst,
+                          size_t dst_len, uint8_t flags, int res)
+{
+    gnrc_netif_burst_t *burst = &netif->burst;
+
+    if ((res >= 0) && (dst != ieee802154_addr_bcast) &&
+        (flags & IEEE802154_FCF_FRAME_PEND) &&
+        (flags & IEEE802154_FCF_ACK_REQ) && (dst_len <= sizeof(burst->dst))) {
+        memcpy(burst->dst, dst, dst_len);
+        burst->dst_len = dst_len;
+        burst->state = GNRC_NETIF_BURST_PENDING;
+    }
+    else {
+        burst->state = GNRC_NETIF_BURST_IDLE;
+    }
+}
+#endif
+
+#ifdef MODULE_GNRC_NETIF_IEEE802154_MHR
+static size_t _set_frame_hdr(gnrc_netif_t *netif, uint8_t *mhr,
+                             const uint8_t *src, size_t src_len,
+                             const uint8_t *dst, size_t dst_len,
+                             le_uint16_t pan, uint8_t flags, uint8_t seq)
+{
+    gnrc_netif_mhr_cache_t *cache = &netif->mhr;
+    gnrc_netif_mhr_t *entry;
+
+    for (unsigned i = 0; i < GNRC_NETIF_MHR_NUMOF; i++) {
+        entry = &cache->entries[i];
+        if ((entry->len > 0) && (entry->flags == flags) &&
+            (entry->pan.u16 == pan.u16) &&
+            (entry->dst_len == dst_len) && (entry->src_len == src_len) &&
+            (memcmp(entry->dst, dst, dst_len) == 0) &&
+            (memcmp(entry->src, src, src_len) == 0)) {
+            memcpy(mhr, entry->hdr, entry->len);
+            mhr[2] = seq;
+            return entry->len;
+        }
+    }
+
+    size_t len = ieee802154_set_frame_hdr(mhr, src, src_len, dst, dst_len,
+                                          pan, pan, flags, seq);
+
+    if ((len > 0) && (dst_len <= sizeof(entry->dst)) &&
+        (src_len <= sizeof(entry->src))) {
+        entry = &cache->entries[cache->next];
+        cache->next = (cache->next + 1) % GNRC_NETIF_MHR_NUMOF;
+        memcpy(entry->hdr, mhr, len);
+        memcpy(entry->dst, dst, dst_len);
+        memcpy(entry->src, src, src_len);
+        entry->pan = pan;
+        entry->dst_len = dst_len;
+        entry->src_len = src_len;
+        entry->flags = flags;
+        entry->len = len;
+    }
+    return len;
+}
+#else
+static inline size_t _set_frame_hdr(gnrc_netif_t *netif, uint8_t *mhr,
+                                    const uint8_t *src, size_t src_len,
+                                    const uint8_t *dst, size_t dst_len,
+                                    le_uint16_t pan, uint8_t flags,
+                                    uint8_t seq)
+{
+    (void)netif;
+    return ieee802154_set_frame_hdr(mhr, src, src_len, dst, dst_len,
+                                    pan, pan, flags, seq);
+}
+#endif
+
+#ifdef MODULE_IEEE802154_SECURITY
+static void _init(gnrc_netif_t *netif)
+{
+    ieee802154_sec_init(&netif->sec);
+}
+
+static int _get(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
+{
+    if (opt->opt == NETOPT_ENCRYPTION) {
+        assert(opt->data_len >= sizeof(netopt_enable_t));
+        *((netopt_enable_t *)opt->data) =
+            (netif->flags & GNRC_NETIF_FLAGS_IEEE802154_SEC) ? NETOPT_ENABLE
+                                                            : NETOPT_DISABLE;
+        return sizeof(netopt_enable_t);
+    }
+    return gnrc_netif_get_from_netdev(netif, opt);
+}
+
+/* adapts the fragment size announced to 6LoWPAN to the security overhead */
+static void _set_sec_overhead(gnrc_netif_t *netif, bool enable)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN
+    if (enable) {
+        netif->sixlo.max_frag_size -= IEEE802154_SEC_OVERHEAD;
+    }
+    else {
+        netif->sixlo.max_frag_size += IEEE802154_SEC_OVERHEAD;
+    }
+#elif defined(MODULE_GNRC_IPV6)
+    if (enable) {
+        netif->ipv6.mtu -= IEEE802154_SEC_OVERHEAD;
+    }
+    else {
+        netif->ipv6.mtu += IEEE802154_SEC_OVERHEAD;
+    }
+#else
+    (void)netif;
+    (void)enable;
+#endif
+}
+
+static int _set(gnrc_netif_t *netif, const gnrc_netapi_opt_t *opt)
+{
+    const uint8_t *key = opt->data;
+    uint8_t index = 1;
+    bool enable;
+    int res;
+
+    switch (opt->opt) {
+        case NETOPT_ENCRYPTION:
+            assert(opt->data_len == sizeof(netopt_enable_t));
+            enable = (*((const netopt_enable_t *)opt->data) == NETOPT_ENABLE);
+            if (enable && (netif->sec.tx_key == 0)) {
+                return -ENOENT;
+            }
+            if (enable != !!(netif->flags & GNRC_NETIF_FLAGS_IEEE802154_SEC)) {
+                _set_sec_overhead(netif, enable);
+                netif->flags ^= GNRC_NETIF_FLAGS_IEEE802154_SEC;
+            }
+            return sizeof(netopt_enable_t);
+        case NETOPT_ENCRYPTION_KEY:
+            /* either only the key for key index 1 or key index and key */
+            if (opt->data_len == (IEEE802154_SEC_KEY_LEN + 1)) {
+                index = *key++;
+            }
+            else if (opt->data_len != IEEE802154_SEC_KEY_LEN) {
+                return -EINVAL;
+            }
+            res = ieee802154_sec_set_key(&netif->sec, index, key);
+            return (res < 0) ? res : (int)opt->data_len;
+        default:
+            return gnrc_netif_set_from_netdev(netif, opt);
+    }
+}
+#endif
+
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     netdev_t *dev = netif->dev;
@@ -187,7 +412,7 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     const uint8_t *src, *dst = NULL;
     int res = 0;
     size_t src_len, dst_len;
-    uint8_t mhr[IEEE802154_MAX_HDR_LEN];
+    uint8_t mhr[MHR_LEN];
     uint8_t flags = (uint8_t)(state->flags & NETDEV_IEEE802154_SEND_MASK);
     le_uint16_t dev_pan = byteorder_btols(byteorder_htons(state->pan));
 
@@ -223,10 +448,17 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         src_len = netif->l2addr_len;
         src = netif->l2addr;
     }
+#ifdef MODULE_IEEE802154_SECURITY
+    if (netif->flags & GNRC_NETIF_FLAGS_IEEE802154_SEC) {
+        /* the CCM* nonce is built from the extended source address */
+        flags |= IEEE802154_FCF_SECURITY_EN;
+        src_len = IEEE802154_LONG_ADDRESS_LEN;
+        src = state->long_addr;
+    }
+#endif
     /* fill MAC header, seq should be set by device */
-    if ((res = ieee802154_set_frame_hdr(mhr, src, src_len,
-                                        dst, dst_len, dev_pan,
-                                        dev_pan, flags, state->seq++)) == 0) {
+    if ((res = _set_frame_hdr(netif, mhr, src, src_len, dst, dst_len,
+                              dev_pan, flags, state->seq++)) == 0) {
         DEBUG("_send_ieee802154: Error preperaring frame\n");
         return -EINVAL;
     }
@@ -238,6 +470,38 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         .iol_len = (size_t)res
     };
 
+#ifdef MODULE_IEEE802154_SECURITY
+    /* the payload is encrypted in a copy, as the packet buffer snips may be
+     * shared with other users */
+    uint8_t payload[IEEE802154_FRAME_LEN_MAX];
+    iolist_t payload_iol = { .iol_next = NULL, .iol_base = payload };
+
+    if (flags & IEEE802154_FCF_SECURITY_EN) {
+        size_t payload_len = 0;
+
+        if ((res + gnrc_pkt_len(pkt->next) + IEEE802154_SEC_OVERHEAD +
+             IEEE802154_FCS_LEN) > IEEE802154_FRAME_LEN_MAX) {
+            DEBUG("_send_ieee802154: secured frame too long\n");
+            gnrc_pktbuf_release(pkt);
+            return -EMSGSIZE;
+        }
+        for (gnrc_pktsnip_t *snip = pkt->next; snip; snip = snip->next) {
+            memcpy(&payload[payload_len], snip->data, snip->size);
+            payload_len += snip->size;
+        }
+        res = ieee802154_sec_encrypt(&netif->sec, mhr, res,
+                                     state->long_addr, payload, payload_len);
+        if (res < 0) {
+            DEBUG("_send_ieee802154: unable to secure frame (%d)\n", res);
+            gnrc_pktbuf_release(pkt);
+            return res;
+        }
+        iolist.iol_len = res;
+        iolist.iol_next = &payload_iol;
+        payload_iol.iol_len = payload_len + IEEE802154_SEC_MIC_LEN;
+    }
+#endif
+
 #ifdef MODULE_NETSTATS_L2
     if (netif_hdr->flags &
             (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
@@ -247,15 +511,38 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         netif->dev->stats.tx_unicast_count++;
     }
 #endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    gnrc_netif_nb_stats_tx(netif, pkt);
+#endif
+#ifdef MODULE_GNRC_NETIF_IEEE802154_BURST
+    bool burst = _burst_continues(netif, dst, dst_len);
+#endif
 #ifdef MODULE_GNRC_MAC
     if (netif->mac.mac_info & GNRC_NETIF_MAC_INFO_CSMA_ENABLED) {
+#ifdef MODULE_GNRC_NETIF_IEEE802154_BURST
+        /* the neighbor just acknowledged and keeps listening, a single CCA
+         * is enough unless the medium is busy */
+        res = -EBUSY;
+        if (burst) {
+            res = csma_sender_cca_send(dev, &iolist);
+        }
+        if (res == -EBUSY) {
+            res = csma_sender_csma_ca_send(dev, &iolist, &netif->mac.csma_conf);
+        }
+#else
         res = csma_sender_csma_ca_send(dev, &iolist, &netif->mac.csma_conf);
+#endif
     }
-    else {
+    else
+#endif
+    {
+#ifdef MODULE_GNRC_NETIF_IEEE802154_BURST
+        _burst_set_backoff(netif, burst);
+#endif
         res = dev->driver->send(dev, &iolist);
     }
-#else
-    res = dev->driver->send(dev, &iolist);
+#ifdef MODULE_GNRC_NETIF_IEEE802154_BURST
+    _burst_update(netif, dst, dst_len, flags, res);
 #endif
 
     /* release old data */
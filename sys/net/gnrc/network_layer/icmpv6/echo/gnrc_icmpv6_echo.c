@@ -68,6 +68,12 @@ void gnrc_icmpv6_echo_req_handle(gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
         return;
     }
 
+#ifdef MODULE_GNRC_ICMPV6_RATELIMIT
+    if ((netif != NULL) && !gnrc_icmpv6_ratelimit_take(netif->pid)) {
+        return;
+    }
+#endif
+
     pkt = gnrc_icmpv6_echo_build(ICMPV6_ECHO_REP, byteorder_ntohs(echo->id),
                                  byteorder_ntohs(echo->seq), payload,
                                  len - sizeof(icmpv6_echo_t));
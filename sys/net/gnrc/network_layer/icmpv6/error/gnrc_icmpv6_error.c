@@ -248,6 +248,22 @@ static gnrc_pktsnip_t *_check_ipv6_hdr(const gnrc_pktsnip_t *orig_pkt)
         ipv6_addr_is_multicast(&ipv6_hdr->src)) {
         ipv6 = NULL;
     }
+#ifdef MODULE_GNRC_ICMPV6_RATELIMIT
+    else {
+        /* discarding const qualifier is safe here */
+        gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type((gnrc_pktsnip_t *)orig_pkt,
+                                                         GNRC_NETTYPE_NETIF);
+        kernel_pid_t netif_pid = (netif != NULL)
+                               ? ((gnrc_netif_hdr_t *)netif->data)->if_pid
+                               : KERNEL_PID_UNDEF;
+
+        if (!gnrc_icmpv6_ratelimit_take(netif_pid)) {
+            /* check before building the message to not waste the packet
+             * buffer */
+            ipv6 = NULL;
+        }
+    }
+#endif
     return ipv6;
 }
 
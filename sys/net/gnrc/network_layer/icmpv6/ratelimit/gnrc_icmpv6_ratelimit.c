@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "irq.h"
+#include "net/gnrc/icmpv6/ratelimit.h"
+#include "net/gnrc/netif.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/* bucket for messages that are not bound to an interface */
+static gnrc_icmpv6_ratelimit_t _global = {
+    .rate = GNRC_ICMPV6_RATELIMIT_RATE,
+    .burst = GNRC_ICMPV6_RATELIMIT_BURST,
+    .tokens = GNRC_ICMPV6_RATELIMIT_BURST,
+};
+
+void gnrc_icmpv6_ratelimit_init(gnrc_icmpv6_ratelimit_t *rl, uint16_t rate,
+                                uint16_t burst)
+{
+    unsigned state = irq_disable();
+
+    rl->last = xtimer_now_usec();
+    rl->rate = rate;
+    rl->burst = burst;
+    rl->tokens = burst;
+    irq_restore(state);
+}
+
+static bool _take(gnrc_icmpv6_ratelimit_t *rl)
+{
+    uint32_t now = xtimer_now_usec();
+    uint32_t elapsed = now - rl->last;
+    uint32_t refill;
+    bool res = false;
+
+    if (rl->rate == 0) {
+        return true;
+    }
+    /* only account for whole tokens, so fractions aren't lost */
+    refill = ((uint64_t)elapsed * rl->rate) / US_PER_SEC;
+    if (refill > 0) {
+        if ((rl->tokens + refill) >= rl->burst) {
+            rl->tokens = rl->burst;
+            rl->last = now;
+        }
+        else {
+            rl->tokens += refill;
+            rl->last += ((uint64_t)refill * US_PER_SEC) / rl->rate;
+        }
+    }
+    if (rl->tokens > 0) {
+        rl->tokens--;
+        res = true;
+    }
+    return res;
+}
+
+bool gnrc_icmpv6_ratelimit_take(kernel_pid_t netif_pid)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(netif_pid);
+    gnrc_icmpv6_ratelimit_t *rl = (netif != NULL) ? &netif->ipv6.icmpv6_rl
+                                                  : &_global;
+    unsigned state = irq_disable();
+    bool res = _take(rl);
+
+    irq_restore(state);
+    if (!res) {
+        DEBUG("icmpv6_ratelimit: rate exceeded on interface %d, "
+              "dropping message\n", (int)netif_pid);
+    }
+    return res;
+}
+
+/** @} */
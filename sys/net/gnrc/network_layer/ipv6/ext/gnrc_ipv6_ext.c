@@ -24,6 +24,9 @@
 #include "net/gnrc/icmpv6/error.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/ext/rh.h"
+#ifdef MODULE_GNRC_IPV6_MPL
+#include "net/gnrc/ipv6/mpl.h"
+#endif
 
 #include "net/gnrc/ipv6/ext.h"
 
@@ -199,6 +202,39 @@ static inline bool _has_valid_size(gnrc_pktsnip_t *pkt, uint8_t protnum)
     }
 }
 
+#ifdef MODULE_GNRC_IPV6_MPL
+/**
+ * @brief   Searches the hop-by-hop options header in the first snip of @p pkt
+ *          for an MPL option and processes it
+ *
+ * @return  false, if @p pkt was released by the MPL forwarder
+ */
+static bool _process_hopopt_mpl(gnrc_pktsnip_t *pkt)
+{
+    ipv6_ext_t *ext = pkt->data;
+    uint8_t *opt = (uint8_t *)(ext + 1);
+    uint8_t *end = (uint8_t *)ipv6_ext_get_next(ext);
+
+    while (opt < end) {
+        if (*opt == IPV6_EXT_OPT_PAD1) {
+            opt++;
+            continue;
+        }
+        if (((opt + 2) > end) || ((opt + 2 + opt[1]) > end)) {
+            /* truncated option, leave it to the regular processing */
+            break;
+        }
+        if ((*opt == IPV6_EXT_OPT_MPL) &&
+            (opt[1] >= (sizeof(ipv6_ext_opt_mpl_t) - 2))) {
+            return gnrc_ipv6_mpl_process(pkt, (ipv6_ext_opt_mpl_t *)opt) ==
+                   GNRC_IPV6_MPL_DELIVER;
+        }
+        opt += 2 + opt[1];
+    }
+    return true;
+}
+#endif  /* MODULE_GNRC_IPV6_MPL */
+
 static gnrc_pktsnip_t *_demux(gnrc_pktsnip_t *pkt, unsigned protnum)
 {
     DEBUG("ipv6_ext: next header = %u\n", protnum);
@@ -256,6 +292,13 @@ static gnrc_pktsnip_t *_demux(gnrc_pktsnip_t *pkt, unsigned protnum)
 #endif  /* MODULE_GNRC_IPV6_EXT_RH */
 
         case PROTNUM_IPV6_EXT_HOPOPT:
+#ifdef MODULE_GNRC_IPV6_MPL
+            if (!_process_hopopt_mpl(pkt)) {
+                /* duplicate or only forwarded, already released */
+                return NULL;
+            }
+            /* Intentionally falls through */
+#endif  /* MODULE_GNRC_IPV6_MPL */
         case PROTNUM_IPV6_EXT_DST:
         case PROTNUM_IPV6_EXT_FRAG:
         case PROTNUM_IPV6_EXT_AH:
@@ -33,6 +33,13 @@
 #include "net/gnrc/ipv6/blacklist.h"
 
 #include "net/gnrc/ipv6.h"
+#ifdef MODULE_GNRC_PKTLAT
+#include "net/gnrc/pktlat.h"
+#endif
+#ifdef MODULE_GNRC_IPV6_RXQ
+#include "cib.h"
+#include "irq.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -69,9 +76,170 @@ static void _receive(gnrc_pktsnip_t *pkt);
  * prep_hdr: prepare header for sending (call to _fill_ipv6_hdr()), otherwise
  * assume it is already prepared */
 static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr);
+
+#ifdef MODULE_GNRC_NETAPI_BATCH
+/* Handles a packet of a GNRC_NETAPI_MSG_TYPE_SND_BATCH message */
+static inline void _send_batched(gnrc_pktsnip_t *pkt)
+{
+    _send(pkt, true);
+}
+#endif
 /* Main event loop for IPv6 */
 static void *_event_loop(void *args);
 
+#ifdef MODULE_GNRC_IPV6_RXQ
+/* one queue per interface and one for packets without interface header */
+#define _RXQ_NUMOF          (GNRC_NETIF_NUMOF + 1)
+
+typedef struct {
+    cib_t cib;
+    gnrc_pktsnip_t *pkts[GNRC_IPV6_RXQ_SIZE];
+    kernel_pid_t netif;
+    uint8_t weight;         /* 0 if the queue is unused */
+} _rxq_t;
+
+static _rxq_t _rxqs[_RXQ_NUMOF];
+/* a GNRC_IPV6_RXQ_MSG_TYPE message is on its way to the IPv6 thread */
+static bool _rxq_pending;
+
+/* must be called with interrupts disabled */
+static _rxq_t *_rxq_get(kernel_pid_t netif)
+{
+    _rxq_t *free = NULL;
+
+    for (unsigned i = 0; i < _RXQ_NUMOF; i++) {
+        if (_rxqs[i].weight == 0) {
+            if (free == NULL) {
+                free = &_rxqs[i];
+            }
+        }
+        else if (_rxqs[i].netif == netif) {
+            return &_rxqs[i];
+        }
+    }
+    if (free != NULL) {
+        cib_init(&free->cib, GNRC_IPV6_RXQ_SIZE);
+        free->netif = netif;
+        free->weight = GNRC_IPV6_RXQ_WEIGHT;
+    }
+    return free;
+}
+
+static void _rxq_notify(void)
+{
+    msg_t msg = { .type = GNRC_IPV6_RXQ_MSG_TYPE };
+    unsigned state = irq_disable();
+    bool notify = !_rxq_pending;
+    int res;
+
+    _rxq_pending = true;
+    irq_restore(state);
+    if (!notify) {
+        return;
+    }
+    res = (sched_active_pid == gnrc_ipv6_pid) ? msg_send_to_self(&msg)
+                                              : msg_try_send(&msg, gnrc_ipv6_pid);
+    if (res < 1) {
+        /* let the next packet try again */
+        DEBUG("ipv6: unable to notify IPv6 thread about input queues\n");
+        _rxq_pending = false;
+    }
+}
+
+/* called in the context of the dispatching thread */
+static void _rxq_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_pktsnip_t *netif_hdr;
+    kernel_pid_t netif = KERNEL_PID_UNDEF;
+    _rxq_t *q;
+    int idx = -1;
+
+    (void)ctx;
+    if (cmd == GNRC_NETAPI_MSG_TYPE_SND) {
+        /* sending is not queued per interface */
+        if (gnrc_netapi_send(gnrc_ipv6_pid, pkt) < 1) {
+            gnrc_pktbuf_release(pkt);
+        }
+        return;
+    }
+    netif_hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif_hdr != NULL) {
+        netif = ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid;
+    }
+
+    unsigned state = irq_disable();
+
+    q = _rxq_get(netif);
+    if (q != NULL) {
+        idx = cib_put(&q->cib);
+    }
+    if (idx >= 0) {
+        q->pkts[idx] = pkt;
+    }
+    irq_restore(state);
+    if (idx < 0) {
+        DEBUG("ipv6: input queue of interface %" PRIkernel_pid " full\n",
+              netif);
+        gnrc_pktbuf_release_error(pkt, ENOBUFS);
+        return;
+    }
+    _rxq_notify();
+}
+
+/* one weighted round-robin turn over all input queues */
+static void _rxq_drain(void)
+{
+    bool more = false;
+    unsigned state = irq_disable();
+
+    _rxq_pending = false;
+    irq_restore(state);
+    for (unsigned i = 0; i < _RXQ_NUMOF; i++) {
+        _rxq_t *q = &_rxqs[i];
+
+        for (unsigned n = 0; n < q->weight; n++) {
+            gnrc_pktsnip_t *pkt = NULL;
+
+            state = irq_disable();
+            int idx = cib_get(&q->cib);
+            if (idx >= 0) {
+                pkt = q->pkts[idx];
+            }
+            irq_restore(state);
+            if (pkt == NULL) {
+                break;
+            }
+#ifdef MODULE_GNRC_PKTLAT
+            gnrc_pktlat_record(GNRC_PKTLAT_IPV6, GNRC_PKTLAT_RX, pkt->stamp,
+                               cib_avail(&q->cib));
+#endif
+            _receive(pkt);
+        }
+        if ((q->weight > 0) && (cib_avail(&q->cib) > 0)) {
+            more = true;
+        }
+    }
+    if (more) {
+        /* go through the message queue first, so other messages for the
+         * IPv6 thread are not delayed by a busy interface */
+        _rxq_notify();
+    }
+}
+
+int gnrc_ipv6_rxq_set_weight(kernel_pid_t netif_pid, unsigned weight)
+{
+    unsigned state = irq_disable();
+    _rxq_t *q = _rxq_get(netif_pid);
+
+    if (q != NULL) {
+        q->weight = (weight == 0) ? 1 : (weight > UINT8_MAX) ? UINT8_MAX
+                                                             : weight;
+    }
+    irq_restore(state);
+    return (q != NULL) ? 0 : -ENOMEM;
+}
+#endif /* MODULE_GNRC_IPV6_RXQ */
+
 kernel_pid_t gnrc_ipv6_init(void)
 {
     if (gnrc_ipv6_pid == KERNEL_PID_UNDEF) {
@@ -165,13 +333,24 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#if defined(MODULE_GNRC_IPV6_RXQ)
+    static gnrc_netreg_entry_cbd_t rxq_cbd = { .cb = _rxq_cb };
+    gnrc_netreg_entry_t me_reg;
+#elif defined(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              sched_active_pid);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
 
     /* register interest in all IPv6 packets */
+#ifdef MODULE_GNRC_IPV6_RXQ
+    gnrc_netreg_entry_init_cb(&me_reg, GNRC_NETREG_DEMUX_CTX_ALL, &rxq_cbd);
+#endif
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
 
     /* preinitialize ACK */
@@ -181,6 +360,9 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
+#ifdef MODULE_GNRC_PKTLAT
+        gnrc_pktlat_record_msg(GNRC_PKTLAT_IPV6, &msg);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -193,6 +375,25 @@ static void *_event_loop(void *args)
                 _send(msg.content.ptr, true);
                 break;
 
+#ifdef MODULE_GNRC_IPV6_RXQ
+            case GNRC_IPV6_RXQ_MSG_TYPE:
+                DEBUG("ipv6: GNRC_IPV6_RXQ_MSG_TYPE received\n");
+                _rxq_drain();
+                break;
+#endif
+
+#ifdef MODULE_GNRC_NETAPI_BATCH
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                gnrc_netapi_batch_drain(msg.content.ptr, _receive);
+                break;
+
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+                gnrc_netapi_batch_drain(msg.content.ptr, _send_batched);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_GET:
             case GNRC_NETAPI_MSG_TYPE_SET:
                 DEBUG("ipv6: reply to unsupported get/set\n");
@@ -452,32 +653,34 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
 #if GNRC_NETIF_NUMOF > 1
     /* interface not given: send over all interfaces */
     if (netif == NULL) {
-        /* send packet to link layer */
+        /* send packet to link layer: every interface holds a reference to
+         * all snips, so the payload is shared and never copied */
         gnrc_pktbuf_hold(pkt, ifnum - 1);
 
         while ((netif = gnrc_netif_iter(netif))) {
+            gnrc_pktsnip_t *tmp = pkt;
+
             if (prep_hdr) {
                 DEBUG("ipv6: prepare IPv6 header for sending\n");
                 /* need to get second write access (duplication) to fill IPv6
-                 * header interface-local */
-                gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(pkt);
+                 * header interface-local; gnrc_pktbuf_start_write() only
+                 * duplicates the IPv6 header snip while it is shared */
+                tmp = gnrc_pktbuf_start_write(pkt);
 
                 if (tmp == NULL) {
                     DEBUG("ipv6: unable to get write access to IPv6 header, "
                           "for interface %" PRIkernel_pid "\n", netif->pid);
+                    /* drop this interface's reference */
                     gnrc_pktbuf_release(pkt);
-                    return;
+                    continue;
                 }
                 if (_fill_ipv6_hdr(netif, tmp) < 0) {
                     /* error on filling up header */
-                    if (tmp != pkt) {
-                        gnrc_pktbuf_release(tmp);
-                    }
-                    gnrc_pktbuf_release(pkt);
-                    return;
+                    gnrc_pktbuf_release(tmp);
+                    continue;
                 }
             }
-            _send_multicast_over_iface(pkt, netif, netif_hdr_flags);
+            _send_multicast_over_iface(tmp, netif, netif_hdr_flags);
         }
     }
     else {
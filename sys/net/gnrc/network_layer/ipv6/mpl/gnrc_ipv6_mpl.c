@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "trickle.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+
+#include "net/gnrc/ipv6/mpl.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/**
+ * @brief   Entry of the seed set
+ */
+typedef struct {
+    uint8_t id[IPV6_EXT_OPT_MPL_SEED_ID_MAX];   /**< seed ID */
+    uint8_t id_len;         /**< length of the seed ID, 0 if unused */
+    uint8_t min_seq;        /**< sequence number of bit 0 in window */
+    uint32_t window;        /**< bit i is set if min_seq + i was received */
+    uint32_t heard;         /**< time stamp for replacement */
+} _seed_t;
+
+/**
+ * @brief   Entry of the buffered message set
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;    /**< message in send order, NULL if unused */
+    trickle_t trickle;      /**< Trickle timer of the message */
+    uint8_t id[IPV6_EXT_OPT_MPL_SEED_ID_MAX];   /**< seed ID */
+    uint8_t id_len;         /**< length of the seed ID */
+    uint8_t seq;            /**< sequence number */
+    uint8_t expirations;    /**< Trickle intervals expired so far */
+} _buffered_t;
+
+static char _stack[GNRC_IPV6_MPL_STACK_SIZE];
+static msg_t _msg_q[GNRC_IPV6_MPL_MSG_QUEUE_SIZE];
+static _seed_t _seeds[GNRC_IPV6_MPL_SEED_SET_SIZE];
+static _buffered_t _buffered[GNRC_IPV6_MPL_BUFFER_SIZE];
+static uint32_t _heard;
+/* the seed set is accessed by the IPv6 thread, the buffered messages by
+ * both threads */
+static mutex_t _lock = MUTEX_INIT;
+
+kernel_pid_t gnrc_ipv6_mpl_pid = KERNEL_PID_UNDEF;
+
+static void *_event_loop(void *args);
+
+kernel_pid_t gnrc_ipv6_mpl_init(void)
+{
+    static const ipv6_addr_t all_mpl_forwarders =
+        IPV6_ADDR_ALL_MPL_FORWARDERS_REALM_LOCAL;
+
+    if (gnrc_ipv6_mpl_pid == KERNEL_PID_UNDEF) {
+        gnrc_ipv6_mpl_pid = thread_create(_stack, sizeof(_stack),
+                                          GNRC_IPV6_MPL_PRIO,
+                                          THREAD_CREATE_STACKTEST,
+                                          _event_loop, NULL, "mpl");
+        if (gnrc_ipv6_mpl_pid == KERNEL_PID_UNDEF) {
+            DEBUG("mpl: could not start the event loop\n");
+            return KERNEL_PID_UNDEF;
+        }
+    }
+
+    gnrc_netif_t *netif = NULL;
+    while ((netif = gnrc_netif_iter(netif))) {
+        gnrc_netif_ipv6_group_join_internal(netif, &all_mpl_forwarders);
+    }
+    return gnrc_ipv6_mpl_pid;
+}
+
+static _seed_t *_seed_get(const uint8_t *id, unsigned id_len)
+{
+    _seed_t *oldest = &_seeds[0];
+
+    for (unsigned i = 0; i < GNRC_IPV6_MPL_SEED_SET_SIZE; i++) {
+        _seed_t *seed = &_seeds[i];
+
+        if ((seed->id_len == id_len) && (memcmp(seed->id, id, id_len) == 0)) {
+            seed->heard = ++_heard;
+            return seed;
+        }
+        if ((seed->id_len == 0) ||
+            ((oldest->id_len != 0) &&
+             ((int32_t)(seed->heard - oldest->heard) < 0))) {
+            oldest = seed;
+        }
+    }
+    DEBUG("mpl: new seed (%u byte ID)\n", id_len);
+    memcpy(oldest->id, id, id_len);
+    oldest->id_len = id_len;
+    oldest->min_seq = 0;
+    oldest->window = 0;
+    oldest->heard = ++_heard;
+    return oldest;
+}
+
+/* returns true if seq was not received from seed before */
+static bool _seed_accept(_seed_t *seed, uint8_t seq)
+{
+    uint8_t diff = seq - seed->min_seq;
+
+    if (seed->window == 0) {
+        /* first message of this seed */
+        seed->min_seq = seq;
+        seed->window = 1;
+        return true;
+    }
+    if (diff >= 0x80) {
+        /* older than the window, see RFC 1982 for the comparison */
+        return false;
+    }
+    if (diff >= GNRC_IPV6_MPL_SEED_WINDOW) {
+        /* slide the window, so seq becomes its newest entry */
+        uint8_t shift = diff - (GNRC_IPV6_MPL_SEED_WINDOW - 1);
+
+        seed->window = (shift < GNRC_IPV6_MPL_SEED_WINDOW)
+                     ? (seed->window >> shift) : 0;
+        seed->min_seq += shift;
+        diff -= shift;
+    }
+    if (seed->window & (1UL << diff)) {
+        return false;
+    }
+    seed->window |= (1UL << diff);
+    return true;
+}
+
+static _buffered_t *_buffered_find(const uint8_t *id, unsigned id_len,
+                                   uint8_t seq)
+{
+    for (unsigned i = 0; i < GNRC_IPV6_MPL_BUFFER_SIZE; i++) {
+        _buffered_t *buf = &_buffered[i];
+
+        if ((buf->pkt != NULL) && (buf->seq == seq) &&
+            (buf->id_len == id_len) && (memcmp(buf->id, id, id_len) == 0)) {
+            return buf;
+        }
+    }
+    return NULL;
+}
+
+static void _buffered_free(_buffered_t *buf)
+{
+    trickle_stop(&buf->trickle);
+    gnrc_pktbuf_release(buf->pkt);
+    buf->pkt = NULL;
+}
+
+static void _transmit(void *arg)
+{
+    _buffered_t *buf = arg;
+
+    DEBUG("mpl: retransmit message %u\n", buf->seq);
+    /* keep the buffered copy, the IPv6 thread duplicates on write */
+    gnrc_pktbuf_hold(buf->pkt, 1);
+    if (gnrc_netapi_send(gnrc_ipv6_pid, buf->pkt) < 1) {
+        DEBUG("mpl: unable to send message\n");
+        gnrc_pktbuf_release(buf->pkt);
+    }
+}
+
+static void _buffered_add(gnrc_pktsnip_t *pkt, const uint8_t *id,
+                          unsigned id_len, uint8_t seq)
+{
+    _buffered_t *buf = NULL;
+
+    /* take a free entry or the one closest to expiration */
+    for (unsigned i = 0; i < GNRC_IPV6_MPL_BUFFER_SIZE; i++) {
+        if (_buffered[i].pkt == NULL) {
+            buf = &_buffered[i];
+            break;
+        }
+        if ((buf == NULL) || (_buffered[i].expirations > buf->expirations)) {
+            buf = &_buffered[i];
+        }
+    }
+    if (buf->pkt != NULL) {
+        DEBUG("mpl: buffer full, drop message %u\n", buf->seq);
+        _buffered_free(buf);
+    }
+
+    /* copy the packet into send order: IPv6 header followed by the hop-by-hop
+     * options header and all of the payload */
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, pkt->data, pkt->size,
+                                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        DEBUG("mpl: unable to buffer message\n");
+        return;
+    }
+    gnrc_pktsnip_t *ipv6 = gnrc_pktbuf_add(payload, pkt->next->data,
+                                           sizeof(ipv6_hdr_t),
+                                           GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        DEBUG("mpl: unable to buffer message\n");
+        gnrc_pktbuf_release(payload);
+        return;
+    }
+    ((ipv6_hdr_t *)ipv6->data)->hl--;
+
+    buf->pkt = ipv6;
+    memcpy(buf->id, id, id_len);
+    buf->id_len = id_len;
+    buf->seq = seq;
+    buf->expirations = 0;
+    buf->trickle.callback.func = _transmit;
+    buf->trickle.callback.args = buf;
+    trickle_start(gnrc_ipv6_mpl_pid, &buf->trickle,
+                  GNRC_IPV6_MPL_MSG_TYPE_TRICKLE, GNRC_IPV6_MPL_DATA_IMIN,
+                  GNRC_IPV6_MPL_DATA_IMAX, GNRC_IPV6_MPL_DATA_K);
+}
+
+int gnrc_ipv6_mpl_process(gnrc_pktsnip_t *pkt, const ipv6_ext_opt_mpl_t *opt)
+{
+    ipv6_hdr_t *hdr = pkt->next->data;
+    const uint8_t *id = (const uint8_t *)(opt + 1);
+    unsigned id_len = ipv6_ext_opt_mpl_seed_id_len(opt);
+
+    if (!ipv6_addr_is_multicast(&hdr->dst)) {
+        return GNRC_IPV6_MPL_DELIVER;
+    }
+    if ((opt->flags & IPV6_EXT_OPT_MPL_FLAG_V) ||
+        (opt->len < (sizeof(*opt) - 2 + id_len))) {
+        DEBUG("mpl: invalid MPL option\n");
+        gnrc_pktbuf_release(pkt);
+        return GNRC_IPV6_MPL_CONSUMED;
+    }
+    if (id_len == 0) {
+        /* seed ID is the IPv6 source address */
+        id = hdr->src.u8;
+        id_len = sizeof(hdr->src);
+    }
+
+    mutex_lock(&_lock);
+    if (!_seed_accept(_seed_get(id, id_len), opt->seq)) {
+        _buffered_t *buf = _buffered_find(id, id_len, opt->seq);
+
+        DEBUG("mpl: drop duplicate message %u\n", opt->seq);
+        if (buf != NULL) {
+            /* a neighbor transmitted the message consistently */
+            trickle_increment_counter(&buf->trickle);
+        }
+        mutex_unlock(&_lock);
+        gnrc_pktbuf_release(pkt);
+        return GNRC_IPV6_MPL_CONSUMED;
+    }
+    if ((gnrc_ipv6_mpl_pid != KERNEL_PID_UNDEF) && (hdr->hl > 1)) {
+        _buffered_add(pkt, id, id_len, opt->seq);
+    }
+    mutex_unlock(&_lock);
+
+    if (gnrc_netif_get_by_ipv6_addr(&hdr->dst) == NULL) {
+        /* not subscribed, only forwarded by MPL */
+        gnrc_pktbuf_release(pkt);
+        return GNRC_IPV6_MPL_CONSUMED;
+    }
+    return GNRC_IPV6_MPL_DELIVER;
+}
+
+static void *_event_loop(void *args)
+{
+    msg_t msg;
+
+    (void)args;
+    msg_init_queue(_msg_q, GNRC_IPV6_MPL_MSG_QUEUE_SIZE);
+
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_IPV6_MPL_MSG_TYPE_TRICKLE: {
+                _buffered_t *buf = container_of(msg.content.ptr, _buffered_t,
+                                                trickle);
+
+                mutex_lock(&_lock);
+                /* message might have been dropped in the meantime */
+                if (buf->pkt != NULL) {
+                    trickle_callback(&buf->trickle);
+                    if (++buf->expirations >= GNRC_IPV6_MPL_DATA_EXPIRATIONS) {
+                        DEBUG("mpl: message %u expired\n", buf->seq);
+                        _buffered_free(buf);
+                    }
+                }
+                mutex_unlock(&_lock);
+                break;
+            }
+            default:
+                DEBUG("mpl: unexpected message type 0x%04x\n", msg.type);
+                break;
+        }
+    }
+    return NULL;
+}
+
+/** @} */
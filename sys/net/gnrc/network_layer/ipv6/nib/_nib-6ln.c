@@ -16,6 +16,7 @@
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ndp.h"
+#include "random.h"
 
 #include "_nib-6ln.h"
 #include "_nib-6lr.h"
@@ -98,6 +99,12 @@ uint8_t _handle_aro(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                      * before timeout */
                     rereg_time = (ltime == 1U) ? (30 * MS_PER_SEC) :
                                  (ltime - 1U) * SEC_PER_MIN * MS_PER_SEC;
+                    /* spread re-registrations of nodes that registered at
+                     * the same time */
+                    rereg_time -= random_uint32_range(0,
+                        ((rereg_time / 2) < GNRC_IPV6_NIB_CONF_REREG_JITTER)
+                        ? (rereg_time / 2) + 1
+                        : GNRC_IPV6_NIB_CONF_REREG_JITTER + 1);
                     DEBUG("nib: Address registration of %s successful. "
                           "Scheduling re-registration in %" PRIu32 "ms\n",
                           ipv6_addr_to_str(addr_str, &ipv6->dst,
@@ -169,7 +176,30 @@ static inline bool _is_valid(const gnrc_netif_t *netif, int idx)
             GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID);
 }
 
+static void _rereg_address(const ipv6_addr_t *addr, bool group);
+
+/* re-registers the other addresses of netif that are due soon along with
+ * addr, so their exchanges with the router happen in one go */
+static void _rereg_due_addrs(gnrc_netif_t *netif, const ipv6_addr_t *addr)
+{
+    for (int i = 0; i < GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
+        ipv6_addr_t *other = &netif->ipv6.addrs[i];
+
+        if (_is_valid(netif, i) && !ipv6_addr_equal(other, addr) &&
+            (_evtimer_lookup(other, GNRC_IPV6_NIB_REREG_ADDRESS) <=
+             GNRC_IPV6_NIB_CONF_REREG_JITTER)) {
+            evtimer_del(&_nib_evtimer, &netif->ipv6.addrs_timers[i].event);
+            _rereg_address(other, false);
+        }
+    }
+}
+
 void _handle_rereg_address(const ipv6_addr_t *addr)
+{
+    _rereg_address(addr, true);
+}
+
+static void _rereg_address(const ipv6_addr_t *addr, bool group)
 {
     gnrc_netif_t *netif = gnrc_netif_get_by_ipv6_addr(addr);
     _nib_dr_entry_t *router = _nib_drl_get_dr();
@@ -184,6 +214,9 @@ void _handle_rereg_address(const ipv6_addr_t *addr)
               ipv6_addr_to_str(addr_str, &router->next_hop->ipv6,
                                sizeof(addr_str)));
         _snd_ns(&router->next_hop->ipv6, netif, addr, &router->next_hop->ipv6);
+        if (group) {
+            _rereg_due_addrs(netif, addr);
+        }
     }
     else {
         DEBUG("nib: Couldn't re-register %s, no current router found or address "
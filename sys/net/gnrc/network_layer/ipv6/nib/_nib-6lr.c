@@ -16,6 +16,9 @@
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/sixlowpan/nd.h"
+#if GNRC_IPV6_NIB_CONF_6LR_AR_RATE
+#include "xtimer.h"
+#endif
 
 #include "_nib-6lr.h"
 
@@ -89,6 +92,35 @@ uint8_t _reg_addr_upstream(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
     return _ADDR_REG_STATUS_IGNORE;
 }
 
+#if GNRC_IPV6_NIB_CONF_6LR_AR_RATE
+bool _ar_rate_limited(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
+                      const sixlowpan_nd_opt_ar_t *aro)
+{
+    static uint32_t window_start;
+    static unsigned count;
+    _nib_onl_entry_t *nce = _nib_onl_get(&ipv6->src, netif->pid);
+    uint32_t now = xtimer_now_usec();
+
+    if ((nce != NULL) && (nce->mode & _NC) &&
+        (_get_ar_state(nce) == GNRC_IPV6_NIB_NC_INFO_AR_STATE_REGISTERED) &&
+        (memcmp(&nce->eui64, &aro->eui64, sizeof(aro->eui64)) == 0)) {
+        /* refreshes keep existing registrations alive */
+        return false;
+    }
+    if ((now - window_start) >= US_PER_SEC) {
+        window_start = now;
+        count = 0;
+    }
+    if (count >= GNRC_IPV6_NIB_CONF_6LR_AR_RATE) {
+        DEBUG("nib: Too many address registrations, dropping NS from %s\n",
+              ipv6_addr_to_str(addr_str, &ipv6->src, sizeof(addr_str)));
+        return true;
+    }
+    count++;
+    return false;
+}
+#endif  /* GNRC_IPV6_NIB_CONF_6LR_AR_RATE */
+
 gnrc_pktsnip_t *_copy_and_handle_aro(gnrc_netif_t *netif,
                                      const ipv6_hdr_t *ipv6,
                                      const ndp_nbr_sol_t *nbr_sol,
@@ -117,6 +117,26 @@ gnrc_pktsnip_t *_copy_and_handle_aro(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6
                                      const sixlowpan_nd_opt_ar_t *aro,
                                      const ndp_opt_t *sl2ao);
 
+#if GNRC_IPV6_NIB_CONF_6LR_AR_RATE || defined(DOXYGEN)
+/**
+ * @brief   Checks if a neighbor solicitation with an ARO exceeds the rate of
+ *          new address registrations
+ *
+ * @see @ref GNRC_IPV6_NIB_CONF_6LR_AR_RATE
+ *
+ * @param[in] netif     The interface the ARO-carrying NS came over.
+ * @param[in] ipv6      The IPv6 header of the NS.
+ * @param[in] aro       The ARO of the NS.
+ *
+ * @return  true, if the NS should be dropped.
+ * @return  false, if the NS should be processed.
+ */
+bool _ar_rate_limited(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
+                      const sixlowpan_nd_opt_ar_t *aro);
+#else   /* GNRC_IPV6_NIB_CONF_6LR_AR_RATE || defined(DOXYGEN) */
+#define _ar_rate_limited(netif, ipv6, aro)  (false)
+#endif  /* GNRC_IPV6_NIB_CONF_6LR_AR_RATE || defined(DOXYGEN) */
+
 /**
  * @brief   Sets the @ref GNRC_NETIF_FLAGS_IPV6_RTR_ADV flags of an interface
  *
@@ -132,6 +152,7 @@ void _set_rtr_adv(gnrc_netif_t *netif);
  */
 #define _copy_and_handle_aro(netif, ipv6, icmpv6, aro, sl2ao) \
                                         (NULL)
+#define _ar_rate_limited(netif, ipv6, aro)  (false)
 #define _set_rtr_adv(netif)             (void)netif
 #endif  /* GNRC_IPV6_NIB_CONF_6LR || defined(DOXYGEN) */
 
@@ -26,6 +26,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-lpm.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG    (0)
@@ -36,6 +37,15 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[GNRC_IPV6_NIB_NUMOF];
+/* on-link entries are stamped with this counter on use for LRU replacement */
+static uint32_t _nodes_last_used[GNRC_IPV6_NIB_NUMOF];
+static uint32_t _nodes_use_counter;
+#if GNRC_IPV6_NIB_ONL_HASH_NUMOF
+static _nib_onl_entry_t *_nodes_hash[GNRC_IPV6_NIB_ONL_HASH_NUMOF];
+/* bucket chains are kept out of _nib_onl_entry_t so clearing an entry does
+ * not break them */
+static _nib_onl_entry_t *_nodes_hash_next[GNRC_IPV6_NIB_NUMOF];
+#endif  /* GNRC_IPV6_NIB_ONL_HASH_NUMOF */
 static _nib_offl_entry_t _dsts[GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
@@ -51,6 +61,20 @@ evtimer_msg_t _nib_evtimer;
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
+#if GNRC_IPV6_NIB_ONL_HASH_NUMOF
+static void _onl_index(_nib_onl_entry_t *node);
+static void _onl_unindex(_nib_onl_entry_t *node);
+#else   /* GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+#define _onl_index(node)    (void)node
+#define _onl_unindex(node)  (void)node
+#endif  /* GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+#if GNRC_IPV6_NIB_CONF_FT_LPM
+static void _lpm_add(_nib_offl_entry_t *dst);
+static void _lpm_remove(_nib_offl_entry_t *dst);
+#else   /* GNRC_IPV6_NIB_CONF_FT_LPM */
+#define _lpm_add(dst)       (void)dst
+#define _lpm_remove(dst)    (void)dst
+#endif  /* GNRC_IPV6_NIB_CONF_FT_LPM */
 
 void _nib_init(void)
 {
@@ -58,16 +82,80 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+    memset(_nodes_last_used, 0, sizeof(_nodes_last_used));
+    _nodes_use_counter = 0;
+#if GNRC_IPV6_NIB_ONL_HASH_NUMOF
+    memset(_nodes_hash, 0, sizeof(_nodes_hash));
+    memset(_nodes_hash_next, 0, sizeof(_nodes_hash_next));
+#endif  /* GNRC_IPV6_NIB_ONL_HASH_NUMOF */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* GNRC_IPV6_NIB_CONF_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+#if GNRC_IPV6_NIB_CONF_FT_LPM
+    _nib_lpm_init();
+#endif  /* GNRC_IPV6_NIB_CONF_FT_LPM */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
 
+static inline void _onl_touch(const _nib_onl_entry_t *node)
+{
+    _nodes_last_used[node - _nodes] = ++_nodes_use_counter;
+}
+
+/* checks if a was used less recently than b */
+static inline bool _onl_lru(const _nib_onl_entry_t *a,
+                            const _nib_onl_entry_t *b)
+{
+    /* difference to the counter survives counter overflows */
+    return (_nodes_use_counter - _nodes_last_used[a - _nodes]) >
+           (_nodes_use_counter - _nodes_last_used[b - _nodes]);
+}
+
+#if GNRC_IPV6_NIB_ONL_HASH_NUMOF
+static inline unsigned _onl_hash(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    hash ^= (hash >> 16);
+    hash ^= (hash >> 8);
+    return hash % GNRC_IPV6_NIB_ONL_HASH_NUMOF;
+}
+
+static void _onl_index(_nib_onl_entry_t *node)
+{
+    _nib_onl_entry_t **ptr = &_nodes_hash[_onl_hash(&node->ipv6)];
+
+    /* keep buckets sorted by position in _nodes, so look-ups find the same
+     * entry a linear search would */
+    while ((*ptr != NULL) && (*ptr < node)) {
+        ptr = &_nodes_hash_next[*ptr - _nodes];
+    }
+    if (*ptr != node) {
+        _nodes_hash_next[node - _nodes] = *ptr;
+        *ptr = node;
+    }
+}
+
+static void _onl_unindex(_nib_onl_entry_t *node)
+{
+    _nib_onl_entry_t **ptr = &_nodes_hash[_onl_hash(&node->ipv6)];
+
+    while (*ptr != NULL) {
+        if (*ptr == node) {
+            *ptr = _nodes_hash_next[node - _nodes];
+            _nodes_hash_next[node - _nodes] = NULL;
+            return;
+        }
+        ptr = &_nodes_hash_next[*ptr - _nodes];
+    }
+}
+#endif  /* GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+
 static inline bool _addr_equals(const ipv6_addr_t *addr,
                                 const _nib_onl_entry_t *node)
 {
@@ -118,41 +206,45 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
                                                      unsigned iface,
                                                      uint16_t cstate)
 {
-    /* Use clist as FIFO for caching */
-    _nib_onl_entry_t *first = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
-    _nib_onl_entry_t *tmp = first, *res = NULL;
+    clist_node_t *ptr = _next_removable.next;
+    _nib_onl_entry_t *res = NULL;
 
     DEBUG("nib: Searching for replaceable entries (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
-    if (tmp == NULL) {
+    if (ptr == NULL) {
         return NULL;
     }
+    /* _next_removable is used as FIFO: replace the oldest garbage-collectible
+     * entry, unless some of them are unreachable. Of those replace the least
+     * recently used one */
     do {
-        if (_is_gc(tmp)) {
-            DEBUG("nib: Removing neighbor cache entry (addr = %s, "
-                  "iface = %u) ",
-                  ipv6_addr_to_str(addr_str, &tmp->ipv6,
-                                   sizeof(addr_str)),
-                  _nib_onl_get_if(tmp));
-            DEBUG("for (addr = %s, iface = %u)\n",
-                  ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)),
-                  iface);
-            /* call _nib_nc_remove to remove timers from _evtimer */
-            _nib_nc_remove(tmp);
+        _nib_onl_entry_t *tmp = (_nib_onl_entry_t *)(ptr = ptr->next);
+
+        if (_is_gc(tmp) &&
+            ((res == NULL) ||
+             (_node_unreachable(tmp) &&
+              (!_node_unreachable(res) || _onl_lru(tmp, res))))) {
             res = tmp;
-            _override_node(addr, iface, res);
-            /* cstate masked in _nib_nc_add() already */
-            res->info |= cstate;
-            res->mode = _NC;
-        }
-        /* requeue if not garbage collectible at the moment or queueing
-         * newly created NCE */
-        clist_rpush(&_next_removable, (clist_node_t *)tmp);
-        if (res == NULL) {
-            /* no new entry created yet, get next entry in FIFO */
-            tmp = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
-        }
-    } while ((tmp != first) && (res != NULL));
+        }
+    } while (ptr != _next_removable.next);
+    if (res != NULL) {
+        DEBUG("nib: Removing neighbor cache entry (addr = %s, iface = %u) ",
+              ipv6_addr_to_str(addr_str, &res->ipv6, sizeof(addr_str)),
+              _nib_onl_get_if(res));
+        DEBUG("for (addr = %s, iface = %u)\n",
+              ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+        clist_remove(&_next_removable, (clist_node_t *)res);
+        res->next = NULL;
+        /* call _nib_nc_remove to remove timers from _evtimer */
+        _nib_nc_remove(res);
+        _override_node(addr, iface, res);
+        /* cstate masked in _nib_nc_add() already */
+        res->info |= cstate;
+        res->mode = _NC;
+        /* queue newly created NCE */
+        clist_rpush(&_next_removable, (clist_node_t *)res);
+        _onl_touch(res);
+    }
     return res;
 }
 
@@ -182,6 +274,7 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
         /* add to next removable list, if not already in it */
         clist_rpush(&_next_removable, (clist_node_t *)node);
     }
+    _onl_touch(node);
     return node;
 }
 
@@ -199,21 +292,46 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+bool _nib_onl_clear(_nib_onl_entry_t *node)
+{
+    if (node->mode == _EMPTY) {
+        _onl_unindex(node);
+        if (node->next != NULL) {
+            /* entry is about to be zeroed => dequeue it */
+            clist_remove(&_next_removable, (clist_node_t *)node);
+        }
+        memset(node, 0, sizeof(_nib_onl_entry_t));
+        return true;
+    }
+    return false;
+}
+
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
-    for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
-        _nib_onl_entry_t *node = &_nodes[i];
-
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
+#if GNRC_IPV6_NIB_ONL_HASH_NUMOF
+    for (_nib_onl_entry_t *node = _nodes_hash[_onl_hash(addr)];
+         node != NULL; node = _nodes_hash_next[node - _nodes]) {
+#else   /* GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+    for (_nib_onl_entry_t *node = _nodes; node < (_nodes + GNRC_IPV6_NIB_NUMOF);
+         node++) {
+#endif  /* GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+        if (_onl_matches(node, addr, iface)) {
             DEBUG("  Found %p\n", (void *)node);
+            _onl_touch(node);
             return node;
         }
     }
@@ -474,7 +592,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+                _onl_unindex(tmp_node);
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _onl_index(tmp_node);
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -495,6 +615,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _lpm_add(dst);
     }
     return dst;
 }
@@ -526,6 +647,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _lpm_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -549,13 +671,53 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if GNRC_IPV6_NIB_CONF_FT_LPM
+static void _lpm_add(_nib_offl_entry_t *dst)
+{
+    _nib_offl_entry_t *cur = _nib_lpm_get(&dst->pfx, dst->pfx_len);
+
+    /* if multiple entries share a prefix, the first one in _dsts represents
+     * it (like in a linear search) */
+    if ((cur == NULL) || (dst < cur)) {
+        int res = _nib_lpm_set(&dst->pfx, dst->pfx_len, dst);
+
+        /* trie has room for GNRC_IPV6_NIB_OFFL_NUMOF distinct prefixes */
+        assert(res == 0);
+        (void)res;
+    }
+}
+
+static void _lpm_remove(_nib_offl_entry_t *dst)
+{
+    if (_nib_lpm_get(&dst->pfx, dst->pfx_len) != dst) {
+        return;
+    }
+    /* hand prefix over to next entry sharing it, if there is one */
+    for (_nib_offl_entry_t *ptr = dst + 1; _in_dsts(ptr); ptr++) {
+        if ((ptr->next_hop != NULL) && (ptr->pfx_len == dst->pfx_len) &&
+            (ipv6_addr_match_prefix(&ptr->pfx, &dst->pfx) >= dst->pfx_len)) {
+            _nib_lpm_set(&dst->pfx, dst->pfx_len, ptr);
+            return;
+        }
+    }
+    _nib_lpm_remove(&dst->pfx, dst->pfx_len);
+}
+#endif  /* GNRC_IPV6_NIB_CONF_FT_LPM */
+
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if GNRC_IPV6_NIB_CONF_FT_LPM
+    res = _nib_lpm_match(dst);
+    if ((res != NULL) && (res->mode == _EMPTY)) {
+        res = NULL;
+    }
+#else   /* GNRC_IPV6_NIB_CONF_FT_LPM */
+    uint8_t best_match = 0;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -575,6 +737,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
             }
         }
     }
+#endif  /* GNRC_IPV6_NIB_CONF_FT_LPM */
     return res;
 }
 
@@ -801,11 +964,13 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
+    _onl_unindex(node);
     _nib_onl_clear(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+    _onl_index(node);
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -822,19 +987,24 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
 
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
-    evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
-    uint32_t offset = 0;
+    evtimer_event_t *ptr = NULL;
+    uint32_t offset = UINT32_MAX;
 
     DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
-    while (event != NULL) {
-        offset += event->event.offset;
+    /* events are iterated in no particular order, so look at all matches */
+    while ((ptr = evtimer_iter(&_nib_evtimer, ptr))) {
+        evtimer_msg_event_t *event = (evtimer_msg_event_t *)ptr;
+
         if ((event->msg.type == type) &&
             ((ctx == NULL) || (event->msg.content.ptr == ctx))) {
-            return offset;
+            uint32_t remaining = evtimer_remaining(&_nib_evtimer, ptr);
+
+            if (remaining < offset) {
+                offset = remaining;
+            }
         }
-        event = (evtimer_msg_event_t *)event->event.next;
     }
-    return UINT32_MAX;
+    return offset;
 }
 
 /** @} */
@@ -312,14 +312,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
  * @return  true, if entry was cleared.
  * @return  false, if entry was not cleared.
  */
-static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
-{
-    if (node->mode == _EMPTY) {
-        memset(node, 0, sizeof(_nib_onl_entry_t));
-        return true;
-    }
-    return false;
-}
+bool _nib_onl_clear(_nib_onl_entry_t *node);
 
 /**
  * @brief   Iterates over on-link entries
@@ -792,7 +785,7 @@ int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *ctx,
  * @param[in] ctx   Context of the event. May be NULL for any event context.
  * @param[in] type  [Type of the event](@ref net_gnrc_ipv6_nib_msg).
  *
- * @return  Milliseconds to the event, if event in queue.
+ * @return  Milliseconds to the earliest matching event, if event in queue.
  * @return  UINT32_MAX, event is not in queue.
  */
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type);
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "_nib-lpm.h"
+
+#if GNRC_IPV6_NIB_CONF_FT_LPM
+typedef struct _lpm_node {
+    struct _lpm_node *child[2]; /**< sub-tries for next bit 0 and 1 */
+    void *val;                  /**< value for _lpm_node::pfx, may be NULL */
+    ipv6_addr_t pfx;            /**< prefix with bits beyond pfx_len zeroed */
+    uint8_t pfx_len;            /**< length of _lpm_node::pfx in bits */
+} _lpm_node_t;
+
+static _lpm_node_t _nodes[_NIB_LPM_NODES_NUMOF];
+static _lpm_node_t *_root;
+static _lpm_node_t *_free;      /* free nodes are chained via child[0] */
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned idx)
+{
+    return (addr->u8[idx >> 3] >> (7 - (idx & 0x7))) & 0x1;
+}
+
+/* checks if the first len bits of a and b are equal */
+static bool _pfx_equal(const ipv6_addr_t *a, const ipv6_addr_t *b,
+                       unsigned len)
+{
+    unsigned bytes = len >> 3;
+    unsigned bits = len & 0x7;
+
+    if (memcmp(a, b, bytes) != 0) {
+        return false;
+    }
+    if (bits > 0) {
+        uint8_t mask = 0xff << (8 - bits);
+
+        return ((a->u8[bytes] ^ b->u8[bytes]) & mask) == 0;
+    }
+    return true;
+}
+
+static _lpm_node_t *_node_alloc(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _lpm_node_t *node = _free;
+
+    if (node != NULL) {
+        _free = node->child[0];
+        memset(node, 0, sizeof(*node));
+        ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+        node->pfx_len = pfx_len;
+    }
+    return node;
+}
+
+static void _node_free(_lpm_node_t *node)
+{
+    node->child[0] = _free;
+    _free = node;
+}
+
+void _nib_lpm_init(void)
+{
+    _root = NULL;
+    _free = NULL;
+    for (unsigned i = 0; i < _NIB_LPM_NODES_NUMOF; i++) {
+        _node_free(&_nodes[i]);
+    }
+}
+
+int _nib_lpm_set(const ipv6_addr_t *pfx, unsigned pfx_len, void *val)
+{
+    _lpm_node_t **link = &_root;
+
+    assert((pfx != NULL) && (pfx_len <= IPV6_ADDR_BIT_LEN) && (val != NULL));
+    while (*link != NULL) {
+        _lpm_node_t *node = *link;
+        unsigned match = ipv6_addr_match_prefix(&node->pfx, pfx);
+
+        if (match > node->pfx_len) {
+            match = node->pfx_len;
+        }
+        if (match > pfx_len) {
+            match = pfx_len;
+        }
+        if (match == node->pfx_len) {
+            if (match == pfx_len) {
+                /* exact match */
+                node->val = val;
+                return 0;
+            }
+            /* node is a prefix of pfx: descend */
+            link = &node->child[_bit(pfx, node->pfx_len)];
+        }
+        else {
+            /* pfx and node diverge (or pfx is a prefix of node): insert a new
+             * node at the point of divergence */
+            _lpm_node_t *parent = _node_alloc(pfx, match);
+
+            if (parent == NULL) {
+                return -ENOMEM;
+            }
+            parent->child[_bit(&node->pfx, match)] = node;
+            if (match < pfx_len) {
+                _lpm_node_t *leaf = _node_alloc(pfx, pfx_len);
+
+                if (leaf == NULL) {
+                    _node_free(parent);
+                    return -ENOMEM;
+                }
+                leaf->val = val;
+                parent->child[_bit(pfx, match)] = leaf;
+            }
+            else {
+                parent->val = val;
+            }
+            *link = parent;
+            return 0;
+        }
+    }
+    if ((*link = _node_alloc(pfx, pfx_len)) == NULL) {
+        return -ENOMEM;
+    }
+    (*link)->val = val;
+    return 0;
+}
+
+static _lpm_node_t **_find(const ipv6_addr_t *pfx, unsigned pfx_len,
+                           _lpm_node_t ***parent_link)
+{
+    _lpm_node_t **link = &_root;
+
+    if (parent_link != NULL) {
+        *parent_link = NULL;
+    }
+    while ((*link != NULL) && ((*link)->pfx_len <= pfx_len) &&
+           _pfx_equal(&(*link)->pfx, pfx, (*link)->pfx_len)) {
+        if ((*link)->pfx_len == pfx_len) {
+            return link;
+        }
+        if (parent_link != NULL) {
+            *parent_link = link;
+        }
+        link = &(*link)->child[_bit(pfx, (*link)->pfx_len)];
+    }
+    return NULL;
+}
+
+void *_nib_lpm_get(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _lpm_node_t **link;
+
+    assert((pfx != NULL) && (pfx_len <= IPV6_ADDR_BIT_LEN));
+    link = _find(pfx, pfx_len, NULL);
+    return (link != NULL) ? (*link)->val : NULL;
+}
+
+void *_nib_lpm_match(const ipv6_addr_t *addr)
+{
+    const _lpm_node_t *node = _root;
+    void *res = NULL;
+
+    assert(addr != NULL);
+    while ((node != NULL) && _pfx_equal(&node->pfx, addr, node->pfx_len)) {
+        if (node->val != NULL) {
+            res = node->val;
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(addr, node->pfx_len)];
+    }
+    return res;
+}
+
+/* replaces a node without value and with at most one child by that child */
+static void _collapse(_lpm_node_t **link)
+{
+    _lpm_node_t *node = *link;
+
+    if ((node->val == NULL) &&
+        ((node->child[0] == NULL) || (node->child[1] == NULL))) {
+        *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+        _node_free(node);
+    }
+}
+
+void _nib_lpm_remove(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _lpm_node_t **parent_link, **link;
+
+    assert((pfx != NULL) && (pfx_len <= IPV6_ADDR_BIT_LEN));
+    if ((link = _find(pfx, pfx_len, &parent_link)) == NULL) {
+        return;
+    }
+    (*link)->val = NULL;
+    _collapse(link);
+    /* parent might have lost its second child */
+    if (parent_link != NULL) {
+        _collapse(parent_link);
+    }
+}
+#else
+typedef int dont_be_pedantic;
+#endif  /* GNRC_IPV6_NIB_CONF_FT_LPM */
+
+/** @} */
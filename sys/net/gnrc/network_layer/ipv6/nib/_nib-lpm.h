@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Longest-prefix-match trie for off-link entries
+ * @see     @ref GNRC_IPV6_NIB_CONF_FT_LPM
+ *
+ * A path-compressed binary (PATRICIA) trie over prefixes. Every node in the
+ * trie either stores a value or branches into two sub-tries, so with
+ * @ref GNRC_IPV6_NIB_OFFL_NUMOF distinct prefixes at most
+ * 2 * @ref GNRC_IPV6_NIB_OFFL_NUMOF - 1 nodes are in use. Look-ups visit at
+ * most one node per prefix bit independent of the number of prefixes stored.
+ *
+ * The trie only stores one value per prefix. It is the responsibility of the
+ * caller to decide which entry represents a prefix if multiple entries share
+ * it.
+ */
+#ifndef PRIV_NIB_LPM_H
+#define PRIV_NIB_LPM_H
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if GNRC_IPV6_NIB_CONF_FT_LPM || defined(DOXYGEN)
+/**
+ * @brief   Number of nodes in the trie
+ */
+#define _NIB_LPM_NODES_NUMOF    (2 * GNRC_IPV6_NIB_OFFL_NUMOF)
+
+/**
+ * @brief   Empties the trie
+ */
+void _nib_lpm_init(void);
+
+/**
+ * @brief   Sets the value for a prefix
+ *
+ * @pre `(pfx != NULL) && (pfx_len <= 128) && (val != NULL)`
+ *
+ * A previously stored value for the same prefix is overwritten.
+ *
+ * @param[in] pfx       A prefix. Bits beyond @p pfx_len are ignored.
+ * @param[in] pfx_len   Length of @p pfx in bits.
+ * @param[in] val       The value for @p pfx.
+ *
+ * @return  0, on success.
+ * @return  -ENOMEM, if there are no trie nodes left.
+ */
+int _nib_lpm_set(const ipv6_addr_t *pfx, unsigned pfx_len, void *val);
+
+/**
+ * @brief   Gets the value stored for exactly the given prefix
+ *
+ * @pre `(pfx != NULL) && (pfx_len <= 128)`
+ *
+ * @param[in] pfx       A prefix. Bits beyond @p pfx_len are ignored.
+ * @param[in] pfx_len   Length of @p pfx in bits.
+ *
+ * @return  The value for @p pfx.
+ * @return  NULL, if no value is stored for @p pfx.
+ */
+void *_nib_lpm_get(const ipv6_addr_t *pfx, unsigned pfx_len);
+
+/**
+ * @brief   Gets the value of the longest prefix matching an address
+ *
+ * @pre `addr != NULL`
+ *
+ * @param[in] addr  An address.
+ *
+ * @return  The value of the longest prefix stored that covers @p addr.
+ * @return  NULL, if no stored prefix covers @p addr.
+ */
+void *_nib_lpm_match(const ipv6_addr_t *addr);
+
+/**
+ * @brief   Removes the value for a prefix
+ *
+ * @pre `(pfx != NULL) && (pfx_len <= 128)`
+ *
+ * @param[in] pfx       A prefix. Bits beyond @p pfx_len are ignored.
+ * @param[in] pfx_len   Length of @p pfx in bits.
+ */
+void _nib_lpm_remove(const ipv6_addr_t *pfx, unsigned pfx_len);
+#endif  /* GNRC_IPV6_NIB_CONF_FT_LPM || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_LPM_H */
+/** @} */
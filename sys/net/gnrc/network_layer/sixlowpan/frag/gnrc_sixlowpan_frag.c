@@ -21,8 +21,12 @@
 #include "net/gnrc/netapi.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
 #include "net/gnrc/sixlowpan/internal.h"
 #include "net/gnrc/netif.h"
+#include "net/ipv6/hdr.h"
 #include "net/sixlowpan.h"
 #include "utlist.h"
 
@@ -229,6 +233,11 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
     return local_offset;
 }
 
+uint16_t gnrc_sixlowpan_frag_next_tag(void)
+{
+    return ++_tag;
+}
+
 gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get(void)
 {
     return (_fragment_msg.pkt == NULL) ? &_fragment_msg : NULL;
@@ -262,7 +271,7 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     /* Check whether to send the first or an Nth fragment */
     if (fragment_msg->offset == 0) {
         /* increment tag for successive, fragmented datagrams */
-        _tag++;
+        gnrc_sixlowpan_frag_next_tag();
         if ((res = _send_1st_fragment(iface, fragment_msg->pkt, payload_len, fragment_msg->datagram_size)) == 0) {
             /* error sending first fragment */
             DEBUG("6lo frag: error sending 1st fragment\n");
@@ -318,6 +327,21 @@ void gnrc_sixlowpan_frag_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 
         case SIXLOWPAN_FRAG_N_DISP:
             offset = (((sixlowpan_frag_n_t *)frag)->offset * 8);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+            do {
+                gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_get(
+                        gnrc_netif_hdr_get_src_addr(hdr), hdr->src_l2addr_len,
+                        byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
+                        byteorder_ntohs(frag->tag)
+                    );
+
+                if (vrbe != NULL) {
+                    /* datagram is forwarded, relay fragment immediately */
+                    gnrc_sixlowpan_frag_vrb_forward(vrbe, pkt);
+                    return;
+                }
+            } while (0);
+#endif
             break;
 
         default:
@@ -369,9 +393,19 @@ void gnrc_sixlowpan_frag_rbuf_dispatch_when_complete(gnrc_sixlowpan_rbuf_t *rbuf
         new_netif_hdr->lqi = netif_hdr->lqi;
         new_netif_hdr->rssi = netif_hdr->rssi;
         LL_APPEND(rbuf->pkt, netif);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        gnrc_sixlowpan_frag_stats_get()->datagrams++;
+#endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
         gnrc_sixlowpan_frag_rbuf_remove(rbuf);
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    else if (ipv6_hdr_is(rbuf->pkt->data)) {
+        /* first fragment was received: try to forward the datagram without
+         * further reassembly */
+        rbuf_forward((rbuf_t *)rbuf);
+    }
+#endif
 }
 
 /** @} */
@@ -15,12 +15,16 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "memarray.h"
 #include "rbuf.h"
 #include "net/ipv6.h"
 #include "net/ipv6/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
 #include "net/sixlowpan.h"
 #include "thread.h"
 #include "xtimer.h"
@@ -46,6 +50,17 @@ static rbuf_int_t rbuf_int[RBUF_INT_SIZE];
 
 static rbuf_t rbuf[RBUF_SIZE];
 
+/* hash index over the entries in use */
+static rbuf_t *_rbuf_hash[RBUF_HASH_SIZE];
+/* free entries, linked by their next pointer */
+static rbuf_t *_rbuf_free;
+static memarray_t _rbuf_int_pool;
+static bool _rbuf_initialized = false;
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+static gnrc_sixlowpan_frag_stats_t _stats;
+#endif
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -54,11 +69,49 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
+/* links all entries and intervals into the free lists */
+static void _rbuf_init(void);
 /* checks whether start and end overlaps, but not identical to, given interval i */
 static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end);
 /* gets a free entry from interval buffer */
 static rbuf_int_t *_rbuf_int_get_free(void);
 /* update interval buffer of entry */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+void rbuf_forward(rbuf_t *entry)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    uint8_t *data = entry->super.pkt->data;
+    /* the interval of the first fragment is in terms of the compressed
+     * datagram, so derive its uncompressed length from the other ones */
+    uint16_t first_len = entry->super.current_size;
+
+    if ((vrbe = gnrc_sixlowpan_frag_vrb_from_rbuf(&entry->super)) == NULL) {
+        return;
+    }
+    for (rbuf_int_t *ptr = entry->ints; ptr != NULL; ptr = ptr->next) {
+        if (ptr->start != 0) {
+            first_len -= (ptr->end - ptr->start + 1);
+        }
+    }
+    if (gnrc_sixlowpan_frag_vrb_send_1st(vrbe, data, first_len) < 0) {
+        DEBUG("6lo rbuf: unable to forward first fragment, reassembling\n");
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        return;
+    }
+    /* forward fragments that arrived before the first one */
+    for (rbuf_int_t *ptr = entry->ints; ptr != NULL; ptr = ptr->next) {
+        if ((ptr->start != 0) &&
+            (gnrc_sixlowpan_frag_vrb_send_n(vrbe, data + ptr->start,
+                                            ptr->end - ptr->start + 1,
+                                            ptr->start) < 0)) {
+            DEBUG("6lo rbuf: unable to forward buffered fragment\n");
+        }
+    }
+    gnrc_pktbuf_release(entry->super.pkt);
+    rbuf_rm(entry);
+}
+#endif
+
 static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size);
 /* gets an entry identified by its tupel */
 static rbuf_t *_rbuf_get(const void *src, size_t src_len,
@@ -74,7 +127,10 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
     size_t frag_size;
 
-    rbuf_gc();
+    rbuf_gc();  /* also initializes the buffer on first use */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    _stats.fragments++;
+#endif
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                       gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
                       byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
@@ -162,15 +218,41 @@ static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, ui
         ((start != i->start) || (end != i->end)); /* not identical */
 }
 
-static rbuf_int_t *_rbuf_int_get_free(void)
+static void _rbuf_init(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
+    if (_rbuf_initialized) {
+        return;
+    }
+    memarray_init(&_rbuf_int_pool, rbuf_int, sizeof(rbuf_int_t),
+                  RBUF_INT_SIZE);
+    memarray_set_name(&_rbuf_int_pool, "6lo rbuf int");
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+        LL_PREPEND(_rbuf_free, &rbuf[i]);
     }
+    _rbuf_initialized = true;
+}
+
+static inline unsigned _rbuf_hash_idx(const uint8_t *src, size_t src_len,
+                                      size_t size, uint16_t tag)
+{
+    /* the tag alone is already unique per source, the last byte of the
+     * source address separates sources that happen to use the same tag */
+    unsigned hash = tag ^ size;
+
+    if (src_len > 0) {
+        hash ^= ((unsigned)src[src_len - 1]) << 3;
+    }
+    return hash % RBUF_HASH_SIZE;
+}
 
-    return NULL;
+static rbuf_int_t *_rbuf_int_get_free(void)
+{
+    rbuf_int_t *res = memarray_alloc(&_rbuf_int_pool);
+
+    if (res != NULL) {
+        res->next = NULL;
+    }
+    return res;
 }
 
 void rbuf_rm(rbuf_t *entry)
@@ -178,12 +260,14 @@ void rbuf_rm(rbuf_t *entry)
     while (entry->ints != NULL) {
         rbuf_int_t *next = entry->ints->next;
 
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
+        memarray_free(&_rbuf_int_pool, entry->ints);
         entry->ints = next;
     }
 
+    if (entry->super.pkt != NULL) {
+        LL_DELETE(_rbuf_hash[entry->bucket], entry);
+        LL_PREPEND(_rbuf_free, entry);
+    }
     entry->super.pkt = NULL;
 }
 
@@ -196,6 +280,9 @@ static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
 
     if (new == NULL) {
         DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        _stats.int_full++;
+#endif
         return false;
     }
 
@@ -221,6 +308,8 @@ void rbuf_gc(void)
     uint32_t now_usec = xtimer_now_usec();
     unsigned int i;
 
+    _rbuf_init();
+
     for (i = 0; i < RBUF_SIZE; i++) {
         /* since pkt occupies pktbuf, aggressivly collect garbage */
         if ((rbuf[i].super.pkt != NULL) &&
@@ -237,6 +326,9 @@ void rbuf_gc(void)
 
             gnrc_pktbuf_release(rbuf[i].super.pkt);
             rbuf_rm(&(rbuf[i]));
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+            _stats.timeouts++;
+#endif
         }
     }
 }
@@ -246,56 +338,72 @@ static inline void _set_rbuf_timeout(void)
     xtimer_set_msg(&_gc_timer, RBUF_TIMEOUT, &_gc_timer_msg, sched_active_pid);
 }
 
+/* chooses the entry to evict if the reassembly buffer is full: the least
+ * complete datagram, or the oldest one of equally complete datagrams */
+static rbuf_t *_rbuf_get_victim(uint32_t now_usec)
+{
+    rbuf_t *victim = &rbuf[0];
+
+    for (unsigned int i = 1; i < RBUF_SIZE; i++) {
+        rbuf_t *e = &rbuf[i];
+        /* compare current_size / size of both entries without division */
+        uint32_t e_ratio = (uint32_t)e->super.current_size *
+                           victim->super.pkt->size;
+        uint32_t victim_ratio = (uint32_t)victim->super.current_size *
+                                e->super.pkt->size;
+
+        if ((e_ratio < victim_ratio) ||
+            ((e_ratio == victim_ratio) &&
+             ((now_usec - e->arrival) > (now_usec - victim->arrival)))) {
+            victim = e;
+        }
+    }
+    return victim;
+}
+
 static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                          const void *dst, size_t dst_len,
                          size_t size, uint16_t tag, unsigned page)
 {
-    rbuf_t *res = NULL, *oldest = NULL;
+    rbuf_t *res;
     uint32_t now_usec = xtimer_now_usec();
+    unsigned bucket = _rbuf_hash_idx(src, src_len, size, tag);
 
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+    LL_FOREACH(_rbuf_hash[bucket], res) {
         /* check first if entry already available */
-        if ((rbuf[i].super.pkt != NULL) && (rbuf[i].super.pkt->size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
+        if ((res->super.pkt->size == size) && (res->super.tag == tag) &&
+            (res->super.src_len == src_len) &&
+            (res->super.dst_len == dst_len) &&
+            (memcmp(res->super.src, src, src_len) == 0) &&
+            (memcmp(res->super.dst, dst, dst_len) == 0)) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+                  gnrc_netif_addr_to_str(res->super.src,
+                                         res->super.src_len,
                                          l2addr_str));
             DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
+                  gnrc_netif_addr_to_str(res->super.dst,
+                                         res->super.dst_len,
                                          l2addr_str),
-                  (unsigned)rbuf[i].super.pkt->size, rbuf[i].super.tag);
-            rbuf[i].arrival = now_usec;
+                  (unsigned)res->super.pkt->size, res->super.tag);
+            res->arrival = now_usec;
             _set_rbuf_timeout();
-            return &(rbuf[i]);
-        }
-
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && (rbuf[i].super.pkt == NULL)) {
-            res = &(rbuf[i]);
-        }
-
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) || (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
+            return res;
         }
     }
 
     /* entry not in buffer and no empty spot found */
-    if (res == NULL) {
-        assert(oldest != NULL);
-        /* if oldest->pkt == NULL, res must not be NULL */
-        assert(oldest->super.pkt != NULL);
-        DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
-        gnrc_pktbuf_release(oldest->super.pkt);
-        rbuf_rm(oldest);
-        res = oldest;
+    if (_rbuf_free == NULL) {
+        rbuf_t *victim = _rbuf_get_victim(now_usec);
+
+        DEBUG("6lo rfrag: reassembly buffer full, remove entry %p\n",
+              (void *)victim);
+        gnrc_pktbuf_release(victim->super.pkt);
+        rbuf_rm(victim);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        _stats.rbuf_full++;
+#endif
     }
+    res = _rbuf_free;
 
     /* now we have an empty spot */
 
@@ -315,6 +423,9 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
         return NULL;
     }
+    LL_DELETE(_rbuf_free, res);
+    res->bucket = bucket;
+    LL_PREPEND(_rbuf_hash[bucket], res);
 
     *((uint64_t *)res->super.pkt->data) = 0;  /* clean first few bytes for later
                                                * look-ups */
@@ -339,4 +450,11 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     return res;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+gnrc_sixlowpan_frag_stats_t *gnrc_sixlowpan_frag_stats_get(void)
+{
+    return &_stats;
+}
+#endif
+
 /** @} */
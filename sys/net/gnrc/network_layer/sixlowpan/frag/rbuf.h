@@ -33,6 +33,13 @@ extern "C" {
 #define RBUF_SIZE           (4U)               /**< size of the reassembly buffer */
 #define RBUF_TIMEOUT        (3U * US_PER_SEC) /**< timeout for reassembly in microseconds */
 
+/**
+ * @brief   Number of buckets of the reassembly buffer's hash index
+ */
+#ifndef RBUF_HASH_SIZE
+#define RBUF_HASH_SIZE      (RBUF_SIZE)
+#endif
+
 /**
  * @brief   Fragment intervals to identify limits of fragments.
  *
@@ -60,11 +67,17 @@ typedef struct rbuf_int {
  *
  * @extends gnrc_sixlowpan_rbuf_t
  */
-typedef struct {
+typedef struct rbuf {
     gnrc_sixlowpan_rbuf_t super;        /**< exposed part of the reassembly buffer */
     rbuf_int_t *ints;                   /**< intervals of the fragment */
+    /**
+     * @brief   next entry in the same hash bucket or in the list of free
+     *          entries
+     */
+    struct rbuf *next;
     uint32_t arrival;                   /**< time in microseconds of arrival of
                                          *   last received fragment */
+    uint8_t bucket;                     /**< hash bucket of the entry */
 } rbuf_t;
 
 /**
@@ -91,6 +104,22 @@ void rbuf_gc(void);
 
 void rbuf_rm(rbuf_t *rbuf);
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || defined(DOXYGEN)
+/**
+ * @brief   Forwards the fragments received so far and frees the entry, if
+ *          the datagram is to be forwarded
+ *
+ * On success all further fragments of the datagram are forwarded using the
+ * @ref net_gnrc_sixlowpan_frag_vrb "virtual reassembly buffer". Otherwise
+ * the entry is left untouched and reassembly continues.
+ *
+ * @pre The first fragment of the datagram was added to @p rbuf
+ *
+ * @param[in] rbuf  A reassembly buffer entry.
+ */
+void rbuf_forward(rbuf_t *rbuf);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
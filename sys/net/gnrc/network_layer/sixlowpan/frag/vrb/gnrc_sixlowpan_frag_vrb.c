@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/gnrc/sixlowpan/internal.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/hdr.h"
+#include "net/sixlowpan.h"
+#include "net/udp.h"
+#include "utlist.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static gnrc_sixlowpan_frag_vrb_t _vrb[GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+
+static gnrc_pktsnip_t *_build_netif_hdr(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                        gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(NULL, 0, vrbe->out_dst,
+                                                 vrbe->out_dst_len);
+
+    if (netif == NULL) {
+        DEBUG("6lo vrb: error allocating link-layer header\n");
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = vrbe->out_netif->pid;
+    LL_PREPEND(pkt, netif);
+    return pkt;
+}
+
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_rbuf(const gnrc_sixlowpan_rbuf_t *rbuf)
+{
+    const ipv6_hdr_t *hdr = rbuf->pkt->data;
+    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_netif_t *netif;
+    gnrc_ipv6_nib_nc_t nce;
+
+    if ((rbuf->pkt->size < sizeof(ipv6_hdr_t)) ||
+        ipv6_addr_is_multicast(&hdr->dst) ||
+        ipv6_addr_is_link_local(&hdr->dst) ||
+        (hdr->hl <= 1) ||
+        (gnrc_netif_get_by_ipv6_addr(&hdr->dst) != NULL)) {
+        /* let the IPv6 layer handle the reassembled datagram */
+        return NULL;
+    }
+    if ((gnrc_ipv6_nib_get_next_hop_l2addr(&hdr->dst, NULL, NULL, &nce) < 0) ||
+        ((netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce))) == NULL) ||
+        !gnrc_netif_is_6ln(netif) ||
+        (nce.l2addr_len > sizeof(vrbe->out_dst))) {
+        DEBUG("6lo vrb: no 6LoWPAN next hop to forward datagram to\n");
+        return NULL;
+    }
+
+    gnrc_sixlowpan_frag_vrb_gc();
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (_vrb[i].current_size == 0) {
+            vrbe = &_vrb[i];
+            break;
+        }
+    }
+    if (vrbe == NULL) {
+        DEBUG("6lo vrb: VRB full\n");
+        return NULL;
+    }
+
+    memcpy(vrbe->src, rbuf->src, rbuf->src_len);
+    vrbe->src_len = rbuf->src_len;
+    memcpy(vrbe->out_dst, nce.l2addr, nce.l2addr_len);
+    vrbe->out_dst_len = nce.l2addr_len;
+    vrbe->datagram_size = rbuf->pkt->size;
+    vrbe->tag = rbuf->tag;
+    vrbe->out_tag = gnrc_sixlowpan_frag_next_tag();
+    vrbe->current_size = rbuf->current_size;
+    vrbe->out_netif = netif;
+    vrbe->arrival = xtimer_now_usec();
+    DEBUG("6lo vrb: created entry %p (tag %u -> %u)\n", (void *)vrbe,
+          vrbe->tag, vrbe->out_tag);
+    return vrbe;
+}
+
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(const uint8_t *src,
+                                                       size_t src_len,
+                                                       uint16_t datagram_size,
+                                                       uint16_t tag)
+{
+    gnrc_sixlowpan_frag_vrb_gc();
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+
+        if ((vrbe->current_size != 0) && (vrbe->tag == tag) &&
+            (vrbe->datagram_size == datagram_size) &&
+            (vrbe->src_len == src_len) &&
+            (memcmp(vrbe->src, src, src_len) == 0)) {
+            return vrbe;
+        }
+    }
+    return NULL;
+}
+
+void gnrc_sixlowpan_frag_vrb_gc(void)
+{
+    uint32_t now_usec = xtimer_now_usec();
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if ((_vrb[i].current_size != 0) &&
+            ((now_usec - _vrb[i].arrival) > GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US)) {
+            DEBUG("6lo vrb: entry %p timed out\n", (void *)&_vrb[i]);
+            gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
+        }
+    }
+}
+
+int gnrc_sixlowpan_frag_vrb_send_1st(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                     const uint8_t *data, size_t len)
+{
+    const ipv6_hdr_t *hdr = (const ipv6_hdr_t *)data;
+    gnrc_pktsnip_t *pkt, *frag;
+    sixlowpan_frag_t *frag_hdr;
+
+    /* the UDP header is compressed along with the IPv6 header, so it needs
+     * to be complete as well */
+    if ((len < sizeof(ipv6_hdr_t)) ||
+        ((hdr->nh == PROTNUM_UDP) &&
+         (len < (sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t))))) {
+        return -EINVAL;
+    }
+    pkt = gnrc_pktbuf_add(NULL, data + sizeof(ipv6_hdr_t),
+                          len - sizeof(ipv6_hdr_t), GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return -ENOMEM;
+    }
+    frag = gnrc_pktbuf_add(pkt, data, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (frag == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    pkt = frag;
+    ((ipv6_hdr_t *)pkt->data)->hl--;
+    if (((pkt = _build_netif_hdr(vrbe, pkt)) == NULL) ||
+        ((pkt = gnrc_sixlowpan_iphc_encode(pkt)) == NULL)) {
+        return -ENOMEM;
+    }
+    frag = gnrc_pktbuf_add(pkt->next, NULL, sizeof(sixlowpan_frag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    pkt->next = frag;
+    frag_hdr = frag->data;
+    frag_hdr->disp_size = byteorder_htons(vrbe->datagram_size);
+    frag_hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    frag_hdr->tag = byteorder_htons(vrbe->out_tag);
+    if (gnrc_pkt_len(pkt->next) > vrbe->out_netif->sixlo.max_frag_size) {
+        DEBUG("6lo vrb: recompressed first fragment too large\n");
+        gnrc_pktbuf_release(pkt);
+        return -EMSGSIZE;
+    }
+    DEBUG("6lo vrb: forward first fragment (tag %u)\n", vrbe->out_tag);
+    gnrc_sixlowpan_dispatch_send(pkt, NULL, 0);
+    return 0;
+}
+
+int gnrc_sixlowpan_frag_vrb_send_n(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                   const uint8_t *data, size_t len,
+                                   uint16_t offset)
+{
+    gnrc_pktsnip_t *pkt;
+    sixlowpan_frag_n_t *frag_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_frag_n_t) + len,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return -ENOMEM;
+    }
+    frag_hdr = pkt->data;
+    frag_hdr->disp_size = byteorder_htons(vrbe->datagram_size);
+    frag_hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+    frag_hdr->tag = byteorder_htons(vrbe->out_tag);
+    frag_hdr->offset = (uint8_t)(offset >> 3);
+    memcpy(frag_hdr + 1, data, len);
+    if ((pkt = _build_netif_hdr(vrbe, pkt)) == NULL) {
+        return -ENOMEM;
+    }
+    DEBUG("6lo vrb: forward buffered fragment (offset %u)\n", offset);
+    gnrc_sixlowpan_dispatch_send(pkt, NULL, 0);
+    return 0;
+}
+
+void gnrc_sixlowpan_frag_vrb_forward(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                     gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *tmp;
+    sixlowpan_frag_n_t *frag_hdr;
+
+    assert(pkt->size >= sizeof(sixlowpan_frag_n_t));
+    vrbe->arrival = xtimer_now_usec();
+    vrbe->current_size += pkt->size - sizeof(sixlowpan_frag_n_t);
+    if (vrbe->current_size >= vrbe->datagram_size) {
+        /* datagram was forwarded completely */
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    }
+
+    if ((tmp = gnrc_pktbuf_start_write(pkt)) == NULL) {
+        DEBUG("6lo vrb: unable to write protect fragment\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    pkt = tmp;
+    /* replace link-layer header of the received frame */
+    pkt = gnrc_pktbuf_remove_snip(pkt, pkt->next);
+    frag_hdr = pkt->data;
+    frag_hdr->tag = byteorder_htons(vrbe->out_tag);
+    if ((pkt = _build_netif_hdr(vrbe, pkt)) == NULL) {
+        return;
+    }
+    DEBUG("6lo vrb: forward fragment (offset %u)\n",
+          (unsigned)(frag_hdr->offset << 3));
+    gnrc_sixlowpan_dispatch_send(pkt, NULL, 0);
+}
+
+/** @} */
@@ -22,6 +22,9 @@
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
+#ifdef MODULE_GNRC_PKTLAT
+#include "net/gnrc/pktlat.h"
+#endif
 #include "net/sixlowpan.h"
 
 #define ENABLE_DEBUG    (0)
@@ -217,6 +220,11 @@ static void _receive(gnrc_pktsnip_t *pkt)
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
     else if (sixlowpan_iphc_is(dispatch)) {
         DEBUG("6lo: received 6LoWPAN IPHC comressed datagram\n");
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_FWD
+        if (gnrc_sixlowpan_iphc_fwd(pkt)) {
+            return;
+        }
+#endif
         gnrc_sixlowpan_iphc_recv(pkt, NULL, 0);
         return;
     }
@@ -305,8 +313,13 @@ static void _send(gnrc_pktsnip_t *pkt)
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              sched_active_pid);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
@@ -321,6 +334,9 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
         msg_receive(&msg);
+#ifdef MODULE_GNRC_PKTLAT
+        gnrc_pktlat_record_msg(GNRC_PKTLAT_SIXLOWPAN, &msg);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -333,6 +349,18 @@ static void *_event_loop(void *args)
                 _send(msg.content.ptr);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_BATCH
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                gnrc_netapi_batch_drain(msg.content.ptr, _receive);
+                break;
+
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+                gnrc_netapi_batch_drain(msg.content.ptr, _send);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_GET:
             case GNRC_NETAPI_MSG_TYPE_SET:
                 DEBUG("6lo: reply to unsupported get/set\n");
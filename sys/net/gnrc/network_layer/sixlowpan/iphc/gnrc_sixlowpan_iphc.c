@@ -17,6 +17,7 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 
 #include "byteorder.h"
 #include "net/ipv6/hdr.h"
@@ -30,6 +31,10 @@
 #include "utlist.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/udp.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_FWD
+#include "net/gnrc/ipv6/nib.h"
+#include "xtimer.h"
+#endif
 
 #include "net/gnrc/sixlowpan/iphc.h"
 
@@ -589,6 +594,230 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
     return;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_FWD
+typedef struct {
+    ipv6_addr_t dst;                /* destination the route is for */
+    gnrc_netif_t *netif;            /* outgoing interface, NULL if unused */
+    uint32_t created;               /* time of the NIB lookup */
+    uint8_t l2addr[GNRC_IPV6_NIB_L2ADDR_MAX_LEN];   /* next hop */
+    uint8_t l2addr_len;
+} _iphc_fwd_route_t;
+
+static _iphc_fwd_route_t _iphc_fwd_routes[GNRC_SIXLOWPAN_IPHC_FWD_CACHE_SIZE];
+static unsigned _iphc_fwd_next;
+
+static _iphc_fwd_route_t *_iphc_fwd_route(const ipv6_addr_t *dst)
+{
+    uint32_t now = xtimer_now_usec();
+    _iphc_fwd_route_t *route = NULL;
+    gnrc_ipv6_nib_nc_t nce;
+    gnrc_netif_t *netif;
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_IPHC_FWD_CACHE_SIZE; i++) {
+        if ((_iphc_fwd_routes[i].netif != NULL) &&
+            ipv6_addr_equal(&_iphc_fwd_routes[i].dst, dst)) {
+            route = &_iphc_fwd_routes[i];
+            if ((now - route->created) < GNRC_SIXLOWPAN_IPHC_FWD_CACHE_TIMEOUT_US) {
+                return route;
+            }
+            /* refresh stale entry in place */
+            break;
+        }
+    }
+    if ((gnrc_ipv6_nib_get_next_hop_l2addr(dst, NULL, NULL, &nce) < 0) ||
+        ((netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce))) == NULL) ||
+        !gnrc_netif_is_6ln(netif)) {
+        if (route != NULL) {
+            route->netif = NULL;
+        }
+        return NULL;
+    }
+    if (route == NULL) {
+        route = &_iphc_fwd_routes[_iphc_fwd_next];
+        _iphc_fwd_next = (_iphc_fwd_next + 1) % GNRC_SIXLOWPAN_IPHC_FWD_CACHE_SIZE;
+    }
+    memcpy(&route->dst, dst, sizeof(route->dst));
+    memcpy(route->l2addr, nce.l2addr, nce.l2addr_len);
+    route->l2addr_len = nce.l2addr_len;
+    route->netif = netif;
+    route->created = now;
+    return route;
+}
+
+/**
+ * @brief   Walks the compressed header up to the destination address
+ *
+ * @param[in] iphc_hdr  The IPHC frame
+ * @param[in] len       Length of @p iphc_hdr
+ * @param[out] dst      The destination address of the frame
+ * @param[out] hl_pos   Position of the (possibly elided) inline hop limit
+ *
+ * @return  true, if the header can be forwarded without recompression
+ */
+static bool _iphc_fwd_parse(const uint8_t *iphc_hdr, size_t len,
+                            ipv6_addr_t *dst, size_t *hl_pos)
+{
+    static const uint8_t tf_len[] = { 4, 3, 1, 0 };
+    gnrc_sixlowpan_ctx_t *ctx = NULL;
+    size_t pos = SIXLOWPAN_IPHC_HDR_LEN;
+    uint8_t sci = 0, dci = 0;
+
+    if (len < SIXLOWPAN_IPHC_HDR_LEN) {
+        return false;
+    }
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
+        if (len <= CID_EXT_IDX) {
+            return false;
+        }
+        sci = iphc_hdr[CID_EXT_IDX] >> 4;
+        dci = iphc_hdr[CID_EXT_IDX] & 0x0f;
+        pos++;
+    }
+    pos += tf_len[(iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_TF) >> 3];
+    if (!(iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_NH)) {
+        /* hop-by-hop options need to be processed by every hop */
+        if ((pos >= len) || (iphc_hdr[pos] == PROTNUM_IPV6_EXT_HOPOPT)) {
+            return false;
+        }
+        pos++;
+    }
+    *hl_pos = pos;
+    switch (iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_HL) {
+        case IPHC_HL_INLINE:
+            /* let the IPv6 layer send the time exceeded message */
+            if ((pos >= len) || (iphc_hdr[pos] <= 1)) {
+                return false;
+            }
+            pos++;
+            break;
+        case IPHC_HL_1:
+            return false;
+        default:
+            break;
+    }
+    /* addresses derived from the link-layer addresses change on every hop
+     * and link-local or unspecified sources must not be forwarded */
+    switch (iphc_hdr[IPHC2_IDX] & (SIXLOWPAN_IPHC2_SAC | SIXLOWPAN_IPHC2_SAM)) {
+        case IPHC_SAC_SAM_FULL:
+            if ((pos + sizeof(ipv6_addr_t)) > len) {
+                return false;
+            }
+            memcpy(dst, iphc_hdr + pos, sizeof(ipv6_addr_t));
+            if (ipv6_addr_is_unspecified(dst) || ipv6_addr_is_link_local(dst) ||
+                ipv6_addr_is_multicast(dst)) {
+                return false;
+            }
+            pos += sizeof(ipv6_addr_t);
+            break;
+        case IPHC_SAC_SAM_CTX_64:
+        case IPHC_SAC_SAM_CTX_16:
+            if (gnrc_sixlowpan_ctx_lookup_id(sci) == NULL) {
+                return false;
+            }
+            pos += ((iphc_hdr[IPHC2_IDX] &
+                     (SIXLOWPAN_IPHC2_SAC | SIXLOWPAN_IPHC2_SAM)) ==
+                    IPHC_SAC_SAM_CTX_64) ? 8 : 2;
+            break;
+        default:
+            return false;
+    }
+    ipv6_addr_set_unspecified(dst);
+    switch (iphc_hdr[IPHC2_IDX] & (SIXLOWPAN_IPHC2_M | SIXLOWPAN_IPHC2_DAC |
+                                   SIXLOWPAN_IPHC2_DAM)) {
+        case IPHC_M_DAC_DAM_U_FULL:
+            if ((pos + sizeof(ipv6_addr_t)) > len) {
+                return false;
+            }
+            memcpy(dst, iphc_hdr + pos, sizeof(ipv6_addr_t));
+            break;
+        case IPHC_M_DAC_DAM_U_CTX_64:
+            if (((pos + 8) > len) ||
+                ((ctx = gnrc_sixlowpan_ctx_lookup_id(dci)) == NULL)) {
+                return false;
+            }
+            memcpy(dst->u8 + 8, iphc_hdr + pos, 8);
+            ipv6_addr_init_prefix(dst, &ctx->prefix, ctx->prefix_len);
+            break;
+        case IPHC_M_DAC_DAM_U_CTX_16:
+            if (((pos + 2) > len) ||
+                ((ctx = gnrc_sixlowpan_ctx_lookup_id(dci)) == NULL)) {
+                return false;
+            }
+            dst->u32[2] = byteorder_htonl(0x000000ff);
+            dst->u16[6] = byteorder_htons(0xfe00);
+            memcpy(dst->u8 + 14, iphc_hdr + pos, 2);
+            ipv6_addr_init_prefix(dst, &ctx->prefix, ctx->prefix_len);
+            break;
+        default:
+            return false;
+    }
+    return !ipv6_addr_is_link_local(dst) && !ipv6_addr_is_multicast(dst);
+}
+
+bool gnrc_sixlowpan_iphc_fwd(gnrc_pktsnip_t *pkt)
+{
+    assert(pkt != NULL);
+    _iphc_fwd_route_t *route;
+    gnrc_pktsnip_t *netif_hdr;
+    gnrc_netif_t *iface;
+    uint8_t *iphc_hdr = pkt->data;
+    ipv6_addr_t dst;
+    size_t hl_pos, len = pkt->size;
+    uint8_t hl;
+
+    if ((pkt->next == NULL) || (pkt->next->type != GNRC_NETTYPE_NETIF) ||
+        ((iface = gnrc_netif_hdr_get_netif(pkt->next->data)) == NULL) ||
+        !gnrc_netif_is_6lr(iface) ||
+        !_iphc_fwd_parse(iphc_hdr, pkt->size, &dst, &hl_pos) ||
+        (gnrc_netif_get_by_ipv6_addr(&dst) != NULL) ||
+        ((route = _iphc_fwd_route(&dst)) == NULL)) {
+        return false;
+    }
+    switch (iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_HL) {
+        case IPHC_HL_INLINE:
+            hl = iphc_hdr[hl_pos];
+            break;
+        case IPHC_HL_64:
+            hl = 64;
+            len++;
+            break;
+        default:
+            hl = 255;
+            len++;
+            break;
+    }
+    if ((route->netif->sixlo.max_frag_size != 0) &&
+        (len > route->netif->sixlo.max_frag_size)) {
+        /* let the normal path fragment the datagram */
+        return false;
+    }
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, route->l2addr, route->l2addr_len);
+    if (netif_hdr == NULL) {
+        DEBUG("6lo iphc: error allocating link-layer header for forwarding\n");
+        return false;
+    }
+    ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid = route->netif->pid;
+    if (len > pkt->size) {
+        /* the decremented hop limit can't be elided anymore */
+        if (gnrc_pktbuf_realloc_data(pkt, len) != 0) {
+            DEBUG("6lo iphc: no space left to inline hop limit\n");
+            gnrc_pktbuf_release(netif_hdr);
+            return false;
+        }
+        iphc_hdr = pkt->data;
+        memmove(iphc_hdr + hl_pos + 1, iphc_hdr + hl_pos, len - hl_pos - 1);
+        iphc_hdr[IPHC1_IDX] &= ~SIXLOWPAN_IPHC1_HL;
+    }
+    iphc_hdr[hl_pos] = hl - 1;
+    /* replace link-layer header of the received frame */
+    gnrc_pktbuf_remove_snip(pkt, pkt->next);
+    netif_hdr->next = pkt;
+    DEBUG("6lo iphc: fast-path forward to interface %u\n", route->netif->pid);
+    gnrc_sixlowpan_dispatch_send(netif_hdr, NULL, 0);
+    return true;
+}
+#endif /* MODULE_GNRC_SIXLOWPAN_IPHC_FWD */
+
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
 static inline size_t iphc_nhc_udp_encode(uint8_t *nhc_data,
                                          const gnrc_pktsnip_t *udp)
@@ -640,6 +869,140 @@ static inline size_t iphc_nhc_udp_encode(uint8_t *nhc_data,
 }
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+/* upper bound of a compressed IPHC (and UDP NHC) header */
+#define IPHC_CACHE_HDR_MAXLEN       (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + \
+                                     4U /* TF */ + 1U /* NH */ + 1U /* HL */ + \
+                                     (2 * sizeof(ipv6_addr_t)) + \
+                                     1U /* NHC */ + sizeof(udp_hdr_t))
+
+/**
+ * @brief   Everything that determines the compressed header of a packet
+ *          apart from the context buffer
+ *
+ * @note    Always zeroed as a whole before being filled, so it can be
+ *          compared with memcmp()
+ */
+typedef struct {
+    ipv6_hdr_t ipv6_hdr;            /**< IPv6 header with zeroed length */
+    const gnrc_netif_t *netif;      /**< interface the packet is sent over */
+#if (GNRC_NETIF_L2ADDR_MAXLEN > 0)
+    uint8_t netif_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];     /**< source of IID */
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];       /**< destination */
+    uint8_t netif_l2addr_len;       /**< length of gnrc_netif_t::l2addr */
+    uint8_t dst_l2addr_len;         /**< length of link-layer destination */
+#endif
+    network_uint16_t src_port;      /**< UDP source port (NHC only) */
+    network_uint16_t dst_port;      /**< UDP destination port (NHC only) */
+} _iphc_cache_key_t;
+
+typedef struct {
+    _iphc_cache_key_t key;
+    uint32_t ctx_generation;        /* context buffer generation on creation */
+    uint16_t ctx_ids;               /* bitmap of the contexts used */
+    uint8_t hdr_len;                /* 0 if entry is unused */
+    uint8_t hdr[IPHC_CACHE_HDR_MAXLEN];
+} _iphc_cache_entry_t;
+
+static _iphc_cache_entry_t _iphc_cache[GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _iphc_cache_next;
+
+static bool _iphc_cache_key_init(_iphc_cache_key_t *key,
+                                 const gnrc_netif_t *netif,
+                                 const gnrc_netif_hdr_t *netif_hdr,
+                                 const ipv6_hdr_t *ipv6_hdr,
+                                 const gnrc_pktsnip_t *next)
+{
+    memset(key, 0, sizeof(*key));
+    key->ipv6_hdr = *ipv6_hdr;
+    key->ipv6_hdr.len.u16 = 0;
+    key->netif = netif;
+#if (GNRC_NETIF_L2ADDR_MAXLEN > 0)
+    if ((netif->l2addr_len > sizeof(key->netif_l2addr)) ||
+        (netif_hdr->dst_l2addr_len > sizeof(key->dst_l2addr))) {
+        return false;
+    }
+    memcpy(key->netif_l2addr, netif->l2addr, netif->l2addr_len);
+    key->netif_l2addr_len = netif->l2addr_len;
+    memcpy(key->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    key->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+#else
+    (void)netif_hdr;
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+    if (ipv6_hdr->nh == PROTNUM_UDP) {
+        const udp_hdr_t *udp_hdr = next->data;
+
+        key->src_port = udp_hdr->src_port;
+        key->dst_port = udp_hdr->dst_port;
+    }
+#else
+    (void)next;
+#endif
+    return true;
+}
+
+static uint16_t _iphc_cache_ctx_ids(const uint8_t *iphc_hdr)
+{
+    uint8_t cid = (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) ?
+                  iphc_hdr[CID_EXT_IDX] : 0;
+    uint16_t ids = 0;
+
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAC) {
+        ids |= (1 << (cid >> 4));
+    }
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_DAC) {
+        ids |= (1 << (cid & 0x0f));
+    }
+    return ids;
+}
+
+static uint16_t _iphc_cache_get(const _iphc_cache_key_t *key,
+                                uint8_t *iphc_hdr)
+{
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        _iphc_cache_entry_t *entry = &_iphc_cache[i];
+
+        if ((entry->hdr_len == 0) ||
+            (memcmp(&entry->key, key, sizeof(*key)) != 0)) {
+            continue;
+        }
+        /* looking up the contexts that were used lets the context buffer
+         * notice expired lifetimes, which changes its generation */
+        for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+            if (entry->ctx_ids & (1 << id)) {
+                gnrc_sixlowpan_ctx_lookup_id(id);
+            }
+        }
+        if (entry->ctx_generation != gnrc_sixlowpan_ctx_generation()) {
+            DEBUG("6lo iphc: context buffer changed, drop cached header\n");
+            entry->hdr_len = 0;
+            return 0;
+        }
+        memcpy(iphc_hdr, entry->hdr, entry->hdr_len);
+        return entry->hdr_len;
+    }
+    return 0;
+}
+
+static void _iphc_cache_set(const _iphc_cache_key_t *key,
+                            uint32_t ctx_generation,
+                            const uint8_t *iphc_hdr, uint16_t hdr_len)
+{
+    _iphc_cache_entry_t *entry = &_iphc_cache[_iphc_cache_next];
+
+    assert(hdr_len <= sizeof(entry->hdr));
+    _iphc_cache_next = (_iphc_cache_next + 1) % GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    entry->key = *key;
+    entry->ctx_generation = ctx_generation;
+    entry->ctx_ids = _iphc_cache_ctx_ids(iphc_hdr);
+    memcpy(entry->hdr, iphc_hdr, hdr_len);
+    entry->hdr_len = hdr_len;
+}
+#endif /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+
 static inline bool _compressible(gnrc_pktsnip_t *hdr)
 {
     switch (hdr->type) {
@@ -654,7 +1017,7 @@ static inline bool _compressible(gnrc_pktsnip_t *hdr)
     }
 }
 
-void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
+gnrc_pktsnip_t *gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt)
 {
     assert(pkt != NULL);
     gnrc_netif_hdr_t *netif_hdr = pkt->data;
@@ -665,11 +1028,13 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     gnrc_pktsnip_t *dispatch, *ptr = pkt->next;
     bool addr_comp = false;
     size_t dispatch_size = 0;
-    /* datagram size before compression */
-    size_t orig_datagram_size = gnrc_pkt_len(pkt->next);
     uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    _iphc_cache_key_t cache_key;
+    uint32_t ctx_generation = gnrc_sixlowpan_ctx_generation();
+    bool cacheable;
+#endif
 
-    (void)ctx;
     dispatch = NULL;    /* use dispatch as temporary pointer for prev */
     /* determine maximum dispatch size and write protect all headers until
      * then because they will be removed */
@@ -681,7 +1046,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
             if (addr_comp) {    /* addr_comp was used as release indicator */
                 gnrc_pktbuf_release(pkt);
             }
-            return;
+            return NULL;
         }
         ptr = tmp;
         if (dispatch == NULL) {
@@ -712,7 +1077,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     if (dispatch == NULL) {
         DEBUG("6lo iphc: error allocating dispatch space\n");
         gnrc_pktbuf_release(pkt);
-        return;
+        return NULL;
     }
 
     iphc_hdr = dispatch->data;
@@ -721,6 +1086,20 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
 
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    cacheable = _iphc_cache_key_init(&cache_key, iface, netif_hdr, ipv6_hdr,
+                                     pkt->next->next);
+    if (cacheable) {
+        uint16_t cached_len = _iphc_cache_get(&cache_key, iphc_hdr);
+
+        if (cached_len > 0) {
+            DEBUG("6lo iphc: using cached header of length %u\n", cached_len);
+            inline_pos = cached_len;
+            goto compressed;
+        }
+    }
+#endif
+
     /* check for available contexts */
     if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
         src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
@@ -840,7 +1219,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
                 gnrc_pktbuf_release(pkt);
-                return;
+                return NULL;
             }
             gnrc_netif_release(iface);
 
@@ -959,7 +1338,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         if (gnrc_netif_hdr_ipv6_iid_from_dst(iface, netif_hdr, &iid) < 0) {
             DEBUG("6lo iphc: could not get destination's IID\n");
             gnrc_pktbuf_release(pkt);
-            return;
+            return NULL;
         }
 
         if ((ipv6_hdr->dst.u64[1].u64 == iid.uint64.u64) ||
@@ -992,13 +1371,33 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         inline_pos += 16;
     }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+    if (ipv6_hdr->nh == PROTNUM_UDP) {
+        assert(pkt->next->next->size >= sizeof(udp_hdr_t));
+        inline_pos += iphc_nhc_udp_encode(&iphc_hdr[inline_pos],
+                                          pkt->next->next);
+    }
+#endif
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    if (cacheable) {
+        _iphc_cache_set(&cache_key, ctx_generation, iphc_hdr, inline_pos);
+    }
+
+compressed:
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
     switch (ipv6_hdr->nh) {
         case PROTNUM_UDP: {
             gnrc_pktsnip_t *udp = pkt->next->next;
 
-            assert(udp->size >= sizeof(udp_hdr_t));
-            inline_pos += iphc_nhc_udp_encode(&iphc_hdr[inline_pos], udp);
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+            /* the checksum is the only part of the NHC header that differs
+             * between packets of a flow and is always written last */
+            memcpy(&iphc_hdr[inline_pos - sizeof(network_uint16_t)],
+                   &((udp_hdr_t *)udp->data)->checksum,
+                   sizeof(network_uint16_t));
+#endif
             /* remove UDP header */
             if (udp->size > sizeof(udp_hdr_t)) {
                 udp = gnrc_pktbuf_mark(udp, sizeof(udp_hdr_t),
@@ -1007,7 +1406,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
                 if (udp == NULL) {
                     DEBUG("gnrc_sixlowpan_iphc_encode: unable to mark UDP header\n");
                     gnrc_pktbuf_release(dispatch);
-                    return;
+                    return NULL;
                 }
             }
             gnrc_pktbuf_remove_snip(pkt, udp);
@@ -1029,7 +1428,21 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     dispatch->next = pkt->next;
     pkt->next = dispatch;
 
-    gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(netif_hdr);
+    return pkt;
+}
+
+void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
+{
+    assert(pkt != NULL);
+    /* datagram size before compression */
+    size_t orig_datagram_size = gnrc_pkt_len(pkt->next);
+
+    (void)ctx;
+    if ((pkt = gnrc_sixlowpan_iphc_encode(pkt)) == NULL) {
+        return;
+    }
+
+    gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(pkt->data);
     assert(netif != NULL);
     gnrc_sixlowpan_multiplex_by_size(pkt, orig_datagram_size, netif, page);
 }
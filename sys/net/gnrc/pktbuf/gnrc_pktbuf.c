@@ -16,6 +16,9 @@
 #include <sys/uio.h>
 
 #include "net/gnrc/pktbuf.h"
+#ifdef MODULE_DMA_MEMCPY
+#include "dma_memcpy.h"
+#endif
 
 gnrc_pktsnip_t *gnrc_pktbuf_get_iovec(gnrc_pktsnip_t *pkt, size_t *len)
 {
@@ -127,7 +130,11 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt)
 
     /* Copy data to new buffer */
     for (gnrc_pktsnip_t *ptr = pkt->next; ptr != NULL; ptr = ptr->next) {
+#ifdef MODULE_DMA_MEMCPY
+        dma_memcpy(((uint8_t *)pkt->data) + offset, ptr->data, ptr->size);
+#else
         memcpy(((uint8_t *)pkt->data) + offset, ptr->data, ptr->size);
+#endif
         offset += ptr->size;
     }
 
@@ -0,0 +1,532 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf_slab
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktbuf_slab.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+static_assert(((GNRC_PKTBUF_SLAB_SMALL_SIZE % sizeof(void *)) == 0) &&
+              ((GNRC_PKTBUF_SLAB_MEDIUM_SIZE % sizeof(void *)) == 0) &&
+              ((GNRC_PKTBUF_SLAB_LARGE_SIZE % sizeof(void *)) == 0) &&
+              (GNRC_PKTBUF_SLAB_SMALL_SIZE < GNRC_PKTBUF_SLAB_MEDIUM_SIZE) &&
+              (GNRC_PKTBUF_SLAB_MEDIUM_SIZE < GNRC_PKTBUF_SLAB_LARGE_SIZE),
+              "payload classes must be pointer aligned and ordered by size");
+
+/**
+ * @brief   Slab indices
+ */
+enum {
+    _SLAB_SNIP = 0,     /**< slab for packet snip headers */
+    _SLAB_SMALL,        /**< small payload slab */
+    _SLAB_MEDIUM,       /**< medium payload slab */
+    _SLAB_LARGE,        /**< large payload slab */
+    _SLAB_NUMOF,
+};
+
+/**
+ * @brief   Overlay for a free block in a slab
+ */
+typedef struct _free_block {
+    struct _free_block *next;   /**< next free block in the same slab */
+} _free_block_t;
+
+/**
+ * @brief   Descriptor of a slab
+ */
+typedef struct {
+    uint8_t *start;             /**< first byte of the slab */
+    _free_block_t *free;        /**< list of free blocks */
+    uint16_t size;              /**< size of one block */
+    uint16_t numof;             /**< number of blocks in the slab */
+    uint16_t avail;             /**< number of free blocks */
+#ifdef DEVELHELP
+    uint16_t min_avail;         /**< low-water mark of free blocks */
+#endif
+} _slab_t;
+
+static mutex_t _mutex = MUTEX_INIT;
+
+/* the buffers are typed as pointers to get proper alignment for the free
+ * list overlay */
+static gnrc_pktsnip_t _snip_buf[GNRC_PKTBUF_SLAB_SNIP_NUMOF];
+static void *_small_buf[(GNRC_PKTBUF_SLAB_SMALL_SIZE * GNRC_PKTBUF_SLAB_SMALL_NUMOF) /
+                        sizeof(void *)];
+static void *_medium_buf[(GNRC_PKTBUF_SLAB_MEDIUM_SIZE * GNRC_PKTBUF_SLAB_MEDIUM_NUMOF) /
+                         sizeof(void *)];
+static void *_large_buf[(GNRC_PKTBUF_SLAB_LARGE_SIZE * GNRC_PKTBUF_SLAB_LARGE_NUMOF) /
+                        sizeof(void *)];
+
+static _slab_t _slabs[_SLAB_NUMOF] = {
+    { .start = (uint8_t *)_snip_buf, .size = sizeof(gnrc_pktsnip_t),
+      .numof = GNRC_PKTBUF_SLAB_SNIP_NUMOF },
+    { .start = (uint8_t *)_small_buf, .size = GNRC_PKTBUF_SLAB_SMALL_SIZE,
+      .numof = GNRC_PKTBUF_SLAB_SMALL_NUMOF },
+    { .start = (uint8_t *)_medium_buf, .size = GNRC_PKTBUF_SLAB_MEDIUM_SIZE,
+      .numof = GNRC_PKTBUF_SLAB_MEDIUM_NUMOF },
+    { .start = (uint8_t *)_large_buf, .size = GNRC_PKTBUF_SLAB_LARGE_SIZE,
+      .numof = GNRC_PKTBUF_SLAB_LARGE_NUMOF },
+};
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_data_alloc(size_t size, unsigned min_class);
+static void _data_free(void *data);
+
+static inline bool _slab_contains(const _slab_t *slab, const void *ptr)
+{
+    return (unsigned)((const uint8_t *)ptr - slab->start) <
+           ((unsigned)slab->size * slab->numof);
+}
+
+static inline bool _pktbuf_contains(const void *ptr)
+{
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* returns the payload slab the pointer is located in or NULL */
+static inline _slab_t *_data_slab(const void *ptr)
+{
+    for (unsigned i = _SLAB_SMALL; i < _SLAB_NUMOF; i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return &_slabs[i];
+        }
+    }
+    return NULL;
+}
+
+/* data pointers may point into the middle of a block after
+ * gnrc_pktbuf_mark(), so find the start of the block */
+static inline uint8_t *_block_start(const _slab_t *slab, const void *ptr)
+{
+    unsigned offset = (const uint8_t *)ptr - slab->start;
+
+    return slab->start + (offset - (offset % slab->size));
+}
+
+static inline void *_slab_alloc(_slab_t *slab)
+{
+    _free_block_t *block = slab->free;
+
+    if (block != NULL) {
+        slab->free = block->next;
+        slab->avail--;
+#ifdef DEVELHELP
+        if (slab->avail < slab->min_avail) {
+            slab->min_avail = slab->avail;
+        }
+#endif
+    }
+    return block;
+}
+
+static inline void _slab_free(_slab_t *slab, void *block)
+{
+    _free_block_t *free_block = block;
+
+    assert(slab->avail < slab->numof);
+    free_block->next = slab->free;
+    slab->free = free_block;
+    slab->avail++;
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        slab->free = NULL;
+        /* push in reverse order so blocks are handed out front to back */
+        for (unsigned j = slab->numof; j > 0; j--) {
+            _free_block_t *block = (_free_block_t *)(slab->start +
+                                                     ((j - 1) * slab->size));
+            block->next = slab->free;
+            slab->free = block;
+        }
+        slab->avail = slab->numof;
+#ifdef DEVELHELP
+        slab->min_avail = slab->numof;
+#endif
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > GNRC_PKTBUF_SLAB_LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, GNRC_PKTBUF_SLAB_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _slab_alloc(&_slabs[_SLAB_SNIP]);
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->size != size) {
+        /* the remainder keeps the original block, marked sections are
+         * typically headers, so they are the cheaper ones to copy */
+        new_data_marked = _data_alloc(size, _SLAB_SMALL);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            _slab_free(&_slabs[_SLAB_SNIP], marked_snip);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    _slab_t *slab;
+
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _data_free(pkt->data);
+        pkt->data = NULL;
+        pkt->size = 0;
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    slab = (pkt->data != NULL) ? _data_slab(pkt->data) : NULL;
+    if ((slab != NULL) && (size < pkt->size) && (size <= _slabs[_SLAB_SMALL].size) &&
+        (slab != &_slabs[_SLAB_SMALL])) {
+        /* try to give a bigger block back to its slab when shrinking */
+        void *new_data = _data_alloc(size, _SLAB_SMALL);
+
+        if ((new_data != NULL) && (_data_slab(new_data) == &_slabs[_SLAB_SMALL])) {
+            memcpy(new_data, pkt->data, size);
+            _data_free(pkt->data);
+            pkt->data = new_data;
+        }
+        else if (new_data != NULL) {
+            _data_free(new_data);
+        }
+    }
+    else if ((slab == NULL) ||
+             ((((uint8_t *)pkt->data) + size) >
+              (_block_start(slab, pkt->data) + slab->size))) {
+        /* new size does not fit into the current block */
+        void *new_data = _data_alloc(size, _SLAB_SMALL);
+
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+            _data_free(pkt->data);
+        }
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_slab_contains(&_slabs[_SLAB_SNIP], pkt));
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _data_free(pkt->data);
+            _slab_free(&_slabs[_SLAB_SNIP], pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if ((pkt == NULL) || (pkt->size == 0)) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snips", "small", "medium", "large" };
+
+    puts("packet buffer (size classes):");
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        printf("  %-6s block size: %4u, free: %3u/%3u, min. free: %3u\n",
+               names[i], (unsigned)slab->size, (unsigned)slab->avail,
+               (unsigned)slab->numof, (unsigned)slab->min_avail);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        if (_slabs[i].avail != _slabs[i].numof) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall blocks in a slab's free list: block is within the slab and
+     *    aligned to the block size
+     *  - the length of a slab's free list is equal to its number of
+     *    available blocks
+     */
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+        unsigned count = 0;
+
+        for (_free_block_t *ptr = slab->free; ptr != NULL; ptr = ptr->next) {
+            if (!_slab_contains(slab, ptr) ||
+                (_block_start(slab, ptr) != (uint8_t *)ptr) ||
+                (++count > slab->numof)) {
+                return false;
+            }
+        }
+        if (count != slab->avail) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _slab_alloc(&_slabs[_SLAB_SNIP]);
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _data_alloc(size, _SLAB_SMALL);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _slab_free(&_slabs[_SLAB_SNIP], pkt);
+            return NULL;
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    if (data != NULL) {
+        memcpy(_data, data, size);
+    }
+    return pkt;
+}
+
+static void *_data_alloc(size_t size, unsigned min_class)
+{
+    for (unsigned i = min_class; i < _SLAB_NUMOF; i++) {
+        if (size <= _slabs[i].size) {
+            void *block = _slab_alloc(&_slabs[i]);
+
+            if (block != NULL) {
+                return block;
+            }
+        }
+    }
+    DEBUG("pktbuf: no block left for %u bytes\n", (unsigned)size);
+    return NULL;
+}
+
+static void _data_free(void *data)
+{
+    _slab_t *slab;
+
+    if ((data == NULL) || ((slab = _data_slab(data)) == NULL)) {
+        return;
+    }
+    _slab_free(slab, _block_start(slab, data));
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
+    mutex_lock(&_mutex);
+
+    bool is_shared = pkt->users > 1;
+    size_t size = gnrc_pkt_len_upto(pkt, type);
+
+    DEBUG("pktbuf: duplicating %d octets\n", (int) size);
+
+    gnrc_pktsnip_t *tmp;
+    gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
+    gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
+    gnrc_pktsnip_t *new = (size <= GNRC_PKTBUF_SLAB_LARGE_SIZE) ?
+                          _create_snip(next, NULL, size, type) : NULL;
+
+    if (new == NULL) {
+        mutex_unlock(&_mutex);
+
+        return NULL;
+    }
+
+    /* copy payloads */
+    for (tmp = pkt; tmp != NULL; tmp = tmp->next) {
+        uint8_t *dest = ((uint8_t *)new->data) + (size - tmp->size);
+
+        memcpy(dest, tmp->data, tmp->size);
+
+        size -= tmp->size;
+
+        if (tmp->type == type) {
+            break;
+        }
+    }
+
+    /* decrements reference counters */
+
+    if (target != NULL) {
+        target->next = NULL;
+    }
+
+    _release_error_locked(pkt, GNRC_NETERR_SUCCESS);
+
+    if (is_shared && (target != NULL)) {
+        target->next = next;
+    }
+
+    mutex_unlock(&_mutex);
+
+    return new;
+}
+
+/** @} */
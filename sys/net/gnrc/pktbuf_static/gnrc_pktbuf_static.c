@@ -29,6 +29,12 @@
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
+#ifdef MODULE_TRACEBUF
+#include "tracebuf.h"
+#endif
+#ifdef MODULE_GNRC_PKTBUF_STATS
+#include "xtimer.h"
+#endif
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -48,6 +54,14 @@ static _unused_t *_first_unused;
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
 #endif
+/* bytes currently allocated and high-water mark of that */
+static size_t _used = 0;
+static size_t _max_used = 0;
+
+#ifdef MODULE_GNRC_PKTBUF_STATS
+static uint32_t _alloc_fails_type[GNRC_NETTYPE_NUMOF - GNRC_NETTYPE_IOVEC];
+static uint32_t _hold_time[GNRC_PKTBUF_STATS_BUCKETS];
+#endif
 
 /* internal gnrc_pktbuf functions */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
@@ -77,6 +91,34 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+#ifdef MODULE_GNRC_PKTBUF_STATS
+    pkt->alloc_time = xtimer_now_usec();
+#endif
+}
+
+static inline void _count_alloc_fail(gnrc_nettype_t type)
+{
+#ifdef MODULE_GNRC_PKTBUF_STATS
+    _alloc_fails_type[type - GNRC_NETTYPE_IOVEC]++;
+#else
+    (void)type;
+#endif
+}
+
+static inline void _record_hold_time(gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_PKTBUF_STATS
+    uint32_t held = (xtimer_now_usec() - pkt->alloc_time) >> 10;
+    unsigned bucket = 0;
+
+    while (held && (bucket < (GNRC_PKTBUF_STATS_BUCKETS - 1))) {
+        held >>= 1;
+        bucket++;
+    }
+    _hold_time[bucket]++;
+#else
+    (void)pkt;
+#endif
 }
 
 void gnrc_pktbuf_init(void)
@@ -96,6 +138,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     if (size > GNRC_PKTBUF_SIZE) {
         DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SIZE (%u)\n",
               (unsigned)size, GNRC_PKTBUF_SIZE);
+        mutex_lock(&_mutex);
+        _count_alloc_fail(type);
+        mutex_unlock(&_mutex);
         return NULL;
     }
     mutex_lock(&_mutex);
@@ -124,6 +169,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
     if (marked_snip == NULL) {
         DEBUG("pktbuf: could not reallocate marked section.\n");
+        _count_alloc_fail(type);
         mutex_unlock(&_mutex);
         return NULL;
     }
@@ -135,6 +181,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         if (new_data_marked == NULL) {
             DEBUG("pktbuf: could not reallocate marked section.\n");
             _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
+            _count_alloc_fail(type);
             mutex_unlock(&_mutex);
             return NULL;
         }
@@ -143,6 +190,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
             DEBUG("pktbuf: could not reallocate remaining section.\n");
             _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
             _pktbuf_free(new_data_marked, size);
+            _count_alloc_fail(type);
             mutex_unlock(&_mutex);
             return NULL;
         }
@@ -190,6 +238,7 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         void *new_data = _pktbuf_alloc(size);
         if (new_data == NULL) {
             DEBUG("pktbuf: error allocating new data section\n");
+            _count_alloc_fail(pkt->type);
             mutex_unlock(&_mutex);
             return ENOMEM;
         }
@@ -227,6 +276,7 @@ static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
         tmp = pkt->next;
         if (pkt->users == 1) {
             pkt->users = 0; /* not necessary but to be on the safe side */
+            _record_hold_time(pkt);
             _pktbuf_free(pkt->data, pkt->size);
             _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
         }
@@ -371,6 +421,7 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
 
     if (pkt == NULL) {
         DEBUG("pktbuf: error allocating new packet snip\n");
+        _count_alloc_fail(type);
         return NULL;
     }
     if (size > 0) {
@@ -378,6 +429,7 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
         if (_data == NULL) {
             DEBUG("pktbuf: error allocating data for new packet snip\n");
             _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+            _count_alloc_fail(type);
             return NULL;
         }
     }
@@ -431,6 +483,13 @@ static void *_pktbuf_alloc(size_t size)
     if (last_byte > max_byte_count) {
         max_byte_count = last_byte;
     }
+#endif
+    _used += size;
+    if (_used > _max_used) {
+        _max_used = _used;
+    }
+#ifdef MODULE_TRACEBUF
+    tracebuf_add(TRACEBUF_PKTBUF_ALLOC, (uint32_t)(uintptr_t)ptr);
 #endif
     return (void *)ptr;
 }
@@ -457,12 +516,16 @@ static void _pktbuf_free(void *data, size_t size)
     if (!_pktbuf_contains(data)) {
         return;
     }
+#ifdef MODULE_TRACEBUF
+    tracebuf_add(TRACEBUF_PKTBUF_FREE, (uint32_t)(uintptr_t)data);
+#endif
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
     }
     new->next = ptr;
     new->size = _align(size);
+    _used = (_used > new->size) ? (_used - new->size) : 0;
     /* calculate number of bytes between new _unused_t chunk and end of packet
      * buffer */
     bytes_at_end = ((&_pktbuf[0] + GNRC_PKTBUF_SIZE) - (((uint8_t *)new) + new->size));
@@ -485,6 +548,49 @@ static void _pktbuf_free(void *data, size_t size)
     }
 }
 
+size_t gnrc_pktbuf_max_used(void)
+{
+    return _max_used;
+}
+
+void gnrc_pktbuf_max_used_reset(void)
+{
+    mutex_lock(&_mutex);
+    _max_used = _used;
+    mutex_unlock(&_mutex);
+}
+
+#ifdef MODULE_GNRC_PKTBUF_STATS
+void gnrc_pktbuf_get_stats(gnrc_pktbuf_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    mutex_lock(&_mutex);
+    stats->used = _used;
+    stats->max_used = _max_used;
+    for (_unused_t *ptr = _first_unused; ptr; ptr = ptr->next) {
+        stats->free_chunks++;
+        if (ptr->size > stats->free_largest) {
+            stats->free_largest = ptr->size;
+        }
+    }
+    for (unsigned i = 0; i < (GNRC_NETTYPE_NUMOF - GNRC_NETTYPE_IOVEC); i++) {
+        stats->alloc_fails_type[i] = _alloc_fails_type[i];
+        stats->alloc_fails += _alloc_fails_type[i];
+    }
+    memcpy(stats->hold_time, _hold_time, sizeof(_hold_time));
+    mutex_unlock(&_mutex);
+}
+
+void gnrc_pktbuf_reset_stats(void)
+{
+    mutex_lock(&_mutex);
+    _max_used = _used;
+    memset(_alloc_fails_type, 0, sizeof(_alloc_fails_type));
+    memset(_hold_time, 0, sizeof(_hold_time));
+    mutex_unlock(&_mutex);
+}
+#endif
 
 gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
 {
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "irq.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/pktlat.h"
+
+gnrc_pktlat_stats_t gnrc_pktlat_stats[GNRC_PKTLAT_LAYER_NUMOF][GNRC_PKTLAT_DIR_NUMOF];
+
+void gnrc_pktlat_record(gnrc_pktlat_layer_t layer, gnrc_pktlat_dir_t dir,
+                        uint32_t stamp, int queued)
+{
+    gnrc_pktlat_stats_t *stats = &gnrc_pktlat_stats[layer][dir];
+    uint32_t latency = xtimer_now().ticks32 - stamp;
+    unsigned bucket = 0;
+
+    stats->count++;
+    if (latency > stats->max) {
+        stats->max = latency;
+    }
+    if ((queued > 0) && ((unsigned)queued > stats->queue_max)) {
+        stats->queue_max = (queued > UINT16_MAX) ? UINT16_MAX : queued;
+    }
+    while (latency && (bucket < (GNRC_PKTLAT_BUCKETS - 1))) {
+        latency >>= 1;
+        bucket++;
+    }
+    if (stats->hist[bucket] < UINT16_MAX) {
+        stats->hist[bucket]++;
+    }
+}
+
+void gnrc_pktlat_record_msg(gnrc_pktlat_layer_t layer, const msg_t *msg)
+{
+    gnrc_pktsnip_t *pkt = msg->content.ptr;
+    gnrc_pktlat_dir_t dir;
+
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            dir = GNRC_PKTLAT_RX;
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            dir = GNRC_PKTLAT_TX;
+            break;
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+        case GNRC_NETAPI_MSG_TYPE_SND_BATCH: {
+            gnrc_pktsnip_t **pkts = pkt->data;
+            unsigned numof = pkt->size / sizeof(gnrc_pktsnip_t *);
+            int queued = msg_avail();
+
+            dir = (msg->type == GNRC_NETAPI_MSG_TYPE_RCV_BATCH) ?
+                  GNRC_PKTLAT_RX : GNRC_PKTLAT_TX;
+            for (unsigned i = 0; i < numof; i++) {
+                gnrc_pktlat_record(layer, dir, pkts[i]->stamp, queued);
+            }
+            return;
+        }
+#endif
+        default:
+            return;
+    }
+    gnrc_pktlat_record(layer, dir, pkt->stamp, msg_avail());
+}
+
+void gnrc_pktlat_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(gnrc_pktlat_stats, 0, sizeof(gnrc_pktlat_stats));
+    irq_restore(state);
+}
+
+/** @} */
@@ -321,18 +321,25 @@ void _update_lifetime(void)
 
 void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag)
 {
+    dodag->dao_counter = 0;
+    dodag->dao_ack_received = false;
+    if (dodag->dao_delayed) {
+        /* a DAO is already scheduled and will carry the changed routes, do not
+         * postpone it any further */
+        return;
+    }
+    dodag->dao_delayed = true;
     evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&dodag->dao_event);
     ((evtimer_event_t *)&(dodag->dao_event))->offset = random_uint32_range(
         GNRC_RPL_DAO_DELAY_DEFAULT,
         GNRC_RPL_DAO_DELAY_DEFAULT + GNRC_RPL_DAO_DELAY_JITTER
     );
     evtimer_add_msg(&gnrc_rpl_evtimer, &dodag->dao_event, gnrc_rpl_pid);
-    dodag->dao_counter = 0;
-    dodag->dao_ack_received = false;
 }
 
 void gnrc_rpl_long_delay_dao(gnrc_rpl_dodag_t *dodag)
 {
+    dodag->dao_delayed = false;
     evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&dodag->dao_event);
     ((evtimer_event_t *)&(dodag->dao_event))->offset = random_uint32_range(
         GNRC_RPL_DAO_DELAY_LONG,
@@ -353,6 +360,18 @@ void _dao_handle_send(gnrc_rpl_dodag_t *dodag)
         return;
     }
 #endif
+    uint32_t since_last_tx = ((xtimer_now_usec64() / US_PER_MS) & UINT32_MAX) -
+                             dodag->dao_last_tx;
+
+    if (since_last_tx < GNRC_RPL_DAO_MIN_INTERVAL) {
+        /* cap the DAO rate, routes changing meanwhile go into the same DAO */
+        evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&dodag->dao_event);
+        ((evtimer_event_t *)&(dodag->dao_event))->offset = GNRC_RPL_DAO_MIN_INTERVAL -
+                                                           since_last_tx;
+        evtimer_add_msg(&gnrc_rpl_evtimer, &dodag->dao_event, gnrc_rpl_pid);
+        return;
+    }
+    dodag->dao_delayed = false;
     if ((dodag->dao_ack_received == false) && (dodag->dao_counter < GNRC_RPL_DAO_SEND_RETRIES)) {
         dodag->dao_counter++;
         gnrc_rpl_send_DAO(dodag->instance, NULL, dodag->default_lifetime);
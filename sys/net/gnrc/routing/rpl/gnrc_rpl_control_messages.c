@@ -854,6 +854,70 @@ gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime, bool e
     return opt_snip;
 }
 
+/**
+ * @brief   Prepends the DAO base object to the options in @p pkt and sends it
+ *
+ * @param[in] inst          The RPL instance
+ * @param[in] pkt           The options of the DAO, released on error
+ * @param[in] destination   The destination of the DAO
+ */
+static void _dao_send(gnrc_rpl_instance_t *inst, gnrc_pktsnip_t *pkt,
+                      ipv6_addr_t *destination)
+{
+    gnrc_rpl_dodag_t *dodag = &inst->dodag;
+    gnrc_pktsnip_t *tmp;
+    gnrc_rpl_dao_t *dao;
+    bool local_instance = (inst->id & GNRC_RPL_INSTANCE_ID_MSB) ? true : false;
+
+    if (local_instance) {
+        if ((tmp = gnrc_pktbuf_add(pkt, &dodag->dodag_id, sizeof(ipv6_addr_t),
+                                   GNRC_NETTYPE_UNDEF)) == NULL) {
+            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+        pkt = tmp;
+    }
+
+    if ((tmp = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_dao_t), GNRC_NETTYPE_UNDEF)) == NULL) {
+        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    pkt = tmp;
+    dao = pkt->data;
+    dao->instance_id = inst->id;
+    if (local_instance) {
+        /* set the D flag to indicate that a DODAG id is present */
+        dao->k_d_flags = GNRC_RPL_DAO_D_BIT;
+    }
+    else {
+        dao->k_d_flags = 0;
+    }
+
+    /* set the K flag to indicate that ACKs are required */
+    dao->k_d_flags |= GNRC_RPL_DAO_K_BIT;
+    dao->dao_sequence = dodag->dao_seq;
+    dao->reserved = 0;
+
+    if ((tmp = gnrc_icmpv6_build(pkt, ICMPV6_RPL_CTRL, GNRC_RPL_ICMPV6_CODE_DAO,
+                                 sizeof(icmpv6_hdr_t))) == NULL) {
+        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    pkt = tmp;
+
+#ifdef MODULE_NETSTATS_RPL
+    gnrc_rpl_netstats_tx_DAO(&gnrc_rpl_netstats, gnrc_pkt_len(pkt),
+                             (destination && !ipv6_addr_is_multicast(destination)));
+#endif
+
+    gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
+
+    GNRC_RPL_COUNTER_INCREMENT(dodag->dao_seq);
+}
+
 void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint8_t lifetime)
 {
     gnrc_rpl_dodag_t *dodag;
@@ -884,8 +948,8 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
         destination = &(dodag->parents->addr);
     }
 
-    gnrc_pktsnip_t *pkt = NULL, *tmp = NULL;
-    gnrc_rpl_dao_t *dao;
+    gnrc_pktsnip_t *pkt = NULL;
+    unsigned targets = 0;
 
     /* find my address */
     ipv6_addr_t *me = NULL;
@@ -899,86 +963,61 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
     idx = gnrc_netif_ipv6_addr_match(netif, &dodag->dodag_id);
     me = &netif->ipv6.addrs[idx];
 
+    dodag->dao_last_tx = (xtimer_now_usec64() / US_PER_MS) & UINT32_MAX;
+
+    /* all targets share the same path, so the targets of a DAO are aggregated
+     * in front of a single transit option. The packet is built back to front,
+     * hence the transit option is built first */
+    if ((pkt = _dao_transit_build(NULL, lifetime, false)) == NULL) {
+        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+        return;
+    }
+
     /* add external and RPL FT entries */
     /* TODO: nib: dropped support for external transit options for now */
     void *ft_state = NULL;
     gnrc_ipv6_nib_ft_t fte;
     while(gnrc_ipv6_nib_ft_iter(NULL, dodag->iface, &ft_state, &fte)) {
-        DEBUG("RPL: Send DAO - building transit option\n");
-
-        if ((pkt = _dao_transit_build(pkt, lifetime, false)) == NULL) {
-            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-            return;
+        if (!ipv6_addr_is_global(&fte.dst) ||
+            ipv6_addr_is_unspecified(&fte.next_hop)) {
+            continue;
         }
-        if (ipv6_addr_is_global(&fte.dst) &&
-            !ipv6_addr_is_unspecified(&fte.next_hop)) {
-            DEBUG("RPL: Send DAO - building target %s/%d\n",
-                  ipv6_addr_to_str(addr_str, &fte.dst, sizeof(addr_str)), fte.dst_len);
-
-            if ((pkt = _dao_target_build(pkt, &fte.dst, fte.dst_len)) == NULL) {
+        if (targets == GNRC_RPL_DAO_TARGETS_MAX) {
+            /* DAO is full, send it and continue with the next one */
+            _dao_send(inst, pkt, destination);
+            targets = 0;
+            if ((pkt = _dao_transit_build(NULL, lifetime, false)) == NULL) {
                 DEBUG("RPL: Send DAO - no space left in packet buffer\n");
                 return;
             }
         }
-    }
-
-    /* add own address */
-    DEBUG("RPL: Send DAO - building target %s/128\n",
-          ipv6_addr_to_str(addr_str, me, sizeof(addr_str)));
-    if ((pkt = _dao_target_build(pkt, me, IPV6_ADDR_BIT_LEN)) == NULL) {
-        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-        return;
-    }
+        DEBUG("RPL: Send DAO - building target %s/%d\n",
+              ipv6_addr_to_str(addr_str, &fte.dst, sizeof(addr_str)), fte.dst_len);
 
-    bool local_instance = (inst->id & GNRC_RPL_INSTANCE_ID_MSB) ? true : false;
-
-    if (local_instance) {
-        if ((tmp = gnrc_pktbuf_add(pkt, &dodag->dodag_id, sizeof(ipv6_addr_t),
-                                   GNRC_NETTYPE_UNDEF)) == NULL) {
+        if ((pkt = _dao_target_build(pkt, &fte.dst, fte.dst_len)) == NULL) {
             DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-            gnrc_pktbuf_release(pkt);
             return;
         }
-        pkt = tmp;
+        targets++;
     }
 
-    if ((tmp = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_dao_t), GNRC_NETTYPE_UNDEF)) == NULL) {
-        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-        gnrc_pktbuf_release(pkt);
-        return;
-    }
-    pkt = tmp;
-    dao = pkt->data;
-    dao->instance_id = inst->id;
-    if (local_instance) {
-        /* set the D flag to indicate that a DODAG id is present */
-        dao->k_d_flags = GNRC_RPL_DAO_D_BIT;
-    }
-    else {
-        dao->k_d_flags = 0;
+    if (targets == GNRC_RPL_DAO_TARGETS_MAX) {
+        _dao_send(inst, pkt, destination);
+        if ((pkt = _dao_transit_build(NULL, lifetime, false)) == NULL) {
+            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+            return;
+        }
     }
 
-    /* set the K flag to indicate that ACKs are required */
-    dao->k_d_flags |= GNRC_RPL_DAO_K_BIT;
-    dao->dao_sequence = dodag->dao_seq;
-    dao->reserved = 0;
-
-    if ((tmp = gnrc_icmpv6_build(pkt, ICMPV6_RPL_CTRL, GNRC_RPL_ICMPV6_CODE_DAO,
-                                 sizeof(icmpv6_hdr_t))) == NULL) {
+    /* add own address */
+    DEBUG("RPL: Send DAO - building target %s/128\n",
+          ipv6_addr_to_str(addr_str, me, sizeof(addr_str)));
+    if ((pkt = _dao_target_build(pkt, me, IPV6_ADDR_BIT_LEN)) == NULL) {
         DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-        gnrc_pktbuf_release(pkt);
         return;
     }
-    pkt = tmp;
 
-#ifdef MODULE_NETSTATS_RPL
-    gnrc_rpl_netstats_tx_DAO(&gnrc_rpl_netstats, gnrc_pkt_len(pkt),
-                             (destination && !ipv6_addr_is_multicast(destination)));
-#endif
-
-    gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
-
-    GNRC_RPL_COUNTER_INCREMENT(dodag->dao_seq);
+    _dao_send(inst, pkt, destination);
 }
 
 void gnrc_rpl_send_DAO_ACK(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint8_t seq)
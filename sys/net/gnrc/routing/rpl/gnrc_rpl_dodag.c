@@ -155,6 +155,9 @@ bool gnrc_rpl_dodag_init(gnrc_rpl_instance_t *instance, ipv6_addr_t *dodag_id, k
     dodag->dtsn = 0;
     dodag->dao_ack_received = false;
     dodag->dao_counter = 0;
+    dodag->dao_delayed = false;
+    dodag->dao_last_tx = ((xtimer_now_usec64() / US_PER_MS) & UINT32_MAX) -
+                         GNRC_RPL_DAO_MIN_INTERVAL;
     dodag->instance = instance;
     dodag->iface = iface;
     dodag->dao_event.msg.content.ptr = instance;
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl_mrhof
+ * @{
+ * @file
+ * @brief       Minimum Rank with Hysteresis Objective Function.
+ * @}
+ */
+
+#include <string.h>
+
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/dodag.h"
+#include "net/gnrc/rpl/mrhof.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/**
+ * @brief   Path cost of parents that must not be selected
+ */
+#define INVALID_PATH_COST   (UINT32_MAX)
+
+static uint16_t calc_rank(gnrc_rpl_parent_t *, uint16_t);
+static gnrc_rpl_parent_t *which_parent(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dodag_t *);
+static void reset(gnrc_rpl_dodag_t *);
+
+static gnrc_rpl_of_t gnrc_rpl_mrhof = {
+    GNRC_RPL_MRHOF_OCP,
+    calc_rank,
+    which_parent,
+    parent_cmp,
+    which_dodag,
+    reset,
+    NULL,
+    NULL,
+    NULL
+};
+
+/**
+ * @brief   Preferred parent per instance, the parent list is reordered
+ *          while it is sorted, so its head cannot be used for the hysteresis
+ */
+static struct {
+    gnrc_rpl_parent_t *parent;
+    ipv6_addr_t addr;
+} _preferred[GNRC_RPL_INSTANCES_NUMOF];
+
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void)
+{
+    return &gnrc_rpl_mrhof;
+}
+
+static inline unsigned _inst_idx(gnrc_rpl_dodag_t *dodag)
+{
+    return dodag->instance - gnrc_rpl_instances;
+}
+
+static bool _is_preferred(gnrc_rpl_parent_t *parent)
+{
+    unsigned idx = _inst_idx(parent->dodag);
+
+    return (_preferred[idx].parent == parent) &&
+           ipv6_addr_equal(&_preferred[idx].addr, &parent->addr);
+}
+
+static uint16_t _link_etx(gnrc_rpl_parent_t *parent)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(parent->dodag->iface);
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    int l2addr_len = -1;
+    void *state = NULL;
+    gnrc_ipv6_nib_nc_t nce;
+
+    if (netif == NULL) {
+        return NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+    }
+    while (gnrc_ipv6_nib_nc_iter(netif->pid, &state, &nce)) {
+        if (ipv6_addr_equal(&nce.ipv6, &parent->addr) &&
+            (nce.l2addr_len > 0) && (nce.l2addr_len <= sizeof(l2addr))) {
+            memcpy(l2addr, nce.l2addr, nce.l2addr_len);
+            l2addr_len = nce.l2addr_len;
+            break;
+        }
+    }
+    if ((l2addr_len <= 0) && ipv6_addr_is_link_local(&parent->addr) &&
+        (netif->flags & GNRC_NETIF_FLAGS_HAS_L2ADDR)) {
+        /* parent is not in the neighbor cache, try the address it was
+         * derived from */
+        l2addr_len = gnrc_netif_ipv6_iid_to_addr(netif,
+                                                 (eui64_t *)&parent->addr.u64[1],
+                                                 l2addr);
+    }
+    if (l2addr_len > 0) {
+        const netstats_nb_t *nb = netstats_nb_get(&netif->dev->nb_stats,
+                                                  l2addr, l2addr_len);
+        if (nb != NULL) {
+            return nb->etx;
+        }
+    }
+    return NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+}
+
+static uint32_t _path_cost(gnrc_rpl_parent_t *parent)
+{
+    uint16_t etx;
+    uint32_t cost;
+
+    if (parent->rank == GNRC_RPL_INFINITE_RANK) {
+        return INVALID_PATH_COST;
+    }
+    etx = _link_etx(parent);
+    cost = (uint32_t)parent->rank + etx;
+    if ((etx > GNRC_RPL_MRHOF_MAX_LINK_METRIC) ||
+        (cost > GNRC_RPL_MRHOF_MAX_PATH_COST)) {
+        DEBUG("RPL: MRHOF excludes parent with rank %u and ETX %u/%u\n",
+              parent->rank, etx, NETSTATS_NB_ETX_DIVISOR);
+        return INVALID_PATH_COST;
+    }
+    return cost;
+}
+
+void reset(gnrc_rpl_dodag_t *dodag)
+{
+    _preferred[_inst_idx(dodag)].parent = NULL;
+}
+
+uint16_t calc_rank(gnrc_rpl_parent_t *parent, uint16_t base_rank)
+{
+    uint32_t add;
+
+    if (base_rank == 0) {
+        if (parent == NULL) {
+            return GNRC_RPL_INFINITE_RANK;
+        }
+
+        base_rank = parent->rank;
+    }
+
+    if (parent != NULL) {
+        uint16_t etx = _link_etx(parent);
+
+        if ((etx > GNRC_RPL_MRHOF_MAX_LINK_METRIC) ||
+            (((uint32_t)base_rank + etx) > GNRC_RPL_MRHOF_MAX_PATH_COST)) {
+            return GNRC_RPL_INFINITE_RANK;
+        }
+        add = parent->dodag->instance->min_hop_rank_inc;
+        if (etx > add) {
+            add = etx;
+        }
+        if (parent == parent->dodag->parents) {
+            /* the rank is calculated from the preferred parent */
+            unsigned idx = _inst_idx(parent->dodag);
+
+            _preferred[idx].parent = parent;
+            _preferred[idx].addr = parent->addr;
+        }
+    }
+    else {
+        add = GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE;
+    }
+
+    if ((base_rank + add) >= GNRC_RPL_INFINITE_RANK) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+
+    return base_rank + add;
+}
+
+gnrc_rpl_parent_t *which_parent(gnrc_rpl_parent_t *p1, gnrc_rpl_parent_t *p2)
+{
+    if (parent_cmp(p1, p2) > 0) {
+        return p2;
+    }
+    return p1;
+}
+
+int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
+{
+    uint32_t cost1 = _path_cost(parent1);
+    uint32_t cost2 = _path_cost(parent2);
+
+    /* hysteresis: the preferred parent keeps its position unless the other
+     * parent is better by more than the threshold */
+    if ((cost1 != INVALID_PATH_COST) && _is_preferred(parent1)) {
+        cost1 = (cost1 > GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD) ?
+                cost1 - GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD : 0;
+    }
+    if ((cost2 != INVALID_PATH_COST) && _is_preferred(parent2)) {
+        cost2 = (cost2 > GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD) ?
+                cost2 - GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD : 0;
+    }
+
+    if (cost1 < cost2) {
+        return -1;
+    }
+    else if (cost1 > cost2) {
+        return 1;
+    }
+    return 0;
+}
+
+/* Not used yet */
+gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *d1, gnrc_rpl_dodag_t *d2)
+{
+    (void) d2;
+    return d1;
+}
@@ -15,8 +15,10 @@
  * @author Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <errno.h>
 #include <string.h>
 #include "net/gnrc/netif/internal.h"
+#include "net/ipv6/ext/rh.h"
 #include "net/gnrc/ipv6/ext/rh.h"
 #include "net/gnrc/rpl/srh.h"
 
@@ -121,4 +123,57 @@ int gnrc_rpl_srh_process(ipv6_hdr_t *ipv6, gnrc_rpl_srh_t *rh)
     return GNRC_IPV6_EXT_RH_FORWARDED;
 }
 
+/* number of leading octets a and b have in common, at most 15 */
+static uint8_t _common_prefix(const ipv6_addr_t *a, const ipv6_addr_t *b)
+{
+    uint8_t len = 0;
+
+    while ((len < 15) && (a->u8[len] == b->u8[len])) {
+        len++;
+    }
+    return len;
+}
+
+int gnrc_rpl_srh_build(gnrc_rpl_srh_t *rh, size_t rh_size,
+                       const ipv6_addr_t *route, unsigned route_len)
+{
+    uint8_t *addr_vec = (uint8_t *)(rh + 1);
+    uint8_t compri = 15, compre;
+    size_t vec_len, pad;
+
+    assert(route_len >= 2);
+    /* every address is expanded with the prefix of the previous one, which
+     * for the intermediate addresses shares CmprI octets with route[0] */
+    for (unsigned i = 1; i < (route_len - 1); i++) {
+        uint8_t prefix = _common_prefix(&route[0], &route[i]);
+
+        if (prefix < compri) {
+            compri = prefix;
+        }
+    }
+    compre = _common_prefix(&route[route_len - 2], &route[route_len - 1]);
+    vec_len = ((route_len - 2) * (sizeof(ipv6_addr_t) - compri)) +
+              (sizeof(ipv6_addr_t) - compre);
+    pad = (8 - (vec_len & 0x7)) & 0x7;
+    if (((route_len - 1) > UINT8_MAX) ||
+        ((sizeof(gnrc_rpl_srh_t) + vec_len + pad) > rh_size)) {
+        return -ENOBUFS;
+    }
+
+    rh->len = (vec_len + pad) / 8;
+    rh->type = IPV6_EXT_RH_TYPE_RPL_SRH;
+    rh->seg_left = route_len - 1;
+    rh->compr = (compri << 4) | compre;
+    rh->pad_resv = pad << 4;
+    rh->resv = 0;
+    for (unsigned i = 1; i < (route_len - 1); i++) {
+        memcpy(addr_vec, &route[i].u8[compri], sizeof(ipv6_addr_t) - compri);
+        addr_vec += sizeof(ipv6_addr_t) - compri;
+    }
+    memcpy(addr_vec, &route[route_len - 1].u8[compre],
+           sizeof(ipv6_addr_t) - compre);
+    memset(addr_vec + sizeof(ipv6_addr_t) - compre, 0, pad);
+    return sizeof(gnrc_rpl_srh_t) + vec_len + pad;
+}
+
 /** @} */
@@ -20,6 +20,9 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/netreg.h"
+#ifdef MODULE_GNRC_PKTLAT
+#include "net/gnrc/pktlat.h"
+#endif
 #include "net/udp.h"
 #include "utlist.h"
 #include "xtimer.h"
@@ -44,10 +47,37 @@ static void _callback_put(void *arg)
 }
 #endif
 
+#ifdef MODULE_SOCK_ASYNC
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_sock_reg_t *reg = ctx;
+    msg_t msg = { .type = cmd, .content = { .ptr = pkt } };
+
+    if ((cmd != GNRC_NETAPI_MSG_TYPE_RCV) ||
+        (mbox_try_put(&reg->mbox, &msg) < 1)) {
+        /* rejected or sock queue full, same as for a mbox netreg entry */
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    if (reg->async_cb.generic != NULL) {
+        reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
+    }
+}
+#endif
+
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, SOCK_MBOX_SIZE);
+#ifdef MODULE_SOCK_ASYNC
+    /* deliver to the mbox via a callback, so the user can be notified */
+    reg->async_cb.generic = NULL;
+    reg->async_cb_arg = NULL;
+    reg->netreg_cb.cb = _netapi_cb;
+    reg->netreg_cb.ctx = reg;
+    gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
+#else
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
@@ -83,6 +113,10 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     switch (msg.type) {
         case GNRC_NETAPI_MSG_TYPE_RCV:
             pkt = msg.content.ptr;
+#ifdef MODULE_GNRC_PKTLAT
+            gnrc_pktlat_record(GNRC_PKTLAT_SOCK, GNRC_PKTLAT_RX, pkt->stamp,
+                               cib_avail(&reg->mbox.cib));
+#endif
             break;
 #ifdef MODULE_XTIMER
         case _TIMEOUT_MSG_TYPE:
@@ -113,13 +147,13 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+int gnrc_sock_build(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                    const sock_ip_ep_t *remote, uint8_t nh,
+                    gnrc_pktsnip_t **pkt_out, gnrc_nettype_t *type_out)
 {
     gnrc_pktsnip_t *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
     gnrc_nettype_t type;
-    size_t payload_len = gnrc_pkt_len(payload);
 
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
@@ -132,6 +166,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
             pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
                                       (ipv6_addr_t *)&remote->addr.ipv6);
             if (pkt == NULL) {
+                gnrc_pktbuf_release(payload);
                 return -ENOMEM;
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
@@ -171,6 +206,13 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         netif_hdr->if_pid = iface;
         LL_PREPEND(pkt, netif);
     }
+    *pkt_out = pkt;
+    *type_out = type;
+    return 0;
+}
+
+int gnrc_sock_dispatch(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
 #ifdef MODULE_GNRC_NETERR
     gnrc_neterr_reg(pkt);   /* no error should occur since pkt was created here */
 #endif
@@ -193,6 +235,23 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         return (int)(-err_report.content.value);
     }
 #endif
+    return 0;
+}
+
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt;
+    gnrc_nettype_t type;
+    size_t payload_len = gnrc_pkt_len(payload);
+    int res;
+
+    if ((res = gnrc_sock_build(payload, local, remote, nh, &pkt, &type)) < 0) {
+        return res;
+    }
+    if ((res = gnrc_sock_dispatch(pkt, type)) < 0) {
+        return res;
+    }
     return payload_len;
 }
 
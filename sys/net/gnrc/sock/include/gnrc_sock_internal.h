@@ -129,6 +129,23 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote);
 
+/**
+ * @brief   Build the network layer and interface headers for a packet
+ *          internally
+ * @internal
+ *
+ * @note    @p payload is released on error
+ */
+int gnrc_sock_build(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                    const sock_ip_ep_t *remote, uint8_t nh,
+                    gnrc_pktsnip_t **pkt_out, gnrc_nettype_t *type_out);
+
+/**
+ * @brief   Dispatch a packet built with gnrc_sock_build() internally
+ * @internal
+ */
+int gnrc_sock_dispatch(gnrc_pktsnip_t *pkt, gnrc_nettype_t type);
+
 /**
  * @brief   Send a packet internally
  * @internal
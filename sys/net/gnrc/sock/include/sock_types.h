@@ -31,6 +31,9 @@
 #include "net/gnrc/netreg.h"
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async_types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +43,21 @@ extern "C" {
 #define SOCK_MBOX_SIZE      (8)         /**< Size for gnrc_sock_reg_t::mbox_queue */
 #endif
 
+#if defined(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+struct gnrc_sock_reg;   /* forward declaration */
+
+/**
+ * @brief   Generic asynchronous callback type for the registry entry
+ * @internal
+ *
+ * Socks start with a @ref gnrc_sock_reg_t, so this is compatible to the
+ * specific callback types of the socks.
+ */
+typedef void (*gnrc_sock_reg_cb_t)(struct gnrc_sock_reg *sock,
+                                   sock_async_flags_t flags,
+                                   void *arg);
+#endif
+
 /**
  * @brief   sock @ref net_gnrc_netreg info
  * @internal
@@ -51,6 +69,25 @@ typedef struct gnrc_sock_reg {
     gnrc_netreg_entry_t entry;          /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                        /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[SOCK_MBOX_SIZE];   /**< queue for gnrc_sock_reg_t::mbox */
+#if defined(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+    gnrc_netreg_entry_cbd_t netreg_cb;  /**< netreg callback feeding the mbox */
+    /**
+     * @brief   asynchronous upper layer callback
+     *
+     * @note    All have void return value and a (pointer) sock pointer as
+     *          first argument, so it should be safe to just call
+     *          gnrc_sock_reg_t::async_cb::generic.
+     */
+    union {
+        gnrc_sock_reg_cb_t generic;     /**< generic version */
+        sock_ip_cb_t ip;                /**< IP version */
+        sock_udp_cb_t udp;              /**< UDP version */
+    } async_cb;
+    void *async_cb_arg;                 /**< asynchronous callback argument */
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+    sock_async_ctx_t async_ctx;         /**< asynchronous event context */
+#endif
+#endif
 } gnrc_sock_reg_t;
 
 /**
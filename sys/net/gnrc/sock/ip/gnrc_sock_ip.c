@@ -23,6 +23,9 @@
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
 #include "net/sock/ip.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async.h"
+#endif
 #include "random.h"
 
 #include "gnrc_sock_internal.h"
@@ -195,7 +198,30 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
     if (res <= 0) {
         return res;
     }
+#ifdef MODULE_SOCK_ASYNC
+    if ((sock != NULL) && (sock->reg.async_cb.ip != NULL)) {
+        sock->reg.async_cb.ip(sock, SOCK_ASYNC_MSG_SENT,
+                              sock->reg.async_cb_arg);
+    }
+#endif
     return res;
 }
 
+#ifdef MODULE_SOCK_ASYNC
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *cb_arg)
+{
+    assert(sock != NULL);
+    sock->reg.async_cb_arg = cb_arg;
+    sock->reg.async_cb.ip = cb;
+}
+
+#ifdef MODULE_SOCK_ASYNC_EVENT
+sock_async_ctx_t *sock_ip_get_async_ctx(sock_ip_t *sock)
+{
+    assert(sock != NULL);
+    return &sock->reg.async_ctx;
+}
+#endif
+#endif
+
 /** @} */
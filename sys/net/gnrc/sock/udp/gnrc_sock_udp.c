@@ -24,6 +24,9 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async.h"
+#endif
 #include "net/udp.h"
 
 #include "gnrc_sock_internal.h"
@@ -175,15 +178,20 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *remote)
     return 0;
 }
 
-ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
-                      uint32_t timeout, sock_udp_ep_t *remote)
+/**
+ * @brief   Receives a packet for @p sock and checks its remote end point
+ *
+ * @return  0 on success, with @p pkt_out pointing to the payload snip.
+ * @return  negative errno on error, see sock_udp_recv().
+ */
+static int _udp_recv(sock_udp_t *sock, gnrc_pktsnip_t **pkt_out,
+                     uint32_t timeout, sock_udp_ep_t *remote)
 {
     gnrc_pktsnip_t *pkt, *udp;
     udp_hdr_t *hdr;
     sock_ip_ep_t tmp;
     int res;
 
-    assert((sock != NULL) && (data != NULL) && (max_len > 0));
     if (sock->local.family == AF_UNSPEC) {
         return -EADDRNOTAVAIL;
     }
@@ -192,10 +200,6 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
     if (res < 0) {
         return res;
     }
-    if (pkt->size > max_len) {
-        gnrc_pktbuf_release(pkt);
-        return -ENOBUFS;
-    }
     udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
     assert(udp);
     hdr = udp->data;
@@ -214,16 +218,71 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
         gnrc_pktbuf_release(pkt);
         return -EPROTO;
     }
+    *pkt_out = pkt;
+    return 0;
+}
+
+ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
+                      uint32_t timeout, sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt;
+    int res;
+
+    assert((sock != NULL) && (data != NULL) && (max_len > 0));
+    res = _udp_recv(sock, &pkt, timeout, remote);
+    if (res < 0) {
+        return res;
+    }
+    if (pkt->size > max_len) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOBUFS;
+    }
     memcpy(data, pkt->data, pkt->size);
     res = (int)pkt->size;
     gnrc_pktbuf_release(pkt);
     return res;
 }
 
-ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
-                      const sock_udp_ep_t *remote)
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote)
 {
+    gnrc_pktsnip_t *pkt;
     int res;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    /* the payload is always handed out as a single chunk */
+    if (*buf_ctx != NULL) {
+        sock_udp_recv_buf_free(sock, *buf_ctx);
+        *buf_ctx = NULL;
+        *data = NULL;
+        return 0;
+    }
+    res = _udp_recv(sock, &pkt, timeout, remote);
+    if (res < 0) {
+        return res;
+    }
+    if (pkt->size == 0) {
+        gnrc_pktbuf_release(pkt);
+        *data = NULL;
+        return 0;
+    }
+    *data = pkt->data;
+    *buf_ctx = pkt;
+    return (ssize_t)pkt->size;
+}
+
+void sock_udp_recv_buf_free(sock_udp_t *sock, void *buf_ctx)
+{
+    (void)sock;
+    if (buf_ctx != NULL) {
+        gnrc_pktbuf_release(buf_ctx);
+    }
+}
+
+static int _build(sock_udp_t *sock, const void *data, size_t len,
+                  const sock_udp_ep_t *remote, gnrc_pktsnip_t **pkt_out,
+                  gnrc_nettype_t *type_out)
+{
     gnrc_pktsnip_t *payload, *pkt;
     uint16_t src_port = 0, dst_port;
     sock_ip_ep_t local;
@@ -313,11 +372,112 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
-    if (res > 0) {
-        res -= sizeof(udp_hdr_t);
+    return gnrc_sock_build(pkt, &local, rem, PROTNUM_UDP, pkt_out, type_out);
+}
+
+#ifdef MODULE_SOCK_ASYNC
+static inline void _sent(sock_udp_t *sock)
+{
+    if ((sock != NULL) && (sock->reg.async_cb.udp != NULL)) {
+        sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
+                               sock->reg.async_cb_arg);
+    }
+}
+#endif
+
+ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
+                      const sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt;
+    gnrc_nettype_t type;
+    int res;
+
+    if (((res = _build(sock, data, len, remote, &pkt, &type)) < 0) ||
+        ((res = gnrc_sock_dispatch(pkt, type)) < 0)) {
+        return res;
     }
-    return res;
+#ifdef MODULE_SOCK_ASYNC
+    _sent(sock);
+#endif
+    return len;
+}
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned numof)
+{
+    unsigned sent = 0;
+    int res = 0;
+
+    assert((numof == 0) || (msgs != NULL));
+#if defined(MODULE_GNRC_NETAPI_BATCH) && !defined(MODULE_GNRC_NETERR)
+    /* build a batch of datagrams and pass it to UDP in a single message */
+    gnrc_pktsnip_t *pkts[GNRC_NETAPI_BATCH_NUMOF];
+
+    while ((sent < numof) && (res >= 0)) {
+        unsigned num = 0;
+        gnrc_nettype_t type;
+
+        while (((sent + num) < numof) && (num < GNRC_NETAPI_BATCH_NUMOF)) {
+            const sock_udp_msg_t *msg = &msgs[sent + num];
+
+            if ((res = _build(sock, msg->data, msg->len, msg->remote,
+                              &pkts[num], &type)) < 0) {
+                break;
+            }
+            num++;
+        }
+        if ((num > 0) &&
+            (gnrc_netapi_dispatch_send_batch(GNRC_NETTYPE_UDP,
+                                             GNRC_NETREG_DEMUX_CTX_ALL,
+                                             pkts, num) == 0)) {
+            /* this should not happen, but just in case */
+            for (unsigned i = 0; i < num; i++) {
+                gnrc_pktbuf_release(pkts[i]);
+            }
+            res = -EBADMSG;
+            num = 0;
+        }
+        sent += num;
+    }
+#else
+    /* send one by one, with gnrc_neterr every datagram needs to wait for
+     * its own error report */
+    for (; sent < numof; sent++) {
+        const sock_udp_msg_t *msg = &msgs[sent];
+        gnrc_pktsnip_t *pkt;
+        gnrc_nettype_t type;
+
+        if (((res = _build(sock, msg->data, msg->len, msg->remote,
+                           &pkt, &type)) < 0) ||
+            ((res = gnrc_sock_dispatch(pkt, type)) < 0)) {
+            break;
+        }
+    }
+#endif
+    if (sent == 0) {
+        return res;
+    }
+#ifdef MODULE_SOCK_ASYNC
+    _sent(sock);
+#endif
+    return sent;
+}
+
+#ifdef MODULE_SOCK_ASYNC
+void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *cb_arg)
+{
+    assert(sock != NULL);
+    sock->reg.async_cb_arg = cb_arg;
+    sock->reg.async_cb.udp = cb;
 }
 
+#ifdef MODULE_SOCK_ASYNC_EVENT
+sock_async_ctx_t *sock_udp_get_async_ctx(sock_udp_t *sock)
+{
+    assert(sock != NULL);
+    return &sock->reg.async_ctx;
+}
+#endif
+#endif
+
 /** @} */
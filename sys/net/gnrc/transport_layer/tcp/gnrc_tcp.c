@@ -329,6 +329,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     cb_arg_t probe_timeout_arg = {MSG_TYPE_PROBE_TIMEOUT, &(tcb->mbox)};
     uint32_t probe_timeout_duration_us = 0;
     ssize_t ret = 0;
+    size_t sent = 0;
     bool probing_mode = false;
 
     /* Lock the TCB for this function call */
@@ -356,8 +357,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         _setup_timeout(&user_timeout, timeout_duration_us, _cb_mbox_put_msg, &user_timeout_arg);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until all data was passed to the send buffer */
+    while (ret == 0) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             ret = -ECONNRESET;
@@ -376,9 +377,15 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                            &probe_timeout_arg);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send remaining data in case we are not probing */
+        if (!probing_mode) {
+            sent += _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, ((uint8_t *) data) + sent, len - sent);
+        }
+
+        /* Return as soon as everything is in flight, there is no need to wait for the ACKs */
+        if (sent >= len) {
+            ret = sent;
+            break;
         }
 
         /* Wait for responses */
@@ -392,8 +399,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
-                ret = -ETIMEDOUT;
+                /* Data that is already in flight stays in the retransmission queue */
+                ret = (sent > 0) ? (ssize_t) sent : -ETIMEDOUT;
                 break;
 
             case MSG_TYPE_PROBE_TIMEOUT:
@@ -508,8 +515,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                     break;
 
                 case MSG_TYPE_USER_SPEC_TIMEOUT:
-                    DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                    _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+                    DEBUG("gnrc_tcp.c : gnrc_tcp_recv() : USER_SPEC_TIMEOUT\n");
                     ret = -ETIMEDOUT;
                     break;
 
@@ -538,6 +544,7 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     msg_t msg;
     xtimer_t connection_timeout;
     cb_arg_t connection_timeout_arg = {MSG_TYPE_CONNECTION_TIMEOUT, &(tcb->mbox)};
+    bool fin_sent = false;
 
     /* Lock the TCB for this function call */
     mutex_lock(&(tcb->function_lock));
@@ -559,11 +566,16 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     _setup_timeout(&connection_timeout, GNRC_TCP_CONNECTION_TIMEOUT_DURATION,
                    _cb_mbox_put_msg, &connection_timeout_arg);
 
-    /* Start connection teardown sequence */
-    _fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
-
     /* Loop until the connection has been closed */
     while (tcb->state != FSM_STATE_CLOSED) {
+        /* Start connection teardown sequence as soon as the FIN fits into the
+         * retransmission queue, previously sent data might still be in flight */
+        if (!fin_sent && tcb->pkt_retransmit_num < GNRC_TCP_SND_QUEUE_SIZE) {
+            _fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+            fin_sent = true;
+            continue;
+        }
+
         mbox_get(&(tcb->mbox), &msg);
         switch (msg.type) {
             case MSG_TYPE_CONNECTION_TIMEOUT:
@@ -599,6 +611,140 @@ void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb)
     mutex_unlock(&(tcb->function_lock));
 }
 
+#ifdef MODULE_GNRC_TCP_EVENT
+int gnrc_tcp_listen(gnrc_tcp_tcb_t *tcbs, size_t num, uint8_t address_family,
+                    const char *local_addr, uint16_t local_port, event_queue_t *evq,
+                    event_handler_t handler)
+{
+    assert(tcbs != NULL);
+    assert(evq != NULL);
+    assert(local_port != PORT_UNSPEC);
+
+    /* Check AF-Family support if local address was supplied */
+    if (local_addr != NULL) {
+#ifdef MODULE_GNRC_IPV6
+        if (address_family != AF_INET6) {
+            return -EAFNOSUPPORT;
+        }
+#else
+        return -EAFNOSUPPORT;
+#endif
+    }
+
+    for (size_t i = 0; i < num; i++) {
+        gnrc_tcp_tcb_t *tcb = &tcbs[i];
+        int ret;
+
+        if (tcb->state != FSM_STATE_CLOSED) {
+            return -EISCONN;
+        }
+
+        /* Start over with a clean TCB, a pending event must not stay queued */
+        if (tcb->evq != NULL) {
+            event_cancel(tcb->evq, &tcb->event);
+        }
+        gnrc_tcp_tcb_init(tcb);
+        tcb->evq = evq;
+        tcb->event.handler = handler;
+
+        /* Mark connection as passive opend */
+        tcb->status |= STATUS_PASSIVE;
+        if (local_addr == NULL) {
+            tcb->status |= STATUS_ALLOW_ANY_ADDR;
+        }
+#ifdef MODULE_GNRC_IPV6
+        else if (ipv6_addr_from_str((ipv6_addr_t *) tcb->local_addr, local_addr) == NULL) {
+            DEBUG("gnrc_tcp.c : gnrc_tcp_listen() : Invalid local addr\n");
+            return -EINVAL;
+        }
+#endif
+        tcb->local_port = local_port;
+
+        /* Call FSM with event: CALL_OPEN, T: CLOSED -> LISTEN */
+        mutex_lock(&(tcb->function_lock));
+        ret = _fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+        mutex_unlock(&(tcb->function_lock));
+        if (ret < 0) {
+            DEBUG("gnrc_tcp.c : gnrc_tcp_listen() : Out of receive buffers.\n");
+            return ret;
+        }
+    }
+    return 0;
+}
+
+unsigned gnrc_tcp_poll(gnrc_tcp_tcb_t *tcb)
+{
+    assert(tcb != NULL);
+
+    unsigned flags = 0;
+
+    mutex_lock(&(tcb->fsm_lock));
+    if (tcb->rcv_len > 0) {
+        flags |= GNRC_TCP_POLL_IN;
+    }
+    if ((tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT) &&
+        tcb->pkt_retransmit_num < GNRC_TCP_SND_QUEUE_SIZE &&
+        LSS_32_BIT(tcb->snd_nxt - tcb->snd_una, tcb->snd_wnd)) {
+        flags |= GNRC_TCP_POLL_OUT;
+    }
+    /* Peer sent FIN or the connection is gone */
+    if (tcb->state == FSM_STATE_CLOSE_WAIT || tcb->state == FSM_STATE_LAST_ACK ||
+        tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_TIME_WAIT ||
+        tcb->state == FSM_STATE_CLOSED) {
+        flags |= GNRC_TCP_POLL_HUP;
+    }
+    mutex_unlock(&(tcb->fsm_lock));
+    return flags;
+}
+
+ssize_t gnrc_tcp_try_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len)
+{
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    ssize_t ret;
+
+    /* Lock the TCB for this function call */
+    mutex_lock(&(tcb->function_lock));
+
+    /* Check if connection is in a valid state */
+    if (tcb->state != FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_CLOSE_WAIT) {
+        mutex_unlock(&(tcb->function_lock));
+        return -ENOTCONN;
+    }
+
+    ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+    if (ret == 0) {
+        ret = -EAGAIN;
+    }
+    mutex_unlock(&(tcb->function_lock));
+    return ret;
+}
+
+int gnrc_tcp_try_close(gnrc_tcp_tcb_t *tcb)
+{
+    assert(tcb != NULL);
+
+    int ret = 0;
+
+    /* Lock the TCB for this function call */
+    mutex_lock(&(tcb->function_lock));
+
+    /* Send FIN only once, as soon as it fits into the retransmission queue */
+    if (tcb->state == FSM_STATE_LISTEN || tcb->state == FSM_STATE_SYN_RCVD ||
+        tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT) {
+        if (tcb->pkt_retransmit_num < GNRC_TCP_SND_QUEUE_SIZE) {
+            _fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+        }
+        else {
+            ret = -EAGAIN;
+        }
+    }
+    mutex_unlock(&(tcb->function_lock));
+    return ret;
+}
+#endif
+
 int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr)
 {
     uint16_t csum;
@@ -281,6 +281,15 @@ void *_event_loop(__attribute__((unused)) void *arg)
                      NULL, NULL, 0);
                 break;
 
+#ifdef MODULE_GNRC_TCP_EVENT
+            /* Connection timer of an event based connection expired */
+            case MSG_TYPE_CONNECTION_TIMEOUT:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_CONNECTION_TIMEOUT\n");
+                _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_TIMEOUT_CONNECTION,
+                     NULL, NULL, 0);
+                break;
+#endif
+
             default:
                 DEBUG("gnrc_tcp_eventloop.c : _event_loop() : received expected message\n");
         }
@@ -17,6 +17,7 @@
  * @}
  */
 
+#include <string.h>
 #include <utlist.h>
 #include <errno.h>
 #include "random.h"
@@ -83,14 +84,61 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
+    if (tcb->pkt_retransmit_num > 0) {
+        for (unsigned i = 0; i < tcb->pkt_retransmit_num; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
         xtimer_remove(&(tcb->tim_tout));
-        tcb->pkt_retransmit = NULL;
+        tcb->pkt_retransmit_num = 0;
     }
+    tcb->status &= ~STATUS_RTT_PENDING;
     return 0;
 }
 
+/**
+ * @brief Retransmits the next segment that is considered lost during fast recovery.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    int i = _pkt_get_next_lost(tcb);
+
+    if (i >= 0) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+
+        /* Every send attempt consumes a user, no RTT sample from retransmissions */
+        gnrc_pktbuf_hold(pkt, 1);
+        tcb->status &= ~STATUS_RTT_PENDING;
+        tcb->high_rxt = _pkt_get_seq_num(pkt) + _pkt_get_seg_len(pkt);
+        _pkt_send(tcb, pkt, 0, true);
+    }
+}
+
+/**
+ * @brief Handles a duplicate ACK (see RFC 5681 and RFC 6675).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    /* During recovery, SACK information may reveal further holes */
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        if (tcb->status & STATUS_SACK_PERMITTED) {
+            _fast_retransmit(tcb);
+        }
+        return;
+    }
+    tcb->dup_acks += 1;
+    if (tcb->dup_acks >= GNRC_TCP_DUPACK_THRESHOLD) {
+        DEBUG("gnrc_tcp_fsm.c : _dup_ack() : Enter fast recovery\n");
+        tcb->status |= STATUS_FAST_RECOVERY;
+        tcb->recover = tcb->snd_nxt;
+        tcb->high_rxt = tcb->snd_una;
+        _fast_retransmit(tcb);
+    }
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -123,8 +171,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and held out-of-order segments */
             _clear_retransmit(tcb);
+            _pkt_ooo_clear(tcb);
 
             /* Remove connection from active connections */
             mutex_lock(&_list_tcb_lock);
@@ -148,6 +197,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
 #endif
             tcb->peer_port = PORT_UNSPEC;
 
+            /* Reset SACK and loss recovery state */
+            _pkt_ooo_clear(tcb);
+            tcb->status &= ~(STATUS_SACK_PERMITTED | STATUS_FAST_RECOVERY);
+            tcb->dup_acks = 0;
+
             /* Allocate receive buffer */
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
                 return -ENOMEM;
@@ -163,6 +217,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_SENT:
+            /* Reset SACK and loss recovery state */
+            tcb->status &= ~(STATUS_SACK_PERMITTED | STATUS_FAST_RECOVERY);
+            tcb->dup_acks = 0;
+
             /* Allocate rceveive buffer */
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
                 return -ENOMEM;
@@ -221,7 +279,6 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     int ret = 0;
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_open()\n");
-    tcb->rcv_wnd = GNRC_TCP_DEFAULT_WINDOW;
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -229,6 +286,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
             _transition_to(tcb, FSM_STATE_CLOSED);
             return -ENOMEM;
         }
+        tcb->rcv_wnd = _rcvbuf_get_window(tcb);
     }
     else {
         /* Active Open, set TCB values, send SYN, T: CLOSED -> SYN_SENT */
@@ -242,6 +300,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
             _transition_to(tcb, FSM_STATE_CLOSED);
             return ret;
         }
+        tcb->rcv_wnd = _rcvbuf_get_window(tcb);
 
         /* Send SYN */
         gnrc_pktsnip_t *out_pkt = NULL;
@@ -256,6 +315,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * Sends as many segments as the send window, the send buffer and the
+ * retransmission queue allow.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
@@ -266,24 +328,39 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    while (sent < len && tcb->pkt_retransmit_num < GNRC_TCP_SND_QUEUE_SIZE) {
+        uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+        size_t payload = 0;
+
+        /* Check if window and send buffer are open */
+        if (in_flight < tcb->snd_wnd && in_flight < GNRC_TCP_SND_BUF_SIZE) {
+            payload = tcb->snd_wnd - in_flight;
+            payload = (payload < (GNRC_TCP_SND_BUF_SIZE - in_flight)) ?
+                      payload : (GNRC_TCP_SND_BUF_SIZE - in_flight);
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
         payload = (payload < GNRC_TCP_MSS) ? payload : GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
+        if (payload == 0) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
+        /* Build segment, stop if the packet buffer is full */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt,
+                       ((uint8_t *) buf) + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
     }
-    return 0;
+    return sent;
 }
 
 /**
@@ -299,16 +376,18 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_recv()\n");
 
-    if (ringbuffer_empty(&tcb->rcv_buf)) {
+    if (tcb->rcv_len == 0) {
         return 0;
     }
 
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    size_t rcvd = _rcvbuf_get(tcb, buf, len);
 
-    /* If receive buffer can store more than GNRC_TCP_MSS: open window to available buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    /* If receive buffer can store more than GNRC_TCP_MSS or was read completely: */
+    /* open window to available buffer size */
+    uint16_t wnd = _rcvbuf_get_window(tcb);
+    if (wnd >= GNRC_TCP_MSS || tcb->rcv_len == 0) {
+        tcb->rcv_wnd = wnd;
 
         /* Send ACK to anounce window update */
         gnrc_pktsnip_t *out_pkt = NULL;
@@ -505,6 +584,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
             tcb->snd_wnd = seg_wnd;
+            tcb->rcv_wnd = _rcvbuf_get_window(tcb);
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss, tcb->rcv_nxt, NULL, 0);
@@ -633,6 +713,26 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
                     _pkt_acknowledge(tcb, seg_ack);
+                    tcb->dup_acks = 0;
+
+                    /* Partial ACK: retransmit next hole, full ACK: leave fast recovery */
+                    if (tcb->status & STATUS_FAST_RECOVERY) {
+                        if (LSS_32_BIT(seg_ack, tcb->recover)) {
+                            _fast_retransmit(tcb);
+                        }
+                        else {
+                            tcb->status &= ~STATUS_FAST_RECOVERY;
+                        }
+                    }
+
+                    /* Signal user: send buffer space was freed */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK: Nothing new acknowledged and no window update */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && seg_wnd == tcb->snd_wnd &&
+                         tcb->pkt_retransmit_num > 0) {
+                    _dup_ack(tcb);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -656,25 +756,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionaly if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -689,21 +789,21 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                /* Accept data that starts at or before the next expected byte */
+                if (LEQ_32_BIT(seg_seq, tcb->rcv_nxt)) {
+                    /* Copy new contents into receive buffer, then held segments behind it */
+                    _pkt_add_payload(tcb, in_pkt, tcb->rcv_nxt - seg_seq);
+                    _pkt_ooo_drain(tcb);
+
                     /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                    tcb->rcv_wnd = _rcvbuf_get_window(tcb);
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Hold data behind a hole, it is reported via SACK */
+                else {
+                    _pkt_ooo_add(tcb, in_pkt);
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
@@ -719,6 +819,12 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_SYN_SENT) {
                 return 0;
             }
+            /* Process FIN only if all data in front of it was received, ACK otherwise */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
+                _pkt_send(tcb, out_pkt, seq_con, false);
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
@@ -728,7 +834,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_num == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -770,9 +876,12 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_num > 0) {
+        /* A timeout ends fast recovery */
+        tcb->status &= ~STATUS_FAST_RECOVERY;
+        tcb->dup_acks = 0;
+        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
@@ -892,6 +1001,9 @@ int _fsm(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip_t *in_pkt, void *b
     mutex_lock(&(tcb->fsm_lock));
 
     /* Call FSM */
+#ifdef MODULE_GNRC_TCP_EVENT
+    uint8_t prev_state = tcb->state;
+#endif
     tcb->status &= ~STATUS_NOTIFY_USER;
     int32_t result = _fsm_unprotected(tcb, event, in_pkt, buf, len);
 
@@ -901,6 +1013,24 @@ int _fsm(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip_t *in_pkt, void *b
         msg.type = MSG_TYPE_NOTIFY_USER;
         mbox_try_put(&(tcb->mbox), &msg);
     }
+#ifdef MODULE_GNRC_TCP_EVENT
+    /* Event based connections: Post event and handle the connection timeout */
+    if (tcb->evq != NULL) {
+        if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_LISTEN) {
+            xtimer_remove(&tcb->tim_conn);
+        }
+        else if ((tcb->status & STATUS_NOTIFY_USER) || tcb->state != prev_state) {
+            /* Connection is alive: Restart connection timeout */
+            tcb->msg_conn.type = MSG_TYPE_CONNECTION_TIMEOUT;
+            tcb->msg_conn.content.ptr = (void *) tcb;
+            xtimer_set_msg(&tcb->tim_conn, GNRC_TCP_CONNECTION_TIMEOUT_DURATION,
+                           &tcb->msg_conn, gnrc_tcp_pid);
+        }
+        if (tcb->status & STATUS_NOTIFY_USER) {
+            event_post(tcb->evq, &tcb->event);
+        }
+    }
+#endif
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
     return result;
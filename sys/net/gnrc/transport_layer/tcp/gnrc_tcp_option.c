@@ -18,6 +18,7 @@
  */
 #include "internal/common.h"
 #include "internal/option.h"
+#include "internal/pkt.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -30,6 +31,9 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
         return 0;
     }
 
+    /* Extract control bits, SACK permitted is only valid in SYN segments */
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
     /* Get pointer to option field and field size */
     uint8_t *opt_ptr = (uint8_t *) hdr + sizeof(tcp_hdr_t);
     uint8_t opt_left = (offset - TCP_HDR_OFFSET_MIN) * 4;
@@ -38,6 +42,13 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     while (opt_left > 0) {
         tcp_hdr_opt_t *option = (tcp_hdr_opt_t *) opt_ptr;
 
+        /* All options except EOL and NOP carry a length byte */
+        if (option->kind != TCP_OPTION_KIND_EOL && option->kind != TCP_OPTION_KIND_NOP &&
+            (opt_left < 2 || option->length < 2 || option->length > opt_left)) {
+            DEBUG("gnrc_tcp_option.c : _option_parse() : invalid option length.\n");
+            return -1;
+        }
+
         /* Examine current option */
         switch (option->kind) {
             case TCP_OPTION_KIND_EOL:
@@ -60,6 +71,38 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                       tcb->mss);
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK_PERM length.\n");
+                    return -1;
+                }
+                if (ctl & MSK_SYN) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK_PERM option found.\n");
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (option->length < TCP_OPTION_LENGTH_SACK_MIN ||
+                    ((option->length - 2) % TCP_OPTION_LENGTH_SACK_BLOCK) != 0) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK length.\n");
+                    return -1;
+                }
+                /* Update the scoreboard, if SACK was negotiated for this connection */
+                if ((ctl & MSK_ACK) && (tcb->status & STATUS_SACK_PERMITTED)) {
+                    for (uint8_t i = 0; i < option->length - 2; i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                        uint8_t *v = &option->value[i];
+                        uint32_t left = ((uint32_t) v[0] << 24) | ((uint32_t) v[1] << 16) |
+                                        ((uint32_t) v[2] << 8) | v[3];
+                        uint32_t right = ((uint32_t) v[4] << 24) | ((uint32_t) v[5] << 16) |
+                                         ((uint32_t) v[6] << 8) | v[7];
+
+                        _pkt_sack(tcb, left, right);
+                    }
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK option found.\n");
+                break;
+
             default:
                 DEBUG("gnrc_tcp_option.c : _option_parse() : Unknown option found.\
                       KIND=%"PRIu8", LENGTH=%"PRIu8"\n", option->kind, option->length);
@@ -69,3 +112,45 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     }
     return 0;
 }
+
+uint8_t _option_build_sack(const gnrc_tcp_tcb_t *tcb, network_uint32_t *opt)
+{
+    uint32_t left[OPTION_SACK_BLOCKS_MAX];
+    uint32_t right[OPTION_SACK_BLOCKS_MAX];
+    uint8_t num = 0;
+
+    /* Build one block per held segment, starting with the most recent one (RFC 2018, 4) */
+    for (int i = tcb->pkt_ooo_num - 1; i >= 0; i--) {
+        uint32_t l = _pkt_get_seq_num(tcb->pkt_ooo[i]);
+        uint32_t r = l + _pkt_get_pay_len(tcb->pkt_ooo[i]);
+        uint8_t j;
+
+        /* Merge segments that overlap or adjoin an existing block */
+        for (j = 0; j < num; j++) {
+            if (LEQ_32_BIT(l, right[j]) && LEQ_32_BIT(left[j], r)) {
+                left[j] = LSS_32_BIT(l, left[j]) ? l : left[j];
+                right[j] = LSS_32_BIT(right[j], r) ? r : right[j];
+                break;
+            }
+        }
+        if (j == num && num < OPTION_SACK_BLOCKS_MAX) {
+            left[num] = l;
+            right[num] = r;
+            num++;
+        }
+    }
+    if (num == 0) {
+        return 0;
+    }
+
+    /* Two NOPs keep the blocks 32-bit aligned */
+    opt[0] = byteorder_htonl(((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+                             ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+                             ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+                             (2 + num * TCP_OPTION_LENGTH_SACK_BLOCK));
+    for (uint8_t i = 0; i < num; i++) {
+        opt[1 + 2 * i] = byteorder_htonl(left[i]);
+        opt[2 + 2 * i] = byteorder_htonl(right[i]);
+    }
+    return 1 + 2 * num;
+}
@@ -25,6 +25,7 @@
 #include "internal/common.h"
 #include "internal/option.h"
 #include "internal/pkt.h"
+#include "internal/rcvbuf.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -169,8 +170,23 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
 
     /* Calculate option field size. */
     /* Add MSS option if SYN is sent */
+    network_uint32_t sack_option[1 + 2 * OPTION_SACK_BLOCKS_MAX];
+    uint8_t sack_len = 0;
+    bool sack_perm = false;
+
     if (ctl & MSK_SYN) {
         offset += 1;
+
+        /* Offer SACK in a SYN, confirm it in a SYN-ACK only if the peer offered it */
+        if (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED)) {
+            sack_perm = true;
+            offset += 1;
+        }
+    }
+    /* Report held out-of-order segments in every other ACK */
+    else if ((ctl & MSK_ACK) && (tcb->status & STATUS_SACK_PERMITTED)) {
+        sack_len = _option_build_sack(tcb, sack_option);
+        offset += sack_len;
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
@@ -196,8 +212,20 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
             if (ctl & MSK_SYN) {
                 network_uint32_t mss_option = byteorder_htonl(_option_build_mss(GNRC_TCP_MSS));
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Add SACK permitted option */
+            if (sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(_option_build_sack_perm());
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
             }
-            /* Increase opt_ptr and decrease opt_ptr, if other options are added */
+            /* Add SACK option */
+            if (sack_len > 0) {
+                memcpy(opt_ptr, sack_option, sack_len * sizeof(network_uint32_t));
+                opt_ptr += sack_len * sizeof(network_uint32_t);
+            }
+            /* Increase opt_ptr, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -260,11 +288,9 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
     }
     else {
         tcb->retries += 1;
@@ -307,6 +333,14 @@ int _pkt_chk_seq_num(const gnrc_tcp_tcb_t *tcb, const uint32_t seq_num, const ui
     return -1;
 }
 
+uint32_t _pkt_get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = NULL;
+
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+    return byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+}
+
 uint32_t _pkt_get_seg_len(gnrc_pktsnip_t *pkt)
 {
     uint32_t seq = 0;
@@ -339,6 +373,44 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Restarts the retransmission timer for the oldest unacknowledged segment.
+ *
+ * @param[in,out] tcb   TCB holding the retransmission timer.
+ */
+static void _restart_retransmit_timer(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundry checks on current RTO before usage */
+    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    xtimer_remove(&tcb->tim_tout);
+    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
+    tcb->msg_tout.content.ptr = (void *) tcb;
+    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
+/**
+ * @brief Calculates the RTO from the current RTT estimation.
+ *
+ * @param[in,out] tcb   TCB holding the RTT estimation.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without a measurement, rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(GNRC_TCP_RTO_GRANULARITY,  GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
 {
     gnrc_pktsnip_t *snp = NULL;
@@ -351,10 +423,33 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
-        return -ENOMEM;
+    /* Only the oldest segment is ever retransmitted */
+    if (retransmit) {
+        if (tcb->pkt_retransmit_num == 0 || tcb->pkt_retransmit[0] != pkt) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Not the oldest segment\n");
+            return -EINVAL;
+        }
+
+        /* Every send attempt consumes a user */
+        gnrc_pktbuf_hold(pkt, 1);
+
+        /* Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* Karns Algorithm: Do not take RTT samples from retransmitted segments */
+        tcb->status &= ~STATUS_RTT_PENDING;
+
+        /* After a timeout the receiver may have dropped SACKed data (RFC 2018, 8) */
+        memset(tcb->pkt_sacked, 0, sizeof(tcb->pkt_sacked));
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+        _restart_retransmit_timer(tcb);
+        return 0;
     }
 
     /* Extract control bits and segment length */
@@ -367,76 +462,73 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(GNRC_TCP_RTO_GRANULARITY,  GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+    /* Check if retransmit queue is full */
+    if (tcb->pkt_retransmit_num >= GNRC_TCP_SND_QUEUE_SIZE) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Retransmit queue is full\n");
+        return -ENOMEM;
     }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
 
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
-    }
+    /* Append pkt and increase users: every send attempt consumes a user */
+    tcb->pkt_sacked[tcb->pkt_retransmit_num] = false;
+    tcb->pkt_retransmit[tcb->pkt_retransmit_num++] = pkt;
+    gnrc_pktbuf_hold(pkt, 1);
 
-    /* Perform boundry checks on current RTO before usage */
-    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
-    }
-    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
+    /* Time one segment per round trip, if no other segment is timed right now */
+    if (!(tcb->status & STATUS_RTT_PENDING)) {
+        tcb->status |= STATUS_RTT_PENDING;
+        tcb->rtt_start = xtimer_now().ticks32;
+        tcb->rtt_seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num) +
+                       _pkt_get_seg_len(pkt);
     }
 
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
-    tcb->msg_tout.content.ptr = (void *) tcb;
-    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+    /* The timer runs for the oldest segment: Start it if pkt is the only one */
+    if (tcb->pkt_retransmit_num == 1) {
+        tcb->retries = 0;
+        _calc_rto(tcb);
+        _restart_retransmit_timer(tcb);
+    }
     return 0;
 }
 
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    uint8_t acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_num == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
+    /* Release every segment that is acknowledged completely */
+    while (acked < tcb->pkt_retransmit_num) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[acked];
+        uint32_t seg = _pkt_get_seq_num(pkt) + _pkt_get_seg_len(pkt) - 1;
 
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->tim_tout));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
+    if (acked == 0) {
+        return 0;
+    }
+    tcb->pkt_retransmit_num -= acked;
+    memmove(tcb->pkt_retransmit, &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_num * sizeof(tcb->pkt_retransmit[0]));
+    memmove(tcb->pkt_sacked, &tcb->pkt_sacked[acked],
+            tcb->pkt_retransmit_num * sizeof(tcb->pkt_sacked[0]));
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
 
-        /* Use time only if ther was no timer overflow and no retransmission (Karns Alogrithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_PENDING;
+
+        /* Use time only if ther was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -451,9 +543,133 @@ int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Restart the timer for the remaining segments (RFC 6298, 5.3) */
+    if (tcb->pkt_retransmit_num > 0) {
+        _calc_rto(tcb);
+        _restart_retransmit_timer(tcb);
+    }
+    else {
+        xtimer_remove(&tcb->tim_tout);
+    }
     return 0;
 }
 
+void _pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    /* Ignore blocks that are empty or below the cumulative ACK */
+    if (!LSS_32_BIT(left, right) || !LEQ_32_BIT(tcb->snd_una, left)) {
+        return;
+    }
+
+    /* Mark every segment that lies inside the block completely */
+    for (uint8_t i = 0; i < tcb->pkt_retransmit_num; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t seq = _pkt_get_seq_num(pkt);
+
+        if (LEQ_32_BIT(left, seq) && LEQ_32_BIT(seq + _pkt_get_seg_len(pkt), right)) {
+            tcb->pkt_sacked[i] = true;
+        }
+    }
+}
+
+int _pkt_get_next_lost(const gnrc_tcp_tcb_t *tcb)
+{
+    for (uint8_t i = 0; i < tcb->pkt_retransmit_num; i++) {
+        uint32_t seq = _pkt_get_seq_num(tcb->pkt_retransmit[i]);
+        bool lost = (i == 0);
+
+        if (tcb->pkt_sacked[i] || LSS_32_BIT(seq, tcb->high_rxt)) {
+            continue;
+        }
+        if (!LSS_32_BIT(seq, tcb->recover)) {
+            break;
+        }
+        for (uint8_t j = i + 1; j < tcb->pkt_retransmit_num && !lost; j++) {
+            lost = tcb->pkt_sacked[j];
+        }
+        if (!lost) {
+            break;
+        }
+        return i;
+    }
+    return -1;
+}
+
+void _pkt_add_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t skip)
+{
+    gnrc_pktsnip_t *snp = NULL;
+
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_UNDEF);
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (skip < snp->size) {
+            size_t len = snp->size - skip;
+            size_t added = _rcvbuf_add(tcb, (uint8_t *) snp->data + skip, len);
+
+            tcb->rcv_nxt += added;
+            /* Stop if the receive buffer is full */
+            if (added < len) {
+                break;
+            }
+            skip = 0;
+        }
+        else {
+            skip -= snp->size;
+        }
+        snp = snp->next;
+    }
+}
+
+void _pkt_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    uint32_t seq = _pkt_get_seq_num(pkt);
+
+    for (unsigned i = 0; i < tcb->pkt_ooo_num; i++) {
+        if (_pkt_get_seq_num(tcb->pkt_ooo[i]) == seq) {
+            return;
+        }
+    }
+    /* Drop segment if the queue is full, the peer will retransmit it */
+    if (tcb->pkt_ooo_num >= GNRC_TCP_OOO_QUEUE_SIZE) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_ooo_add() : Out-of-order queue is full\n");
+        return;
+    }
+    gnrc_pktbuf_hold(pkt, 1);
+    tcb->pkt_ooo[tcb->pkt_ooo_num++] = pkt;
+}
+
+void _pkt_ooo_drain(gnrc_tcp_tcb_t *tcb)
+{
+    unsigned i = 0;
+
+    while (i < tcb->pkt_ooo_num) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_ooo[i];
+        uint32_t seq = _pkt_get_seq_num(pkt);
+
+        if (!LEQ_32_BIT(seq, tcb->rcv_nxt)) {
+            i++;
+            continue;
+        }
+        /* Segment starts at or before rcv_nxt: take what is new, then rescan */
+        if (LSS_32_BIT(tcb->rcv_nxt, seq + _pkt_get_pay_len(pkt))) {
+            _pkt_add_payload(tcb, pkt, tcb->rcv_nxt - seq);
+        }
+        gnrc_pktbuf_release(pkt);
+        tcb->pkt_ooo_num--;
+        memmove(&tcb->pkt_ooo[i], &tcb->pkt_ooo[i + 1],
+                (tcb->pkt_ooo_num - i) * sizeof(tcb->pkt_ooo[0]));
+        i = 0;
+    }
+}
+
+void _pkt_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    for (unsigned i = 0; i < tcb->pkt_ooo_num; i++) {
+        gnrc_pktbuf_release(tcb->pkt_ooo[i]);
+    }
+    tcb->pkt_ooo_num = 0;
+}
+
 uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr,
                         const gnrc_pktsnip_t *payload)
 {
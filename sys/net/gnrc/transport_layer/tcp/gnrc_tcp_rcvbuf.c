@@ -16,13 +16,14 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 #include <errno.h>
+#include <string.h>
 #include "internal/rcvbuf.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
 /**
- * @brief Internal struct holding receive buffers.
+ * @brief Internal struct holding the receive buffer pool.
  */
 rcvbuf_t _static_buf;
 
@@ -33,69 +34,237 @@ void _rcvbuf_init(void)
 {
     DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_init() : entry\n");
     mutex_init(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        _static_buf.entries[i].used = 0;
+    _static_buf.free = NULL;
+    for (size_t i = 0; i < GNRC_TCP_RCV_CHUNKS; ++i) {
+        _static_buf.chunks[i].next = _static_buf.free;
+        _static_buf.free = &_static_buf.chunks[i];
     }
+    _static_buf.free_num = GNRC_TCP_RCV_CHUNKS;
+    _static_buf.reserved = 0;
+    _static_buf.users = 0;
 }
 
 /**
- * @brief Allocate receive buffer.
+ * @brief Borrow a chunk from the pool.
  *
- * @returns   Not NULL if a receive buffer was allocated.
+ * @note Must be called with the pool locked.
+ *
+ * @returns   Not NULL if a chunk was allocated.
  *            NULL if allocation failed.
  */
-static void* _rcvbuf_alloc(void)
+static rcvbuf_chunk_t *_rcvbuf_alloc(void)
 {
-    void *result = NULL;
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_alloc() : Entry\n");
-    mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        if (_static_buf.entries[i].used == 0) {
-            _static_buf.entries[i].used = 1;
-            result = (void *)(_static_buf.entries[i].buffer);
-            break;
-        }
+    rcvbuf_chunk_t *chunk = _static_buf.free;
+
+    if (chunk != NULL) {
+        _static_buf.free = chunk->next;
+        _static_buf.free_num--;
+        chunk->next = NULL;
     }
-    mutex_unlock(&(_static_buf.lock));
-    return result;
+    return chunk;
 }
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Borrow a chunk for a TCB, preferring chunks reserved by it.
+ *
+ * Without a reservation, only chunks that are not reserved by any TCB are
+ * handed out, so that the windows advertised by other TCBs stay covered.
+ *
+ * @note Must be called with the pool locked.
+ *
+ * @param[in,out] tcb   TCB that borrows the chunk.
  *
- * @param[in] buf   Pointer to buffer that should be released.
+ * @returns   Not NULL if a chunk was allocated.
+ *            NULL if allocation failed.
  */
-static void _rcvbuf_free(void * const buf)
+static rcvbuf_chunk_t *_rcvbuf_alloc_for(gnrc_tcp_tcb_t *tcb)
 {
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_free() : Entry\n");
-    mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
-            _static_buf.entries[i].used = 0;
-        }
+    if (tcb->rcv_reserved > 0) {
+        tcb->rcv_reserved--;
+        _static_buf.reserved--;
     }
-    mutex_unlock(&(_static_buf.lock));
+    else if (_static_buf.free_num <= _static_buf.reserved) {
+        return NULL;
+    }
+    return _rcvbuf_alloc();
+}
+
+/**
+ * @brief Return a chunk to the pool.
+ *
+ * @note Must be called with the pool locked.
+ *
+ * @param[in] chunk   Chunk that should be released.
+ */
+static void _rcvbuf_free(rcvbuf_chunk_t *chunk)
+{
+    chunk->next = _static_buf.free;
+    _static_buf.free = chunk;
+    _static_buf.free_num++;
 }
 
 int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->rcv_buf_raw == NULL) {
-        tcb->rcv_buf_raw = _rcvbuf_alloc();
-        if (tcb->rcv_buf_raw == NULL) {
-            DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_get_buffer() : Can't allocate rcv_buf_raw\n");
+    if (tcb->rcv_head == NULL) {
+        mutex_lock(&(_static_buf.lock));
+        tcb->rcv_reserved = 0;
+        tcb->rcv_head = _rcvbuf_alloc_for(tcb);
+        if (tcb->rcv_head == NULL) {
+            mutex_unlock(&(_static_buf.lock));
+            DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_get_buffer() : Can't allocate chunk\n");
             return -ENOMEM;
         }
-        else {
-            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
-        }
+        _static_buf.users++;
+        mutex_unlock(&(_static_buf.lock));
+        tcb->rcv_tail = tcb->rcv_head;
+        tcb->rcv_rd = 0;
+        tcb->rcv_len = 0;
+        tcb->rcv_chunks = 1;
     }
     return 0;
 }
 
 void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
-        tcb->rcv_buf_raw = NULL;
+    if (tcb->rcv_head != NULL) {
+        mutex_lock(&(_static_buf.lock));
+        while (tcb->rcv_head != NULL) {
+            rcvbuf_chunk_t *next = tcb->rcv_head->next;
+
+            _rcvbuf_free(tcb->rcv_head);
+            tcb->rcv_head = next;
+        }
+        _static_buf.reserved -= tcb->rcv_reserved;
+        _static_buf.users--;
+        mutex_unlock(&(_static_buf.lock));
+        tcb->rcv_tail = NULL;
+        tcb->rcv_rd = 0;
+        tcb->rcv_len = 0;
+        tcb->rcv_chunks = 0;
+        tcb->rcv_reserved = 0;
+    }
+}
+
+size_t _rcvbuf_add(gnrc_tcp_tcb_t *tcb, const void *data, size_t len)
+{
+    const uint8_t *src = data;
+    size_t added = 0;
+
+    if (tcb->rcv_head == NULL) {
+        return 0;
+    }
+
+    /* Limit to the maximum buffer size of a single connection */
+    if (len > (size_t)(GNRC_TCP_RCV_BUF_SIZE - tcb->rcv_len)) {
+        len = GNRC_TCP_RCV_BUF_SIZE - tcb->rcv_len;
+    }
+
+    while (added < len) {
+        /* Write position in the tail chunk */
+        size_t wr = tcb->rcv_rd + tcb->rcv_len -
+                    (size_t)(tcb->rcv_chunks - 1) * GNRC_TCP_RCV_CHUNK_SIZE;
+        size_t n;
+
+        /* Tail chunk is full: Borrow another one */
+        if (wr == GNRC_TCP_RCV_CHUNK_SIZE) {
+            mutex_lock(&(_static_buf.lock));
+            rcvbuf_chunk_t *chunk = _rcvbuf_alloc_for(tcb);
+            mutex_unlock(&(_static_buf.lock));
+            if (chunk == NULL) {
+                DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_add() : Pool is exhausted\n");
+                break;
+            }
+            tcb->rcv_tail->next = chunk;
+            tcb->rcv_tail = chunk;
+            tcb->rcv_chunks++;
+            wr = 0;
+        }
+        n = GNRC_TCP_RCV_CHUNK_SIZE - wr;
+        if (n > len - added) {
+            n = len - added;
+        }
+        memcpy(&tcb->rcv_tail->data[wr], src + added, n);
+        tcb->rcv_len += n;
+        added += n;
+    }
+    return added;
+}
+
+size_t _rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    uint8_t *dst = buf;
+    size_t rcvd = 0;
+
+    if (len > tcb->rcv_len) {
+        len = tcb->rcv_len;
+    }
+
+    while (rcvd < len) {
+        size_t n = GNRC_TCP_RCV_CHUNK_SIZE - tcb->rcv_rd;
+
+        if (n > len - rcvd) {
+            n = len - rcvd;
+        }
+        memcpy(dst + rcvd, &tcb->rcv_head->data[tcb->rcv_rd], n);
+        tcb->rcv_rd += n;
+        tcb->rcv_len -= n;
+        rcvd += n;
+
+        /* Head chunk was read completely: Return it, but keep the last one */
+        if (tcb->rcv_rd == GNRC_TCP_RCV_CHUNK_SIZE && tcb->rcv_chunks > 1) {
+            rcvbuf_chunk_t *chunk = tcb->rcv_head;
+
+            tcb->rcv_head = chunk->next;
+            tcb->rcv_chunks--;
+            tcb->rcv_rd = 0;
+            mutex_lock(&(_static_buf.lock));
+            _rcvbuf_free(chunk);
+            mutex_unlock(&(_static_buf.lock));
+        }
+    }
+
+    /* Buffer is empty: Start over at the beginning of the remaining chunk */
+    if (tcb->rcv_len == 0) {
+        tcb->rcv_rd = 0;
+    }
+    return rcvd;
+}
+
+uint16_t _rcvbuf_get_window(gnrc_tcp_tcb_t *tcb)
+{
+    size_t wnd;
+    size_t max;
+
+    if (tcb->rcv_head == NULL) {
+        return 0;
+    }
+
+    /* Free space in the chunks held or reserved by this connection */
+    wnd = (size_t) tcb->rcv_chunks * GNRC_TCP_RCV_CHUNK_SIZE - tcb->rcv_rd - tcb->rcv_len;
+    max = GNRC_TCP_RCV_BUF_SIZE - tcb->rcv_len;
+
+    /* Reserve up to a fair share of the unreserved chunks to open the window further.
+     * Advertised space is never handed to another connection, so the window never
+     * has to shrink (RFC 793, 3.7). */
+    mutex_lock(&(_static_buf.lock));
+    wnd += (size_t) tcb->rcv_reserved * GNRC_TCP_RCV_CHUNK_SIZE;
+    if (wnd < max) {
+        size_t need = (max - wnd + GNRC_TCP_RCV_CHUNK_SIZE - 1) / GNRC_TCP_RCV_CHUNK_SIZE;
+        size_t share = (size_t)(_static_buf.free_num - _static_buf.reserved) /
+                       _static_buf.users;
+
+        if (need > share) {
+            need = share;
+        }
+        tcb->rcv_reserved += need;
+        _static_buf.reserved += need;
+        wnd += need * GNRC_TCP_RCV_CHUNK_SIZE;
+    }
+    mutex_unlock(&(_static_buf.lock));
+
+    /* Limit to the maximum buffer size of a single connection */
+    if (wnd > max) {
+        wnd = max;
     }
+    return (wnd > UINT16_MAX) ? UINT16_MAX : (uint16_t) wnd;
 }
@@ -44,6 +44,23 @@ static inline uint32_t _option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Maximum number of blocks in a generated SACK option.
+ */
+#define OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Helper function to build the SACK permitted option, prefixed with two NOPs.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -69,6 +86,17 @@ static inline uint16_t _option_build_offset_control(uint16_t nopts, uint16_t ctl
  */
 int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
+/**
+ * @brief Builds the SACK option from the out-of-order segments held by a TCB.
+ *
+ * @param[in]  tcb   TCB holding the out-of-order segments.
+ * @param[out] opt   Buffer for the option, must hold 1 + 2 * OPTION_SACK_BLOCKS_MAX words.
+ *
+ * @returns   Number of 32-bit words written to @p opt.
+ *            Zero if no segments are held.
+ */
+uint8_t _option_build_sack(const gnrc_tcp_tcb_t *tcb, network_uint32_t *opt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -89,6 +89,15 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
  */
 int _pkt_chk_seq_num(const gnrc_tcp_tcb_t *tcb, const uint32_t seq_num, const uint32_t seg_len);
 
+/**
+ * @brief Extracts the sequence number of a segment.
+ *
+ * @param[in] pkt   Packet to extract the sequence number from.
+ *
+ * @returns   Sequence number of the segment.
+ */
+uint32_t _pkt_get_seq_num(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief Extracts the length of a segment.
  *
@@ -131,6 +140,66 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
  */
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks segments in the retransmission mechanism as selectively acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the SACK block.
+ * @param[in]     right   Right edge of the SACK block.
+ */
+void _pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
+/**
+ * @brief Finds the next segment to retransmit during fast recovery.
+ *
+ * The oldest unacknowledged segment counts as lost as soon as fast recovery is
+ * entered or a partial ACK arrives. Any other segment counts as lost once a
+ * later segment was selectively acknowledged. Segments below
+ * gnrc_tcp_tcb_t::high_rxt were retransmitted already.
+ *
+ * @param[in] tcb   TCB holding the retransmission queue.
+ *
+ * @returns   Index in gnrc_tcp_tcb_t::pkt_retransmit of the segment to retransmit.
+ *            -1 if no segment is considered lost.
+ */
+int _pkt_get_next_lost(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Copies the payload of a segment into the receive buffer.
+ *
+ * Advances gnrc_tcp_tcb_t::rcv_nxt by the number of bytes copied.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     pkt    Segment to copy the payload from.
+ * @param[in]     skip   Number of leading payload bytes that were received already.
+ */
+void _pkt_add_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t skip);
+
+/**
+ * @brief Holds a segment that was received out of order.
+ *
+ * The segment is dropped if a segment with the same sequence number is held
+ * already or the queue is full.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ * @param[in]     pkt   Received segment.
+ */
+void _pkt_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Delivers held out-of-order segments that became in-order.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+void _pkt_ooo_drain(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Releases all held out-of-order segments.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+void _pkt_ooo_clear(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
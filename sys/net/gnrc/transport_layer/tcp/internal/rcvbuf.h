@@ -22,6 +22,7 @@
 #ifndef RCVBUF_H
 #define RCVBUF_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "mutex.h"
 #include "net/gnrc/tcp/config.h"
@@ -32,19 +33,24 @@ extern "C" {
 #endif
 
 /**
- * @brief Receive buffer entry.
+ * @brief Receive buffer chunk.
  */
-typedef struct rcvbuf_entry {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} rcvbuf_entry_t;
+typedef struct rcvbuf_chunk {
+    struct rcvbuf_chunk *next;             /**< Next chunk in the pool or connection */
+    uint8_t data[GNRC_TCP_RCV_CHUNK_SIZE]; /**< Chunk storage */
+} rcvbuf_chunk_t;
 
 /**
- * @brief   Stuct holding receive buffers.
+ * @brief   Struct holding the shared receive buffer pool.
  */
 typedef struct rcvbuf {
-    mutex_t lock;                                 /**< Lock for allocation synchronization */
-    rcvbuf_entry_t entries[GNRC_TCP_RCV_BUFFERS]; /**< Maintained receive buffers */
+    mutex_t lock;                               /**< Lock for allocation synchronization */
+    rcvbuf_chunk_t *free;                       /**< List of unused chunks */
+    uint16_t free_num;                          /**< Number of unused chunks */
+    uint16_t reserved;                          /**< Number of unused chunks reserved
+                                                 *   by connections */
+    uint16_t users;                             /**< Number of connections holding chunks */
+    rcvbuf_chunk_t chunks[GNRC_TCP_RCV_CHUNKS]; /**< Maintained chunks */
 } rcvbuf_t;
 
 /**
@@ -55,10 +61,12 @@ void _rcvbuf_init(void);
 /**
  * @brief Allocate receive buffer and assign it to TCB.
  *
+ * The TCB gets a single chunk. Further chunks are borrowed by _rcvbuf_add().
+ *
  * @param[in,out] tcb   TCB that aquires receive buffer.
  *
  * @returns   Zero  on success.
- *            -ENOMEM if all receive buffers are currently used.
+ *            -ENOMEM if all chunks are currently used.
  */
 int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
 
@@ -69,6 +77,48 @@ int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Appends data to the receive buffer of a TCB.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     data   Data to append.
+ * @param[in]     len    Number of bytes in @p data.
+ *
+ * Chunks reserved by _rcvbuf_get_window() are used first.
+ *
+ * @returns   Number of bytes appended. Less than @p len if the connection
+ *            reached @ref GNRC_TCP_RCV_BUF_SIZE or the pool ran out of chunks.
+ */
+size_t _rcvbuf_add(gnrc_tcp_tcb_t *tcb, const void *data, size_t len);
+
+/**
+ * @brief Reads data from the receive buffer of a TCB.
+ *
+ * Chunks that were read completely are returned to the pool.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[out]    buf   Buffer to store the data into.
+ * @param[in]     len   Size of @p buf.
+ *
+ * @returns   Number of bytes read.
+ */
+size_t _rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len);
+
+/**
+ * @brief Calculates the receive window a TCB can advertise.
+ *
+ * The window covers the free space in the chunks held by @p tcb and in the
+ * unused chunks reserved for it, limited by @ref GNRC_TCP_RCV_BUF_SIZE. To open
+ * the window further, @p tcb reserves up to a fair share of the unreserved
+ * chunks in the pool. Reserved chunks are only handed to @p tcb, so space
+ * that was advertised once stays available until it is filled.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Receive window in bytes.
+ */
+uint16_t _rcvbuf_get_window(gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -112,9 +112,8 @@ size_t ieee802154_set_frame_hdr(uint8_t *buf, const uint8_t *src, size_t src_len
     return pos;
 }
 
-size_t ieee802154_get_frame_hdr_len(const uint8_t *mhr)
+static size_t _get_addr_hdr_len(const uint8_t *mhr)
 {
-    /* TODO: include security header implications */
     uint8_t tmp;
     size_t len = 3; /* 2 byte FCF, 1 byte sequence number */
 
@@ -151,6 +150,20 @@ size_t ieee802154_get_frame_hdr_len(const uint8_t *mhr)
     return 0;
 }
 
+size_t ieee802154_get_frame_hdr_len(const uint8_t *mhr)
+{
+    size_t len = _get_addr_hdr_len(mhr);
+
+    if ((len > 0) && (mhr[0] & IEEE802154_FCF_SECURITY_EN)) {
+        /* auxiliary security header: security control, frame counter and
+         * key identifier of 0, 1, 5 or 9 bytes depending on its mode */
+        static const uint8_t key_id_len[] = { 0, 1, 5, 9 };
+
+        len += 5 + key_id_len[(mhr[len] >> 3) & 0x3];
+    }
+    return len;
+}
+
 int ieee802154_get_src(const uint8_t *mhr, uint8_t *src, le_uint16_t *src_pan)
 {
     int offset = 3; /* FCF: 0-1, Seq: 2 */
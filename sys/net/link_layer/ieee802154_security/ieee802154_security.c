@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_ieee802154_security
+ * @{
+ *
+ * @file
+ * @brief       IEEE 802.15.4 security implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "crypto/modes/ccm.h"
+#include "net/ieee802154_security.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/* extended source address, frame counter and security level */
+#define NONCE_LEN       (IEEE802154_LONG_ADDRESS_LEN + 5U)
+/* CCM* in IEEE 802.15.4 always uses a 2 byte length field */
+#define LENGTH_ENC      (2U)
+
+#define SEC_LEVEL_MASK  (0x07)
+#define KEY_ID_MASK     (0x18)
+
+static ieee802154_sec_key_t *_get_key(ieee802154_sec_context_t *ctx,
+                                      uint8_t index)
+{
+    for (unsigned i = 0; i < IEEE802154_SEC_KEY_NUMOF; i++) {
+        if ((index != 0) && (ctx->keys[i].index == index)) {
+            return &ctx->keys[i];
+        }
+    }
+    return NULL;
+}
+
+static void _set_nonce(uint8_t *nonce, const uint8_t *src,
+                       uint32_t frame_counter, uint8_t level)
+{
+    memcpy(nonce, src, IEEE802154_LONG_ADDRESS_LEN);
+    nonce += IEEE802154_LONG_ADDRESS_LEN;
+    nonce[0] = frame_counter >> 24;
+    nonce[1] = frame_counter >> 16;
+    nonce[2] = frame_counter >> 8;
+    nonce[3] = frame_counter;
+    nonce[4] = level;
+}
+
+static ieee802154_sec_neighbor_t *_get_neighbor(ieee802154_sec_context_t *ctx,
+                                                const uint8_t *addr)
+{
+    for (unsigned i = 0; i < ctx->neighbors_numof; i++) {
+        if (memcmp(ctx->neighbors[i].addr, addr,
+                   IEEE802154_LONG_ADDRESS_LEN) == 0) {
+            return &ctx->neighbors[i];
+        }
+    }
+    return NULL;
+}
+
+void ieee802154_sec_init(ieee802154_sec_context_t *ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+int ieee802154_sec_set_key(ieee802154_sec_context_t *ctx, uint8_t index,
+                           const uint8_t *key)
+{
+    ieee802154_sec_key_t *entry;
+
+    if (index == 0) {
+        return -EINVAL;
+    }
+    if ((entry = _get_key(ctx, index)) == NULL) {
+        /* index 0 marks unused entries */
+        for (unsigned i = 0; i < IEEE802154_SEC_KEY_NUMOF; i++) {
+            if (ctx->keys[i].index == 0) {
+                entry = &ctx->keys[i];
+                break;
+            }
+        }
+    }
+    if (entry == NULL) {
+        return -ENOMEM;
+    }
+    if (cipher_init(&entry->cipher, CIPHER_AES_128, key,
+                    IEEE802154_SEC_KEY_LEN) != CIPHER_INIT_SUCCESS) {
+        entry->index = 0;
+        return -EINVAL;
+    }
+    entry->index = index;
+    if (ctx->tx_key == 0) {
+        ctx->tx_key = index;
+    }
+    return 0;
+}
+
+int ieee802154_sec_encrypt(ieee802154_sec_context_t *ctx, uint8_t *mhr,
+                           size_t mhr_len, const uint8_t *src,
+                           uint8_t *payload, size_t payload_len)
+{
+    ieee802154_sec_key_t *key = _get_key(ctx, ctx->tx_key);
+    uint8_t nonce[NONCE_LEN];
+    uint8_t *aux = &mhr[mhr_len];
+    uint32_t frame_counter = ctx->frame_counter;
+
+    if (key == NULL) {
+        return -ENOENT;
+    }
+    /* 0xffffffff is reserved, a new key is needed at this point */
+    if (frame_counter == UINT32_MAX) {
+        return -EOVERFLOW;
+    }
+    ctx->frame_counter++;
+
+    aux[0] = IEEE802154_SEC_LEVEL | IEEE802154_SEC_KEY_ID_MODE_1;
+    aux[1] = frame_counter;
+    aux[2] = frame_counter >> 8;
+    aux[3] = frame_counter >> 16;
+    aux[4] = frame_counter >> 24;
+    aux[5] = key->index;
+    mhr_len += IEEE802154_SEC_AUX_HDR_LEN;
+
+    _set_nonce(nonce, src, frame_counter, IEEE802154_SEC_LEVEL);
+
+    iolist_t data = { .iol_base = payload, .iol_len = payload_len };
+    int res = cipher_encrypt_ccm_iolist(&key->cipher, mhr, mhr_len,
+                                        IEEE802154_SEC_MIC_LEN, LENGTH_ENC,
+                                        nonce, sizeof(nonce), &data,
+                                        &payload[payload_len]);
+    if (res < 0) {
+        DEBUG("ieee802154_sec: encryption failed (%d)\n", res);
+        return -EINVAL;
+    }
+    return mhr_len;
+}
+
+int ieee802154_sec_decrypt(ieee802154_sec_context_t *ctx, const uint8_t *mhr,
+                           size_t mhr_len, uint8_t *payload, size_t len)
+{
+    /* the auxiliary security header follows the addressing fields */
+    const uint8_t fcf[] = { mhr[0] & ~IEEE802154_FCF_SECURITY_EN, mhr[1] };
+    size_t pos = ieee802154_get_frame_hdr_len(fcf);
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t nonce[NONCE_LEN];
+    le_uint16_t pan;
+
+    if ((pos == 0) || (pos + IEEE802154_SEC_AUX_HDR_LEN != mhr_len) ||
+        ((mhr[pos] & KEY_ID_MASK) != IEEE802154_SEC_KEY_ID_MODE_1) ||
+        ((mhr[pos] & SEC_LEVEL_MASK) != IEEE802154_SEC_LEVEL)) {
+        DEBUG("ieee802154_sec: unsupported security control\n");
+        return -ENOTSUP;
+    }
+    if (ieee802154_get_src(mhr, src, &pan) != IEEE802154_LONG_ADDRESS_LEN) {
+        DEBUG("ieee802154_sec: no extended source address\n");
+        return -ENOTSUP;
+    }
+
+    const uint8_t level = IEEE802154_SEC_LEVEL;
+    const size_t mic_len = IEEE802154_SEC_MIC_LEN;
+    uint32_t frame_counter = mhr[pos + 1] | ((uint32_t)mhr[pos + 2] << 8) |
+                             ((uint32_t)mhr[pos + 3] << 16) |
+                             ((uint32_t)mhr[pos + 4] << 24);
+    ieee802154_sec_key_t *key = _get_key(ctx, mhr[pos + 5]);
+    ieee802154_sec_neighbor_t *neighbor = _get_neighbor(ctx, src);
+
+    if (len < mic_len) {
+        return -EBADMSG;
+    }
+    if (key == NULL) {
+        DEBUG("ieee802154_sec: unknown key %u\n", mhr[pos + 5]);
+        return -ENOENT;
+    }
+    if ((neighbor != NULL) && (frame_counter <= neighbor->frame_counter)) {
+        DEBUG("ieee802154_sec: replayed frame %" PRIu32 "\n", frame_counter);
+        return -EALREADY;
+    }
+    if ((neighbor == NULL) &&
+        (ctx->neighbors_numof >= IEEE802154_SEC_NEIGHBOR_NUMOF)) {
+        DEBUG("ieee802154_sec: no room for a new sender\n");
+        return -ENOSPC;
+    }
+    len -= mic_len;
+
+    _set_nonce(nonce, src, frame_counter, level);
+
+    iolist_t data = { .iol_base = payload, .iol_len = len };
+    if (cipher_decrypt_ccm_iolist(&key->cipher, mhr, mhr_len, mic_len,
+                                  LENGTH_ENC, nonce, sizeof(nonce), &data,
+                                  &payload[len]) < 0) {
+        DEBUG("ieee802154_sec: MIC mismatch\n");
+        return -EBADMSG;
+    }
+
+    /* only authentic frames may advance the replay state */
+    if (neighbor == NULL) {
+        neighbor = &ctx->neighbors[ctx->neighbors_numof++];
+        memcpy(neighbor->addr, src, sizeof(neighbor->addr));
+    }
+    neighbor->frame_counter = frame_counter;
+    return len;
+}
+
+int ieee802154_sec_del_neighbor(ieee802154_sec_context_t *ctx,
+                                const uint8_t *addr)
+{
+    ieee802154_sec_neighbor_t *neighbor = _get_neighbor(ctx, addr);
+
+    if (neighbor == NULL) {
+        return -ENOENT;
+    }
+    /* keep the used entries at the start of the table */
+    *neighbor = ctx->neighbors[--ctx->neighbors_numof];
+    return 0;
+}
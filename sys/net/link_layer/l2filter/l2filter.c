@@ -105,3 +105,28 @@ bool l2filter_pass(const l2filter_t *list, const void *addr, size_t addr_len)
 
     return res;
 }
+
+const l2filter_t *l2filter_whitelist_single(const l2filter_t *list,
+                                            size_t addr_len)
+{
+    assert(list);
+
+#ifdef MODULE_L2FILTER_WHITELIST
+    const l2filter_t *res = NULL;
+
+    for (unsigned i = 0; i < L2FILTER_LISTSIZE; i++) {
+        if (list[i].addr_len == 0) {
+            continue;
+        }
+        if ((res != NULL) || (list[i].addr_len != addr_len)) {
+            return NULL;
+        }
+        res = &list[i];
+    }
+    return res;
+#else
+    (void)addr_len;
+    /* a blacklist can not be expressed by matching a single address */
+    return NULL;
+#endif
+}
@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_netcap
+ * @{
+ *
+ * @file
+ * @brief       Packet capture implementation
+ *
+ * The ring buffer only ever holds complete pcapng blocks, so the streaming
+ * thread can pass it on without looking at the content.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+#include "xtimer.h"
+#include "net/netcap.h"
+
+#ifdef MODULE_NETCAP_UART
+#include "periph/uart.h"
+#else
+#include "stdio_base.h"
+#endif
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#define FLAG_DATA               (0x0001)
+
+#define BLOCK_SHB               (0x0A0D0D0AUL)
+#define BLOCK_IDB               (0x00000001UL)
+#define BLOCK_EPB               (0x00000006UL)
+#define BYTE_ORDER_MAGIC        (0x1A2B3C4DUL)
+
+#define LINKTYPE_ETHERNET       (1U)
+#define LINKTYPE_IEEE802_15_4   (230U)  /* without FCS */
+#define LINKTYPE_USER0          (147U)
+
+#define OPT_EPB_FLAGS           (2U)
+#define EPB_FLAGS_INBOUND       (1U)
+#define EPB_FLAGS_OUTBOUND      (2U)
+
+/* block type, length, interface, time stamp, captured and original length */
+#define EPB_HDR_WORDS           (7U)
+/* epb_flags option, end of options and trailing block length */
+#define EPB_TRAILER_WORDS       (4U)
+
+typedef struct {
+    netdev_t *dev;
+    const netdev_driver_t *orig;
+    netdev_driver_t driver;
+} _capdev_t;
+
+static char _buf[NETCAP_BUF_SIZE];
+static tsrb_t _rb = TSRB_INIT(_buf);
+static mutex_t _lock = MUTEX_INIT;
+static _capdev_t _devs[NETCAP_DEV_NUMOF];
+static unsigned _numof;
+static uint32_t _dropped;
+static bool _shb_written;
+static thread_t *_thread;
+static char _stack[NETCAP_STACKSIZE];
+
+static unsigned _padded(unsigned len)
+{
+    return (len + 3) & ~3U;
+}
+
+static void _put_words(const uint32_t *words, unsigned numof)
+{
+    tsrb_add(&_rb, (const char *)words, numof * sizeof(uint32_t));
+}
+
+static void _notify(void)
+{
+    if (_thread) {
+        thread_flags_set(_thread, FLAG_DATA);
+    }
+}
+
+/* must be called with _lock held */
+static void _write_shb(void)
+{
+    const uint32_t shb[] = {
+        BLOCK_SHB, 28, BYTE_ORDER_MAGIC,
+        0x00000001, /* version 1.0 */
+        0xffffffff, 0xffffffff, /* section length unknown */
+        28,
+    };
+
+    _put_words(shb, sizeof(shb) / sizeof(shb[0]));
+    _shb_written = true;
+}
+
+static uint16_t _linktype(netdev_t *dev, const netdev_driver_t *driver)
+{
+    uint16_t type;
+
+    if (driver->get(dev, NETOPT_DEVICE_TYPE, &type, sizeof(type)) < 0) {
+        return LINKTYPE_USER0;
+    }
+    switch (type) {
+        case NETDEV_TYPE_ETHERNET:
+            return LINKTYPE_ETHERNET;
+        case NETDEV_TYPE_IEEE802154:
+            return LINKTYPE_IEEE802_15_4;
+        default:
+            return LINKTYPE_USER0;
+    }
+}
+
+static int _capdev(netdev_t *dev)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_devs[i].dev == dev) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* writes the block header and returns false if the frame does not fit */
+static bool _epb_begin(unsigned ifid, unsigned len, unsigned caplen)
+{
+    uint32_t block_len = (EPB_HDR_WORDS + EPB_TRAILER_WORDS) * sizeof(uint32_t) +
+                         _padded(caplen);
+    uint64_t now = xtimer_now_usec64();
+    const uint32_t hdr[EPB_HDR_WORDS] = {
+        BLOCK_EPB, block_len, ifid, now >> 32, now, caplen, len,
+    };
+
+    if (tsrb_free(&_rb) < block_len) {
+        _dropped++;
+        return false;
+    }
+    _put_words(hdr, EPB_HDR_WORDS);
+    return true;
+}
+
+static void _epb_end(unsigned caplen, uint32_t flags)
+{
+    static const char pad[3] = { 0 };
+    uint32_t block_len = (EPB_HDR_WORDS + EPB_TRAILER_WORDS) * sizeof(uint32_t) +
+                         _padded(caplen);
+    const uint32_t trailer[EPB_TRAILER_WORDS] = {
+        OPT_EPB_FLAGS | (4UL << 16), flags, 0, block_len,
+    };
+
+    tsrb_add(&_rb, pad, _padded(caplen) - caplen);
+    _put_words(trailer, EPB_TRAILER_WORDS);
+    _notify();
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    int idx = _capdev(dev);
+    unsigned len = iolist_size(iolist);
+    unsigned caplen = (len > NETCAP_SNAPLEN) ? NETCAP_SNAPLEN : len;
+
+    mutex_lock(&_lock);
+    if (_epb_begin(idx, len, caplen)) {
+        unsigned left = caplen;
+        for (const iolist_t *iol = iolist; iol && left; iol = iol->iol_next) {
+            unsigned chunk = (iol->iol_len > left) ? left : iol->iol_len;
+            tsrb_add(&_rb, (const char *)iol->iol_base, chunk);
+            left -= chunk;
+        }
+        _epb_end(caplen, EPB_FLAGS_OUTBOUND);
+    }
+    mutex_unlock(&_lock);
+
+    return _devs[idx].orig->send(dev, iolist);
+}
+
+static int _recv(netdev_t *dev, void *buf, size_t len, void *info)
+{
+    int idx = _capdev(dev);
+    int res = _devs[idx].orig->recv(dev, buf, len, info);
+
+    /* only the call that actually fetches the frame is captured */
+    if ((buf != NULL) && (res > 0)) {
+        unsigned caplen = ((unsigned)res > NETCAP_SNAPLEN) ? NETCAP_SNAPLEN
+                                                           : (unsigned)res;
+        mutex_lock(&_lock);
+        if (_epb_begin(idx, res, caplen)) {
+            tsrb_add(&_rb, (const char *)buf, caplen);
+            _epb_end(caplen, EPB_FLAGS_INBOUND);
+        }
+        mutex_unlock(&_lock);
+    }
+    return res;
+}
+
+int netcap_add(netdev_t *dev)
+{
+    mutex_lock(&_lock);
+    if (_numof >= NETCAP_DEV_NUMOF) {
+        mutex_unlock(&_lock);
+        return -ENOMEM;
+    }
+
+    _capdev_t *cap = &_devs[_numof++];
+    const uint32_t idb[] = {
+        BLOCK_IDB, 20, _linktype(dev, dev->driver), NETCAP_SNAPLEN, 20,
+    };
+
+    cap->dev = dev;
+    cap->orig = dev->driver;
+    cap->driver = *dev->driver;
+    cap->driver.send = _send;
+    cap->driver.recv = _recv;
+    dev->driver = &cap->driver;
+
+    /* the interface description has to reach the host before any frame */
+    if (!_shb_written) {
+        _write_shb();
+    }
+    _put_words(idb, sizeof(idb) / sizeof(idb[0]));
+    mutex_unlock(&_lock);
+
+    _notify();
+    return 0;
+}
+
+uint32_t netcap_dropped(void)
+{
+    return _dropped;
+}
+
+static void _write(const void *data, size_t len)
+{
+#ifdef MODULE_NETCAP_UART
+    uart_write(NETCAP_UART_DEV, data, len);
+#else
+    stdio_write(data, len);
+#endif
+}
+
+static void *_netcap_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        char *data;
+        size_t len;
+
+        while ((len = tsrb_peek_region(&_rb, &data)) > 0) {
+            _write(data, len);
+            tsrb_drop(&_rb, len);
+        }
+        thread_flags_wait_any(FLAG_DATA);
+    }
+
+    return NULL;
+}
+
+void netcap_init(void)
+{
+#ifdef MODULE_NETCAP_UART
+    uart_init(NETCAP_UART_DEV, NETCAP_UART_BAUDRATE, NULL, NULL);
+#endif
+    mutex_lock(&_lock);
+    if (!_shb_written) {
+        _write_shb();
+    }
+    mutex_unlock(&_lock);
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack), NETCAP_PRIO,
+                                     THREAD_CREATE_STACKTEST, _netcap_thread,
+                                     NULL, "netcap");
+    _thread = (thread_t *)thread_get(pid);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_netstats_neighbor
+ * @{
+ *
+ * @file
+ * @brief       Per neighbor link statistics implementation
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "assert.h"
+#include "net/netstats/neighbor.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static inline bool _match(const netstats_nb_t *nb,
+                          const uint8_t *l2_addr, size_t l2_addr_len)
+{
+    return ((nb->l2_addr_len == l2_addr_len) &&
+            (memcmp(nb->l2_addr, l2_addr, l2_addr_len) == 0));
+}
+
+void netstats_nb_init(netstats_nb_table_t *table)
+{
+    assert(table);
+
+    memset(table, 0, sizeof(netstats_nb_table_t));
+}
+
+static netstats_nb_t *_get_or_add(netstats_nb_table_t *table,
+                                  const uint8_t *l2_addr, size_t l2_addr_len)
+{
+    netstats_nb_t *lru = NULL;
+
+    table->use_counter++;
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        netstats_nb_t *nb = &table->entries[i];
+
+        if (_match(nb, l2_addr, l2_addr_len)) {
+            nb->last_used = table->use_counter;
+            return nb;
+        }
+        if ((lru == NULL) || (nb->l2_addr_len == 0) ||
+            ((lru->l2_addr_len != 0) &&
+             ((uint16_t)(table->use_counter - nb->last_used) >
+              (uint16_t)(table->use_counter - lru->last_used)))) {
+            lru = nb;
+        }
+    }
+    DEBUG("netstats_nb: replacing neighbor table entry %u\n",
+          (unsigned)(lru - table->entries));
+    if (lru == table->pending) {
+        /* do not attribute a pending result to the new neighbor */
+        table->pending = NULL;
+    }
+    memset(lru, 0, sizeof(netstats_nb_t));
+    memcpy(lru->l2_addr, l2_addr, l2_addr_len);
+    lru->l2_addr_len = l2_addr_len;
+    lru->etx = NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+    lru->last_used = table->use_counter;
+    return lru;
+}
+
+static inline int32_t _ewma(int32_t old, int32_t sample)
+{
+    return (old * (int32_t)(NETSTATS_NB_EWMA_SCALE - NETSTATS_NB_EWMA_ALPHA) +
+            sample * (int32_t)NETSTATS_NB_EWMA_ALPHA) / (int32_t)NETSTATS_NB_EWMA_SCALE;
+}
+
+netstats_nb_t *netstats_nb_record(netstats_nb_table_t *table,
+                                  const uint8_t *l2_addr, size_t l2_addr_len)
+{
+    assert(table && (l2_addr_len <= NETSTATS_NB_L2ADDR_MAXLEN));
+
+    table->pending = NULL;
+    if ((l2_addr == NULL) || (l2_addr_len == 0)) {
+        return NULL;
+    }
+    table->pending = _get_or_add(table, l2_addr, l2_addr_len);
+    return table->pending;
+}
+
+netstats_nb_t *netstats_nb_update_tx(netstats_nb_table_t *table,
+                                     netstats_nb_result_t result,
+                                     unsigned transmissions)
+{
+    assert(table);
+
+    netstats_nb_t *nb = table->pending;
+    uint32_t sample;
+
+    if (nb == NULL) {
+        return NULL;
+    }
+    table->pending = NULL;
+    if (result == NETSTATS_NB_BUSY) {
+        /* frame never reached the air, so it says nothing about the link */
+        return nb;
+    }
+    if (result == NETSTATS_NB_NOACK) {
+        sample = NETSTATS_NB_ETX_NOACK_PENALTY * NETSTATS_NB_ETX_DIVISOR;
+        nb->tx_failed++;
+    }
+    else {
+        transmissions = (transmissions > 0) ? transmissions : 1;
+        sample = transmissions * NETSTATS_NB_ETX_DIVISOR;
+        nb->tx_attempts += transmissions;
+    }
+    nb->etx = _ewma(nb->etx, sample);
+    nb->tx_count++;
+    DEBUG("netstats_nb: ETX of entry %u is now %u/%u\n",
+          (unsigned)(nb - table->entries), nb->etx, NETSTATS_NB_ETX_DIVISOR);
+    return nb;
+}
+
+netstats_nb_t *netstats_nb_update_rx(netstats_nb_table_t *table,
+                                     const uint8_t *l2_addr, size_t l2_addr_len,
+                                     int16_t rssi, uint8_t lqi)
+{
+    assert(table && (l2_addr_len <= NETSTATS_NB_L2ADDR_MAXLEN));
+
+    netstats_nb_t *nb;
+
+    if ((l2_addr == NULL) || (l2_addr_len == 0)) {
+        return NULL;
+    }
+    nb = _get_or_add(table, l2_addr, l2_addr_len);
+    if (nb->rx_count == 0) {
+        nb->rssi = rssi;
+        nb->lqi = lqi;
+    }
+    else {
+        nb->rssi = _ewma(nb->rssi, rssi);
+        nb->lqi = _ewma(nb->lqi, lqi);
+    }
+    nb->rx_count++;
+    nb->last_heard = (xtimer_now_usec64() / US_PER_MS) & UINT32_MAX;
+    return nb;
+}
+
+const netstats_nb_t *netstats_nb_get(const netstats_nb_table_t *table,
+                                     const uint8_t *l2_addr,
+                                     size_t l2_addr_len)
+{
+    assert(table && l2_addr);
+
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        if (_match(&table->entries[i], l2_addr, l2_addr_len)) {
+            return &table->entries[i];
+        }
+    }
+    return NULL;
+}
@@ -65,6 +65,69 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#ifdef MODULE_FIB_ROUTE_CACHE
+/**
+ * @brief invalidates all memoized look-ups of the given table
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_route_cache_flush(fib_table_t *table)
+{
+    memset(table->route_cache, 0, sizeof(table->route_cache));
+    table->route_cache_next = 0;
+}
+
+/**
+ * @brief returns the memoized look-up for the given destination address
+ *
+ * @param[in] table     the FIB table
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ *
+ * @return the cache slot for @p dst, NULL if @p dst was not looked up recently
+ */
+static fib_route_cache_entry_t *fib_route_cache_get(fib_table_t *table,
+                                                    uint8_t *dst,
+                                                    size_t dst_size)
+{
+    for (unsigned i = 0; i < FIB_ROUTE_CACHE_SIZE; i++) {
+        fib_route_cache_entry_t *c = &table->route_cache[i];
+
+        if ((c->entry != NULL) && (c->dst_size == dst_size) &&
+            (memcmp(c->dst, dst, dst_size) == 0)) {
+            return c;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief memoizes a look-up, replacing the cache slots round-robin
+ *
+ * @param[in] table     the FIB table
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ * @param[in] entry     the entry found for @p dst
+ * @param[in] exact     1 if @p entry matched @p dst exactly, 0 otherwise
+ */
+static void fib_route_cache_set(fib_table_t *table, uint8_t *dst,
+                                size_t dst_size, fib_entry_t *entry, int exact)
+{
+    fib_route_cache_entry_t *c = &table->route_cache[table->route_cache_next];
+
+    if (dst_size > sizeof(c->dst)) {
+        return;
+    }
+    memcpy(c->dst, dst, dst_size);
+    c->dst_size = dst_size;
+    c->entry = entry;
+    c->exact = exact;
+    table->route_cache_next = (table->route_cache_next + 1) % FIB_ROUTE_CACHE_SIZE;
+}
+#else
+#define fib_route_cache_flush(table)    (void)(table)
+#endif
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -88,6 +151,9 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     size_t match_size = dst_size << 3;
     int ret = -EHOSTUNREACH;
     bool is_all_zeros_addr = true;
+#ifdef MODULE_FIB_ROUTE_CACHE
+    bool expired = false;
+#endif
 
 #if ENABLE_DEBUG
     DEBUG("[fib_find_entry] dst =");
@@ -97,6 +163,25 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     DEBUG("\n");
 #endif
 
+#ifdef MODULE_FIB_ROUTE_CACHE
+    fib_route_cache_entry_t *cached = fib_route_cache_get(table, dst, dst_size);
+
+    if (cached != NULL) {
+        fib_entry_t *entry = cached->entry;
+
+        if ((entry->global != NULL) &&
+            ((entry->lifetime == FIB_LIFETIME_NO_EXPIRE) ||
+             (entry->lifetime >= now))) {
+            DEBUG("[fib_find_entry] route cache hit\n");
+            entry_arr[0] = entry;
+            *entry_arr_size = 1;
+            return cached->exact;
+        }
+        /* the memoized entry expired, so the best match may have changed */
+        fib_route_cache_flush(table);
+    }
+#endif
+
     for (size_t i = 0; i < dst_size; ++i) {
         if (dst[i] != 0) {
             is_all_zeros_addr = false;
@@ -111,6 +196,9 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 
             /* check if the lifetime expired */
             if (table->data.entries[i].lifetime < now) {
+#ifdef MODULE_FIB_ROUTE_CACHE
+                expired |= (table->data.entries[i].global != NULL);
+#endif
                 /* remove this entry if its lifetime expired */
                 table->data.entries[i].lifetime = 0;
                 table->data.entries[i].global_flags = 0;
@@ -137,6 +225,12 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                 || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
                 entry_arr[0] = &(table->data.entries[i]);
                 *entry_arr_size = 1;
+#ifdef MODULE_FIB_ROUTE_CACHE
+                if (expired) {
+                    fib_route_cache_flush(table);
+                }
+                fib_route_cache_set(table, dst, dst_size, entry_arr[0], 1);
+#endif
                 /* we will not find a better one so we return */
                 return 1;
             }
@@ -185,6 +279,15 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     }
 #endif
 
+#ifdef MODULE_FIB_ROUTE_CACHE
+    if (expired) {
+        fib_route_cache_flush(table);
+    }
+    if (count > 0) {
+        fib_route_cache_set(table, dst, dst_size, entry_arr[0], ret);
+    }
+#endif
+
     *entry_arr_size = count;
     return ret;
 }
@@ -268,6 +371,8 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+                /* the new entry may be a better match for memoized look-ups */
+                fib_route_cache_flush(table);
                 return 0;
             }
         }
@@ -458,6 +563,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
     if (ret == 1) {
         /* we must take the according entry and update the values */
         fib_remove(entry[0]);
+        fib_route_cache_flush(table);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -480,6 +586,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
             fib_remove(&table->data.entries[i]);
         }
     }
+    fib_route_cache_flush(table);
 
     mutex_unlock(&(table->mtx_access));
 }
@@ -597,6 +704,7 @@ void fib_init(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+    fib_route_cache_flush(table);
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
 }
@@ -622,6 +730,7 @@ void fib_deinit(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+    fib_route_cache_flush(table);
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
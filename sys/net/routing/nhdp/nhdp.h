@@ -83,6 +83,15 @@ extern "C" {
 #define NHDP_L_HOLD_TIME_MS         (NHDP_DEFAULT_HOLD_TIME_MS)
 #define NHDP_N_HOLD_TIME_MS         (NHDP_DEFAULT_HOLD_TIME_MS)
 #define NHDP_I_HOLD_TIME_MS         (NHDP_DEFAULT_HOLD_TIME_MS)
+
+/**
+ * @brief   Number of hash buckets of the central address storage
+ *
+ *          Must be a power of two
+ */
+#ifndef NHDP_ADDR_DB_BUCKETS
+#define NHDP_ADDR_DB_BUCKETS        (8U)
+#endif
 /** @} */
 
 /**
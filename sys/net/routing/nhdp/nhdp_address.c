@@ -27,6 +27,13 @@
 /* Internal variables */
 static mutex_t mtx_addr_access = MUTEX_INIT;
 static nhdp_addr_t *nhdp_addr_db_head = NULL;
+/* Address-keyed index into the central storage, so that looking up the
+ * addresses of a received HELLO does not scan all known addresses */
+static nhdp_addr_t *nhdp_addr_db_buckets[NHDP_ADDR_DB_BUCKETS];
+
+/* Internal function prototypes */
+static unsigned _addr_hash(uint8_t *addr, size_t addr_size, uint8_t addr_type);
+static void _bucket_remove(nhdp_addr_t *addr);
 
 
 /*---------------------------------------------------------------------------*
@@ -36,10 +43,11 @@ static nhdp_addr_t *nhdp_addr_db_head = NULL;
 nhdp_addr_t *nhdp_addr_db_get_address(uint8_t *addr, size_t addr_size, uint8_t addr_type)
 {
     nhdp_addr_t *addr_elt;
+    unsigned bucket = _addr_hash(addr, addr_size, addr_type);
 
     mutex_lock(&mtx_addr_access);
 
-    LL_FOREACH(nhdp_addr_db_head, addr_elt) {
+    for (addr_elt = nhdp_addr_db_buckets[bucket]; addr_elt; addr_elt = addr_elt->bucket_next) {
         if ((addr_elt->addr_size == addr_size) && (addr_elt->addr_type == addr_type)) {
             if (memcmp(addr_elt->addr, addr, addr_size) == 0) {
                 /* Found a matching entry */
@@ -54,6 +62,7 @@ nhdp_addr_t *nhdp_addr_db_get_address(uint8_t *addr, size_t addr_size, uint8_t a
 
         if (!addr_elt) {
             /* Insufficient memory */
+            mutex_unlock(&mtx_addr_access);
             return NULL;
         }
 
@@ -63,6 +72,7 @@ nhdp_addr_t *nhdp_addr_db_get_address(uint8_t *addr, size_t addr_size, uint8_t a
         if (!addr_elt->addr) {
             /* Insufficient memory */
             free(addr_elt);
+            mutex_unlock(&mtx_addr_access);
             return NULL;
         }
 
@@ -73,6 +83,8 @@ nhdp_addr_t *nhdp_addr_db_get_address(uint8_t *addr, size_t addr_size, uint8_t a
         addr_elt->in_tmp_table = NHDP_ADDR_TMP_NONE;
         addr_elt->tmp_metric_val = NHDP_METRIC_UNKNOWN;
         LL_PREPEND(nhdp_addr_db_head, addr_elt);
+        addr_elt->bucket_next = nhdp_addr_db_buckets[bucket];
+        nhdp_addr_db_buckets[bucket] = addr_elt;
     }
 
     addr_elt->usg_count++;
@@ -92,6 +104,7 @@ void nhdp_decrement_addr_usage(nhdp_addr_t *addr)
         if (addr->usg_count == 0) {
             /* Free address space if address is no longer used */
             LL_DELETE(nhdp_addr_db_head, addr);
+            _bucket_remove(addr);
             free(addr->addr);
             free(addr);
         }
@@ -159,3 +172,40 @@ nhdp_addr_t *nhdp_get_addr_db_head(void)
 {
     return nhdp_addr_db_head;
 }
+
+
+/*------------------------------------------------------------------------------------*/
+/*                                Internal functions                                  */
+/*------------------------------------------------------------------------------------*/
+
+/**
+ * Get the hash bucket for the given address (FNV-1a)
+ */
+static unsigned _addr_hash(uint8_t *addr, size_t addr_size, uint8_t addr_type)
+{
+    uint32_t hash = 2166136261U ^ addr_type;
+
+    for (size_t i = 0; i < addr_size; i++) {
+        hash ^= addr[i];
+        hash *= 16777619U;
+    }
+
+    return hash & (NHDP_ADDR_DB_BUCKETS - 1);
+}
+
+/**
+ * Remove the given address from its hash bucket
+ */
+static void _bucket_remove(nhdp_addr_t *addr)
+{
+    nhdp_addr_t **elt = &nhdp_addr_db_buckets[_addr_hash(addr->addr, addr->addr_size,
+                                                          addr->addr_type)];
+
+    while (*elt) {
+        if (*elt == addr) {
+            *elt = addr->bucket_next;
+            return;
+        }
+        elt = &(*elt)->bucket_next;
+    }
+}
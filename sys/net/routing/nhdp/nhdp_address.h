@@ -34,6 +34,7 @@ typedef struct nhdp_addr {
     uint8_t in_tmp_table;               /**< Signals usage in a writers temp table */
     uint16_t tmp_metric_val;            /**< Encoded metric value used during HELLO processing */
     struct nhdp_addr *next;             /**< Pointer to next address (used in central storage) */
+    struct nhdp_addr *bucket_next;      /**< Pointer to next address in the same hash bucket */
 } nhdp_addr_t;
 
 /**
@@ -19,8 +19,10 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 
 #include "assert.h"
+#include "irq.h"
 #include "random.h"
 #include "luid.h"
 
@@ -72,6 +74,18 @@ static void _sched_next(skald_ctx_t *ctx)
     xtimer_set(&ctx->timer, (ctx->last - xtimer_now_usec()));
 }
 
+static void _apply_updates(skald_ctx_t *ctx)
+{
+    for (; ctx != NULL; ctx = ctx->next) {
+        if (ctx->update != NULL) {
+            /* keep the header flags set up by Skald */
+            ctx->pkt.len = ctx->update->len;
+            memcpy(ctx->pkt.pdu, ctx->update->pdu, ctx->update->len);
+            ctx->update = NULL;
+        }
+    }
+}
+
 static void _on_adv_evt(void *arg)
 {
     skald_ctx_t *ctx = (skald_ctx_t *)arg;
@@ -79,11 +93,19 @@ static void _on_adv_evt(void *arg)
     /* advertise on the next adv channel - or skip this event if the radio is
      * busy */
     if ((ctx->cur_chan < ADV_CHAN_NUMOF) && (_radio->context == NULL)) {
+        if ((ctx->cur_chan == 0) && (ctx->cur == ctx)) {
+            _apply_updates(ctx);
+        }
         _radio->context = ctx;
         _ble_ctx.chan = _adv_chan[ctx->cur_chan];
         netdev_ble_set_ctx(_radio, &_ble_ctx);
-        netdev_ble_send(_radio, &ctx->pkt);
-        ++ctx->cur_chan;
+        netdev_ble_send(_radio, &ctx->cur->pkt);
+        /* send all added packets on a channel before moving to the next */
+        ctx->cur = ctx->cur->next;
+        if (ctx->cur == NULL) {
+            ctx->cur = ctx;
+            ++ctx->cur_chan;
+        }
     }
     else {
         ctx->cur_chan = 0;
@@ -128,6 +150,7 @@ void skald_adv_start(skald_ctx_t *ctx)
     ctx->timer.arg = ctx;
     ctx->last = xtimer_now_usec();
     ctx->cur_chan = 0;
+    ctx->cur = ctx;
     ctx->pkt.flags = (BLE_ADV_NONCON_IND | BLE_LL_FLAG_TXADD);
 
     /* start advertising */
@@ -144,6 +167,46 @@ void skald_adv_stop(skald_ctx_t *ctx)
     }
 }
 
+void skald_adv_add(skald_ctx_t *ctx, skald_ctx_t *member)
+{
+    assert(ctx && member && (ctx != member));
+
+    skald_adv_stop(member);
+    member->pkt.flags = (BLE_ADV_NONCON_IND | BLE_LL_FLAG_TXADD);
+
+    unsigned state = irq_disable();
+    member->next = ctx->next;
+    ctx->next = member;
+    irq_restore(state);
+}
+
+void skald_adv_remove(skald_ctx_t *ctx, skald_ctx_t *member)
+{
+    assert(ctx && member);
+
+    unsigned state = irq_disable();
+    for (skald_ctx_t *prev = ctx; prev->next != NULL; prev = prev->next) {
+        if (prev->next == member) {
+            prev->next = member->next;
+            member->next = NULL;
+            /* don't continue the current event with the removed packet */
+            if (ctx->cur == member) {
+                ctx->cur = ctx;
+                ++ctx->cur_chan;
+            }
+            break;
+        }
+    }
+    irq_restore(state);
+}
+
+void skald_adv_update(skald_ctx_t *ctx, const netdev_ble_pkt_t *pkt)
+{
+    assert(ctx && pkt);
+
+    ctx->update = pkt;
+}
+
 void skald_generate_random_addr(uint8_t *buf)
 {
     assert(buf);
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Implementation of asynchronous sock using @ref sys_event
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "net/sock/async_event.h"
+
+static unsigned _get_flags(sock_event_t *event)
+{
+    unsigned state = irq_disable();
+    unsigned flags = event->flags;
+
+    event->flags = 0;
+    irq_restore(state);
+    return flags;
+}
+
+static void _post(sock_async_ctx_t *ctx, sock_async_flags_t type)
+{
+    unsigned state = irq_disable();
+
+    /* events that were not handled yet get coalesced into one */
+    ctx->event.flags |= type;
+    irq_restore(state);
+    event_post(ctx->queue, &ctx->event.super);
+}
+
+static void _init(sock_async_ctx_t *ctx, event_queue_t *ev_queue,
+                  event_handler_t handler, void *handler_arg)
+{
+    assert(ev_queue != NULL);
+    ctx->queue = ev_queue;
+    ctx->event.super.handler = handler;
+    ctx->event.super.list_node.next = NULL;
+    ctx->event.cb_arg = handler_arg;
+    ctx->event.flags = 0;
+}
+
+#ifdef MODULE_SOCK_IP
+static void _ip_event_handler(event_t *ev)
+{
+    sock_event_t *event = (sock_event_t *)ev;
+    unsigned flags = _get_flags(event);
+
+    if (flags) {
+        event->cb.ip(event->sock.ip, flags, event->cb_arg);
+    }
+}
+
+static void _ip_cb(sock_ip_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)sock;
+    _post(arg, type);
+}
+
+void sock_ip_event_init(sock_ip_t *sock, event_queue_t *ev_queue,
+                        sock_ip_cb_t handler, void *handler_arg)
+{
+    sock_async_ctx_t *ctx = sock_ip_get_async_ctx(sock);
+
+    assert(handler != NULL);
+    _init(ctx, ev_queue, _ip_event_handler, handler_arg);
+    ctx->event.sock.ip = sock;
+    ctx->event.cb.ip = handler;
+    sock_ip_set_cb(sock, _ip_cb, ctx);
+}
+#endif  /* MODULE_SOCK_IP */
+
+#ifdef MODULE_SOCK_UDP
+static void _udp_event_handler(event_t *ev)
+{
+    sock_event_t *event = (sock_event_t *)ev;
+    unsigned flags = _get_flags(event);
+
+    if (flags) {
+        event->cb.udp(event->sock.udp, flags, event->cb_arg);
+    }
+}
+
+static void _udp_cb(sock_udp_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)sock;
+    _post(arg, type);
+}
+
+void sock_udp_event_init(sock_udp_t *sock, event_queue_t *ev_queue,
+                         sock_udp_cb_t handler, void *handler_arg)
+{
+    sock_async_ctx_t *ctx = sock_udp_get_async_ctx(sock);
+
+    assert(handler != NULL);
+    _init(ctx, ev_queue, _udp_event_handler, handler_arg);
+    ctx->event.sock.udp = sock;
+    ctx->event.cb.udp = handler;
+    sock_udp_set_cb(sock, _udp_cb, ctx);
+}
+#endif  /* MODULE_SOCK_UDP */
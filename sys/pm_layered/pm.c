@@ -22,6 +22,15 @@
 #include "periph/pm.h"
 #include "pm_layered.h"
 
+#if (defined(MODULE_XTIMER) && defined(PM_WAKEUP_LATENCY_US)) || \
+    defined(MODULE_PM_LAYERED_STATS)
+#include "xtimer.h"
+#endif
+#ifdef MODULE_PM_LAYERED_STATS
+#include <string.h>
+#include "board.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -46,6 +55,28 @@ typedef union {
  */
 volatile pm_blocker_t pm_blocker = PM_BLOCKER_INITIAL;
 
+#if defined(MODULE_XTIMER) && defined(PM_WAKEUP_LATENCY_US)
+static const uint32_t _wakeup_latency[PM_NUM_MODES] = PM_WAKEUP_LATENCY_US;
+
+/**
+ * @brief   Skip modes that can't be left before the next timer expires
+ */
+static unsigned _limit_by_deadline(unsigned mode)
+{
+    uint32_t until = xtimer_usec_from_ticks(xtimer_until_next());
+
+    while ((mode < PM_NUM_MODES) && (_wakeup_latency[mode] > until)) {
+        mode++;
+    }
+    return mode;
+}
+#endif
+
+#ifdef MODULE_PM_LAYERED_STATS
+static pm_layered_stats_t _stats;
+static uint64_t _since;
+#endif
+
 void pm_set_lowest(void)
 {
     pm_blocker_t blocker = pm_blocker;
@@ -60,8 +91,19 @@ void pm_set_lowest(void)
     /* set lowest mode if blocker is still the same */
     unsigned state = irq_disable();
     if (blocker.val_u32 == pm_blocker.val_u32) {
+#if defined(MODULE_XTIMER) && defined(PM_WAKEUP_LATENCY_US)
+        mode = _limit_by_deadline(mode);
+#endif
         DEBUG("pm: setting mode %u\n", mode);
+#ifdef MODULE_PM_LAYERED_STATS
+        uint64_t start = xtimer_now_usec64();
         pm_set(mode);
+        /* interrupts are still disabled, so the wakeup ISR is not counted */
+        _stats.time_us[mode] += xtimer_now_usec64() - start;
+        _stats.count[mode]++;
+#else
+        pm_set(mode);
+#endif
     }
     else {
         DEBUG("pm: mode block changed\n");
@@ -87,11 +129,60 @@ void pm_unblock(unsigned mode)
     irq_restore(state);
 }
 
+#ifdef MODULE_PM_LAYERED_STATS
+void pm_layered_stats_get(pm_layered_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _stats;
+    irq_restore(state);
+}
+
+void pm_layered_stats_reset(void)
+{
+    unsigned state = irq_disable();
+    memset(&_stats, 0, sizeof(_stats));
+    _since = xtimer_now_usec64();
+    irq_restore(state);
+}
+
+uint64_t pm_layered_stats_charge(void)
+{
+#ifdef PM_CURRENT_UA
+    static const uint32_t current[PM_NUM_MODES + 1] = PM_CURRENT_UA;
+    pm_layered_stats_t stats;
+    uint64_t sleeping = 0;
+    uint64_t charge = 0;
+
+    pm_layered_stats_get(&stats);
+    uint64_t total = xtimer_now_usec64() - _since;
+
+    for (unsigned i = 0; i <= PM_NUM_MODES; i++) {
+        charge += stats.time_us[i] * current[i];
+        sleeping += stats.time_us[i];
+    }
+#ifdef PM_ACTIVE_CURRENT_UA
+    charge += (total - sleeping) * PM_ACTIVE_CURRENT_UA;
+#else
+    (void)total;
+    (void)sleeping;
+#endif
+    /* uA * us = pC */
+    return charge / US_PER_SEC;
+#else
+    return 0;
+#endif
+}
+#endif
+
 #ifndef PROVIDES_PM_LAYERED_OFF
 void pm_off(void)
 {
     pm_blocker.val_u32 = 0;
-    pm_set_lowest();
+    /* bypass pm_set_lowest(), mode 0 must be entered regardless of any
+     * pending timer */
+    unsigned state = irq_disable();
+    pm_set(0);
+    irq_restore(state);
     while(1) {}
 }
 #endif
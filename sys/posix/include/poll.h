@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  posix_sockets
+ * @{
+ */
+
+/**
+ * @file
+ * @brief   Definitions for input/output multiplexing
+ * @see     <a href="http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/poll.h.html">
+ *              The Open Group Base Specifications Issue 7, <poll.h>
+ *          </a>
+ *
+ * Only available with module `posix_poll`. Datagram and raw sockets are
+ * reported readable as soon as the network stack queued a message for them
+ * (see @ref net_sock_async), other VFS file descriptors are always ready.
+ * Stream sockets have no readiness source yet and are reported as POLLNVAL.
+ *
+ * @todo Omitted from original specification for now:
+ * * POLLRDNORM, POLLRDBAND, POLLPRI, POLLWRNORM, POLLWRBAND
+ */
+#ifndef POLL_H
+#define POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Thread flag poll() waits on for readiness changes
+ *
+ * @note    Must not be used by threads calling poll() or select() for
+ *          anything else.
+ */
+#ifndef POSIX_POLL_THREAD_FLAG
+#define POSIX_POLL_THREAD_FLAG  (1u << 13)
+#endif
+
+/**
+ * @name    Event flags for struct pollfd
+ * @{
+ */
+#define POLLIN      (0x0001)    /**< data may be read without blocking */
+#define POLLOUT     (0x0004)    /**< data may be written without blocking */
+#define POLLERR     (0x0008)    /**< an error has occurred (revents only) */
+#define POLLHUP     (0x0010)    /**< device has been disconnected (revents only) */
+#define POLLNVAL    (0x0020)    /**< invalid file descriptor (revents only) */
+/** @} */
+
+/**
+ * @brief   Type for the number of entries given to poll()
+ */
+typedef unsigned int nfds_t;
+
+/**
+ * @brief   File descriptor to poll
+ */
+struct pollfd {
+    int fd;             /**< file descriptor, ignored if negative */
+    short events;       /**< requested events */
+    short revents;      /**< returned events */
+};
+
+/**
+ * @brief   Wait until one of the given file descriptors is ready
+ *
+ * @see     <a href="http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html">
+ *              The Open Group Base Specification Issue 7, poll()
+ *          </a>
+ *
+ * @param[in,out] fds   file descriptors to check
+ * @param[in] nfds      number of entries in @p fds
+ * @param[in] timeout   timeout in ms, -1 to wait forever, 0 to return
+ *                      immediately. Limited to UINT32_MAX us.
+ *
+ * @return  number of entries in @p fds with non-zero revents
+ * @return  0 on timeout
+ * @return  -1 on error, errno is set accordingly
+ */
+int poll(struct pollfd fds[], nfds_t nfds, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLL_H */
+/** @} */
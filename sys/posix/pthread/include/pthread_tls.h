@@ -23,16 +23,23 @@ extern "C" {
 #endif
 
 /**
- * @brief   Internal representation of a thread-specific key.
- * @internal
+ * @brief   Number of thread-specific keys that can exist at the same time
+ *
+ * Every pthread reserves one pointer per key, so lookups need neither a
+ * search nor heap allocation. The POSIX minimum of 128 keys
+ * (`_POSIX_THREAD_KEYS_MAX`) would add 512 bytes to every pthread on a 32-bit
+ * platform, while the libraries using thread-specific data on RIOT need one
+ * or two keys each. Applications that need more keys raise the limit.
  */
-struct __pthread_tls_key;
+#ifndef PTHREAD_KEYS_NUMOF
+#define PTHREAD_KEYS_NUMOF  (8)
+#endif
 
 /**
- * @brief   A single thread-specific datum.
+ * @brief   Internal representation of a thread-specific key.
  * @internal
  */
-struct __pthread_tls_datum;
+struct __pthread_tls_key;
 
 /**
  * @brief   A thread-specific key.
@@ -51,6 +58,9 @@ void *pthread_getspecific(pthread_key_t key);
  * @param[in] key the identifier for the tls
  * @param[in] value pointer to the location of the tls
  * @return returns 0 on success, an errorcode otherwise
+ * @return EINVAL if @p key was not created or was deleted
+ * @return ENOMEM if the caller is not a pthread and thus has no storage for
+ *         thread-specific values
  */
 int pthread_setspecific(pthread_key_t key, const void *value);
 
@@ -59,6 +69,7 @@ int pthread_setspecific(pthread_key_t key, const void *value);
  * @param[out] key the created key is scribed to the given pointer
  * @param[in] destructor function pointer called when non NULL just befor the pthread exits
  * @return returns 0 on success, an errorcode otherwise
+ * @return EAGAIN if all #PTHREAD_KEYS_NUMOF keys are in use
  */
 int pthread_key_create(pthread_key_t *key, void (*destructor)(void *));
 
@@ -78,10 +89,10 @@ int pthread_key_delete(pthread_key_t key);
 void __pthread_keys_exit(int self_id);
 
 /**
- * @brief Returns the pointer to the head of the list of thread-specific data.
+ * @brief Returns the #PTHREAD_KEYS_NUMOF thread-specific values of a pthread.
  * @internal
  */
-struct __pthread_tls_datum **__pthread_get_tls_head(int self_id) PURE;
+void **__pthread_get_tls(int self_id) PURE;
 
 #ifdef __cplusplus
 }
@@ -68,7 +68,7 @@ typedef struct {
 
     char *stack;
 
-    struct __pthread_tls_datum *tls_head;
+    void *tls[PTHREAD_KEYS_NUMOF];
 
     __pthread_cleanup_datum_t *cleanup_top;
 } pthread_thread_t;
@@ -367,8 +367,8 @@ void __pthread_cleanup_pop(__pthread_cleanup_datum_t *datum, int execute)
     }
 }
 
-struct __pthread_tls_datum **__pthread_get_tls_head(int self_id)
+void **__pthread_get_tls(int self_id)
 {
     pthread_thread_t *self = pthread_sched_threads[self_id-1];
-    return self ? &self->tls_head : NULL;
+    return self ? self->tls : NULL;
 }
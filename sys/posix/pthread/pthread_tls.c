@@ -16,107 +16,78 @@
  * @}
  */
 
-#include "pthread.h"
+#include <stdbool.h>
 
-#ifdef HAVE_MALLOC_H
-#include <malloc.h>
-#endif
+#include "pthread.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-typedef struct __pthread_tls_datum {
-    pthread_key_t key;
-    struct __pthread_tls_datum *next;
-    void *value;
-} tls_data_t;
-
 struct __pthread_tls_key {
     void (*destructor)(void *);
+    bool used;
 };
 
 /**
- * @brief   Used while manipulating the TLS of a pthread.
+ * @brief   All keys, the index of a key is its slot in the values of every
+ *          pthread.
+ */
+static struct __pthread_tls_key tls_keys[PTHREAD_KEYS_NUMOF];
+
+/**
+ * @brief   Used while creating or deleting keys.
  */
 static mutex_t tls_mutex;
 
 /**
- * @brief        Find a thread-specific datum.
- * @param[in]    tls    Pointer to the list of the thread-specific datums.
- * @param[in]    key    The key to look up.
- * @param[out]   prev   The datum before the result. `NULL` if the result is the first key. Spurious if the key was not found.
- * @returns      The datum or `NULL`.
+ * @brief       Check if a key was created and not deleted since.
+ * @param[in]   key   The key to check.
+ * @returns     `true` if the key is valid.
  */
-static tls_data_t *find_specific(tls_data_t **tls, pthread_key_t key, tls_data_t **prev)
+static bool key_is_valid(pthread_key_t key)
 {
-    tls_data_t *specific = *tls;
-    *prev = NULL;
-
-    while (specific) {
-        if (specific->key == key) {
-            return specific;
-        }
-
-        *prev = specific;
-        specific = specific->next;
-    }
-
-    return 0;
+    return (key >= &tls_keys[0]) && (key <= &tls_keys[PTHREAD_KEYS_NUMOF - 1]) &&
+           key->used;
 }
 
 /**
- * @brief       Find or allocate a thread specific datum.
- * @details     The `key` must be initialized.
- *              The result will be the head of the thread-specific datums afterwards.
- * @param[in]   key   The key to lookup.
- * @returns     The datum. `NULL` on ENOMEM or if the caller is not a pthread.
+ * @brief       Find the thread-specific value of a key.
+ * @param[in]   key   The key to look up.
+ * @returns     The value slot. `NULL` if the key is invalid or if the caller
+ *              is not a pthread.
  */
-static tls_data_t *get_specific(pthread_key_t key)
+static void **get_specific(pthread_key_t key)
 {
+    if (!key_is_valid(key)) {
+        return NULL;
+    }
+
     pthread_t self_id = pthread_self();
     if (self_id == 0) {
         DEBUG("ERROR called pthread_self() returned 0 in \"%s\"!\n", __func__);
         return NULL;
     }
 
-    tls_data_t **tls = __pthread_get_tls_head(self_id);
-    tls_data_t *prev, *specific = find_specific(tls, key, &prev);
-
-    /* Did the datum already exist? */
-    if (specific) {
-        if (prev) {
-            /* Move the datum to the front for a faster next lookup. */
-            /* Let's pretend that we have a totally degenerated splay tree. ;-) */
-            prev->next = specific->next;
-            specific->next = *tls;
-            *tls = specific;
-        }
-        return specific;
-    }
-
-    /* Allocate new datum. */
-    specific = malloc(sizeof (*specific));
-    if (specific) {
-        specific->key = key;
-        specific->next = *tls;
-        specific->value = NULL;
-        *tls = specific;
-    }
-    else {
-        DEBUG("ERROR out of memory in %s!\n", __func__);
-    }
-    return specific;
+    return &__pthread_get_tls(self_id)[key - tls_keys];
 }
 
 int pthread_key_create(pthread_key_t *key, void (*destructor)(void *))
 {
-    *key = malloc(sizeof (**key));
-    if (!*key) {
-        return ENOMEM;
+    int res = EAGAIN;
+
+    mutex_lock(&tls_mutex);
+    for (unsigned i = 0; i < PTHREAD_KEYS_NUMOF; i++) {
+        if (!tls_keys[i].used) {
+            tls_keys[i].used = true;
+            tls_keys[i].destructor = destructor;
+            *key = &tls_keys[i];
+            res = 0;
+            break;
+        }
     }
+    mutex_unlock(&tls_mutex);
 
-    (*key)->destructor = destructor;
-    return 0;
+    return res;
 }
 
 int pthread_key_delete(pthread_key_t key)
@@ -124,25 +95,22 @@ int pthread_key_delete(pthread_key_t key)
     if (!key) {
         return EINVAL;
     }
+    if ((key < &tls_keys[0]) || (key > &tls_keys[PTHREAD_KEYS_NUMOF - 1])) {
+        /* nothing was ever stored for it */
+        return 0;
+    }
+
+    unsigned idx = key - tls_keys;
 
     mutex_lock(&tls_mutex);
+    /* a key created later in this slot has to start without values */
     for (unsigned i = 1; i <= MAXTHREADS; ++i) {
-        tls_data_t **tls = __pthread_get_tls_head(i);
-        if (!tls) {
-            continue;
-        }
-
-        tls_data_t *prev, *specific = find_specific(tls, key, &prev);
-        if (specific) {
-            if (prev) {
-                prev->next = specific->next;
-            }
-            else {
-                *tls = specific->next;
-            }
-            free(specific);
+        void **tls = __pthread_get_tls(i);
+        if (tls) {
+            tls[idx] = NULL;
         }
     }
+    key->used = false;
     mutex_unlock(&tls_mutex);
 
     return 0;
@@ -150,47 +118,39 @@ int pthread_key_delete(pthread_key_t key)
 
 void *pthread_getspecific(pthread_key_t key)
 {
-    if (!key) {
-        return NULL;
-    }
-
-    mutex_lock(&tls_mutex);
-    tls_data_t *specific = get_specific(key);
-    void *result = specific ? specific->value : NULL;
-    mutex_unlock(&tls_mutex);
+    void **specific = get_specific(key);
 
-    return result;
+    return specific ? *specific : NULL;
 }
 
 int pthread_setspecific(pthread_key_t key, const void *value)
 {
-    if (!key) {
+    if (!key_is_valid(key)) {
         return EINVAL;
     }
 
-    mutex_lock(&tls_mutex);
-    tls_data_t *specific = get_specific(key);
-    if (specific) {
-        specific->value = (void *) value;
+    /* the key is valid, so only a caller that is no pthread has no slot */
+    void **specific = get_specific(key);
+    if (!specific) {
+        return ENOMEM;
     }
-    mutex_unlock(&tls_mutex);
+    *specific = (void *) value;
 
-    return specific ? 0 : ENOMEM;
+    return 0;
 }
 
 void __pthread_keys_exit(int self_id)
 {
-    tls_data_t **tls = __pthread_get_tls_head(self_id);
+    void **tls = __pthread_get_tls(self_id);
 
-    /* Calling the dtor could cause another pthread_exit(), so we dehead and free defore calling it. */
+    /* Calling the dtor could cause another pthread_exit(), so we clear the value before calling it. */
     mutex_lock(&tls_mutex);
-    for (tls_data_t *specific; (specific = *tls); ) {
-        *tls = specific->next;
-        void *value = specific->value;
-        void (*destructor)(void *) = specific->key->destructor;
-        free(specific);
+    for (unsigned i = 0; i < PTHREAD_KEYS_NUMOF; i++) {
+        void *value = tls[i];
+        void (*destructor)(void *) = tls_keys[i].destructor;
+        tls[i] = NULL;
 
-        if (value && destructor) {
+        if (value && destructor && tls_keys[i].used) {
             mutex_unlock(&tls_mutex);
             destructor(value);
             mutex_lock(&tls_mutex);
@@ -19,6 +19,7 @@
 #include <assert.h>
 #include <arpa/inet.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <string.h>
 
@@ -36,6 +37,16 @@
 #include "net/sock/udp.h"
 #include "net/sock/tcp.h"
 
+#ifdef MODULE_POSIX_POLL
+#include <sys/select.h>
+
+#include "net/sock/async.h"
+#include "poll.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "xtimer.h"
+#endif
+
 /* enough to create sockets both with socket() and accept() */
 #define _ACTUAL_SOCKET_POOL_SIZE   (SOCKET_POOL_SIZE + \
                                     (SOCKET_POOL_SIZE * SOCKET_TCP_QUEUE_SIZE))
@@ -79,8 +90,18 @@ typedef struct {
     unsigned queue_array_len;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
+#ifdef MODULE_POSIX_POLL
+    unsigned avail;             /* messages received but not read yet */
+#endif
 } socket_t;
 
+#ifdef MODULE_POSIX_POLL
+typedef struct _poll_waiter {
+    struct _poll_waiter *next;
+    thread_t *thread;
+} _poll_waiter_t;
+#endif
+
 static socket_t _socket_pool[_ACTUAL_SOCKET_POOL_SIZE];
 static socket_sock_t _sock_pool[SOCKET_POOL_SIZE];
 #ifdef MODULE_SOCK_TCP
@@ -89,6 +110,11 @@ static sock_tcp_t _tcp_sock_pool[SOCKET_POOL_SIZE][SOCKET_TCP_QUEUE_SIZE];
 BITFIELD(_sock_pool_used, SOCKET_POOL_SIZE);
 static mutex_t _socket_pool_mutex = MUTEX_INIT;
 
+#ifdef MODULE_POSIX_POLL
+static _poll_waiter_t *_poll_waiters;
+static mutex_t _poll_mutex = MUTEX_INIT;
+#endif
+
 const struct in6_addr in6addr_any = IN6ADDR_ANY_INIT;
 const struct in6_addr in6addr_loopback = IN6ADDR_LOOPBACK_INIT;
 
@@ -137,6 +163,70 @@ static int _get_sock_idx(socket_sock_t *sock)
     return sock - &_sock_pool[0];
 }
 
+#ifdef MODULE_POSIX_POLL
+/* called by the network stack */
+static void _recv_event(socket_t *s, sock_async_flags_t flags)
+{
+    if (!(flags & SOCK_ASYNC_MSG_RECV)) {
+        return;
+    }
+    mutex_lock(&_poll_mutex);
+    s->avail++;
+    for (_poll_waiter_t *w = _poll_waiters; w != NULL; w = w->next) {
+        thread_flags_set(w->thread, POSIX_POLL_THREAD_FLAG);
+    }
+    mutex_unlock(&_poll_mutex);
+}
+
+#ifdef MODULE_SOCK_IP
+static void _ip_cb(sock_ip_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _recv_event(arg, flags);
+}
+#endif
+
+#ifdef MODULE_SOCK_UDP
+static void _udp_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _recv_event(arg, flags);
+}
+#endif
+
+static void _set_async_cb(socket_t *s)
+{
+    s->avail = 0;
+    switch (s->type) {
+#ifdef MODULE_SOCK_IP
+        case SOCK_RAW:
+            sock_ip_set_cb(&s->sock->raw, _ip_cb, s);
+            break;
+#endif
+#ifdef MODULE_SOCK_UDP
+        case SOCK_DGRAM:
+            sock_udp_set_cb(&s->sock->udp, _udp_cb, s);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+static void _msg_read(socket_t *s, int res)
+{
+    if ((res == -ETIMEDOUT) || (res == -EAGAIN)) {
+        /* nothing was taken from the sock */
+        return;
+    }
+    mutex_lock(&_poll_mutex);
+    if (s->avail > 0) {
+        s->avail--;
+    }
+    mutex_unlock(&_poll_mutex);
+}
+#endif
+
 static inline int _choose_ipproto(int type, int protocol)
 {
     switch (type) {
@@ -361,6 +451,9 @@ int socket(int domain, int type, int protocol)
             }
             s->bound = false;
             s->sock = NULL;
+#ifdef MODULE_POSIX_POLL
+            s->avail = 0;
+#endif
 #ifdef POSIX_SETSOCKOPT
             s->recv_timeout = SOCK_NO_TIMEOUT;
 #endif
@@ -591,6 +684,9 @@ static int _bind_connect(socket_t *s, const struct sockaddr *address,
         return -1;
     }
     s->sock = sock;
+#ifdef MODULE_POSIX_POLL
+    _set_async_cb(s);
+#endif
     return 0;
 }
 
@@ -842,6 +938,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         case SOCK_RAW:
             res = sock_ip_recv(&s->sock->raw, buffer, length, recv_timeout,
                                (sock_ip_ep_t *)&ep);
+#ifdef MODULE_POSIX_POLL
+            _msg_read(s, res);
+#endif
             break;
 #endif
 #ifdef MODULE_SOCK_TCP
@@ -854,6 +953,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         case SOCK_DGRAM:
             res = sock_udp_recv(&s->sock->udp, buffer, length, recv_timeout,
                                 &ep);
+#ifdef MODULE_POSIX_POLL
+            _msg_read(s, res);
+#endif
             break;
 #endif
         default:
@@ -1046,6 +1148,202 @@ int setsockopt(int socket, int level, int option_name, const void *option_value,
 #endif
 }
 
+#ifdef MODULE_POSIX_POLL
+static short _socket_revents(socket_t *s)
+{
+    short revents;
+
+    switch (s->type) {
+        case SOCK_RAW:
+        case SOCK_DGRAM:
+            /* sending never waits for buffer space */
+            revents = POLLOUT;
+            mutex_lock(&_poll_mutex);
+            if (s->avail > 0) {
+                revents |= POLLIN;
+            }
+            mutex_unlock(&_poll_mutex);
+            break;
+        default:
+            /* no readiness information for stream sockets */
+            revents = POLLNVAL;
+            break;
+    }
+    return revents;
+}
+
+static int _poll_check(struct pollfd fds[], nfds_t nfds)
+{
+    int ready = 0;
+
+    for (nfds_t i = 0; i < nfds; i++) {
+        socket_t *s;
+
+        fds[i].revents = 0;
+        if (fds[i].fd < 0) {
+            continue;
+        }
+        mutex_lock(&_socket_pool_mutex);
+        s = _get_socket(fds[i].fd);
+        if ((s != NULL) && (s->domain == AF_UNSPEC)) {
+            s = NULL;
+        }
+        mutex_unlock(&_socket_pool_mutex);
+        if (s != NULL) {
+            fds[i].revents = _socket_revents(s);
+        }
+        else {
+            struct stat buf;
+
+            /* regular files and devices never block */
+            fds[i].revents = (vfs_fstat(fds[i].fd, &buf) < 0) ? POLLNVAL
+                                                              : (POLLIN | POLLOUT);
+        }
+        fds[i].revents &= (fds[i].events | POLLERR | POLLHUP | POLLNVAL);
+        if (fds[i].revents) {
+            ready++;
+        }
+    }
+    return ready;
+}
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout)
+{
+    _poll_waiter_t waiter = { .thread = (thread_t *)sched_active_thread };
+    xtimer_t timer;
+    int res;
+
+    if ((fds == NULL) && (nfds > 0)) {
+        errno = EFAULT;
+        return -1;
+    }
+
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    mutex_lock(&_poll_mutex);
+    waiter.next = _poll_waiters;
+    _poll_waiters = &waiter;
+    mutex_unlock(&_poll_mutex);
+    if (timeout > 0) {
+        /* xtimer only handles 32-bit timeouts */
+        uint32_t us = ((unsigned)timeout < (UINT32_MAX / US_PER_MS))
+                    ? (uint32_t)timeout * US_PER_MS : UINT32_MAX;
+        xtimer_set_timeout_flag(&timer, us);
+    }
+
+    /* readiness changes after the check set the flag, so none is missed */
+    while (((res = _poll_check(fds, nfds)) == 0) && (timeout != 0)) {
+        if (thread_flags_wait_any(POSIX_POLL_THREAD_FLAG |
+                                  THREAD_FLAG_TIMEOUT) & THREAD_FLAG_TIMEOUT) {
+            res = _poll_check(fds, nfds);
+            break;
+        }
+    }
+
+    if (timeout > 0) {
+        xtimer_remove(&timer);
+    }
+    mutex_lock(&_poll_mutex);
+    for (_poll_waiter_t **w = &_poll_waiters; *w != NULL; w = &(*w)->next) {
+        if (*w == &waiter) {
+            *w = waiter.next;
+            break;
+        }
+    }
+    mutex_unlock(&_poll_mutex);
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    return res;
+}
+
+int select(int nfds, fd_set *restrict readfds, fd_set *restrict writefds,
+           fd_set *restrict errorfds, struct timeval *restrict timeout)
+{
+    struct pollfd fds[VFS_MAX_OPEN_FILES];
+    nfds_t num = 0;
+    int ms = -1;
+    int res;
+
+    if ((nfds < 0) || (nfds > FD_SETSIZE)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (timeout != NULL) {
+        if ((timeout->tv_sec < 0) || (timeout->tv_usec < 0)) {
+            errno = EINVAL;
+            return -1;
+        }
+        if (timeout->tv_sec < ((INT_MAX / MS_PER_SEC) - 1)) {
+            ms = (timeout->tv_sec * MS_PER_SEC) + (timeout->tv_usec / US_PER_MS);
+        }
+        else {
+            ms = INT_MAX;
+        }
+    }
+    for (int fd = 0; fd < nfds; fd++) {
+        short events = 0;
+
+        if ((readfds != NULL) && FD_ISSET(fd, readfds)) {
+            events |= POLLIN;
+        }
+        if ((writefds != NULL) && FD_ISSET(fd, writefds)) {
+            events |= POLLOUT;
+        }
+        if ((errorfds != NULL) && FD_ISSET(fd, errorfds)) {
+            events |= POLLERR;
+        }
+        if (events == 0) {
+            continue;
+        }
+        if (num == VFS_MAX_OPEN_FILES) {
+            /* more than can be open at the same time */
+            errno = EBADF;
+            return -1;
+        }
+        fds[num].fd = fd;
+        fds[num].events = events;
+        num++;
+    }
+
+    if ((res = poll(fds, num, ms)) < 0) {
+        return res;
+    }
+    for (nfds_t i = 0; i < num; i++) {
+        if (fds[i].revents & POLLNVAL) {
+            errno = EBADF;
+            return -1;
+        }
+    }
+
+    res = 0;
+    for (nfds_t i = 0; i < num; i++) {
+        if (readfds != NULL) {
+            if (fds[i].revents & POLLIN) {
+                res++;
+            }
+            else {
+                FD_CLR(fds[i].fd, readfds);
+            }
+        }
+        if (writefds != NULL) {
+            if (fds[i].revents & POLLOUT) {
+                res++;
+            }
+            else {
+                FD_CLR(fds[i].fd, writefds);
+            }
+        }
+        if (errorfds != NULL) {
+            if (fds[i].revents & POLLERR) {
+                res++;
+            }
+            else {
+                FD_CLR(fds[i].fd, errorfds);
+            }
+        }
+    }
+    return res;
+}
+#endif
+
 /**
  * @}
  */
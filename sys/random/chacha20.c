@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup sys_random
+ * @{
+ * @file
+ *
+ * @brief   ChaCha20 based CSPRNG
+ *
+ * The key is replaced by keystream right after each request ("fast key
+ * erasure"), so output that was handed out can not be reconstructed from a
+ * later state. If a hardware RNG is available, fresh entropy is mixed into
+ * the key every @ref RANDOM_CHACHA20_RESEED_BLOCKS keystream blocks.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/chacha.h"
+#include "mutex.h"
+#include "random.h"
+#ifdef MODULE_PERIPH_HWRNG
+#include "periph/hwrng.h"
+#endif
+
+#define KEY_SIZE        (32U)
+#define BLOCK_SIZE      (64U)
+
+static const uint8_t _nonce[8];
+static chacha_ctx _ctx;
+static uint32_t _block[BLOCK_SIZE / sizeof(uint32_t)];
+static unsigned _pos = BLOCK_SIZE;
+static unsigned _blocks;
+static mutex_t _lock = MUTEX_INIT;
+
+static void _rekey(const uint8_t *key)
+{
+    chacha_init(&_ctx, 20, key, KEY_SIZE, _nonce);
+}
+
+#ifdef MODULE_PERIPH_HWRNG
+static void _reseed(void)
+{
+    uint8_t key[KEY_SIZE];
+
+    /* keep the old key in, in case the hardware RNG is weak */
+    chacha_keystream_bytes(&_ctx, _block);
+    hwrng_read(key, sizeof(key));
+    for (unsigned i = 0; i < sizeof(key); i++) {
+        key[i] ^= ((uint8_t *)_block)[i];
+    }
+    _rekey(key);
+    memset(key, 0, sizeof(key));
+    _blocks = 0;
+}
+#endif
+
+static void _next_block(void *out)
+{
+#ifdef MODULE_PERIPH_HWRNG
+    if (_blocks >= RANDOM_CHACHA20_RESEED_BLOCKS) {
+        _reseed();
+    }
+#endif
+    chacha_keystream_bytes(&_ctx, out);
+    _blocks++;
+}
+
+static void _finish(void)
+{
+    /* replace the key and discard the rest of the block */
+    _next_block(_block);
+    _rekey((uint8_t *)_block);
+    memset(_block, 0, sizeof(_block));
+    _pos = BLOCK_SIZE;
+}
+
+static void _init(const uint8_t *in, size_t bytes)
+{
+    uint8_t key[KEY_SIZE];
+
+    memset(key, 0, sizeof(key));
+    for (size_t i = 0; i < bytes; i++) {
+        key[i % sizeof(key)] ^= in[i];
+    }
+
+    mutex_lock(&_lock);
+    _rekey(key);
+    memset(key, 0, sizeof(key));
+    _pos = BLOCK_SIZE;
+#ifdef MODULE_PERIPH_HWRNG
+    _reseed();
+#else
+    _blocks = 0;
+#endif
+    mutex_unlock(&_lock);
+}
+
+void random_init(uint32_t s)
+{
+    _init((uint8_t *)&s, sizeof(s));
+}
+
+void random_init_by_array(uint32_t init_key[], int key_length)
+{
+    _init((uint8_t *)init_key, sizeof(uint32_t) * key_length);
+}
+
+void random_bytes(uint8_t *buf, size_t size)
+{
+    mutex_lock(&_lock);
+
+    /* leftovers of the last block are never used, see _finish() */
+    while (size >= BLOCK_SIZE) {
+        if ((uintptr_t)buf & (sizeof(uint32_t) - 1)) {
+            _next_block(_block);
+            memcpy(buf, _block, BLOCK_SIZE);
+        }
+        else {
+            /* the keystream is generated in place for aligned buffers */
+            _next_block(buf);
+        }
+        buf += BLOCK_SIZE;
+        size -= BLOCK_SIZE;
+    }
+    if (size) {
+        _next_block(_block);
+        memcpy(buf, _block, size);
+    }
+    _finish();
+
+    mutex_unlock(&_lock);
+}
+
+uint32_t random_uint32(void)
+{
+    uint32_t res;
+
+    mutex_lock(&_lock);
+    /* single words are taken from a buffered block, to not rekey each time */
+    if (_pos >= BLOCK_SIZE) {
+        _next_block(_block);
+        _rekey((uint8_t *)_block);
+        /* the first half of the block became the new key */
+        memset(_block, 0, KEY_SIZE);
+        _pos = KEY_SIZE;
+    }
+    res = _block[_pos / sizeof(uint32_t)];
+    _block[_pos / sizeof(uint32_t)] = 0;
+    _pos += sizeof(uint32_t);
+    mutex_unlock(&_lock);
+
+    return res;
+}
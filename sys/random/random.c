@@ -22,6 +22,9 @@
 #include "log.h"
 #include "luid.h"
 #include "periph/cpuid.h"
+#ifdef MODULE_PERIPH_HWRNG
+#include "periph/hwrng.h"
+#endif
 #include "random.h"
 #ifdef MODULE_PUF_SRAM
 #include "puf_sram.h"
@@ -39,6 +42,8 @@ void auto_init_random(void)
         LOG_WARNING("random: PUF SEED not fresh\n");
     }
     seed = puf_sram_seed;
+#elif defined (MODULE_PERIPH_HWRNG)
+    hwrng_read(&seed, sizeof(seed));
 #elif defined (MODULE_PERIPH_CPUID)
     luid_get(&seed, 4);
 #else
@@ -49,6 +54,8 @@ void auto_init_random(void)
     random_init(seed);
 }
 
+#ifndef MODULE_PRNG_CHACHA20
+/* ChaCha20 provides its own, as it generates 64 byte blocks */
 void random_bytes(uint8_t *target, size_t n)
 {
     uint32_t random;
@@ -63,6 +70,7 @@ void random_bytes(uint8_t *target, size_t n)
         *target++ = *random_pos++;
     }
 }
+#endif
 
 uint32_t random_uint32_range(uint32_t a, uint32_t b)
 {
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_riotboot_delta
+ * @{
+ *
+ * @file
+ * @brief       riotboot delta patch implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "riotboot/delta.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+enum {
+    STATE_HDR,
+    STATE_CTRL,
+    STATE_DIFF,
+    STATE_EXTRA,
+    STATE_DONE,
+    STATE_ERROR,
+};
+
+#define MAGIC_LEN   (sizeof(RIOTBOOT_DELTA_MAGIC) - 1)
+
+/* bsdiff's sign-magnitude little endian 64 bit integers, limited to 31 bit */
+static int _offtin(const uint8_t *buf, int32_t *res)
+{
+    uint32_t y = 0;
+
+    if ((buf[7] & 0x7f) || buf[6] || buf[5] || buf[4] || (buf[3] & 0x80)) {
+        return -EINVAL;
+    }
+    for (int i = 3; i >= 0; i--) {
+        y = (y << 8) | buf[i];
+    }
+    *res = (buf[7] & 0x80) ? -(int32_t)y : (int32_t)y;
+    return 0;
+}
+
+static int _flush(riotboot_delta_t *delta)
+{
+    int res = 0;
+
+    if (delta->buf_pos) {
+        res = delta->write(delta->arg, delta->new_pos - delta->buf_pos,
+                           delta->buf, delta->buf_pos);
+        delta->buf_pos = 0;
+    }
+    return res;
+}
+
+/* Set up the next block of the patch after the current one is done */
+static void _next_block(riotboot_delta_t *delta)
+{
+    while (delta->remaining == 0) {
+        if (delta->state == STATE_DIFF) {
+            delta->state = STATE_EXTRA;
+            delta->remaining = delta->extra_len;
+        }
+        else {
+            delta->old_pos += delta->seek;
+            delta->state = (delta->new_pos == delta->new_len) ? STATE_DONE
+                                                              : STATE_CTRL;
+            delta->hdr_pos = 0;
+            return;
+        }
+    }
+}
+
+static int _parse_ctrl(riotboot_delta_t *delta)
+{
+    int32_t diff_len, extra_len;
+
+    if (_offtin(&delta->hdr[0], &diff_len) || _offtin(&delta->hdr[8], &extra_len) ||
+        _offtin(&delta->hdr[16], &delta->seek) || diff_len < 0 || extra_len < 0 ||
+        (size_t)diff_len + extra_len > delta->new_len - delta->new_pos) {
+        DEBUG("riotboot_delta: invalid control record\n");
+        return -EINVAL;
+    }
+    delta->state = STATE_DIFF;
+    delta->remaining = diff_len;
+    delta->extra_len = extra_len;
+    _next_block(delta);
+    return 0;
+}
+
+static int _parse_hdr(riotboot_delta_t *delta)
+{
+    int32_t new_len;
+
+    if (memcmp(delta->hdr, RIOTBOOT_DELTA_MAGIC, MAGIC_LEN) ||
+        _offtin(&delta->hdr[MAGIC_LEN], &new_len) || new_len < 0) {
+        DEBUG("riotboot_delta: invalid header\n");
+        return -EINVAL;
+    }
+    delta->new_len = new_len;
+    delta->state = (new_len == 0) ? STATE_DONE : STATE_CTRL;
+    delta->hdr_pos = 0;
+    return 0;
+}
+
+static int _process(riotboot_delta_t *delta, const uint8_t *data, size_t len)
+{
+    while (len) {
+        switch (delta->state) {
+            case STATE_HDR:
+            case STATE_CTRL: {
+                size_t want = ((delta->state == STATE_HDR) ? MAGIC_LEN + 8
+                                                           : 24) - delta->hdr_pos;
+                size_t n = (len < want) ? len : want;
+                int res = 0;
+
+                memcpy(&delta->hdr[delta->hdr_pos], data, n);
+                delta->hdr_pos += n;
+                data += n;
+                len -= n;
+                if (n == want) {
+                    res = (delta->state == STATE_HDR) ? _parse_hdr(delta)
+                                                      : _parse_ctrl(delta);
+                }
+                if (res < 0) {
+                    return res;
+                }
+                break;
+            }
+            case STATE_DIFF:
+            case STATE_EXTRA: {
+                size_t n = delta->buf_len - delta->buf_pos;
+
+                if (n > len) {
+                    n = len;
+                }
+                if (n > delta->remaining) {
+                    n = delta->remaining;
+                }
+                for (size_t i = 0; i < n; i++) {
+                    uint8_t byte = data[i];
+
+                    if (delta->state == STATE_DIFF) {
+                        /* like bspatch, bytes outside the old image are 0 */
+                        if (delta->old_pos >= 0 &&
+                            (size_t)delta->old_pos < delta->old_len) {
+                            byte += delta->old[delta->old_pos];
+                        }
+                        delta->old_pos++;
+                    }
+                    delta->buf[delta->buf_pos++] = byte;
+                }
+                delta->new_pos += n;
+                delta->remaining -= n;
+                data += n;
+                len -= n;
+                if (delta->buf_pos == delta->buf_len) {
+                    int res = _flush(delta);
+
+                    if (res < 0) {
+                        return res;
+                    }
+                }
+                _next_block(delta);
+                break;
+            }
+            default:
+                DEBUG("riotboot_delta: trailing data\n");
+                return -EINVAL;
+        }
+    }
+    return 0;
+}
+
+int riotboot_delta_init(riotboot_delta_t *delta,
+                        const uint8_t *old, size_t old_len,
+                        uint8_t *buf, size_t buf_len,
+                        riotboot_delta_write_t write, void *arg,
+                        bool compressed)
+{
+#ifndef MODULE_HEATSHRINK
+    if (compressed) {
+        return -ENOTSUP;
+    }
+#endif
+
+    memset(delta, 0, sizeof(*delta));
+    delta->old = old;
+    delta->old_len = old_len;
+    delta->buf = buf;
+    delta->buf_len = buf_len;
+    delta->write = write;
+    delta->arg = arg;
+    delta->state = STATE_HDR;
+#ifdef MODULE_HEATSHRINK
+    delta->compressed = compressed;
+    heatshrink_decoder_reset(&delta->hsd);
+#endif
+    return 0;
+}
+
+#ifdef MODULE_HEATSHRINK
+/* Pass everything the decoder has ready to the patch parser */
+static int _drain(riotboot_delta_t *delta)
+{
+    uint8_t out[32];
+    size_t n;
+    HSD_poll_res poll;
+
+    do {
+        poll = heatshrink_decoder_poll(&delta->hsd, out, sizeof(out), &n);
+        if (poll < 0) {
+            return -EINVAL;
+        }
+        int res = _process(delta, out, n);
+        if (res < 0) {
+            return res;
+        }
+    } while (poll == HSDR_POLL_MORE);
+    return 0;
+}
+#endif
+
+int riotboot_delta_feed(riotboot_delta_t *delta, const uint8_t *patch,
+                        size_t len)
+{
+    int res;
+
+    if (delta->state == STATE_ERROR) {
+        return -EINVAL;
+    }
+#ifdef MODULE_HEATSHRINK
+    if (delta->compressed) {
+        res = 0;
+        while (len && res == 0) {
+            size_t n;
+
+            if (heatshrink_decoder_sink(&delta->hsd, (uint8_t *)patch, len,
+                                        &n) < 0) {
+                res = -EINVAL;
+                break;
+            }
+            patch += n;
+            len -= n;
+            res = _drain(delta);
+        }
+    }
+    else
+#endif
+    {
+        res = _process(delta, patch, len);
+    }
+    if (res < 0) {
+        delta->state = STATE_ERROR;
+    }
+    return res;
+}
+
+int riotboot_delta_finish(riotboot_delta_t *delta)
+{
+    int res = 0;
+
+#ifdef MODULE_HEATSHRINK
+    if (delta->compressed && delta->state != STATE_ERROR) {
+        HSD_finish_res fin;
+
+        while ((fin = heatshrink_decoder_finish(&delta->hsd)) == HSDR_FINISH_MORE) {
+            res = _drain(delta);
+            if (res < 0) {
+                return res;
+            }
+        }
+        if (fin < 0) {
+            return -EINVAL;
+        }
+    }
+#endif
+    if (delta->state != STATE_DONE) {
+        DEBUG("riotboot_delta: patch incomplete\n");
+        return -EINVAL;
+    }
+    res = _flush(delta);
+    return (res < 0) ? res : (int)delta->new_len;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_riotboot_verify
+ * @{
+ *
+ * @file
+ * @brief       riotboot image digest verification
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "log.h"
+#include "riotboot/verify.h"
+#ifdef MODULE_DMA_MEMCPY
+#include "dma_memcpy.h"
+#endif
+
+int riotboot_verify(const riotboot_hdr_t *riotboot_hdr, uint8_t *buf,
+                    size_t buf_len, riotboot_verify_cb_t cb, void *arg)
+{
+    const riotboot_digest_t *digest = riotboot_digest_get(riotboot_hdr);
+    const uint8_t *img = (const uint8_t *)(uintptr_t)riotboot_hdr->start_addr;
+    uint8_t res[SHA256_DIGEST_LENGTH];
+    sha256_context_t ctx;
+
+    if (digest->magic_number != RIOTBOOT_DIGEST_MAGIC) {
+        LOG_INFO("%s: riotboot_digest magic number invalid\n", __func__);
+        return -1;
+    }
+
+    sha256_init(&ctx);
+    if (cb == NULL) {
+        sha256_update(&ctx, img, digest->img_len);
+    }
+    else {
+        for (size_t pos = 0; pos < digest->img_len; pos += buf_len) {
+            size_t len = digest->img_len - pos;
+
+            if (len > buf_len) {
+                len = buf_len;
+            }
+#ifdef MODULE_DMA_MEMCPY
+            dma_memcpy(buf, img + pos, len);
+#else
+            memcpy(buf, img + pos, len);
+#endif
+            if (cb(arg, buf, len, pos) != 0) {
+                return -1;
+            }
+            sha256_update(&ctx, buf, len);
+        }
+    }
+    sha256_final(&ctx, res);
+
+    if (memcmp(res, digest->sha256, sizeof(res)) != 0) {
+        LOG_INFO("%s: image digest invalid\n", __func__);
+        return -1;
+    }
+    return 0;
+}
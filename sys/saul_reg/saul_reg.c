@@ -24,12 +24,91 @@
 #include <string.h>
 
 #include "saul_reg.h"
+#ifdef MODULE_SAUL_REG_CACHE
+#include "xtimer.h"
+#endif
 
 /**
  * @brief   Keep the head of the device list as global variable
  */
 saul_reg_t *saul_reg = NULL;
 
+/**
+ * @brief   Entry and position of the last saul_reg_find_nth() lookup
+ *
+ * Enumerating the registry with increasing positions continues from here, so
+ * it takes linear instead of quadratic time.
+ */
+static saul_reg_t *_nth_dev = NULL;
+static int _nth_pos;
+
+#ifdef MODULE_SAUL_REG_INDEX
+/**
+ * @brief   First entry of each type and name bucket
+ *
+ * A bucket points to the first entry in the registry whose type (or name)
+ * hashes to it. Lookups that hit an entry of a different type (or name) in
+ * the bucket fall back to walking the list from there.
+ */
+static saul_reg_t *_by_type[SAUL_REG_INDEX_BUCKETS];
+static saul_reg_t *_by_name[SAUL_REG_INDEX_BUCKETS];
+
+static inline unsigned _type_bucket(uint8_t type)
+{
+    return type % SAUL_REG_INDEX_BUCKETS;
+}
+
+static unsigned _name_bucket(const char *name)
+{
+    /* djb2 */
+    uint32_t hash = 5381;
+
+    while (*name) {
+        hash = (hash * 33) + (uint8_t)*name++;
+    }
+    return hash % SAUL_REG_INDEX_BUCKETS;
+}
+
+static void _index_add(saul_reg_t *dev)
+{
+    unsigned type = _type_bucket(dev->driver->type);
+    unsigned name = _name_bucket(dev->name);
+
+    /* entries are appended, so the first entry of a bucket never changes */
+    if (_by_type[type] == NULL) {
+        _by_type[type] = dev;
+    }
+    if (_by_name[name] == NULL) {
+        _by_name[name] = dev;
+    }
+}
+
+static void _index_rm(saul_reg_t *dev)
+{
+    unsigned type = _type_bucket(dev->driver->type);
+    unsigned name = _name_bucket(dev->name);
+
+    if (_by_type[type] == dev) {
+        _by_type[type] = NULL;
+        for (saul_reg_t *tmp = dev->next; tmp; tmp = tmp->next) {
+            if (_type_bucket(tmp->driver->type) == type) {
+                _by_type[type] = tmp;
+                break;
+            }
+        }
+    }
+    if (_by_name[name] == dev) {
+        _by_name[name] = NULL;
+        for (saul_reg_t *tmp = dev->next; tmp; tmp = tmp->next) {
+            if (_name_bucket(tmp->name) == name) {
+                _by_name[name] = tmp;
+                break;
+            }
+        }
+    }
+}
+#endif /* MODULE_SAUL_REG_INDEX */
+
 
 int saul_reg_add(saul_reg_t *dev)
 {
@@ -51,6 +130,9 @@ int saul_reg_add(saul_reg_t *dev)
         }
         tmp->next = dev;
     }
+#ifdef MODULE_SAUL_REG_INDEX
+    _index_add(dev);
+#endif
     return 0;
 }
 
@@ -61,35 +143,56 @@ int saul_reg_rm(saul_reg_t *dev)
     if (saul_reg == NULL || dev == NULL) {
         return -ENODEV;
     }
+    if (saul_reg != dev) {
+        while (tmp->next && (tmp->next != dev)) {
+            tmp = tmp->next;
+        }
+        if (tmp->next != dev) {
+            return -ENODEV;
+        }
+    }
+#ifdef MODULE_SAUL_REG_INDEX
+    /* still linked, so the buckets can be refilled from its successors */
+    _index_rm(dev);
+#endif
     if (saul_reg == dev) {
         saul_reg = dev->next;
-        return 0;
-    }
-    while (tmp->next && (tmp->next != dev)) {
-        tmp = tmp->next;
-    }
-    if (tmp->next == dev) {
-        tmp->next = dev->next;
     }
     else {
-        return -ENODEV;
+        tmp->next = dev->next;
     }
+    /* positions behind the removed entry changed */
+    _nth_dev = NULL;
     return 0;
 }
 
 saul_reg_t *saul_reg_find_nth(int pos)
 {
     saul_reg_t *tmp = saul_reg;
+    int i = 0;
 
-    for (int i = 0; (i < pos) && tmp; i++) {
+    /* continue from the last lookup when enumerating */
+    if (_nth_dev && (pos >= _nth_pos)) {
+        tmp = _nth_dev;
+        i = _nth_pos;
+    }
+    for (; (i < pos) && tmp; i++) {
         tmp = tmp->next;
     }
+    if (tmp && (pos >= 0)) {
+        _nth_dev = tmp;
+        _nth_pos = pos;
+    }
     return tmp;
 }
 
 saul_reg_t *saul_reg_find_type(uint8_t type)
 {
+#ifdef MODULE_SAUL_REG_INDEX
+    saul_reg_t *tmp = _by_type[_type_bucket(type)];
+#else
     saul_reg_t *tmp = saul_reg;
+#endif
 
     while (tmp) {
         if (tmp->driver->type == type) {
@@ -102,7 +205,11 @@ saul_reg_t *saul_reg_find_type(uint8_t type)
 
 saul_reg_t *saul_reg_find_name(const char *name)
 {
+#ifdef MODULE_SAUL_REG_INDEX
+    saul_reg_t *tmp = _by_name[_name_bucket(name)];
+#else
     saul_reg_t *tmp = saul_reg;
+#endif
 
     while (tmp) {
         if (strcmp(tmp->name, name) == 0) {
@@ -113,12 +220,70 @@ saul_reg_t *saul_reg_find_name(const char *name)
     return NULL;
 }
 
+#ifdef MODULE_SAUL_REG_CACHE
+static int _read_cached(saul_reg_t *dev, phydat_t *res, uint64_t now)
+{
+    uint32_t max_age = (dev->max_age) ? dev->max_age : SAUL_REG_CACHE_MAX_AGE;
+
+    if ((dev->cache_dim > 0) && ((now - dev->cache_time) <= max_age)) {
+        memcpy(res, &dev->cache, sizeof(phydat_t));
+        return dev->cache_dim;
+    }
+
+    int dim = dev->driver->read(dev->dev, res);
+    if (dim > 0) {
+        memcpy(&dev->cache, res, sizeof(phydat_t));
+        dev->cache_time = now;
+        dev->cache_dim = dim;
+    }
+    else {
+        dev->cache_dim = 0;
+    }
+    return dim;
+}
+#endif
+
 int saul_reg_read(saul_reg_t *dev, phydat_t *res)
 {
     if (dev == NULL) {
         return -ENODEV;
     }
+#ifdef MODULE_SAUL_REG_CACHE
+    return _read_cached(dev, res, xtimer_now_usec64());
+#else
     return dev->driver->read(dev->dev, res);
+#endif
+}
+
+int saul_reg_read_batch(saul_reg_t *const *devs, phydat_t *res, int *dims,
+                        size_t num)
+{
+    int read = 0;
+#ifdef MODULE_SAUL_REG_CACHE
+    uint64_t now = xtimer_now_usec64();
+#endif
+
+    for (size_t i = 0; i < num; i++) {
+        int dim;
+
+        if (devs[i] == NULL) {
+            dim = -ENODEV;
+        }
+        else {
+#ifdef MODULE_SAUL_REG_CACHE
+            dim = _read_cached(devs[i], &res[i], now);
+#else
+            dim = devs[i]->driver->read(devs[i]->dev, &res[i]);
+#endif
+        }
+        if (dims) {
+            dims[i] = dim;
+        }
+        if (dim > 0) {
+            read++;
+        }
+    }
+    return read;
 }
 
 int saul_reg_write(saul_reg_t *dev, phydat_t *data)
@@ -126,5 +291,9 @@ int saul_reg_write(saul_reg_t *dev, phydat_t *data)
     if (dev == NULL) {
         return -ENODEV;
     }
+#ifdef MODULE_SAUL_REG_CACHE
+    /* the written value might change what the device reads */
+    dev->cache_dim = 0;
+#endif
     return dev->driver->write(dev->dev, data);
 }
@@ -0,0 +1,391 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_scbor
+ * @{
+ *
+ * @file
+ * @brief       Streaming CBOR decoder
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "scbor.h"
+#include "scbor_internal.h"
+
+static int _skip(scbor_value_t *val, unsigned depth);
+static int _leave(scbor_value_t *val, scbor_value_t *container,
+                  unsigned depth);
+
+void scbor_decoder_init(scbor_value_t *val, const uint8_t *buf, size_t len)
+{
+    val->cur = buf;
+    val->end = buf + len;
+    val->remaining = 0;
+    val->flags = 0;
+}
+
+bool scbor_at_end(const scbor_value_t *val)
+{
+    if (val->cur >= val->end) {
+        return true;
+    }
+    if (!(val->flags & SCBOR_DEC_CONTAINER)) {
+        return false;
+    }
+    if (val->flags & SCBOR_DEC_INDEFINITE) {
+        return *val->cur == SCBOR_BREAK;
+    }
+    return val->remaining == 0;
+}
+
+int scbor_get_type(const scbor_value_t *val)
+{
+    if (scbor_at_end(val)) {
+        return -ENOENT;
+    }
+    return *val->cur >> 5;
+}
+
+/* Consume one item (or only a tag, which belongs to the following item) */
+static void _advance(scbor_value_t *val, size_t len, bool item)
+{
+    val->cur += len;
+    if (item && (val->flags & SCBOR_DEC_CONTAINER) &&
+        !(val->flags & SCBOR_DEC_INDEFINITE)) {
+        val->remaining--;
+    }
+}
+
+/* Parse the initial byte and argument of the next item without consuming it,
+ * returns the length of the head or a negative error */
+static int _get_head(const scbor_value_t *val, uint8_t type, uint64_t *num)
+{
+    int res = scbor_get_type(val);
+
+    if (res < 0) {
+        return res;
+    }
+    if ((unsigned)res != type) {
+        return -EINVAL;
+    }
+
+    uint8_t info = *val->cur & SCBOR_INFO_MASK;
+    if (info < SCBOR_INFO_UINT8) {
+        *num = info;
+        return 1;
+    }
+    if (info > SCBOR_INFO_UINT64) {
+        /* reserved values and indefinite lengths */
+        return -EINVAL;
+    }
+
+    unsigned bytes = 1U << (info - SCBOR_INFO_UINT8);
+    if ((size_t)(val->end - val->cur) <= bytes) {
+        return -EINVAL;
+    }
+    *num = 0;
+    for (unsigned i = 1; i <= bytes; i++) {
+        *num = (*num << 8) | val->cur[i];
+    }
+    return 1 + bytes;
+}
+
+int scbor_get_uint32(scbor_value_t *val, uint32_t *num)
+{
+    uint64_t tmp;
+    int res = _get_head(val, SCBOR_TYPE_UINT, &tmp);
+
+    if (res < 0) {
+        return res;
+    }
+    if (tmp > UINT32_MAX) {
+        return -EOVERFLOW;
+    }
+    *num = (uint32_t)tmp;
+    _advance(val, res, true);
+    return res;
+}
+
+int scbor_get_int32(scbor_value_t *val, int32_t *num)
+{
+    uint64_t tmp;
+    bool negative = (scbor_get_type(val) == SCBOR_TYPE_NINT);
+    int res = _get_head(val, negative ? SCBOR_TYPE_NINT : SCBOR_TYPE_UINT,
+                        &tmp);
+
+    if (res < 0) {
+        return res;
+    }
+    /* -1 - tmp is the value of a negative integer */
+    if (tmp > INT32_MAX) {
+        return -EOVERFLOW;
+    }
+    *num = negative ? (-1 - (int32_t)tmp) : (int32_t)tmp;
+    _advance(val, res, true);
+    return res;
+}
+
+static int _get_simple(scbor_value_t *val, uint8_t *simple)
+{
+    if (scbor_at_end(val)) {
+        return -ENOENT;
+    }
+    *simple = *val->cur;
+    return 1;
+}
+
+int scbor_get_bool(scbor_value_t *val, bool *res)
+{
+    uint8_t simple;
+    int len = _get_simple(val, &simple);
+
+    if (len < 0) {
+        return len;
+    }
+    if ((simple != SCBOR_SIMPLE_FALSE) && (simple != SCBOR_SIMPLE_TRUE)) {
+        return -EINVAL;
+    }
+    *res = (simple == SCBOR_SIMPLE_TRUE);
+    _advance(val, 1, true);
+    return 1;
+}
+
+int scbor_get_null(scbor_value_t *val)
+{
+    uint8_t simple;
+    int len = _get_simple(val, &simple);
+
+    if (len < 0) {
+        return len;
+    }
+    if (simple != SCBOR_SIMPLE_NULL) {
+        return -EINVAL;
+    }
+    _advance(val, 1, true);
+    return 1;
+}
+
+int scbor_get_float(scbor_value_t *val, float *num)
+{
+    uint8_t simple;
+    int len = _get_simple(val, &simple);
+
+    if (len < 0) {
+        return len;
+    }
+    if ((simple != SCBOR_SIMPLE_FLOAT32) || ((val->end - val->cur) < 5)) {
+        return -EINVAL;
+    }
+
+    uint32_t bits = 0;
+    for (unsigned i = 1; i <= 4; i++) {
+        bits = (bits << 8) | val->cur[i];
+    }
+    memcpy(num, &bits, sizeof(*num));
+    _advance(val, 5, true);
+    return 5;
+}
+
+int scbor_get_tag(scbor_value_t *val, uint32_t *tag)
+{
+    uint64_t tmp;
+    int res = _get_head(val, SCBOR_TYPE_TAG, &tmp);
+
+    if (res < 0) {
+        return res;
+    }
+    if (tmp > UINT32_MAX) {
+        return -EOVERFLOW;
+    }
+    *tag = (uint32_t)tmp;
+    _advance(val, res, false);
+    return res;
+}
+
+static int _get_str(scbor_value_t *val, uint8_t type, const uint8_t **buf,
+                    size_t *len)
+{
+    uint64_t tmp;
+    int res = _get_head(val, type, &tmp);
+
+    if (res < 0) {
+        return res;
+    }
+    if (tmp > (uint64_t)(val->end - val->cur - res)) {
+        return -EINVAL;
+    }
+    *buf = val->cur + res;
+    *len = (size_t)tmp;
+    _advance(val, res + *len, true);
+    return res + *len;
+}
+
+int scbor_get_bstr(scbor_value_t *val, const uint8_t **buf, size_t *len)
+{
+    return _get_str(val, SCBOR_TYPE_BSTR, buf, len);
+}
+
+int scbor_get_tstr(scbor_value_t *val, const char **buf, size_t *len)
+{
+    return _get_str(val, SCBOR_TYPE_TSTR, (const uint8_t **)buf, len);
+}
+
+static int _enter(const scbor_value_t *val, scbor_value_t *container,
+                  uint8_t type)
+{
+    int res = scbor_get_type(val);
+
+    if (res < 0) {
+        return res;
+    }
+    if ((unsigned)res != type) {
+        return -EINVAL;
+    }
+
+    container->end = val->end;
+    if ((*val->cur & SCBOR_INFO_MASK) == SCBOR_INFO_INDEFINITE) {
+        container->cur = val->cur + 1;
+        container->remaining = 0;
+        container->flags = SCBOR_DEC_CONTAINER | SCBOR_DEC_INDEFINITE;
+        return 0;
+    }
+
+    uint64_t num;
+    res = _get_head(val, type, &num);
+    if (res < 0) {
+        return res;
+    }
+    /* maps hold a key and a value per entry */
+    if (type == SCBOR_TYPE_MAP) {
+        num *= 2;
+    }
+    if (num > UINT32_MAX) {
+        return -EINVAL;
+    }
+    container->cur = val->cur + res;
+    container->remaining = (uint32_t)num;
+    container->flags = SCBOR_DEC_CONTAINER;
+    return 0;
+}
+
+int scbor_enter_array(const scbor_value_t *val, scbor_value_t *array)
+{
+    return _enter(val, array, SCBOR_TYPE_ARR);
+}
+
+int scbor_enter_map(const scbor_value_t *val, scbor_value_t *map)
+{
+    return _enter(val, map, SCBOR_TYPE_MAP);
+}
+
+static int _leave(scbor_value_t *val, scbor_value_t *container,
+                  unsigned depth)
+{
+    while (!scbor_at_end(container)) {
+        int res = _skip(container, depth);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if (container->flags & SCBOR_DEC_INDEFINITE) {
+        if (container->cur >= container->end) {
+            /* missing break */
+            return -EINVAL;
+        }
+        container->cur++;
+    }
+    else if (container->remaining) {
+        /* truncated input */
+        return -EINVAL;
+    }
+    _advance(val, container->cur - val->cur, true);
+    return 0;
+}
+
+int scbor_leave_container(scbor_value_t *val, scbor_value_t *container)
+{
+    return _leave(val, container, SCBOR_RECURSION_MAX);
+}
+
+static int _skip(scbor_value_t *val, unsigned depth)
+{
+    int type = scbor_get_type(val);
+    uint64_t num;
+    int res;
+
+    if (type < 0) {
+        return type;
+    }
+    switch (type) {
+        case SCBOR_TYPE_UINT:
+        case SCBOR_TYPE_NINT:
+            res = _get_head(val, type, &num);
+            if (res > 0) {
+                _advance(val, res, true);
+            }
+            break;
+        case SCBOR_TYPE_BSTR:
+        case SCBOR_TYPE_TSTR: {
+            const uint8_t *buf;
+            size_t len;
+            res = _get_str(val, type, &buf, &len);
+            break;
+        }
+        case SCBOR_TYPE_ARR:
+        case SCBOR_TYPE_MAP: {
+            scbor_value_t container;
+            if (depth == 0) {
+                return -EINVAL;
+            }
+            res = _enter(val, &container, type);
+            if (res == 0) {
+                res = _leave(val, &container, depth - 1);
+            }
+            break;
+        }
+        case SCBOR_TYPE_TAG:
+            if (depth == 0) {
+                return -EINVAL;
+            }
+            res = _get_head(val, type, &num);
+            if (res > 0) {
+                _advance(val, res, false);
+                res = _skip(val, depth - 1);
+            }
+            break;
+        default: {
+            /* simple values and floats */
+            static const uint8_t lens[] = { 2, 3, 5, 9 };
+            uint8_t info = *val->cur & SCBOR_INFO_MASK;
+            size_t len = 1;
+            if (info >= SCBOR_INFO_UINT8) {
+                if (info > SCBOR_INFO_UINT64) {
+                    return -EINVAL;
+                }
+                len = lens[info - SCBOR_INFO_UINT8];
+            }
+            if ((size_t)(val->end - val->cur) < len) {
+                return -EINVAL;
+            }
+            _advance(val, len, true);
+            res = 0;
+            break;
+        }
+    }
+    return (res < 0) ? res : 0;
+}
+
+int scbor_skip(scbor_value_t *val)
+{
+    return _skip(val, SCBOR_RECURSION_MAX);
+}
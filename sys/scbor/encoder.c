@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_scbor
+ * @{
+ *
+ * @file
+ * @brief       Streaming CBOR encoder
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "scbor.h"
+#include "scbor_internal.h"
+
+void scbor_enc_init(scbor_enc_t *enc, uint8_t *buf, size_t len)
+{
+    enc->cur = buf;
+    enc->end = buf ? buf + len : NULL;
+    enc->len = 0;
+}
+
+static void _put(scbor_enc_t *enc, const void *data, size_t len)
+{
+    if (len == 0) {
+        return;
+    }
+    if ((size_t)(enc->end - enc->cur) >= len) {
+        memcpy(enc->cur, data, len);
+        enc->cur += len;
+    }
+    else {
+        /* never write again once an item was truncated */
+        enc->end = enc->cur;
+    }
+    enc->len += len;
+}
+
+static void _fmt_head(scbor_enc_t *enc, uint8_t type, uint64_t num)
+{
+    uint8_t head[9];
+    unsigned bytes;
+
+    if (num < SCBOR_INFO_UINT8) {
+        head[0] = (type << 5) | (uint8_t)num;
+        _put(enc, head, 1);
+        return;
+    }
+    else if (num <= UINT8_MAX) {
+        head[0] = (type << 5) | SCBOR_INFO_UINT8;
+        bytes = 1;
+    }
+    else if (num <= UINT16_MAX) {
+        head[0] = (type << 5) | SCBOR_INFO_UINT16;
+        bytes = 2;
+    }
+    else if (num <= UINT32_MAX) {
+        head[0] = (type << 5) | SCBOR_INFO_UINT32;
+        bytes = 4;
+    }
+    else {
+        head[0] = (type << 5) | SCBOR_INFO_UINT64;
+        bytes = 8;
+    }
+    for (unsigned i = bytes; i > 0; i--) {
+        head[i] = (uint8_t)num;
+        num >>= 8;
+    }
+    _put(enc, head, bytes + 1);
+}
+
+static void _fmt_byte(scbor_enc_t *enc, uint8_t byte)
+{
+    _put(enc, &byte, 1);
+}
+
+void scbor_fmt_uint(scbor_enc_t *enc, uint64_t num)
+{
+    _fmt_head(enc, SCBOR_TYPE_UINT, num);
+}
+
+void scbor_fmt_int(scbor_enc_t *enc, int64_t num)
+{
+    if (num < 0) {
+        /* -1 - num can not overflow, unlike -num */
+        _fmt_head(enc, SCBOR_TYPE_NINT, (uint64_t)(-1 - num));
+    }
+    else {
+        _fmt_head(enc, SCBOR_TYPE_UINT, (uint64_t)num);
+    }
+}
+
+void scbor_fmt_bool(scbor_enc_t *enc, bool val)
+{
+    _fmt_byte(enc, val ? SCBOR_SIMPLE_TRUE : SCBOR_SIMPLE_FALSE);
+}
+
+void scbor_fmt_null(scbor_enc_t *enc)
+{
+    _fmt_byte(enc, SCBOR_SIMPLE_NULL);
+}
+
+void scbor_fmt_float(scbor_enc_t *enc, float num)
+{
+    uint8_t buf[5] = { SCBOR_SIMPLE_FLOAT32 };
+    uint32_t bits;
+
+    memcpy(&bits, &num, sizeof(bits));
+    for (unsigned i = 4; i > 0; i--) {
+        buf[i] = (uint8_t)bits;
+        bits >>= 8;
+    }
+    _put(enc, buf, sizeof(buf));
+}
+
+void scbor_fmt_tag(scbor_enc_t *enc, uint32_t tag)
+{
+    _fmt_head(enc, SCBOR_TYPE_TAG, tag);
+}
+
+void scbor_fmt_array(scbor_enc_t *enc, size_t len)
+{
+    _fmt_head(enc, SCBOR_TYPE_ARR, len);
+}
+
+void scbor_fmt_map(scbor_enc_t *enc, size_t len)
+{
+    _fmt_head(enc, SCBOR_TYPE_MAP, len);
+}
+
+void scbor_fmt_array_indefinite(scbor_enc_t *enc)
+{
+    _fmt_byte(enc, (SCBOR_TYPE_ARR << 5) | SCBOR_INFO_INDEFINITE);
+}
+
+void scbor_fmt_map_indefinite(scbor_enc_t *enc)
+{
+    _fmt_byte(enc, (SCBOR_TYPE_MAP << 5) | SCBOR_INFO_INDEFINITE);
+}
+
+void scbor_fmt_end(scbor_enc_t *enc)
+{
+    _fmt_byte(enc, SCBOR_BREAK);
+}
+
+void scbor_put_bstr(scbor_enc_t *enc, const void *str, size_t len)
+{
+    _fmt_head(enc, SCBOR_TYPE_BSTR, len);
+    _put(enc, str, len);
+}
+
+void scbor_put_tstrn(scbor_enc_t *enc, const char *str, size_t len)
+{
+    _fmt_head(enc, SCBOR_TYPE_TSTR, len);
+    _put(enc, str, len);
+}
+
+void scbor_put_tstr(scbor_enc_t *enc, const char *str)
+{
+    scbor_put_tstrn(enc, str, strlen(str));
+}
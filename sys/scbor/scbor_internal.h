@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_scbor
+ * @{
+ *
+ * @file
+ * @brief       Encoding details shared by the CBOR encoder and decoder
+ */
+
+#ifndef SCBOR_INTERNAL_H
+#define SCBOR_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Additional information values of the initial byte
+ * @{
+ */
+#define SCBOR_INFO_UINT8        (24U)
+#define SCBOR_INFO_UINT16       (25U)
+#define SCBOR_INFO_UINT32       (26U)
+#define SCBOR_INFO_UINT64       (27U)
+#define SCBOR_INFO_INDEFINITE   (31U)
+#define SCBOR_INFO_MASK         (0x1fU)
+/** @} */
+
+/**
+ * @name    Initial bytes of simple values
+ * @{
+ */
+#define SCBOR_SIMPLE_FALSE      (0xf4U)
+#define SCBOR_SIMPLE_TRUE       (0xf5U)
+#define SCBOR_SIMPLE_NULL       (0xf6U)
+#define SCBOR_SIMPLE_FLOAT32    (0xfaU)
+#define SCBOR_BREAK             (0xffU)
+/** @} */
+
+/**
+ * @name    Decoder flags
+ * @{
+ */
+#define SCBOR_DEC_CONTAINER     (0x01U) /**< decoder iterates a container */
+#define SCBOR_DEC_INDEFINITE    (0x02U) /**< container ends with a break */
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCBOR_INTERNAL_H */
+/** @} */
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sensor_pipeline
+ * @{
+ *
+ * @file
+ * @brief       Sensor streaming pipeline implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "assert.h"
+#include "byteorder.h"
+#include "irq.h"
+#include "mutex.h"
+#include "sensor_pipeline.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static char _stack[SENSOR_PIPELINE_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static mutex_t _lock = MUTEX_INIT;
+static event_queue_t _queue;
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    /* the queue's owner is set by the creator */
+    event_loop(&_queue);
+
+    return NULL;
+}
+
+static void _timer_cb(void *arg)
+{
+    sensor_pipeline_t *pipe = arg;
+
+    event_post(&_queue, &pipe->event);
+    xtimer_set(&pipe->timer, pipe->period);
+}
+
+static void _run(sensor_pipeline_t *pipe)
+{
+    for (sensor_pipeline_stage_t *stage = pipe->stages; stage != NULL;
+         stage = stage->next) {
+        int res = stage->process(stage, &pipe->buf);
+
+        if (res < 0) {
+            DEBUG("sensor_pipeline: stage %p failed (%d)\n",
+                  (void *)stage, res);
+            pipe->errors++;
+        }
+        if (res != SENSOR_PIPELINE_NEXT) {
+            break;
+        }
+    }
+}
+
+static void _reset(sensor_pipeline_t *pipe)
+{
+    pipe->buf.values = pipe->mem;
+    pipe->buf.size = pipe->mem_len;
+    pipe->buf.numof = 0;
+    pipe->buf.dim = 0;
+}
+
+static void _handler(event_t *event)
+{
+    sensor_pipeline_t *pipe = (sensor_pipeline_t *)event;
+
+    if (pipe->source == NULL) {
+        _run(pipe);
+        pipe->busy = false;
+        return;
+    }
+
+    int res = pipe->source->process(pipe->source, &pipe->buf);
+
+    if (res < 0) {
+        DEBUG("sensor_pipeline: source failed (%d)\n", res);
+        pipe->errors++;
+        return;
+    }
+    /* the sinks only run once the batch is complete */
+    if ((pipe->buf.dim == 0) ||
+        ((pipe->buf.numof + pipe->buf.dim) <= pipe->buf.size)) {
+        return;
+    }
+    _run(pipe);
+    _reset(pipe);
+}
+
+void sensor_pipeline_init(sensor_pipeline_t *pipe,
+                          sensor_pipeline_stage_t *source,
+                          int16_t *mem, size_t numof)
+{
+    assert(pipe);
+    assert((source == NULL) || ((mem != NULL) && (numof >= PHYDAT_DIM) &&
+                                (numof <= UINT16_MAX)));
+
+    memset(pipe, 0, sizeof(*pipe));
+    pipe->event.handler = _handler;
+    pipe->source = source;
+    pipe->mem = mem;
+    pipe->mem_len = numof;
+    pipe->timer.callback = _timer_cb;
+    pipe->timer.arg = pipe;
+    _reset(pipe);
+}
+
+void sensor_pipeline_add(sensor_pipeline_t *pipe,
+                         sensor_pipeline_stage_t *stage)
+{
+    sensor_pipeline_stage_t **last = &pipe->stages;
+
+    while (*last != NULL) {
+        last = &(*last)->next;
+    }
+    stage->next = NULL;
+    *last = stage;
+}
+
+int sensor_pipeline_start(sensor_pipeline_t *pipe, uint32_t period)
+{
+    mutex_lock(&_lock);
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), SENSOR_PIPELINE_PRIO,
+                             THREAD_CREATE_STACKTEST, _thread, NULL,
+                             "sensor_pipeline");
+        if (_pid <= KERNEL_PID_UNDEF) {
+            _pid = KERNEL_PID_UNDEF;
+            mutex_unlock(&_lock);
+            return -ENOMEM;
+        }
+        _queue.waiter = (thread_t *)thread_get(_pid);
+    }
+    mutex_unlock(&_lock);
+
+    if (pipe->source != NULL) {
+        pipe->period = period;
+        xtimer_set(&pipe->timer, period);
+    }
+    return 0;
+}
+
+void sensor_pipeline_stop(sensor_pipeline_t *pipe)
+{
+    xtimer_remove(&pipe->timer);
+    event_cancel(&_queue, &pipe->event);
+    pipe->busy = false;
+}
+
+int sensor_pipeline_push(sensor_pipeline_t *pipe, int16_t *values,
+                         size_t numof, uint8_t dim, uint8_t unit,
+                         int8_t scale)
+{
+    assert(pipe->source == NULL);
+    assert((dim > 0) && (numof <= UINT16_MAX));
+
+    unsigned state = irq_disable();
+
+    if (pipe->busy) {
+        irq_restore(state);
+        return -EBUSY;
+    }
+    pipe->busy = true;
+    irq_restore(state);
+
+    pipe->buf.values = values;
+    pipe->buf.numof = numof;
+    pipe->buf.size = numof;
+    pipe->buf.dim = dim;
+    pipe->buf.unit = unit;
+    pipe->buf.scale = scale;
+    event_post(&_queue, &pipe->event);
+    return 0;
+}
+
+ssize_t sensor_pipeline_encode(const sensor_pipeline_buf_t *buf,
+                               void *out, size_t len)
+{
+    uint8_t *pos = out;
+
+    if (len < SENSOR_PIPELINE_ENCODED_LEN(buf->numof)) {
+        return -ENOBUFS;
+    }
+    *pos++ = buf->unit;
+    *pos++ = (uint8_t)buf->scale;
+    *pos++ = buf->dim;
+    *pos++ = buf->numof >> 8;
+    *pos++ = buf->numof & 0xff;
+    for (unsigned i = 0; i < buf->numof; i++) {
+        network_uint16_t val = byteorder_htons((uint16_t)buf->values[i]);
+
+        memcpy(pos, &val, sizeof(val));
+        pos += sizeof(val);
+    }
+    return pos - (uint8_t *)out;
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sensor_pipeline
+ * @{
+ *
+ * @file
+ * @brief       Sources and sinks of the sensor streaming pipeline
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "assert.h"
+#include "sensor_pipeline.h"
+#ifdef MODULE_VFS
+#include "vfs.h"
+#endif
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#ifdef MODULE_SAUL_REG
+/* convert a value of scale 10^from to scale 10^to */
+static int16_t _rescale(int32_t val, int from, int to)
+{
+    for (; from > to; from--) {
+        val *= 10;
+        if ((val > INT16_MAX) || (val < INT16_MIN)) {
+            return (val > 0) ? INT16_MAX : INT16_MIN;
+        }
+    }
+    for (; from < to; from++) {
+        val /= 10;
+    }
+    return val;
+}
+
+static int _saul(sensor_pipeline_stage_t *stage, sensor_pipeline_buf_t *buf)
+{
+    sensor_pipeline_saul_t *src = (sensor_pipeline_saul_t *)stage;
+    phydat_t data;
+    int dim = saul_reg_read(src->dev, &data);
+
+    if (dim <= 0) {
+        return (dim < 0) ? dim : -ENODATA;
+    }
+    if (buf->numof == 0) {
+        buf->dim = dim;
+        buf->unit = data.unit;
+        buf->scale = data.scale;
+    }
+    else if (dim != buf->dim) {
+        return -EINVAL;
+    }
+    for (int d = 0; d < dim; d++) {
+        buf->values[buf->numof++] = _rescale(data.val[d], data.scale,
+                                             buf->scale);
+    }
+    return SENSOR_PIPELINE_NEXT;
+}
+
+void sensor_pipeline_saul_init(sensor_pipeline_saul_t *src, saul_reg_t *dev)
+{
+    assert(dev);
+
+    src->stage.next = NULL;
+    src->stage.process = _saul;
+    src->dev = dev;
+}
+#endif /* MODULE_SAUL_REG */
+
+#ifdef MODULE_PERIPH_ADC_CONTINUOUS
+static void _adc_cb(void *arg, int16_t *samples, size_t len)
+{
+    /* a block that arrives while the previous one is processed is lost */
+    if (sensor_pipeline_push(arg, samples, len, 1, UNIT_NONE, 0) < 0) {
+        DEBUG("sensor_pipeline: dropped ADC block\n");
+    }
+}
+
+int sensor_pipeline_adc_start(sensor_pipeline_t *pipe, adc_t line,
+                              adc_res_t res, uint32_t freq,
+                              int16_t *buf, size_t len)
+{
+    return adc_continuous_start(line, res, freq, buf, len, _adc_cb, pipe);
+}
+#endif /* MODULE_PERIPH_ADC_CONTINUOUS */
+
+#ifdef MODULE_SOCK_UDP
+static int _udp(sensor_pipeline_stage_t *stage, sensor_pipeline_buf_t *buf)
+{
+    sensor_pipeline_udp_t *sink = (sensor_pipeline_udp_t *)stage;
+    ssize_t len = sensor_pipeline_encode(buf, sink->pkt, sink->pkt_len);
+
+    if (len < 0) {
+        return len;
+    }
+    len = sock_udp_send(sink->sock, sink->pkt, len, &sink->remote);
+    return (len < 0) ? len : SENSOR_PIPELINE_NEXT;
+}
+
+void sensor_pipeline_udp_init(sensor_pipeline_udp_t *sink, sock_udp_t *sock,
+                              const sock_udp_ep_t *remote,
+                              uint8_t *pkt, size_t pkt_len)
+{
+    assert(remote && pkt);
+
+    sink->stage.next = NULL;
+    sink->stage.process = _udp;
+    sink->sock = sock;
+    sink->remote = *remote;
+    sink->pkt = pkt;
+    sink->pkt_len = pkt_len;
+}
+#endif /* MODULE_SOCK_UDP */
+
+#ifdef MODULE_GCOAP
+static int _coap(sensor_pipeline_stage_t *stage, sensor_pipeline_buf_t *buf)
+{
+    sensor_pipeline_coap_t *sink = (sensor_pipeline_coap_t *)stage;
+    coap_pkt_t pdu;
+
+    switch (gcoap_obs_init(&pdu, sink->pdu, sink->pdu_len, sink->resource)) {
+        case GCOAP_OBS_INIT_OK:
+            break;
+        case GCOAP_OBS_INIT_UNUSED:
+            /* nobody listens, don't even encode */
+            return SENSOR_PIPELINE_NEXT;
+        default:
+            return -ENOBUFS;
+    }
+
+    ssize_t len = sensor_pipeline_encode(buf, pdu.payload, pdu.payload_len);
+
+    if (len < 0) {
+        return len;
+    }
+    len = gcoap_finish(&pdu, len, COAP_FORMAT_OCTET);
+    if (len < 0) {
+        return len;
+    }
+    if (gcoap_obs_send(sink->pdu, len, sink->resource) == 0) {
+        return -EIO;
+    }
+    return SENSOR_PIPELINE_NEXT;
+}
+
+void sensor_pipeline_coap_init(sensor_pipeline_coap_t *sink,
+                               const coap_resource_t *resource,
+                               uint8_t *pdu, size_t pdu_len)
+{
+    assert(resource && pdu);
+
+    sink->stage.next = NULL;
+    sink->stage.process = _coap;
+    sink->resource = resource;
+    sink->pdu = pdu;
+    sink->pdu_len = pdu_len;
+}
+#endif /* MODULE_GCOAP */
+
+#ifdef MODULE_VFS
+static int _vfs(sensor_pipeline_stage_t *stage, sensor_pipeline_buf_t *buf)
+{
+    sensor_pipeline_vfs_t *sink = (sensor_pipeline_vfs_t *)stage;
+    ssize_t len = sensor_pipeline_encode(buf, sink->scratch,
+                                         sink->scratch_len);
+
+    if (len < 0) {
+        return len;
+    }
+
+    ssize_t res = vfs_write(sink->fd, sink->scratch, len);
+
+    if (res < 0) {
+        return res;
+    }
+    return (res == len) ? SENSOR_PIPELINE_NEXT : -ENOSPC;
+}
+
+void sensor_pipeline_vfs_init(sensor_pipeline_vfs_t *sink, int fd,
+                              uint8_t *scratch, size_t scratch_len)
+{
+    assert(scratch);
+
+    sink->stage.next = NULL;
+    sink->stage.process = _vfs;
+    sink->fd = fd;
+    sink->scratch = scratch;
+    sink->scratch_len = scratch_len;
+}
+#endif /* MODULE_VFS */
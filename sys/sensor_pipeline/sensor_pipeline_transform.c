@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sensor_pipeline
+ * @{
+ *
+ * @file
+ * @brief       Transform stages of the sensor streaming pipeline
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "assert.h"
+#include "bitarithm.h"
+#include "sensor_pipeline.h"
+
+static int16_t _sat16(int32_t val)
+{
+    if (val > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (val < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return val;
+}
+
+static int _ema(sensor_pipeline_stage_t *stage, sensor_pipeline_buf_t *buf)
+{
+    sensor_pipeline_ema_t *ema = (sensor_pipeline_ema_t *)stage;
+    unsigned dim = (buf->dim < PHYDAT_DIM) ? buf->dim : PHYDAT_DIM;
+
+    if (!ema->primed) {
+        for (unsigned d = 0; (d < dim) && (d < buf->numof); d++) {
+            ema->acc[d] = (int32_t)buf->values[d] << ema->shift;
+        }
+        ema->primed = true;
+    }
+    for (unsigned i = 0; i < buf->numof; i++) {
+        unsigned d = i % buf->dim;
+
+        if (d >= dim) {
+            continue;
+        }
+        /* acc holds y * 2^shift: acc += x - y */
+        ema->acc[d] += buf->values[i] - (ema->acc[d] >> ema->shift);
+        buf->values[i] = ema->acc[d] >> ema->shift;
+    }
+    return SENSOR_PIPELINE_NEXT;
+}
+
+void sensor_pipeline_ema_init(sensor_pipeline_ema_t *ema, uint8_t shift)
+{
+    assert(shift <= 15);
+
+    ema->stage.next = NULL;
+    ema->stage.process = _ema;
+    ema->shift = shift;
+    ema->primed = false;
+}
+
+static int _delta(sensor_pipeline_stage_t *stage, sensor_pipeline_buf_t *buf)
+{
+    (void)stage;
+
+    /* backwards, so every value is still absolute when it is subtracted */
+    for (unsigned i = buf->numof; i-- > buf->dim;) {
+        buf->values[i] = _sat16((int32_t)buf->values[i] -
+                                buf->values[i - buf->dim]);
+    }
+    return SENSOR_PIPELINE_NEXT;
+}
+
+void sensor_pipeline_delta_init(sensor_pipeline_delta_t *delta)
+{
+    delta->stage.next = NULL;
+    delta->stage.process = _delta;
+}
+
+static void _aggr_clear(sensor_pipeline_aggr_t *aggr)
+{
+    for (unsigned d = 0; d < PHYDAT_DIM; d++) {
+        matstat_clear(&aggr->state[d]);
+    }
+    aggr->count = 0;
+}
+
+static int _aggr(sensor_pipeline_stage_t *stage, sensor_pipeline_buf_t *buf)
+{
+    sensor_pipeline_aggr_t *aggr = (sensor_pipeline_aggr_t *)stage;
+    unsigned dim = buf->dim;
+    unsigned out = 0;
+
+    if (dim > PHYDAT_DIM) {
+        return -EINVAL;
+    }
+    /* a window consumes window * dim values and produces at most
+     * 3 * dim, so the results never overtake the unread values */
+    for (unsigned i = 0; (i + dim) <= buf->numof; i += dim) {
+        for (unsigned d = 0; d < dim; d++) {
+            matstat_add(&aggr->state[d], buf->values[i + d]);
+        }
+        if (++aggr->count < aggr->window) {
+            continue;
+        }
+        for (unsigned d = 0; d < dim; d++) {
+            const matstat_state_t *state = &aggr->state[d];
+
+            if (aggr->fields & SENSOR_PIPELINE_AGGR_MIN) {
+                buf->values[out++] = state->min;
+            }
+            if (aggr->fields & SENSOR_PIPELINE_AGGR_MEAN) {
+                buf->values[out++] = matstat_mean(state);
+            }
+            if (aggr->fields & SENSOR_PIPELINE_AGGR_MAX) {
+                buf->values[out++] = state->max;
+            }
+        }
+        _aggr_clear(aggr);
+    }
+
+    buf->numof = out;
+    buf->dim = dim * bitarithm_bits_set(aggr->fields);
+    return (out > 0) ? SENSOR_PIPELINE_NEXT : SENSOR_PIPELINE_DROP;
+}
+
+void sensor_pipeline_aggr_init(sensor_pipeline_aggr_t *aggr, uint16_t window,
+                               uint8_t fields)
+{
+    assert((fields != 0) && (window >= bitarithm_bits_set(fields)));
+
+    aggr->stage.next = NULL;
+    aggr->stage.process = _aggr;
+    aggr->window = window;
+    aggr->fields = fields & (SENSOR_PIPELINE_AGGR_MIN |
+                             SENSOR_PIPELINE_AGGR_MEAN |
+                             SENSOR_PIPELINE_AGGR_MAX);
+    _aggr_clear(aggr);
+}
@@ -18,6 +18,7 @@
  * @author      Oliver Hahm <oliver.hahm@inria.fr>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -30,6 +31,10 @@
 #ifdef MODULE_NETSTATS
 #include "net/netstats.h"
 #endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+#include "net/netstats/neighbor.h"
+#include "xtimer.h"
+#endif
 #ifdef MODULE_L2FILTER
 #include "net/l2filter.h"
 #endif
@@ -102,6 +107,8 @@ static const char *_netstats_module_to_str(uint8_t module)
             return "Layer 2";
         case NETSTATS_IPV6:
             return "IPv6";
+        case NETSTATS_NEIGHBOR:
+            return "Neighbors";
         case NETSTATS_ALL:
             return "all";
         default:
@@ -139,6 +146,57 @@ static int _netif_stats(kernel_pid_t iface, unsigned module, bool reset)
     }
     return res;
 }
+
+#ifdef MODULE_NETSTATS_NEIGHBOR
+static int _netif_stats_nb(kernel_pid_t iface, bool reset)
+{
+    netstats_nb_table_t *table;
+    uint32_t now = (xtimer_now_usec64() / US_PER_MS) & UINT32_MAX;
+    int res = gnrc_netapi_get(iface, NETOPT_STATS, NETSTATS_NEIGHBOR, &table,
+                              sizeof(&table));
+    unsigned count = 0;
+
+    if (res < 0) {
+        puts("           Device doesn't provide neighbor statistics.");
+        return res;
+    }
+    if (reset) {
+        netstats_nb_init(table);
+        printf("Reset statistics for module %s!\n",
+               _netstats_module_to_str(NETSTATS_NEIGHBOR));
+        return 0;
+    }
+    printf("          Statistics for %s\n",
+           _netstats_module_to_str(NETSTATS_NEIGHBOR));
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        const netstats_nb_t *nb = &table->entries[i];
+        char l2addr_str[3 * NETSTATS_NB_L2ADDR_MAXLEN];
+
+        if (nb->l2_addr_len == 0) {
+            continue;
+        }
+        count++;
+        printf("            %s\n",
+               gnrc_netif_addr_to_str(nb->l2_addr, nb->l2_addr_len,
+                                      l2addr_str));
+        printf("              ETX %u.%02u  TX %u (attempts: %u) errors %u\n",
+               (unsigned)(nb->etx / NETSTATS_NB_ETX_DIVISOR),
+               (unsigned)(((nb->etx % NETSTATS_NB_ETX_DIVISOR) * 100) /
+                          NETSTATS_NB_ETX_DIVISOR),
+               (unsigned)nb->tx_count, (unsigned)nb->tx_attempts,
+               (unsigned)nb->tx_failed);
+        if (nb->rx_count > 0) {
+            printf("              RX %u  RSSI %i  LQI %u  last heard %" PRIu32
+                   " ms ago\n", (unsigned)nb->rx_count, (int)nb->rssi,
+                   (unsigned)nb->lqi, now - nb->last_heard);
+        }
+    }
+    if (count == 0) {
+        puts("            --- none ---");
+    }
+    return 0;
+}
+#endif
 #endif /* MODULE_NETSTATS */
 
 static void _set_usage(char *cmd_name)
@@ -201,7 +259,7 @@ static void _del_usage(char *cmd_name)
 #ifdef MODULE_NETSTATS
 static void _stats_usage(char *cmd_name)
 {
-    printf("usage: %s <if_id> stats [l2|ipv6] [reset]\n", cmd_name);
+    printf("usage: %s <if_id> stats [l2|ipv6|nb] [reset]\n", cmd_name);
     puts("       reset can be only used if the module is specified.");
 }
 #endif
@@ -584,6 +642,11 @@ static void _netif_list(kernel_pid_t iface)
         if (count == 0) {
             puts("            --- none ---");
         }
+        netopt_enable_t hw = NETOPT_DISABLE;
+        if ((gnrc_netapi_get(iface, NETOPT_L2FILTER_HW, 0, &hw,
+                             sizeof(hw)) > 0) && (hw == NETOPT_ENABLE)) {
+            puts("            (enforced by hardware)");
+        }
     }
 #endif
 
@@ -593,6 +656,9 @@ static void _netif_list(kernel_pid_t iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+    _netif_stats_nb(iface, false);
 #endif
     puts("");
 }
@@ -1333,6 +1399,9 @@ int _gnrc_netif_config(int argc, char **argv)
                 else if (strcmp(argv[3], "ipv6") == 0) {
                     module = NETSTATS_IPV6;
                 }
+                else if (strcmp(argv[3], "nb") == 0) {
+                    module = NETSTATS_NEIGHBOR;
+                }
                 else {
                     printf("Module %s doesn't exist or does not provide statistics.\n", argv[3]);
 
@@ -1349,6 +1418,11 @@ int _gnrc_netif_config(int argc, char **argv)
                 if (module & NETSTATS_IPV6) {
                     _netif_stats((kernel_pid_t) iface, NETSTATS_IPV6, reset);
                 }
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                if (module & NETSTATS_NEIGHBOR) {
+                    _netif_stats_nb((kernel_pid_t) iface, reset);
+                }
+#endif
 
                 return 1;
             }
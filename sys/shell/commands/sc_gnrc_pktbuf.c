@@ -13,13 +13,50 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdio.h>
+#include <string.h>
+
 #include "net/gnrc/pktbuf.h"
 
+#ifdef MODULE_GNRC_PKTBUF_STATS
+static void _print_stats(void)
+{
+    gnrc_pktbuf_stats_t stats;
+
+    gnrc_pktbuf_get_stats(&stats);
+    printf("used: %u (max %u) of %u bytes\n", (unsigned)stats.used,
+           (unsigned)stats.max_used, (unsigned)GNRC_PKTBUF_SIZE);
+    printf("free: %u chunks, largest %u bytes\n", stats.free_chunks,
+           (unsigned)stats.free_largest);
+    printf("allocation failures: %lu\n", (unsigned long)stats.alloc_fails);
+    for (int i = 0; i < (GNRC_NETTYPE_NUMOF - GNRC_NETTYPE_IOVEC); i++) {
+        if (stats.alloc_fails_type[i]) {
+            printf("\ttype %d: %lu\n", i + GNRC_NETTYPE_IOVEC,
+                   (unsigned long)stats.alloc_fails_type[i]);
+        }
+    }
+    printf("hold time histogram, bucket n counts < 2^n * 1024 us:\n");
+    for (unsigned b = 0; b < GNRC_PKTBUF_STATS_BUCKETS; b++) {
+        printf(" %lu", (unsigned long)stats.hold_time[b]);
+    }
+    puts("");
+}
+#endif
+
 int _gnrc_pktbuf_cmd(int argc, char **argv)
 {
+#ifdef MODULE_GNRC_PKTBUF_STATS
+    if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+        gnrc_pktbuf_reset_stats();
+        return 0;
+    }
+    _print_stats();
+#endif
     (void)argc;
     (void)argv;
+#ifdef DEVELHELP
     gnrc_pktbuf_stats();
+#endif
     return 0;
 }
 
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the per-layer GNRC packet latencies
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/pktlat.h"
+#include "xtimer.h"
+
+static const char *_layers[] = { "netif", "6lo", "ipv6", "udp", "sock" };
+static const char *_dirs[] = { "rx", "tx" };
+
+static void _print_usage(const char *cmd)
+{
+    printf("usage: %s [reset]\n", cmd);
+}
+
+int _gnrc_pktlat(int argc, char **argv)
+{
+    if (argc > 1) {
+        if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+            gnrc_pktlat_reset();
+            return 0;
+        }
+        _print_usage(argv[0]);
+        return 1;
+    }
+
+    printf("layer hand-over latency histogram, bucket n counts latencies "
+           "< 2^n ticks (1 tick = %lu us)\n",
+           (unsigned long)xtimer_usec_from_ticks(xtimer_ticks(1)));
+    printf("\tlayer | dir |    count | max [us] | queue |");
+    for (unsigned b = 0; b < GNRC_PKTLAT_BUCKETS; b++) {
+        printf(" %5u", b);
+    }
+    puts("");
+    for (unsigned l = 0; l < GNRC_PKTLAT_LAYER_NUMOF; l++) {
+        for (unsigned d = 0; d < GNRC_PKTLAT_DIR_NUMOF; d++) {
+            gnrc_pktlat_stats_t stats = gnrc_pktlat_stats[l][d];
+
+            if (stats.count == 0) {
+                continue;
+            }
+            printf("\t%5s | %3s | %8lu | %8lu | %5u |", _layers[l], _dirs[d],
+                   (unsigned long)stats.count,
+                   (unsigned long)xtimer_usec_from_ticks(xtimer_ticks(stats.max)),
+                   stats.queue_max);
+            for (unsigned b = 0; b < GNRC_PKTLAT_BUCKETS; b++) {
+                printf(" %5u", stats.hist[b]);
+            }
+            puts("");
+        }
+    }
+    return 0;
+}
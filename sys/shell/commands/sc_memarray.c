@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the memarray pool statistics
+ *
+ * @}
+ */
+
+#include "memarray.h"
+
+int _memarray_handler(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    memarray_print_stats();
+    return 0;
+}
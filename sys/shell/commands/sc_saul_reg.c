@@ -26,6 +26,10 @@
 
 #include "saul_reg.h"
 
+#ifdef MODULE_AUTO_INIT_DEFERRED
+#include "auto_init.h"
+#endif
+
 /* this function does not check, if the given device is valid */
 static void probe(int num, saul_reg_t *dev)
 {
@@ -138,6 +142,10 @@ static void write(int argc, char **argv)
 
 int _saul(int argc, char **argv)
 {
+#ifdef MODULE_AUTO_INIT_DEFERRED
+    auto_init_wait();
+#endif
+
     if (argc < 2) {
         list();
     }
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the scheduler latency statistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sched.h"
+#include "thread.h"
+#include "xtimer.h"
+
+static void _print_usage(const char *cmd)
+{
+    printf("usage: %s [reset]\n", cmd);
+}
+
+int _schedlat_handler(int argc, char **argv)
+{
+    if (argc > 1) {
+        if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+            sched_latency_reset();
+            return 0;
+        }
+        _print_usage(argv[0]);
+        return 1;
+    }
+
+    printf("max. IRQ off: %lu cycles\n", (unsigned long)sched_irq_off_max);
+    printf("wake-to-run latency histogram, bucket n counts latencies < 2^n "
+           "ticks (1 tick = %lu us)\n",
+           (unsigned long)xtimer_usec_from_ticks(xtimer_ticks(1)));
+    printf("\tpid | pri | max [us] |");
+    for (unsigned b = 0; b < SCHEDLATENCY_BUCKETS; b++) {
+        printf(" %5u", b);
+    }
+    puts("");
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *p = (thread_t *)sched_threads[i];
+
+        if (p != NULL) {
+            schedlat_t lat = sched_latency[i];
+
+            printf("\t%3" PRIkernel_pid " | %3i | %8lu |", p->pid, p->priority,
+                   (unsigned long)xtimer_usec_from_ticks(xtimer_ticks(lat.max)));
+            for (unsigned b = 0; b < SCHEDLATENCY_BUCKETS; b++) {
+                printf(" %5u", lat.hist[b]);
+            }
+            puts("");
+        }
+    }
+    return 0;
+}
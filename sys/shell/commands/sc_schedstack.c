@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the sampled stack high-water marks
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sched.h"
+#include "thread.h"
+
+static void _print_usage(const char *cmd)
+{
+    printf("usage: %s [reset]\n", cmd);
+}
+
+int _schedstack_handler(int argc, char **argv)
+{
+    if (argc > 1) {
+        if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+            sched_stack_reset();
+            return 0;
+        }
+        _print_usage(argv[0]);
+        return 1;
+    }
+
+    puts("\tpid | stack | max used |  free");
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *p = (thread_t *)sched_threads[i];
+
+        if (p != NULL) {
+            unsigned used = sched_stack_max[i];
+
+            printf("\t%3" PRIkernel_pid " | %5i | %8u | %5i\n", p->pid,
+                   p->stack_size, used, p->stack_size - (int)used);
+        }
+    }
+    return 0;
+}
@@ -27,12 +27,20 @@
 #include "sht1x.h"
 #include "sht1x_params.h"
 
+#ifdef MODULE_AUTO_INIT_DEFERRED
+#include "auto_init.h"
+#endif
+
 #define SHT1X_NUM     (sizeof(sht1x_params) / sizeof(sht1x_params[0]))
 
 extern sht1x_dev_t sht1x_devs[SHT1X_NUM];
 
 static sht1x_dev_t *get_dev(int argc, char **argv)
 {
+#ifdef MODULE_AUTO_INIT_DEFERRED
+    auto_init_wait();
+#endif
+
     switch (argc) {
         case 1:
             return &sht1x_devs[0];
@@ -174,6 +182,10 @@ int _sht_config_handler(int argc, char **argv)
     int16_t hum_off = INT16_MAX;
     int dev_num = 0;
 
+#ifdef MODULE_AUTO_INIT_DEFERRED
+    auto_init_wait();
+#endif
+
     if ((argc == 2) && (strcmp("--help", argv[1]) == 0)) {
         printf("Usage: \"%s [PARMS]\n"
                "\n"
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to dump and control the event trace buffer
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "tracebuf.h"
+
+static void _print_usage(const char *cmd)
+{
+    printf("usage: %s [clear|on|off]\n", cmd);
+}
+
+int _tracebuf_handler(int argc, char **argv)
+{
+    if (argc == 1) {
+        tracebuf_dump();
+        return 0;
+    }
+    if (argc == 2) {
+        if (strcmp(argv[1], "clear") == 0) {
+            tracebuf_clear();
+            return 0;
+        }
+        if (strcmp(argv[1], "on") == 0) {
+            tracebuf_enable(true);
+            return 0;
+        }
+        if (strcmp(argv[1], "off") == 0) {
+            tracebuf_enable(false);
+            return 0;
+        }
+    }
+    _print_usage(argv[0]);
+    return 1;
+}
@@ -29,7 +29,7 @@ extern int _reboot_handler(int argc, char **argv);
 extern int _id_handler(int argc, char **argv);
 #endif
 
-#ifdef MODULE_LPC_COMMON
+#if defined(MODULE_LPC_COMMON) || defined(MODULE_TLSF_MALLOC)
 extern int _heap_handler(int argc, char **argv);
 #endif
 
@@ -37,6 +37,22 @@ extern int _heap_handler(int argc, char **argv);
 extern int _ps_handler(int argc, char **argv);
 #endif
 
+#ifdef MODULE_SCHEDLATENCY
+extern int _schedlat_handler(int argc, char **argv);
+#endif
+
+#ifdef MODULE_SCHEDSTACK
+extern int _schedstack_handler(int argc, char **argv);
+#endif
+
+#ifdef MODULE_TRACEBUF
+extern int _tracebuf_handler(int argc, char **argv);
+#endif
+
+#ifdef MODULE_MEMARRAY_STATS
+extern int _memarray_handler(int argc, char **argv);
+#endif
+
 #ifdef MODULE_SHT1X
 extern int _get_temperature_handler(int argc, char **argv);
 extern int _get_humidity_handler(int argc, char **argv);
@@ -112,6 +128,10 @@ extern int _blacklist(int argc, char **argv);
 extern int _gnrc_pktbuf_cmd(int argc, char **argv);
 #endif
 
+#ifdef MODULE_GNRC_PKTLAT
+extern int _gnrc_pktlat(int argc, char **argv);
+#endif
+
 #ifdef MODULE_GNRC_RPL
 extern int _gnrc_rpl(int argc, char **argv);
 #endif
@@ -151,12 +171,27 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_CONFIG
     {"id", "Gets or sets the node's id.", _id_handler},
 #endif
-#ifdef MODULE_LPC_COMMON
-    {"heap", "Shows the heap state for the LPC2387 on the command shell.", _heap_handler},
+#if defined(MODULE_LPC_COMMON) || defined(MODULE_TLSF_MALLOC)
+    {"heap", "Shows the heap state.", _heap_handler},
 #endif
 #ifdef MODULE_PS
     {"ps", "Prints information about running threads.", _ps_handler},
 #endif
+#ifdef MODULE_SCHEDLATENCY
+    {"schedlat", "Prints scheduling latency statistics of all threads.",
+     _schedlat_handler},
+#endif
+#ifdef MODULE_SCHEDSTACK
+    {"stackmax", "Prints the sampled stack high-water marks of all threads.",
+     _schedstack_handler},
+#endif
+#ifdef MODULE_TRACEBUF
+    {"tracebuf", "Prints the recorded trace events.", _tracebuf_handler},
+#endif
+#ifdef MODULE_MEMARRAY_STATS
+    {"memarray", "Prints the statistics of all memarray pools.",
+     _memarray_handler},
+#endif
 #ifdef MODULE_SHT1X
     {"temp", "Prints measured temperature.", _get_temperature_handler},
     {"hum", "Prints measured humidity.", _get_humidity_handler},
@@ -208,7 +243,10 @@ const shell_command_t _shell_command_list[] = {
     {"blacklist", "blacklists an address for receival ('blacklist [add|del|help]')", _blacklist },
 #endif
 #ifdef MODULE_GNRC_PKTBUF_CMD
-    {"pktbuf", "prints internal stats of the packet buffer", _gnrc_pktbuf_cmd },
+    {"pktbuf", "prints internal stats of the packet buffer ('pktbuf [reset]')", _gnrc_pktbuf_cmd },
+#endif
+#ifdef MODULE_GNRC_PKTLAT
+    {"pktlat", "prints per-layer packet latencies ('pktlat [reset]')", _gnrc_pktlat },
 #endif
 #ifdef MODULE_GNRC_RPL
     {"rpl", "rpl configuration tool ('rpl help' for more information)", _gnrc_rpl },
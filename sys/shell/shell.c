@@ -25,6 +25,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -44,6 +45,41 @@ static void _putchar(int c) {
 #endif
 #endif
 
+#ifdef MODULE_SHELL_BUFFERED
+static char _out_buf[SHELL_BUFFERED_OUT_SIZE];
+#endif
+
+#ifdef MODULE_SHELL_TLV
+int shell_tlv_write(uint8_t type, const void *data, size_t len)
+{
+    uint8_t hdr[] = { SHELL_TLV_START, type, len >> 8, len & 0xff };
+
+    if (len > UINT16_MAX) {
+        return -EINVAL;
+    }
+    if ((fwrite(hdr, 1, sizeof(hdr), stdout) != sizeof(hdr)) ||
+        (fwrite(data, 1, len, stdout) != len)) {
+        return -EIO;
+    }
+    return 0;
+}
+
+static void _tlv_result(int res)
+{
+    uint8_t data[] = { (uint32_t)res >> 24, (uint32_t)res >> 16,
+                       (uint32_t)res >> 8, (uint32_t)res };
+
+    shell_tlv_write(SHELL_TLV_TYPE_RESULT, data, sizeof(data));
+}
+#endif
+
+static inline void _flush(void)
+{
+#if defined(MODULE_NEWLIB) || defined(MODULE_SHELL_BUFFERED)
+    fflush(stdout);
+#endif
+}
+
 static shell_command_handler_t find_handler(const shell_command_t *command_list, char *command)
 {
     const shell_command_t *command_lists[] = {
@@ -99,7 +135,7 @@ static void print_help(const shell_command_t *command_list)
     }
 }
 
-static void handle_input_line(const shell_command_t *command_list, char *line)
+static int handle_input_line(const shell_command_t *command_list, char *line)
 {
     static const char *INCORRECT_QUOTING = "shell: incorrect quoting";
 
@@ -117,7 +153,7 @@ static void handle_input_line(const shell_command_t *command_list, char *line)
                     ++pos;
                     if (!*pos) {
                         puts(INCORRECT_QUOTING);
-                        return;
+                        return -EINVAL;
                     }
                     else if (*pos == '\\') {
                         /* skip over the next character */
@@ -125,14 +161,14 @@ static void handle_input_line(const shell_command_t *command_list, char *line)
                         ++pos;
                         if (!*pos) {
                             puts(INCORRECT_QUOTING);
-                            return;
+                            return -EINVAL;
                         }
                         continue;
                     }
                 } while (*pos != quote_char);
                 if ((unsigned char) pos[1] > ' ') {
                     puts(INCORRECT_QUOTING);
-                    return;
+                    return -EINVAL;
                 }
             }
             else {
@@ -144,13 +180,13 @@ static void handle_input_line(const shell_command_t *command_list, char *line)
                         ++pos;
                         if (!*pos) {
                             puts(INCORRECT_QUOTING);
-                            return;
+                            return -EINVAL;
                         }
                     }
                     ++pos;
                     if (*pos == '"') {
                         puts(INCORRECT_QUOTING);
-                        return;
+                        return -EINVAL;
                     }
                 } while ((unsigned char) *pos > ' ');
             }
@@ -169,7 +205,7 @@ static void handle_input_line(const shell_command_t *command_list, char *line)
         }
     }
     if (!argc) {
-        return;
+        return 0;
     }
 
     /* then we fill the argv array */
@@ -205,14 +241,16 @@ static void handle_input_line(const shell_command_t *command_list, char *line)
     /* then we call the appropriate handler */
     shell_command_handler_t handler = find_handler(command_list, argv[0]);
     if (handler != NULL) {
-        handler(argc, argv);
+        return handler(argc, argv);
     }
     else {
         if (strcmp("help", argv[0]) == 0) {
             print_help(command_list);
+            return 0;
         }
         else {
             printf("shell: command not found: %s\n", argv[0]);
+            return -ENOENT;
         }
     }
 }
@@ -257,12 +295,19 @@ static int readline(char *buf, size_t size)
             _putchar('\b');
             _putchar(' ');
             _putchar('\b');
+#ifdef MODULE_SHELL_BUFFERED
+            fflush(stdout);
+#endif
 #endif
         }
         else {
             *line_buf_ptr++ = c;
 #ifndef SHELL_NO_ECHO
             _putchar(c);
+#ifdef MODULE_SHELL_BUFFERED
+            /* keep interactive sessions responsive */
+            fflush(stdout);
+#endif
 #endif
         }
     }
@@ -275,13 +320,16 @@ static inline void print_prompt(void)
     _putchar(' ');
 #endif
 
-#ifdef MODULE_NEWLIB
-    fflush(stdout);
-#endif
+    _flush();
 }
 
 void shell_run(const shell_command_t *shell_commands, char *line_buf, int len)
 {
+#ifdef MODULE_SHELL_BUFFERED
+    /* collect the output of a command and write it at once */
+    setvbuf(stdout, _out_buf, _IOFBF, sizeof(_out_buf));
+#endif
+
     print_prompt();
 
     while (1) {
@@ -292,7 +340,12 @@ void shell_run(const shell_command_t *shell_commands, char *line_buf, int len)
         }
 
         if (!res) {
-            handle_input_line(shell_commands, line_buf);
+            int cmd_res = handle_input_line(shell_commands, line_buf);
+#ifdef MODULE_SHELL_TLV
+            _tlv_result(cmd_res);
+#else
+            (void)cmd_res;
+#endif
         }
 
         print_prompt();
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sigproc
+ * @{
+ *
+ * @file
+ * @brief       Block based signal processing, with and without CMSIS-DSP
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "sigproc.h"
+
+#ifndef MODULE_CMSIS_DSP
+static inline int16_t _sat16(int64_t val)
+{
+    if (val > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (val < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)val;
+}
+
+static uint32_t _isqrt(uint32_t val)
+{
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > val) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (val >= res + bit) {
+            val -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+#endif
+
+int sigproc_fir_init(sigproc_fir_t *fir, const int16_t *coeffs,
+                     uint16_t num_taps, uint8_t factor, int16_t *state,
+                     size_t block_size)
+{
+    assert(fir && coeffs && state);
+
+    /* CMSIS-DSP's q15 FIR kernels process pairs of coefficients */
+    if ((num_taps < 4) || (num_taps & 1) || (factor == 0) ||
+        (block_size == 0) || (block_size % factor)) {
+        return -EINVAL;
+    }
+
+    fir->coeffs = coeffs;
+    fir->state = state;
+    fir->num_taps = num_taps;
+    fir->factor = factor;
+    memset(state, 0, SIGPROC_FIR_STATE_LEN(num_taps, block_size) *
+                     sizeof(int16_t));
+
+#ifdef MODULE_CMSIS_DSP
+    if (factor == 1) {
+        if (arm_fir_init_q15(&fir->arm.fir, num_taps, (q15_t *)coeffs,
+                             state, block_size) != ARM_MATH_SUCCESS) {
+            return -EINVAL;
+        }
+    }
+    else if (arm_fir_decimate_init_q15(&fir->arm.dec, num_taps, factor,
+                                       (q15_t *)coeffs, state,
+                                       block_size) != ARM_MATH_SUCCESS) {
+        return -EINVAL;
+    }
+#endif
+
+    return 0;
+}
+
+void sigproc_fir(sigproc_fir_t *fir, const int16_t *in, int16_t *out,
+                 size_t len)
+{
+    assert(fir && in && out);
+    assert((len % fir->factor) == 0);
+
+#ifdef MODULE_CMSIS_DSP
+    if (fir->factor == 1) {
+        arm_fir_q15(&fir->arm.fir, (q15_t *)in, out, len);
+    }
+    else {
+        arm_fir_decimate_q15(&fir->arm.dec, (q15_t *)in, out, len);
+    }
+#else
+    size_t hist = fir->num_taps - 1;
+
+    /* the state holds the last num_taps - 1 inputs, followed by the block */
+    memcpy(&fir->state[hist], in, len * sizeof(int16_t));
+    for (size_t k = 0; k < (len / fir->factor); k++) {
+        const int16_t *x = &fir->state[k * fir->factor];
+        int64_t acc = 0;
+        for (unsigned i = 0; i < fir->num_taps; i++) {
+            acc += (int32_t)x[i] * fir->coeffs[i];
+        }
+        out[k] = _sat16(acc >> 15);
+    }
+    memmove(fir->state, &fir->state[len], hist * sizeof(int16_t));
+#endif
+}
+
+int sigproc_biquad_init(sigproc_biquad_t *iir, const int16_t *coeffs,
+                        uint8_t num_stages, int16_t *state,
+                        uint8_t post_shift)
+{
+    assert(iir && coeffs && state);
+
+    if ((num_stages == 0) || (post_shift > 15)) {
+        return -EINVAL;
+    }
+
+    iir->coeffs = coeffs;
+    iir->state = state;
+    iir->num_stages = num_stages;
+    iir->post_shift = post_shift;
+
+#ifdef MODULE_CMSIS_DSP
+    /* also clears the state */
+    arm_biquad_cascade_df1_init_q15(&iir->arm, num_stages, (q15_t *)coeffs,
+                                    state, (int8_t)post_shift);
+#else
+    memset(state, 0, SIGPROC_BIQUAD_STATE_LEN(num_stages) * sizeof(int16_t));
+#endif
+
+    return 0;
+}
+
+void sigproc_biquad(sigproc_biquad_t *iir, const int16_t *in, int16_t *out,
+                    size_t len)
+{
+    assert(iir && in && out);
+
+#ifdef MODULE_CMSIS_DSP
+    arm_biquad_cascade_df1_q15(&iir->arm, (q15_t *)in, out, len);
+#else
+    const int16_t *src = in;
+
+    for (unsigned s = 0; s < iir->num_stages; s++) {
+        const int16_t *c = &iir->coeffs[6 * s];
+        int16_t *st = &iir->state[4 * s];
+        int16_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        /* each stage filters the output of the previous one in place */
+        for (size_t n = 0; n < len; n++) {
+            int16_t x0 = src[n];
+            int64_t acc = (int32_t)c[0] * x0 + (int32_t)c[2] * x1 +
+                          (int32_t)c[3] * x2 + (int32_t)c[4] * y1 +
+                          (int32_t)c[5] * y2;
+            int16_t y0 = _sat16(acc >> (15 - iir->post_shift));
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            out[n] = y0;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        src = out;
+    }
+#endif
+}
+
+int16_t sigproc_rms(const int16_t *in, size_t len)
+{
+    assert(in && len);
+
+#ifdef MODULE_CMSIS_DSP
+    q15_t res;
+    arm_rms_q15((q15_t *)in, len, &res);
+    return res;
+#else
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        sum += (int32_t)in[i] * in[i];
+    }
+    /* the mean of squares is Q30, its square root is Q15 */
+    uint32_t res = _isqrt((uint32_t)(sum / len));
+    return (res > INT16_MAX) ? INT16_MAX : (int16_t)res;
+#endif
+}
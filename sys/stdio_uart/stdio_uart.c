@@ -42,6 +42,14 @@ extern ethos_t ethos;
 #include "vfs.h"
 #endif
 
+#ifdef MODULE_STDIO_UART_ASYNC
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -49,10 +57,157 @@ extern ethos_t ethos;
 static char _rx_buf_mem[STDIO_UART_RX_BUFSIZE];
 isrpipe_t stdio_uart_isrpipe = ISRPIPE_INIT(_rx_buf_mem);
 
+#ifndef USE_ETHOS_FOR_STDIO
+#ifdef MODULE_PERIPH_UART_DMA
+static uint8_t _rx_dma_buf[STDIO_UART_DMA_BUFSIZE];
+
+static void _rx_chunk(void *arg, const uint8_t *data, size_t len)
+{
+    isrpipe_write(arg, (const char *)data, len);
+}
+#endif
+
+static void _init_uart(void)
+{
+#ifdef MODULE_PERIPH_UART_DMA
+    if (uart_init_dma(STDIO_UART_DEV, STDIO_UART_BAUDRATE, _rx_dma_buf,
+                      sizeof(_rx_dma_buf), _rx_chunk,
+                      &stdio_uart_isrpipe) == UART_OK) {
+        return;
+    }
+    /* no RX DMA for this device, fall back to per byte interrupts */
+#endif
+    uart_init(STDIO_UART_DEV, STDIO_UART_BAUDRATE, (uart_rx_cb_t) isrpipe_write_one, &stdio_uart_isrpipe);
+}
+#endif
+
+#ifdef MODULE_STDIO_UART_ASYNC
+#define FLAG_DATA   (0x1)
+#define FLAG_DONE   (0x2)
+
+static char _tx_buf_mem[STDIO_UART_TX_BUFSIZE];
+static tsrb_t _tx_rb = TSRB_INIT(_tx_buf_mem);
+static char _tx_chunk[STDIO_UART_TX_CHUNK];
+static char _tx_stack[STDIO_UART_TX_STACKSIZE];
+static kernel_pid_t _tx_pid = KERNEL_PID_UNDEF;
+/* unlocked by the TX thread whenever space became available */
+static mutex_t _tx_space = MUTEX_INIT_LOCKED;
+
+static void _uart_write(const void *buffer, size_t len)
+{
+#ifndef USE_ETHOS_FOR_STDIO
+    uart_write(STDIO_UART_DEV, (const uint8_t *)buffer, len);
+#else
+    ethos_send_frame(&ethos, (const uint8_t *)buffer, len, ETHOS_FRAME_TYPE_TEXT);
+#endif
+}
+
+#if defined(MODULE_PERIPH_UART_DMA) && !defined(USE_ETHOS_FOR_STDIO)
+static void _tx_done(void *arg)
+{
+    thread_flags_set(arg, FLAG_DONE);
+}
+#endif
+
+static void *_tx_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        unsigned state = irq_disable();
+        int len = tsrb_get(&_tx_rb, _tx_chunk, sizeof(_tx_chunk));
+        irq_restore(state);
+
+        if (len <= 0) {
+            thread_flags_wait_any(FLAG_DATA);
+            continue;
+        }
+        mutex_unlock(&_tx_space);
+#if defined(MODULE_PERIPH_UART_DMA) && !defined(USE_ETHOS_FOR_STDIO)
+        if (uart_write_async(STDIO_UART_DEV, (uint8_t *)_tx_chunk, len,
+                             _tx_done, (void *)sched_active_thread) == UART_OK) {
+            thread_flags_wait_any(FLAG_DONE);
+            continue;
+        }
+#endif
+        _uart_write(_tx_chunk, len);
+    }
+
+    return NULL;
+}
+
+/* buffers as much of buffer as policy allows, returns the bytes not taken */
+static size_t _tx_add(const char *buffer, size_t len)
+{
+    unsigned state = irq_disable();
+
+#if STDIO_UART_TX_OVERFLOW == STDIO_UART_TX_OVERWRITE
+    if (len > STDIO_UART_TX_BUFSIZE) {
+        /* only the newest bytes fit at all */
+        buffer += len - STDIO_UART_TX_BUFSIZE;
+        len = STDIO_UART_TX_BUFSIZE;
+    }
+    if (tsrb_free(&_tx_rb) < len) {
+        tsrb_drop(&_tx_rb, len - tsrb_free(&_tx_rb));
+    }
+#endif
+    len -= tsrb_add(&_tx_rb, buffer, len);
+    irq_restore(state);
+
+    return len;
+}
+
+static void _tx_write(const char *buffer, size_t len)
+{
+    if (_tx_pid == KERNEL_PID_UNDEF) {
+        static mutex_t init_lock = MUTEX_INIT;
+
+        if (irq_is_in() || (sched_active_thread == NULL)) {
+            /* too early to start the TX thread */
+            _uart_write(buffer, len);
+            return;
+        }
+        mutex_lock(&init_lock);
+        if (_tx_pid == KERNEL_PID_UNDEF) {
+            kernel_pid_t pid = thread_create(_tx_stack, sizeof(_tx_stack),
+                                             STDIO_UART_TX_PRIO,
+                                             THREAD_CREATE_STACKTEST,
+                                             _tx_thread, NULL, "stdio_tx");
+            _tx_pid = (pid < 0) ? KERNEL_PID_UNDEF : pid;
+        }
+        mutex_unlock(&init_lock);
+        if (_tx_pid == KERNEL_PID_UNDEF) {
+            _uart_write(buffer, len);
+            return;
+        }
+    }
+
+    thread_t *tx_thread = (thread_t *)thread_get(_tx_pid);
+    size_t left;
+
+    while ((left = _tx_add(buffer, len)) > 0) {
+        thread_flags_set(tx_thread, FLAG_DATA);
+#if STDIO_UART_TX_OVERFLOW == STDIO_UART_TX_BLOCK
+        buffer += len - left;
+        len = left;
+        if (irq_is_in() || (sched_active_pid == _tx_pid)) {
+            /* can not wait for the TX thread */
+            _uart_write(buffer, len);
+            return;
+        }
+        mutex_lock(&_tx_space);
+#else
+        return;
+#endif
+    }
+    thread_flags_set(tx_thread, FLAG_DATA);
+}
+#endif /* MODULE_STDIO_UART_ASYNC */
+
 void stdio_init(void)
 {
 #ifndef USE_ETHOS_FOR_STDIO
-    uart_init(STDIO_UART_DEV, STDIO_UART_BAUDRATE, (uart_rx_cb_t) isrpipe_write_one, &stdio_uart_isrpipe);
+    _init_uart();
 #else
     uart_init(ETHOS_UART, ETHOS_BAUDRATE, (uart_rx_cb_t) isrpipe_write_one, &stdio_uart_isrpipe);
 #endif
@@ -68,7 +223,9 @@ ssize_t stdio_read(void* buffer, size_t count)
 
 ssize_t stdio_write(const void* buffer, size_t len)
 {
-#ifndef USE_ETHOS_FOR_STDIO
+#ifdef MODULE_STDIO_UART_ASYNC
+    _tx_write(buffer, len);
+#elif !defined(USE_ETHOS_FOR_STDIO)
     uart_write(STDIO_UART_DEV, (const uint8_t *)buffer, len);
 #else
     ethos_send_frame(&ethos, (const uint8_t *)buffer, len, ETHOS_FRAME_TYPE_TEXT);
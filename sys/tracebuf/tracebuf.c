@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_tracebuf
+ * @{
+ *
+ * @file
+ * @brief       Event trace buffer implementation
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "irq.h"
+#include "xtimer.h"
+#include "tracebuf.h"
+
+#if (TRACEBUF_SIZE & (TRACEBUF_SIZE - 1)) != 0
+#error "TRACEBUF_SIZE must be a power of two"
+#endif
+
+static tracebuf_entry_t _buf[TRACEBUF_SIZE];
+static unsigned _next;
+static unsigned _count;
+static bool _enabled = true;
+
+void tracebuf_add(uint32_t id, uint32_t arg)
+{
+    uint32_t now = xtimer_now().ticks32;
+    unsigned state = irq_disable();
+
+    if (_enabled) {
+        tracebuf_entry_t *entry = &_buf[_next];
+
+        entry->time = now;
+        entry->id = id;
+        entry->arg = arg;
+        _next = (_next + 1) & (TRACEBUF_SIZE - 1);
+        if (_count < TRACEBUF_SIZE) {
+            _count++;
+        }
+    }
+    irq_restore(state);
+}
+
+unsigned tracebuf_count(void)
+{
+    return _count;
+}
+
+int tracebuf_get(unsigned n, tracebuf_entry_t *entry)
+{
+    unsigned state = irq_disable();
+
+    if (n >= _count) {
+        irq_restore(state);
+        return -1;
+    }
+    *entry = _buf[(_next - _count + n) & (TRACEBUF_SIZE - 1)];
+    irq_restore(state);
+    return 0;
+}
+
+void tracebuf_clear(void)
+{
+    unsigned state = irq_disable();
+
+    _next = 0;
+    _count = 0;
+    irq_restore(state);
+}
+
+void tracebuf_enable(bool enable)
+{
+    _enabled = enable;
+}
+
+void tracebuf_dump(void)
+{
+    bool enabled = _enabled;
+    tracebuf_entry_t entry;
+
+    _enabled = false;
+    for (unsigned i = 0; tracebuf_get(i, &entry) == 0; i++) {
+        printf("tracebuf: %08lx %08lx %08lx\n", (unsigned long)entry.time,
+               (unsigned long)entry.id, (unsigned long)entry.arg);
+    }
+    _enabled = enabled;
+}
@@ -17,22 +17,40 @@
  * @}
  */
 
+#include <string.h>
+
 #include "tsrb.h"
 
+/* Keeps the compiler from moving buffer accesses across index updates.
+ * Producer and consumer run on the same core (thread and ISR), which is why no
+ * hardware memory barrier is needed. */
+static inline void _barrier(void)
+{
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
 static void _push(tsrb_t *rb, char c)
 {
-    rb->buf[rb->writes++ & (rb->size - 1)] = c;
+    unsigned writes = rb->writes;
+    rb->buf[writes & (rb->size - 1)] = c;
+    _barrier();
+    rb->writes = writes + 1;
 }
 
 static char _pop(tsrb_t *rb)
 {
-    return rb->buf[rb->reads++ & (rb->size - 1)];
+    unsigned reads = rb->reads;
+    char c = rb->buf[reads & (rb->size - 1)];
+    _barrier();
+    rb->reads = reads + 1;
+    return c;
 }
 
 int tsrb_get_one(tsrb_t *rb)
 {
     if (!tsrb_empty(rb)) {
-        return _pop(rb);
+        _barrier();
+        return (unsigned char)_pop(rb);
     }
     else {
         return -1;
@@ -41,27 +59,43 @@ int tsrb_get_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, char *dst, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    unsigned reads = rb->reads;
+    unsigned avail = rb->writes - reads;
+    _barrier();
+
+    if (n > avail) {
+        n = avail;
+    }
+    unsigned pos = reads & (rb->size - 1);
+    size_t first = rb->size - pos;
+    if (first > n) {
+        first = n;
     }
-    return (n - tmp);
+    memcpy(dst, &rb->buf[pos], first);
+    memcpy(dst + first, rb->buf, n - first);
+
+    _barrier();
+    rb->reads = reads + n;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    unsigned reads = rb->reads;
+    unsigned avail = rb->writes - reads;
+
+    if (n > avail) {
+        n = avail;
     }
-    return (n - tmp);
+    _barrier();
+    rb->reads = reads + n;
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, char c)
 {
     if (!tsrb_full(rb)) {
+        _barrier();
         _push(rb, c);
         return 0;
     }
@@ -72,10 +106,53 @@ int tsrb_add_one(tsrb_t *rb, char c)
 
 int tsrb_add(tsrb_t *rb, const char *src, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned writes = rb->writes;
+    unsigned space = rb->size - (writes - rb->reads);
+    _barrier();
+
+    if (n > space) {
+        n = space;
     }
-    return (n - tmp);
+    unsigned pos = writes & (rb->size - 1);
+    size_t first = rb->size - pos;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(&rb->buf[pos], src, first);
+    memcpy(rb->buf, src + first, n - first);
+
+    _barrier();
+    rb->writes = writes + n;
+    return n;
+}
+
+size_t tsrb_peek_region(tsrb_t *rb, char **data)
+{
+    unsigned reads = rb->reads;
+    unsigned avail = rb->writes - reads;
+    _barrier();
+
+    unsigned pos = reads & (rb->size - 1);
+    size_t len = rb->size - pos;
+    *data = &rb->buf[pos];
+    return (len < avail) ? len : avail;
+}
+
+size_t tsrb_space_region(tsrb_t *rb, char **space)
+{
+    unsigned writes = rb->writes;
+    unsigned space_len = rb->size - (writes - rb->reads);
+    _barrier();
+
+    unsigned pos = writes & (rb->size - 1);
+    size_t len = rb->size - pos;
+    *space = &rb->buf[pos];
+    return (len < space_len) ? len : space_len;
+}
+
+void tsrb_commit(tsrb_t *rb, size_t n)
+{
+    assert(n <= tsrb_free(rb));
+    _barrier();
+    rb->writes += n;
 }
@@ -258,8 +258,8 @@ typedef bool (*_ubjson_read_struct_continue)(ubjson_cookie_t *restrict cookie, c
                                              ssize_t count, ssize_t index,
                                              ubjson_type_t *type1, ssize_t *content1);
 
-static ubjson_read_callback_result_t _ubjson_read_struct(ubjson_cookie_t *restrict cookie,
-                                                         _ubjson_read_struct_continue get_continue)
+static ubjson_read_callback_result_t _ubjson_read_header(ubjson_cookie_t *restrict cookie,
+                                                         ssize_t *count_, char *type_marker_)
 {
     ubjson_read_callback_result_t result;
     ssize_t count = -1;
@@ -294,6 +294,23 @@ static ubjson_read_callback_result_t _ubjson_read_struct(ubjson_cookie_t *restri
         return UBJSON_INVALID_DATA;
     }
 
+    *count_ = count;
+    *type_marker_ = type_marker;
+    return UBJSON_OKAY;
+}
+
+static ubjson_read_callback_result_t _ubjson_read_struct(ubjson_cookie_t *restrict cookie,
+                                                         _ubjson_read_struct_continue get_continue)
+{
+    ubjson_read_callback_result_t result;
+    ssize_t count;
+    char marker, type_marker;
+
+    result = _ubjson_read_header(cookie, &count, &type_marker);
+    if (result != UBJSON_OKAY) {
+        return result;
+    }
+
     for (ssize_t index = 0; (count < 0) || (index < count); ++index) {
         ubjson_type_t type1;
         ssize_t content1;
@@ -380,6 +397,101 @@ ubjson_read_callback_result_t ubjson_read_next(ubjson_cookie_t *restrict cookie)
     return cookie->callback.read(cookie, type, content, UBJSON_ABSENT, 0);
 }
 
+ubjson_read_callback_result_t ubjson_read_iterative(ubjson_cookie_t *restrict cookie,
+                                                    ubjson_read_t read,
+                                                    ubjson_read_callback_t callback,
+                                                    ubjson_read_level_t *stack,
+                                                    size_t depth)
+{
+    ubjson_read_callback_result_t result;
+    size_t level = 0;
+    char marker;
+
+    cookie->rw.read = read;
+    cookie->callback.read = callback;
+    cookie->marker = 0;
+
+    while (1) {
+        /* read a value, typed containers omit the marker */
+        if ((level > 0) && stack[level - 1].type_marker) {
+            marker = stack[level - 1].type_marker;
+        }
+        else {
+            READ_MARKER();
+        }
+
+        ubjson_type_t type;
+        ssize_t content;
+        result = _ubjson_get_call(cookie, marker, &type, &content);
+        if (result != UBJSON_OKAY) {
+            return result;
+        }
+        result = callback(cookie, type, content, UBJSON_ABSENT, 0);
+        if (result != UBJSON_OKAY) {
+            return result;
+        }
+
+        if ((type == UBJSON_ENTER_ARRAY) || (type == UBJSON_ENTER_OBJECT)) {
+            if (level == depth) {
+                return UBJSON_SIZE_ERROR;
+            }
+            ubjson_read_level_t *cur = &stack[level++];
+            result = _ubjson_read_header(cookie, &cur->count, &cur->type_marker);
+            if (result != UBJSON_OKAY) {
+                return result;
+            }
+            cur->index = 0;
+            cur->object = (type == UBJSON_ENTER_OBJECT);
+        }
+
+        /* find the next key or index, closing all finished containers */
+        while (level > 0) {
+            ubjson_read_level_t *cur = &stack[level - 1];
+            bool done = (cur->count >= 0) && (cur->index >= cur->count);
+            if (!done) {
+                READ_MARKER();
+                if (marker == (cur->object ? UBJSON_MARKER_OBJECT_END
+                                           : UBJSON_MARKER_ARRAY_END)) {
+                    if (cur->count >= 0) {
+                        return UBJSON_INVALID_DATA;
+                    }
+                    done = true;
+                }
+                else {
+                    cookie->marker = marker;
+                }
+            }
+            if (!done) {
+                ssize_t content1 = cur->index;
+                if (cur->object) {
+                    result = _ubjson_read_length(cookie, &content1);
+                    if (result != UBJSON_OKAY) {
+                        return result;
+                    }
+                }
+                ++cur->index;
+                result = callback(cookie, cur->object ? UBJSON_KEY : UBJSON_INDEX, content1,
+                                  UBJSON_ABSENT, (unsigned char) cur->type_marker);
+                if (result != UBJSON_OKAY) {
+                    return result;
+                }
+                break;
+            }
+
+            --level;
+            result = callback(cookie, cur->object ? UBJSON_LEAVE_OBJECT : UBJSON_LEAVE_ARRAY,
+                              cur->index, UBJSON_ABSENT, 0);
+            if (result != UBJSON_OKAY) {
+                return result;
+            }
+        }
+
+        if (level == 0) {
+            return UBJSON_OKAY;
+        }
+    }
+}
+
 ubjson_read_callback_result_t ubjson_peek_value(ubjson_cookie_t *restrict cookie,
                                                 ubjson_type_t *type, ssize_t *content)
 {
@@ -30,6 +30,7 @@
 #include "byteorder.h"
 
 #include <limits.h>
+#include <string.h>
 
 #define WRITE_CALL(FUN, ...)                                                  \
     do {                                                                      \
@@ -57,6 +58,63 @@
         return result;                                                        \
     }
 
+static ssize_t _ubjson_write_buffered(ubjson_cookie_t *restrict cookie,
+                                      const void *buf, size_t len)
+{
+    const char *src = buf;
+    size_t total = len;
+
+    while (len > 0) {
+        if ((cookie->wbuf.pos == 0) && (len >= cookie->wbuf.size)) {
+            /* no point in copying large strings */
+            ssize_t wrote = cookie->wbuf.write(cookie, src, len);
+            if (wrote < 0) {
+                return wrote;
+            }
+            break;
+        }
+
+        size_t chunk = cookie->wbuf.size - cookie->wbuf.pos;
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(&cookie->wbuf.buf[cookie->wbuf.pos], src, chunk);
+        cookie->wbuf.pos += chunk;
+        src += chunk;
+        len -= chunk;
+
+        if (cookie->wbuf.pos == cookie->wbuf.size) {
+            ssize_t wrote = ubjson_write_flush(cookie);
+            if (wrote < 0) {
+                return wrote;
+            }
+        }
+    }
+    return total;
+}
+
+void ubjson_write_init_buffered(ubjson_cookie_t *restrict cookie, ubjson_write_t write_fun,
+                                void *buf, size_t size)
+{
+    cookie->rw.write = _ubjson_write_buffered;
+    cookie->wbuf.write = write_fun;
+    cookie->wbuf.buf = buf;
+    cookie->wbuf.size = size;
+    cookie->wbuf.pos = 0;
+}
+
+ssize_t ubjson_write_flush(ubjson_cookie_t *restrict cookie)
+{
+    if (cookie->wbuf.pos == 0) {
+        return 0;
+    }
+    ssize_t result = cookie->wbuf.write(cookie, cookie->wbuf.buf, cookie->wbuf.pos);
+    if (result >= 0) {
+        cookie->wbuf.pos = 0;
+    }
+    return result;
+}
+
 MARKER_FUN(ubjson_write_null, UBJSON_MARKER_NULL)
 MARKER_FUN(ubjson_write_noop, UBJSON_MARKER_NOOP)
 
@@ -28,6 +28,8 @@
 #include "thread.h"
 #include "kernel_types.h"
 #include "clist.h"
+#include "bitarithm.h"
+#include "kernel_defines.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -50,12 +52,27 @@
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+/**
+ * @internal
+ * @brief Number of bits in a word of _vfs_fd_used
+ */
+#define FD_WORD_BITS    (sizeof(unsigned) * 8)
+
+/**
+ * @internal
+ * @brief Bitmap of the entries of _vfs_open_files that are in use
+ *
+ * Lets _allocate_fd find a free entry without scanning the table.
+ */
+static unsigned _vfs_fd_used[(VFS_MAX_OPEN_FILES + FD_WORD_BITS - 1) / FD_WORD_BITS];
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
  *
  * This singly linked list is used to dispatch vfs calls to the appropriate file
- * system driver.
+ * system driver. It is sorted by descending mount point length, so the first
+ * mount point matching a path is the longest match.
  */
 static clist_node_t _vfs_mounts_list;
 
@@ -101,6 +118,17 @@ static inline void _free_fd(int fd);
  */
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data);
 
+/**
+ * @internal
+ * @brief Order mount points by descending mount point length
+ *
+ * @param[in]  a    list node of the first mount point
+ * @param[in]  b    list node of the second mount point
+ *
+ * @return >0 if @p a needs to go after @p b
+ */
+static int _mount_cmp(clist_node_t *a, clist_node_t *b);
+
 /**
  * @internal
  * @brief Find the file system associated with the file name @p name, and
@@ -333,6 +361,118 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
     return filp->f_op->write(filp, src, count);
 }
 
+ssize_t vfs_readv(int fd, const iolist_t *iolist)
+{
+    DEBUG("vfs_readv: %d, %p\n", fd, (void *)iolist);
+    ssize_t total = 0;
+    for (; iolist; iolist = iolist->iol_next) {
+        if (iolist->iol_len == 0) {
+            continue;
+        }
+        ssize_t res = vfs_read(fd, iolist->iol_base, iolist->iol_len);
+        if (res < 0) {
+            return (total > 0) ? total : res;
+        }
+        total += res;
+        if ((size_t)res < iolist->iol_len) {
+            /* end of file */
+            break;
+        }
+    }
+    return total;
+}
+
+ssize_t vfs_writev(int fd, const iolist_t *iolist)
+{
+    DEBUG_NOT_STDOUT(fd, "vfs_writev: %d, %p\n", fd, (void *)iolist);
+    ssize_t total = 0;
+    for (; iolist; iolist = iolist->iol_next) {
+        if (iolist->iol_len == 0) {
+            continue;
+        }
+        ssize_t res = vfs_write(fd, iolist->iol_base, iolist->iol_len);
+        if (res < 0) {
+            return (total > 0) ? total : res;
+        }
+        total += res;
+        if ((size_t)res < iolist->iol_len) {
+            /* file system full */
+            break;
+        }
+    }
+    return total;
+}
+
+ssize_t vfs_sendfile(int fd, vfs_sendfile_cb_t cb, void *arg,
+                     void *buf, size_t buf_len, size_t count)
+{
+    DEBUG("vfs_sendfile: %d, %p, %lu\n", fd, buf, (unsigned long)count);
+    if (cb == NULL) {
+        return -EINVAL;
+    }
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (((filp->flags & O_ACCMODE) != O_RDONLY) & ((filp->flags & O_ACCMODE) != O_RDWR)) {
+        /* File not open for reading */
+        return -EBADF;
+    }
+    if (filp->f_op->sendfile != NULL) {
+        return filp->f_op->sendfile(filp, cb, arg, count);
+    }
+    if ((buf == NULL) || (buf_len == 0)) {
+        return -EFAULT;
+    }
+    ssize_t total = 0;
+    while ((size_t)total < count) {
+        size_t chunk = count - total;
+        if (chunk > buf_len) {
+            chunk = buf_len;
+        }
+        ssize_t len = vfs_read(fd, buf, chunk);
+        if (len <= 0) {
+            return ((total > 0) || (len == 0)) ? total : len;
+        }
+        for (ssize_t done = 0; done < len;) {
+            ssize_t sent = cb(arg, (uint8_t *)buf + done, len - done);
+            if (sent <= 0) {
+                /* a consumer that makes no progress is treated as an error */
+                return (total > 0) ? total : ((sent < 0) ? sent : -EIO);
+            }
+            done += sent;
+            total += sent;
+        }
+    }
+    return total;
+}
+
+int vfs_mmap(int fd, off_t off, size_t len, const void **addr)
+{
+    DEBUG("vfs_mmap: %d, %ld, %lu\n", fd, (long)off, (unsigned long)len);
+    if (addr == NULL) {
+        return -EFAULT;
+    }
+    if (off < 0) {
+        return -EINVAL;
+    }
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (((filp->flags & O_ACCMODE) != O_RDONLY) & ((filp->flags & O_ACCMODE) != O_RDWR)) {
+        /* File not open for reading */
+        return -EBADF;
+    }
+    if (filp->f_op->mmap == NULL) {
+        /* driver can not map files to memory */
+        return -ENOTSUP;
+    }
+    return filp->f_op->mmap(filp, off, len, addr);
+}
+
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("vfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
@@ -356,11 +496,13 @@ int vfs_opendir(vfs_DIR *dirp, const char *dirname)
     }
     if (mountp->fs->d_op == NULL) {
         /* file system driver does not support directories */
+        atomic_fetch_sub(&mountp->open_files, 1);
         return -EINVAL;
     }
     /* initialize dirp */
     memset(dirp, 0, sizeof(*dirp));
     dirp->mp = mountp;
+    dirp->path = dirname;
     dirp->d_op = mountp->fs->d_op;
     if (dirp->d_op->opendir != NULL) {
         int res = dirp->d_op->opendir(dirp, rel_path, dirname);
@@ -373,6 +515,54 @@ int vfs_opendir(vfs_DIR *dirp, const char *dirname)
     return 0;
 }
 
+int vfs_openat(const vfs_DIR *dirp, const char *name, int flags, mode_t mode)
+{
+    DEBUG("vfs_openat: %p, \"%s\", 0x%x, 0%03lo\n", (void *)dirp, name, flags,
+          (long unsigned int)mode);
+    if ((dirp == NULL) || (dirp->mp == NULL) || (name == NULL)) {
+        return -EINVAL;
+    }
+    size_t dir_len = strlen(dirp->path);
+    size_t name_len = strlen(name);
+    while ((dir_len > 0) && (dirp->path[dir_len - 1] == '/')) {
+        --dir_len;
+    }
+    if (dir_len + 1 + name_len > VFS_PATH_MAX) {
+        return -ENAMETOOLONG;
+    }
+    char path[VFS_PATH_MAX + 1];
+    memcpy(path, dirp->path, dir_len);
+    path[dir_len] = '/';
+    memcpy(&path[dir_len + 1], name, name_len + 1);
+
+    vfs_mount_t *mountp = dirp->mp;
+    /* the open directory keeps the mount alive, no need for _find_mount */
+    atomic_fetch_add(&mountp->open_files, 1);
+    mutex_lock(&_open_mutex);
+    int fd = _init_fd(VFS_ANY_FD, mountp->fs->f_op, mountp, flags, NULL);
+    mutex_unlock(&_open_mutex);
+    if (fd < 0) {
+        DEBUG("vfs_openat: _init_fd: ERR %d!\n", fd);
+        atomic_fetch_sub(&mountp->open_files, 1);
+        return fd;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->open != NULL) {
+        const char *rel_path = path;
+        if (mountp->mount_point_len > 1) {
+            rel_path += mountp->mount_point_len;
+        }
+        int res = filp->f_op->open(filp, rel_path, flags, mode, path);
+        if (res < 0) {
+            DEBUG("vfs_openat: open: ERR %d!\n", res);
+            _free_fd(fd);
+            return res;
+        }
+    }
+    DEBUG("vfs_openat: opened %d\n", fd);
+    return fd;
+}
+
 int vfs_readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
 {
     DEBUG("vfs_readdir: %p, %p\n", (void *)dirp, (void *)entry);
@@ -481,8 +671,9 @@ int vfs_mount(vfs_mount_t *mountp)
             }
         }
     }
-    /* insert last in list */
+    /* keep the list sorted by mount point length */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    clist_sort(&_vfs_mounts_list, _mount_cmp);
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -867,15 +1058,19 @@ const vfs_mount_t *vfs_iterate_mounts(const vfs_mount_t *cur)
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
+        fd = VFS_MAX_OPEN_FILES;
+        for (unsigned i = 0; i < sizeof(_vfs_fd_used) / sizeof(_vfs_fd_used[0]); ++i) {
+            unsigned avail = ~_vfs_fd_used[i];
+            if (i == 0) {
                 /* Do not auto-allocate the stdio file descriptor numbers to
                  * avoid conflicts between normal file system users and stdio
                  * drivers such as stdio_uart, stdio_rtt which need to be able
                  * to bind to these specific file descriptor numbers. */
-                continue;
+                avail &= ~((1u << STDIN_FILENO) | (1u << STDOUT_FILENO) |
+                           (1u << STDERR_FILENO));
             }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
+            if (avail) {
+                fd = i * FD_WORD_BITS + bitarithm_lsb(avail);
                 break;
             }
         }
@@ -895,6 +1090,7 @@ static inline int _allocate_fd(int fd)
         pid = -1;
     }
     _vfs_open_files[fd].pid = pid;
+    _vfs_fd_used[fd / FD_WORD_BITS] |= (1u << (fd % FD_WORD_BITS));
     return fd;
 }
 
@@ -905,6 +1101,7 @@ static inline void _free_fd(int fd)
         atomic_fetch_sub(&_vfs_open_files[fd].mp->open_files, 1);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    _vfs_fd_used[fd / FD_WORD_BITS] &= ~(1u << (fd % FD_WORD_BITS));
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -922,6 +1119,12 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
+static int _mount_cmp(clist_node_t *a, clist_node_t *b)
+{
+    return (int)container_of(b, vfs_mount_t, list_entry)->mount_point_len -
+           (int)container_of(a, vfs_mount_t, list_entry)->mount_point_len;
+}
+
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
 {
     size_t longest_match = 0;
@@ -939,10 +1142,6 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
         node = node->next;
         vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
         size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
         if (len > name_len) {
             /* path name is shorter than the mount point name */
             continue;
@@ -958,6 +1157,8 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
                 longest_match = len;
             }
             mountp = it;
+            /* the list is sorted, nothing longer can follow */
+            break;
         }
     } while (node != _vfs_mounts_list.next);
     if (mountp == NULL) {
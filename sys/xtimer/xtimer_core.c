@@ -48,6 +48,7 @@ static xtimer_t *long_list_head = NULL;
 
 static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer);
 static void _add_timer_to_long_list(xtimer_t **list_head, xtimer_t *timer);
+static xtimer_t *_pop_first(xtimer_t **list_head);
 static void _shoot(xtimer_t *timer);
 static void _remove(xtimer_t *timer);
 static inline void _lltimer_set(uint32_t target);
@@ -154,6 +155,49 @@ void _xtimer_set(xtimer_t *timer, uint32_t offset)
     }
 }
 
+void _xtimer_set_slack(xtimer_t *timer, uint32_t offset, uint32_t slack)
+{
+    uint32_t now, target, latest, diff;
+
+    if (!timer->callback) {
+        DEBUG("timer_set_slack(): timer has no callback.\n");
+        return;
+    }
+
+    now = _xtimer_now();
+    target = now + offset;
+    latest = target + slack;
+    /* clear all bits below the highest one that differs between earliest
+     * and latest target: the result is still within the window, and timers
+     * with overlapping windows are likely to get the same one */
+    diff = target ^ latest;
+    diff |= diff >> 1;
+    diff |= diff >> 2;
+    diff |= diff >> 4;
+    diff |= diff >> 8;
+    diff |= diff >> 16;
+    target = latest & ~(diff >> 1);
+    if ((target - now) < XTIMER_BACKOFF) {
+        _xtimer_set(timer, offset);
+    }
+    else {
+        xtimer_remove(timer);
+        _xtimer_set_absolute(timer, target);
+    }
+}
+
+xtimer_ticks32_t xtimer_until_next(void)
+{
+    unsigned state = irq_disable();
+    uint32_t next = (timer_list_head) ?
+                    _xtimer_lltimer_mask(timer_list_head->target) :
+                    _xtimer_lltimer_mask(0xFFFFFFFF);
+    uint32_t res = _time_left(next, 0);
+
+    irq_restore(state);
+    return xtimer_ticks(res);
+}
+
 static void _periph_timer_callback(void *arg, int chan)
 {
     (void)arg;
@@ -252,6 +296,170 @@ int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
     return res;
 }
 
+#ifdef MODULE_XTIMER_HEAP
+/*
+ * The timer "lists" are pairing heaps: *list_head points to the timer that
+ * expires first, xtimer_t::child to the first of its children and
+ * xtimer_t::next to the next sibling.  xtimer_t::prev points to the previous
+ * sibling or, for the first child, to the parent.
+ *
+ * All heaps are ordered by (long_target, target).  Within timer_list_head
+ * and overflow_list_head all timers share the same long_target, so this is
+ * the same order the sorted lists use.
+ */
+static inline int _before(const xtimer_t *a, const xtimer_t *b)
+{
+    if (a->long_target != b->long_target) {
+        return a->long_target < b->long_target;
+    }
+    return a->target <= b->target;
+}
+
+/**
+ * @brief link two heap roots, return the root of the resulting heap
+ */
+static xtimer_t *_heap_meld(xtimer_t *a, xtimer_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (!_before(a, b)) {
+        xtimer_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    /* b becomes first child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+/**
+ * @brief two-pass pairing of a list of siblings into a single heap
+ */
+static xtimer_t *_heap_merge_pairs(xtimer_t *first)
+{
+    xtimer_t *pairs = NULL;
+    xtimer_t *root = NULL;
+
+    /* first pass: meld siblings pairwise from left to right, keep the
+     * results in reverse order */
+    while (first) {
+        xtimer_t *a = first;
+        xtimer_t *b = first->next;
+
+        first = (b) ? b->next : NULL;
+        a->next = a->prev = NULL;
+        if (b) {
+            b->next = b->prev = NULL;
+        }
+        a = _heap_meld(a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+    /* second pass: meld the pairs from right to left */
+    while (pairs) {
+        xtimer_t *next = pairs->next;
+
+        pairs->next = NULL;
+        root = _heap_meld(root, pairs);
+        pairs = next;
+    }
+
+    return root;
+}
+
+static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer)
+{
+    timer->next = timer->prev = timer->child = NULL;
+    *list_head = _heap_meld(*list_head, timer);
+}
+
+static void _add_timer_to_long_list(xtimer_t **list_head, xtimer_t *timer)
+{
+    _add_timer_to_list(list_head, timer);
+}
+
+static xtimer_t *_pop_first(xtimer_t **list_head)
+{
+    xtimer_t *timer = *list_head;
+
+    *list_head = _heap_merge_pairs(timer->child);
+    timer->child = NULL;
+
+    return timer;
+}
+
+/**
+ * @brief remove a timer that is not the root of its heap
+ */
+static void _heap_cut(xtimer_t *timer)
+{
+    xtimer_t *prev = timer->prev;
+    xtimer_t *next = timer->next;
+    xtimer_t *repl;
+
+    if (!prev) {
+        /* not in any heap */
+        return;
+    }
+    /* replace timer by the heap of its children, its root is still later
+     * than the parent of timer */
+    repl = _heap_merge_pairs(timer->child);
+    if (repl) {
+        repl->next = next;
+    }
+    else {
+        repl = next;
+    }
+    if (repl) {
+        repl->prev = prev;
+    }
+    if (next && (next != repl)) {
+        next->prev = repl;
+    }
+    if (prev->child == timer) {
+        prev->child = repl;
+    }
+    else {
+        prev->next = repl;
+    }
+    timer->next = timer->prev = timer->child = NULL;
+}
+
+static void _remove(xtimer_t *timer)
+{
+    if (timer_list_head == timer) {
+        uint32_t next;
+        _pop_first(&timer_list_head);
+        if (timer_list_head) {
+            /* schedule callback on next timer target time */
+            next = timer_list_head->target - XTIMER_OVERHEAD;
+        }
+        else {
+            next = _xtimer_lltimer_mask(0xFFFFFFFF);
+        }
+        _lltimer_set(next);
+    }
+    else if (overflow_list_head == timer) {
+        _pop_first(&overflow_list_head);
+    }
+    else if (long_list_head == timer) {
+        _pop_first(&long_list_head);
+    }
+    else {
+        _heap_cut(timer);
+    }
+}
+#else
 static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer)
 {
     while (*list_head && (*list_head)->target <= timer->target) {
@@ -287,6 +495,15 @@ static int _remove_timer_from_list(xtimer_t **list_head, xtimer_t *timer)
     return 0;
 }
 
+static xtimer_t *_pop_first(xtimer_t **list_head)
+{
+    xtimer_t *timer = *list_head;
+
+    *list_head = timer->next;
+
+    return timer;
+}
+
 static void _remove(xtimer_t *timer)
 {
     if (timer_list_head == timer) {
@@ -309,6 +526,7 @@ static void _remove(xtimer_t *timer)
         }
     }
 }
+#endif /* MODULE_XTIMER_HEAP */
 
 void xtimer_remove(xtimer_t *timer)
 {
@@ -346,6 +564,19 @@ static inline int _this_high_period(uint32_t target)
 #endif
 }
 
+#ifdef MODULE_XTIMER_HEAP
+/**
+ * @brief move long timers that will expire in the current short timer period
+ *        to the current timer heap
+ */
+static void _select_long_timers(void)
+{
+    while (long_list_head && (long_list_head->long_target <= _long_cnt) &&
+           _this_high_period(long_list_head->target)) {
+        _add_timer_to_list(&timer_list_head, _pop_first(&long_list_head));
+    }
+}
+#else
 /**
  * @brief compare two timers' target values, return the one with lower value.
  *
@@ -435,6 +666,7 @@ static void _select_long_timers(void)
         }
     }
 }
+#endif /* MODULE_XTIMER_HEAP */
 
 /**
  * @brief handle low-level timer overflow, advance to next short timer period
@@ -503,11 +735,8 @@ overflow:
         /* make sure we don't fire too early */
         while (_time_left(_xtimer_lltimer_mask(timer_list_head->target), reference)) {}
 
-        /* pick first timer in list */
-        xtimer_t *timer = timer_list_head;
-
-        /* advance list */
-        timer_list_head = timer->next;
+        /* pick first timer in list and advance list */
+        xtimer_t *timer = _pop_first(&timer_list_head);
 
         /* make sure timer is recognized as being already fired */
         timer->target = 0;
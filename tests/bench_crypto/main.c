@@ -0,0 +1,387 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare the crypto implementations available in RIOT
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "thread.h"
+#include "random.h"
+
+#include "crypto/ciphers.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/chacha20poly1305.h"
+#include "hashes/sha256.h"
+
+#ifdef MODULE_LIBB2
+#include "blake2.h"
+#endif
+#ifdef MODULE_MONOCYPHER
+#include "monocypher.h"
+#endif
+#ifdef MODULE_TWEETNACL
+#include "tweetnacl.h"
+#endif
+#ifdef MODULE_HACL
+#include "haclnacl.h"
+#endif
+#ifdef MODULE_TINYCRYPT
+#include "tinycrypt/sha256.h"
+#include "tinycrypt/aes.h"
+#include "tinycrypt/ccm_mode.h"
+#endif
+#ifdef MODULE_MICRO_ECC
+#include "uECC.h"
+#endif
+
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP        (1U)
+#endif
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES       (10U)
+#endif
+
+/**
+ * @brief   Length of the messages to hash, encrypt and sign
+ */
+#ifndef BENCH_MSG_LEN
+#define BENCH_MSG_LEN       (64U)
+#endif
+
+/**
+ * @brief   Size of the stack every operation is run on once to measure its
+ *          stack usage
+ */
+#ifndef BENCH_STACKSIZE
+#define BENCH_STACKSIZE     (4 * THREAD_STACKSIZE_DEFAULT)
+#endif
+
+#define NONCE_LEN           (13U)
+#define TAG_LEN             (16U)
+
+static uint8_t _msg[BENCH_MSG_LEN];
+static uint8_t _out[BENCH_MSG_LEN + 64];
+static uint8_t _digest[64];
+static uint8_t _tag[TAG_LEN];
+static const uint8_t _key[32] = { 0x42 };
+static const uint8_t _nonce[24] = { 0x23 };
+
+#ifdef DEVELHELP
+static char _stack[BENCH_STACKSIZE];
+
+static void *_stack_thread(void *arg)
+{
+    void (*func)(void) = *(void (**)(void))arg;
+
+    func();
+    return NULL;
+}
+
+/* runs func once on a painted stack, the thread has a higher priority than
+ * main, so it has terminated when thread_create() returns */
+static void _print_stack(const char *name, void (*func)(void))
+{
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _stack_thread, &func, "bench");
+    printf("{\"name\": \"%s\", \"stack\": %u}\n", name,
+           (unsigned)(sizeof(_stack) - thread_measure_stack_free(_stack)));
+}
+#else
+static void _print_stack(const char *name, void (*func)(void))
+{
+    (void)name;
+    (void)func;
+}
+#endif
+
+#define BENCH(name, func)                                               \
+    do {                                                                \
+        BENCHMARK_SAMPLE(name, BENCH_WARMUP, BENCH_SAMPLES, func());    \
+        _print_stack(name, func);                                       \
+    } while (0)
+
+/* SHA-256 */
+static void _sha256_riot(void)
+{
+    sha256(_msg, sizeof(_msg), _digest);
+}
+
+#ifdef MODULE_TINYCRYPT
+static void _sha256_tinycrypt(void)
+{
+    struct tc_sha256_state_struct s;
+
+    tc_sha256_init(&s);
+    tc_sha256_update(&s, _msg, sizeof(_msg));
+    tc_sha256_final(_digest, &s);
+}
+#endif
+
+/* BLAKE2 */
+#ifdef MODULE_LIBB2
+static void _blake2s_libb2(void)
+{
+    blake2s(_digest, _msg, NULL, 32, sizeof(_msg), 0);
+}
+
+static void _blake2b_libb2(void)
+{
+    blake2b(_digest, _msg, NULL, 64, sizeof(_msg), 0);
+}
+#endif
+
+#ifdef MODULE_MONOCYPHER
+static void _blake2b_monocypher(void)
+{
+    crypto_blake2b_general(_digest, 64, NULL, 0, _msg, sizeof(_msg));
+}
+#endif
+
+/* AES-128-CCM */
+static cipher_t _cipher;
+
+static void _aes_ccm_riot(void)
+{
+    cipher_encrypt_ccm(&_cipher, NULL, 0, 8, 2, _nonce, NONCE_LEN,
+                       _msg, sizeof(_msg), _out);
+}
+
+#ifdef MODULE_TINYCRYPT
+static struct tc_aes_key_sched_struct _sched;
+
+static void _aes_ccm_tinycrypt(void)
+{
+    struct tc_ccm_mode_struct c;
+
+    tc_ccm_config(&c, &_sched, (uint8_t *)_nonce, NONCE_LEN, 8);
+    tc_ccm_generation_encryption(_out, sizeof(_out), NULL, 0,
+                                 _msg, sizeof(_msg), &c);
+}
+#endif
+
+/* ChaCha20-Poly1305 */
+static void _chachapoly_riot(void)
+{
+    iolist_t data = { .iol_base = _out, .iol_len = sizeof(_msg) };
+
+    chacha20poly1305_encrypt_iolist(_key, _nonce, NULL, 0, &data, _tag);
+}
+
+#ifdef MODULE_MONOCYPHER
+/* monocypher only offers XChaCha20-Poly1305 */
+static void _xchachapoly_monocypher(void)
+{
+    crypto_lock(_tag, _out, _key, _nonce, _msg, sizeof(_msg));
+}
+#endif
+
+/* Ed25519 and X25519 */
+#ifdef MODULE_MONOCYPHER
+static uint8_t _mc_sk[32];
+static uint8_t _mc_pk[32];
+
+static void _ed25519_sign_monocypher(void)
+{
+    crypto_sign(_digest, _mc_sk, _mc_pk, _msg, sizeof(_msg));
+}
+
+static void _ed25519_verify_monocypher(void)
+{
+    crypto_check(_digest, _mc_pk, _msg, sizeof(_msg));
+}
+
+static void _x25519_monocypher(void)
+{
+    crypto_x25519(_out, _mc_sk, _mc_pk);
+}
+#endif
+
+#if defined(MODULE_TWEETNACL) || defined(MODULE_HACL)
+static uint8_t _nacl_sk[crypto_sign_SECRETKEYBYTES];
+static uint8_t _nacl_pk[crypto_sign_PUBLICKEYBYTES];
+static uint8_t _nacl_box_sk[crypto_box_SECRETKEYBYTES];
+static uint8_t _nacl_box_pk[crypto_box_PUBLICKEYBYTES];
+static uint8_t _nacl_sm[BENCH_MSG_LEN + crypto_sign_BYTES];
+static uint8_t _nacl_m[BENCH_MSG_LEN + crypto_sign_BYTES];
+
+static void _ed25519_sign_nacl(void)
+{
+    unsigned long long smlen;
+
+    crypto_sign(_nacl_sm, &smlen, _msg, sizeof(_msg), _nacl_sk);
+}
+
+static void _ed25519_verify_nacl(void)
+{
+    unsigned long long mlen;
+
+    crypto_sign_open(_nacl_m, &mlen, _nacl_sm, sizeof(_nacl_sm), _nacl_pk);
+}
+
+/* X25519 plus the HSalsa20 key derivation of crypto_box */
+static void _x25519_nacl(void)
+{
+    crypto_box_beforenm(_out, _nacl_box_pk, _nacl_box_sk);
+}
+#endif
+
+/* P-256 ECDSA */
+#ifdef MODULE_MICRO_ECC
+typedef struct {
+    uECC_HashContext uECC;
+    sha256_context_t ctx;
+} _uecc_hash_ctx_t;
+
+static uint8_t _uecc_sk[32];
+static uint8_t _uecc_pk[64];
+static uint8_t _uecc_sig[64];
+static uint8_t _uecc_tmp[2 * SHA256_DIGEST_LENGTH + SHA256_INTERNAL_BLOCK_SIZE];
+
+static void _uecc_init(const uECC_HashContext *base)
+{
+    sha256_init(&((_uecc_hash_ctx_t *)base)->ctx);
+}
+
+static void _uecc_update(const uECC_HashContext *base,
+                         const uint8_t *message, unsigned message_size)
+{
+    sha256_update(&((_uecc_hash_ctx_t *)base)->ctx, message, message_size);
+}
+
+static void _uecc_finish(const uECC_HashContext *base, uint8_t *hash_result)
+{
+    sha256_final(&((_uecc_hash_ctx_t *)base)->ctx, hash_result);
+}
+
+static void _p256_sign_uecc(void)
+{
+    _uecc_hash_ctx_t ctx = {
+        .uECC = {
+            .init_hash = _uecc_init,
+            .update_hash = _uecc_update,
+            .finish_hash = _uecc_finish,
+            .block_size = SHA256_INTERNAL_BLOCK_SIZE,
+            .result_size = SHA256_DIGEST_LENGTH,
+            .tmp = _uecc_tmp,
+        },
+    };
+
+    sha256(_msg, sizeof(_msg), _digest);
+    uECC_sign_deterministic(_uecc_sk, _digest, SHA256_DIGEST_LENGTH,
+                            &ctx.uECC, _uecc_sig, uECC_secp256r1());
+}
+
+static void _p256_verify_uecc(void)
+{
+    sha256(_msg, sizeof(_msg), _digest);
+    uECC_verify(_uecc_pk, _digest, SHA256_DIGEST_LENGTH, _uecc_sig,
+                uECC_secp256r1());
+}
+
+static void _p256_ecdh_uecc(void)
+{
+    uECC_shared_secret(_uecc_pk, _uecc_sk, _out, uECC_secp256r1());
+}
+#endif
+
+static void _setup(void)
+{
+    memset(_msg, 'A', sizeof(_msg));
+
+    cipher_init(&_cipher, CIPHER_AES_128, _key, 16);
+#ifdef MODULE_TINYCRYPT
+    tc_aes128_set_encrypt_key(&_sched, _key);
+#endif
+#ifdef MODULE_MONOCYPHER
+    random_bytes(_mc_sk, sizeof(_mc_sk));
+    crypto_sign_public_key(_mc_pk, _mc_sk);
+#endif
+#if defined(MODULE_TWEETNACL) || defined(MODULE_HACL)
+    crypto_sign_keypair(_nacl_pk, _nacl_sk);
+    crypto_box_keypair(_nacl_box_pk, _nacl_box_sk);
+    _ed25519_sign_nacl();
+#endif
+#ifdef MODULE_MICRO_ECC
+    /* any value below the group order is a valid private key */
+    random_bytes(_uecc_sk, sizeof(_uecc_sk));
+    _uecc_sk[0] &= 0x7f;
+    uECC_compute_public_key(_uecc_sk, _uecc_pk, uECC_secp256r1());
+    _p256_sign_uecc();
+#endif
+}
+
+int main(void)
+{
+    puts("Crypto implementation benchmark\n");
+    printf("message length: %u bytes\n\n", (unsigned)BENCH_MSG_LEN);
+
+    _setup();
+
+    BENCH("sha256 riot", _sha256_riot);
+#ifdef MODULE_TINYCRYPT
+    BENCH("sha256 tinycrypt", _sha256_tinycrypt);
+#endif
+    puts("");
+
+#ifdef MODULE_LIBB2
+    BENCH("blake2s libb2", _blake2s_libb2);
+    BENCH("blake2b libb2", _blake2b_libb2);
+#endif
+#ifdef MODULE_MONOCYPHER
+    BENCH("blake2b monocypher", _blake2b_monocypher);
+#endif
+    puts("");
+
+    BENCH("aes128-ccm riot", _aes_ccm_riot);
+#ifdef MODULE_TINYCRYPT
+    BENCH("aes128-ccm tinycrypt", _aes_ccm_tinycrypt);
+#endif
+    puts("");
+
+    BENCH("chacha20-poly1305 riot", _chachapoly_riot);
+#ifdef MODULE_MONOCYPHER
+    BENCH("xchacha20-poly1305 monocypher", _xchachapoly_monocypher);
+#endif
+    puts("");
+
+#ifdef MODULE_MONOCYPHER
+    BENCH("ed25519 sign monocypher", _ed25519_sign_monocypher);
+    BENCH("ed25519 verify monocypher", _ed25519_verify_monocypher);
+    BENCH("x25519 monocypher", _x25519_monocypher);
+#endif
+#if defined(MODULE_TWEETNACL)
+    BENCH("ed25519 sign tweetnacl", _ed25519_sign_nacl);
+    BENCH("ed25519 verify tweetnacl", _ed25519_verify_nacl);
+    BENCH("x25519 box_beforenm tweetnacl", _x25519_nacl);
+#elif defined(MODULE_HACL)
+    BENCH("ed25519 sign hacl", _ed25519_sign_nacl);
+    BENCH("ed25519 verify hacl", _ed25519_verify_nacl);
+    BENCH("x25519 box_beforenm hacl", _x25519_nacl);
+#endif
+    puts("");
+
+#ifdef MODULE_MICRO_ECC
+    BENCH("p256 ecdsa sign micro-ecc", _p256_sign_uecc);
+    BENCH("p256 ecdsa verify micro-ecc", _p256_verify_uecc);
+    BENCH("p256 ecdh micro-ecc", _p256_ecdh_uecc);
+#endif
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC UDP throughput and latency benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "msg.h"
+#include "shell.h"
+#include "thread.h"
+#include "utlist.h"
+#include "xtimer.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/udp.h"
+
+#ifndef BENCH_SAMPLES_MAX
+/**
+ * @brief   Number of round trip times kept for the percentiles
+ */
+#define BENCH_SAMPLES_MAX   (256U)
+#endif
+
+#ifndef BENCH_TIMEOUT
+/**
+ * @brief   Time to wait for outstanding replies after the last request in us
+ */
+#define BENCH_TIMEOUT       (1U * US_PER_SEC)
+#endif
+
+#ifndef BENCH_SIZE_MAX
+/**
+ * @brief   Maximum UDP payload size, larger than one 802.15.4 frame by default
+ *          to exercise 6LoWPAN fragmentation
+ */
+#define BENCH_SIZE_MAX      (IPV6_MIN_MTU - sizeof(ipv6_hdr_t) - sizeof(udp_hdr_t))
+#endif
+
+#define QUEUE_SIZE          (16U)
+
+/* header of each benchmark packet, padded to the requested size */
+typedef struct {
+    uint32_t seq;
+    uint32_t sent;
+} bench_hdr_t;
+
+static msg_t _main_queue[QUEUE_SIZE];
+static msg_t _server_queue[QUEUE_SIZE];
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netreg_entry_t _server = GNRC_NETREG_ENTRY_INIT_PID(0, KERNEL_PID_UNDEF);
+static gnrc_netreg_entry_t _client = GNRC_NETREG_ENTRY_INIT_PID(0, KERNEL_PID_UNDEF);
+
+static uint32_t _rtts[BENCH_SAMPLES_MAX];
+static unsigned _received;
+
+static int _send(const ipv6_addr_t *addr, int iface, uint16_t src_port,
+                 uint16_t dst_port, const void *data, size_t size)
+{
+    gnrc_pktsnip_t *payload, *udp, *ip;
+
+    payload = gnrc_pktbuf_add(NULL, data, size, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -1;
+    }
+    udp = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    if (udp == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -1;
+    }
+    ip = gnrc_ipv6_hdr_build(udp, NULL, addr);
+    if (ip == NULL) {
+        gnrc_pktbuf_release(udp);
+        return -1;
+    }
+    if (iface > 0) {
+        gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+
+        if (netif == NULL) {
+            gnrc_pktbuf_release(ip);
+            return -1;
+        }
+        ((gnrc_netif_hdr_t *)netif->data)->if_pid = (kernel_pid_t)iface;
+        LL_PREPEND(ip, netif);
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL, ip)) {
+        gnrc_pktbuf_release(ip);
+        return -1;
+    }
+    return 0;
+}
+
+/* sends every received packet back to where it came from */
+static void *_server_thread(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    msg_init_queue(_server_queue, QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            continue;
+        }
+        gnrc_pktsnip_t *pkt = msg.content.ptr;
+        gnrc_pktsnip_t *udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+        gnrc_pktsnip_t *ip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+        gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+        if ((udp != NULL) && (ip != NULL)) {
+            udp_hdr_t *udp_hdr = udp->data;
+            ipv6_hdr_t *ip_hdr = ip->data;
+            int iface = (netif != NULL) ?
+                        ((gnrc_netif_hdr_t *)netif->data)->if_pid : 0;
+
+            _send(&ip_hdr->src, iface, byteorder_ntohs(udp_hdr->dst_port),
+                  byteorder_ntohs(udp_hdr->src_port), pkt->data, pkt->size);
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    return NULL;
+}
+
+static void _handle_reply(msg_t *msg)
+{
+    if (msg->type != GNRC_NETAPI_MSG_TYPE_RCV) {
+        return;
+    }
+    gnrc_pktsnip_t *pkt = msg->content.ptr;
+
+    if (pkt->size >= sizeof(bench_hdr_t)) {
+        bench_hdr_t hdr;
+
+        memcpy(&hdr, pkt->data, sizeof(hdr));
+        if (_received < BENCH_SAMPLES_MAX) {
+            _rtts[_received] = xtimer_now_usec() - hdr.sent;
+        }
+        _received++;
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+/* handle replies until the given time stamp is reached */
+static void _wait_until(uint32_t until)
+{
+    msg_t msg;
+
+    while (1) {
+        int32_t left = (int32_t)(until - xtimer_now_usec());
+
+        if (left <= 0) {
+            while (msg_try_receive(&msg) == 1) {
+                _handle_reply(&msg);
+            }
+            return;
+        }
+        if (xtimer_msg_receive_timeout(&msg, left) >= 0) {
+            _handle_reply(&msg);
+        }
+    }
+}
+
+static int _cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t _percentile(unsigned num, unsigned pct)
+{
+    return _rtts[((num - 1) * pct) / 100];
+}
+
+static void _run_client(const ipv6_addr_t *addr, int iface, uint16_t port,
+                        unsigned count, size_t size, uint32_t interval)
+{
+    static uint8_t buf[BENCH_SIZE_MAX];
+    bench_hdr_t hdr;
+    unsigned sent = 0;
+
+    if (size < sizeof(hdr)) {
+        size = sizeof(hdr);
+    }
+    if (size > sizeof(buf)) {
+        size = sizeof(buf);
+    }
+    memset(buf, 0, sizeof(buf));
+    _received = 0;
+    _client.target.pid = thread_getpid();
+    _client.demux_ctx = port + 1;
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &_client);
+#ifdef MODULE_GNRC_PKTBUF_STATIC
+    gnrc_pktbuf_max_used_reset();
+#endif
+
+    uint32_t start = xtimer_now_usec();
+    uint32_t next = start;
+
+    for (unsigned i = 0; i < count; i++) {
+        hdr.seq = i;
+        hdr.sent = xtimer_now_usec();
+        memcpy(buf, &hdr, sizeof(hdr));
+        if (_send(addr, iface, port + 1, port, buf, size) == 0) {
+            sent++;
+        }
+        next += interval;
+        _wait_until(next);
+    }
+    uint32_t tx_time = xtimer_now_usec() - start;
+
+    /* collect the stragglers */
+    uint32_t deadline = xtimer_now_usec() + BENCH_TIMEOUT;
+    while ((_received < sent) && ((int32_t)(deadline - xtimer_now_usec()) > 0)) {
+        _wait_until(xtimer_now_usec() + 10U * US_PER_MS);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_client);
+
+    if (tx_time == 0) {
+        tx_time = 1;
+    }
+    printf("{\"size\": %u, \"sent\": %u, \"received\": %u, \"tx_pps\": %" PRIu32,
+           (unsigned)size, sent, _received,
+           (uint32_t)(((uint64_t)sent * US_PER_SEC) / tx_time));
+    unsigned num = (_received < BENCH_SAMPLES_MAX) ? _received
+                                                   : BENCH_SAMPLES_MAX;
+    if (num > 0) {
+        qsort(_rtts, num, sizeof(_rtts[0]), _cmp);
+        printf(", \"rtt_us\": {\"min\": %" PRIu32 ", \"p50\": %" PRIu32
+               ", \"p90\": %" PRIu32 ", \"p99\": %" PRIu32
+               ", \"max\": %" PRIu32 "}",
+               _rtts[0], _percentile(num, 50), _percentile(num, 90),
+               _percentile(num, 99), _rtts[num - 1]);
+    }
+#ifdef MODULE_GNRC_PKTBUF_STATIC
+    printf(", \"pktbuf_max_used\": %u", (unsigned)gnrc_pktbuf_max_used());
+#endif
+    puts("}");
+}
+
+static int _bench_cmd(int argc, char **argv)
+{
+    if ((argc == 3) && (strcmp(argv[1], "server") == 0)) {
+        if (_server.target.pid != KERNEL_PID_UNDEF) {
+            puts("error: server already running");
+            return 1;
+        }
+        _server.target.pid = thread_create(_server_stack, sizeof(_server_stack),
+                                           THREAD_PRIORITY_MAIN - 1,
+                                           THREAD_CREATE_STACKTEST,
+                                           _server_thread, NULL, "bench_server");
+        _server.demux_ctx = atoi(argv[2]);
+        gnrc_netreg_register(GNRC_NETTYPE_UDP, &_server);
+        printf("echo server running on port %u\n", (unsigned)_server.demux_ctx);
+        return 0;
+    }
+    if ((argc >= 4) && (strcmp(argv[1], "client") == 0)) {
+        ipv6_addr_t addr;
+        int iface = ipv6_addr_split_iface(argv[2]);
+        unsigned count = (argc > 4) ? (unsigned)atoi(argv[4]) : 100;
+        size_t size = (argc > 5) ? (size_t)atoi(argv[5]) : 32;
+        uint32_t interval = (argc > 6) ? (uint32_t)atoi(argv[6]) : 10000;
+
+        if ((iface < 0) && (gnrc_netif_numof() == 1)) {
+            iface = gnrc_netif_iter(NULL)->pid;
+        }
+        if (ipv6_addr_from_str(&addr, argv[2]) == NULL) {
+            puts("error: unable to parse destination address");
+            return 1;
+        }
+        _run_client(&addr, iface, atoi(argv[3]), count, size, interval);
+        return 0;
+    }
+    printf("usage: %s server <port>\n"
+           "       %s client <addr> <port> [<count> [<size> [<interval in us>]]]\n",
+           argv[0], argv[0]);
+    return 1;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "bench", "UDP echo throughput and latency benchmark", _bench_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    puts("GNRC UDP benchmark");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,344 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Interrupt latency benchmark under background load
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "irq.h"
+#include "mutex.h"
+#include "random.h"
+#include "thread.h"
+#include "periph/gpio.h"
+#include "periph/timer.h"
+
+#ifdef LOAD_PKTBUF
+#include "net/gnrc/pktbuf.h"
+#endif
+#ifdef LOAD_XTIMER
+#include "xtimer.h"
+#endif
+#ifdef LOAD_CRYPTO
+#include "hashes/sha256.h"
+#endif
+#ifdef LOAD_FLASH
+#include "periph/flashpage.h"
+#endif
+#ifdef LOAD_GNRC
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#endif
+
+/**
+ * @brief   Timer used for the measurement, must not be used by xtimer
+ */
+#ifndef LATENCY_TIM
+#define LATENCY_TIM         TIMER_DEV(1)
+#endif
+
+/**
+ * @brief   Frequency of the measurement timer, one tick is the resolution
+ */
+#ifndef LATENCY_TIM_FREQ
+#define LATENCY_TIM_FREQ    (1000000LU)
+#endif
+
+/**
+ * @brief   Largest value of the measurement timer, e.g. 0xffff for 16-bit
+ *          timers
+ */
+#ifndef LATENCY_TIM_MAX
+#define LATENCY_TIM_MAX     (~0U)
+#endif
+
+/**
+ * @brief   Ticks between two compare interrupts
+ */
+#ifndef LATENCY_PERIOD
+#define LATENCY_PERIOD      (997U)
+#endif
+
+/**
+ * @brief   Number of interrupts measured per load
+ */
+#ifndef LATENCY_SAMPLES
+#define LATENCY_SAMPLES     (10000U)
+#endif
+
+/**
+ * @brief   Number of histogram buckets of one tick each, larger latencies
+ *          are only counted
+ */
+#ifndef LATENCY_HIST_SIZE
+#define LATENCY_HIST_SIZE   (256U)
+#endif
+
+/**
+ * @brief   Pin set at the entry of the compare interrupt and cleared at its
+ *          end, to observe the jitter with a scope or logic analyzer
+ */
+#ifndef LATENCY_GPIO
+#define LATENCY_GPIO        GPIO_UNDEF
+#endif
+
+#define ARRAY_SIZE(a)       (sizeof(a) / sizeof((a)[0]))
+
+#ifdef MODULE_PERIPH_GPIO
+#define PIN_SET()           if (LATENCY_GPIO != GPIO_UNDEF) { gpio_set(LATENCY_GPIO); }
+#define PIN_CLEAR()         if (LATENCY_GPIO != GPIO_UNDEF) { gpio_clear(LATENCY_GPIO); }
+#else
+#define PIN_SET()
+#define PIN_CLEAR()
+#endif
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} load_t;
+
+static uint16_t _hist[LATENCY_HIST_SIZE];
+static unsigned _overflows;
+static unsigned _max;
+static unsigned _min;
+static volatile unsigned _samples;
+static unsigned _target;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static volatile unsigned _load;
+static char _load_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void _load_idle(void)
+{
+}
+
+#ifdef LOAD_MALLOC
+static void _load_malloc(void)
+{
+    void *ptr = malloc(random_uint32_range(16, 257));
+
+    free(ptr);
+}
+#endif
+
+#ifdef LOAD_PKTBUF
+static void _load_pktbuf(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          random_uint32_range(16, 257),
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (pkt != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+}
+#endif
+
+#ifdef LOAD_XTIMER
+static void _xtimer_cb(void *arg)
+{
+    (void)arg;
+}
+
+static void _load_xtimer(void)
+{
+    static xtimer_t timers[8];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        timers[i].callback = _xtimer_cb;
+        xtimer_set(&timers[i], random_uint32_range(100, 10000));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        xtimer_remove(&timers[i]);
+    }
+}
+#endif
+
+#ifdef LOAD_CRYPTO
+static void _load_crypto(void)
+{
+    static uint8_t data[512];
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    sha256(data, sizeof(data), digest);
+}
+#endif
+
+#ifdef LOAD_FLASH
+static void _load_flash(void)
+{
+    static uint8_t page[FLASHPAGE_SIZE];
+
+    /* the last page is not used by the application */
+    memset(page, random_uint32() & 0xff, sizeof(page));
+    flashpage_write(FLASHPAGE_NUMOF - 1, page);
+}
+#endif
+
+#ifdef LOAD_GNRC
+static void _load_gnrc(void)
+{
+    static uint8_t payload[64];
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = 1234 };
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    sock_udp_send(NULL, payload, sizeof(payload), &remote);
+}
+#endif
+
+static const load_t _loads[] = {
+    { "idle", _load_idle },
+#ifdef LOAD_MALLOC
+    { "malloc", _load_malloc },
+#endif
+#ifdef LOAD_PKTBUF
+    { "pktbuf", _load_pktbuf },
+#endif
+#ifdef LOAD_XTIMER
+    { "xtimer", _load_xtimer },
+#endif
+#ifdef LOAD_CRYPTO
+    { "crypto", _load_crypto },
+#endif
+#ifdef LOAD_FLASH
+    { "flash", _load_flash },
+#endif
+#ifdef LOAD_GNRC
+    { "gnrc", _load_gnrc },
+#endif
+};
+
+static void _timer_cb(void *arg, int channel)
+{
+    (void)arg;
+    (void)channel;
+
+    PIN_SET();
+
+    unsigned now = timer_read(LATENCY_TIM);
+    unsigned latency = (now - _target) & LATENCY_TIM_MAX;
+
+    if (latency < LATENCY_HIST_SIZE) {
+        _hist[latency]++;
+    }
+    else {
+        _overflows++;
+    }
+    if (latency > _max) {
+        _max = latency;
+    }
+    if (latency < _min) {
+        _min = latency;
+    }
+
+    if (++_samples < LATENCY_SAMPLES) {
+        /* schedule relative to the target, so the phase against the load
+         * keeps moving */
+        _target = (_target + LATENCY_PERIOD) & LATENCY_TIM_MAX;
+        if (((_target - now) & LATENCY_TIM_MAX) > LATENCY_PERIOD) {
+            /* missed the next period already */
+            _target = (now + LATENCY_PERIOD) & LATENCY_TIM_MAX;
+        }
+        timer_set_absolute(LATENCY_TIM, 0, _target);
+    }
+    else {
+        mutex_unlock(&_done);
+    }
+
+    PIN_CLEAR();
+}
+
+static void *_load_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        _loads[_load].run();
+    }
+
+    return NULL;
+}
+
+/* smallest latency that at least permille/1000 of the samples did not
+ * exceed, latencies beyond the histogram are reported as the maximum */
+static unsigned _percentile(unsigned permille)
+{
+    uint32_t needed = ((uint32_t)LATENCY_SAMPLES * permille + 999) / 1000;
+    uint32_t sum = 0;
+
+    for (unsigned i = 0; i < LATENCY_HIST_SIZE; i++) {
+        sum += _hist[i];
+        if (sum >= needed) {
+            return i;
+        }
+    }
+    return _max;
+}
+
+static void _measure(unsigned load)
+{
+    memset(_hist, 0, sizeof(_hist));
+    _overflows = 0;
+    _max = 0;
+    _min = ~0U;
+    _samples = 0;
+    _load = load;
+
+    unsigned state = irq_disable();
+    _target = (timer_read(LATENCY_TIM) + LATENCY_PERIOD) & LATENCY_TIM_MAX;
+    timer_set_absolute(LATENCY_TIM, 0, _target);
+    irq_restore(state);
+
+    mutex_lock(&_done);
+
+    printf("{ \"load\" : \"%s\", \"samples\" : %u, \"min\" : %u, "
+           "\"p50\" : %u, \"p90\" : %u, \"p99\" : %u, \"p999\" : %u, "
+           "\"max\" : %u, \"overflows\" : %u }\n",
+           _loads[load].name, LATENCY_SAMPLES, _min, _percentile(500),
+           _percentile(900), _percentile(990), _percentile(999), _max,
+           _overflows);
+}
+
+int main(void)
+{
+    puts("IRQ latency benchmark");
+    printf("latencies in ticks of %lu Hz, %u samples per load\n",
+           (unsigned long)LATENCY_TIM_FREQ, LATENCY_SAMPLES);
+
+#ifdef MODULE_PERIPH_GPIO
+    if (LATENCY_GPIO != GPIO_UNDEF) {
+        gpio_init(LATENCY_GPIO, GPIO_OUT);
+        gpio_clear(LATENCY_GPIO);
+    }
+#endif
+    if (timer_init(LATENCY_TIM, LATENCY_TIM_FREQ, _timer_cb, NULL) != 0) {
+        puts("error: unable to initialize the timer");
+        return 1;
+    }
+
+    /* the load runs whenever main waits for the measurement to finish */
+    thread_create(_load_stack, sizeof(_load_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _load_thread, NULL, "load");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_loads); i++) {
+        _measure(i);
+    }
+
+    puts("done");
+    return 0;
+}
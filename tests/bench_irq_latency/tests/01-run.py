@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("IRQ latency benchmark")
+    child.expect(r'{ "load" : "idle", .* "max" : \d+, "overflows" : \d+ }')
+    child.expect_exact("done", timeout=120)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
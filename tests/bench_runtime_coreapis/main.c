@@ -25,8 +25,12 @@
 #include "thread.h"
 #include "thread_flags.h"
 
-#ifndef BENCH_RUNS
-#define BENCH_RUNS          (1000UL * 1000UL)
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP        (10U)
+#endif
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES       (100U)
 #endif
 
 static mutex_t _lock;
@@ -64,19 +68,19 @@ int main(void)
 
     t = (thread_t *)sched_active_thread;
 
-    BENCHMARK_FUNC("nop loop", BENCH_RUNS, __asm__ volatile ("nop"));
+    BENCHMARK_SAMPLE("nop", BENCH_WARMUP, BENCH_SAMPLES, __asm__ volatile ("nop"));
     puts("");
-    BENCHMARK_FUNC("mutex_init()", BENCH_RUNS, mutex_init(&_lock));
-    BENCHMARK_FUNC("mutex lock/unlock", BENCH_RUNS, _mutex_lockunlock());
+    BENCHMARK_SAMPLE("mutex_init()", BENCH_WARMUP, BENCH_SAMPLES, mutex_init(&_lock));
+    BENCHMARK_SAMPLE("mutex lock/unlock", BENCH_WARMUP, BENCH_SAMPLES, _mutex_lockunlock());
     puts("");
-    BENCHMARK_FUNC("thread_flags_set()", BENCH_RUNS, thread_flags_set(t, _flag));
-    BENCHMARK_FUNC("thread_flags_clear()", BENCH_RUNS, thread_flags_clear(_flag));
-    BENCHMARK_FUNC("thread flags set/wait any", BENCH_RUNS, _flag_waitany());
-    BENCHMARK_FUNC("thread flags set/wait all", BENCH_RUNS, _flag_waitall());
-    BENCHMARK_FUNC("thread flags set/wait one", BENCH_RUNS, _flag_waitone());
+    BENCHMARK_SAMPLE("thread_flags_set()", BENCH_WARMUP, BENCH_SAMPLES, thread_flags_set(t, _flag));
+    BENCHMARK_SAMPLE("thread_flags_clear()", BENCH_WARMUP, BENCH_SAMPLES, thread_flags_clear(_flag));
+    BENCHMARK_SAMPLE("thread flags set/wait any", BENCH_WARMUP, BENCH_SAMPLES, _flag_waitany());
+    BENCHMARK_SAMPLE("thread flags set/wait all", BENCH_WARMUP, BENCH_SAMPLES, _flag_waitall());
+    BENCHMARK_SAMPLE("thread flags set/wait one", BENCH_WARMUP, BENCH_SAMPLES, _flag_waitone());
     puts("");
-    BENCHMARK_FUNC("msg_try_receive()", BENCH_RUNS, msg_try_receive(&_msg));
-    BENCHMARK_FUNC("msg_avail()", BENCH_RUNS, msg_avail());
+    BENCHMARK_SAMPLE("msg_try_receive()", BENCH_WARMUP, BENCH_SAMPLES, msg_try_receive(&_msg));
+    BENCHMARK_SAMPLE("msg_avail()", BENCH_WARMUP, BENCH_SAMPLES, msg_avail());
 
     puts("\n[SUCCESS]");
     return 0;
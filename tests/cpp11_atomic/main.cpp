@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief test atomic replacement and lock-free containers
+ *
+ * @}
+ */
+#include <cstdio>
+#include <cassert>
+
+#include "riot/atomic.hpp"
+#include "riot/lockfree.hpp"
+#include "riot/thread.hpp"
+
+using namespace riot;
+
+namespace {
+
+constexpr int rounds = 1000;
+
+struct item : mpsc_stack_node {
+  int value;
+};
+
+} // namespace
+
+int main() {
+  puts("\n************ C++ atomic test ***********");
+
+  puts("Atomic counter ...");
+  {
+    atomic<unsigned> counter{0};
+    auto f = [&counter] {
+      for (int i = 0; i < rounds; ++i) {
+        counter.fetch_add(1);
+        this_thread::yield();
+      }
+    };
+    thread t1(f);
+    thread t2(f);
+    t1.join();
+    t2.join();
+    assert(counter.load() == 2 * rounds);
+
+    unsigned expected = 0;
+    assert(!counter.compare_exchange_strong(expected, 1));
+    assert(expected == 2 * rounds);
+    assert(counter.compare_exchange_strong(expected, 1));
+    assert(counter.exchange(5) == 1);
+    assert(counter == 5);
+  }
+  puts("Done\n");
+
+  puts("SPSC queue ...");
+  {
+    spsc_queue<int, 8> queue;
+    thread producer([&queue] {
+      for (int i = 0; i < rounds; ++i) {
+        while (!queue.push(i)) {
+          this_thread::yield();
+        }
+      }
+    });
+    for (int i = 0; i < rounds; ++i) {
+      int value;
+      while (!queue.pop(value)) {
+        this_thread::yield();
+      }
+      assert(value == i);
+    }
+    producer.join();
+    assert(queue.empty());
+  }
+  puts("Done\n");
+
+  puts("MPSC stack ...");
+  {
+    mpsc_stack stack;
+    item items[4];
+    for (int i = 0; i < 4; ++i) {
+      items[i].value = i;
+      stack.push(&items[i]);
+    }
+    int expected = 3;
+    for (auto node = stack.take_all(); node; node = node->next) {
+      assert(static_cast<item*>(node)->value == expected--);
+    }
+    assert(expected == -1);
+    assert(stack.empty());
+  }
+  puts("Done\n");
+
+  puts("Bye, bye.");
+  puts("*****************************************\n");
+
+  return 0;
+}
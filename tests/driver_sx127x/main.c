@@ -335,6 +335,10 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                        sx127x_get_time_on_air((const sx127x_t*)dev, len));
                 break;
 
+            case NETDEV_EVENT_RX_STARTED:
+                puts("Receiving a packet");
+                break;
+
             case NETDEV_EVENT_TX_COMPLETE:
                 sx127x_set_sleep(&sx127x);
                 puts("Transmission completed");
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for WS281x LED strips
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "xtimer.h"
+#include "color.h"
+
+#include "ws281x.h"
+#include "ws281x_params.h"
+
+/**
+ * @brief   Move the light to the next LED every 50ms
+ */
+#define STEP        (50 * US_PER_MS)
+
+static ws281x_t dev;
+
+int main(void)
+{
+    static const color_rgb_t black = { 0, 0, 0 };
+    color_hsv_t hsv = { 0.0, 1.0, 0.25 };
+    color_rgb_t rgb;
+    unsigned pos = 0;
+
+    puts("WS281x Test App");
+
+    ws281x_init(&dev, &ws281x_params[0]);
+
+    puts("Initialization done.");
+
+    while (1) {
+        /* run around the hue circle while moving along the strip */
+        hsv.h += 5.0;
+        if (hsv.h > 360.0) {
+            hsv.h = 0.0;
+        }
+        color_hsv2rgb(&hsv, &rgb);
+
+        ws281x_set(&dev, pos, &black);
+        pos = (pos + 1) % dev.led_numof;
+        ws281x_set(&dev, pos, &rgb);
+        ws281x_write(&dev);
+
+        xtimer_usleep(STEP);
+    }
+
+    return 0;
+}
@@ -32,10 +32,13 @@ static void callback(event_t *arg);
 static void custom_callback(event_t *event);
 static void timed_callback(void *arg);
 static void forbidden_callback(void *arg);
+static void forbidden_event(event_t *event);
 
 
 static event_t event = { .handler = callback };
 static event_t event2 = { .handler = callback };
+static event_t event_prio_high = { .handler = forbidden_event };
+static event_t event_prio_low = { .handler = forbidden_event };
 
 static void callback(event_t *arg)
 {
@@ -85,10 +88,34 @@ static void forbidden_callback(void *arg)
     }
 }
 
+static void forbidden_event(event_t *event)
+{
+    forbidden_callback(event);
+}
+
+static void test_prio_queues(void)
+{
+    event_queue_t queues[2];
+
+    event_queues_init(queues, 2);
+    puts("posting low priority event, then high priority event");
+    event_post(&queues[1], &event_prio_low);
+    event_post(&queues[0], &event_prio_high);
+
+    event_t *ev = event_wait_multi(queues, 2);
+    assert(ev == &event_prio_high);
+    ev = event_wait_multi(queues, 2);
+    assert(ev == &event_prio_low);
+    (void)ev;
+    puts("prioritized events received in order");
+}
+
 int main(void)
 {
     puts("[START] event test application.\n");
 
+    test_prio_queues();
+
     event_queue_t queue = { .waiter = (thread_t *)sched_active_thread };
     printf("posting 0x%08x\n", (unsigned)&event);
     event_post(&queue, &event);
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the size-class packet buffer backend
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktbuf_slab.h"
+
+#define TEST_STRING     "Lorem ipsum dolor sit amet"
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+}
+
+static void test_pktbuf_slab_add_release(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING), pkt->size);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, pkt->data);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_add__too_large(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, GNRC_PKTBUF_SLAB_LARGE_SIZE + 1,
+                                     GNRC_NETTYPE_UNDEF));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_add__exhaust_snips(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_SNIP_NUMOF; i++) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_add(pkt, NULL, 0, GNRC_NETTYPE_UNDEF);
+
+        TEST_ASSERT_NOT_NULL(tmp);
+        pkt = tmp;
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(pkt, NULL, 0, GNRC_NETTYPE_UNDEF));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_add__fallback_to_larger_class(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    /* exhaust small class, further small allocations go to medium class */
+    for (unsigned i = 0; i < (GNRC_PKTBUF_SLAB_SMALL_NUMOF + 1); i++) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_UNDEF);
+
+        TEST_ASSERT_NOT_NULL(tmp);
+        pkt = tmp;
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_mark(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 5, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(pkt->next == hdr);
+    TEST_ASSERT_EQUAL_INT(5, hdr->size);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING) - 5, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING, hdr->data, 5));
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING + 5, pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* remainder was moved within its block, releasing must free the block */
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_realloc_data(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* grow into a larger class */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, GNRC_PKTBUF_SLAB_MEDIUM_SIZE));
+    TEST_ASSERT_EQUAL_INT(GNRC_PKTBUF_SLAB_MEDIUM_SIZE, pkt->size);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, pkt->data);
+    /* shrink back to the small class */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, sizeof(TEST_STRING)));
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, pkt->data);
+    TEST_ASSERT_EQUAL_INT(ENOMEM,
+                          gnrc_pktbuf_realloc_data(pkt, GNRC_PKTBUF_SLAB_LARGE_SIZE + 1));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_start_write(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *write;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_hold(pkt, 1);
+    write = gnrc_pktbuf_start_write(pkt);
+    TEST_ASSERT_NOT_NULL(write);
+    TEST_ASSERT(write != pkt);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, write->data);
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_release(write);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_pktbuf_slab(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_slab_add_release),
+        new_TestFixture(test_pktbuf_slab_add__too_large),
+        new_TestFixture(test_pktbuf_slab_add__exhaust_snips),
+        new_TestFixture(test_pktbuf_slab_add__fallback_to_larger_class),
+        new_TestFixture(test_pktbuf_slab_mark),
+        new_TestFixture(test_pktbuf_slab_realloc_data),
+        new_TestFixture(test_pktbuf_slab_start_write),
+    };
+
+    EMB_UNIT_TESTCALLER(pktbuf_slab_tests, set_up, NULL, fixtures);
+
+    return (Test *)&pktbuf_slab_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_slab());
+    TESTS_END();
+
+    return 0;
+}
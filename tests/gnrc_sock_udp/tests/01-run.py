@@ -33,6 +33,9 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_recv__unsocketed_with_remote()")
     child.expect_exact(u"Calling test_sock_udp_recv__with_timeout()")
     child.expect_exact(u"Calling test_sock_udp_recv__non_blocking()")
+    child.expect_exact(u"Calling test_sock_udp_recv_buf()")
+    child.expect_exact(u"Calling test_sock_udp_recv_buf__free()")
+    child.expect_exact(u"Calling test_sock_udp_set_cb__recv()")
     child.expect_exact(u"Calling test_sock_udp_send__EAFNOSUPPORT()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_addr()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_netif()")
@@ -49,6 +52,9 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed()")
     child.expect_exact(u"Calling test_sock_udp_send__no_sock_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__no_sock()")
+    child.expect_exact(u"Calling test_sock_udp_send_batch()")
+    child.expect_exact(u"Calling test_sock_udp_send_batch__EINVAL_port()")
+    child.expect_exact(u"Calling test_sock_udp_set_cb__sent()")
     child.expect_exact(u"ALL TESTS SUCCESSFUL")
 
 
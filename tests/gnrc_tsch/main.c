@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for testing the TSCH implementation
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shell.h"
+#include "shell_commands.h"
+
+#include "net/gnrc/pktdump.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/tsch/tsch.h"
+
+static void _print_state(gnrc_netif_t *netif)
+{
+    gnrc_tsch_t *tsch = &netif->mac.prot.tsch;
+    char addr_str[GNRC_NETIF_HDR_L2ADDR_PRINT_LEN];
+
+    printf("state: %s  ASN: %lu  join priority: %u\n",
+           (tsch->state == GNRC_TSCH_STATE_SYNCED) ? "synced" : "scanning",
+           (unsigned long)tsch->asn, (unsigned)tsch->join_priority);
+    puts("cells:");
+    mutex_lock(&tsch->lock);
+    for (unsigned i = 0; i < GNRC_TSCH_CELL_NUMOF; i++) {
+        const gnrc_tsch_cell_t *cell = &tsch->cells[i];
+
+        if (cell->options == 0) {
+            continue;
+        }
+        printf("  slot %u  channel offset %u  %s%s%s %s\n",
+               (unsigned)cell->slot_offset, (unsigned)cell->channel_offset,
+               (cell->options & GNRC_TSCH_CELL_TX) ? "TX " : "",
+               (cell->options & GNRC_TSCH_CELL_RX) ? "RX " : "",
+               (cell->options & GNRC_TSCH_CELL_SHARED) ? "SHARED " : "",
+               (cell->addr_len == 0) ? "any" :
+               gnrc_netif_addr_to_str(cell->addr, cell->addr_len, addr_str));
+    }
+    mutex_unlock(&tsch->lock);
+}
+
+static int _parse_cell(gnrc_tsch_cell_t *cell, int argc, char **argv)
+{
+    memset(cell, 0, sizeof(*cell));
+    cell->slot_offset = atoi(argv[2]);
+    cell->channel_offset = atoi(argv[3]);
+    for (int i = 4; i < argc; i++) {
+        if (strcmp(argv[i], "tx") == 0) {
+            cell->options |= GNRC_TSCH_CELL_TX;
+        }
+        else if (strcmp(argv[i], "rx") == 0) {
+            cell->options |= GNRC_TSCH_CELL_RX;
+        }
+        else if (strcmp(argv[i], "shared") == 0) {
+            cell->options |= GNRC_TSCH_CELL_SHARED;
+        }
+        else {
+            uint8_t addr[GNRC_NETIF_L2ADDR_MAXLEN];
+            size_t len = gnrc_netif_addr_from_str(argv[i], addr);
+
+            if ((len == 0) || (len > sizeof(cell->addr))) {
+                printf("error: invalid address %s\n", argv[i]);
+                return -1;
+            }
+            memcpy(cell->addr, addr, len);
+            cell->addr_len = len;
+        }
+    }
+    return 0;
+}
+
+static int _tsch_cmd(int argc, char **argv)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    gnrc_tsch_cell_t cell;
+    int res;
+
+    if (netif == NULL) {
+        puts("error: no network interface");
+        return 1;
+    }
+    if (argc == 1) {
+        _print_state(netif);
+        return 0;
+    }
+    if (strcmp(argv[1], "start") == 0) {
+        res = gnrc_tsch_start(netif);
+    }
+    else if ((argc >= 5) && (strcmp(argv[1], "add") == 0)) {
+        if (_parse_cell(&cell, argc, argv) < 0) {
+            return 1;
+        }
+        res = gnrc_tsch_cell_add(netif, &cell);
+    }
+    else if ((argc == 4) && (strcmp(argv[1], "del") == 0)) {
+        res = gnrc_tsch_cell_remove(netif, atoi(argv[2]), atoi(argv[3]));
+    }
+    else {
+        printf("usage: %s [start]\n"
+               "       %s add <slot> <channel offset> [tx] [rx] [shared] [<addr>]\n"
+               "       %s del <slot> <channel offset>\n",
+               argv[0], argv[0], argv[0]);
+        return 1;
+    }
+    if (res < 0) {
+        printf("error: %s failed (%d)\n", argv[1], res);
+        return 1;
+    }
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "tsch", "show and configure TSCH", _tsch_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("TSCH test application");
+
+    gnrc_netreg_entry_t dump = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                          gnrc_pktdump_pid);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &dump);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
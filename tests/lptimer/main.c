@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       lptimer test application
+ *
+ * Sleeps with lptimer and compares the result with xtimer.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "lptimer.h"
+#include "xtimer.h"
+
+static const uint32_t sleep_ms[] = { 5, 50, 500, 2000, 5000 };
+
+int main(void)
+{
+    puts("lptimer test application");
+
+    for (unsigned i = 0; i < sizeof(sleep_ms) / sizeof(sleep_ms[0]); i++) {
+        uint64_t lp_start = lptimer_now_ms64();
+        uint64_t start = xtimer_now_usec64();
+
+        lptimer_sleep_ms(sleep_ms[i]);
+
+        uint32_t lp_slept = lptimer_now_ms64() - lp_start;
+        uint32_t slept = (xtimer_now_usec64() - start) / US_PER_MS;
+        printf("slept %" PRIu32 " ms: lptimer %" PRIu32 " ms, xtimer %" PRIu32
+               " ms\n", sleep_ms[i], lp_slept, slept);
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
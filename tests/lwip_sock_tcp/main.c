@@ -427,6 +427,36 @@ static void test_tcp_read4__success(void)
     assert(memcmp(exp_data.iov_base, _test_buffer, exp_data.iov_len) == 0);
 }
 
+static void test_tcp_read_buf4__success(void)
+{
+    static const sock_tcp_ep_t remote = { .addr = { .ipv4_u32 = _TEST_ADDR4_REMOTE },
+                                          .family = AF_INET,
+                                          .port = _TEST_PORT_REMOTE,
+                                          .netif = SOCK_ADDR_ANY_NETIF };
+    msg_t msg = { .type = _SERVER_MSG_START };
+    static const struct iovec exp_data = { .iov_base = "Hello!",
+                                           .iov_len = sizeof("Hello!") };
+    void *data = NULL;
+
+    _server_addr.family = AF_INET;
+    _server_addr.port = _TEST_PORT_REMOTE;
+    _server_addr.netif = SOCK_ADDR_ANY_NETIF;
+
+    msg_send(&msg, _server);        /* start server on _TEST_PORT_LOCAL */
+    msg.type = _SERVER_MSG_ACCEPT;
+    msg_send(&msg, _server);        /* let server accept */
+
+    assert(0 == sock_tcp_connect(&_sock, &remote, 0, SOCK_FLAGS_REUSE_EP));
+    msg.type = _SERVER_MSG_WRITE;
+    msg.content.ptr = (void *)&exp_data;
+    msg_send(&msg, _server);        /* write expected data at server */
+    assert(((ssize_t)exp_data.iov_len) == sock_tcp_read_buf(&_sock, &data,
+                                                            SOCK_NO_TIMEOUT));
+    assert(data != NULL);
+    assert(memcmp(exp_data.iov_base, data, exp_data.iov_len) == 0);
+    assert(-EAGAIN == sock_tcp_read_buf(&_sock, &data, 0));
+}
+
 static void test_tcp_read4__success_with_timeout(void)
 {
     static const sock_tcp_ep_t remote = { .addr = { .ipv4_u32 = _TEST_ADDR4_REMOTE },
@@ -1017,6 +1047,7 @@ int main(void)
     CALL(test_tcp_read4__success());
     CALL(test_tcp_read4__success_with_timeout());
     CALL(test_tcp_read4__success_non_blocking());
+    CALL(test_tcp_read_buf4__success());
     /* ECONNABORTED can't be tested in this setup */
     /* ENOTCONN not applicable since lwIP always tries to send */
     CALL(test_tcp_write4__ENOTCONN());
@@ -88,6 +88,7 @@ def testfunc(child):
         child.expect_exact(u"Calling test_sock_udp_recv6__unsocketed_with_remote()")
         child.expect_exact(u"Calling test_sock_udp_recv6__with_timeout()")
         child.expect_exact(u"Calling test_sock_udp_recv6__non_blocking()")
+        child.expect_exact(u"Calling test_sock_udp_recv6_buf()")
         child.expect_exact(u"Calling test_sock_udp_send6__EAFNOSUPPORT()")
         child.expect_exact(u"Calling test_sock_udp_send6__EINVAL_addr()")
         child.expect_exact(u"Calling test_sock_udp_send6__EINVAL_netif()")
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the malloc thread caches
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "malloc_thread_cache.h"
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define BLOCK_SIZE      (24U)
+#define ISR_BLOCK_SIZE  (200U)
+#define ITERATIONS      (500U)
+
+static char stack[THREAD_STACKSIZE_MAIN];
+static mutex_t done = MUTEX_INIT_LOCKED;
+static void *isr_malloc = (void *)1;
+static void *isr_block;
+static unsigned failed;
+
+static void isr_cb(void *arg)
+{
+    (void)arg;
+    isr_malloc = malloc(BLOCK_SIZE);
+    free(isr_block);
+}
+
+static void churn(uint8_t pattern)
+{
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        /* sizes in and above the range of the caches */
+        size_t size = 1 + ((i * 7) % 200);
+        uint8_t *ptr = malloc(size);
+
+        if (ptr == NULL) {
+            failed++;
+            return;
+        }
+        memset(ptr, pattern, size);
+        thread_yield();
+        for (size_t j = 0; j < size; j++) {
+            if (ptr[j] != pattern) {
+                printf("block %p overwritten\n", (void *)ptr);
+                failed++;
+                break;
+            }
+        }
+        free(ptr);
+    }
+    malloc_thread_cache_flush();
+}
+
+static void *thread(void *arg)
+{
+    (void)arg;
+    churn(0xa5);
+    mutex_unlock(&done);
+    return NULL;
+}
+
+int main(void)
+{
+    xtimer_t timer = { .callback = isr_cb };
+    void *a, *b;
+
+    a = malloc(BLOCK_SIZE);
+    free(a);
+    b = malloc(BLOCK_SIZE);
+    printf("cache hit: %s\n", (a == b) ? "yes" : "no");
+    failed += (a != b);
+    free(b);
+
+    isr_block = malloc(ISR_BLOCK_SIZE);
+    xtimer_set(&timer, 1000);
+    xtimer_usleep(10000);
+    printf("malloc in ISR refused: %s\n", (isr_malloc == NULL) ? "yes" : "no");
+    failed += (isr_malloc != NULL);
+    /* returns the block freed in the ISR to the heap */
+    free(malloc(ISR_BLOCK_SIZE));
+
+    thread_create(stack, sizeof(stack), THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_STACKTEST, thread, NULL, "churn");
+    churn(0x5a);
+    mutex_lock(&done);
+    malloc_thread_cache_flush();
+
+    puts(failed ? "FAILURE" : "SUCCESS");
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for msg_send_bulk() and msg_receive_bulk()
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (8U)
+#define BULK_NUMOF      (4U)
+
+static msg_t _main_queue[QUEUE_SIZE];
+static msg_t _recv_queue[QUEUE_SIZE];
+static char _stack[THREAD_STACKSIZE_MAIN];
+
+static void _print_msgs(const char *name, const msg_t *msgs, int numof)
+{
+    printf("%s: got %d:", name, numof);
+    for (int i = 0; i < numof; i++) {
+        printf(" %" PRIu32, msgs[i].content.value);
+    }
+    puts("");
+}
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+    msg_t msgs[BULK_NUMOF];
+
+    msg_init_queue(_recv_queue, QUEUE_SIZE);
+    while (1) {
+        _print_msgs("receiver", msgs, msg_receive_bulk(msgs, BULK_NUMOF));
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    msg_t msgs[QUEUE_SIZE + 1];
+    msg_t out[BULK_NUMOF];
+    kernel_pid_t pid;
+
+    puts("main starting");
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    for (unsigned i = 0; i < (QUEUE_SIZE + 1); i++) {
+        msgs[i].type = 0;
+        msgs[i].content.value = i;
+    }
+
+    /* one message more than fits into the queue */
+    printf("sent to self: %d\n",
+           msg_send_bulk(msgs, QUEUE_SIZE + 1, thread_getpid()));
+    _print_msgs("main", out, msg_try_receive_bulk(out, BULK_NUMOF));
+    _print_msgs("main", out, msg_try_receive_bulk(out, BULK_NUMOF));
+    _print_msgs("main", out, msg_try_receive_bulk(out, BULK_NUMOF));
+
+    /* receiver has a higher priority and is blocked in msg_receive_bulk() */
+    pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                        THREAD_CREATE_STACKTEST, _receiver, NULL, "receiver");
+    printf("sent to receiver: %d\n", msg_send_bulk(msgs, 6, pid));
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact('main starting')
+    child.expect_exact('sent to self: 8')
+    child.expect_exact('main: got 4: 0 1 2 3')
+    child.expect_exact('main: got 4: 4 5 6 7')
+    child.expect_exact('main: got 0:')
+    child.expect_exact('receiver: got 1: 0')
+    child.expect_exact('receiver: got 4: 1 2 3 4')
+    child.expect_exact('receiver: got 1: 5')
+    child.expect_exact('sent to receiver: 6')
+    child.expect_exact('SUCCESS')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
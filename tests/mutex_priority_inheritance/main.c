@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for mutex priority inheritance with nested
+ *              mutexes
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+
+#define PRIO_BASE       (THREAD_PRIORITY_MAIN)
+#define PRIO_WAITER_A   (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_WAITER_B   (THREAD_PRIORITY_MAIN - 3)
+
+static char stack_a[THREAD_STACKSIZE_MAIN];
+static char stack_b[THREAD_STACKSIZE_MAIN];
+
+static mutex_t mutex_a = MUTEX_INIT;
+static mutex_t mutex_b = MUTEX_INIT;
+
+static unsigned failures;
+
+static void *waiter(void *arg)
+{
+    mutex_t *mutex = arg;
+
+    mutex_lock(mutex);
+    printf("waiter %c (prio %u): got mutex\n", (mutex == &mutex_a) ? 'A' : 'B',
+           (unsigned)((thread_t *)sched_active_thread)->priority);
+    mutex_unlock(mutex);
+    return NULL;
+}
+
+static void start_waiter(char *stack, char prio, mutex_t *mutex)
+{
+    thread_create(stack, THREAD_STACKSIZE_MAIN, prio, THREAD_CREATE_STACKTEST,
+                  waiter, mutex, "waiter");
+}
+
+static void check(const char *step, unsigned expected)
+{
+    unsigned prio = ((thread_t *)sched_active_thread)->priority;
+
+    printf("%s: prio %u, expected %u\n", step, prio, expected);
+    if (prio != expected) {
+        failures++;
+    }
+}
+
+int main(void)
+{
+    puts("Test for priority inheritance with nested mutexes\n");
+
+    /* boosted through A, then locking B, unlocking A before B */
+    mutex_lock(&mutex_a);
+    start_waiter(stack_a, PRIO_WAITER_A, &mutex_a);
+    check("1: waiter on A", PRIO_WAITER_A);
+    mutex_lock(&mutex_b);
+    check("1: locked B", PRIO_WAITER_A);
+    mutex_unlock(&mutex_a);
+    check("1: unlocked A", PRIO_BASE);
+    mutex_unlock(&mutex_b);
+    check("1: unlocked B", PRIO_BASE);
+
+    /* waiters on both, the outer one with the higher priority */
+    mutex_lock(&mutex_a);
+    start_waiter(stack_a, PRIO_WAITER_A, &mutex_a);
+    mutex_lock(&mutex_b);
+    start_waiter(stack_b, PRIO_WAITER_B, &mutex_b);
+    check("2: waiters on A and B", PRIO_WAITER_B);
+    mutex_unlock(&mutex_a);
+    check("2: unlocked A", PRIO_WAITER_B);
+    mutex_unlock(&mutex_b);
+    check("2: unlocked B", PRIO_BASE);
+
+    /* waiters on both, the inner one with the higher priority */
+    mutex_lock(&mutex_a);
+    mutex_lock(&mutex_b);
+    start_waiter(stack_b, PRIO_WAITER_B, &mutex_b);
+    start_waiter(stack_a, PRIO_WAITER_A, &mutex_a);
+    check("3: waiters on A and B", PRIO_WAITER_B);
+    mutex_unlock(&mutex_b);
+    check("3: unlocked B", PRIO_WAITER_A);
+    mutex_unlock(&mutex_a);
+    check("3: unlocked A", PRIO_BASE);
+
+    puts(failures ? "FAILURE" : "SUCCESS");
+    return 0;
+}
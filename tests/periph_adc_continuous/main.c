@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for continuous ADC sampling
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "irq.h"
+#include "xtimer.h"
+#include "timex.h"
+#include "periph/adc.h"
+
+#define LINE            ADC_LINE(0)
+#define RES             ADC_RES_12BIT
+#define RATE            (10000UL)       /* 10 kHz */
+#define SAMPLES         (250U)          /* samples per half buffer */
+#define DELAY           (1LU * US_PER_SEC)
+
+static int16_t buf[2 * SAMPLES];
+
+static struct {
+    unsigned count;
+    int16_t min;
+    int16_t max;
+    int32_t sum;
+} stats;
+
+static void _cb(void *arg, int16_t *samples, size_t len)
+{
+    (void)arg;
+    int16_t min = samples[0];
+    int16_t max = samples[0];
+    int32_t sum = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        if (samples[i] < min) {
+            min = samples[i];
+        }
+        if (samples[i] > max) {
+            max = samples[i];
+        }
+        sum += samples[i];
+    }
+    stats.count++;
+    stats.min = min;
+    stats.max = max;
+    stats.sum = sum;
+}
+
+int main(void)
+{
+    xtimer_ticks32_t last = xtimer_now();
+
+    puts("\nRIOT continuous ADC sampling test\n");
+
+    if (adc_init(LINE) < 0) {
+        puts("Initialization of ADC_LINE(0) failed");
+        return 1;
+    }
+    if (adc_continuous_start(LINE, RES, RATE, buf, SAMPLES, _cb, NULL) < 0) {
+        puts("Continuous sampling not applicable");
+        return 1;
+    }
+
+    while (1) {
+        xtimer_periodic_wakeup(&last, DELAY);
+
+        unsigned state = irq_disable();
+        unsigned count = stats.count;
+        int min = stats.min;
+        int max = stats.max;
+        int mean = (int)(stats.sum / (int32_t)SAMPLES);
+        irq_restore(state);
+
+        printf("buffers: %u, min: %i, mean: %i, max: %i\n",
+               count, min, mean, max);
+    }
+
+    return 0;
+}
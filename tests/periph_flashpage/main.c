@@ -25,6 +25,7 @@
 
 #include "shell.h"
 #include "periph/flashpage.h"
+#include "flashpage_stream.h"
 
 #define LINE_LEN            (16)
 
@@ -345,6 +346,41 @@ static int cmd_test_last_raw(int argc, char **argv)
 }
 #endif
 
+/**
+ * @brief   Writes the test pattern to the last page available in small,
+ *          unaligned chunks through the stream and verifies it
+ */
+static int cmd_test_stream(int argc, char **argv)
+{
+    (void) argc;
+    (void) argv;
+    static flashpage_stream_t stream;
+    int page = (int)FLASHPAGE_NUMOF - 2;
+    char fill = 'a';
+
+    for (unsigned i = 0; i < sizeof(page_mem); i++) {
+        page_mem[i] = (uint8_t)fill++;
+        if (fill > 'z') {
+            fill = 'a';
+        }
+    }
+
+    flashpage_stream_init(&stream, page);
+    for (unsigned pos = 0; pos < sizeof(page_mem); pos += 7) {
+        size_t len = sizeof(page_mem) - pos;
+        flashpage_stream_write(&stream, &page_mem[pos], (len < 7) ? len : 7);
+    }
+    flashpage_stream_flush(&stream);
+
+    if (flashpage_verify(page, page_mem) != FLASHPAGE_OK) {
+        puts("error verifying the content of last page");
+        return 1;
+    }
+
+    puts("wrote stream to last flash page");
+    return 0;
+}
+
 static const shell_command_t shell_commands[] = {
     { "info", "Show information about pages", cmd_info },
     { "dump", "Dump the selected page to STDOUT", cmd_dump },
@@ -358,6 +394,7 @@ static const shell_command_t shell_commands[] = {
     { "edit", "Write bytes to the local page buffer", cmd_edit },
     { "test", "Write and verify test pattern", cmd_test },
     { "test_last", "Write and verify test pattern on last page available", cmd_test_last },
+    { "test_stream", "Write and verify test pattern in chunks on last page available", cmd_test_stream },
 #ifdef MODULE_PERIPH_FLASHPAGE_RAW
     { "test_last_raw", "Write and verify raw short write on last page available", cmd_test_last_raw },
 #endif
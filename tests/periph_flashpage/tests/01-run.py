@@ -16,6 +16,11 @@ def testfunc(child):
     child.expect_exact('wrote local page buffer to last flash page')
     child.expect('>')
 
+    # writes the same pattern in small chunks through flashpage_stream
+    child.sendline("test_stream")
+    child.expect_exact('wrote stream to last flash page')
+    child.expect('>')
+
     # check if board has raw write capability and if so test that as well
     # capability is deduced from help contents
     child.sendline("help")
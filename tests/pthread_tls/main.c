@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <stdio.h>
 #include "pthread.h"
 
@@ -129,6 +130,12 @@ void *run(void *parameter)
     void* test_7_val = pthread_getspecific(new_key);
     printf("test_7_val: %p\n", test_7_val);
 
+    puts("");
+    puts("-= TEST 8 - set value of deleted key =-");
+    pthread_key_delete(new_key);
+    printf("try to set returns EINVAL: %s\n",
+           (pthread_setspecific(new_key, &new_val) == EINVAL) ? "yes" : "no");
+
 
     return NULL;
 }
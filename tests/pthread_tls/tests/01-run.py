@@ -31,6 +31,8 @@ def testfunc(child):
     child.expect('-= TEST 7 - add key without tls =-')
     child.expect('created key: \d+')
     child.expect('test_7_val: (0|\(nil\))')
+    child.expect('-= TEST 8 - set value of deleted key =-')
+    child.expect('try to set returns EINVAL: yes')
     child.expect('tls tests finished.')
     child.expect('SUCCESS')
 
@@ -17,8 +17,10 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "riotboot/hdr.h"
+#include "riotboot/verify.h"
 #include "embUnit.h"
 
 const riotboot_hdr_t riotboot_hdr_good = {
@@ -70,6 +72,69 @@ static void test_riotboot_hdr_04(void)
     TEST_ASSERT_EQUAL_INT(0x02eda672, chksum);
 }
 
+static const char img[] = "Lorem ipsum dolor sit amet, consectetur adipiscing";
+
+static struct {
+    riotboot_hdr_t hdr;
+    riotboot_digest_t digest;
+} slot;
+
+static void _init_slot(void)
+{
+    slot.hdr.magic_number = RIOTBOOT_MAGIC;
+    slot.hdr.start_addr = (uint32_t)(uintptr_t)img;
+    slot.hdr.chksum = riotboot_hdr_checksum(&slot.hdr);
+    slot.digest.magic_number = RIOTBOOT_DIGEST_MAGIC;
+    slot.digest.img_len = sizeof(img);
+    sha256(img, sizeof(img), slot.digest.sha256);
+}
+
+static size_t chunk_bytes;
+
+static int _chunk_cb(void *arg, uint8_t *chunk, size_t len, size_t offset)
+{
+    TEST_ASSERT(memcmp(img + offset, chunk, len) == 0);
+    TEST_ASSERT(len <= 7);
+    chunk_bytes += len;
+    return (arg == NULL) ? 0 : -1;
+}
+
+static void test_riotboot_verify_01(void)
+{
+    _init_slot();
+    TEST_ASSERT_EQUAL_INT(0, riotboot_verify(&slot.hdr, NULL, 0, NULL, NULL));
+}
+
+static void test_riotboot_verify_02(void)
+{
+    uint8_t buf[7];
+
+    _init_slot();
+    chunk_bytes = 0;
+    TEST_ASSERT_EQUAL_INT(0, riotboot_verify(&slot.hdr, buf, sizeof(buf),
+                                             _chunk_cb, NULL));
+    TEST_ASSERT_EQUAL_INT(sizeof(img), chunk_bytes);
+
+    /* callback aborts */
+    TEST_ASSERT_EQUAL_INT(-1, riotboot_verify(&slot.hdr, buf, sizeof(buf),
+                                              _chunk_cb, buf));
+}
+
+static void test_riotboot_verify_03(void)
+{
+    _init_slot();
+    slot.digest.sha256[0] ^= 1;
+    TEST_ASSERT_EQUAL_INT(-1, riotboot_verify(&slot.hdr, NULL, 0, NULL, NULL));
+
+    _init_slot();
+    slot.digest.img_len--;
+    TEST_ASSERT_EQUAL_INT(-1, riotboot_verify(&slot.hdr, NULL, 0, NULL, NULL));
+
+    _init_slot();
+    slot.digest.magic_number = 0;
+    TEST_ASSERT_EQUAL_INT(-1, riotboot_verify(&slot.hdr, NULL, 0, NULL, NULL));
+}
+
 Test *tests_riotboot_hdr(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -77,6 +142,9 @@ Test *tests_riotboot_hdr(void)
         new_TestFixture(test_riotboot_hdr_02),
         new_TestFixture(test_riotboot_hdr_03),
         new_TestFixture(test_riotboot_hdr_04),
+        new_TestFixture(test_riotboot_verify_01),
+        new_TestFixture(test_riotboot_verify_02),
+        new_TestFixture(test_riotboot_verify_03),
     };
 
     EMB_UNIT_TESTCALLER(riotboot_hdr_tests, NULL, NULL, fixtures);
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "arena.h"
+
+#include "tests-arena.h"
+
+#define BUF_SIZE    (64U)
+
+static uint64_t _buf[BUF_SIZE / sizeof(uint64_t)];
+static arena_t _arena;
+
+static void set_up(void)
+{
+    arena_init(&_arena, _buf, sizeof(_buf));
+}
+
+static void tear_down(void)
+{
+    arena_reset(&_arena);
+}
+
+static void test_arena_alloc_aligned(void)
+{
+    uint8_t *a = arena_alloc(&_arena, 1);
+    uint8_t *b = arena_alloc(&_arena, 3);
+
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)b % ARENA_ALIGNMENT);
+    TEST_ASSERT(b >= a + 1);
+    TEST_ASSERT_NULL(arena_alloc(&_arena, 0));
+}
+
+static void test_arena_exhausted(void)
+{
+    TEST_ASSERT_NOT_NULL(arena_alloc(&_arena, BUF_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, arena_available(&_arena));
+    TEST_ASSERT_NULL(arena_alloc(&_arena, 1));
+}
+
+static void test_arena_reset(void)
+{
+    void *first = arena_alloc(&_arena, BUF_SIZE / 2);
+
+    arena_alloc(&_arena, BUF_SIZE / 2);
+    arena_reset(&_arena);
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE, arena_available(&_arena));
+    TEST_ASSERT(first == arena_alloc(&_arena, 1));
+}
+
+static void test_arena_calloc(void)
+{
+    memset(_buf, 0xff, sizeof(_buf));
+
+    uint32_t *array = arena_calloc(&_arena, 4, sizeof(uint32_t));
+
+    TEST_ASSERT_NOT_NULL(array);
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, array[i]);
+    }
+    TEST_ASSERT_NULL(arena_calloc(&_arena, SIZE_MAX / 2, 4));
+}
+
+static void test_arena_chaining(void)
+{
+    arena_set_chaining(&_arena, BUF_SIZE);
+
+    uint8_t *a = arena_alloc(&_arena, BUF_SIZE - 8);
+    uint8_t *b = arena_alloc(&_arena, 16);
+    uint8_t *c = arena_alloc(&_arena, 4 * BUF_SIZE);
+
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_NOT_NULL(c);
+    /* b and c don't fit the buffer anymore */
+    TEST_ASSERT((b < (uint8_t *)_buf) || (b >= (uint8_t *)_buf + BUF_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)b % ARENA_ALIGNMENT);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)c % ARENA_ALIGNMENT);
+    memset(c, 0, 4 * BUF_SIZE);
+
+    arena_reset(&_arena);
+    TEST_ASSERT_NULL(_arena.chunks);
+    TEST_ASSERT(a == arena_alloc(&_arena, 1));
+}
+
+Test *tests_arena_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_arena_alloc_aligned),
+        new_TestFixture(test_arena_exhausted),
+        new_TestFixture(test_arena_reset),
+        new_TestFixture(test_arena_calloc),
+        new_TestFixture(test_arena_chaining),
+    };
+
+    EMB_UNIT_TESTCALLER(arena_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&arena_tests;
+}
+
+void tests_arena(void)
+{
+    TESTS_RUN(tests_arena_tests());
+}
+/** @} */
@@ -383,6 +383,74 @@ static void test_base64_09_encode_size_determination(void)
     TEST_ASSERT_EQUAL_INT(required_out_size, expected_out_size);
 }
 
+static void test_base64_10_encode_url(void)
+{
+    static const unsigned char data[] = { 0xfb, 0xff, 0xbf, 0x3e };
+    unsigned char out[8];
+    unsigned char decoded[6];
+    size_t out_size = sizeof(out);
+    size_t decoded_size = sizeof(decoded);
+
+    int ret = base64url_encode(data, sizeof(data), out, &out_size);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS, ret);
+    TEST_ASSERT_EQUAL_INT(sizeof(out), out_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "-_-_Pg==", out_size));
+
+    /* the decoder accepts both alphabets */
+    ret = base64_decode(out, out_size, decoded, &decoded_size);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS, ret);
+    TEST_ASSERT_EQUAL_INT(sizeof(data), decoded_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, decoded, decoded_size));
+
+    out_size = sizeof(out);
+    ret = base64_encode(data, sizeof(data), out, &out_size);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS, ret);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "+/+/Pg==", out_size));
+}
+
+static void test_base64_11_stream_encoder(void)
+{
+    static const char data[] = "This is a streamed base64 test";
+    enum { encoded_size = 4 * ((sizeof(data) - 1 + 2) / 3) };
+    unsigned char expected[encoded_size];
+    unsigned char out[encoded_size];
+    size_t expected_size = sizeof(expected);
+    base64_stream_t stream;
+
+    int ret = base64_encode(data, sizeof(data) - 1, expected, &expected_size);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS, ret);
+
+    /* chunks of every size must give the same result as a single call */
+    for (size_t chunk = 1; chunk < sizeof(data); chunk++) {
+        size_t pos = 0;
+        size_t len = 0;
+        base64_stream_init(&stream, false);
+        while (pos < sizeof(data) - 1) {
+            size_t n = sizeof(data) - 1 - pos;
+            if (n > chunk) {
+                n = chunk;
+            }
+            len += base64_stream_encode(&stream, &data[pos], n, &out[len]);
+            pos += n;
+        }
+        len += base64_stream_finish(&stream, &out[len]);
+        TEST_ASSERT_EQUAL_INT(expected_size, len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected, out, len));
+    }
+}
+
+static void test_base64_12_decode_whitespace(void)
+{
+    static const unsigned char encoded[] = "SGVs\r\nbG8g V29y\nbGQ=";
+    unsigned char out[sizeof(encoded)];
+    size_t out_size = sizeof(out);
+
+    int ret = base64_decode(encoded, sizeof(encoded) - 1, out, &out_size);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS, ret);
+    TEST_ASSERT_EQUAL_INT(11, out_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "Hello World", out_size));
+}
+
 Test *tests_base64_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -395,6 +463,9 @@ Test *tests_base64_tests(void)
         new_TestFixture(test_base64_07_stream_decode),
         new_TestFixture(test_base64_08_encode_16_bytes),
         new_TestFixture(test_base64_09_encode_size_determination),
+        new_TestFixture(test_base64_10_encode_url),
+        new_TestFixture(test_base64_11_stream_encoder),
+        new_TestFixture(test_base64_12_decode_whitespace),
     };
 
     EMB_UNIT_TESTCALLER(base64_tests, NULL, NULL, fixtures);
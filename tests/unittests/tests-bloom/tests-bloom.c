@@ -22,6 +22,8 @@
 #define TESTS_BLOOM_PROB_IN_FILTER (4)
 #define TESTS_BLOOM_NOT_IN_FILTER (996)
 #define TESTS_BLOOM_FALSE_POS_RATE_THR (0.005)
+#define TESTS_BLOOM_BLOCKED_BLOCKS (16)
+#define TESTS_BLOOM_BLOCKED_K (4)
 
 static bloom_t bloom;
 BITFIELD(bf, TESTS_BLOOM_BITS);
@@ -85,11 +87,39 @@ static void test_bloom_based_on_dictionary_fixture(void)
     TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR);
 }
 
+static void test_bloom_blocked_based_on_dictionary_fixture(void)
+{
+    bloom_blocked_t blocked;
+    uint32_t blocks[TESTS_BLOOM_BLOCKED_BLOCKS];
+    int in = 0;
+
+    bloom_blocked_init(&blocked, blocks, TESTS_BLOOM_BLOCKED_BLOCKS,
+                       TESTS_BLOOM_BLOCKED_K, (hashfp_t) one_at_a_time_hash);
+
+    for (int i = 0; i < lenB; i++) {
+        bloom_blocked_add(&blocked, (const uint8_t *) B[i], strlen(B[i]));
+    }
+    /* no false negatives */
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_blocked_check(&blocked, (const uint8_t *) B[i],
+                                        strlen(B[i])));
+    }
+
+    for (int i = 0; i < lenA; i++) {
+        if (bloom_blocked_check(&blocked, (const uint8_t *) A[i],
+                                strlen(A[i]))) {
+            in++;
+        }
+    }
+    TEST_ASSERT(((double) in / (double) lenA) < TESTS_BLOOM_FALSE_POS_RATE_THR);
+}
+
 Test *tests_bloom_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_bloom_parameters_bytes_hashf),
         new_TestFixture(test_bloom_based_on_dictionary_fixture),
+        new_TestFixture(test_bloom_blocked_based_on_dictionary_fixture),
     };
 
     EMB_UNIT_TESTCALLER(bloom_tests, set_up_bloom, tear_down_bloom, fixtures);
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "net/bluetil/ad.h"
+
+#include "tests-bluetil_ad.h"
+
+static uint8_t _buf[31];
+static bluetil_ad_t _ad;
+static bluetil_ad_index_t _idx;
+
+static const uint8_t _uuids[] = { 0x0f, 0x18, 0x0d, 0x18 };
+static const uint8_t _manuf[] = { 0x59, 0x00, 0x01, 0x02 };
+
+static void set_up(void)
+{
+    bluetil_ad_init_with_flags(&_ad, _buf, sizeof(_buf),
+                               BLUETIL_AD_FLAGS_DEFAULT);
+    bluetil_ad_add(&_ad, BLE_GAP_AD_UUID16_COMP, _uuids, sizeof(_uuids));
+    bluetil_ad_add(&_ad, BLE_GAP_AD_VENDOR, _manuf, sizeof(_manuf));
+    bluetil_ad_add_name(&_ad, "RIOT");
+}
+
+static void test_bluetil_ad_index(void)
+{
+    bluetil_ad_data_t data;
+
+    TEST_ASSERT_EQUAL_INT(4, bluetil_ad_index(&_ad, &_idx));
+    TEST_ASSERT_EQUAL_INT(BLUETIL_AD_OK,
+                          bluetil_ad_index_find(&_idx, BLE_GAP_AD_NAME, &data));
+    TEST_ASSERT_EQUAL_INT(4, data.len);
+    TEST_ASSERT(memcmp(data.data, "RIOT", 4) == 0);
+    TEST_ASSERT_EQUAL_INT(BLUETIL_AD_NOTFOUND,
+                          bluetil_ad_index_find(&_idx, BLE_GAP_AD_NAME_SHORT,
+                                                &data));
+}
+
+static void test_bluetil_ad_index_truncated(void)
+{
+    bluetil_ad_data_t data;
+
+    /* cut off the last byte of the name */
+    _ad.pos--;
+    TEST_ASSERT_EQUAL_INT(BLUETIL_AD_INVALID, bluetil_ad_index(&_ad, &_idx));
+    TEST_ASSERT_EQUAL_INT(3, _idx.numof);
+    TEST_ASSERT_EQUAL_INT(BLUETIL_AD_NOTFOUND,
+                          bluetil_ad_find(&_ad, BLE_GAP_AD_NAME, &data));
+}
+
+static void test_bluetil_ad_index_match(void)
+{
+    static const uint8_t uuid[] = { 0x0d, 0x18 };
+    static const uint8_t company[] = { 0x59, 0x00 };
+    static const uint8_t other[] = { 0x4c, 0x00 };
+    bluetil_ad_filter_t filters[] = {
+        { .type = BLE_GAP_AD_UUID16_COMP, .data = uuid, .len = sizeof(uuid) },
+        { .type = BLE_GAP_AD_VENDOR, .data = company, .len = sizeof(company) },
+        { .type = BLE_GAP_AD_NAME },
+    };
+
+    bluetil_ad_index(&_ad, &_idx);
+    TEST_ASSERT(bluetil_ad_index_match(&_idx, filters, 3));
+
+    /* vendor data only matches at its start */
+    filters[1].data = &_manuf[2];
+    TEST_ASSERT(!bluetil_ad_index_match(&_idx, filters, 3));
+    filters[1].data = other;
+    TEST_ASSERT(!bluetil_ad_index_match(&_idx, filters, 3));
+
+    filters[0].type = BLE_GAP_AD_NAME_SHORT;
+    TEST_ASSERT(!bluetil_ad_index_match(&_idx, filters, 1));
+}
+
+Test *tests_bluetil_ad_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_bluetil_ad_index),
+        new_TestFixture(test_bluetil_ad_index_truncated),
+        new_TestFixture(test_bluetil_ad_index_match),
+    };
+
+    EMB_UNIT_TESTCALLER(bluetil_ad_tests, set_up, NULL, fixtures);
+
+    return (Test *)&bluetil_ad_tests;
+}
+
+void tests_bluetil_ad(void)
+{
+    TESTS_RUN(tests_bluetil_ad_tests());
+}
+/** @} */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdint.h>
+
+#include "embUnit/embUnit.h"
+
+#include "checksum/crc8.h"
+
+#include "tests-checksum.h"
+
+static void test_checksum_crc8_sequence_empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(0xff, crc8(NULL, 0, 0x31, 0xff));
+}
+
+static void test_checksum_crc8_sequence_1to9(void)
+{
+    const uint8_t buf[] = "123456789";
+
+    /* CRC-8/SMBUS */
+    TEST_ASSERT_EQUAL_INT(0xf4, crc8(buf, sizeof(buf) - 1, 0x07, 0x00));
+    /* CRC-8/NRSC-5 */
+    TEST_ASSERT_EQUAL_INT(0xf7, crc8(buf, sizeof(buf) - 1, 0x31, 0xff));
+}
+
+static void test_checksum_crc8_sensirion(void)
+{
+    /* example from the Sensirion SHT3x datasheet, section 4.12 */
+    const uint8_t buf[] = { 0xbe, 0xef };
+
+    TEST_ASSERT_EQUAL_INT(0x92, crc8(buf, sizeof(buf), 0x31, 0xff));
+}
+
+Test *tests_checksum_crc8_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_checksum_crc8_sequence_empty),
+        new_TestFixture(test_checksum_crc8_sequence_1to9),
+        new_TestFixture(test_checksum_crc8_sensirion),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc8_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc8_tests;
+}
@@ -10,7 +10,9 @@
 
 void tests_checksum(void)
 {
+    TESTS_RUN(tests_checksum_crc8_tests());
     TESTS_RUN(tests_checksum_crc16_ccitt_tests());
+    TESTS_RUN(tests_checksum_crc32_tests());
     TESTS_RUN(tests_checksum_fletcher16_tests());
     TESTS_RUN(tests_checksum_fletcher32_tests());
     TESTS_RUN(tests_checksum_ucrc16_tests());
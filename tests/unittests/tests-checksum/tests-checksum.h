@@ -29,6 +29,13 @@ extern "C" {
  */
 void tests_checksum(void);
 
+/**
+ * @brief   Generates tests for checksum/crc8.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_checksum_crc8_tests(void);
+
 /**
  * @brief   Generates tests for checksum/crc16_ccitt.h
  *
@@ -36,6 +43,13 @@ void tests_checksum(void);
  */
 Test *tests_checksum_crc16_ccitt_tests(void);
 
+/**
+ * @brief   Generates tests for checksum/crc32.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_checksum_crc32_tests(void);
+
 /**
  * @brief   Generates tests for checksum/fletcher16.h
  *
@@ -253,6 +253,124 @@ static void test_crypto_modes_ccm_check_len(void)
     TEST_ASSERT_EQUAL_INT(-1, ret);
 }
 
+/* Test incremental operation against the vectors, split at every offset */
+static void test_crypto_modes_ccm_streaming(void)
+{
+    cipher_t cipher;
+    ccm_ctx_t ctx;
+    uint8_t mac[8];
+    size_t len_encoding = nonce_and_len_encoding_size - TEST_2_NONCE_LEN;
+    const uint8_t *plain = TEST_2_INPUT + TEST_2_ADATA_LEN;
+    const uint8_t *expected = TEST_2_EXPECTED + TEST_2_ADATA_LEN;
+    size_t plain_len = TEST_2_INPUT_LEN;
+
+    cipher_init(&cipher, CIPHER_AES_128, TEST_2_KEY, TEST_2_KEY_LEN);
+
+    for (size_t split = 0; split <= plain_len; split++) {
+        TEST_ASSERT_EQUAL_INT(0, cipher_init_ccm(&ctx, &cipher, TEST_2_MAC_LEN,
+                                                 len_encoding, TEST_2_NONCE,
+                                                 TEST_2_NONCE_LEN,
+                                                 TEST_2_ADATA_LEN, plain_len));
+        TEST_ASSERT_EQUAL_INT(0, cipher_update_ccm_aad(&ctx, TEST_2_INPUT, 3));
+        TEST_ASSERT_EQUAL_INT(0, cipher_update_ccm_aad(&ctx, TEST_2_INPUT + 3,
+                                                       TEST_2_ADATA_LEN - 3));
+        TEST_ASSERT_EQUAL_INT(0, cipher_encrypt_ccm_update(&ctx, plain, split,
+                                                           data));
+        TEST_ASSERT_EQUAL_INT(0, cipher_encrypt_ccm_update(&ctx, plain + split,
+                                                           plain_len - split,
+                                                           data + split));
+        TEST_ASSERT_EQUAL_INT(0, cipher_encrypt_ccm_finish(&ctx, mac));
+        TEST_ASSERT_EQUAL_INT(1, compare(expected, data, plain_len));
+        TEST_ASSERT_EQUAL_INT(1, compare(expected + plain_len, mac,
+                                         TEST_2_MAC_LEN));
+
+        /* decrypt in place */
+        cipher_init_ccm(&ctx, &cipher, TEST_2_MAC_LEN, len_encoding,
+                        TEST_2_NONCE, TEST_2_NONCE_LEN, TEST_2_ADATA_LEN,
+                        plain_len);
+        cipher_update_ccm_aad(&ctx, TEST_2_INPUT, TEST_2_ADATA_LEN);
+        cipher_decrypt_ccm_update(&ctx, data, split, data);
+        cipher_decrypt_ccm_update(&ctx, data + split, plain_len - split,
+                                  data + split);
+        TEST_ASSERT_EQUAL_INT(0, cipher_decrypt_ccm_finish(&ctx, mac));
+        TEST_ASSERT_EQUAL_INT(1, compare(plain, data, plain_len));
+    }
+
+    /* more data than announced */
+    cipher_init_ccm(&ctx, &cipher, TEST_2_MAC_LEN, len_encoding, TEST_2_NONCE,
+                    TEST_2_NONCE_LEN, TEST_2_ADATA_LEN, plain_len);
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_update_ccm_aad(&ctx, TEST_2_INPUT,
+                                                TEST_2_ADATA_LEN + 1));
+    /* message before all additional data */
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_encrypt_ccm_update(&ctx, plain, 1, data));
+    /* finish before all data */
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_encrypt_ccm_finish(&ctx, mac));
+}
+
+static void test_crypto_modes_ccm_iolist(void)
+{
+    cipher_t cipher;
+    uint8_t mac[8];
+    size_t len_encoding = nonce_and_len_encoding_size - TEST_1_NONCE_LEN;
+    size_t plain_len = TEST_1_INPUT_LEN;
+    iolist_t tail = { NULL, data + 5, plain_len - 5 };
+    iolist_t head = { &tail, data, 5 };
+
+    cipher_init(&cipher, CIPHER_AES_128, TEST_1_KEY, TEST_1_KEY_LEN);
+    memcpy(data, TEST_1_INPUT + TEST_1_ADATA_LEN, plain_len);
+
+    TEST_ASSERT_EQUAL_INT(plain_len,
+                          cipher_encrypt_ccm_iolist(&cipher, TEST_1_INPUT,
+                                                    TEST_1_ADATA_LEN,
+                                                    TEST_1_MAC_LEN, len_encoding,
+                                                    TEST_1_NONCE, TEST_1_NONCE_LEN,
+                                                    &head, mac));
+    TEST_ASSERT_EQUAL_INT(1, compare(TEST_1_EXPECTED + TEST_1_ADATA_LEN, data,
+                                     plain_len));
+    TEST_ASSERT_EQUAL_INT(1, compare(TEST_1_EXPECTED + TEST_1_ADATA_LEN +
+                                     plain_len, mac, TEST_1_MAC_LEN));
+
+    TEST_ASSERT_EQUAL_INT(plain_len,
+                          cipher_decrypt_ccm_iolist(&cipher, TEST_1_INPUT,
+                                                    TEST_1_ADATA_LEN,
+                                                    TEST_1_MAC_LEN, len_encoding,
+                                                    TEST_1_NONCE, TEST_1_NONCE_LEN,
+                                                    &head, mac));
+    TEST_ASSERT_EQUAL_INT(1, compare(TEST_1_INPUT + TEST_1_ADATA_LEN, data,
+                                     plain_len));
+}
+
+/* Additional data longer than a block used to overflow an internal buffer */
+static void test_crypto_modes_ccm_long_adata(void)
+{
+    cipher_t cipher;
+    uint8_t adata[40], plain[4] = { 1, 2, 3, 4 };
+    int len;
+
+    for (unsigned i = 0; i < sizeof(adata); i++) {
+        adata[i] = i;
+    }
+    cipher_init(&cipher, CIPHER_AES_128, TEST_1_KEY, TEST_1_KEY_LEN);
+    len = cipher_encrypt_ccm(&cipher, adata, sizeof(adata), 8, 2,
+                             TEST_1_NONCE, TEST_1_NONCE_LEN,
+                             plain, sizeof(plain), data);
+    TEST_ASSERT_EQUAL_INT(sizeof(plain) + 8, len);
+    TEST_ASSERT_EQUAL_INT(sizeof(plain),
+                          cipher_decrypt_ccm(&cipher, adata, sizeof(adata), 8, 2,
+                                             TEST_1_NONCE, TEST_1_NONCE_LEN,
+                                             data, len, data + 20));
+    TEST_ASSERT_EQUAL_INT(1, compare(plain, data + 20, sizeof(plain)));
+
+    adata[30] ^= 1;
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_CBC_MAC,
+                          cipher_decrypt_ccm(&cipher, adata, sizeof(adata), 8, 2,
+                                             TEST_1_NONCE, TEST_1_NONCE_LEN,
+                                             data, len, data + 20));
+}
+
 
 Test* tests_crypto_modes_ccm_tests(void)
 {
@@ -260,6 +378,9 @@ Test* tests_crypto_modes_ccm_tests(void)
         new_TestFixture(test_crypto_modes_ccm_encrypt),
         new_TestFixture(test_crypto_modes_ccm_decrypt),
         new_TestFixture(test_crypto_modes_ccm_check_len),
+        new_TestFixture(test_crypto_modes_ccm_streaming),
+        new_TestFixture(test_crypto_modes_ccm_iolist),
+        new_TestFixture(test_crypto_modes_ccm_long_adata),
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ccm_tests, NULL, NULL, fixtures);
@@ -129,6 +129,42 @@ static void test_div_u64_by_15625div512(void)
     }
 }
 
+static void test_div_u32_by_const(void)
+{
+    for (unsigned i = 0; i < N_U32_VALS; i++) {
+        DEBUG("Dividing %"PRIu32" by constants...\n", u32_test_values[i]);
+        TEST_ASSERT(u32_test_values[i] / 10 ==
+                    div_u32_by_const(u32_test_values[i], 10));
+        TEST_ASSERT(u32_test_values[i] % 10 ==
+                    div_u32_mod_const(u32_test_values[i], 10));
+        TEST_ASSERT(u32_test_values[i] / 7 ==
+                    div_u32_by_const(u32_test_values[i], 7));
+        TEST_ASSERT(u32_test_values[i] / 1000000lu ==
+                    div_u32_by_const(u32_test_values[i], 1000000lu));
+        TEST_ASSERT(u32_test_values[i] / 0xfffffffbul ==
+                    div_u32_by_const(u32_test_values[i], 0xfffffffbul));
+        TEST_ASSERT(u32_test_values[i] / 64 ==
+                    div_u32_by_const(u32_test_values[i], 64));
+    }
+}
+
+static void test_div_u64_by_const(void)
+{
+    for (unsigned i = 0; i < N_U64_VALS; i++) {
+        DEBUG("Dividing %"PRIu64" by constants...\n", u64_test_values[i]);
+        TEST_ASSERT(u64_test_values[i] / 10 ==
+                    div_u64_by_const(u64_test_values[i], 10));
+        TEST_ASSERT(u64_test_values[i] / 7 ==
+                    div_u64_by_const(u64_test_values[i], 7));
+        TEST_ASSERT(u64_test_values[i] / 1000000lu ==
+                    div_u64_by_const(u64_test_values[i], 1000000lu));
+        TEST_ASSERT(u64_test_values[i] / 0xfffffffbul ==
+                    div_u64_by_const(u64_test_values[i], 0xfffffffbul));
+        TEST_ASSERT(u64_test_values[i] / 64 ==
+                    div_u64_by_const(u64_test_values[i], 64));
+    }
+}
+
 Test *tests_div_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -136,6 +172,8 @@ Test *tests_div_tests(void)
         new_TestFixture(test_div_u32_by_15625div512),
         new_TestFixture(test_div_u64_by_15625div512),
         new_TestFixture(test_div_u64_by_1000000),
+        new_TestFixture(test_div_u32_by_const),
+        new_TestFixture(test_div_u64_by_const),
     };
 
     EMB_UNIT_TESTCALLER(div_tests, NULL, NULL, fixtures);
@@ -976,6 +976,103 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing that repeated look-ups follow added and removed routes
+* adding a prefix route, looking it up repeatedly, then adding and removing a
+* more specific route must always return the best fitting next-hop
+*/
+static void test_fib_21_more_specific_prefix(void)
+{
+    size_t add_buf_size = 16;
+    char addr_dst[add_buf_size];
+    char addr_nxt[add_buf_size];
+    char addr_nxt_specific[add_buf_size];
+    char addr_nxt_hop[add_buf_size];
+    char addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    memset(addr_dst, 0, add_buf_size);
+    memset(addr_nxt_hop, 0, add_buf_size);
+    memset(addr_lookup, 0, add_buf_size);
+
+    /* set the bytes to 0x01..0x10 of the next-hop of the short prefix and
+     * 0x02..0x11 of the next-hop of the more specific prefix */
+    for(size_t i = 0; i < add_buf_size; i++) {
+        addr_nxt[i] = i+1;
+        addr_nxt_specific[i] = i+2;
+    }
+
+    /* set the bytes to 0x01..0x08 of the destination prefix */
+    for(size_t i = 0; i < add_buf_size/2; i++) {
+        addr_dst[i] = i+1;
+    }
+
+    /* set the bytes to 0x01..0x0e of the lookup address */
+    for(size_t i = 0; i < 14; i++) {
+        addr_lookup[i] = i+1;
+    }
+
+    uint32_t prefix_len = _get_prefix_bits_num(addr_dst, strlen(addr_dst));
+    fib_add_entry(&test_fib_table, 42, (uint8_t *)addr_dst,
+                  add_buf_size, ((prefix_len << FIB_FLAG_NET_PREFIX_SHIFT) | 0x123),
+                  (uint8_t *)addr_nxt, add_buf_size, 0x23,
+                  100000);
+
+    /* look up twice to serve the second look-up from a memoized result */
+    for (unsigned i = 0; i < 2; i++) {
+        add_buf_size = sizeof(addr_nxt_hop);
+        int ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                                   (uint8_t *)addr_nxt_hop, &add_buf_size,
+                                   &next_hop_flags, (uint8_t *)addr_lookup,
+                                   add_buf_size, 0x123);
+
+        TEST_ASSERT_EQUAL_INT(0, ret);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(addr_nxt, addr_nxt_hop, add_buf_size));
+    }
+
+    /* set the bytes to 0x01..0x0d of the more specific destination prefix */
+    for(size_t i = 0; i < 13; i++) {
+        addr_dst[i] = i+1;
+    }
+
+    prefix_len = _get_prefix_bits_num(addr_dst, strlen(addr_dst));
+    fib_add_entry(&test_fib_table, 42, (uint8_t *)addr_dst,
+                  add_buf_size, ((prefix_len << FIB_FLAG_NET_PREFIX_SHIFT) | 0x123),
+                  (uint8_t *)addr_nxt_specific, add_buf_size, 0x24,
+                  100000);
+
+    /* the more specific prefix must be preferred now */
+    int ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                               (uint8_t *)addr_nxt_hop, &add_buf_size,
+                               &next_hop_flags, (uint8_t *)addr_lookup,
+                               add_buf_size, 0x123);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(addr_nxt_specific, addr_nxt_hop, add_buf_size));
+    TEST_ASSERT_EQUAL_INT(0x24, next_hop_flags);
+
+    /* after removing it, the short prefix must be used again */
+    fib_remove_entry(&test_fib_table, (uint8_t *)addr_dst, add_buf_size);
+
+    ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                           (uint8_t *)addr_nxt_hop, &add_buf_size,
+                           &next_hop_flags, (uint8_t *)addr_lookup,
+                           add_buf_size, 0x123);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(addr_nxt, addr_nxt_hop, add_buf_size));
+    TEST_ASSERT_EQUAL_INT(0x23, next_hop_flags);
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_fib_table(&test_fib_table);
+    puts("");
+    universal_address_print_table();
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1097,7 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_more_specific_prefix),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
@@ -492,6 +492,37 @@ static void test_nib_nc_add__success_full_but_garbage_collectible(void)
     }
 }
 
+/*
+ * Creates GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
+ * addresses, sets two of them unreachable, uses the older of those and then
+ * adds another entry.
+ * Expected result: the unused unreachable entry is replaced, even though it
+ * is not the oldest entry
+ */
+static void test_nib_nc_add__success_full_replace_unreachable_lru(void)
+{
+    _nib_onl_entry_t *nodes[GNRC_IPV6_NIB_NUMOF], *node;
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (int i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_nc_add(&addr, IFACE,
+                                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+        addr.u64[1].u64++;
+    }
+    nodes[1]->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+    nodes[1]->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE;
+    nodes[2]->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+    nodes[2]->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE;
+    TEST_ASSERT(nodes[1] == _nib_onl_get(&nodes[1]->ipv6, IFACE));
+    TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                             GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    TEST_ASSERT(nodes[2] == node);
+    TEST_ASSERT(ipv6_addr_equal(&addr, &node->ipv6));
+    TEST_ASSERT(node == _nib_onl_get(&addr, IFACE));
+    TEST_ASSERT(nodes[1] == _nib_onl_get(&nodes[1]->ipv6, IFACE));
+}
+
 /*
  * Creates a neighbor cache entry and sets it reachable
  * Expected result: node->info flags set to NUD_STATE_REACHABLE and NIB's event
@@ -1935,6 +1966,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_nc_add__success_duplicate),
         new_TestFixture(test_nib_nc_add__success),
         new_TestFixture(test_nib_nc_add__success_full_but_garbage_collectible),
+        new_TestFixture(test_nib_nc_add__success_full_replace_unreachable_lru),
         new_TestFixture(test_nib_nc_remove__uncleared),
         new_TestFixture(test_nib_nc_remove__cleared),
         new_TestFixture(test_nib_nc_set_reachable__success),
@@ -14,6 +14,7 @@
  * @author Cenk Gündoğan <mail@cgundogan.de>
  * @author Martine Lenders <m.lenders@fu-berlin.de>
  */
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 #include "embUnit.h"
@@ -180,6 +181,45 @@ static void test_rpl_srh_nexthop_prefix_elided(void)
     TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &expected2));
 }
 
+static void test_rpl_srh_build(void)
+{
+    static const ipv6_addr_t route[] = { IPV6_ADDR1, IPV6_ADDR2, IPV6_DST };
+    static const ipv6_addr_t expected1 = IPV6_ADDR2, expected2 = IPV6_DST;
+    gnrc_rpl_srh_t *srh = (gnrc_rpl_srh_t *)buf;
+    int res;
+
+    res = gnrc_rpl_srh_build(srh, sizeof(buf), route, 3);
+    /* one octet per address, padded to 8 octets */
+    TEST_ASSERT_EQUAL_INT(sizeof(gnrc_rpl_srh_t) + 8, res);
+    TEST_ASSERT_EQUAL_INT(1, srh->len);
+    TEST_ASSERT_EQUAL_INT(IPV6_EXT_RH_TYPE_RPL_SRH, srh->type);
+    TEST_ASSERT_EQUAL_INT(SRH_SEG_LEFT, srh->seg_left);
+    TEST_ASSERT_EQUAL_INT(0xff, srh->compr);
+    TEST_ASSERT_EQUAL_INT(6 << 4, srh->pad_resv);
+    memcpy(&hdr.dst, &route[0], sizeof(hdr.dst));
+
+    /* first hop */
+    res = gnrc_rpl_srh_process(&hdr, srh);
+    TEST_ASSERT_EQUAL_INT(res, GNRC_IPV6_EXT_RH_FORWARDED);
+    TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &expected1));
+
+    /* second hop */
+    res = gnrc_rpl_srh_process(&hdr, srh);
+    TEST_ASSERT_EQUAL_INT(res, GNRC_IPV6_EXT_RH_FORWARDED);
+    TEST_ASSERT_EQUAL_INT(0, srh->seg_left);
+    TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &expected2));
+}
+
+static void test_rpl_srh_build_no_space(void)
+{
+    static const ipv6_addr_t route[] = { IPV6_ADDR1, IPV6_MCAST_ADDR };
+
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS,
+                          gnrc_rpl_srh_build((gnrc_rpl_srh_t *)buf,
+                                             sizeof(gnrc_rpl_srh_t) + 8,
+                                             route, 2));
+}
+
 static Test *tests_rpl_srh_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -188,6 +228,8 @@ static Test *tests_rpl_srh_tests(void)
         new_TestFixture(test_rpl_srh_too_many_seg_left),
         new_TestFixture(test_rpl_srh_nexthop_no_prefix_elided),
         new_TestFixture(test_rpl_srh_nexthop_prefix_elided),
+        new_TestFixture(test_rpl_srh_build),
+        new_TestFixture(test_rpl_srh_build_no_space),
     };
 
     EMB_UNIT_TESTCALLER(rpl_srh_tests, set_up, NULL, fixtures);
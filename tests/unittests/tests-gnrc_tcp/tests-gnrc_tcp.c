@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp/tcb.h"
+#include "net/tcp.h"
+
+#include "internal/common.h"
+#include "internal/option.h"
+#include "internal/pkt.h"
+#include "internal/rcvbuf.h"
+
+#include "tests-gnrc_tcp.h"
+
+#define SEQ         (1000U)
+#define SEG_LEN     (100U)
+
+static gnrc_tcp_tcb_t tcb;
+static gnrc_tcp_tcb_t other;
+static uint8_t buf[GNRC_TCP_RCV_BUF_SIZE];
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    _rcvbuf_init();
+    memset(&tcb, 0, sizeof(tcb));
+    memset(&other, 0, sizeof(other));
+}
+
+/*
+ * Creates a segment with SEG_LEN bytes of payload. Every payload byte holds the
+ * lower bits of its sequence number.
+ */
+static gnrc_pktsnip_t *_segment(uint32_t seq)
+{
+    gnrc_pktsnip_t *pay, *hdr;
+    tcp_hdr_t *tcp_hdr;
+
+    pay = gnrc_pktbuf_add(NULL, NULL, SEG_LEN, GNRC_NETTYPE_UNDEF);
+    for (unsigned i = 0; i < SEG_LEN; i++) {
+        ((uint8_t *)pay->data)[i] = (uint8_t)(seq + i);
+    }
+    hdr = gnrc_pktbuf_add(pay, NULL, sizeof(tcp_hdr_t), GNRC_NETTYPE_TCP);
+    tcp_hdr = hdr->data;
+    memset(tcp_hdr, 0, sizeof(tcp_hdr_t));
+    tcp_hdr->seq_num = byteorder_htonl(seq);
+    tcp_hdr->off_ctl = byteorder_htons((TCP_HDR_OFFSET_MIN << 12) | MSK_ACK);
+    return hdr;
+}
+
+/*
+ * Holds a segment in the out-of-order queue of tcb and drops the reference of
+ * the caller, like the receive path does.
+ */
+static void _ooo_add(uint32_t seq)
+{
+    gnrc_pktsnip_t *pkt = _segment(seq);
+
+    _pkt_ooo_add(&tcb, pkt);
+    gnrc_pktbuf_release(pkt);
+}
+
+/*
+ * Reads len bytes from the receive buffer of tcb and checks that they are the
+ * stream starting at seq.
+ */
+static void _check_stream(uint32_t seq, size_t len)
+{
+    TEST_ASSERT_EQUAL_INT(len, _rcvbuf_get(&tcb, buf, sizeof(buf)));
+    for (unsigned i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(seq + i), buf[i]);
+    }
+}
+
+static void _check_sack_block(network_uint32_t *opt, unsigned i,
+                              uint32_t left, uint32_t right)
+{
+    TEST_ASSERT_EQUAL_INT(left, byteorder_ntohl(opt[1 + 2 * i]));
+    TEST_ASSERT_EQUAL_INT(right, byteorder_ntohl(opt[2 + 2 * i]));
+}
+
+/*
+ * Fills the retransmission queue of tcb with num segments of SEG_LEN bytes,
+ * starting at SEQ, and enters fast recovery for all of them.
+ */
+static void _setup_recovery(unsigned num)
+{
+    for (unsigned i = 0; i < num; i++) {
+        tcb.pkt_retransmit[i] = _segment(SEQ + i * SEG_LEN);
+    }
+    tcb.pkt_retransmit_num = num;
+    tcb.snd_una = SEQ;
+    tcb.snd_nxt = SEQ + num * SEG_LEN;
+    tcb.recover = tcb.snd_nxt;
+    tcb.high_rxt = tcb.snd_una;
+}
+
+static void _clear_recovery(void)
+{
+    for (unsigned i = 0; i < tcb.pkt_retransmit_num; i++) {
+        gnrc_pktbuf_release(tcb.pkt_retransmit[i]);
+    }
+    tcb.pkt_retransmit_num = 0;
+}
+
+static void test_option_build_sack__empty(void)
+{
+    network_uint32_t opt[1 + 2 * OPTION_SACK_BLOCKS_MAX];
+
+    TEST_ASSERT_EQUAL_INT(0, _option_build_sack(&tcb, opt));
+}
+
+/*
+ * Holds three segments behind a hole, the last one received adjoins the first.
+ * Expected result: a block for the merged segments is reported first, followed
+ * by a block for the separate segment.
+ */
+static void test_option_build_sack__merge(void)
+{
+    network_uint32_t opt[1 + 2 * OPTION_SACK_BLOCKS_MAX];
+
+    _ooo_add(SEQ + SEG_LEN);
+    _ooo_add(SEQ + 4 * SEG_LEN);
+    _ooo_add(SEQ + 2 * SEG_LEN);
+    TEST_ASSERT_EQUAL_INT(5, _option_build_sack(&tcb, opt));
+    TEST_ASSERT_EQUAL_INT(((uint32_t)TCP_OPTION_KIND_NOP << 24) |
+                          ((uint32_t)TCP_OPTION_KIND_NOP << 16) |
+                          ((uint32_t)TCP_OPTION_KIND_SACK << 8) |
+                          (2 + 2 * TCP_OPTION_LENGTH_SACK_BLOCK),
+                          byteorder_ntohl(opt[0]));
+    _check_sack_block(opt, 0, SEQ + SEG_LEN, SEQ + 3 * SEG_LEN);
+    _check_sack_block(opt, 1, SEQ + 4 * SEG_LEN, SEQ + 5 * SEG_LEN);
+    _pkt_ooo_clear(&tcb);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/*
+ * Holds segments behind a hole, then receives the missing segment.
+ * Expected result: the held segments are appended in order and released.
+ */
+static void test_ooo__reassembly(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&tcb));
+    tcb.rcv_nxt = SEQ;
+    _ooo_add(SEQ + 2 * SEG_LEN);
+    _ooo_add(SEQ + SEG_LEN);
+    _pkt_ooo_drain(&tcb);
+    TEST_ASSERT_EQUAL_INT(2, tcb.pkt_ooo_num);
+    TEST_ASSERT_EQUAL_INT(SEQ, tcb.rcv_nxt);
+
+    pkt = _segment(SEQ);
+    _pkt_add_payload(&tcb, pkt, 0);
+    gnrc_pktbuf_release(pkt);
+    _pkt_ooo_drain(&tcb);
+    TEST_ASSERT_EQUAL_INT(0, tcb.pkt_ooo_num);
+    TEST_ASSERT_EQUAL_INT(SEQ + 3 * SEG_LEN, tcb.rcv_nxt);
+    _check_stream(SEQ, 3 * SEG_LEN);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    _rcvbuf_release_buffer(&tcb);
+}
+
+/*
+ * Holds a segment that overlaps the next expected byte and a segment that
+ * was received completely already.
+ * Expected result: only the new bytes are appended, both are released.
+ */
+static void test_ooo__overlap(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&tcb));
+    tcb.rcv_nxt = SEQ;
+    _ooo_add(SEQ + SEG_LEN / 2);
+    _ooo_add(SEQ - SEG_LEN);
+
+    pkt = _segment(SEQ);
+    _pkt_add_payload(&tcb, pkt, 0);
+    gnrc_pktbuf_release(pkt);
+    _pkt_ooo_drain(&tcb);
+    TEST_ASSERT_EQUAL_INT(0, tcb.pkt_ooo_num);
+    TEST_ASSERT_EQUAL_INT(SEQ + SEG_LEN + SEG_LEN / 2, tcb.rcv_nxt);
+    _check_stream(SEQ, SEG_LEN + SEG_LEN / 2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    _rcvbuf_release_buffer(&tcb);
+}
+
+/*
+ * Holds the same segment twice and more segments than the queue can hold.
+ * Expected result: duplicates and segments beyond GNRC_TCP_OOO_QUEUE_SIZE are
+ * dropped.
+ */
+static void test_ooo__duplicate_full(void)
+{
+    _ooo_add(SEQ);
+    _ooo_add(SEQ);
+    TEST_ASSERT_EQUAL_INT(1, tcb.pkt_ooo_num);
+    for (unsigned i = 1; i <= GNRC_TCP_OOO_QUEUE_SIZE; i++) {
+        _ooo_add(SEQ + i * SEG_LEN);
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_OOO_QUEUE_SIZE, tcb.pkt_ooo_num);
+    _pkt_ooo_clear(&tcb);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/*
+ * Enters fast recovery without SACK information.
+ * Expected result: only the oldest segment is retransmitted.
+ */
+static void test_recovery__no_sack(void)
+{
+    _setup_recovery(GNRC_TCP_SND_QUEUE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, _pkt_get_next_lost(&tcb));
+    tcb.high_rxt = SEQ + SEG_LEN;
+    TEST_ASSERT_EQUAL_INT(-1, _pkt_get_next_lost(&tcb));
+    _clear_recovery();
+}
+
+/*
+ * Enters fast recovery, the last segment is selectively acknowledged.
+ * Expected result: every segment in front of it is retransmitted once.
+ */
+static void test_recovery__sack(void)
+{
+    unsigned last = GNRC_TCP_SND_QUEUE_SIZE - 1;
+
+    _setup_recovery(GNRC_TCP_SND_QUEUE_SIZE);
+    _pkt_sack(&tcb, SEQ + last * SEG_LEN, SEQ + (last + 1) * SEG_LEN);
+    TEST_ASSERT(tcb.pkt_sacked[last]);
+    for (unsigned i = 0; i < last; i++) {
+        TEST_ASSERT(!tcb.pkt_sacked[i]);
+        TEST_ASSERT_EQUAL_INT(i, _pkt_get_next_lost(&tcb));
+        tcb.high_rxt = SEQ + (i + 1) * SEG_LEN;
+    }
+    TEST_ASSERT_EQUAL_INT(-1, _pkt_get_next_lost(&tcb));
+    _clear_recovery();
+}
+
+/*
+ * Reports SACK blocks below the cumulative ACK and blocks that cover a segment
+ * only partially.
+ * Expected result: no segment is marked.
+ */
+static void test_recovery__sack_invalid(void)
+{
+    _setup_recovery(GNRC_TCP_SND_QUEUE_SIZE);
+    _pkt_sack(&tcb, SEQ - SEG_LEN, SEQ + SEG_LEN);
+    _pkt_sack(&tcb, SEQ + SEG_LEN, SEQ + SEG_LEN + SEG_LEN / 2);
+    _pkt_sack(&tcb, SEQ + 2 * SEG_LEN, SEQ + 2 * SEG_LEN);
+    for (unsigned i = 0; i < GNRC_TCP_SND_QUEUE_SIZE; i++) {
+        TEST_ASSERT(!tcb.pkt_sacked[i]);
+    }
+    _clear_recovery();
+}
+
+/*
+ * Advertises a window, then lets another connection take as many chunks as it
+ * can.
+ * Expected result: the advertised window stays available.
+ */
+static void test_rcvbuf_window__reserved(void)
+{
+    uint16_t wnd;
+
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&tcb));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&other));
+    wnd = _rcvbuf_get_window(&tcb);
+    TEST_ASSERT(wnd > GNRC_TCP_RCV_CHUNK_SIZE);
+
+    _rcvbuf_get_window(&other);
+    _rcvbuf_add(&other, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(wnd, _rcvbuf_get_window(&tcb));
+    TEST_ASSERT_EQUAL_INT(wnd, _rcvbuf_add(&tcb, buf, sizeof(buf)));
+
+    _rcvbuf_release_buffer(&other);
+    _rcvbuf_release_buffer(&tcb);
+}
+
+/*
+ * Advertises a window, then appends data to the receive buffer.
+ * Expected result: the window only shrinks by the data appended.
+ */
+static void test_rcvbuf_window__no_shrink(void)
+{
+    uint16_t wnd;
+
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&tcb));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&other));
+    wnd = _rcvbuf_get_window(&tcb);
+    TEST_ASSERT_EQUAL_INT(SEG_LEN, _rcvbuf_add(&tcb, buf, SEG_LEN));
+    TEST_ASSERT(_rcvbuf_get_window(&tcb) >= wnd - SEG_LEN);
+    TEST_ASSERT_EQUAL_INT(SEG_LEN, _rcvbuf_get(&tcb, buf, SEG_LEN));
+    TEST_ASSERT(_rcvbuf_get_window(&tcb) >= wnd);
+
+    _rcvbuf_release_buffer(&other);
+    _rcvbuf_release_buffer(&tcb);
+}
+
+Test *tests_gnrc_tcp_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_option_build_sack__empty),
+        new_TestFixture(test_option_build_sack__merge),
+        new_TestFixture(test_ooo__reassembly),
+        new_TestFixture(test_ooo__overlap),
+        new_TestFixture(test_ooo__duplicate_full),
+        new_TestFixture(test_recovery__no_sack),
+        new_TestFixture(test_recovery__sack),
+        new_TestFixture(test_recovery__sack_invalid),
+        new_TestFixture(test_rcvbuf_window__reserved),
+        new_TestFixture(test_rcvbuf_window__no_shrink),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_tcp_tests;
+}
+
+void tests_gnrc_tcp(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_tests());
+}
+/** @} */
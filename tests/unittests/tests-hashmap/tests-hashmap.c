@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "hashmap.h"
+
+#include "tests-hashmap.h"
+
+#define MAP_SIZE    (8U)
+
+typedef struct {
+    uint32_t key;
+    uint32_t value;
+} entry_t;
+
+static entry_t _entries[MAP_SIZE];
+static uint8_t _states[MAP_SIZE];
+static hashmap_t _map;
+
+static void set_up(void)
+{
+    hashmap_init(&_map, _entries, _states, MAP_SIZE, sizeof(entry_t),
+                 sizeof(uint32_t));
+}
+
+static entry_t *_put(uint32_t key, uint32_t value)
+{
+    entry_t *e = hashmap_put(&_map, &key);
+
+    if (e) {
+        e->value = value;
+    }
+    return e;
+}
+
+static void test_hashmap_put_get(void)
+{
+    uint32_t key = 42;
+
+    TEST_ASSERT_NULL(hashmap_get(&_map, &key));
+    TEST_ASSERT_NOT_NULL(_put(42, 1));
+    TEST_ASSERT_NOT_NULL(_put(23, 2));
+    TEST_ASSERT_EQUAL_INT(2, hashmap_numof(&_map));
+
+    entry_t *e = hashmap_get(&_map, &key);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_INT(42, e->key);
+    TEST_ASSERT_EQUAL_INT(1, e->value);
+
+    /* putting an existing key returns the same entry */
+    TEST_ASSERT(hashmap_put(&_map, &key) == e);
+    TEST_ASSERT_EQUAL_INT(2, hashmap_numof(&_map));
+}
+
+static void test_hashmap_full(void)
+{
+    for (uint32_t i = 0; i < MAP_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(_put(i * 7, i));
+    }
+    TEST_ASSERT_NULL(_put(1000, 0));
+    TEST_ASSERT_EQUAL_INT(MAP_SIZE, hashmap_numof(&_map));
+
+    for (uint32_t i = 0; i < MAP_SIZE; i++) {
+        uint32_t key = i * 7;
+        entry_t *e = hashmap_get(&_map, &key);
+        TEST_ASSERT_NOT_NULL(e);
+        TEST_ASSERT_EQUAL_INT(i, e->value);
+    }
+}
+
+static void test_hashmap_remove(void)
+{
+    uint32_t key;
+
+    for (uint32_t i = 0; i < MAP_SIZE; i++) {
+        _put(i, i);
+    }
+    key = 3;
+    TEST_ASSERT_EQUAL_INT(0, hashmap_remove(&_map, &key));
+    TEST_ASSERT_EQUAL_INT(-1, hashmap_remove(&_map, &key));
+    TEST_ASSERT_NULL(hashmap_get(&_map, &key));
+    TEST_ASSERT_EQUAL_INT(MAP_SIZE - 1, hashmap_numof(&_map));
+
+    /* all other keys must still be reachable */
+    for (uint32_t i = 0; i < MAP_SIZE; i++) {
+        key = i;
+        if (i != 3) {
+            TEST_ASSERT_NOT_NULL(hashmap_get(&_map, &key));
+        }
+    }
+
+    /* the freed slot can be reused */
+    TEST_ASSERT_NOT_NULL(_put(100, 100));
+    TEST_ASSERT_NULL(_put(101, 101));
+
+    hashmap_clear(&_map);
+    TEST_ASSERT_EQUAL_INT(0, hashmap_numof(&_map));
+    TEST_ASSERT_NULL(hashmap_get(&_map, &key));
+}
+
+static void test_hashmap_iter(void)
+{
+    unsigned pos = 0;
+    unsigned seen = 0;
+    entry_t *e;
+
+    TEST_ASSERT_NULL(hashmap_iter(&_map, &pos));
+
+    for (uint32_t i = 0; i < 5; i++) {
+        _put(i, i);
+    }
+
+    /* remove the odd keys while iterating */
+    pos = 0;
+    while ((e = hashmap_iter(&_map, &pos))) {
+        seen |= 1 << e->key;
+        if (e->key & 1) {
+            hashmap_remove_entry(&_map, e);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0x1f, seen);
+    TEST_ASSERT_EQUAL_INT(3, hashmap_numof(&_map));
+
+    pos = 0;
+    seen = 0;
+    while ((e = hashmap_iter(&_map, &pos))) {
+        seen |= 1 << e->key;
+    }
+    TEST_ASSERT_EQUAL_INT(0x15, seen);
+}
+
+Test *tests_hashmap_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_hashmap_put_get),
+        new_TestFixture(test_hashmap_full),
+        new_TestFixture(test_hashmap_remove),
+        new_TestFixture(test_hashmap_iter),
+    };
+
+    EMB_UNIT_TESTCALLER(hashmap_tests, set_up, NULL, fixtures);
+
+    return (Test *)&hashmap_tests;
+}
+
+void tests_hashmap(void)
+{
+    TESTS_RUN(tests_hashmap_tests());
+}
+/** @} */
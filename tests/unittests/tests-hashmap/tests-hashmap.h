@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``hashmap`` module
+ */
+#ifndef TESTS_HASHMAP_H
+#define TESTS_HASHMAP_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite.
+ */
+void tests_hashmap(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_HASHMAP_H */
+/** @} */
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "net/ieee802154.h"
+#include "net/ieee802154_security.h"
+
+#include "tests-ieee802154_security.h"
+
+#define PAYLOAD_LEN     (10U)
+
+static const uint8_t _key[IEEE802154_SEC_KEY_LEN] = {
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+};
+static const uint8_t _src[] = { 0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t _dst[] = { 0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x02 };
+static const uint8_t _payload[PAYLOAD_LEN] = "RIOT-OS!!";
+
+static ieee802154_sec_context_t _tx, _rx;
+static uint8_t _mhr[IEEE802154_MAX_HDR_LEN + IEEE802154_SEC_AUX_HDR_LEN];
+static uint8_t _frame[PAYLOAD_LEN + IEEE802154_SEC_MIC_LEN];
+
+static void set_up(void)
+{
+    ieee802154_sec_init(&_tx);
+    ieee802154_sec_init(&_rx);
+    ieee802154_sec_set_key(&_tx, 1, _key);
+    ieee802154_sec_set_key(&_rx, 1, _key);
+}
+
+/* builds and secures a frame of src, returns the length of the MAC header */
+static int _secure_frame_from(const uint8_t *src)
+{
+    le_uint16_t pan = { .u16 = 0x1234 };
+    size_t mhr_len = ieee802154_set_frame_hdr(_mhr, src, sizeof(_src),
+                                              _dst, sizeof(_dst), pan, pan,
+                                              IEEE802154_FCF_TYPE_DATA |
+                                              IEEE802154_FCF_SECURITY_EN, 0);
+
+    memcpy(_frame, _payload, sizeof(_payload));
+    return ieee802154_sec_encrypt(&_tx, _mhr, mhr_len, src, _frame,
+                                  sizeof(_payload));
+}
+
+static int _secure_frame(void)
+{
+    return _secure_frame_from(_src);
+}
+
+static void test_ieee802154_sec_set_key_invalid(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ieee802154_sec_set_key(&_tx, 0, _key));
+    for (unsigned i = 1; i < IEEE802154_SEC_KEY_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, ieee802154_sec_set_key(&_tx, i + 1, _key));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM,
+                          ieee802154_sec_set_key(&_tx,
+                                                 IEEE802154_SEC_KEY_NUMOF + 1,
+                                                 _key));
+    /* replacing a key needs no additional entry */
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_sec_set_key(&_tx, 1, _key));
+}
+
+static void test_ieee802154_sec_encrypt_no_key(void)
+{
+    uint8_t mhr[IEEE802154_SEC_AUX_HDR_LEN + 3] = { 0 };
+    uint8_t payload[IEEE802154_SEC_MIC_LEN];
+
+    ieee802154_sec_init(&_tx);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, ieee802154_sec_encrypt(&_tx, mhr, 3, _src,
+                                                          payload, 0));
+}
+
+static void test_ieee802154_sec_roundtrip(void)
+{
+    int mhr_len = _secure_frame();
+
+    TEST_ASSERT(mhr_len > 0);
+    TEST_ASSERT_EQUAL_INT(mhr_len, ieee802154_get_frame_hdr_len(_mhr));
+    TEST_ASSERT(memcmp(_frame, _payload, sizeof(_payload)) != 0);
+    TEST_ASSERT_EQUAL_INT(sizeof(_payload),
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, _frame,
+                                                 sizeof(_frame)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_frame, _payload, sizeof(_payload)));
+}
+
+static void test_ieee802154_sec_tampered(void)
+{
+    int mhr_len = _secure_frame();
+
+    _frame[0] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(-EBADMSG,
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, _frame,
+                                                 sizeof(_frame)));
+}
+
+static void test_ieee802154_sec_replay(void)
+{
+    uint8_t copy[sizeof(_frame)];
+    int mhr_len = _secure_frame();
+
+    memcpy(copy, _frame, sizeof(copy));
+    TEST_ASSERT_EQUAL_INT(sizeof(_payload),
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, _frame,
+                                                 sizeof(_frame)));
+    TEST_ASSERT_EQUAL_INT(-EALREADY,
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, copy,
+                                                 sizeof(copy)));
+    /* the next frame of the same sender is accepted */
+    mhr_len = _secure_frame();
+    TEST_ASSERT_EQUAL_INT(sizeof(_payload),
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, _frame,
+                                                 sizeof(_frame)));
+}
+
+static void test_ieee802154_sec_unknown_key(void)
+{
+    static const uint8_t other[IEEE802154_SEC_KEY_LEN] = { 0 };
+    int mhr_len;
+
+    ieee802154_sec_init(&_tx);
+    ieee802154_sec_set_key(&_tx, 2, other);
+    mhr_len = _secure_frame();
+    TEST_ASSERT_EQUAL_INT(-ENOENT,
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, _frame,
+                                                 sizeof(_frame)));
+}
+
+static void test_ieee802154_sec_neighbors_full(void)
+{
+    uint8_t src[sizeof(_src)];
+    uint8_t replay_mhr[sizeof(_mhr)];
+    uint8_t replay[sizeof(_frame)];
+    int replay_mhr_len = _secure_frame();
+
+    /* an authentic frame of the first sender, to be replayed later */
+    memcpy(replay_mhr, _mhr, sizeof(replay_mhr));
+    memcpy(replay, _frame, sizeof(replay));
+    TEST_ASSERT_EQUAL_INT(sizeof(_payload),
+                          ieee802154_sec_decrypt(&_rx, _mhr, replay_mhr_len,
+                                                 _frame, sizeof(_frame)));
+
+    /* fill the table with other senders */
+    memcpy(src, _src, sizeof(src));
+    for (unsigned i = 1; i < IEEE802154_SEC_NEIGHBOR_NUMOF; i++) {
+        src[sizeof(src) - 1] = 0x10 + i;
+        int mhr_len = _secure_frame_from(src);
+        TEST_ASSERT_EQUAL_INT(sizeof(_payload),
+                              ieee802154_sec_decrypt(&_rx, _mhr, mhr_len,
+                                                     _frame, sizeof(_frame)));
+    }
+
+    /* further senders are dropped instead of evicting a frame counter */
+    src[sizeof(src) - 1] = 0xff;
+    int mhr_len = _secure_frame_from(src);
+    TEST_ASSERT_EQUAL_INT(-ENOSPC,
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, _frame,
+                                                 sizeof(_frame)));
+    TEST_ASSERT_EQUAL_INT(-EALREADY,
+                          ieee802154_sec_decrypt(&_rx, replay_mhr,
+                                                 replay_mhr_len, replay,
+                                                 sizeof(replay)));
+
+    /* removing a sender makes room for a new one */
+    src[sizeof(src) - 1] = 0x11;
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_sec_del_neighbor(&_rx, src));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, ieee802154_sec_del_neighbor(&_rx, src));
+    src[sizeof(src) - 1] = 0xff;
+    mhr_len = _secure_frame_from(src);
+    TEST_ASSERT_EQUAL_INT(sizeof(_payload),
+                          ieee802154_sec_decrypt(&_rx, _mhr, mhr_len, _frame,
+                                                 sizeof(_frame)));
+    /* the first sender is still protected */
+    TEST_ASSERT_EQUAL_INT(-EALREADY,
+                          ieee802154_sec_decrypt(&_rx, replay_mhr,
+                                                 replay_mhr_len, replay,
+                                                 sizeof(replay)));
+}
+
+static void test_ieee802154_sec_level_mismatch(void)
+{
+    static const uint8_t levels[] = {
+        1 /* MIC-32 without encryption */,
+        IEEE802154_SEC_LEVEL_ENC_MIC_32,
+        IEEE802154_SEC_LEVEL_ENC_MIC_64,
+        IEEE802154_SEC_LEVEL_ENC_MIC_128,
+    };
+    int mhr_len = _secure_frame();
+    uint8_t *ctrl = &_mhr[mhr_len - IEEE802154_SEC_AUX_HDR_LEN];
+
+    for (unsigned i = 0; i < sizeof(levels); i++) {
+        if (levels[i] == IEEE802154_SEC_LEVEL) {
+            continue;
+        }
+        *ctrl = (*ctrl & ~0x07) | levels[i];
+        TEST_ASSERT_EQUAL_INT(-ENOTSUP,
+                              ieee802154_sec_decrypt(&_rx, _mhr, mhr_len,
+                                                     _frame, sizeof(_frame)));
+    }
+}
+
+Test *tests_ieee802154_security_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ieee802154_sec_set_key_invalid),
+        new_TestFixture(test_ieee802154_sec_encrypt_no_key),
+        new_TestFixture(test_ieee802154_sec_roundtrip),
+        new_TestFixture(test_ieee802154_sec_tampered),
+        new_TestFixture(test_ieee802154_sec_replay),
+        new_TestFixture(test_ieee802154_sec_unknown_key),
+        new_TestFixture(test_ieee802154_sec_neighbors_full),
+        new_TestFixture(test_ieee802154_sec_level_mismatch),
+    };
+
+    EMB_UNIT_TESTCALLER(ieee802154_security_tests, set_up, NULL, fixtures);
+
+    return (Test *)&ieee802154_security_tests;
+}
+
+void tests_ieee802154_security(void)
+{
+    TESTS_RUN(tests_ieee802154_security_tests());
+}
+/** @} */
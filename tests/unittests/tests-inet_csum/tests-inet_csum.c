@@ -165,6 +165,44 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static uint16_t _ref_csum(const uint8_t *buf, size_t len)
+{
+    uint32_t csum = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        csum += (i & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__alignment(void)
+{
+    uint8_t data[67];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)((i * 0x9d) + 0x5b);
+    }
+
+    /* result must not depend on buffer alignment or where the domain is
+     * split into slices */
+    for (unsigned off = 0; off < 4; off++) {
+        for (unsigned len = 0; len <= (sizeof(data) - off); len++) {
+            uint16_t expected = _ref_csum(&data[off], len);
+
+            TEST_ASSERT_EQUAL_INT(expected, inet_csum(0, &data[off], len));
+            for (unsigned split = 0; split <= len; split += 3) {
+                uint16_t sum = inet_csum_slice(0, &data[off], split, 0);
+                sum = inet_csum_slice(sum, &data[off + split], len - split,
+                                      split);
+                TEST_ASSERT_EQUAL_INT(expected, sum);
+            }
+        }
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +214,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__alignment),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -0,0 +1,318 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "kvs.h"
+#include "mtd.h"
+
+#include "tests-kvs.h"
+
+#define SECTOR_COUNT    (5U)
+#define PAGE_PER_SECTOR (2U)
+#define PAGE_SIZE       (128U)
+#define SECTOR_SIZE     (PAGE_PER_SECTOR * PAGE_SIZE)
+
+/* the store uses all but the first sector */
+#define FIRST_SECTOR    (1U)
+#define SECTOR_NUM      (SECTOR_COUNT - FIRST_SECTOR)
+
+/* RAM backed mtd behaving like NOR flash: writes can only clear bits */
+static uint8_t dummy_memory[SECTOR_COUNT * SECTOR_SIZE];
+static unsigned writes;
+static unsigned erases[SECTOR_COUNT];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if (addr + size > sizeof(dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, dummy_memory + addr, size);
+    return size;
+}
+
+static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
+{
+    const uint8_t *in = buff;
+    (void)dev;
+
+    if ((addr + size > sizeof(dummy_memory)) ||
+        (((addr % PAGE_SIZE) + size) > PAGE_SIZE)) {
+        return -EOVERFLOW;
+    }
+    writes++;
+    for (uint32_t i = 0; i < size; i++) {
+        dummy_memory[addr + i] &= in[i];
+    }
+    return size;
+}
+
+static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if ((addr % SECTOR_SIZE) || (size % SECTOR_SIZE) ||
+        (addr + size > sizeof(dummy_memory))) {
+        return -EOVERFLOW;
+    }
+    for (uint32_t s = addr / SECTOR_SIZE; s < (addr + size) / SECTOR_SIZE; s++) {
+        erases[s]++;
+    }
+    memset(dummy_memory + addr, 0xff, size);
+    return 0;
+}
+
+static const mtd_desc_t _driver = {
+    .init = _init,
+    .read = _read,
+    .write = _write,
+    .erase = _erase,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static kvs_slot_t slots[8];
+static kvs_t kvs;
+
+static void set_up(void)
+{
+    memset(dummy_memory, 0xff, sizeof(dummy_memory));
+    memset(dummy_memory, 0x5a, SECTOR_SIZE);
+    memset(erases, 0, sizeof(erases));
+    kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_NUM, slots, 8);
+    writes = 0;
+}
+
+static void test_kvs_init__invalid(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EINVAL, kvs_init(&kvs, &_dev, FIRST_SECTOR, 1, slots, 8));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_NUM, slots, 6));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_COUNT, slots, 8));
+}
+
+static void test_kvs_set_get(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "counter", "1", 2));
+    TEST_ASSERT_EQUAL_INT(4, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("bar", buf);
+    TEST_ASSERT_EQUAL_INT(2, kvs_get(&kvs, "counter", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("1", buf);
+    /* truncated read still reports the full length */
+    TEST_ASSERT_EQUAL_INT(4, kvs_get(&kvs, "foo", buf, 1));
+    TEST_ASSERT_EQUAL_INT('b', buf[0]);
+    /* the sector outside of the store is untouched */
+    TEST_ASSERT_EQUAL_INT(0x5a, dummy_memory[SECTOR_SIZE - 1]);
+}
+
+static void test_kvs_set__unchanged(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "bar", 4));
+    writes = 0;
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, writes);
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "baz", 4));
+    TEST_ASSERT(writes > 0);
+    TEST_ASSERT_EQUAL_INT(4, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("baz", buf);
+}
+
+static void test_kvs_set__invalid(void)
+{
+    char key[KVS_KEY_LEN_MAX + 2];
+    static uint8_t big[SECTOR_SIZE];
+
+    memset(key, 'k', sizeof(key) - 1);
+    key[sizeof(key) - 1] = '\0';
+    TEST_ASSERT_EQUAL_INT(-EINVAL, kvs_set(&kvs, key, "", 1));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, kvs_set(&kvs, "", "", 1));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, kvs_set(&kvs, "big", big, sizeof(big)));
+}
+
+static void test_kvs_delete(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvs_delete(&kvs, "foo"));
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, kvs_delete(&kvs, "foo"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvs_delete(&kvs, "foo"));
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "new", 4));
+    TEST_ASSERT_EQUAL_INT(4, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("new", buf);
+}
+
+static void test_kvs_init__replay(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "gone", "x", 2));
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "baz", 4));
+    TEST_ASSERT_EQUAL_INT(0, kvs_delete(&kvs, "gone"));
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_NUM, slots, 8));
+    TEST_ASSERT_EQUAL_INT(4, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("baz", buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvs_get(&kvs, "gone", buf, sizeof(buf)));
+}
+
+static void test_kvs_init__torn_record(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "bar", 4));
+    uint32_t end = FIRST_SECTOR * SECTOR_SIZE + kvs.pos;
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "baz", 4));
+    /* the last value byte never made it to the device */
+    dummy_memory[end + 8 + 3 + 3] = 0xff;
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_NUM, slots, 8));
+    TEST_ASSERT_EQUAL_INT(4, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("bar", buf);
+    /* nothing is written behind the broken record */
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "qux", 4));
+    TEST_ASSERT_EQUAL_INT(0, kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_NUM, slots, 8));
+    TEST_ASSERT_EQUAL_INT(4, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("qux", buf);
+}
+
+static void test_kvs_set__index_full(void)
+{
+    char key[] = "k0";
+
+    for (unsigned i = 0; i < 8; i++) {
+        key[1] = '0' + i;
+        TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, key, &i, sizeof(i)));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, kvs_set(&kvs, "k8", "", 1));
+    /* updating existing keys still works */
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "k0", "", 1));
+}
+
+static void test_kvs_compaction(void)
+{
+    uint32_t val;
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "static", "data", 5));
+    for (uint32_t i = 0; i < 500; i++) {
+        TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "counter", &i, sizeof(i)));
+    }
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvs_get(&kvs, "counter", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(499, val);
+
+    /* erases are spread over all sectors of the store */
+    TEST_ASSERT_EQUAL_INT(0, erases[0]);
+    for (unsigned s = FIRST_SECTOR + 1; s < SECTOR_COUNT; s++) {
+        TEST_ASSERT(erases[s] > 0);
+        TEST_ASSERT((erases[s] + 1 >= erases[FIRST_SECTOR]) &&
+                    (erases[s] <= erases[FIRST_SECTOR] + 1));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_NUM, slots, 8));
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvs_get(&kvs, "counter", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(499, val);
+    char buf[8];
+    TEST_ASSERT_EQUAL_INT(5, kvs_get(&kvs, "static", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("data", buf);
+}
+
+static void test_kvs_gc(void)
+{
+    uint32_t i = 0;
+    unsigned total = 0;
+
+    /* nothing to reclaim while there are erased sectors to spare */
+    TEST_ASSERT_EQUAL_INT(0, kvs_gc(&kvs));
+    /* fill all but the last erased sector */
+    while (kvs_set(&kvs, "counter", &i, sizeof(i)) == 0) {
+        unsigned sum = 0;
+        for (unsigned s = 0; s < SECTOR_COUNT; s++) {
+            sum += erases[s];
+        }
+        if (sum) {
+            break;
+        }
+        i++;
+    }
+    for (unsigned s = 0; s < SECTOR_COUNT; s++) {
+        total += erases[s];
+    }
+    /* the first compaction happened on demand, the next one is done ahead */
+    TEST_ASSERT_EQUAL_INT(1, total);
+    TEST_ASSERT_EQUAL_INT(1, kvs_gc(&kvs));
+    TEST_ASSERT_EQUAL_INT(0, kvs_gc(&kvs));
+    uint32_t val;
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvs_get(&kvs, "counter", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(i, val);
+}
+
+static void test_kvs_format(void)
+{
+    char buf[4];
+
+    TEST_ASSERT_EQUAL_INT(0, kvs_set(&kvs, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, kvs_format(&kvs));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, kvs_init(&kvs, &_dev, FIRST_SECTOR, SECTOR_NUM, slots, 8));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvs_get(&kvs, "foo", buf, sizeof(buf)));
+}
+
+Test *tests_kvs_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_kvs_init__invalid),
+        new_TestFixture(test_kvs_set_get),
+        new_TestFixture(test_kvs_set__unchanged),
+        new_TestFixture(test_kvs_set__invalid),
+        new_TestFixture(test_kvs_delete),
+        new_TestFixture(test_kvs_init__replay),
+        new_TestFixture(test_kvs_init__torn_record),
+        new_TestFixture(test_kvs_set__index_full),
+        new_TestFixture(test_kvs_compaction),
+        new_TestFixture(test_kvs_gc),
+        new_TestFixture(test_kvs_format),
+    };
+
+    EMB_UNIT_TESTCALLER(kvs_tests, set_up, NULL, fixtures);
+
+    return (Test *)&kvs_tests;
+}
+
+void tests_kvs(void)
+{
+    TESTS_RUN(tests_kvs_tests());
+}
+/** @} */
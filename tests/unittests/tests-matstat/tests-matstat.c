@@ -272,6 +272,58 @@ static void test_matstat_accuracy(void)
     TEST_ASSERT_EQUAL_INT(12293, mean);
 }
 
+static void test_matstat_add_array(void)
+{
+    /* Adding a block must give the same results as adding the values one by
+     * one */
+    static const int32_t values[] = {
+        2000, 1000, 2000, 9999, 2456, 1234, 5678, 9999, -300, 17,
+    };
+    matstat_state_t state = MATSTAT_STATE_INIT;
+    matstat_state_t state_ref = MATSTAT_STATE_INIT;
+    matstat_add(&state, 1500);
+    matstat_add(&state_ref, 1500);
+    for (unsigned k = 0; k < sizeof(values) / sizeof(values[0]); ++k) {
+        matstat_add(&state_ref, values[k]);
+    }
+    matstat_add_array(&state, values, sizeof(values) / sizeof(values[0]));
+    TEST_ASSERT_EQUAL_INT(state_ref.min, state.min);
+    TEST_ASSERT_EQUAL_INT(state_ref.max, state.max);
+    TEST_ASSERT_EQUAL_INT(state_ref.count, state.count);
+    TEST_ASSERT_EQUAL_INT(state_ref.sum, state.sum);
+    TEST_ASSERT_EQUAL_INT(matstat_mean(&state_ref), matstat_mean(&state));
+    uint64_t var_ref = matstat_variance(&state_ref);
+    int64_t var_diff = matstat_variance(&state) - var_ref;
+    /* Both ways truncate differently, allow for 0.1 % deviation */
+    TEST_ASSERT(var_diff <  (int64_t)(var_ref / 1000));
+    TEST_ASSERT(var_diff > -(int64_t)(var_ref / 1000));
+    /* Empty blocks are a no-op */
+    matstat_add_array(&state, values, 0);
+    TEST_ASSERT_EQUAL_INT(state_ref.count, state.count);
+}
+
+static void test_matstat_hist_percentile(void)
+{
+    uint32_t bins[10];
+    matstat_hist_t hist;
+    /* bins of width 4, starting at 100 */
+    matstat_hist_init(&hist, bins, 10, 100, 2);
+    TEST_ASSERT_EQUAL_INT(100, matstat_hist_percentile(&hist, 50));
+    for (int32_t k = 0; k < 40; ++k) {
+        matstat_hist_add(&hist, 100 + k);
+    }
+    TEST_ASSERT_EQUAL_INT(40, hist.count);
+    TEST_ASSERT_EQUAL_INT(104, matstat_hist_percentile(&hist, 0));
+    TEST_ASSERT_EQUAL_INT(120, matstat_hist_percentile(&hist, 50));
+    TEST_ASSERT_EQUAL_INT(140, matstat_hist_percentile(&hist, 99));
+    TEST_ASSERT_EQUAL_INT(140, matstat_hist_percentile(&hist, 100));
+    /* out of range values end up in the first and last bin */
+    matstat_hist_add(&hist, -5);
+    matstat_hist_add(&hist, INT32_MAX);
+    TEST_ASSERT_EQUAL_INT(5, bins[0]);
+    TEST_ASSERT_EQUAL_INT(5, bins[9]);
+}
+
 Test *tests_matstat_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -283,6 +335,8 @@ Test *tests_matstat_tests(void)
         new_TestFixture(test_matstat_merge_variance_regr1),
         new_TestFixture(test_matstat_accuracy),
         new_TestFixture(test_matstat_negative_variance),
+        new_TestFixture(test_matstat_add_array),
+        new_TestFixture(test_matstat_hist_percentile),
     };
 
     EMB_UNIT_TESTCALLER(matstat_tests, NULL, NULL, fixtures);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include "embUnit.h"
+
+#include "memarray.h"
+
+#include "tests-memarray.h"
+
+#define TEST_NUM    (4U)
+
+typedef struct {
+    void *next;
+    unsigned value;
+} _elem_t;
+
+static _elem_t _data[TEST_NUM];
+static memarray_t _pool;
+
+static void set_up(void)
+{
+    memarray_init(&_pool, _data, sizeof(_elem_t), TEST_NUM);
+}
+
+static void test_memarray_alloc_free(void)
+{
+    _elem_t *elems[TEST_NUM];
+
+    for (unsigned i = 0; i < TEST_NUM; i++) {
+        elems[i] = memarray_alloc(&_pool);
+        TEST_ASSERT_NOT_NULL(elems[i]);
+        TEST_ASSERT(elems[i] >= &_data[0]);
+        TEST_ASSERT(elems[i] <= &_data[TEST_NUM - 1]);
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(elems[i] != elems[j]);
+        }
+    }
+    TEST_ASSERT_NULL(memarray_alloc(&_pool));
+    memarray_free(&_pool, elems[1]);
+    TEST_ASSERT(elems[1] == memarray_alloc(&_pool));
+}
+
+static void test_memarray_reinit(void)
+{
+    for (unsigned i = 0; i < TEST_NUM; i++) {
+        TEST_ASSERT_NOT_NULL(memarray_alloc(&_pool));
+    }
+    /* the free list must be terminated even if the data was used before */
+    memarray_init(&_pool, _data, sizeof(_elem_t), TEST_NUM);
+    for (unsigned i = 0; i < TEST_NUM; i++) {
+        TEST_ASSERT_NOT_NULL(memarray_alloc(&_pool));
+    }
+    TEST_ASSERT_NULL(memarray_alloc(&_pool));
+}
+
+static void test_memarray_stats(void)
+{
+    void *a, *b;
+
+    memarray_set_name(&_pool, "test");
+    TEST_ASSERT(memarray_iter(NULL) != NULL);
+    TEST_ASSERT_EQUAL_INT(0, _pool.used);
+    a = memarray_alloc(&_pool);
+    b = memarray_alloc(&_pool);
+    TEST_ASSERT_EQUAL_INT(2, _pool.used);
+    memarray_free(&_pool, a);
+    memarray_free(&_pool, b);
+    TEST_ASSERT_EQUAL_INT(0, _pool.used);
+    TEST_ASSERT_EQUAL_INT(2, _pool.max_used);
+    for (unsigned i = 0; i <= TEST_NUM; i++) {
+        memarray_alloc(&_pool);
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_NUM, _pool.max_used);
+    TEST_ASSERT_EQUAL_INT(1, _pool.failed);
+}
+
+Test *tests_memarray_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_memarray_alloc_free),
+        new_TestFixture(test_memarray_reinit),
+        new_TestFixture(test_memarray_stats),
+    };
+
+    EMB_UNIT_TESTCALLER(memarray_tests, set_up, NULL, fixtures);
+
+    return (Test *)&memarray_tests;
+}
+
+void tests_memarray(void)
+{
+    TESTS_RUN(tests_memarray_tests());
+}
+/** @} */
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "memscan.h"
+
+#include "tests-memscan.h"
+
+static void test_memscan2__none(void)
+{
+    static const uint8_t buf[] = "plain text without control bytes";
+
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), memscan2(buf, sizeof(buf), 0xc0, 0xdb));
+    TEST_ASSERT_EQUAL_INT(0, memscan2(buf, 0, 0xc0, 0xdb));
+}
+
+static void test_memscan2__every_offset(void)
+{
+    /* word aligned, so each match lands on every position of a word and
+     * the unaligned head is covered by the shifted start */
+    static uint32_t words[8];
+    uint8_t *buf = (uint8_t *)words;
+
+    for (unsigned start = 0; start < 4; start++) {
+        for (unsigned pos = start; pos < sizeof(words); pos++) {
+            memset(buf, 0x55, sizeof(words));
+            buf[pos] = 0xdb;
+            TEST_ASSERT_EQUAL_INT(pos - start,
+                                  memscan2(&buf[start], sizeof(words) - start,
+                                           0xc0, 0xdb));
+            buf[pos] = 0xc0;
+            TEST_ASSERT_EQUAL_INT(pos - start,
+                                  memscan2(&buf[start], sizeof(words) - start,
+                                           0xc0, 0xc0));
+        }
+    }
+}
+
+static void test_memscan2__first(void)
+{
+    static uint32_t words[4];
+    uint8_t *buf = (uint8_t *)words;
+
+    memset(buf, 0x01, sizeof(words));
+    buf[9] = 0xc0;
+    buf[6] = 0xdb;
+    TEST_ASSERT_EQUAL_INT(6, memscan2(buf, sizeof(words), 0xc0, 0xdb));
+    /* a match beyond len is not reported */
+    TEST_ASSERT_EQUAL_INT(5, memscan2(buf, 5, 0xc0, 0xdb));
+    /* bytes that only differ in the high bit don't match */
+    memset(buf, 0x40, sizeof(words));
+    TEST_ASSERT_EQUAL_INT(sizeof(words),
+                          memscan2(buf, sizeof(words), 0xc0, 0xc0));
+}
+
+Test *tests_memscan_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_memscan2__none),
+        new_TestFixture(test_memscan2__every_offset),
+        new_TestFixture(test_memscan2__first),
+    };
+
+    EMB_UNIT_TESTCALLER(memscan_tests, NULL, NULL, fixtures);
+
+    return (Test *)&memscan_tests;
+}
+
+void tests_memscan(void)
+{
+    TESTS_RUN(tests_memscan_tests());
+}
+/** @} */
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief   Unittests for the `memscan` header
+ */
+#ifndef TESTS_MEMSCAN_H
+#define TESTS_MEMSCAN_H
+
+#include "embUnit/embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_memscan(void);
+
+/**
+ * @brief   Generates tests for memscan
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_memscan_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_MEMSCAN_H */
+/** @} */
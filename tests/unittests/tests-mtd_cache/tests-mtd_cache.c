@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_cache.h"
+
+#include "tests-mtd_cache.h"
+
+#define SECTOR_COUNT    (4U)
+#define PAGE_PER_SECTOR (4U)
+#define PAGE_SIZE       (64U)
+#define SECTOR_SIZE     (PAGE_PER_SECTOR * PAGE_SIZE)
+
+#define SETS            (2U)
+#define WAYS            (2U)
+
+/* RAM backed mtd counting the accesses to it */
+static uint8_t dummy_memory[SECTOR_COUNT * SECTOR_SIZE];
+static unsigned reads, writes;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if (addr + size > sizeof(dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    reads++;
+    memcpy(buff, dummy_memory + addr, size);
+    return size;
+}
+
+static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if ((addr + size > sizeof(dummy_memory)) ||
+        (((addr % PAGE_SIZE) + size) > PAGE_SIZE)) {
+        return -EOVERFLOW;
+    }
+    writes++;
+    memcpy(dummy_memory + addr, buff, size);
+    return size;
+}
+
+static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if ((addr % SECTOR_SIZE) || (size % SECTOR_SIZE) ||
+        (addr + size > sizeof(dummy_memory))) {
+        return -EOVERFLOW;
+    }
+    memset(dummy_memory + addr, 0xff, size);
+    return 0;
+}
+
+static const mtd_desc_t _driver = {
+    .init = _init,
+    .read = _read,
+    .write = _write,
+    .erase = _erase,
+};
+
+static mtd_dev_t _parent = {
+    .driver = &_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_cache_line_t lines[SETS * WAYS];
+static uint8_t buf[MTD_CACHE_BUF_SIZE(SETS, WAYS, PAGE_SIZE)];
+static mtd_cache_t cache;
+static mtd_dev_t *dev = &cache.base;
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < sizeof(dummy_memory); i++) {
+        dummy_memory[i] = i;
+    }
+    mtd_cache_setup(&cache, &_parent, lines, buf, sizeof(buf), SETS, WAYS);
+    mtd_init(dev);
+    reads = 0;
+    writes = 0;
+}
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, dev->page_size);
+
+    mtd_cache_setup(&cache, &_parent, lines, buf, sizeof(buf) - 1, SETS, WAYS);
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, mtd_init(dev));
+}
+
+static void test_mtd_cache_read__hit(void)
+{
+    uint8_t out[PAGE_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(8, mtd_read(dev, out, PAGE_SIZE + 4, 8));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, dummy_memory + PAGE_SIZE + 4, 8));
+    TEST_ASSERT_EQUAL_INT(1, reads);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, mtd_read(dev, out, PAGE_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, dummy_memory + PAGE_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, reads);
+}
+
+static void test_mtd_cache_read__across_pages(void)
+{
+    uint8_t out[PAGE_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, mtd_read(dev, out, PAGE_SIZE / 2, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, dummy_memory + PAGE_SIZE / 2, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(2, reads);
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_read(dev, out, sizeof(dummy_memory) - 1, 2));
+}
+
+static void test_mtd_cache_read__lru(void)
+{
+    uint8_t out;
+
+    /* pages 0, 2 and 4 share set 0 */
+    mtd_read(dev, &out, 0 * PAGE_SIZE, 1);
+    mtd_read(dev, &out, 2 * PAGE_SIZE, 1);
+    mtd_read(dev, &out, 0 * PAGE_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(2, reads);
+    /* evicts page 2, the least recently used one */
+    mtd_read(dev, &out, 4 * PAGE_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(3, reads);
+    mtd_read(dev, &out, 0 * PAGE_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(3, reads);
+    mtd_read(dev, &out, 2 * PAGE_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(4, reads);
+    /* set 1 is untouched */
+    mtd_read(dev, &out, 1 * PAGE_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(5, reads);
+}
+
+static void test_mtd_cache_write__coalesce(void)
+{
+    const uint8_t data[] = { 0xaa, 0xbb, 0xcc, 0xdd };
+    uint8_t out[sizeof(data)];
+
+    TEST_ASSERT_EQUAL_INT(2, mtd_write(dev, data, 8, 2));
+    TEST_ASSERT_EQUAL_INT(2, mtd_write(dev, data + 2, 10, 2));
+    TEST_ASSERT_EQUAL_INT(0, writes);
+    TEST_ASSERT(memcmp(dummy_memory + 8, data, sizeof(data)) != 0);
+    TEST_ASSERT_EQUAL_INT(sizeof(out), mtd_read(dev, out, 8, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, data, sizeof(data)));
+
+    /* both writes go to the device at once, the rest of the page is untouched */
+    dummy_memory[0] = 0x42;
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+    TEST_ASSERT_EQUAL_INT(1, writes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(dummy_memory + 8, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0x42, dummy_memory[0]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&cache));
+    TEST_ASSERT_EQUAL_INT(1, writes);
+}
+
+static void test_mtd_cache_write__eviction(void)
+{
+    uint8_t page[PAGE_SIZE];
+    uint8_t out;
+
+    memset(page, 0x5a, sizeof(page));
+    /* full page write does not need to read the page */
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, mtd_write(dev, page, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, reads);
+    mtd_read(dev, &out, 2 * PAGE_SIZE, 1);
+    mtd_read(dev, &out, 4 * PAGE_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(1, writes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(dummy_memory, page, PAGE_SIZE));
+}
+
+static void test_mtd_cache_erase(void)
+{
+    const uint8_t data = 0x11;
+    uint8_t out;
+
+    mtd_write(dev, &data, 3, 1);
+    mtd_read(dev, &out, SECTOR_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, 0, SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+    TEST_ASSERT_EQUAL_INT(0, writes);
+    TEST_ASSERT_EQUAL_INT(1, mtd_read(dev, &out, 3, 1));
+    TEST_ASSERT_EQUAL_INT(0xff, out);
+    /* page of the next sector is still cached */
+    reads = 0;
+    mtd_read(dev, &out, SECTOR_SIZE, 1);
+    TEST_ASSERT_EQUAL_INT(0, reads);
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_read__hit),
+        new_TestFixture(test_mtd_cache_read__across_pages),
+        new_TestFixture(test_mtd_cache_read__lru),
+        new_TestFixture(test_mtd_cache_write__coalesce),
+        new_TestFixture(test_mtd_cache_write__eviction),
+        new_TestFixture(test_mtd_cache_erase),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+void tests_mtd_cache(void)
+{
+    TESTS_RUN(tests_mtd_cache_tests());
+}
+/** @} */
@@ -433,6 +433,292 @@ static void test_nanocoap__server_reply_simple_con(void)
     TEST_ASSERT_EQUAL_INT(COAP_TYPE_ACK, coap_get_type(&pkt));
 }
 
+/* Test data for block-wise transfers, with 16 byte blocks (szx 0) */
+static const uint8_t _block_data[] = "0123456789abcdef0123456789ABCDEF01234567";
+#define _BLOCK_DATA_LEN (sizeof(_block_data) - 1)
+
+/* Builds and parses a piggybacked response with an optional block option */
+static void _block_resp(coap_pkt_t *pkt, uint8_t *buf, unsigned code,
+                        uint16_t optnum, uint32_t blknum, unsigned szx,
+                        int more, const uint8_t *payload, size_t len)
+{
+    ssize_t pdu_len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_ACK, NULL, 0,
+                                     code, 1);
+
+    coap_pkt_init(pkt, buf, _BUF_SIZE, pdu_len);
+    if (more >= 0) {
+        coap_opt_add_uint(pkt, optnum, (blknum << 4) | (more << 3) | szx);
+    }
+    pdu_len = coap_opt_finish(pkt, (len) ? COAP_OPT_FINISH_PAYLOAD
+                                         : COAP_OPT_FINISH_NONE);
+    memcpy(pkt->payload, payload, len);
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(pkt, buf, pdu_len + len));
+}
+
+/*
+ * Downloads a representation with blocks in flight out of order.
+ */
+static void test_nanocoap__block2_xfer(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t data[_BLOCK_DATA_LEN];
+    coap_block_xfer_t xfer;
+    coap_pkt_t pkt;
+    uint32_t blknum;
+
+    coap_block2_xfer_init(&xfer, data, sizeof(data), 0, 4);
+    TEST_ASSERT_EQUAL_INT(1, coap_block_xfer_next(&xfer, &blknum));
+    TEST_ASSERT_EQUAL_INT(0, blknum);
+    /* first block is transferred alone */
+    TEST_ASSERT_EQUAL_INT(0, coap_block_xfer_next(&xfer, &blknum));
+
+    _block_resp(&pkt, buf, COAP_CODE_CONTENT, COAP_OPT_BLOCK2, 0, 0, 1,
+                _block_data, 16);
+    TEST_ASSERT_EQUAL_INT(0, coap_block2_xfer_recv(&xfer, &pkt));
+
+    for (unsigned i = 1; i <= 4; i++) {
+        TEST_ASSERT_EQUAL_INT(1, coap_block_xfer_next(&xfer, &blknum));
+        TEST_ASSERT_EQUAL_INT(i, blknum);
+    }
+    TEST_ASSERT_EQUAL_INT(0, coap_block_xfer_next(&xfer, &blknum));
+
+    _block_resp(&pkt, buf, COAP_CODE_CONTENT, COAP_OPT_BLOCK2, 2, 0, 0,
+                &_block_data[32], 8);
+    TEST_ASSERT_EQUAL_INT(0, coap_block2_xfer_recv(&xfer, &pkt));
+    /* blocks 3 and 4 are beyond the end */
+    _block_resp(&pkt, buf, COAP_CODE_BAD_OPTION, 0, 0, 0, -1, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, coap_block2_xfer_recv(&xfer, &pkt));
+    _block_resp(&pkt, buf, COAP_CODE_BAD_OPTION, 0, 0, 0, -1, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, coap_block2_xfer_recv(&xfer, &pkt));
+    TEST_ASSERT_EQUAL_INT(0, coap_block_xfer_next(&xfer, &blknum));
+
+    _block_resp(&pkt, buf, COAP_CODE_CONTENT, COAP_OPT_BLOCK2, 1, 0, 1,
+                &_block_data[16], 16);
+    TEST_ASSERT_EQUAL_INT(1, coap_block2_xfer_recv(&xfer, &pkt));
+    TEST_ASSERT(coap_block_xfer_complete(&xfer));
+    TEST_ASSERT_EQUAL_INT(_BLOCK_DATA_LEN, xfer.total);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_block_data, data, _BLOCK_DATA_LEN));
+}
+
+/*
+ * Server reduces the block size in its response to the first block.
+ */
+static void test_nanocoap__block2_xfer_szx(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t data[_BLOCK_DATA_LEN];
+    coap_block_xfer_t xfer;
+    coap_pkt_t pkt;
+    uint32_t blknum;
+
+    coap_block2_xfer_init(&xfer, data, sizeof(data), 2, 2);
+    TEST_ASSERT_EQUAL_INT(1, coap_block_xfer_next(&xfer, &blknum));
+
+    coap_pkt_init(&pkt, buf, _BUF_SIZE,
+                  coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                                 COAP_METHOD_GET, 1));
+    coap_opt_add_block2_xfer(&pkt, &xfer, blknum);
+    coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+
+    coap_block1_t block2;
+    TEST_ASSERT_EQUAL_INT(1, coap_get_block2(&pkt, &block2));
+    TEST_ASSERT_EQUAL_INT(2, block2.szx);
+
+    _block_resp(&pkt, buf, COAP_CODE_CONTENT, COAP_OPT_BLOCK2, 0, 0, 1,
+                _block_data, 16);
+    TEST_ASSERT_EQUAL_INT(0, coap_block2_xfer_recv(&xfer, &pkt));
+    TEST_ASSERT_EQUAL_INT(0, xfer.szx);
+    TEST_ASSERT_EQUAL_INT(1, coap_block_xfer_next(&xfer, &blknum));
+    TEST_ASSERT_EQUAL_INT(1, blknum);
+
+    /* further changes of the block size are invalid */
+    _block_resp(&pkt, buf, COAP_CODE_CONTENT, COAP_OPT_BLOCK2, 0, 1, 1,
+                _block_data, 32);
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, coap_block2_xfer_recv(&xfer, &pkt));
+}
+
+/*
+ * Representation is larger than the buffer; server error.
+ */
+static void test_nanocoap__block2_xfer_errors(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t data[20];
+    coap_block_xfer_t xfer;
+    coap_pkt_t pkt;
+    uint32_t blknum;
+
+    coap_block2_xfer_init(&xfer, data, sizeof(data), 0, 1);
+    coap_block_xfer_next(&xfer, &blknum);
+    _block_resp(&pkt, buf, COAP_CODE_CONTENT, COAP_OPT_BLOCK2, 0, 0, 1,
+                _block_data, 16);
+    TEST_ASSERT_EQUAL_INT(0, coap_block2_xfer_recv(&xfer, &pkt));
+    coap_block_xfer_next(&xfer, &blknum);
+    _block_resp(&pkt, buf, COAP_CODE_CONTENT, COAP_OPT_BLOCK2, 1, 0, 1,
+                &_block_data[16], 16);
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, coap_block2_xfer_recv(&xfer, &pkt));
+
+    coap_block2_xfer_init(&xfer, data, sizeof(data), 0, 1);
+    coap_block_xfer_next(&xfer, &blknum);
+    _block_resp(&pkt, buf, COAP_CODE_PATH_NOT_FOUND, 0, 0, 0, -1, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(-EPROTO, coap_block2_xfer_recv(&xfer, &pkt));
+}
+
+/*
+ * Uploads data with two blocks in flight; the final response carries no
+ * Block1 option.
+ */
+static void test_nanocoap__block1_xfer(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_block_xfer_t xfer;
+    coap_block1_t block1;
+    coap_pkt_t pkt;
+    uint32_t blknum;
+    ssize_t len;
+
+    coap_block1_xfer_init(&xfer, _block_data, _BLOCK_DATA_LEN, 0, 2);
+    TEST_ASSERT_EQUAL_INT(2, xfer.last);
+    TEST_ASSERT_EQUAL_INT(1, coap_block_xfer_next(&xfer, &blknum));
+    TEST_ASSERT_EQUAL_INT(0, coap_block_xfer_next(&xfer, &blknum));
+
+    coap_pkt_init(&pkt, buf, _BUF_SIZE,
+                  coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                                 COAP_METHOD_PUT, 1));
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, "/fw", '/');
+    len = coap_block1_xfer_finish(&pkt, &xfer, 0);
+    TEST_ASSERT(len > 0);
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, buf, len));
+    TEST_ASSERT_EQUAL_INT(1, coap_get_block1(&pkt, &block1));
+    TEST_ASSERT_EQUAL_INT(0, block1.blknum);
+    TEST_ASSERT_EQUAL_INT(16, pkt.payload_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_block_data, pkt.payload, 16));
+
+    _block_resp(&pkt, buf, COAP_CODE_231, COAP_OPT_BLOCK1, 0, 0, 1, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, coap_block1_xfer_recv(&xfer, &pkt));
+    TEST_ASSERT_EQUAL_INT(1, coap_block_xfer_next(&xfer, &blknum));
+    TEST_ASSERT_EQUAL_INT(1, blknum);
+    TEST_ASSERT_EQUAL_INT(1, coap_block_xfer_next(&xfer, &blknum));
+    TEST_ASSERT_EQUAL_INT(2, blknum);
+    TEST_ASSERT_EQUAL_INT(0, coap_block_xfer_next(&xfer, &blknum));
+
+    /* last block is short and has the more flag cleared */
+    coap_pkt_init(&pkt, buf, _BUF_SIZE,
+                  coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                                 COAP_METHOD_PUT, 3));
+    len = coap_block1_xfer_finish(&pkt, &xfer, 2);
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, buf, len));
+    TEST_ASSERT_EQUAL_INT(1, coap_get_block1(&pkt, &block1));
+    TEST_ASSERT_EQUAL_INT(0, block1.more);
+    TEST_ASSERT_EQUAL_INT(8, pkt.payload_len);
+
+    _block_resp(&pkt, buf, COAP_CODE_CHANGED, 0, 0, 0, -1, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, coap_block1_xfer_recv(&xfer, &pkt));
+    _block_resp(&pkt, buf, COAP_CODE_231, COAP_OPT_BLOCK1, 1, 0, 1, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(1, coap_block1_xfer_recv(&xfer, &pkt));
+    TEST_ASSERT(coap_block_xfer_complete(&xfer));
+}
+
+/*
+ * Options added out of order with the builder encode like options added in
+ * order with the struct-based API.
+ */
+static void test_nanocoap__builder(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t ref[_BUF_SIZE];
+    char path[] = "/riot/value";
+    char query[] = "a=1&b=2";
+    coap_pkt_t pkt;
+    ssize_t len, ref_len;
+
+    ref_len = coap_build_hdr((coap_hdr_t *)ref, COAP_TYPE_CON, NULL, 0,
+                             COAP_METHOD_PUT, 1);
+    coap_pkt_init(&pkt, ref, _BUF_SIZE, ref_len);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, path, '/');
+    coap_opt_add_uint(&pkt, COAP_OPT_CONTENT_FORMAT, COAP_FORMAT_LINK);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_QUERY, query, '&');
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, 1000);
+    ref_len = coap_opt_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+
+    len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                         COAP_METHOD_PUT, 1);
+    coap_builder_init(&pkt, buf, _BUF_SIZE, len);
+    TEST_ASSERT(coap_builder_add_uint(&pkt, COAP_OPT_BLOCK2, 1000) > 0);
+    TEST_ASSERT(coap_builder_add_string(&pkt, COAP_OPT_URI_QUERY, query, '&') > 0);
+    TEST_ASSERT(coap_builder_add_string(&pkt, COAP_OPT_URI_PATH, path, '/') > 0);
+    TEST_ASSERT(coap_builder_add_uint(&pkt, COAP_OPT_CONTENT_FORMAT,
+                                      COAP_FORMAT_LINK) > 0);
+    len = coap_builder_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+
+    TEST_ASSERT_EQUAL_INT(ref_len, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ref, buf, len));
+    TEST_ASSERT_EQUAL_INT(_BUF_SIZE - len, pkt.payload_len);
+    TEST_ASSERT(pkt.payload == &buf[len]);
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_LINK, coap_get_content_type(&pkt));
+}
+
+/*
+ * Builder rejects options that do not fit.
+ */
+static void test_nanocoap__builder_nospc(void)
+{
+    uint8_t buf[32];
+    uint8_t val[8] = { 0 };
+    coap_pkt_t pkt;
+    ssize_t len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                                 COAP_METHOD_GET, 1);
+
+    coap_builder_init(&pkt, buf, sizeof(buf), len);
+    /* stages 8 bytes and reserves 13 bytes for encoding */
+    TEST_ASSERT_EQUAL_INT(8, coap_builder_add_opaque(&pkt, COAP_OPT_URI_HOST,
+                                                     val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(-ENOSPC,
+                          coap_builder_add_opaque(&pkt, COAP_OPT_LOCATION_PATH,
+                                                  val, sizeof(val)));
+    len = coap_builder_finish(&pkt, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT_EQUAL_INT(4 + 1 + sizeof(val), len);
+}
+
+/*
+ * Options are found through the option index, including options in slots
+ * beyond the indexed ones and options with numbers beyond the index.
+ */
+static void test_nanocoap__option_index(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    char value[] = "a";
+    char target[8];
+    coap_pkt_t pkt;
+    ssize_t len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, NULL, 0,
+                                 COAP_METHOD_GET, 1);
+
+    coap_pkt_init(&pkt, buf, _BUF_SIZE, len);
+    for (unsigned i = 1; i < NANOCOAP_NOPTS_MAX; i++) {
+        value[0] = 'a' + i;
+        coap_opt_add_string(&pkt, i, value, '/');
+    }
+    value[0] = 'z';
+    coap_opt_add_string(&pkt, 40, value, '/');
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, buf, len));
+    TEST_ASSERT_EQUAL_INT(NANOCOAP_NOPTS_MAX, pkt.options_len);
+    for (unsigned i = 1; i < NANOCOAP_NOPTS_MAX; i++) {
+        TEST_ASSERT_EQUAL_INT(3, coap_opt_get_string(&pkt, i, (uint8_t *)target,
+                                                     sizeof(target), '/'));
+        TEST_ASSERT_EQUAL_INT('a' + i, target[1]);
+    }
+    TEST_ASSERT_EQUAL_INT(3, coap_opt_get_string(&pkt, 40, (uint8_t *)target,
+                                                 sizeof(target), '/'));
+    TEST_ASSERT_EQUAL_INT('z', target[1]);
+    /* options not present, within and beyond the index */
+    coap_opt_get_string(&pkt, 20, (uint8_t *)target, sizeof(target), '/');
+    TEST_ASSERT_EQUAL_STRING("/", target);
+    coap_opt_get_string(&pkt, 41, (uint8_t *)target, sizeof(target), '/');
+    TEST_ASSERT_EQUAL_STRING("/", target);
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -450,6 +736,13 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__server_reply_simple),
         new_TestFixture(test_nanocoap__server_get_req_con),
         new_TestFixture(test_nanocoap__server_reply_simple_con),
+        new_TestFixture(test_nanocoap__block2_xfer),
+        new_TestFixture(test_nanocoap__block2_xfer_szx),
+        new_TestFixture(test_nanocoap__block2_xfer_errors),
+        new_TestFixture(test_nanocoap__block1_xfer),
+        new_TestFixture(test_nanocoap__builder),
+        new_TestFixture(test_nanocoap__builder_nospc),
+        new_TestFixture(test_nanocoap__option_index),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "net/netstats/neighbor.h"
+
+#include "tests-netstats_neighbor.h"
+
+#define ETX_INIT    (NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR)
+
+static const uint8_t _addr[] = { 0x02, 0x00, 0x5e, 0x10, 0x00, 0x00, 0x00, 0x01 };
+static netstats_nb_table_t _table;
+
+static void set_up(void)
+{
+    netstats_nb_init(&_table);
+}
+
+static void test_netstats_nb_get__empty(void)
+{
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, _addr, sizeof(_addr)));
+}
+
+static void test_netstats_nb_record__multicast(void)
+{
+    TEST_ASSERT_NULL(netstats_nb_record(&_table, NULL, 0));
+    TEST_ASSERT_NULL(netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 1));
+}
+
+static void test_netstats_nb_record__success(void)
+{
+    netstats_nb_t *nb = netstats_nb_record(&_table, _addr, sizeof(_addr));
+
+    TEST_ASSERT_NOT_NULL(nb);
+    TEST_ASSERT(nb == netstats_nb_get(&_table, _addr, sizeof(_addr)));
+    TEST_ASSERT_EQUAL_INT(ETX_INIT, nb->etx);
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, _addr, sizeof(_addr) - 1));
+    /* recording the same address again must not create a new entry */
+    TEST_ASSERT(nb == netstats_nb_record(&_table, _addr, sizeof(_addr)));
+}
+
+static void test_netstats_nb_update_tx__success(void)
+{
+    netstats_nb_t *nb = netstats_nb_record(&_table, _addr, sizeof(_addr));
+
+    TEST_ASSERT(nb == netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 1));
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_attempts);
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_failed);
+    TEST_ASSERT(nb->etx < ETX_INIT);
+    TEST_ASSERT(nb->etx >= NETSTATS_NB_ETX_DIVISOR);
+    /* result was consumed */
+    TEST_ASSERT_NULL(netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 1));
+}
+
+static void test_netstats_nb_update_tx__noack(void)
+{
+    netstats_nb_t *nb = netstats_nb_record(&_table, _addr, sizeof(_addr));
+
+    TEST_ASSERT(nb == netstats_nb_update_tx(&_table, NETSTATS_NB_NOACK, 0));
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_failed);
+    TEST_ASSERT(nb->etx > ETX_INIT);
+}
+
+static void test_netstats_nb_update_tx__busy(void)
+{
+    netstats_nb_t *nb = netstats_nb_record(&_table, _addr, sizeof(_addr));
+
+    TEST_ASSERT(nb == netstats_nb_update_tx(&_table, NETSTATS_NB_BUSY, 0));
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(ETX_INIT, nb->etx);
+}
+
+static void test_netstats_nb_update_tx__converge(void)
+{
+    netstats_nb_t *nb = NULL;
+
+    for (unsigned i = 0; i < 100; i++) {
+        netstats_nb_record(&_table, _addr, sizeof(_addr));
+        nb = netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 3);
+    }
+    TEST_ASSERT_NOT_NULL(nb);
+    /* may be off by a few units due to the integer arithmetic */
+    TEST_ASSERT(nb->etx <= (3 * NETSTATS_NB_ETX_DIVISOR));
+    TEST_ASSERT(nb->etx > ((3 * NETSTATS_NB_ETX_DIVISOR) - 8));
+}
+
+static void test_netstats_nb_record__replace_lru(void)
+{
+    uint8_t addr[sizeof(_addr)];
+
+    memcpy(addr, _addr, sizeof(addr));
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        addr[sizeof(addr) - 1] = i;
+        TEST_ASSERT_NOT_NULL(netstats_nb_record(&_table, addr, sizeof(addr)));
+    }
+    /* use first entry, so the second is the least recently used one */
+    addr[sizeof(addr) - 1] = 0;
+    netstats_nb_record(&_table, addr, sizeof(addr));
+    addr[sizeof(addr) - 1] = NETSTATS_NB_SIZE;
+    TEST_ASSERT_NOT_NULL(netstats_nb_record(&_table, addr, sizeof(addr)));
+    TEST_ASSERT_NOT_NULL(netstats_nb_get(&_table, addr, sizeof(addr)));
+    addr[sizeof(addr) - 1] = 0;
+    TEST_ASSERT_NOT_NULL(netstats_nb_get(&_table, addr, sizeof(addr)));
+    addr[sizeof(addr) - 1] = 1;
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, addr, sizeof(addr)));
+}
+
+static void test_netstats_nb_update_rx__empty(void)
+{
+    TEST_ASSERT_NULL(netstats_nb_update_rx(&_table, NULL, 0, -70, 200));
+}
+
+static void test_netstats_nb_update_rx__success(void)
+{
+    netstats_nb_t *nb = netstats_nb_update_rx(&_table, _addr, sizeof(_addr),
+                                              -70, 200);
+
+    TEST_ASSERT_NOT_NULL(nb);
+    TEST_ASSERT(nb == netstats_nb_get(&_table, _addr, sizeof(_addr)));
+    TEST_ASSERT_EQUAL_INT(1, nb->rx_count);
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_count);
+    /* first frame is taken as is */
+    TEST_ASSERT_EQUAL_INT(-70, nb->rssi);
+    TEST_ASSERT_EQUAL_INT(200, nb->lqi);
+    /* further frames are averaged */
+    TEST_ASSERT(nb == netstats_nb_update_rx(&_table, _addr, sizeof(_addr),
+                                            -90, 100));
+    TEST_ASSERT_EQUAL_INT(2, nb->rx_count);
+    TEST_ASSERT(nb->rssi < -70);
+    TEST_ASSERT(nb->rssi > -90);
+    TEST_ASSERT(nb->lqi < 200);
+    TEST_ASSERT(nb->lqi > 100);
+    /* a received frame must not consume a pending TX result */
+    netstats_nb_record(&_table, _addr, sizeof(_addr));
+    netstats_nb_update_rx(&_table, _addr, sizeof(_addr), -70, 200);
+    TEST_ASSERT(nb == netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 2));
+    TEST_ASSERT_EQUAL_INT(2, nb->tx_attempts);
+}
+
+Test *tests_netstats_neighbor_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netstats_nb_get__empty),
+        new_TestFixture(test_netstats_nb_record__multicast),
+        new_TestFixture(test_netstats_nb_record__success),
+        new_TestFixture(test_netstats_nb_update_tx__success),
+        new_TestFixture(test_netstats_nb_update_tx__noack),
+        new_TestFixture(test_netstats_nb_update_tx__busy),
+        new_TestFixture(test_netstats_nb_update_tx__converge),
+        new_TestFixture(test_netstats_nb_record__replace_lru),
+        new_TestFixture(test_netstats_nb_update_rx__empty),
+        new_TestFixture(test_netstats_nb_update_rx__success),
+    };
+
+    EMB_UNIT_TESTCALLER(netstats_neighbor_tests, set_up, NULL, fixtures);
+
+    return (Test *)&netstats_neighbor_tests;
+}
+
+void tests_netstats_neighbor(void)
+{
+    TESTS_RUN(tests_netstats_neighbor_tests());
+}
+/** @} */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "riotboot/delta.h"
+
+#include "tests-riotboot_delta.h"
+
+static const char old_img[] = "RIOT firmware, version 1 - the quick brown fox "
+                              "jumps over the lazy dog";
+static const char new_img[] = "RIOT firmware, version 2 - the quick brown fox "
+                              "jumps over the lazy dog!!!the lazy dog";
+
+/* patch from old_img to new_img, the last 12 bytes are copied once more */
+static const uint8_t patch[] = {
+    0x45, 0x4e, 0x44, 0x53, 0x4c, 0x45, 0x59, 0x2f, 0x42, 0x53, 0x44, 0x49,
+    0x46, 0x46, 0x34, 0x33, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21,
+    0x21, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00,
+};
+
+static uint8_t page[8];
+static uint8_t result[sizeof(new_img)];
+static int write_res;
+
+static int _write(void *arg, size_t offset, const uint8_t *data, size_t len)
+{
+    (void)arg;
+    if ((len > sizeof(page)) || (offset + len > sizeof(result))) {
+        return -EFAULT;
+    }
+    memcpy(&result[offset], data, len);
+    return write_res;
+}
+
+static int _apply(const uint8_t *p, size_t len, size_t chunk)
+{
+    riotboot_delta_t delta;
+    int res;
+
+    memset(result, 0, sizeof(result));
+    riotboot_delta_init(&delta, (const uint8_t *)old_img, sizeof(old_img) - 1,
+                        page, sizeof(page), _write, NULL, false);
+    for (size_t pos = 0; pos < len; pos += chunk) {
+        res = riotboot_delta_feed(&delta, p + pos,
+                                  (len - pos < chunk) ? len - pos : chunk);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return riotboot_delta_finish(&delta);
+}
+
+static void test_riotboot_delta_apply(void)
+{
+    write_res = 0;
+    TEST_ASSERT_EQUAL_INT(sizeof(new_img) - 1, _apply(patch, sizeof(patch),
+                                                      sizeof(patch)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(new_img, result, sizeof(new_img) - 1));
+}
+
+static void test_riotboot_delta_apply_chunked(void)
+{
+    write_res = 0;
+    for (size_t chunk = 1; chunk < 30; chunk++) {
+        TEST_ASSERT_EQUAL_INT(sizeof(new_img) - 1,
+                              _apply(patch, sizeof(patch), chunk));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(new_img, result, sizeof(new_img) - 1));
+    }
+}
+
+static void test_riotboot_delta_truncated(void)
+{
+    write_res = 0;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _apply(patch, sizeof(patch) - 1, 16));
+}
+
+static void test_riotboot_delta_invalid(void)
+{
+    uint8_t tmp[sizeof(patch) + 1];
+
+    write_res = 0;
+    /* wrong magic */
+    memcpy(tmp, patch, sizeof(patch));
+    tmp[0] = 'X';
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _apply(tmp, sizeof(patch), 16));
+
+    /* diff block exceeding the announced image length */
+    memcpy(tmp, patch, sizeof(patch));
+    tmp[24] = 0x7f;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _apply(tmp, sizeof(patch), 16));
+
+    /* trailing data */
+    memcpy(tmp, patch, sizeof(patch));
+    tmp[sizeof(patch)] = 0;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _apply(tmp, sizeof(tmp), 16));
+}
+
+static void test_riotboot_delta_write_error(void)
+{
+    write_res = -EIO;
+    TEST_ASSERT_EQUAL_INT(-EIO, _apply(patch, sizeof(patch), 16));
+}
+
+Test *tests_riotboot_delta_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_riotboot_delta_apply),
+        new_TestFixture(test_riotboot_delta_apply_chunked),
+        new_TestFixture(test_riotboot_delta_truncated),
+        new_TestFixture(test_riotboot_delta_invalid),
+        new_TestFixture(test_riotboot_delta_write_error),
+    };
+
+    EMB_UNIT_TESTCALLER(riotboot_delta_tests, NULL, NULL, fixtures);
+
+    return (Test *)&riotboot_delta_tests;
+}
+
+void tests_riotboot_delta(void)
+{
+    TESTS_RUN(tests_riotboot_delta_tests());
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``riotboot_delta`` module
+ */
+#ifndef TESTS_RIOTBOOT_DELTA_H
+#define TESTS_RIOTBOOT_DELTA_H
+#include "embUnit/embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_riotboot_delta(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_RIOTBOOT_DELTA_H */
+/** @} */
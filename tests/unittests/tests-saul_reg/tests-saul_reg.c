@@ -23,6 +23,7 @@
 #include "embUnit/embUnit.h"
 
 #include "saul_reg.h"
+#include "timex.h"
 #include "tests-saul_reg.h"
 
 static const saul_driver_t s0_dri = { NULL, NULL, SAUL_ACT_SERVO };
@@ -30,10 +31,31 @@ static const saul_driver_t s1_dri = { NULL, NULL, SAUL_SENSE_TEMP };
 static const saul_driver_t s2_dri = { NULL, NULL, SAUL_SENSE_LIGHT };
 static const saul_driver_t s3_dri = { NULL, NULL, SAUL_ACT_LED_RGB };
 
-static saul_reg_t s0 = { NULL, NULL, "S0", &s0_dri };
-static saul_reg_t s1 = { NULL, NULL, "S1", &s1_dri };
-static saul_reg_t s2 = { NULL, NULL, "S2", &s2_dri };
-static saul_reg_t s3 = { NULL, NULL, "S3", &s3_dri };
+static saul_reg_t s0 = { .name = "S0", .driver = &s0_dri };
+static saul_reg_t s1 = { .name = "S1", .driver = &s1_dri };
+static saul_reg_t s2 = { .name = "S2", .driver = &s2_dri };
+static saul_reg_t s3 = { .name = "S3", .driver = &s3_dri };
+
+static unsigned s4_reads;
+
+static int s4_read(const void *dev, phydat_t *res)
+{
+    (void)dev;
+    res->val[0] = (int16_t)++s4_reads;
+    res->unit = UNIT_TEMP_C;
+    res->scale = 0;
+    return 1;
+}
+
+static int s4_write(const void *dev, phydat_t *data)
+{
+    (void)dev;
+    (void)data;
+    return 1;
+}
+
+static const saul_driver_t s4_dri = { s4_read, s4_write, SAUL_SENSE_TEMP };
+static saul_reg_t s4 = { .name = "S4", .driver = &s4_dri };
 
 
 static int count(void)
@@ -114,6 +136,17 @@ static void test_reg_find_nth(void)
 
     dev = saul_reg_find_nth(17);
     TEST_ASSERT_NULL(dev);
+
+    /* enumerating continues from the previous lookup */
+    for (int i = 0; i < 4; i++) {
+        dev = saul_reg_find_nth(i);
+        TEST_ASSERT_NOT_NULL(dev);
+        TEST_ASSERT(dev == saul_reg_find_nth(i));
+    }
+    TEST_ASSERT_EQUAL_STRING("S3", dev->name);
+    dev = saul_reg_find_nth(1);
+    TEST_ASSERT_NOT_NULL(dev);
+    TEST_ASSERT_EQUAL_STRING("S1", dev->name);
 }
 
 static void test_reg_find_type(void)
@@ -161,6 +194,10 @@ static void test_reg_rm(void)
     res = saul_reg_rm(&s1);
     TEST_ASSERT_EQUAL_INT(0, res);
     TEST_ASSERT_EQUAL_INT(2, count());
+    /* lookups must not return removed entries */
+    TEST_ASSERT_NULL(saul_reg_find_type(SAUL_SENSE_TEMP));
+    TEST_ASSERT_NULL(saul_reg_find_name("S1"));
+    TEST_ASSERT_EQUAL_STRING("S2", saul_reg_find_nth(1)->name);
     TEST_ASSERT_EQUAL_STRING("S0", saul_reg->name);
     TEST_ASSERT_EQUAL_STRING("S2", last()->name);
 
@@ -184,6 +221,53 @@ static void test_reg_rm(void)
     TEST_ASSERT_NULL(saul_reg);
 }
 
+static void test_reg_read(void)
+{
+    phydat_t data;
+
+    s4_reads = 0;
+    TEST_ASSERT_EQUAL_INT(-ENODEV, saul_reg_read(NULL, &data));
+    TEST_ASSERT_EQUAL_INT(1, saul_reg_read(&s4, &data));
+    TEST_ASSERT_EQUAL_INT(1, data.val[0]);
+    TEST_ASSERT_EQUAL_INT(UNIT_TEMP_C, data.unit);
+#ifdef MODULE_SAUL_REG_CACHE
+    /* a second read within the maximum age is served from the cache */
+    s4.max_age = 10U * US_PER_SEC;
+    TEST_ASSERT_EQUAL_INT(1, saul_reg_read(&s4, &data));
+    TEST_ASSERT_EQUAL_INT(1, data.val[0]);
+    /* writing invalidates the cache */
+    TEST_ASSERT_EQUAL_INT(1, saul_reg_write(&s4, &data));
+    TEST_ASSERT_EQUAL_INT(1, saul_reg_read(&s4, &data));
+    TEST_ASSERT_EQUAL_INT(2, data.val[0]);
+    TEST_ASSERT_EQUAL_INT(2, s4_reads);
+#endif
+}
+
+static void test_reg_read_batch(void)
+{
+    saul_reg_t *devs[] = { &s4, NULL, &s4 };
+    phydat_t data[3];
+    int dims[3];
+
+    s4_reads = 0;
+#ifdef MODULE_SAUL_REG_CACHE
+    s4.cache_dim = 0;
+#endif
+    TEST_ASSERT_EQUAL_INT(2, saul_reg_read_batch(devs, data, dims, 3));
+    TEST_ASSERT_EQUAL_INT(1, dims[0]);
+    TEST_ASSERT_EQUAL_INT(-ENODEV, dims[1]);
+    TEST_ASSERT_EQUAL_INT(1, dims[2]);
+    TEST_ASSERT_EQUAL_INT(1, data[0].val[0]);
+#ifdef MODULE_SAUL_REG_CACHE
+    /* the second read of the same entry hits the cache */
+    TEST_ASSERT_EQUAL_INT(1, data[2].val[0]);
+    TEST_ASSERT_EQUAL_INT(1, s4_reads);
+#else
+    TEST_ASSERT_EQUAL_INT(2, data[2].val[0]);
+#endif
+    TEST_ASSERT_EQUAL_INT(2, saul_reg_read_batch(devs, data, NULL, 3));
+}
+
 Test *tests_saul_reg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -192,6 +276,8 @@ Test *tests_saul_reg_tests(void)
         new_TestFixture(test_reg_find_nth),
         new_TestFixture(test_reg_find_type),
         new_TestFixture(test_reg_find_name),
+        new_TestFixture(test_reg_read),
+        new_TestFixture(test_reg_read_batch),
         new_TestFixture(test_reg_rm)
     };
 
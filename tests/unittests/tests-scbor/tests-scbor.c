@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include "embUnit.h"
+#include "tests-scbor.h"
+
+#include "scbor.h"
+
+/* the examples are taken from RFC 7049, appendix A */
+
+static uint8_t _buf[32];
+
+static void test_scbor_fmt_int(void)
+{
+    static const uint8_t exp[] = {
+        0x00, 0x17, 0x18, 0x18, 0x18, 0x64, 0x19, 0x03, 0xe8,
+        0x1a, 0x00, 0x0f, 0x42, 0x40,
+        0x1b, 0x00, 0x00, 0x00, 0xe8, 0xd4, 0xa5, 0x10, 0x00,
+        0x20, 0x38, 0x63, 0x39, 0x03, 0xe7,
+    };
+    scbor_enc_t enc;
+
+    scbor_enc_init(&enc, _buf, sizeof(_buf));
+    scbor_fmt_uint(&enc, 0);
+    scbor_fmt_uint(&enc, 23);
+    scbor_fmt_uint(&enc, 24);
+    scbor_fmt_int(&enc, 100);
+    scbor_fmt_int(&enc, 1000);
+    scbor_fmt_uint(&enc, 1000000);
+    scbor_fmt_uint(&enc, 1000000000000);
+    scbor_fmt_int(&enc, -1);
+    scbor_fmt_int(&enc, -100);
+    scbor_fmt_int(&enc, -1000);
+    TEST_ASSERT_EQUAL_INT(sizeof(exp), scbor_enc_len(&enc));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, _buf, sizeof(exp)));
+}
+
+static void test_scbor_fmt_simple(void)
+{
+    static const uint8_t exp[] = {
+        0xf4, 0xf5, 0xf6, 0xfa, 0x47, 0xc3, 0x50, 0x00,
+        0x60, 0x64, 0x49, 0x45, 0x54, 0x46, 0x44, 0x01, 0x02, 0x03, 0x04,
+        0xc1, 0x1a, 0x51, 0x4b, 0x67, 0xb0,
+    };
+    static const uint8_t bytes[] = { 1, 2, 3, 4 };
+    scbor_enc_t enc;
+
+    scbor_enc_init(&enc, _buf, sizeof(_buf));
+    scbor_fmt_bool(&enc, false);
+    scbor_fmt_bool(&enc, true);
+    scbor_fmt_null(&enc);
+    scbor_fmt_float(&enc, 100000.0f);
+    scbor_put_tstr(&enc, "");
+    scbor_put_tstr(&enc, "IETF");
+    scbor_put_bstr(&enc, bytes, sizeof(bytes));
+    scbor_fmt_tag(&enc, 1);
+    scbor_fmt_uint(&enc, 1363896240);
+    TEST_ASSERT_EQUAL_INT(sizeof(exp), scbor_enc_len(&enc));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, _buf, sizeof(exp)));
+}
+
+static void test_scbor_fmt_containers(void)
+{
+    /* {"a": 1, "b": [2, 3]} followed by [_ 1, [2, 3], [_ 4, 5]] */
+    static const uint8_t exp[] = {
+        0xa2, 0x61, 0x61, 0x01, 0x61, 0x62, 0x82, 0x02, 0x03,
+        0x9f, 0x01, 0x82, 0x02, 0x03, 0x9f, 0x04, 0x05, 0xff, 0xff,
+    };
+    scbor_enc_t enc;
+
+    scbor_enc_init(&enc, _buf, sizeof(_buf));
+    scbor_fmt_map(&enc, 2);
+    scbor_put_tstr(&enc, "a");
+    scbor_fmt_uint(&enc, 1);
+    scbor_put_tstr(&enc, "b");
+    scbor_fmt_array(&enc, 2);
+    scbor_fmt_uint(&enc, 2);
+    scbor_fmt_uint(&enc, 3);
+    scbor_fmt_array_indefinite(&enc);
+    scbor_fmt_uint(&enc, 1);
+    scbor_fmt_array(&enc, 2);
+    scbor_fmt_uint(&enc, 2);
+    scbor_fmt_uint(&enc, 3);
+    scbor_fmt_array_indefinite(&enc);
+    scbor_fmt_uint(&enc, 4);
+    scbor_fmt_uint(&enc, 5);
+    scbor_fmt_end(&enc);
+    scbor_fmt_end(&enc);
+    TEST_ASSERT_EQUAL_INT(sizeof(exp), scbor_enc_len(&enc));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, _buf, sizeof(exp)));
+}
+
+static void test_scbor_fmt_overflow(void)
+{
+    scbor_enc_t enc;
+
+    /* only the length is computed without buffer */
+    scbor_enc_init(&enc, NULL, 0);
+    scbor_put_tstr(&enc, "IETF");
+    scbor_fmt_uint(&enc, 1000);
+    TEST_ASSERT_EQUAL_INT(8, scbor_enc_len(&enc));
+
+    memset(_buf, 0, sizeof(_buf));
+    scbor_enc_init(&enc, _buf, 4);
+    scbor_fmt_uint(&enc, 24);
+    scbor_put_tstr(&enc, "IETF");
+    scbor_fmt_null(&enc);
+    TEST_ASSERT_EQUAL_INT(8, scbor_enc_len(&enc));
+    /* the null would fit, but nothing may be written after the string */
+    TEST_ASSERT_EQUAL_INT(0x18, _buf[0]);
+    TEST_ASSERT_EQUAL_INT(0x18, _buf[1]);
+    TEST_ASSERT_EQUAL_INT(0x64, _buf[2]);
+    TEST_ASSERT_EQUAL_INT(0x00, _buf[3]);
+}
+
+static void test_scbor_get_map(void)
+{
+    static const uint8_t in[] = {
+        0xa2, 0x61, 0x61, 0x01, 0x61, 0x62, 0x82, 0x02, 0x03, 0xf5,
+    };
+    scbor_value_t val, map, arr;
+    const char *str;
+    size_t len;
+    uint32_t u;
+    int32_t i;
+    bool b;
+
+    scbor_decoder_init(&val, in, sizeof(in));
+    TEST_ASSERT_EQUAL_INT(SCBOR_TYPE_MAP, scbor_get_type(&val));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_enter_array(&val, &arr));
+    TEST_ASSERT_EQUAL_INT(0, scbor_enter_map(&val, &map));
+    TEST_ASSERT_EQUAL_INT(2, scbor_get_tstr(&map, &str, &len));
+    TEST_ASSERT_EQUAL_INT(1, len);
+    TEST_ASSERT_EQUAL_INT('a', str[0]);
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_uint32(&map, &u));
+    TEST_ASSERT_EQUAL_INT(1, u);
+    TEST_ASSERT_EQUAL_INT(2, scbor_get_tstr(&map, &str, &len));
+    TEST_ASSERT_EQUAL_INT('b', str[0]);
+    TEST_ASSERT_EQUAL_INT(0, scbor_enter_array(&map, &arr));
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_int32(&arr, &i));
+    TEST_ASSERT_EQUAL_INT(2, i);
+    TEST_ASSERT(!scbor_at_end(&arr));
+    /* the remaining item is skipped */
+    TEST_ASSERT_EQUAL_INT(0, scbor_leave_container(&map, &arr));
+    TEST_ASSERT(scbor_at_end(&map));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, scbor_get_uint32(&map, &u));
+    TEST_ASSERT_EQUAL_INT(0, scbor_leave_container(&val, &map));
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_bool(&val, &b));
+    TEST_ASSERT(b);
+    TEST_ASSERT(scbor_at_end(&val));
+}
+
+static void test_scbor_get_indefinite(void)
+{
+    /* [_ 1, [2, 3], [_ 4, 5]], null */
+    static const uint8_t in[] = {
+        0x9f, 0x01, 0x82, 0x02, 0x03, 0x9f, 0x04, 0x05, 0xff, 0xff, 0xf6,
+    };
+    scbor_value_t val, arr, inner;
+    uint32_t u;
+
+    scbor_decoder_init(&val, in, sizeof(in));
+    TEST_ASSERT_EQUAL_INT(0, scbor_enter_array(&val, &arr));
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_uint32(&arr, &u));
+    TEST_ASSERT_EQUAL_INT(1, u);
+    TEST_ASSERT_EQUAL_INT(0, scbor_skip(&arr));
+    TEST_ASSERT_EQUAL_INT(0, scbor_enter_array(&arr, &inner));
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_uint32(&inner, &u));
+    TEST_ASSERT_EQUAL_INT(4, u);
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_uint32(&inner, &u));
+    TEST_ASSERT_EQUAL_INT(5, u);
+    TEST_ASSERT(scbor_at_end(&inner));
+    TEST_ASSERT_EQUAL_INT(0, scbor_leave_container(&arr, &inner));
+    TEST_ASSERT(scbor_at_end(&arr));
+    TEST_ASSERT_EQUAL_INT(0, scbor_leave_container(&val, &arr));
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_null(&val));
+    TEST_ASSERT(scbor_at_end(&val));
+
+    /* the same when skipping everything at once */
+    scbor_decoder_init(&val, in, sizeof(in));
+    TEST_ASSERT_EQUAL_INT(0, scbor_skip(&val));
+    TEST_ASSERT_EQUAL_INT(0, scbor_skip(&val));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, scbor_skip(&val));
+}
+
+static void test_scbor_get_errors(void)
+{
+    static const uint8_t big[] = {
+        0x1b, 0x00, 0x00, 0x00, 0xe8, 0xd4, 0xa5, 0x10, 0x00,
+    };
+    static const uint8_t min[] = { 0x3a, 0x7f, 0xff, 0xff, 0xff };
+    static const uint8_t trunc[] = { 0x19, 0x03 };
+    static const uint8_t str[] = { 0x64, 0x49, 0x45 };
+    static const uint8_t nint[] = { 0x20 };
+    static const uint8_t arr[] = { 0x83, 0x01 };
+    scbor_value_t val, inner;
+    const uint8_t *buf;
+    size_t len;
+    uint32_t u;
+    int32_t i;
+    float f;
+
+    scbor_decoder_init(&val, big, sizeof(big));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, scbor_get_uint32(&val, &u));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, scbor_get_int32(&val, &i));
+    TEST_ASSERT_EQUAL_INT(0, scbor_skip(&val));
+
+    scbor_decoder_init(&val, min, sizeof(min));
+    TEST_ASSERT_EQUAL_INT(5, scbor_get_int32(&val, &i));
+    TEST_ASSERT_EQUAL_INT(INT32_MIN, i);
+
+    scbor_decoder_init(&val, trunc, sizeof(trunc));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_get_uint32(&val, &u));
+
+    scbor_decoder_init(&val, str, sizeof(str));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_get_uint32(&val, &u));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_get_bstr(&val, &buf, &len));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_skip(&val));
+
+    scbor_decoder_init(&val, nint, sizeof(nint));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_get_uint32(&val, &u));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_get_float(&val, &f));
+    TEST_ASSERT_EQUAL_INT(1, scbor_get_int32(&val, &i));
+    TEST_ASSERT_EQUAL_INT(-1, i);
+
+    scbor_decoder_init(&val, arr, sizeof(arr));
+    TEST_ASSERT_EQUAL_INT(0, scbor_enter_array(&val, &inner));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, scbor_leave_container(&val, &inner));
+
+    scbor_decoder_init(&val, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, scbor_get_type(&val));
+}
+
+static void test_scbor_roundtrip(void)
+{
+    scbor_enc_t enc;
+    scbor_value_t val;
+    float f;
+    uint32_t tag;
+
+    scbor_enc_init(&enc, _buf, sizeof(_buf));
+    scbor_fmt_tag(&enc, 100000);
+    scbor_fmt_float(&enc, -1.5f);
+    TEST_ASSERT_EQUAL_INT(10, scbor_enc_len(&enc));
+
+    scbor_decoder_init(&val, _buf, scbor_enc_len(&enc));
+    TEST_ASSERT_EQUAL_INT(SCBOR_TYPE_TAG, scbor_get_type(&val));
+    TEST_ASSERT_EQUAL_INT(5, scbor_get_tag(&val, &tag));
+    TEST_ASSERT_EQUAL_INT(100000, tag);
+    TEST_ASSERT_EQUAL_INT(5, scbor_get_float(&val, &f));
+    TEST_ASSERT(f == -1.5f);
+    TEST_ASSERT(scbor_at_end(&val));
+}
+
+Test *tests_scbor_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_scbor_fmt_int),
+        new_TestFixture(test_scbor_fmt_simple),
+        new_TestFixture(test_scbor_fmt_containers),
+        new_TestFixture(test_scbor_fmt_overflow),
+        new_TestFixture(test_scbor_get_map),
+        new_TestFixture(test_scbor_get_indefinite),
+        new_TestFixture(test_scbor_get_errors),
+        new_TestFixture(test_scbor_roundtrip),
+    };
+
+    EMB_UNIT_TESTCALLER(scbor_tests, NULL, NULL, fixtures);
+
+    return (Test *)&scbor_tests;
+}
+
+void tests_scbor(void)
+{
+    TESTS_RUN(tests_scbor_tests());
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the scbor library
+ */
+#ifndef TESTS_SCBOR_H
+#define TESTS_SCBOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_scbor(void);
+
+/**
+ * @brief   Generates tests for scbor
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_scbor_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_SCBOR_H */
+/** @} */
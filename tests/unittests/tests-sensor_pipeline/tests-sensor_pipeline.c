@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "sensor_pipeline.h"
+
+#include "tests-sensor_pipeline.h"
+
+#define ARRAY_SIZE(a)   (sizeof(a) / sizeof((a)[0]))
+
+static int16_t _values[12];
+static sensor_pipeline_buf_t _buf;
+
+static void _fill(const int16_t *values, unsigned numof, unsigned dim)
+{
+    memcpy(_values, values, numof * sizeof(int16_t));
+    _buf.values = _values;
+    _buf.numof = numof;
+    _buf.size = ARRAY_SIZE(_values);
+    _buf.dim = dim;
+}
+
+static void test_sensor_pipeline_delta(void)
+{
+    static const int16_t in[] = { -32000, 100, 32000, 90, 32010, 80 };
+    static const int16_t out[] = { -32000, 100, INT16_MAX, -10, 10, -10 };
+    sensor_pipeline_delta_t delta;
+
+    sensor_pipeline_delta_init(&delta);
+    _fill(in, ARRAY_SIZE(in), 2);
+    TEST_ASSERT_EQUAL_INT(SENSOR_PIPELINE_NEXT,
+                          delta.stage.process(&delta.stage, &_buf));
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(out), _buf.numof);
+    for (unsigned i = 0; i < ARRAY_SIZE(out); i++) {
+        TEST_ASSERT_EQUAL_INT(out[i], _values[i]);
+    }
+}
+
+static void test_sensor_pipeline_aggr(void)
+{
+    static const int16_t first[] = { 1, -1, 5, -5, 3, -3 };
+    static const int16_t second[] = { 7, -7, 100, 0 };
+    sensor_pipeline_aggr_t aggr;
+
+    sensor_pipeline_aggr_init(&aggr, 4, SENSOR_PIPELINE_AGGR_MIN |
+                                        SENSOR_PIPELINE_AGGR_MAX);
+
+    /* 3 of 4 samples: nothing to pass on yet */
+    _fill(first, ARRAY_SIZE(first), 2);
+    TEST_ASSERT_EQUAL_INT(SENSOR_PIPELINE_DROP,
+                          aggr.stage.process(&aggr.stage, &_buf));
+    TEST_ASSERT_EQUAL_INT(0, _buf.numof);
+
+    /* the window completes with the first sample of the second batch */
+    _fill(second, ARRAY_SIZE(second), 2);
+    TEST_ASSERT_EQUAL_INT(SENSOR_PIPELINE_NEXT,
+                          aggr.stage.process(&aggr.stage, &_buf));
+    TEST_ASSERT_EQUAL_INT(4, _buf.dim);
+    TEST_ASSERT_EQUAL_INT(4, _buf.numof);
+    TEST_ASSERT_EQUAL_INT(1, _values[0]);
+    TEST_ASSERT_EQUAL_INT(7, _values[1]);
+    TEST_ASSERT_EQUAL_INT(-7, _values[2]);
+    TEST_ASSERT_EQUAL_INT(-1, _values[3]);
+    TEST_ASSERT_EQUAL_INT(1, aggr.count);
+}
+
+static void test_sensor_pipeline_ema(void)
+{
+    static const int16_t in[] = { 100, 200, 200, 200 };
+    sensor_pipeline_ema_t ema;
+
+    sensor_pipeline_ema_init(&ema, 1);
+    _fill(in, ARRAY_SIZE(in), 1);
+    TEST_ASSERT_EQUAL_INT(SENSOR_PIPELINE_NEXT,
+                          ema.stage.process(&ema.stage, &_buf));
+    TEST_ASSERT_EQUAL_INT(100, _values[0]);
+    TEST_ASSERT_EQUAL_INT(150, _values[1]);
+    TEST_ASSERT_EQUAL_INT(175, _values[2]);
+    TEST_ASSERT_EQUAL_INT(187, _values[3]);
+}
+
+static void test_sensor_pipeline_encode(void)
+{
+    static const int16_t in[] = { 1, -2 };
+    uint8_t out[SENSOR_PIPELINE_ENCODED_LEN(2)];
+
+    _fill(in, ARRAY_SIZE(in), 2);
+    _buf.unit = UNIT_TEMP_C;
+    _buf.scale = -2;
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS,
+                          sensor_pipeline_encode(&_buf, out, sizeof(out) - 1));
+    TEST_ASSERT_EQUAL_INT(sizeof(out),
+                          sensor_pipeline_encode(&_buf, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(UNIT_TEMP_C, out[0]);
+    TEST_ASSERT_EQUAL_INT(0xfe, out[1]);
+    TEST_ASSERT_EQUAL_INT(2, out[2]);
+    TEST_ASSERT_EQUAL_INT(0, out[3]);
+    TEST_ASSERT_EQUAL_INT(2, out[4]);
+    TEST_ASSERT_EQUAL_INT(0x00, out[5]);
+    TEST_ASSERT_EQUAL_INT(0x01, out[6]);
+    TEST_ASSERT_EQUAL_INT(0xff, out[7]);
+    TEST_ASSERT_EQUAL_INT(0xfe, out[8]);
+}
+
+Test *tests_sensor_pipeline_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sensor_pipeline_delta),
+        new_TestFixture(test_sensor_pipeline_aggr),
+        new_TestFixture(test_sensor_pipeline_ema),
+        new_TestFixture(test_sensor_pipeline_encode),
+    };
+
+    EMB_UNIT_TESTCALLER(sensor_pipeline_tests, NULL, NULL, fixtures);
+
+    return (Test *)&sensor_pipeline_tests;
+}
+
+void tests_sensor_pipeline(void)
+{
+    TESTS_RUN(tests_sensor_pipeline_tests());
+}
+/** @} */
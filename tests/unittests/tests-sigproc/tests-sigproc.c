@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <errno.h>
+#include "embUnit.h"
+#include "tests-sigproc.h"
+
+#include "sigproc.h"
+
+#define BLOCK_SIZE      (8U)
+
+/* moving average over four samples */
+static const int16_t _avg4[] = { 8192, 8192, 8192, 8192 };
+
+static int16_t _state[SIGPROC_FIR_STATE_LEN(4, BLOCK_SIZE)];
+
+static void test_sigproc_fir_init_invalid(void)
+{
+    sigproc_fir_t fir;
+    static const int16_t odd[] = { 1, 2, 3, 4, 5 };
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          sigproc_fir_init(&fir, odd, 5, 1, _state, 4));
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          sigproc_fir_init(&fir, _avg4, 2, 1, _state, 4));
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          sigproc_fir_init(&fir, _avg4, 4, 0, _state, 4));
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          sigproc_fir_init(&fir, _avg4, 4, 3, _state, 4));
+}
+
+static void test_sigproc_fir_step(void)
+{
+    sigproc_fir_t fir;
+    static const int16_t in[BLOCK_SIZE] = {
+        4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000
+    };
+    static const int16_t exp[BLOCK_SIZE] = {
+        1000, 2000, 3000, 4000, 4000, 4000, 4000, 4000
+    };
+    int16_t out[BLOCK_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(0, sigproc_fir_init(&fir, _avg4, 4, 1, _state,
+                                              BLOCK_SIZE));
+    sigproc_fir(&fir, in, out, BLOCK_SIZE);
+    for (unsigned i = 0; i < BLOCK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(exp[i], out[i]);
+    }
+}
+
+static void test_sigproc_fir_blocks(void)
+{
+    sigproc_fir_t fir;
+    static const int16_t in[BLOCK_SIZE] = {
+        100, -200, 300, -400, 500, -600, 700, -800
+    };
+    int16_t whole[BLOCK_SIZE];
+    int16_t split[BLOCK_SIZE];
+
+    /* the history must carry over from one block to the next */
+    sigproc_fir_init(&fir, _avg4, 4, 1, _state, BLOCK_SIZE);
+    sigproc_fir(&fir, in, whole, BLOCK_SIZE);
+    sigproc_fir_init(&fir, _avg4, 4, 1, _state, BLOCK_SIZE);
+    sigproc_fir(&fir, in, split, BLOCK_SIZE / 2);
+    sigproc_fir(&fir, &in[BLOCK_SIZE / 2], &split[BLOCK_SIZE / 2],
+                BLOCK_SIZE / 2);
+    for (unsigned i = 0; i < BLOCK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(whole[i], split[i]);
+    }
+}
+
+static void test_sigproc_fir_decimate(void)
+{
+    sigproc_fir_t fir;
+    static const int16_t in[BLOCK_SIZE] = {
+        4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000
+    };
+    static const int16_t exp[BLOCK_SIZE / 2] = { 1000, 3000, 4000, 4000 };
+    int16_t out[BLOCK_SIZE / 2];
+
+    TEST_ASSERT_EQUAL_INT(0, sigproc_fir_init(&fir, _avg4, 4, 2, _state,
+                                              BLOCK_SIZE));
+    sigproc_fir(&fir, in, out, BLOCK_SIZE);
+    for (unsigned i = 0; i < BLOCK_SIZE / 2; i++) {
+        TEST_ASSERT_EQUAL_INT(exp[i], out[i]);
+    }
+}
+
+static void test_sigproc_biquad_lowpass(void)
+{
+    sigproc_biquad_t iir;
+    int16_t state[SIGPROC_BIQUAD_STATE_LEN(1)];
+    /* y[n] = 0.5 * x[n] + 0.5 * y[n-1] */
+    static const int16_t coeffs[] = { 16384, 0, 0, 0, 16384, 0 };
+    static const int16_t in[] = { 1000, 1000, 1000, 1000 };
+    static const int16_t exp[] = { 500, 750, 875, 937 };
+    int16_t out[4];
+
+    TEST_ASSERT_EQUAL_INT(0, sigproc_biquad_init(&iir, coeffs, 1, state, 0));
+    sigproc_biquad(&iir, in, out, 4);
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(exp[i], out[i]);
+    }
+}
+
+static void test_sigproc_biquad_cascade(void)
+{
+    sigproc_biquad_t iir;
+    int16_t state[SIGPROC_BIQUAD_STATE_LEN(2)];
+    /* a unity stage in Q14 followed by a one sample delay */
+    static const int16_t coeffs[] = {
+        16384, 0, 0, 0, 0, 0,
+        0, 0, 16384, 0, 0, 0,
+    };
+    int16_t buf[] = { 1, -2, 3, -4, 32767 };
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          sigproc_biquad_init(&iir, coeffs, 2, state, 16));
+    TEST_ASSERT_EQUAL_INT(0, sigproc_biquad_init(&iir, coeffs, 2, state, 1));
+    /* filtering in place */
+    sigproc_biquad(&iir, buf, buf, 5);
+    TEST_ASSERT_EQUAL_INT(0, buf[0]);
+    TEST_ASSERT_EQUAL_INT(1, buf[1]);
+    TEST_ASSERT_EQUAL_INT(-2, buf[2]);
+    TEST_ASSERT_EQUAL_INT(3, buf[3]);
+    TEST_ASSERT_EQUAL_INT(-4, buf[4]);
+}
+
+static void test_sigproc_rms(void)
+{
+    static const int16_t dc[] = { 1000, 1000, 1000, 1000 };
+    static const int16_t square[] = { 16384, -16384, 16384, -16384 };
+    static const int16_t full[] = { -32768, -32768 };
+
+    TEST_ASSERT_EQUAL_INT(1000, sigproc_rms(dc, 4));
+    TEST_ASSERT_EQUAL_INT(16384, sigproc_rms(square, 4));
+    TEST_ASSERT_EQUAL_INT(32767, sigproc_rms(full, 2));
+}
+
+Test *tests_sigproc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sigproc_fir_init_invalid),
+        new_TestFixture(test_sigproc_fir_step),
+        new_TestFixture(test_sigproc_fir_blocks),
+        new_TestFixture(test_sigproc_fir_decimate),
+        new_TestFixture(test_sigproc_biquad_lowpass),
+        new_TestFixture(test_sigproc_biquad_cascade),
+        new_TestFixture(test_sigproc_rms),
+    };
+
+    EMB_UNIT_TESTCALLER(sigproc_tests, NULL, NULL, fixtures);
+
+    return (Test *)&sigproc_tests;
+}
+
+void tests_sigproc(void)
+{
+    TESTS_RUN(tests_sigproc_tests());
+}
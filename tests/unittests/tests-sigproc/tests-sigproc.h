@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the sigproc library
+ */
+#ifndef TESTS_SIGPROC_H
+#define TESTS_SIGPROC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_sigproc(void);
+
+/**
+ * @brief   Generates tests for sigproc
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_sigproc_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_SIGPROC_H */
+/** @} */
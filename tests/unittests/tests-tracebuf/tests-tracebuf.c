@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include "embUnit.h"
+
+#include "tracebuf.h"
+
+#include "tests-tracebuf.h"
+
+static void set_up(void)
+{
+    tracebuf_enable(true);
+    tracebuf_clear();
+}
+
+static void tear_down(void)
+{
+    tracebuf_enable(true);
+}
+
+static void test_tracebuf_add_get(void)
+{
+    tracebuf_entry_t entry;
+
+    TEST_ASSERT_EQUAL_INT(0, tracebuf_count());
+    TEST_ASSERT_EQUAL_INT(-1, tracebuf_get(0, &entry));
+
+    tracebuf_add(TRACEBUF_USER, 42);
+    tracebuf_add(TRACEBUF_USER + 1, 0xdeadbeef);
+    TEST_ASSERT_EQUAL_INT(2, tracebuf_count());
+    TEST_ASSERT_EQUAL_INT(0, tracebuf_get(0, &entry));
+    TEST_ASSERT_EQUAL_INT(TRACEBUF_USER, entry.id);
+    TEST_ASSERT_EQUAL_INT(42, entry.arg);
+    TEST_ASSERT_EQUAL_INT(0, tracebuf_get(1, &entry));
+    TEST_ASSERT_EQUAL_INT(TRACEBUF_USER + 1, entry.id);
+    TEST_ASSERT(entry.arg == 0xdeadbeef);
+    TEST_ASSERT_EQUAL_INT(-1, tracebuf_get(2, &entry));
+}
+
+static void test_tracebuf_wrap(void)
+{
+    tracebuf_entry_t entry;
+
+    /* the oldest events are overwritten */
+    for (unsigned i = 0; i < TRACEBUF_SIZE + 3; i++) {
+        tracebuf_add(TRACEBUF_USER, i);
+    }
+    TEST_ASSERT_EQUAL_INT(TRACEBUF_SIZE, tracebuf_count());
+    TEST_ASSERT_EQUAL_INT(0, tracebuf_get(0, &entry));
+    TEST_ASSERT_EQUAL_INT(3, entry.arg);
+    TEST_ASSERT_EQUAL_INT(0, tracebuf_get(TRACEBUF_SIZE - 1, &entry));
+    TEST_ASSERT_EQUAL_INT(TRACEBUF_SIZE + 2, entry.arg);
+}
+
+static void test_tracebuf_disabled(void)
+{
+    tracebuf_enable(false);
+    tracebuf_add(TRACEBUF_USER, 1);
+    TEST_ASSERT_EQUAL_INT(0, tracebuf_count());
+}
+
+Test *tests_tracebuf_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_tracebuf_add_get),
+        new_TestFixture(test_tracebuf_wrap),
+        new_TestFixture(test_tracebuf_disabled),
+    };
+
+    EMB_UNIT_TESTCALLER(tracebuf_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tracebuf_tests;
+}
+
+void tests_tracebuf(void)
+{
+    TESTS_RUN(tests_tracebuf_tests());
+}
+/** @} */
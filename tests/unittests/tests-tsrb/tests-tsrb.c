@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "tsrb.h"
+
+#include "tests-tsrb.h"
+
+#define BUF_SIZE    (16U)
+
+static char _buf[BUF_SIZE];
+static tsrb_t _rb;
+
+static void set_up(void)
+{
+    memset(_buf, 0, sizeof(_buf));
+    tsrb_init(&_rb, _buf, sizeof(_buf));
+}
+
+static void test_tsrb_one(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, tsrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_rb, 'a'));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_rb, (char)0xff));
+    TEST_ASSERT_EQUAL_INT(2, tsrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT('a', tsrb_get_one(&_rb));
+    /* bytes >= 0x80 must not be mistaken for an empty buffer */
+    TEST_ASSERT_EQUAL_INT(0xff, tsrb_get_one(&_rb));
+    TEST_ASSERT(tsrb_empty(&_rb));
+}
+
+static void test_tsrb_bulk__wrap(void)
+{
+    char out[BUF_SIZE];
+
+    /* move the indices close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(12, tsrb_add(&_rb, "0123456789ab", 12));
+    TEST_ASSERT_EQUAL_INT(12, tsrb_drop(&_rb, 12));
+
+    TEST_ASSERT_EQUAL_INT(10, tsrb_add(&_rb, "ABCDEFGHIJ", 10));
+    TEST_ASSERT_EQUAL_INT(10, tsrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(10, tsrb_get(&_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "ABCDEFGHIJ", 10));
+    TEST_ASSERT(tsrb_empty(&_rb));
+}
+
+static void test_tsrb_bulk__full(void)
+{
+    char out[4];
+
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE, tsrb_add(&_rb, "0123456789abcdefXYZ", 19));
+    TEST_ASSERT(tsrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_add(&_rb, "X", 1));
+    TEST_ASSERT_EQUAL_INT(-1, tsrb_add_one(&_rb, 'X'));
+    TEST_ASSERT_EQUAL_INT(4, tsrb_get(&_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "0123", 4));
+    TEST_ASSERT_EQUAL_INT(4, tsrb_free(&_rb));
+}
+
+static void test_tsrb_regions(void)
+{
+    char *ptr;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_region(&_rb, &ptr));
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE, tsrb_space_region(&_rb, &ptr));
+    memcpy(ptr, "0123456789ab", 12);
+    tsrb_commit(&_rb, 12);
+    TEST_ASSERT_EQUAL_INT(12, tsrb_drop(&_rb, 12));
+
+    /* free space wraps, only the part up to the end is returned */
+    TEST_ASSERT_EQUAL_INT(4, tsrb_space_region(&_rb, &ptr));
+    TEST_ASSERT(ptr == &_buf[12]);
+    memcpy(ptr, "ABCD", 4);
+    tsrb_commit(&_rb, 4);
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE - 4, tsrb_space_region(&_rb, &ptr));
+    TEST_ASSERT(ptr == &_buf[0]);
+    memcpy(ptr, "EF", 2);
+    tsrb_commit(&_rb, 2);
+    TEST_ASSERT_EQUAL_INT(6, tsrb_avail(&_rb));
+
+    TEST_ASSERT_EQUAL_INT(4, tsrb_peek_region(&_rb, &ptr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ptr, "ABCD", 4));
+    TEST_ASSERT_EQUAL_INT(4, tsrb_drop(&_rb, 4));
+    TEST_ASSERT_EQUAL_INT(2, tsrb_peek_region(&_rb, &ptr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ptr, "EF", 2));
+    TEST_ASSERT_EQUAL_INT(2, tsrb_drop(&_rb, 10));
+    TEST_ASSERT(tsrb_empty(&_rb));
+}
+
+Test *tests_tsrb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_tsrb_one),
+        new_TestFixture(test_tsrb_bulk__wrap),
+        new_TestFixture(test_tsrb_bulk__full),
+        new_TestFixture(test_tsrb_regions),
+    };
+
+    EMB_UNIT_TESTCALLER(tsrb_tests, set_up, NULL, fixtures);
+
+    return (Test *)&tsrb_tests;
+}
+
+void tests_tsrb(void)
+{
+    TESTS_RUN(tests_tsrb_tests());
+}
+/** @} */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <string.h>
+
+#include "tests-ubjson.h"
+
+#define CHUNK_SIZE  (4)
+#define NUMOF(a)    (sizeof(a) / sizeof((a)[0]))
+
+typedef struct {
+    ubjson_cookie_t cookie;
+    char data[64];
+    size_t len;
+    size_t pos;
+    unsigned writes;
+    ubjson_type_t events[16];
+    ssize_t contents[16];
+    unsigned num_events;
+} test_ubjson_iterative_cookie_t;
+
+static test_ubjson_iterative_cookie_t _state;
+
+static ssize_t _write_fun(ubjson_cookie_t *restrict cookie, const void *buf, size_t len)
+{
+    test_ubjson_iterative_cookie_t *state;
+    state = container_of(cookie, test_ubjson_iterative_cookie_t, cookie);
+
+    if (state->len + len > sizeof(state->data)) {
+        return -1;
+    }
+    memcpy(&state->data[state->len], buf, len);
+    state->len += len;
+    ++state->writes;
+    return len;
+}
+
+static ssize_t _read_fun(ubjson_cookie_t *restrict cookie, void *buf, size_t len)
+{
+    test_ubjson_iterative_cookie_t *state;
+    state = container_of(cookie, test_ubjson_iterative_cookie_t, cookie);
+
+    if (state->pos + len > state->len) {
+        return -1;
+    }
+    memcpy(buf, &state->data[state->pos], len);
+    state->pos += len;
+    return len;
+}
+
+static ubjson_read_callback_result_t _callback(ubjson_cookie_t *restrict cookie,
+                                               ubjson_type_t type1, ssize_t content1,
+                                               ubjson_type_t type2, ssize_t content2)
+{
+    (void) type2, (void) content2;
+
+    test_ubjson_iterative_cookie_t *state;
+    state = container_of(cookie, test_ubjson_iterative_cookie_t, cookie);
+
+    if (state->num_events == NUMOF(state->events)) {
+        return UBJSON_ABORTED;
+    }
+    state->events[state->num_events] = type1;
+    state->contents[state->num_events] = content1;
+    ++state->num_events;
+
+    if (type1 == UBJSON_KEY) {
+        char key[4];
+        if ((content1 >= (ssize_t) sizeof(key)) ||
+            (ubjson_get_string(cookie, content1, key) != content1)) {
+            return UBJSON_ABORTED;
+        }
+    }
+    else if (type1 == UBJSON_TYPE_INT32) {
+        int32_t value;
+        if (ubjson_get_i32(cookie, content1, &value) <= 0) {
+            return UBJSON_ABORTED;
+        }
+        state->contents[state->num_events - 1] = value;
+    }
+    return UBJSON_OKAY;
+}
+
+static void _write_document(void)
+{
+    /* {"a": [1, [300]], "bc": null} */
+    ubjson_cookie_t *cookie = &_state.cookie;
+    char buf[CHUNK_SIZE];
+
+    ubjson_write_init_buffered(cookie, _write_fun, buf, sizeof(buf));
+    TEST_ASSERT(ubjson_open_object(cookie) > 0);
+    TEST_ASSERT(ubjson_write_key(cookie, "a", 1) > 0);
+    TEST_ASSERT(ubjson_open_array(cookie) > 0);
+    TEST_ASSERT(ubjson_write_i32(cookie, 1) > 0);
+    TEST_ASSERT(ubjson_open_array(cookie) > 0);
+    TEST_ASSERT(ubjson_write_i32(cookie, 300) > 0);
+    TEST_ASSERT(ubjson_close_array(cookie) > 0);
+    TEST_ASSERT(ubjson_close_array(cookie) > 0);
+    TEST_ASSERT(ubjson_write_key(cookie, "bc", 2) > 0);
+    TEST_ASSERT(ubjson_write_null(cookie) > 0);
+    TEST_ASSERT(ubjson_close_object(cookie) > 0);
+    TEST_ASSERT_EQUAL_INT(0, _state.len % CHUNK_SIZE);
+    TEST_ASSERT(ubjson_write_flush(cookie) > 0);
+    TEST_ASSERT_EQUAL_INT(0, ubjson_write_flush(cookie));
+}
+
+void test_ubjson_iterative(void)
+{
+    static const char exp_data[] = "{i\x01" "a[i\x01" "[I\x01\x2c]]i\x02" "bcZ}";
+    static const ubjson_type_t exp_events[] = {
+        UBJSON_ENTER_OBJECT,
+        UBJSON_KEY, UBJSON_ENTER_ARRAY,
+        UBJSON_INDEX, UBJSON_TYPE_INT32,
+        UBJSON_INDEX, UBJSON_ENTER_ARRAY,
+        UBJSON_INDEX, UBJSON_TYPE_INT32,
+        UBJSON_LEAVE_ARRAY, UBJSON_LEAVE_ARRAY,
+        UBJSON_KEY, UBJSON_TYPE_NULL,
+        UBJSON_LEAVE_OBJECT,
+    };
+    static const ssize_t exp_contents[] = {
+        -1, 1, -1, 0, 1, 1, -1, 0, 300, 1, 2, 2, -1, 2,
+    };
+    ubjson_read_level_t stack[3];
+
+    memset(&_state, 0, sizeof(_state));
+    _write_document();
+    TEST_ASSERT_EQUAL_INT(sizeof(exp_data) - 1, _state.len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp_data, _state.data, _state.len));
+    TEST_ASSERT_EQUAL_INT((_state.len + CHUNK_SIZE - 1) / CHUNK_SIZE, _state.writes);
+
+    TEST_ASSERT_EQUAL_INT(UBJSON_OKAY,
+                          ubjson_read_iterative(&_state.cookie, _read_fun, _callback,
+                                                stack, NUMOF(stack)));
+    TEST_ASSERT_EQUAL_INT(_state.len, _state.pos);
+    TEST_ASSERT_EQUAL_INT(NUMOF(exp_events), _state.num_events);
+    for (unsigned i = 0; i < NUMOF(exp_events); ++i) {
+        TEST_ASSERT_EQUAL_INT(exp_events[i], _state.events[i]);
+        TEST_ASSERT_EQUAL_INT(exp_contents[i], _state.contents[i]);
+    }
+
+    /* too deeply nested for the stack */
+    _state.pos = 0;
+    _state.num_events = 0;
+    TEST_ASSERT_EQUAL_INT(UBJSON_SIZE_ERROR,
+                          ubjson_read_iterative(&_state.cookie, _read_fun, _callback,
+                                                stack, 2));
+}
@@ -45,6 +45,7 @@ void test_ubjson_test(void (*sender_fun)(void), void (*receiver_fun)(void));
 
 void test_ubjson_empty_array(void);
 void test_ubjson_empty_object(void);
+void test_ubjson_iterative(void);
 
 #ifdef __cplusplus
 }
@@ -128,6 +128,40 @@ static void test_vfs_constfs_open(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_constfs_openat(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    vfs_DIR dir;
+    res = vfs_opendir(&dir, "/test/");
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd;
+    fd = vfs_openat(&dir, "notfound", O_RDONLY, 0);
+    TEST_ASSERT(fd == -ENOENT);
+    fd = vfs_openat(&dir, "test.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    if (fd >= 0) {
+        char strbuf[64];
+        memset(strbuf, '\0', sizeof(strbuf));
+        TEST_ASSERT_EQUAL_INT(sizeof(str_data), vfs_read(fd, strbuf, sizeof(strbuf)));
+        TEST_ASSERT_EQUAL_STRING((const char *)&str_data[0], (const char *)&strbuf[0]);
+        res = vfs_close(fd);
+        TEST_ASSERT_EQUAL_INT(0, res);
+    }
+
+    /* open files and directories keep the file system mounted */
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT(res < 0);
+
+    res = vfs_closedir(&dir);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 static void test_vfs_constfs_read_lseek(void)
 {
     int res;
@@ -171,6 +205,99 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_constfs_readv(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/test.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    char head[5];
+    char tail[32];
+    memset(tail, '\0', sizeof(tail));
+    iolist_t tail_iol = { .iol_base = tail, .iol_len = sizeof(tail) };
+    iolist_t iol = { .iol_next = &tail_iol, .iol_base = head, .iol_len = sizeof(head) };
+    ssize_t nbytes = vfs_readv(fd, &iol);
+    TEST_ASSERT_EQUAL_INT(sizeof(str_data), nbytes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(str_data, head, sizeof(head)));
+    TEST_ASSERT_EQUAL_STRING((const char *)&str_data[sizeof(head)], (const char *)&tail[0]);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static uint8_t _sendfile_buf[64];
+static size_t _sendfile_len;
+
+static ssize_t _sendfile_cb(void *arg, const void *data, size_t len)
+{
+    size_t max = *(size_t *)arg;
+    if (len > max) {
+        len = max;
+    }
+    memcpy(&_sendfile_buf[_sendfile_len], data, len);
+    _sendfile_len += len;
+    return len;
+}
+
+static void test_vfs_constfs_sendfile(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/data.bin", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* consumer takes short chunks, constfs does not use the scratch buffer */
+    size_t max = 5;
+    _sendfile_len = 0;
+    ssize_t nbytes = vfs_sendfile(fd, _sendfile_cb, &max, NULL, 0, sizeof(_sendfile_buf));
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data), nbytes);
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data), _sendfile_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(bin_data, _sendfile_buf, sizeof(bin_data)));
+    TEST_ASSERT_EQUAL_INT(0, vfs_sendfile(fd, _sendfile_cb, &max, NULL, 0, 1));
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void test_vfs_constfs_mmap(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/data.bin", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    const void *addr = NULL;
+    res = vfs_mmap(fd, 0, sizeof(bin_data), &addr);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT(addr == bin_data);
+    res = vfs_mmap(fd, 8, 8, &addr);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT(addr == &bin_data[8]);
+    res = vfs_mmap(fd, 8, sizeof(bin_data), &addr);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, res);
+    res = vfs_mmap(fd, sizeof(bin_data) + 1, 0, &addr);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, res);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 #if MODULE_NEWLIB || defined(BOARD_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -209,7 +336,11 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_mount__invalid),
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
+        new_TestFixture(test_vfs_constfs_openat),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_constfs_readv),
+        new_TestFixture(test_vfs_constfs_sendfile),
+        new_TestFixture(test_vfs_constfs_mmap),
 #if MODULE_NEWLIB || defined(BOARD_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif